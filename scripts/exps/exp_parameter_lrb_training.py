@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+# exp_parameter_lrb_training: parameter analysis on inline vs. background model training of LRB (i.e., p99 GET latency w/ and w/o training stalls in the request path).
+# NOTE: training mode is is_lrb_background_training in config.json (shared by all machines) -> run this script once for each training mode, and compare tail latencies (and LRB training/inference counters in edge logs) under the two log dirpaths.
+
+from .utils.prototype import *
+
+# Check if current machine is an evaluator machine
+evaluator_machine_idx = JsonUtil.getValueForKeystr(Common.scriptname, "evaluator_machine_index")
+if Common.cur_machine_idx != evaluator_machine_idx:
+    LogUtil.die(Common.scriptname, "This script is only allowed to run on the evaluator machine")
+
+# Get training mode of LRB from config.json
+is_lrb_background_training = JsonUtil.getValueForKeystr(Common.scriptname, "is_lrb_background_training")
+lrb_training_mode = "background" if is_lrb_background_training == 1 else "inline"
+
+# Used to hint users for stable statistics on cache performance
+log_dirpaths = []
+
+# Get round indexes for the current experiment
+round_indexes = range(0, Common.exp_round_number) # [0, ..., exp_round_number-1]
+
+# Prepare settings for current experiment
+exp_default_settings = {
+    "clientcnt": 12,
+    "edgecnt": 12,
+    "keycnt": 1000000,
+    "capacity_mb": 1024,
+    "cache_name": "lrb",
+    "workload_name": "facebook"
+}
+# NOTE: more cache server workers contend on the local edge cache lock held by inline training
+percacheserver_workercnt_list = [1, 4]
+
+# Run the experiments with multiple rounds
+for tmp_round_index in round_indexes:
+    tmp_log_dirpath = "{}/exp_parameter_lrb_training/{}/round{}".format(Common.output_log_dirpath, lrb_training_mode, tmp_round_index)
+    log_dirpaths.append(tmp_log_dirpath)
+
+    # Create log dirpath if necessary
+    if not os.path.exists(tmp_log_dirpath):
+        LogUtil.prompt(Common.scriptname, "Create log dirpath {} for the current round {}...".format(tmp_log_dirpath, tmp_round_index))
+        SubprocessUtil.tryToCreateDirectory(Common.scriptname, tmp_log_dirpath, keep_silent = True)
+
+    # Run prototype for each per-cache-server worker count
+    for tmp_percacheserver_workercnt in percacheserver_workercnt_list:
+        tmp_log_filepath = "{}/tmp_evaluator_for_lrb_{}_worker{}.out".format(tmp_log_dirpath, lrb_training_mode, tmp_percacheserver_workercnt)
+        SubprocessUtil.tryToCreateDirectory(Common.scriptname, os.path.dirname(tmp_log_filepath))
+
+        # Check log filepath
+        if os.path.exists(tmp_log_filepath):
+            LogUtil.prompt(Common.scriptname, "Log filepath {} already exists, skip lrb w/ {} training and {} workers for the current round {}...".format(tmp_log_filepath, lrb_training_mode, tmp_percacheserver_workercnt, tmp_round_index))
+            continue
+
+        # NOTE: Log filepath MUST NOT exist here
+
+        # Prepare settings for the current worker count
+        tmp_exp_settings = exp_default_settings.copy()
+        tmp_exp_settings["percacheserver_workercnt"] = tmp_percacheserver_workercnt
+
+        # Launch prototype
+        LogUtil.prompt(Common.scriptname, "Run prototype of lrb w/ {} training and {} workers for the current round {}...".format(lrb_training_mode, tmp_percacheserver_workercnt, tmp_round_index))
+        prototype_instance = Prototype(evaluator_logfile = tmp_log_filepath, **tmp_exp_settings)
+        prototype_instance.run()
+
+# Hint users to check stable statistics of cache peformance in log files (p99 latency of inline vs. background training)
+LogUtil.emphasize(Common.scriptname, "Please check cache stable statistics (e.g., tail latency) in log files (at the end of each log file) in the following directories, and re-run this script after flipping is_lrb_background_training in config.json for the other training mode:\n{}".format(log_dirpaths))
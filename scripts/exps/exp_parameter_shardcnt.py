@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+# exp_parameter_shardcnt: parameter analysis on different numbers of per-cache-server workers and local edge cache shards (i.e., throughput scalability of local edge cache under concurrent accesses).
+
+from .utils.prototype import *
+
+# Check if current machine is an evaluator machine
+evaluator_machine_idx = JsonUtil.getValueForKeystr(Common.scriptname, "evaluator_machine_index")
+if Common.cur_machine_idx != evaluator_machine_idx:
+    LogUtil.die(Common.scriptname, "This script is only allowed to run on the evaluator machine")
+
+# Used to hint users for stable statistics on cache performance
+log_dirpaths = []
+
+# Get round indexes for the current experiment
+round_indexes = range(0, Common.exp_round_number) # [0, ..., exp_round_number-1]
+
+# Prepare settings for current experiment
+exp_default_settings = {
+    "clientcnt": 12,
+    "edgecnt": 12,
+    "keycnt": 1000000,
+    "capacity_mb": 1024,
+    "cache_name": "covered",
+    "workload_name": "facebook"
+}
+# NOTE: ONLY fine-grained cache management policies support local edge cache sharding (others fallback to a single shard w/ a warning)
+cache_names = ["covered", "shark", "shark+slru", "shark+sieve", "shark+arc", "shark+lfu", "shark+gdsf"]
+percacheserver_workercnt_list = [1, 2, 4, 8, 16]
+# NOTE: shardcnt of 1 is the baseline w/ a single rwlock for the entire local edge cache
+local_cache_shardcnt_list = [1, 16]
+
+# Run the experiments with multiple rounds
+for tmp_round_index in round_indexes:
+    tmp_log_dirpath = "{}/exp_parameter_shardcnt/round{}".format(Common.output_log_dirpath, tmp_round_index)
+    log_dirpaths.append(tmp_log_dirpath)
+
+    # Create log dirpath if necessary
+    if not os.path.exists(tmp_log_dirpath):
+        LogUtil.prompt(Common.scriptname, "Create log dirpath {} for the current round {}...".format(tmp_log_dirpath, tmp_round_index))
+        SubprocessUtil.tryToCreateDirectory(Common.scriptname, tmp_log_dirpath, keep_silent = True)
+    
+    # Run prototype for each cache name
+    for tmp_cache_name in cache_names:
+
+        # Run prototype for each local edge cache shard count
+        for tmp_local_cache_shardcnt in local_cache_shardcnt_list:
+
+            # Run prototype for each per-cache-server worker count
+            for tmp_percacheserver_workercnt in percacheserver_workercnt_list:
+                tmp_log_filepath = "{}/tmp_evaluator_for_{}_shard{}_worker{}.out".format(tmp_log_dirpath, tmp_cache_name, tmp_local_cache_shardcnt, tmp_percacheserver_workercnt)
+                SubprocessUtil.tryToCreateDirectory(Common.scriptname, os.path.dirname(tmp_log_filepath))
+
+                # Check log filepath
+                if os.path.exists(tmp_log_filepath):
+                    LogUtil.prompt(Common.scriptname, "Log filepath {} already exists, skip {} w/ {} shards and {} workers for the current round {}...".format(tmp_log_filepath, tmp_cache_name, tmp_local_cache_shardcnt, tmp_percacheserver_workercnt, tmp_round_index))
+                    continue
+
+                # NOTE: Log filepath MUST NOT exist here
+
+                # Prepare settings for the current cache name
+                tmp_exp_settings = exp_default_settings.copy()
+                tmp_exp_settings["cache_name"] = tmp_cache_name
+                tmp_exp_settings["local_cache_shardcnt"] = tmp_local_cache_shardcnt
+                tmp_exp_settings["percacheserver_workercnt"] = tmp_percacheserver_workercnt
+
+                # Launch prototype
+                LogUtil.prompt(Common.scriptname, "Run prototype of {} w/ {} shards and {} workers for the current round {}...".format(tmp_cache_name, tmp_local_cache_shardcnt, tmp_percacheserver_workercnt, tmp_round_index))
+                prototype_instance = Prototype(evaluator_logfile = tmp_log_filepath, **tmp_exp_settings)
+                prototype_instance.run()
+
+# Hint users to check stable statistics of cache peformance in log files (throughput vs. per-cache-server workers)
+LogUtil.emphasize(Common.scriptname, "Please check cache stable statistics (e.g., throughput) in log files (at the end of each log file) in the following directories:\n{}".format(log_dirpaths))
@@ -1,6 +1,10 @@
 #include "benchmark/client_worker_wrapper.h"
 
+#include <algorithm> // std::min
 #include <assert.h> // assert
+#include <errno.h> // errno
+#include <poll.h> // ppoll
+#include <random> // std::exponential_distribution
 #include <sstream>
 #include <time.h> // struct timespec
 
@@ -10,6 +14,7 @@
 #include "message/data_message.h"
 #include "network/network_addr.h"
 #include "network/propagation_simulator.h"
+#include "network/udp_pkt_socket.h"
 #include "statistics/client_statistics_tracker.h"
 #include "workload/workload_item.h"
 #include "workload/workload_wrapper_base.h"
@@ -17,6 +22,7 @@
 namespace covered
 {
     const std::string ClientWorkerWrapper::kClassName("ClientWorkerWrapper");
+    const double ClientWorkerWrapper::OPENLOOP_TIMEOUT_CHECK_INTERVAL_US = MS2US(10.0); // 10ms
 
     void* ClientWorkerWrapper::launchClientWorker(void* client_worker_param_ptr)
     {
@@ -80,7 +86,18 @@ namespace covered
         assert(warmup_reqcnt_limit_ > 0);
         assert(warmup_reqcnt_limit_ * total_client_workercnt >= total_warmup_reqcnt); // Total # of issued warmup reqs MUST >= total # of required warmup reqs
 
-        // (4) Initialize for real-net experiments
+        // (4) For open-loop client load modes
+
+        const std::string client_load_mode = client_wrapper_ptr->getClientLoadMode();
+        is_openloop_ = Util::isOpenloopClientLoadMode(client_load_mode);
+        is_poisson_arrival_ = (client_load_mode == Util::CLIENT_LOAD_POISSON_MODE_NAME);
+        arrival_randgen_.seed(Util::CLIENT_LOAD_ARRIVAL_SEED_BASE + global_client_worker_idx); // Different arrivals for different client workers
+        if (is_openloop_)
+        {
+            outstanding_reqs_.reserve(client_wrapper_ptr->getPerclientworkerMaxOutstandingReqcnt());
+        }
+
+        // (5) Initialize for real-net experiments
         // NOTE: NO need to implement as a virtual function due to NO difference with baselines and COVERED in client worker wrapper
         const std::string realnet_option = client_wrapper_ptr->getRealnetOption();
         if (realnet_option == Util::REALNET_LOAD_OPTION_NAME)
@@ -148,6 +165,13 @@ namespace covered
             bool is_monitored = tmp_client_wrapper_ptr->isMonitored();
             bool is_stresstest_phase = !is_warmup_phase;
 
+            // Issue requests on a rate-controlled schedule in stresstest phase for open-loop client load modes (NOTE: warmup phase is always closed-loop to warm up caches as fast as possible)
+            if (is_openloop_ && is_stresstest_phase)
+            {
+                issueOpenloopItemsToEdge_(is_warmup_speedup); // Return after client is NOT running
+                break;
+            }
+
             // Consider per-client-worker warmup reqcnt limitation to avoid inconsistent warmup progress (under second-level evaluator monitoring) among different caches due to different warmup speed
             if (is_warmup_phase)
             {
@@ -203,20 +227,7 @@ namespace covered
         {
             if (!is_stale_response)
             {
-                // Convert workload item into local request message
-                MessageBase* local_request_ptr = MessageBase::getRequestFromWorkloadItem(workload_item, tmp_client_wrapper_ptr->getNodeIdx(), client_worker_recvrsp_source_addr_, is_warmup_phase, is_warmup_speedup, is_monitored, cur_msg_seqnum);
-                assert(local_request_ptr != NULL);
-
-                #ifdef DEBUG_CLIENT_WORKER_WRAPPER
-                Util::dumpVariablesForDebug(instance_name_, 7, "issue a local request;", "type:", MessageBase::messageTypeToString(local_request_ptr->getMessageType()).c_str(), "keystr:", workload_item.getKey().getKeystr().c_str(), "valuesize:", std::to_string(workload_item.getValue().getValuesize()).c_str());
-                #endif
-
-                // Push local request into client-to-edge propagation simulator to send to closest edge node
-                bool is_successful = tmp_client_wrapper_ptr->getClientToedgePropagationSimulatorParamPtr()->push(local_request_ptr, closest_edge_cache_server_recvreq_dst_addr_);
-                assert(is_successful);
-                
-                // NOTE: local_request_ptr will be released by client-to-edge propagation simulator
-                local_request_ptr = NULL;
+                sendLocalRequest_(workload_item, is_warmup_phase, is_warmup_speedup, is_monitored, cur_msg_seqnum);
             }
 
             // Receive the message payload of local response from the closest edge node
@@ -269,6 +280,186 @@ namespace covered
         return is_finish;
     }
 
+    void ClientWorkerWrapper::issueOpenloopItemsToEdge_(const bool& is_warmup_speedup)
+    {
+        checkPointers_();
+        ClientWrapper* tmp_client_wrapper_ptr = client_worker_param_ptr_->getClientWrapperPtr();
+        const uint32_t local_client_worker_idx = client_worker_param_ptr_->getLocalClientWorkerIdx();
+        WorkloadWrapperBase* workload_generator_ptr = tmp_client_wrapper_ptr->getWorkloadWrapperPtr();
+        const uint32_t max_outstanding_reqcnt = tmp_client_wrapper_ptr->getPerclientworkerMaxOutstandingReqcnt();
+        const double timeout_us = static_cast<double>(SEC2US(UdpPktSocket::SOCKET_TIMEOUT_SECONDS) + UdpPktSocket::SOCKET_TIMEOUT_USECONDS); // The same as the timeout of closed-loop issuing
+
+        const bool is_warmup_phase = false; // NOTE: open-loop issuing is ONLY for stresstest phase
+        const bool is_stresstest_phase = true;
+
+        // NOTE: all time points are relative to start_timestamp in units of us
+        const struct timespec start_timestamp = Util::getCurrentTimespec();
+        double next_scheduled_us = 0.0;
+        double prev_timeout_check_us = 0.0;
+        while (tmp_client_wrapper_ptr->isNodeRunning())
+        {
+            const bool is_monitored = tmp_client_wrapper_ptr->isMonitored();
+            const double cur_us = Util::getDeltaTimeUs(Util::getCurrentTimespec(), start_timestamp);
+
+            // (1) Issue all requests whose scheduled send time has arrived
+            // NOTE: if reaching max outstanding reqcnt, scheduled requests are delayed, yet still measured from the scheduled send time
+            while (next_scheduled_us <= cur_us && outstanding_reqs_.size() < max_outstanding_reqcnt)
+            {
+                bool is_dynamic_mapped = false;
+                WorkloadItem workload_item = workload_generator_ptr->generateWorkloadItem(local_client_worker_idx, &is_dynamic_mapped);
+                const uint64_t cur_msg_seqnum = tmp_client_wrapper_ptr->getAndIncrNodeMsgSeqnum();
+
+                sendLocalRequest_(workload_item, is_warmup_phase, is_warmup_speedup, is_monitored, cur_msg_seqnum);
+                outstanding_reqs_.insert(std::pair<uint64_t, OpenloopRequest>(cur_msg_seqnum, OpenloopRequest(workload_item, next_scheduled_us, cur_us, is_dynamic_mapped)));
+
+                next_scheduled_us += getNextInterarrivalUs_();
+            }
+
+            // (2) Poll local response w/o blocking the schedule
+            DynamicArray local_response_msg_payload;
+            bool is_timeout = client_worker_recvrsp_socket_server_ptr_->recv(local_response_msg_payload, true); // Nonblocking
+            if (!is_timeout)
+            {
+                const double recvrsp_us = Util::getDeltaTimeUs(Util::getCurrentTimespec(), start_timestamp);
+
+                MessageBase* local_response_ptr = MessageBase::getResponseFromMsgPayload(local_response_msg_payload);
+                assert(local_response_ptr != NULL);
+                const uint64_t tmp_msg_seqnum = local_response_ptr->getExtraCommonMsghdr().getMsgSeqnum();
+                delete local_response_ptr;
+                local_response_ptr = NULL;
+
+                std::unordered_map<uint64_t, OpenloopRequest>::iterator outstanding_req_iter = outstanding_reqs_.find(tmp_msg_seqnum);
+                if (outstanding_req_iter == outstanding_reqs_.end()) // Stale response (e.g., duplicate response of a resent request, or response of a closed-loop warmup request)
+                {
+                    std::ostringstream oss;
+                    oss << "stale response with seqnum " << tmp_msg_seqnum << " for open-loop issuing";
+                    Util::dumpWarnMsg(instance_name_, oss.str());
+                }
+                else
+                {
+                    // Measure latency from the scheduled send time instead of the actual send time (coordinated-omission-safe)
+                    const OpenloopRequest& tmp_outstanding_req = outstanding_req_iter->second;
+                    const uint32_t latency_us = static_cast<uint32_t>(recvrsp_us - tmp_outstanding_req.scheduled_us);
+                    processLocalResponse_(tmp_outstanding_req.workload_item, local_response_msg_payload, latency_us, is_stresstest_phase, tmp_outstanding_req.is_dynamic_mapped);
+
+                    outstanding_reqs_.erase(outstanding_req_iter);
+                }
+            }
+
+            // NOTE: check timeout in every round (even if responses keep arriving), otherwise lost requests will occupy outstanding slots forever
+            if (cur_us - prev_timeout_check_us >= OPENLOOP_TIMEOUT_CHECK_INTERVAL_US)
+            {
+                // (3) Resend timeout outstanding requests with the same msg seqnums
+                for (std::unordered_map<uint64_t, OpenloopRequest>::iterator outstanding_req_iter = outstanding_reqs_.begin(); outstanding_req_iter != outstanding_reqs_.end(); outstanding_req_iter++)
+                {
+                    OpenloopRequest& tmp_outstanding_req = outstanding_req_iter->second;
+                    if (cur_us - tmp_outstanding_req.sendreq_us >= timeout_us)
+                    {
+                        std::ostringstream oss;
+                        oss << "client timeout to wait for local response for key " << tmp_outstanding_req.workload_item.getKey().getKeyDebugstr() << " from edge " << closest_edge_idx_;
+                        Util::dumpWarnMsg(instance_name_, oss.str());
+
+                        sendLocalRequest_(tmp_outstanding_req.workload_item, is_warmup_phase, is_warmup_speedup, is_monitored, outstanding_req_iter->first);
+                        tmp_outstanding_req.sendreq_us = cur_us;
+                    }
+                }
+
+                prev_timeout_check_us = cur_us;
+            }
+
+            if (is_timeout)
+            {
+                // (4) Block until the next response, scheduled send time (if NOT reaching max outstanding reqcnt), or timeout check instead of busy polling
+                double next_wakeup_us = prev_timeout_check_us + OPENLOOP_TIMEOUT_CHECK_INTERVAL_US;
+                if (outstanding_reqs_.size() < max_outstanding_reqcnt)
+                {
+                    next_wakeup_us = std::min(next_wakeup_us, next_scheduled_us);
+                }
+                const double wait_us = next_wakeup_us - Util::getDeltaTimeUs(Util::getCurrentTimespec(), start_timestamp);
+                if (wait_us > 0.0)
+                {
+                    waitForLocalResponse_(wait_us);
+                }
+            }
+        }
+
+        outstanding_reqs_.clear(); // Drop in-flight requests after client is NOT running
+        return;
+    }
+
+    void ClientWorkerWrapper::waitForLocalResponse_(const double& wait_us) const
+    {
+        assert(wait_us > 0.0);
+        assert(client_worker_recvrsp_socket_server_ptr_ != NULL);
+
+        struct pollfd tmp_pollfd;
+        tmp_pollfd.fd = client_worker_recvrsp_socket_server_ptr_->getSockfd();
+        tmp_pollfd.events = POLLIN;
+        tmp_pollfd.revents = 0;
+
+        struct timespec tmp_wait_timespec;
+        const uint64_t tmp_wait_us = static_cast<uint64_t>(wait_us);
+        tmp_wait_timespec.tv_sec = static_cast<time_t>(tmp_wait_us / 1000000);
+        tmp_wait_timespec.tv_nsec = static_cast<long>((tmp_wait_us % 1000000) * 1000);
+
+        int return_code = ppoll(&tmp_pollfd, 1, &tmp_wait_timespec, NULL);
+        if (return_code < 0 && errno != EINTR)
+        {
+            std::ostringstream oss;
+            oss << "failed to wait for local response (errno: " << errno << ")";
+            Util::dumpWarnMsg(instance_name_, oss.str());
+        }
+
+        return;
+    }
+
+    double ClientWorkerWrapper::getNextInterarrivalUs_()
+    {
+        checkPointers_();
+        ClientWrapper* tmp_client_wrapper_ptr = client_worker_param_ptr_->getClientWrapperPtr();
+
+        // NOTE: per-client target rate may be updated by evaluator for throughput-latency sweep
+        const uint32_t perclient_target_rate = tmp_client_wrapper_ptr->getPerclientTargetRate();
+        assert(perclient_target_rate > 0);
+        const double perworker_rate_perus = static_cast<double>(perclient_target_rate) / static_cast<double>(tmp_client_wrapper_ptr->getPerclientWorkercnt()) / static_cast<double>(SEC2US(1));
+
+        double interarrival_us = 0.0;
+        if (is_poisson_arrival_)
+        {
+            std::exponential_distribution<double> interarrival_dist(perworker_rate_perus);
+            interarrival_us = interarrival_dist(arrival_randgen_);
+        }
+        else
+        {
+            interarrival_us = 1.0 / perworker_rate_perus;
+        }
+        return interarrival_us;
+    }
+
+    void ClientWorkerWrapper::sendLocalRequest_(const WorkloadItem& workload_item, const bool& is_warmup_phase, const bool& is_warmup_speedup, const bool& is_monitored, const uint64_t& cur_msg_seqnum)
+    {
+        checkPointers_();
+        ClientWrapper* tmp_client_wrapper_ptr = client_worker_param_ptr_->getClientWrapperPtr();
+
+        // Convert workload item into local request message
+        MessageBase* local_request_ptr = MessageBase::getRequestFromWorkloadItem(workload_item, tmp_client_wrapper_ptr->getNodeIdx(), client_worker_recvrsp_source_addr_, is_warmup_phase, is_warmup_speedup, is_monitored, cur_msg_seqnum);
+        assert(local_request_ptr != NULL);
+
+        #ifdef DEBUG_CLIENT_WORKER_WRAPPER
+        Util::dumpVariablesForDebug(instance_name_, 7, "issue a local request;", "type:", MessageBase::messageTypeToString(local_request_ptr->getMessageType()).c_str(), "keystr:", workload_item.getKey().getKeystr().c_str(), "valuesize:", std::to_string(workload_item.getValue().getValuesize()).c_str());
+        #endif
+
+        // Push local request into client-to-edge propagation simulator to send to closest edge node
+        bool is_successful = tmp_client_wrapper_ptr->getClientToedgePropagationSimulatorParamPtr()->push(local_request_ptr, closest_edge_cache_server_recvreq_dst_addr_);
+        assert(is_successful);
+        UNUSED(is_successful);
+
+        // NOTE: local_request_ptr will be released by client-to-edge propagation simulator
+        local_request_ptr = NULL;
+
+        return;
+    }
+
     void ClientWorkerWrapper::processLocalResponse_(const WorkloadItem& workload_item, const DynamicArray& local_response_msg_payload, const uint32_t& rtt_us, const bool& is_stresstest_phase, const bool& is_dynamic_mapped)
     {
         checkPointers_();
@@ -2,6 +2,8 @@
  * ClientWorkerWrapper: a worker thread launched by client to issue local requests and receive responses.
  *
  * NOTE: client worker will convert generated workload items (generated by an underlying workload, e.g., CacheBench) into local requests to test remote cache.
+ *
+ * NOTE: for open-loop client load modes, client worker issues requests in stresstest phase on a Poisson/constant-rate schedule with up to perclientworker_max_outstanding_reqcnt in-flight requests, and measures latency from the scheduled send time instead of the actual send time (i.e., coordinated-omission-safe: queueing delay in client side is NOT hidden if the system falls behind the offered load).
  * 
  * By Siyuan Sheng (2023.04.20).
  */
@@ -11,11 +13,14 @@
 
 //#define DEBUG_CLIENT_WORKER_WRAPPER
 
+#include <random> // std::mt19937_64
 #include <string>
+#include <unordered_map>
 
 #include "benchmark/client_worker_param.h"
 #include "message/message_base.h"
 #include "network/udp_msg_socket_server.h"
+#include "workload/workload_item.h"
 
 namespace covered
 {
@@ -30,6 +35,23 @@ namespace covered
         void start();
     private:
         static const std::string kClassName;
+        static const double OPENLOOP_TIMEOUT_CHECK_INTERVAL_US; // Interval to check timeout of outstanding requests for open-loop client load modes
+
+        // In-flight local request for open-loop client load modes
+        struct OpenloopRequest
+        {
+            OpenloopRequest(const WorkloadItem& tmp_workload_item, const double& tmp_scheduled_us, const double& tmp_sendreq_us, const bool& tmp_is_dynamic_mapped) : workload_item(tmp_workload_item), scheduled_us(tmp_scheduled_us), sendreq_us(tmp_sendreq_us), is_dynamic_mapped(tmp_is_dynamic_mapped) {}
+
+            WorkloadItem workload_item;
+            double scheduled_us; // Scheduled send time relative to the start of open-loop issuing (used to measure latency)
+            double sendreq_us; // Latest actual send time relative to the start of open-loop issuing (used to detect timeout)
+            bool is_dynamic_mapped;
+        };
+
+        void issueOpenloopItemsToEdge_(const bool& is_warmup_speedup); // Open-loop issuing for stresstest phase until client is NOT running
+        double getNextInterarrivalUs_(); // Based on the latest per-client target rate
+        void waitForLocalResponse_(const double& wait_us) const; // Block until a local response arrives or wait_us elapses (for open-loop issuing w/o busy polling)
+        void sendLocalRequest_(const WorkloadItem& workload_item, const bool& is_warmup_phase, const bool& is_warmup_speedup, const bool& is_monitored, const uint64_t& cur_msg_seqnum);
 
         bool issueItemToEdge_(const WorkloadItem& workload_item, DynamicArray& local_response_msg_payload, uint32_t& rtt_us, const bool& is_warmup_phase, const bool& is_warmup_speedup, const bool& is_monitored, const uint64_t& cur_msg_seqnum); // Return is_finish
         void processLocalResponse_(const WorkloadItem& workload_item, const DynamicArray& local_response_msg_payload, const uint32_t& rtt_us, const bool& is_stresstest_phase, const bool& is_dynamic_mapped);
@@ -51,6 +73,12 @@ namespace covered
         // (3) For per-client-worker warmup reqcnt limitation
         uint32_t cur_warmup_reqcnt_;
         uint32_t warmup_reqcnt_limit_;
+
+        // (4) For open-loop client load modes
+        bool is_openloop_; // Come from CLI
+        bool is_poisson_arrival_; // Come from CLI (Poisson or constant inter-arrival time)
+        std::mt19937_64 arrival_randgen_; // Generate Poisson inter-arrival time
+        std::unordered_map<uint64_t, OpenloopRequest> outstanding_reqs_; // Key: msg seqnum of in-flight local request
     };
 }
 
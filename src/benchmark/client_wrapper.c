@@ -61,14 +61,14 @@ namespace covered
         uint32_t client_idx = client_wrapper_param.getClientIdx();
         ClientCLI* client_cli_ptr = client_wrapper_param.getClientCLIPtr();
         
-        ClientWrapper local_client(client_cli_ptr->getCapacityBytes(), client_idx, client_cli_ptr->getClientcnt(), client_cli_ptr->isWarmupSpeedup(), client_cli_ptr->getEdgecnt(), client_cli_ptr->getKeycnt(), client_cli_ptr->getPerclientOpcnt(), client_cli_ptr->getPerclientWorkercnt(), client_cli_ptr->getCLILatencyInfo(), client_cli_ptr->getRealnetOption(), client_cli_ptr->getWarmupReqcntScale(), client_cli_ptr->getWorkloadName(), client_cli_ptr->getZipfAlpha(), client_cli_ptr->getWorkloadPatternName(), client_cli_ptr->getDynamicChangePeriod(), client_cli_ptr->getDynamicChangeKeycnt());
+        ClientWrapper local_client(client_cli_ptr->getCapacityBytes(), client_idx, client_cli_ptr->getClientcnt(), client_cli_ptr->isWarmupSpeedup(), client_cli_ptr->getEdgecnt(), client_cli_ptr->getKeycnt(), client_cli_ptr->getPerclientOpcnt(), client_cli_ptr->getPerclientWorkercnt(), client_cli_ptr->getCLILatencyInfo(), client_cli_ptr->getRealnetOption(), client_cli_ptr->getWarmupReqcntScale(), client_cli_ptr->getClientLoadMode(), client_cli_ptr->getPerclientTargetRate(), client_cli_ptr->getPerclientworkerMaxOutstandingReqcnt(), client_cli_ptr->getWorkloadName(), client_cli_ptr->getZipfAlpha(), client_cli_ptr->getWorkloadPatternName(), client_cli_ptr->getDynamicChangePeriod(), client_cli_ptr->getDynamicChangeKeycnt());
         local_client.start();
         
         pthread_exit(NULL);
         return NULL;
     }
 
-    ClientWrapper::ClientWrapper(const uint64_t& capacity_bytes, const uint32_t& client_idx, const uint32_t& clientcnt, const bool& is_warmup_speedup, const uint32_t& edgecnt, const uint32_t& keycnt, const uint32_t& perclient_opcnt, const uint32_t& perclient_workercnt, const CLILatencyInfo& cli_latency_info, const std::string& realnet_option, const uint32_t& warmup_reqcnt_scale, const std::string& workload_name, const float& zipf_alpha, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period, const uint32_t& dynamic_change_keycnt) : NodeWrapperBase(NodeWrapperBase::CLIENT_NODE_ROLE, client_idx, clientcnt, false), is_warmup_speedup_(is_warmup_speedup), capacity_bytes_(capacity_bytes), edgecnt_(edgecnt), keycnt_(keycnt), perclient_workercnt_(perclient_workercnt), realnet_option_(realnet_option), warmup_reqcnt_scale_(warmup_reqcnt_scale), is_warmup_phase_(true), is_monitored_(false)
+    ClientWrapper::ClientWrapper(const uint64_t& capacity_bytes, const uint32_t& client_idx, const uint32_t& clientcnt, const bool& is_warmup_speedup, const uint32_t& edgecnt, const uint32_t& keycnt, const uint32_t& perclient_opcnt, const uint32_t& perclient_workercnt, const CLILatencyInfo& cli_latency_info, const std::string& realnet_option, const uint32_t& warmup_reqcnt_scale, const std::string& client_load_mode, const uint32_t& perclient_target_rate, const uint32_t& perclientworker_max_outstanding_reqcnt, const std::string& workload_name, const float& zipf_alpha, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period, const uint32_t& dynamic_change_keycnt) : NodeWrapperBase(NodeWrapperBase::CLIENT_NODE_ROLE, client_idx, clientcnt, false), is_warmup_speedup_(is_warmup_speedup), capacity_bytes_(capacity_bytes), edgecnt_(edgecnt), keycnt_(keycnt), perclient_workercnt_(perclient_workercnt), realnet_option_(realnet_option), warmup_reqcnt_scale_(warmup_reqcnt_scale), client_load_mode_(client_load_mode), perclientworker_max_outstanding_reqcnt_(perclientworker_max_outstanding_reqcnt), is_warmup_phase_(true), is_monitored_(false), perclient_target_rate_(perclient_target_rate)
     {
         // Differentiate different clients
         std::ostringstream oss;
@@ -198,6 +198,21 @@ namespace covered
         return warmup_reqcnt_scale_;
     }
 
+    std::string ClientWrapper::getClientLoadMode() const
+    {
+        return client_load_mode_;
+    }
+
+    uint32_t ClientWrapper::getPerclientTargetRate() const
+    {
+        return perclient_target_rate_.load(Util::LOAD_CONCURRENCY_ORDER);
+    }
+
+    uint32_t ClientWrapper::getPerclientworkerMaxOutstandingReqcnt() const
+    {
+        return perclientworker_max_outstanding_reqcnt_;
+    }
+
     bool ClientWrapper::isWarmupPhase() const
     {
         return is_warmup_phase_.load(Util::LOAD_CONCURRENCY_ORDER);
@@ -321,6 +336,10 @@ namespace covered
         {
             processUpdateRulesRequest_(control_request_ptr); // Update dynamic workload rules
         }
+        else if (control_request_msg_type == MessageType::kSetLoadRateRequest)
+        {
+            processSetLoadRateRequest_(control_request_ptr); // Update perclient_target_rate_ for open-loop client load modes
+        }
         else
         {
             std::ostringstream oss;
@@ -406,6 +425,24 @@ namespace covered
         return;
     }
 
+    void ClientWrapper::processSetLoadRateRequest_(MessageBase* control_request_ptr)
+    {
+        assert(control_request_ptr != NULL);
+
+        const SetLoadRateRequest* const set_load_rate_request_ptr = static_cast<const SetLoadRateRequest*>(control_request_ptr);
+        const uint32_t perclient_target_rate = set_load_rate_request_ptr->getPerclientTargetRate();
+        assert(perclient_target_rate > 0);
+
+        // Update target rate, which will be used by client workers for the following scheduled requests
+        perclient_target_rate_.store(perclient_target_rate, Util::STORE_CONCURRENCY_ORDER);
+
+        // Send back SetLoadRateResponse to evaluator
+        SetLoadRateResponse set_load_rate_response(node_idx_, node_recvmsg_source_addr_, EventList(), control_request_ptr->getExtraCommonMsghdr().getMsgSeqnum());
+        node_sendmsg_socket_client_ptr_->send((MessageBase*)&set_load_rate_response, evaluator_recvmsg_dst_addr_);
+
+        return;
+    }
+
     // (3) Other utility functions
 
     void ClientWrapper::finishWarmupPhase_()
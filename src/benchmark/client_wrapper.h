@@ -50,7 +50,7 @@ namespace covered
     public:
         static void* launchClient(void* client_wrapper_param_ptr);
 
-        ClientWrapper(const uint64_t& capacity_bytes, const uint32_t& client_idx, const uint32_t& clientcnt, const bool& is_warmup_speedup, const uint32_t& edgecnt, const uint32_t& keycnt, const uint32_t& perclient_opcnt, const uint32_t& perclient_workercnt, const CLILatencyInfo& cli_latency_info, const std::string& realnet_option, const uint32_t& warmup_reqcnt_scale, const std::string& workload_name, const float& zipf_alpha, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period, const uint32_t& dynamic_change_keycnt);
+        ClientWrapper(const uint64_t& capacity_bytes, const uint32_t& client_idx, const uint32_t& clientcnt, const bool& is_warmup_speedup, const uint32_t& edgecnt, const uint32_t& keycnt, const uint32_t& perclient_opcnt, const uint32_t& perclient_workercnt, const CLILatencyInfo& cli_latency_info, const std::string& realnet_option, const uint32_t& warmup_reqcnt_scale, const std::string& client_load_mode, const uint32_t& perclient_target_rate, const uint32_t& perclientworker_max_outstanding_reqcnt, const std::string& workload_name, const float& zipf_alpha, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period, const uint32_t& dynamic_change_keycnt);
         virtual ~ClientWrapper();
 
         // (1) Const getters
@@ -61,6 +61,9 @@ namespace covered
         uint32_t getPerclientWorkercnt() const;
         std::string getRealnetOption() const;
         uint32_t getWarmupReqcntScale() const;
+        std::string getClientLoadMode() const;
+        uint32_t getPerclientTargetRate() const; // NOTE: may be updated by evaluator for throughput-latency sweep
+        uint32_t getPerclientworkerMaxOutstandingReqcnt() const;
         bool isWarmupPhase() const;
         bool isMonitored() const;
         WorkloadWrapperBase* getWorkloadWrapperPtr() const;
@@ -79,6 +82,7 @@ namespace covered
         void processSwitchSlotRequest_(MessageBase* control_request_ptr);
         void processFinishWarmupRequest_(MessageBase* control_request_ptr);
         void processUpdateRulesRequest_(MessageBase* control_request_ptr);
+        void processSetLoadRateRequest_(MessageBase* control_request_ptr);
 
         // (3) Other utility functions
 
@@ -94,6 +98,8 @@ namespace covered
         const uint32_t perclient_workercnt_; // Come from CLI
         const std::string realnet_option_; // Come from CLI
         const uint32_t warmup_reqcnt_scale_; // Come from CLI
+        const std::string client_load_mode_; // Come from CLI
+        const uint32_t perclientworker_max_outstanding_reqcnt_; // Come from CLI
 
         // Const individual variable
         std::string instance_name_;
@@ -102,6 +108,9 @@ namespace covered
         std::atomic<bool> is_warmup_phase_;
         std::atomic<bool> is_monitored_;
 
+        // Non-const shared variable for open-loop client load modes
+        std::atomic<uint32_t> perclient_target_rate_; // Initialized by CLI, yet updated by evaluator for throughput-latency sweep
+
         // Non-const shared variables
         WorkloadWrapperBase* workload_generator_ptr_; // thread safe
         ClientStatisticsTracker* client_statistics_tracker_ptr_; // thread safe
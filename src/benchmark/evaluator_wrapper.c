@@ -1,5 +1,6 @@
 #include "benchmark/evaluator_wrapper.h"
 
+#include <algorithm> // std::max
 #include <assert.h>
 #include <sstream>
 #include <unistd.h> // sleep
@@ -22,6 +23,8 @@ namespace covered
     //const bool EvaluatorWrapper::IS_HIGH_PRIORITY_FOR_EVALUATOR = true;
     const bool EvaluatorWrapper::IS_HIGH_PRIORITY_FOR_EVALUATOR = false; // TMPDEBUG
 
+    const double EvaluatorWrapper::OPENLOOP_SWEEP_SATURATION_THROUGHPUT_RATIO = 0.95;
+
     const std::string EvaluatorWrapper::kClassName("EvaluatorWrapper");
 
     EvaluatorWrapperParam::EvaluatorWrapperParam() : SubthreadParamBase()
@@ -63,7 +66,7 @@ namespace covered
         EvaluatorCLI* evaluator_cli_ptr = evaluator_wrapper_param.getEvaluatorCLIPtr();
         std::string evaluator_statistics_filepath = Util::getEvaluatorStatisticsFilepath(evaluator_cli_ptr);
 
-        EvaluatorWrapper evaluator(evaluator_cli_ptr->getClientcnt(), evaluator_cli_ptr->getEdgecnt(), evaluator_cli_ptr->getKeycnt(), evaluator_cli_ptr->getWarmupReqcntScale(), evaluator_cli_ptr->getWarmupMaxDurationSec(), evaluator_cli_ptr->getStresstestDurationSec(), evaluator_statistics_filepath, evaluator_cli_ptr->getRealnetOption(), evaluator_cli_ptr->getWorkloadPatternName(), evaluator_cli_ptr->getDynamicChangePeriod());
+        EvaluatorWrapper evaluator(evaluator_cli_ptr->getClientcnt(), evaluator_cli_ptr->getEdgecnt(), evaluator_cli_ptr->getKeycnt(), evaluator_cli_ptr->getWarmupReqcntScale(), evaluator_cli_ptr->getWarmupMaxDurationSec(), evaluator_cli_ptr->getStresstestDurationSec(), evaluator_statistics_filepath, evaluator_cli_ptr->getRealnetOption(), evaluator_cli_ptr->getWorkloadPatternName(), evaluator_cli_ptr->getDynamicChangePeriod(), evaluator_cli_ptr->getPerclientTargetRate(), evaluator_cli_ptr->getOpenloopSweepRateStep(), evaluator_cli_ptr->getOpenloopSweepPeriodSec());
         evaluator_wrapper_param.markFinishInitialization(); // Such that simulator or prototype will continue to launch cloud, edge, and client nodes
 
         evaluator.start();
@@ -72,7 +75,7 @@ namespace covered
         return NULL;
     }
 
-    EvaluatorWrapper::EvaluatorWrapper(const uint32_t& clientcnt, const uint32_t& edgecnt, const uint32_t& keycnt, const uint32_t& warmup_reqcnt_scale, const uint32_t& warmup_max_duration_sec, const uint32_t& stresstest_duration_sec, const std::string& evaluator_statistics_filepath, const std::string& realnet_option, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period) : clientcnt_(clientcnt), edgecnt_(edgecnt), warmup_reqcnt_(keycnt * warmup_reqcnt_scale), warmup_max_duration_sec_(warmup_max_duration_sec), stresstest_duration_sec_(stresstest_duration_sec), evaluator_statistics_filepath_(evaluator_statistics_filepath), realnet_option_(realnet_option), evaluator_msg_seqnum_(0), workload_pattern_name_(workload_pattern_name), dynamic_change_period_(dynamic_change_period)
+    EvaluatorWrapper::EvaluatorWrapper(const uint32_t& clientcnt, const uint32_t& edgecnt, const uint32_t& keycnt, const uint32_t& warmup_reqcnt_scale, const uint32_t& warmup_max_duration_sec, const uint32_t& stresstest_duration_sec, const std::string& evaluator_statistics_filepath, const std::string& realnet_option, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period, const uint32_t& perclient_target_rate, const uint32_t& openloop_sweep_rate_step, const uint32_t& openloop_sweep_period_sec) : clientcnt_(clientcnt), edgecnt_(edgecnt), warmup_reqcnt_(keycnt * warmup_reqcnt_scale), warmup_max_duration_sec_(warmup_max_duration_sec), stresstest_duration_sec_(stresstest_duration_sec), evaluator_statistics_filepath_(evaluator_statistics_filepath), realnet_option_(realnet_option), evaluator_msg_seqnum_(0), workload_pattern_name_(workload_pattern_name), dynamic_change_period_(dynamic_change_period), openloop_sweep_rate_step_(openloop_sweep_rate_step), openloop_sweep_period_sec_(openloop_sweep_period_sec)
     {
         if (realnet_option == Util::REALNET_LOAD_OPTION_NAME)
         {
@@ -85,6 +88,11 @@ namespace covered
         target_slot_idx_ = 0;
         dynamic_period_idx_ = 0;
 
+        cur_perclient_target_rate_ = perclient_target_rate;
+        sweep_step_idx_ = 0;
+        sweep_step_begin_slotidx_ = 0;
+        is_saturated_ = false;
+
         // (1) Manage evaluation phases
 
         // Prepare evaluator recvmsg source addr
@@ -327,6 +335,7 @@ namespace covered
         struct timespec start_timestamp = Util::getCurrentTimespec(); // For max duration of warmup phase and duration of stresstest phase
         struct timespec prev_timestamp = start_timestamp; // For switch slot
         struct timespec prev_timestamp_to_update_rules = start_timestamp; // For dynamic workload patterns
+        struct timespec prev_timestamp_to_sweep = start_timestamp; // For throughput-latency sweep of open-loop client load modes
         bool is_monitored = false; // Whether to monitor messages for debugging
         while (true)
         {
@@ -346,6 +355,12 @@ namespace covered
                     // Notify client/edge/cloud to finish run
                     notifyAllToFinishrun_(); // Update per-slot/stable total aggregated statistics
 
+                    // Summarize the last sweep step after the last-slot total aggregated statistics are updated
+                    if (openloop_sweep_rate_step_ > 0)
+                    {
+                        dumpOpenloopSweepStep_();
+                    }
+
                     break;
                 }
 
@@ -362,6 +377,12 @@ namespace covered
                         prev_timestamp_to_update_rules = cur_timestamp;
                     }
                 }
+
+                // For throughput-latency sweep of open-loop client load modes
+                if (openloop_sweep_rate_step_ > 0)
+                {
+                    checkOpenloopSweep_(cur_timestamp, prev_timestamp_to_sweep);
+                }
             }
 
             // Switch cur-slot client raw statistics to track per-slot aggregated statistics
@@ -396,6 +417,10 @@ namespace covered
 
                     // Reset prev_timestamp_to_update_rules for dynamic workload patterns during stresstest phase
                     prev_timestamp_to_update_rules = start_timestamp;
+
+                    // Reset prev_timestamp_to_sweep and the first slot of the first sweep step for throughput-latency sweep during stresstest phase
+                    prev_timestamp_to_sweep = start_timestamp;
+                    sweep_step_begin_slotidx_ = target_slot_idx_;
                 } // End of finish warmup phase
             } // End if (is_warmup_phase == true)
 
@@ -503,6 +528,7 @@ namespace covered
         struct timespec start_timestamp = Util::getCurrentTimespec(); // For max duration of warmup phase and duration of stresstest phase
         struct timespec prev_timestamp = start_timestamp; // For switch slot
         struct timespec prev_timestamp_to_update_rules = start_timestamp; // For dynamic workload patterns
+        struct timespec prev_timestamp_to_sweep = start_timestamp; // For throughput-latency sweep of open-loop client load modes
         bool is_monitored = false; // Whether to monitor messages for debugging
         while (true)
         {
@@ -524,6 +550,12 @@ namespace covered
                     // Notify client/edge/cloud to finish run
                     notifyAllToFinishrun_(); // Update per-slot/stable total aggregated statistics
 
+                    // Summarize the last sweep step after the last-slot total aggregated statistics are updated
+                    if (openloop_sweep_rate_step_ > 0)
+                    {
+                        dumpOpenloopSweepStep_();
+                    }
+
                     break;
                 }
 
@@ -540,6 +572,12 @@ namespace covered
                         prev_timestamp_to_update_rules = cur_timestamp;
                     }
                 }
+
+                // For throughput-latency sweep of open-loop client load modes
+                if (openloop_sweep_rate_step_ > 0)
+                {
+                    checkOpenloopSweep_(cur_timestamp, prev_timestamp_to_sweep);
+                }
             }
 
             // Switch cur-slot client raw statistics to track per-slot aggregated statistics
@@ -966,6 +1004,162 @@ namespace covered
         return;
     }
 
+    void EvaluatorWrapper::notifyClientsToSetLoadRate_(const uint32_t& perclient_target_rate)
+    {
+        checkPointers_();
+
+        assert(!is_warmup_phase_); // Must finish warmup phase already
+        assert(openloop_sweep_rate_step_ > 0); // Must enable throughput-latency sweep
+
+        // Client ack flags
+        std::unordered_map<NetworkAddr, std::pair<bool, std::string>, NetworkAddrHasher> set_load_rate_acked_flags = getAckedFlagsForClients_();
+
+        std::ostringstream oss;
+        oss << "Notify all clients to set per-client target rate as " << perclient_target_rate << " reqs/sec for sweep step " << sweep_step_idx_ << "...";
+        Util::dumpNormalMsg(kClassName, oss.str());
+
+        const uint64_t cur_msg_seqnum = evaluator_msg_seqnum_.fetch_add(1, Util::RMW_CONCURRENCY_ORDER); // NOTE: ONLY need one msg seqnum for multiple setloadrate requests due to issuing to different clients
+
+        // Timeout-and-retry mechanism
+        uint32_t acked_cnt = 0;
+        bool is_stale_response = false; // Only recv again instead of send if with a stale response
+        while (acked_cnt < set_load_rate_acked_flags.size())
+        {
+            if (!is_stale_response)
+            {
+                // Issue SetLoadRateRequests to unacked clients simultaneously
+                SetLoadRateRequest tmp_set_load_rate_request(perclient_target_rate, 0, evaluator_recvmsg_source_addr_, cur_msg_seqnum);
+                issueMsgToUnackedNodes_((MessageBase*)&tmp_set_load_rate_request, set_load_rate_acked_flags);
+            }
+
+            // Receive SetLoadRateResponses for unacked clients
+            const uint32_t expected_rspcnt = set_load_rate_acked_flags.size() - acked_cnt;
+            for (uint32_t i = 0; i < expected_rspcnt; i++)
+            {
+                DynamicArray control_response_msg_payload;
+                bool is_timeout = evaluator_recvmsg_socket_server_ptr_->recv(control_response_msg_payload);
+                if (is_timeout)
+                {
+                    Util::dumpWarnMsg(kClassName, "timeout to wait for SetLoadRateResponse from " + Util::getAckedStatusStr(set_load_rate_acked_flags) + "!");
+                    is_stale_response = false; // Reset to re-send request
+                    break; // Wait until all clients have set per-client target rate
+                }
+                else
+                {
+                    MessageBase* control_response_ptr = MessageBase::getResponseFromMsgPayload(control_response_msg_payload);
+                    assert(control_response_ptr != NULL);
+
+                    // Check if the received message is a stale response
+                    if (control_response_ptr->getExtraCommonMsghdr().getMsgSeqnum() != cur_msg_seqnum)
+                    {
+                        is_stale_response = true; // ONLY recv again instead of send if with a stale response
+
+                        std::ostringstream oss_for_stable_response;
+                        oss_for_stable_response << "stale response " << MessageBase::messageTypeToString(control_response_ptr->getMessageType()) << " with seqnum " << control_response_ptr->getExtraCommonMsghdr().getMsgSeqnum() << " != " << cur_msg_seqnum;
+                        Util::dumpWarnMsg(kClassName, oss_for_stable_response.str());
+
+                        delete control_response_ptr;
+                        control_response_ptr = NULL;
+                        break; // Jump to while loop
+                    }
+
+                    assert(control_response_ptr->getMessageType() == MessageType::kSetLoadRateResponse);
+
+                    bool is_first_rsp_for_ack = processMsgForAck_(control_response_ptr, set_load_rate_acked_flags);
+                    if (is_first_rsp_for_ack)
+                    {
+                        acked_cnt++;
+                    }
+
+                    delete control_response_ptr;
+                    control_response_ptr = NULL;
+                }
+            }
+        }
+
+        cur_perclient_target_rate_ = perclient_target_rate;
+
+        oss.clear();
+        oss.str("");
+        oss << "All clients have set per-client target rate as " << perclient_target_rate << " reqs/sec for sweep step " << sweep_step_idx_;
+        Util::dumpNormalMsg(kClassName, oss.str());
+
+        return;
+    }
+
+    void EvaluatorWrapper::checkOpenloopSweep_(const struct timespec& cur_timestamp, struct timespec& prev_timestamp_to_sweep)
+    {
+        assert(openloop_sweep_rate_step_ > 0);
+
+        double delta_us_to_sweep = Util::getDeltaTimeUs(cur_timestamp, prev_timestamp_to_sweep);
+        if (delta_us_to_sweep >= static_cast<double>(SEC2US(openloop_sweep_period_sec_)))
+        {
+            // Summarize the finished sweep step
+            dumpOpenloopSweepStep_(); // Increase sweep_step_idx_ by one
+
+            // Notify clients to increase per-client target rate for the next sweep step
+            notifyClientsToSetLoadRate_(cur_perclient_target_rate_ + openloop_sweep_rate_step_);
+
+            // Update prev_timestamp_to_sweep for the next sweep step
+            prev_timestamp_to_sweep = cur_timestamp;
+        }
+
+        return;
+    }
+
+    void EvaluatorWrapper::dumpOpenloopSweepStep_()
+    {
+        checkPointers_();
+
+        // NOTE: ONLY count finished slots (i.e., [sweep_step_begin_slotidx_, target_slot_idx_)) to avoid underestimating achieved throughput by a partial slot
+        std::ostringstream oss;
+        if (sweep_step_begin_slotidx_ >= target_slot_idx_)
+        {
+            oss << "no finished slot for sweep step " << sweep_step_idx_ << " (please use a larger openloop_sweep_period_sec than slot interval)!";
+            Util::dumpWarnMsg(kClassName, oss.str());
+        }
+        else
+        {
+            uint64_t step_reqcnt = 0;
+            double step_total_latency = 0.0;
+            uint32_t step_tail99_latency = 0; // Max per-slot 99th percentile latency
+            for (uint32_t slotidx = sweep_step_begin_slotidx_; slotidx < target_slot_idx_; slotidx++)
+            {
+                TotalAggregatedStatistics tmp_total_aggregated_statistics = total_statistics_tracker_ptr_->getGivenslotTotalAggregatedStatistics(slotidx);
+                const uint32_t tmp_reqcnt = tmp_total_aggregated_statistics.getTotalReqcnt();
+                step_reqcnt += tmp_reqcnt;
+                step_total_latency += static_cast<double>(tmp_reqcnt) * static_cast<double>(tmp_total_aggregated_statistics.getAvgLatency());
+                step_tail99_latency = std::max(step_tail99_latency, tmp_total_aggregated_statistics.getTail99Latency());
+            }
+
+            const uint32_t step_slotcnt = target_slot_idx_ - sweep_step_begin_slotidx_;
+            const double step_duration_sec = static_cast<double>(step_slotcnt * Config::getClientRawStatisticsSlotIntervalSec());
+            const double offered_throughput = static_cast<double>(cur_perclient_target_rate_) * static_cast<double>(clientcnt_); // reqs/sec
+            const double achieved_throughput = static_cast<double>(step_reqcnt) / step_duration_sec; // reqs/sec
+            const uint32_t step_avg_latency = step_reqcnt > 0 ? static_cast<uint32_t>(step_total_latency / static_cast<double>(step_reqcnt)) : 0;
+
+            oss << "[Sweep step " << sweep_step_idx_ << "] per-client target rate: " << cur_perclient_target_rate_ << " reqs/sec; offered throughput: " << offered_throughput << " reqs/sec; achieved throughput: " << achieved_throughput << " reqs/sec; avg latency: " << step_avg_latency << " us; tail99 latency: " << step_tail99_latency << " us (over " << step_slotcnt << " slots)";
+            Util::dumpNormalMsg(kClassName, oss.str());
+
+            // Report the saturation point (i.e., the first sweep step whose achieved throughput falls behind offered load)
+            if (!is_saturated_ && achieved_throughput < OPENLOOP_SWEEP_SATURATION_THROUGHPUT_RATIO * offered_throughput)
+            {
+                is_saturated_ = true;
+
+                oss.clear();
+                oss.str("");
+                oss << "saturation point is found at sweep step " << sweep_step_idx_ << " with per-client target rate " << cur_perclient_target_rate_ << " reqs/sec (achieved throughput " << achieved_throughput << " < " << OPENLOOP_SWEEP_SATURATION_THROUGHPUT_RATIO << " * offered throughput " << offered_throughput << ")";
+                Util::dumpNormalMsg(kClassName, oss.str());
+            }
+        }
+
+        // Prepare for the next sweep step
+        sweep_step_idx_ += 1;
+        sweep_step_begin_slotidx_ = target_slot_idx_;
+
+        return;
+    }
+
     void EvaluatorWrapper::notifyAllToFinishrun_()
     {
         // Notify all clients to finish running, and update per-slot/stable total aggregated statistics
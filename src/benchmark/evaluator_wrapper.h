@@ -2,6 +2,8 @@
  * EvaluatorWrapper: an evaluation controller to control the evaluation phases during benchmark.
  *
  * NOTE: evaluator notifies each client wrapper to switch and update cur-slot client raw statistics, monitors per-slot total aggregated statistics to finish warmup phase for stresstest.
+ *
+ * NOTE: for open-loop client load modes, evaluator can sweep per-client target rate during stresstest phase (increase by a step for each sweep period) and report offered vs. achieved throughput and latency of each step to find the saturation point of each cache policy.
  * 
  * By Siyuan Sheng (2023.07.25).
  */
@@ -45,10 +47,11 @@ namespace covered
         static const std::string EVALUATOR_FINISH_BENCHMARK_SYMBOL;
 
         static const bool IS_HIGH_PRIORITY_FOR_EVALUATOR;
+        static const double OPENLOOP_SWEEP_SATURATION_THROUGHPUT_RATIO; // Saturated if achieved throughput < ratio * offered load
         
         static void* launchEvaluator(void* evaluator_wrapper_param_ptr);
 
-        EvaluatorWrapper(const uint32_t& clientcnt, const uint32_t& edgecnt, const uint32_t& keycnt, const uint32_t& warmup_reqcnt_scale, const uint32_t& warmup_max_duration_sec, const uint32_t& stresstest_duration_sec, const std::string& evaluator_statistics_filepath, const std::string& realnet_option, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period);
+        EvaluatorWrapper(const uint32_t& clientcnt, const uint32_t& edgecnt, const uint32_t& keycnt, const uint32_t& warmup_reqcnt_scale, const uint32_t& warmup_max_duration_sec, const uint32_t& stresstest_duration_sec, const std::string& evaluator_statistics_filepath, const std::string& realnet_option, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period, const uint32_t& perclient_target_rate, const uint32_t& openloop_sweep_rate_step, const uint32_t& openloop_sweep_period_sec);
         ~EvaluatorWrapper();
 
         void start();
@@ -70,6 +73,9 @@ namespace covered
         void notifyClientsToFinishWarmup_();
         void notifyEdgesToDumpSnapshot_(); // Only for realnet dump evaluation
         void notifyClientsToUpdateRules_(); // Only for dynamic workload patterns after warmup
+        void notifyClientsToSetLoadRate_(const uint32_t& perclient_target_rate); // Only for throughput-latency sweep of open-loop client load modes after warmup
+        void checkOpenloopSweep_(const struct timespec& cur_timestamp, struct timespec& prev_timestamp_to_sweep); // Enter the next sweep step if the current one is finished
+        void dumpOpenloopSweepStep_(); // Summarize per-slot total aggregated statistics of the current sweep step
         void notifyAllToFinishrun_(); // Finish clients first, and then edge and cloud
         void notifyClientsToFinishrun_(); // Update per-slot/stable total aggregated statistics
         void notifyEdgeCloudToFinishrun_();
@@ -94,6 +100,8 @@ namespace covered
         const std::string realnet_option_; // Come from CLI
         const std::string workload_pattern_name_; // Come from CLI
         const uint32_t dynamic_change_period_; // Come from CLI
+        const uint32_t openloop_sweep_rate_step_; // Come from CLI (0: disable throughput-latency sweep)
+        const uint32_t openloop_sweep_period_sec_; // Come from CLI
 
         // (1) Manage evaluation phases
 
@@ -101,6 +109,12 @@ namespace covered
         uint32_t target_slot_idx_;
         uint32_t dynamic_period_idx_; // ONLY used by evaluator to dump log
 
+        // For throughput-latency sweep of open-loop client load modes
+        uint32_t cur_perclient_target_rate_; // Initialized by CLI
+        uint32_t sweep_step_idx_;
+        uint32_t sweep_step_begin_slotidx_; // The first slot of the current sweep step
+        bool is_saturated_; // Whether the saturation point has been found
+
         NetworkAddr evaluator_recvmsg_source_addr_;
         NetworkAddr* perclient_recvmsg_dst_addrs_;
         NetworkAddr* peredge_recvmsg_dst_addrs_;
@@ -164,24 +164,6 @@ namespace covered
 
     // (4) Other functions
 
-    void AdaptSizeLocalCache::invokeCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr)
-    {
-        std::ostringstream oss;
-        oss << "invokeCustomFunctionInternal_() does NOT support func_name " << func_name;
-        Util::dumpErrorMsg(instance_name_, oss.str());
-        exit(1);
-        return;
-    }
-
-    void AdaptSizeLocalCache::invokeConstCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const
-    {
-        std::ostringstream oss;
-        oss << "invokeConstCustomFunctionInternal_() does NOT support func_name " << func_name;
-        Util::dumpErrorMsg(instance_name_, oss.str());
-        exit(1);
-        return;
-    }
-
     uint64_t AdaptSizeLocalCache::getSizeForCapacityInternal_() const
     {
         uint64_t internal_size = adaptsize_cache_ptr_->getSizeForCapacity();
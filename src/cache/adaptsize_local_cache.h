@@ -44,9 +44,6 @@ namespace covered
 
         // (4) Other functions
 
-        virtual void invokeCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) override; // Invoke some method-specific function for local edge cache
-        virtual void invokeConstCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const override; // Invoke some method-specific function for local edge cache
-
         // In units of bytes
         virtual uint64_t getSizeForCapacityInternal_() const override;
 
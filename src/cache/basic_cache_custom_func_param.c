@@ -6,8 +6,6 @@ namespace covered
 
     const std::string GetLocalVictimVtimeFuncParam::kClassName("GetLocalVictimVtimeFuncParam");
 
-    const std::string GetLocalVictimVtimeFuncParam::FUNCNAME("get_local_victim_vtime");
-
     GetLocalVictimVtimeFuncParam::GetLocalVictimVtimeFuncParam() : CacheCustomFuncParamBase(false, false, Key(), false)
     {
         local_victim_vtime_ = 0;
@@ -26,8 +24,6 @@ namespace covered
 
     const std::string UpdateNeighborVictimVtimeParam::kClassName("UpdateNeighborVictimVtimeParam");
 
-    const std::string UpdateNeighborVictimVtimeParam::FUNCNAME("update_neighbor_victim_vtime");
-
     UpdateNeighborVictimVtimeParam::UpdateNeighborVictimVtimeParam(const uint32_t& neighbor_edge_idx, const uint64_t& neighbor_victim_vtime)
         : CacheCustomFuncParamBase(false, false, Key(), true), neighbor_edge_idx_(neighbor_edge_idx), neighbor_victim_vtime_(neighbor_victim_vtime)
     {
@@ -51,8 +47,6 @@ namespace covered
 
     const std::string GetPlacementEdgeIdxParam::kClassName("GetPlacementEdgeIdxParam");
 
-    const std::string GetPlacementEdgeIdxParam::FUNCNAME("get_placement_edge_idx");
-
     GetPlacementEdgeIdxParam::GetPlacementEdgeIdxParam()
         : CacheCustomFuncParamBase(false, false, Key(), false)
     {
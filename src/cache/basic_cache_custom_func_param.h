@@ -17,13 +17,11 @@
 
 namespace covered
 {
-    // GetLocalVictimVtimeFuncParam for BestGuess
+    // GetLocalVictimVtimeFuncParam for BestGuess: get victim vtime of the current edge node
 
     class GetLocalVictimVtimeFuncParam : public CacheCustomFuncParamBase
     {
     public:
-        static const std::string FUNCNAME; // get victim vtime of the current edge node
-
         GetLocalVictimVtimeFuncParam();
         virtual ~GetLocalVictimVtimeFuncParam();
 
@@ -34,13 +32,11 @@ namespace covered
         uint64_t local_victim_vtime_;
     };
 
-    // UpdateNeighborVictimVtimeParam for BestGuess
+    // UpdateNeighborVictimVtimeParam for BestGuess: update victim vtime of the given neighbor edge node
 
     class UpdateNeighborVictimVtimeParam : public CacheCustomFuncParamBase
     {
     public:
-        static const std::string FUNCNAME; // Update victim vtime of the given neighbor edge node
-
         UpdateNeighborVictimVtimeParam(const uint32_t& neighbor_edge_idx, const uint64_t& neighbor_victim_vtime);
         virtual ~UpdateNeighborVictimVtimeParam();
 
@@ -53,13 +49,11 @@ namespace covered
         const uint64_t neighbor_victim_vtime_;
     };
 
-    // GetPlacementEdgeIdxParam for BestGuess
+    // GetPlacementEdgeIdxParam for BestGuess: get placement edge idx for best-guess replacement
 
     class GetPlacementEdgeIdxParam : public CacheCustomFuncParamBase
     {
     public:
-        static const std::string FUNCNAME; // Get placement edge idx for best-guess replacement
-
         GetPlacementEdgeIdxParam();
         virtual ~GetPlacementEdgeIdxParam();
 
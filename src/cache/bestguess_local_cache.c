@@ -263,25 +263,6 @@ namespace covered
 
     // (4) Other functions
 
-    void BestGuessLocalCache::invokeCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr)
-    {
-        assert(func_param_ptr != NULL);
-
-        if (func_name == UpdateNeighborVictimVtimeParam::FUNCNAME)
-        {
-            UpdateNeighborVictimVtimeParam* tmp_param_ptr = static_cast<UpdateNeighborVictimVtimeParam*>(func_param_ptr);
-            updateNeighborVictimVtimeInternal_(tmp_param_ptr->getNeighborEdgeIdx(), tmp_param_ptr->getNeighborVictimVtime());
-        }
-        else
-        {
-            std::ostringstream oss;
-            oss << "invokeCustomFunctionInternal_() does NOT support func_name " << func_name;
-            Util::dumpErrorMsg(instance_name_, oss.str());
-            exit(1);
-        }
-        return;
-    }
-
     void BestGuessLocalCache::updateNeighborVictimVtimeInternal_(const uint32_t& neighbor_edge_idx, const uint64_t& neighbor_victim_vtime)
     {
         if (neighbor_edge_idx == edge_idx_)
@@ -306,30 +287,6 @@ namespace covered
         return;
     }
 
-    void BestGuessLocalCache::invokeConstCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const
-    {
-        assert(func_param_ptr != NULL);
-
-        if (func_name == GetLocalVictimVtimeFuncParam::FUNCNAME)
-        {
-            GetLocalVictimVtimeFuncParam* tmp_param_ptr = static_cast<GetLocalVictimVtimeFuncParam*>(func_param_ptr);
-            getLocalVictimVtimeInternal_(tmp_param_ptr->getLocalVictimVtimeRef());
-        }
-        else if (func_name == GetPlacementEdgeIdxParam::FUNCNAME)
-        {
-            GetPlacementEdgeIdxParam* tmp_param_ptr = static_cast<GetPlacementEdgeIdxParam*>(func_param_ptr);
-            getPlacementEdgeIdxInternal_(tmp_param_ptr->getPlacementEdgeIdxRef());
-        }
-        else
-        {
-            std::ostringstream oss;
-            oss << "invokeConstCustomFunctionInternal_() does NOT support func_name " << func_name;
-            Util::dumpErrorMsg(instance_name_, oss.str());
-            exit(1);
-        }
-        return;
-    }
-
     void BestGuessLocalCache::getLocalVictimVtimeInternal_(uint64_t& local_victim_vtime) const
     {
         local_victim_vtime = 0; // NOTE: keep victim as 0 if BestGuess cache is empty, which has the largest priority for admission placement
@@ -67,12 +67,10 @@ namespace covered
 
         // (4) Other functions
 
-        virtual void invokeCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) override; // Invoke some method-specific function for local edge cache
-        void updateNeighborVictimVtimeInternal_(const uint32_t& neighbor_edge_idx, const uint64_t& neighbor_victim_vtime); // Update victim vtime of the given neighbor edge node
+        virtual void updateNeighborVictimVtimeInternal_(const uint32_t& neighbor_edge_idx, const uint64_t& neighbor_victim_vtime) override; // Update victim vtime of the given neighbor edge node
 
-        virtual void invokeConstCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const override; // Invoke some method-specific function for local edge cache
-        void getLocalVictimVtimeInternal_(uint64_t& local_victim_vtime) const; // Get victim vtime of current edge node
-        void getPlacementEdgeIdxInternal_(uint32_t& placement_edge_idx) const; // Get placement edge idx under best-guess replacement policy
+        virtual void getLocalVictimVtimeInternal_(uint64_t& local_victim_vtime) const override; // Get victim vtime of current edge node
+        virtual void getPlacementEdgeIdxInternal_(uint32_t& placement_edge_idx) const override; // Get placement edge idx under best-guess replacement policy
 
         // In units of bytes
         virtual uint64_t getSizeForCapacityInternal_() const override;
@@ -11,7 +11,7 @@ namespace covered
 {
     const std::string CacheWrapper::kClassName("CacheWrapper");
 
-    CacheWrapper::CacheWrapper(const EdgeWrapperBase* edge_wrapper_ptr, const std::string& cache_name, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const uint32_t& dataset_keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& peredge_synced_victimcnt) : cache_name_(cache_name)
+    CacheWrapper::CacheWrapper(const EdgeWrapperBase* edge_wrapper_ptr, const std::string& cache_name, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const uint32_t& dataset_keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& peredge_synced_victimcnt, const uint32_t& local_cache_shardcnt, const CachelibNvmInfo& cachelib_nvm_info) : cache_name_(cache_name)
     {
         // Differentiate local edge cache in different edge nodes
         std::ostringstream oss;
@@ -19,9 +19,17 @@ namespace covered
         instance_name_ = oss.str();
 
         // Allocate local edge cache
-        local_cache_ptr_ = LocalCacheBase::getLocalCacheByCacheName(edge_wrapper_ptr, cache_name, edge_idx, capacity_bytes, dataset_keycnt, local_uncached_capacity_bytes, local_uncached_lru_bytes, peredge_synced_victimcnt);
+        local_cache_ptr_ = LocalCacheBase::getLocalCacheByCacheName(edge_wrapper_ptr, cache_name, edge_idx, capacity_bytes, dataset_keycnt, local_uncached_capacity_bytes, local_uncached_lru_bytes, peredge_synced_victimcnt, local_cache_shardcnt, cachelib_nvm_info);
         assert(local_cache_ptr_ != NULL);
 
+        // Allocate value slab arena for real value bytes if any
+        value_slab_arena_ptr_ = NULL;
+        if (Config::isRealValuePayload())
+        {
+            value_slab_arena_ptr_ = new ValueSlabArena(edge_idx);
+            assert(value_slab_arena_ptr_ != NULL);
+        }
+
         // Allocate per-key rwlock for cache wrapper
         cache_wrapper_perkey_rwlock_ptr_ = new PerkeyRwlock(edge_idx, Config::getFineGrainedLockingSize(), local_cache_ptr_->hasFineGrainedManagement());
         assert(cache_wrapper_perkey_rwlock_ptr_ != NULL);
@@ -61,6 +69,15 @@ namespace covered
         delete local_cache_ptr_;
         local_cache_ptr_ = NULL;
 
+        // Release value slab arena after local edge cache (i.e., all cached values have released their chunks)
+        // NOTE: deleting the arena is deferred if any value copied out of local edge cache still references its chunk
+        if (value_slab_arena_ptr_ != NULL)
+        {
+            Util::dumpNormalMsg(instance_name_, "value slab arena statistics: " + value_slab_arena_ptr_->getStatisticsStr());
+            ValueSlabArena::destroy(value_slab_arena_ptr_);
+            value_slab_arena_ptr_ = NULL;
+        }
+
         // Release per-key rwlock for cache wrapper
         assert(cache_wrapper_perkey_rwlock_ptr_ != NULL);
         delete cache_wrapper_perkey_rwlock_ptr_;
@@ -90,7 +107,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock
-        std::string context_name = "CacheWrapper::isLocalCached()";
+        const char* context_name = "CacheWrapper::isLocalCached()";
         cache_wrapper_perkey_rwlock_ptr_->acquire_lock_shared(key, context_name);
 
         bool is_local_cached = local_cache_ptr_->isLocalCached(key);
@@ -106,7 +123,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock
-        std::string context_name = "CacheWrapper::isValidKeyForLocalCachedObject()";
+        const char* context_name = "CacheWrapper::isValidKeyForLocalCachedObject()";
         cache_wrapper_perkey_rwlock_ptr_->acquire_lock_shared(key, context_name);
 
         bool is_valid = isValidKeyForLocalCachedObject_(key);
@@ -122,7 +139,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock
-        std::string context_name = "CacheWrapper::invalidateKeyForLocalCachedObject()";
+        const char* context_name = "CacheWrapper::invalidateKeyForLocalCachedObject()";
         cache_wrapper_perkey_rwlock_ptr_->acquire_lock(key, context_name);
 
         invalidateKeyForLocalCachedObject_(key);
@@ -140,7 +157,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock
-        std::string context_name = "CacheWrapper::get()";
+        const char* context_name = "CacheWrapper::get()";
         cache_wrapper_perkey_rwlock_ptr_->acquire_lock_shared(key, context_name);
 
         bool is_local_cached = local_cache_ptr_->getLocalCache(key, is_redirected, value, affect_victim_tracker); // Still need to update local metadata if key is cached yet invalid
@@ -162,7 +179,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock
-        std::string context_name = "CacheWrapper::get_p2p()";
+        const char* context_name = "CacheWrapper::get_p2p()";
         assert(is_redirected);
         
         cache_wrapper_perkey_rwlock_ptr_->acquire_lock_shared(key, context_name);
@@ -186,7 +203,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock
-        std::string context_name = "CacheWrapper::update()";
+        const char* context_name = "CacheWrapper::update()";
         if (value.isDeleted())
         {
             context_name = "CacheWrapper::remove()";
@@ -196,7 +213,7 @@ namespace covered
         // Try to update local edge cache for put/delreq
         const bool is_getrsp = false;
         bool is_successful = false;
-        bool is_local_cached = local_cache_ptr_->updateLocalCache(key, value, is_getrsp, is_global_cached, affect_victim_tracker, is_successful);
+        bool is_local_cached = local_cache_ptr_->updateLocalCache(key, internValue_(value), is_getrsp, is_global_cached, affect_victim_tracker, is_successful);
 
         if (is_local_cached)
         {
@@ -234,7 +251,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock
-        std::string context_name = "CacheWrapper::updateIfInvalidForGetrsp()";
+        const char* context_name = "CacheWrapper::updateIfInvalidForGetrsp()";
         if (value.isDeleted())
         {
             context_name = "CacheWrapper::remove()";
@@ -253,7 +270,7 @@ namespace covered
                 // Update local edge cache for getrsp with invalid hit
                 bool is_successful = false;
                 const bool tmp_is_global_cached = true; // Local cached objects MUST be global cached
-                bool tmp_is_local_cached = local_cache_ptr_->updateLocalCache(key, value, is_getrsp, tmp_is_global_cached, affect_victim_tracker, is_successful);
+                bool tmp_is_local_cached = local_cache_ptr_->updateLocalCache(key, internValue_(value), is_getrsp, tmp_is_global_cached, affect_victim_tracker, is_successful);
                 assert(tmp_is_local_cached);
 
                 if (is_successful) // Validate key ONLY if update successfully
@@ -296,7 +313,7 @@ namespace covered
     {
         checkPointers_();
 
-        std::string context_name = "CacheWrapper::fetchVictimCacheinfosForRequiredSize()";
+        const char* context_name = "CacheWrapper::fetchVictimCacheinfosForRequiredSize()";
 
         // NOTE: as we only access local edge cache (thread safe w/o per-key rwlock) instead of validity map (thread safe w/ per-key rwlock), we do NOT need to acquire a fine-grained read lock here
 
@@ -333,7 +350,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock
-        std::string context_name = "CacheWrapper::needIndependentAdmit()";
+        const char* context_name = "CacheWrapper::needIndependentAdmit()";
         cache_wrapper_perkey_rwlock_ptr_->acquire_lock_shared(key, context_name);
 
         bool need_independent_admit = local_cache_ptr_->needIndependentAdmit(key, value);
@@ -349,11 +366,11 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock
-        std::string context_name = "CacheWrapper::admit()";
+        const char* context_name = "CacheWrapper::admit()";
         cache_wrapper_perkey_rwlock_ptr_->acquire_lock(key, context_name);
 
         bool is_successful = false;
-        local_cache_ptr_->admitLocalCache(key, value, is_neighbor_cached, affect_victim_tracker, is_successful, miss_latency_us);
+        local_cache_ptr_->admitLocalCache(key, internValue_(value), is_neighbor_cached, affect_victim_tracker, is_successful, miss_latency_us);
 
         if (is_successful) // If key is admited successfully
         {
@@ -395,7 +412,7 @@ namespace covered
     {
         checkPointers_();
 
-        std::string context_name = "CacheWrapper::evict()";
+        const char* context_name = "CacheWrapper::evict()";
 
         if (local_cache_ptr_->hasFineGrainedManagement()) // Local cache with fine-grained management
         {
@@ -434,37 +451,112 @@ namespace covered
 
     // (4) Other functions
 
-    void CacheWrapper::customFunc(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr)
+    void CacheWrapper::customFunc(UpdateIsNeighborCachedFlagFuncParam* func_param_ptr)
+    {
+        checkPointers_();
+
+        const char* context_name = "CacheWrapper::customFunc(UpdateIsNeighborCachedFlagFuncParam)";
+
+        preCustomFunc_(context_name, func_param_ptr);
+
+        local_cache_ptr_->invokeCustomFunction(func_param_ptr);
+
+        postCustomFunc_(context_name, func_param_ptr);
+        
+        return;
+    }
+
+    void CacheWrapper::customFunc(UpdateNeighborVictimVtimeParam* func_param_ptr)
+    {
+        checkPointers_();
+
+        const char* context_name = "CacheWrapper::customFunc(UpdateNeighborVictimVtimeParam)";
+
+        preCustomFunc_(context_name, func_param_ptr);
+
+        local_cache_ptr_->invokeCustomFunction(func_param_ptr);
+
+        postCustomFunc_(context_name, func_param_ptr);
+        
+        return;
+    }
+
+    void CacheWrapper::constCustomFunc(GetLocalSyncedVictimCacheinfosParam* func_param_ptr) const
+    {
+        checkPointers_();
+
+        const char* context_name = "CacheWrapper::constCustomFunc(GetLocalSyncedVictimCacheinfosParam)";
+
+        preCustomFunc_(context_name, func_param_ptr);
+
+        local_cache_ptr_->invokeConstCustomFunction(func_param_ptr);
+
+        postCustomFunc_(context_name, func_param_ptr);
+
+        // Post processing: fill beacon edge idx of each victim
+        cache_wrapper_rwlock_for_beacon_edgeidx_ptr_->acquire_lock_shared(context_name);
+        std::list<VictimCacheinfo>& victim_cacheinfos_ref = func_param_ptr->getVictimCacheinfosRef();
+        for (std::list<VictimCacheinfo>::iterator victim_cacheinfo_iter = victim_cacheinfos_ref.begin(); victim_cacheinfo_iter != victim_cacheinfos_ref.end(); victim_cacheinfo_iter++)
+        {
+            const Key& tmp_victim_key = victim_cacheinfo_iter->getKey();
+            std::unordered_map<Key, uint32_t, KeyHasher>::const_iterator beacon_edgeidx_const_iter = perkey_beacon_edgeidx_.find(tmp_victim_key);
+            if (beacon_edgeidx_const_iter != perkey_beacon_edgeidx_.end())
+            {
+                const uint32_t tmp_beacon_edgeidx = beacon_edgeidx_const_iter->second;
+                victim_cacheinfo_iter->setBeaconEdgeidx(tmp_beacon_edgeidx);
+            }
+        }
+        cache_wrapper_rwlock_for_beacon_edgeidx_ptr_->unlock_shared(context_name);
+        
+        return;
+    }
+
+    void CacheWrapper::constCustomFunc(GetCollectedPopularityParam* func_param_ptr) const
+    {
+        checkPointers_();
+
+        const char* context_name = "CacheWrapper::constCustomFunc(GetCollectedPopularityParam)";
+
+        preCustomFunc_(context_name, func_param_ptr);
+
+        local_cache_ptr_->invokeConstCustomFunction(func_param_ptr);
+
+        postCustomFunc_(context_name, func_param_ptr);
+        
+        return;
+    }
+
+    void CacheWrapper::constCustomFunc(GetLocalVictimVtimeFuncParam* func_param_ptr) const
     {
         checkPointers_();
 
-        std::string context_name = "CacheWrapper::customFunc(" + func_name + ")";
+        const char* context_name = "CacheWrapper::constCustomFunc(GetLocalVictimVtimeFuncParam)";
 
         preCustomFunc_(context_name, func_param_ptr);
 
-        local_cache_ptr_->invokeCustomFunction(func_name, func_param_ptr);
+        local_cache_ptr_->invokeConstCustomFunction(func_param_ptr);
 
-        postCustomFunc_(func_name, context_name, func_param_ptr);
+        postCustomFunc_(context_name, func_param_ptr);
         
         return;
     }
 
-    void CacheWrapper::constCustomFunc(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const
+    void CacheWrapper::constCustomFunc(GetPlacementEdgeIdxParam* func_param_ptr) const
     {
         checkPointers_();
 
-        std::string context_name = "CacheWrapper::customFunc(" + func_name + ")";
+        const char* context_name = "CacheWrapper::constCustomFunc(GetPlacementEdgeIdxParam)";
 
         preCustomFunc_(context_name, func_param_ptr);
 
-        local_cache_ptr_->invokeConstCustomFunction(func_name, func_param_ptr);
+        local_cache_ptr_->invokeConstCustomFunction(func_param_ptr);
 
-        postCustomFunc_(func_name, context_name, func_param_ptr);
+        postCustomFunc_(context_name, func_param_ptr);
         
         return;
     }
 
-    void CacheWrapper::preCustomFunc_(const std::string context_name, CacheCustomFuncParamBase* func_param_ptr) const
+    void CacheWrapper::preCustomFunc_(const char* context_name, CacheCustomFuncParamBase* func_param_ptr) const
     {
         bool need_perkey_lock = func_param_ptr->needPerkeyLock();
         bool is_perkey_write_lock = func_param_ptr->isPerkeyWriteLock();
@@ -486,7 +578,7 @@ namespace covered
         return;
     }
 
-    void CacheWrapper::postCustomFunc_(const std::string& func_name, const std::string context_name, CacheCustomFuncParamBase* func_param_ptr) const
+    void CacheWrapper::postCustomFunc_(const char* context_name, CacheCustomFuncParamBase* func_param_ptr) const
     {
         bool need_perkey_lock = func_param_ptr->needPerkeyLock();
         bool is_perkey_write_lock = func_param_ptr->isPerkeyWriteLock();
@@ -505,25 +597,6 @@ namespace covered
             }
         }
 
-        // Post processing
-        if (func_name == GetLocalSyncedVictimCacheinfosParam::FUNCNAME)
-        {
-            GetLocalSyncedVictimCacheinfosParam* tmp_param_ptr = static_cast<GetLocalSyncedVictimCacheinfosParam*>(func_param_ptr);
-            cache_wrapper_rwlock_for_beacon_edgeidx_ptr_->acquire_lock_shared(context_name);
-            std::list<VictimCacheinfo>& victim_cacheinfos_ref = tmp_param_ptr->getVictimCacheinfosRef();
-            for (std::list<VictimCacheinfo>::iterator victim_cacheinfo_iter = victim_cacheinfos_ref.begin(); victim_cacheinfo_iter != victim_cacheinfos_ref.end(); victim_cacheinfo_iter++)
-            {
-                const Key& tmp_victim_key = victim_cacheinfo_iter->getKey();
-                std::unordered_map<Key, uint32_t, KeyHasher>::const_iterator beacon_edgeidx_const_iter = perkey_beacon_edgeidx_.find(tmp_victim_key);
-                if (beacon_edgeidx_const_iter != perkey_beacon_edgeidx_.end())
-                {
-                    const uint32_t tmp_beacon_edgeidx = beacon_edgeidx_const_iter->second;
-                    victim_cacheinfo_iter->setBeaconEdgeidx(tmp_beacon_edgeidx);
-                }
-            }
-            cache_wrapper_rwlock_for_beacon_edgeidx_ptr_->unlock_shared(context_name);
-        }
-
         return;
     }
 
@@ -537,6 +610,11 @@ namespace covered
         uint64_t validity_map_size = validity_map_ptr_->getSizeForCapacity();
         // NOTE: NOT consider per-key beacon edge idx, which is just impl trick to avoid duplicate consistent hashing, yet NOT necessary for edge caching
         uint64_t total_size = Util::uint64Add(local_edge_cache_size, validity_map_size);
+        if (value_slab_arena_ptr_ != NULL)
+        {
+            // NOTE: value bytes have been counted by local edge cache, so we only add chunk headers and rounding of size classes
+            total_size = Util::uint64Add(total_size, value_slab_arena_ptr_->getOverheadBytes());
+        }
 
         return total_size;
     }
@@ -821,7 +899,7 @@ namespace covered
 
             // Acquire a write lock (pessimistic locking to avoid atomicity/order issues)
             // NOTE: we still need to acquire fine-grained locking for tmp_victim_key even if we have acquired cache eviction mutex in cache server worker, otherwise tmp_victim_key may be accessed/motified/invalidated during eviction
-            std::string context_name = "CacheWrapper::evictForFineGrainedManagement_()";
+            const char* context_name = "CacheWrapper::evictForFineGrainedManagement_()";
             cache_wrapper_perkey_rwlock_ptr_->acquire_lock(tmp_victim_key, context_name);
 
             // Evict if key matches (similar as version check for optimistic locking to revert effects of atomicity/order issues)
@@ -866,7 +944,7 @@ namespace covered
         victims.clear();
 
         // Acquire a write lock (pessimistic locking to avoid atomicity/order issues)
-        std::string context_name = "CacheWrapper::evictForCoarseGrainedManagement_()";
+        const char* context_name = "CacheWrapper::evictForCoarseGrainedManagement_()";
         cache_wrapper_perkey_rwlock_ptr_->acquire_lock(Key(), context_name); // NOTE: parameter key will NOT be used due to NOT using fine-grained locking for coarse-grained management
 
         // Directly evict local cache for coarse-grained management
@@ -895,6 +973,15 @@ namespace covered
 
     // (4) Other functions
 
+    Value CacheWrapper::internValue_(const Value& value) const
+    {
+        if (value_slab_arena_ptr_ == NULL)
+        {
+            return value;
+        }
+        return value_slab_arena_ptr_->intern(value);
+    }
+
     void CacheWrapper::checkPointers_() const
     {
         assert(cache_wrapper_perkey_rwlock_ptr_ != NULL);
@@ -30,6 +30,7 @@ namespace covered
 #include "common/covered_common_header.h"
 #include "common/key.h"
 #include "common/value.h"
+#include "common/value_slab_arena.h"
 #include "concurrency/perkey_rwlock.h"
 #include "core/popularity/collected_popularity.h"
 #include "core/victim/victim_cacheinfo.h"
@@ -39,7 +40,7 @@ namespace covered
     class CacheWrapper
     {
     public:
-        CacheWrapper(const EdgeWrapperBase* edge_wrapper_ptr, const std::string& cache_name, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const uint32_t& dataset_keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& peredge_synced_victimcnt);
+        CacheWrapper(const EdgeWrapperBase* edge_wrapper_ptr, const std::string& cache_name, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const uint32_t& dataset_keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& peredge_synced_victimcnt, const uint32_t& local_cache_shardcnt = 1, const CachelibNvmInfo& cachelib_nvm_info = CachelibNvmInfo());
         virtual ~CacheWrapper();
 
         // (1) Check is cached and access validity
@@ -76,10 +77,15 @@ namespace covered
 
         // (4) Other functions
 
-        void customFunc(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr); // Invoke method-specific functions for local edge cache
-        void constCustomFunc(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const;
-        void preCustomFunc_(const std::string context_name, CacheCustomFuncParamBase* func_param_ptr) const;
-        void postCustomFunc_(const std::string& func_name, const std::string context_name, CacheCustomFuncParamBase* func_param_ptr) const;
+        // Invoke method-specific functions for local edge cache (overloaded by param type)
+        void customFunc(UpdateIsNeighborCachedFlagFuncParam* func_param_ptr);
+        void customFunc(UpdateNeighborVictimVtimeParam* func_param_ptr);
+        void constCustomFunc(GetLocalSyncedVictimCacheinfosParam* func_param_ptr) const; // NOTE: also fill beacon edge idx of each victim
+        void constCustomFunc(GetCollectedPopularityParam* func_param_ptr) const;
+        void constCustomFunc(GetLocalVictimVtimeFuncParam* func_param_ptr) const;
+        void constCustomFunc(GetPlacementEdgeIdxParam* func_param_ptr) const;
+        void preCustomFunc_(const char* context_name, CacheCustomFuncParamBase* func_param_ptr) const;
+        void postCustomFunc_(const char* context_name, CacheCustomFuncParamBase* func_param_ptr) const;
         
         // In units of bytes
         uint64_t getSizeForCapacity() const; // sum of internal size (each individual local cache) and external size (metadata for edge caching)
@@ -109,6 +115,7 @@ namespace covered
 
         // (4) Other functions
 
+        Value internValue_(const Value& value) const; // Copy real value bytes into value slab arena if any, such that cached values do NOT hold heap payloads
         void checkPointers_() const;
 
         // Member variables
@@ -119,6 +126,7 @@ namespace covered
 
         // Non-const shared variable
         LocalCacheBase* local_cache_ptr_; // Maintain key-value objects for local edge cache (thread safe)
+        ValueSlabArena* value_slab_arena_ptr_; // Store real value bytes of cached objects (thread safe; NULL if NOT Config::isRealValuePayload())
         // Fine-graind locking for local edge cache with fine-grained management, or single read-write lock for that with coarse-grained cache management
         mutable PerkeyRwlock* cache_wrapper_perkey_rwlock_ptr_;
         // NOTE: Due to the write-through policy, we only need to maintain an invalidity flag for MSI protocol (i.e., both M and S refers to validity)
@@ -0,0 +1,579 @@
+#include "cache/cachelib_hybrid_local_cache.h"
+
+#include <assert.h>
+#include <cstdio> // std::remove
+#include <sstream>
+
+#include <folly/Random.h>
+
+#include "common/config.h"
+#include "common/util.h"
+
+namespace covered
+{
+    // CachelibHybridNvmAdmissionPolicy
+
+    CachelibHybridNvmAdmissionPolicy::CachelibHybridNvmAdmissionPolicy(const double& admit_probability) : facebook::cachelib::NvmAdmissionPolicy<Lru2QAllocator>(), admit_probability_(admit_probability)
+    {
+        assert(admit_probability > 0.0 && admit_probability <= 1.0);
+    }
+
+    CachelibHybridNvmAdmissionPolicy::~CachelibHybridNvmAdmissionPolicy() {}
+
+    bool CachelibHybridNvmAdmissionPolicy::acceptImpl(const Lru2QAllocator::Item& item, folly::Range<Lru2QAllocator::ChainedItemIter> chained_item_range)
+    {
+        UNUSED(item);
+        UNUSED(chained_item_range);
+
+        if (admit_probability_ >= 1.0)
+        {
+            return true;
+        }
+        return folly::Random::randDouble01() < admit_probability_;
+    }
+
+    // CachelibHybridLocalCache
+
+    const uint64_t CachelibHybridLocalCache::NVM_BLOCK_SIZE = 4096;
+    const uint64_t CachelibHybridLocalCache::NVM_REGION_SIZE = MB2B(16);
+    const uint32_t CachelibHybridLocalCache::NVM_MIN_REGIONCNT = 16;
+    const uint32_t CachelibHybridLocalCache::NVM_BIGHASH_SIZE_PERCENTAGE = 10;
+    const uint32_t CachelibHybridLocalCache::NVM_BIGHASH_MAX_ITEM_SIZE = 640;
+    const uint32_t CachelibHybridLocalCache::NVM_BIGHASH_BUCKET_SIZE = 4096;
+    const uint64_t CachelibHybridLocalCache::NVM_BIGHASH_BUCKET_BF_SIZE = 8;
+
+    const std::string CachelibHybridLocalCache::kClassName("CachelibHybridLocalCache");
+
+    CachelibHybridLocalCache::CachelibHybridLocalCache(const EdgeWrapperBase* edge_wrapper_ptr, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const CachelibNvmInfo& cachelib_nvm_info) : LocalCacheBase(edge_wrapper_ptr, edge_idx, capacity_bytes)
+    {
+        // Differentiate local edge cache in different edge nodes
+        std::ostringstream oss;
+        oss << kClassName << " edge" << edge_idx;
+        instance_name_ = oss.str();
+
+        // Split capacity into NVM and DRAM tiers (NOTE: Navy device size MUST be aligned with regions)
+        nvm_capacity_bytes_ = cachelib_nvm_info.getNvmCapacityBytes() / NVM_REGION_SIZE * NVM_REGION_SIZE;
+        if (nvm_capacity_bytes_ < NVM_MIN_REGIONCNT * NVM_REGION_SIZE || nvm_capacity_bytes_ >= capacity_bytes)
+        {
+            oss.clear();
+            oss.str("");
+            oss << "region-aligned NVM capacity " << nvm_capacity_bytes_ << " bytes should be >= " << NVM_MIN_REGIONCNT * NVM_REGION_SIZE << " bytes and < overall capacity " << capacity_bytes << " bytes";
+            Util::dumpErrorMsg(instance_name_, oss.str());
+            exit(1);
+        }
+        dram_capacity_bytes_ = capacity_bytes - nvm_capacity_bytes_;
+
+        // Differentiate NVM devices of different edge nodes in the same machine (e.g., single-node simulator)
+        oss.clear();
+        oss.str("");
+        oss << cachelib_nvm_info.getNvmFilepath() << ".edge" << edge_idx;
+        nvm_filepath_ = oss.str();
+
+        nvm_used_bytes_ = 0;
+        pending_victim_bytes_ = 0;
+        dram_hitcnt_ = 0;
+        nvm_hitcnt_ = 0;
+        misscnt_ = 0;
+        demotecnt_ = 0;
+        nvm_rejectcnt_ = 0;
+        nvm_evictcnt_ = 0;
+
+        // Prepare cacheConfig for DRAM tier (refer to CachelibLocalCache)
+        Lru2QCacheConfig cacheConfig;
+        cacheConfig.setDefaultAllocSizes(cacheConfig.allocationClassSizeFactor, CACHELIB_ENGINE_MAX_SLAB_SIZE, cacheConfig.minAllocationClassSize, cacheConfig.reduceFragmentationInAllocationClass);
+        max_allocation_class_size_ = cacheConfig.maxAllocationClassSize;
+        assert(max_allocation_class_size_ == CACHELIB_ENGINE_MAX_SLAB_SIZE);
+        // NOTE: we over-provision DRAM to avoid internal eviction, while DRAM capacity is enforced by demoteDramVictims_()
+        uint64_t over_provisioned_capacity_bytes = dram_capacity_bytes_ + COMMON_ENGINE_INTERNAL_UNUSED_CAPACITY_BYTES;
+        if (over_provisioned_capacity_bytes >= CACHELIB_ENGINE_MIN_CAPACITY_BYTES)
+        {
+            cacheConfig.setCacheSize(over_provisioned_capacity_bytes);
+        }
+        else
+        {
+            cacheConfig.setCacheSize(CACHELIB_ENGINE_MIN_CAPACITY_BYTES);
+        }
+
+        // Prepare nvmConfig for NVM tier on a plain file (truncated at startup)
+        Lru2QNvmCacheConfig nvmConfig;
+        nvmConfig.navyConfig.setBlockSize(NVM_BLOCK_SIZE);
+        nvmConfig.navyConfig.setSimpleFile(nvm_filepath_, nvm_capacity_bytes_, true);
+        nvmConfig.navyConfig.blockCache().setRegionSize(NVM_REGION_SIZE);
+        nvmConfig.navyConfig.bigHash().setSizePctAndMaxItemSize(NVM_BIGHASH_SIZE_PERCENTAGE, NVM_BIGHASH_MAX_ITEM_SIZE).setBucketSize(NVM_BIGHASH_BUCKET_SIZE).setBucketBfSize(NVM_BIGHASH_BUCKET_BF_SIZE);
+        cacheConfig.enableNvmCache(nvmConfig);
+        cacheConfig.setNvmCacheAdmissionPolicy(std::make_shared<CachelibHybridNvmAdmissionPolicy>(cachelib_nvm_info.getNvmAdmitProbability()));
+        cacheConfig.setItemDestructor([this](const Lru2QDestructorData& data) { onItemDestroyed_(data); });
+        cacheConfig.validate(); // will throw if bad config
+
+        cachelib_cache_ptr_ = std::make_unique<CachelibLru2QCache>(cacheConfig);
+        assert(cachelib_cache_ptr_.get() != NULL);
+
+        cachelib_poolid_ = cachelib_cache_ptr_->addPool("default", cachelib_cache_ptr_->getCacheMemoryStats().ramCacheSize);
+
+        oss.clear();
+        oss.str("");
+        oss << "DRAM capacity: " << dram_capacity_bytes_ << " bytes; NVM capacity: " << nvm_capacity_bytes_ << " bytes on " << nvm_filepath_ << "; NVM admit probability: " << cachelib_nvm_info.getNvmAdmitProbability();
+        Util::dumpNormalMsg(instance_name_, oss.str());
+    }
+
+    CachelibHybridLocalCache::~CachelibHybridLocalCache()
+    {
+        // Dump per-tier statistics
+        const uint64_t dram_hitcnt = dram_hitcnt_.load();
+        const uint64_t nvm_hitcnt = nvm_hitcnt_.load();
+        const uint64_t total_reqcnt = dram_hitcnt + nvm_hitcnt + misscnt_.load();
+        std::ostringstream oss;
+        oss << "DRAM hitcnt: " << dram_hitcnt << "; NVM hitcnt: " << nvm_hitcnt << "; misscnt: " << misscnt_.load();
+        if (total_reqcnt > 0)
+        {
+            oss << "; DRAM hit ratio: " << static_cast<double>(dram_hitcnt) / static_cast<double>(total_reqcnt) << "; NVM hit ratio: " << static_cast<double>(nvm_hitcnt) / static_cast<double>(total_reqcnt);
+        }
+        oss << "; demotecnt: " << demotecnt_.load() << "; NVM rejectcnt: " << nvm_rejectcnt_.load() << "; NVM evictcnt: " << nvm_evictcnt_.load();
+        Util::dumpNormalMsg(instance_name_, oss.str());
+
+        // NOTE: release Cachelib (incl. Navy threads invoking onItemDestroyed_()) before other member variables
+        cachelib_cache_ptr_.reset();
+
+        std::remove(nvm_filepath_.c_str());
+    }
+
+    const bool CachelibHybridLocalCache::hasFineGrainedManagement() const
+    {
+        return false; // Slab-level cache management in DRAM and region-level cache management in NVM
+    }
+
+    // (1) Check is cached and access validity
+
+    bool CachelibHybridLocalCache::isLocalCachedInternal_(const Key& key) const
+    {
+        // NOTE: NOT use find() of Cachelib, which will promote the object from NVM into DRAM
+        std::lock_guard<std::mutex> lock(cached_objinfos_mutex_);
+        bool is_cached = (cached_objinfos_.find(key) != cached_objinfos_.end());
+        return is_cached;
+    }
+
+    // (2) Access local edge cache (KV data and local metadata)
+
+    bool CachelibHybridLocalCache::getLocalCacheInternal_(const Key& key, const bool& is_redirected, Value& value, bool& affect_victim_tracker) const
+    {
+        UNUSED(is_redirected); // ONLY used by COVERED
+        UNUSED(affect_victim_tracker); // ONLY used by COVERED
+
+        bool is_in_nvm = false;
+        {
+            std::lock_guard<std::mutex> lock(cached_objinfos_mutex_);
+            std::unordered_map<Key, std::pair<uint32_t, bool>, KeyHasher>::const_iterator objinfo_const_iter = cached_objinfos_.find(key);
+            if (objinfo_const_iter == cached_objinfos_.end())
+            {
+                misscnt_++;
+                return false; // NO need to access Cachelib for cache misses
+            }
+            is_in_nvm = objinfo_const_iter->second.second;
+        }
+
+        // NOTE: find() updates LRU2Q metadata in DRAM, or reads the object from NVM and promotes it into DRAM
+        Lru2QCacheReadHandle handle = cachelib_cache_ptr_->find(key.getKeystr());
+        bool is_local_cached = (handle != nullptr);
+        if (is_local_cached)
+        {
+            if (Config::isRealValuePayload())
+            {
+                value = Value(reinterpret_cast<const char*>(handle->getMemory()), handle->getSize());
+            }
+            else
+            {
+                value = Value(handle->getSize());
+            }
+        }
+        handle.reset(); // NOTE: release the handle such that the promoted object can be demoted again
+
+        {
+            std::lock_guard<std::mutex> lock(cached_objinfos_mutex_);
+            std::unordered_map<Key, std::pair<uint32_t, bool>, KeyHasher>::iterator objinfo_iter = cached_objinfos_.find(key);
+            if (objinfo_iter != cached_objinfos_.end() && objinfo_iter->second.second)
+            {
+                const uint32_t tmp_objsize = key.getKeyLength() + objinfo_iter->second.first;
+                if (is_local_cached) // Promoted into DRAM
+                {
+                    objinfo_iter->second.second = false;
+                    nvm_used_bytes_ -= tmp_objsize;
+                }
+                else // Dropped by Navy w/o item destructor (e.g., failed to write into NVM)
+                {
+                    nvm_used_bytes_ -= tmp_objsize;
+                    pending_victims_.insert(std::pair<Key, Value>(key, Value(objinfo_iter->second.first)));
+                    pending_victim_bytes_ += tmp_objsize;
+                    cached_objinfos_.erase(objinfo_iter);
+                }
+            }
+        }
+
+        if (!is_local_cached)
+        {
+            misscnt_++;
+        }
+        else if (is_in_nvm)
+        {
+            nvm_hitcnt_++;
+            demoteDramVictims_(); // Promoted object may make DRAM usage exceed DRAM capacity
+        }
+        else
+        {
+            dram_hitcnt_++;
+        }
+
+        return is_local_cached;
+    }
+
+    bool CachelibHybridLocalCache::getLocalCacheInternal_p2p_(const Key& key, const bool& is_redirected, Value& value, bool& affect_victim_tracker, const uint32_t redirected_reward) const
+    {
+        std::ostringstream oss;
+        oss << "getLocalCacheInternal_p2p_() is NOT supported by " << kClassName << "!";
+        Util::dumpErrorMsg(instance_name_, oss.str());
+        exit(1);
+        return false;
+    }
+
+    bool CachelibHybridLocalCache::updateLocalCacheInternal_(const Key& key, const Value& value, const bool& is_getrsp, const bool& is_global_cached, bool& affect_victim_tracker, bool& is_successful)
+    {
+        const bool is_valid_objsize = isValidObjsize_(key, value); // Object size checking
+
+        UNUSED(is_getrsp); // ONLY used by COVERED
+        UNUSED(is_global_cached); // ONLY used by COVERED
+        UNUSED(affect_victim_tracker); // ONLY used by COVERED
+        is_successful = false;
+
+        bool is_local_cached = isLocalCachedInternal_(key);
+        if (is_local_cached) // Key already exists in either DRAM or NVM
+        {
+            if (!is_valid_objsize)
+            {
+                is_successful = false; // NOT cache too large object size due to slab class size limitation of Cachelib -> equivalent to NOT caching the latest value (will be invalidated by CacheWrapper later if key is local cached)
+                return is_local_cached;
+            }
+
+            // Update with the latest value in DRAM (NOTE: insertOrReplace() also drops the stale copy in NVM if any)
+            is_successful = insertIntoDram_(key.getKeystr(), value);
+            if (is_successful)
+            {
+                std::lock_guard<std::mutex> lock(cached_objinfos_mutex_);
+                std::unordered_map<Key, std::pair<uint32_t, bool>, KeyHasher>::iterator objinfo_iter = cached_objinfos_.find(key);
+                if (objinfo_iter != cached_objinfos_.end())
+                {
+                    if (objinfo_iter->second.second)
+                    {
+                        nvm_used_bytes_ -= key.getKeyLength() + objinfo_iter->second.first;
+                    }
+                    objinfo_iter->second = std::pair<uint32_t, bool>(value.getValuesize(), false);
+                }
+                else // Evicted by Navy after isLocalCachedInternal_() and hence already in pending victims
+                {
+                    cached_objinfos_.insert(std::pair<Key, std::pair<uint32_t, bool>>(key, std::pair<uint32_t, bool>(value.getValuesize(), false)));
+                    std::unordered_map<Key, Value, KeyHasher>::iterator pending_victim_iter = pending_victims_.find(key);
+                    if (pending_victim_iter != pending_victims_.end())
+                    {
+                        pending_victim_bytes_ -= key.getKeyLength() + pending_victim_iter->second.getValuesize();
+                        pending_victims_.erase(pending_victim_iter);
+                    }
+                }
+            }
+            // NOTE: cache may fail to allocate due to too many pending writes -> equivalent to NOT caching the latest value (BUT still local cached, yet will be invalidated by CacheWrapper later)
+
+            demoteDramVictims_();
+        }
+
+        return is_local_cached;
+    }
+
+    // (3) Local edge cache management
+
+    bool CachelibHybridLocalCache::needIndependentAdmitInternal_(const Key& key, const Value& value) const
+    {
+        UNUSED(value);
+
+        // CacheLib (LRU2Q) cache uses default admission policy for DRAM (i.e., always admit), which always returns true as long as key is not cached in either tier
+        bool is_local_cached = isLocalCachedInternal_(key);
+        return !is_local_cached;
+    }
+
+    void CachelibHybridLocalCache::admitLocalCacheInternal_(const Key& key, const Value& value, const bool& is_neighbor_cached, bool& affect_victim_tracker, bool& is_successful, const uint64_t& miss_latency_us)
+    {
+        UNUSED(is_neighbor_cached); // ONLY used by COVERED
+        UNUSED(affect_victim_tracker); // ONLY used by COVERED
+        UNUSED(miss_latency_us); // ONLY used by LA-Cache
+
+        assert(!isLocalCachedInternal_(key)); // Key should NOT exist
+
+        // NOTE: new objects are always admitted into DRAM, and then demoted into NVM as DRAM victims
+        is_successful = insertIntoDram_(key.getKeystr(), value);
+        if (is_successful)
+        {
+            std::lock_guard<std::mutex> lock(cached_objinfos_mutex_);
+            cached_objinfos_.insert(std::pair<Key, std::pair<uint32_t, bool>>(key, std::pair<uint32_t, bool>(value.getValuesize(), false)));
+
+            // NOTE: the re-admitted object should NOT be reported as a victim any more
+            std::unordered_map<Key, Value, KeyHasher>::iterator pending_victim_iter = pending_victims_.find(key);
+            if (pending_victim_iter != pending_victims_.end())
+            {
+                pending_victim_bytes_ -= key.getKeyLength() + pending_victim_iter->second.getValuesize();
+                pending_victims_.erase(pending_victim_iter);
+            }
+        }
+        // NOTE: cache may fail to allocate due to too many pending writes -> equivalent to NOT admitting the new key-value pair (CacheWrapper will NOT add track validity flag for the object)
+
+        demoteDramVictims_();
+
+        return;
+    }
+
+    bool CachelibHybridLocalCache::getLocalCacheVictimKeysInternal_(std::unordered_set<Key, KeyHasher>& keys, std::list<VictimCacheinfo>& victim_cacheinfos, const uint64_t& required_size) const
+    {
+        assert(hasFineGrainedManagement());
+
+        Util::dumpErrorMsg(instance_name_, "getLocalCacheVictimKeysInternal_() is not supported due to coarse-grained management");
+        exit(1);
+
+        return false;
+    }
+
+    bool CachelibHybridLocalCache::evictLocalCacheWithGivenKeyInternal_(const Key& key, Value& value)
+    {
+        assert(hasFineGrainedManagement());
+
+        Util::dumpErrorMsg(instance_name_, "evictLocalCacheWithGivenKeyInternal_() is not supported due to coarse-grained management");
+        exit(1);
+
+        return false;
+    }
+
+    void CachelibHybridLocalCache::evictLocalCacheNoGivenKeyInternal_(std::unordered_map<Key, Value, KeyHasher>& victims, const uint64_t& required_size)
+    {
+        assert(!hasFineGrainedManagement());
+
+        // Report objects already removed from both tiers by Cachelib first
+        {
+            std::lock_guard<std::mutex> lock(cached_objinfos_mutex_);
+            victims.insert(pending_victims_.begin(), pending_victims_.end());
+            pending_victims_.clear();
+            pending_victim_bytes_ = 0;
+        }
+        if (victims.size() > 0)
+        {
+            return; // NOTE: CacheServer will use a while loop to evict more victims if necessary
+        }
+
+        // NOTE: rarely happens as Navy evicts NVM by itself -> drop the coldest DRAM object from both tiers, or an arbitrary NVM object if DRAM is empty
+        std::string victim_keystr = "";
+        Lru2QCacheItem* item_ptr = findDramVictim_(required_size);
+        if (item_ptr != nullptr)
+        {
+            victim_keystr = std::string((const char*)item_ptr->getKey().data(), item_ptr->getKey().size());
+            cachelib_cache_ptr_->allocator_->free(item_ptr); // NOTE: Cachelib has already evicted the victim from DRAM (see demoteDramVictims_())
+            item_ptr = NULL;
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(cached_objinfos_mutex_);
+            for (std::unordered_map<Key, std::pair<uint32_t, bool>, KeyHasher>::const_iterator objinfo_const_iter = cached_objinfos_.begin(); objinfo_const_iter != cached_objinfos_.end(); objinfo_const_iter++)
+            {
+                if (objinfo_const_iter->second.second)
+                {
+                    victim_keystr = objinfo_const_iter->first.getKeystr();
+                    break;
+                }
+            }
+        }
+        assert(victim_keystr != "");
+        cachelib_cache_ptr_->remove(victim_keystr); // Drop the copy in NVM if any (NO effect if already removed)
+
+        const Key victim_key(victim_keystr);
+        {
+            std::lock_guard<std::mutex> lock(cached_objinfos_mutex_);
+            std::unordered_map<Key, std::pair<uint32_t, bool>, KeyHasher>::iterator objinfo_iter = cached_objinfos_.find(victim_key);
+            if (objinfo_iter != cached_objinfos_.end()) // NOT removed by item destructor due to NVM admission rejection
+            {
+                if (objinfo_iter->second.second)
+                {
+                    nvm_used_bytes_ -= victim_key.getKeyLength() + objinfo_iter->second.first;
+                }
+                victims.insert(std::pair<Key, Value>(victim_key, Value(objinfo_iter->second.first)));
+                cached_objinfos_.erase(objinfo_iter);
+            }
+
+            victims.insert(pending_victims_.begin(), pending_victims_.end());
+            pending_victims_.clear();
+            pending_victim_bytes_ = 0;
+        }
+        assert(victims.size() > 0);
+
+        return;
+    }
+
+    // (4) Other functions
+
+    uint64_t CachelibHybridLocalCache::getSizeForCapacityInternal_() const
+    {
+        // NOTE: should NOT use cachelib_cache_ptr_->getCacheMemoryStats().ramCacheSize, which is usable cache size (i.e. capacity) instead of used size
+        uint64_t internal_size = cachelib_cache_ptr_->getUsedSize(cachelib_poolid_);
+
+        // NOTE: pending victims still occupy capacity until reported to EdgeWrapper, which triggers eviction to drain them
+        std::lock_guard<std::mutex> lock(cached_objinfos_mutex_);
+        internal_size += nvm_used_bytes_ + pending_victim_bytes_;
+
+        return internal_size;
+    }
+
+    void CachelibHybridLocalCache::checkPointersInternal_() const
+    {
+        assert(cachelib_cache_ptr_ != NULL);
+        return;
+    }
+
+    bool CachelibHybridLocalCache::checkObjsizeInternal_(const ObjectSize& objsize) const
+    {
+        // NOTE: Navy region size is larger than max slab size
+        bool is_valid_objsize = objsize <= max_allocation_class_size_;
+        return is_valid_objsize;
+    }
+
+    // (5) Tier management
+
+    bool CachelibHybridLocalCache::insertIntoDram_(const std::string& keystr, const Value& value)
+    {
+        bool is_successful = false;
+
+        auto allocate_handle = cachelib_cache_ptr_->allocate(cachelib_poolid_, keystr, value.getValuesize());
+        if (allocate_handle != nullptr) // NOTE: cache may fail to evict due to too many pending writes
+        {
+            std::string valuestr = value.generateValuestrForStorage();
+            assert(valuestr.size() == value.getValuesize());
+            std::memcpy(allocate_handle->getMemory(), valuestr.data(), value.getValuesize());
+            cachelib_cache_ptr_->insertOrReplace(allocate_handle);
+
+            is_successful = true;
+        }
+
+        return is_successful;
+    }
+
+    void CachelibHybridLocalCache::demoteDramVictims_() const
+    {
+        // NOTE: NOT hold cached_objinfos_mutex_ when invoking Cachelib, which may invoke onItemDestroyed_() in the same thread
+        while (true)
+        {
+            const uint64_t dram_used_bytes = cachelib_cache_ptr_->getUsedSize(cachelib_poolid_);
+            if (dram_used_bytes <= dram_capacity_bytes_)
+            {
+                break;
+            }
+
+            Lru2QCacheItem* item_ptr = findDramVictim_(dram_used_bytes - dram_capacity_bytes_);
+            if (item_ptr == nullptr) // NO evictable object in DRAM (e.g., all referenced by in-flight handles)
+            {
+                break;
+            }
+            const Key victim_key(std::string((const char*)item_ptr->getKey().data(), item_ptr->getKey().size()));
+
+            // NOTE: findEviction() just evicts the victim object from DRAM (and writes it into NVM if admitted) yet NOT reclaim its slab memory!!!
+            cachelib_cache_ptr_->allocator_->free(item_ptr); // NOTE: this will decrease currAllocSize_ of corresponding MemoryPool and hence affect DRAM usage
+            item_ptr = NULL;
+
+            std::lock_guard<std::mutex> lock(cached_objinfos_mutex_);
+            std::unordered_map<Key, std::pair<uint32_t, bool>, KeyHasher>::iterator objinfo_iter = cached_objinfos_.find(victim_key);
+            if (objinfo_iter != cached_objinfos_.end() && !objinfo_iter->second.second) // NOT removed by item destructor due to NVM admission rejection
+            {
+                objinfo_iter->second.second = true;
+                nvm_used_bytes_ += victim_key.getKeyLength() + objinfo_iter->second.first;
+                demotecnt_++;
+            }
+        }
+
+        return;
+    }
+
+    CachelibHybridLocalCache::Lru2QCacheItem* CachelibHybridLocalCache::findDramVictim_(const uint64_t& required_size) const
+    {
+        // NOTE: extra bytes will be evicted by the while loop of the caller
+        uint64_t tmp_required_size = required_size;
+        if (tmp_required_size > max_allocation_class_size_)
+        {
+            tmp_required_size = max_allocation_class_size_;
+        }
+
+        // NOTE: Cachelib performs slab-based eviction, so we use the lower-bound slab class for required size to try to find a victim first (refer to CachelibLocalCache)
+        const auto lower_bound_cid = cachelib_cache_ptr_->allocator_->getAllocationClassId(cachelib_poolid_, static_cast<uint32_t>(tmp_required_size));
+        assert(lower_bound_cid >= 0);
+        Lru2QCacheItem* item_ptr = cachelib_cache_ptr_->findEviction(cachelib_poolid_, lower_bound_cid);
+
+        // NOTE: under limited DRAM capacity, the lower-bound class may NOT have any cached objects -> find victims from subsequent and then previous slab classes
+        if (item_ptr == nullptr && cachelib_cache_ptr_->allocator_->getAllocSize(cachelib_poolid_, lower_bound_cid) < max_allocation_class_size_)
+        {
+            auto tmp_subsequent_cid = lower_bound_cid + 1;
+            while (true)
+            {
+                item_ptr = cachelib_cache_ptr_->findEviction(cachelib_poolid_, tmp_subsequent_cid);
+                if (item_ptr != nullptr || cachelib_cache_ptr_->allocator_->getAllocSize(cachelib_poolid_, tmp_subsequent_cid) == max_allocation_class_size_)
+                {
+                    break;
+                }
+                tmp_subsequent_cid++;
+            }
+        }
+        if (item_ptr == nullptr && lower_bound_cid >= 1)
+        {
+            auto tmp_previous_cid = lower_bound_cid - 1;
+            while (tmp_previous_cid >= 0)
+            {
+                item_ptr = cachelib_cache_ptr_->findEviction(cachelib_poolid_, tmp_previous_cid);
+                if (item_ptr != nullptr)
+                {
+                    break;
+                }
+                tmp_previous_cid--;
+            }
+        }
+
+        return item_ptr;
+    }
+
+    void CachelibHybridLocalCache::onItemDestroyed_(const Lru2QDestructorData& data)
+    {
+        // NOTE: removals (e.g., replaced by the latest value) are issued by ourselves and have been tracked in cached_objinfos_
+        const bool is_nvm_rejected = (data.context == facebook::cachelib::DestructorContext::kEvictedFromRAM); // DRAM victim NOT written into NVM
+        const bool is_nvm_evicted = (data.context == facebook::cachelib::DestructorContext::kEvictedFromNVM);
+        if (!is_nvm_rejected && !is_nvm_evicted)
+        {
+            return;
+        }
+
+        const Key key(std::string((const char*)data.item.getKey().data(), data.item.getKey().size()));
+        {
+            std::lock_guard<std::mutex> lock(cached_objinfos_mutex_);
+            std::unordered_map<Key, std::pair<uint32_t, bool>, KeyHasher>::iterator objinfo_iter = cached_objinfos_.find(key);
+            if (objinfo_iter == cached_objinfos_.end()) // Already reported as a victim
+            {
+                return;
+            }
+
+            const uint32_t tmp_objsize = key.getKeyLength() + objinfo_iter->second.first;
+            if (objinfo_iter->second.second)
+            {
+                nvm_used_bytes_ -= tmp_objsize;
+            }
+            pending_victims_.insert(std::pair<Key, Value>(key, Value(objinfo_iter->second.first)));
+            pending_victim_bytes_ += tmp_objsize;
+            cached_objinfos_.erase(objinfo_iter);
+        }
+
+        if (is_nvm_rejected)
+        {
+            nvm_rejectcnt_++;
+        }
+        else
+        {
+            nvm_evictcnt_++;
+        }
+
+        return;
+    }
+}
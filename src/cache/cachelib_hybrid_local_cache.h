@@ -0,0 +1,126 @@
+/*
+ * CachelibHybridLocalCache: local edge cache with LRU2Q policy in DRAM and Navy (BlockCache for large objects + BigHash for small objects) on a file-backed NVM device based on Cachelib (https://github.com/facebook/CacheLib).
+ *
+ * NOTE: capacity_bytes covers both tiers, where NVM capacity comes from EdgeCLI (see CachelibNvmInfo) and the rest is DRAM capacity.
+ *
+ * NOTE: we demote DRAM victims into NVM inside CachelibHybridLocalCache once DRAM usage exceeds DRAM capacity (Cachelib writes the victim into Navy in findEviction() if admitted by CachelibHybridNvmAdmissionPolicy), so demotion is invisible to EdgeWrapper and cooperation; an object leaves the hybrid cache ONLY if rejected by NVM admission or evicted by Navy, which is tracked by the item destructor of Cachelib and reported as victims in the next eviction of EdgeWrapper.
+ *
+ * NOTE: see notes on source code of cachelib in docs/cachelib.md.
+ */
+
+#ifndef CACHELIB_HYBRID_LOCAL_CACHE_H
+#define CACHELIB_HYBRID_LOCAL_CACHE_H
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "cache/cachelib/CacheAllocator-inl.h"
+#include "cache/local_cache_base.h"
+#include "common/cachelib_nvm_info.h"
+
+namespace covered
+{
+    // Random NVM admission for DRAM victims (rejected victims are evicted from the hybrid cache directly)
+    class CachelibHybridNvmAdmissionPolicy : public facebook::cachelib::NvmAdmissionPolicy<Lru2QAllocator>
+    {
+    public:
+        CachelibHybridNvmAdmissionPolicy(const double& admit_probability);
+        virtual ~CachelibHybridNvmAdmissionPolicy();
+    protected:
+        virtual bool acceptImpl(const Lru2QAllocator::Item& item, folly::Range<Lru2QAllocator::ChainedItemIter> chained_item_range) override;
+    private:
+        const double admit_probability_;
+    };
+
+    class CachelibHybridLocalCache : public LocalCacheBase
+    {
+    public:
+        typedef Lru2QAllocator CachelibLru2QCache; // LRU2Q cache policy
+        typedef CachelibLru2QCache::Config Lru2QCacheConfig;
+        typedef CachelibLru2QCache::NvmCacheConfig Lru2QNvmCacheConfig;
+        typedef CachelibLru2QCache::ReadHandle Lru2QCacheReadHandle;
+        typedef CachelibLru2QCache::Item Lru2QCacheItem;
+        typedef CachelibLru2QCache::DestructorData Lru2QDestructorData;
+
+        static const uint64_t NVM_BLOCK_SIZE; // Navy IO alignment
+        static const uint64_t NVM_REGION_SIZE; // Navy BlockCache region (i.e., eviction unit of large objects)
+        static const uint32_t NVM_MIN_REGIONCNT; // Navy needs a few clean regions for in-flight writes
+        static const uint32_t NVM_BIGHASH_SIZE_PERCENTAGE; // Share of NVM capacity for BigHash
+        static const uint32_t NVM_BIGHASH_MAX_ITEM_SIZE; // Objects no larger than this go to BigHash, and others go to BlockCache
+        static const uint32_t NVM_BIGHASH_BUCKET_SIZE;
+        static const uint64_t NVM_BIGHASH_BUCKET_BF_SIZE; // Bloom filter bytes per bucket to avoid NVM reads for misses
+
+        CachelibHybridLocalCache(const EdgeWrapperBase* edge_wrapper_ptr, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const CachelibNvmInfo& cachelib_nvm_info);
+        virtual ~CachelibHybridLocalCache();
+
+        virtual const bool hasFineGrainedManagement() const;
+    private:
+        static const std::string kClassName;
+
+        // (1) Check is cached and access validity
+
+        virtual bool isLocalCachedInternal_(const Key& key) const override;
+
+        // (2) Access local edge cache (KV data and local metadata)
+
+        virtual bool getLocalCacheInternal_(const Key& key, const bool& is_redirected, Value& value, bool& affect_victim_tracker) const override;
+        virtual bool getLocalCacheInternal_p2p_(const Key& key, const bool& is_redirected, Value& value, bool& affect_victim_tracker, const uint32_t redirected_reward) const override;
+
+        virtual bool updateLocalCacheInternal_(const Key& key, const Value& value, const bool& is_getrsp, const bool& is_global_cached, bool& affect_victim_tracker, bool& is_successful) override; // Return if key is local cached for getrsp/put/delreq (is_getrsp indicates getrsp w/ invalid hit or cache miss; is_successful indicates whether value is updated successfully)
+
+        // (3) Local edge cache management
+
+        virtual bool needIndependentAdmitInternal_(const Key& key, const Value& value) const override;
+        virtual void admitLocalCacheInternal_(const Key& key, const Value& value, const bool& is_neighbor_cached, bool& affect_victim_tracker, bool& is_successful, const uint64_t& miss_latency_us = 0) override;
+        virtual bool getLocalCacheVictimKeysInternal_(std::unordered_set<Key, KeyHasher>& keys, std::list<VictimCacheinfo>& victim_cacheinfos, const uint64_t& required_size) const override;
+        virtual bool evictLocalCacheWithGivenKeyInternal_(const Key& key, Value& value) override;
+        virtual void evictLocalCacheNoGivenKeyInternal_(std::unordered_map<Key, Value, KeyHasher>& victims, const uint64_t& required_size) override;
+
+        // (4) Other functions
+
+        // In units of bytes
+        virtual uint64_t getSizeForCapacityInternal_() const override;
+
+        virtual void checkPointersInternal_() const override;
+        virtual bool checkObjsizeInternal_(const ObjectSize& objsize) const override;
+
+        // (5) Tier management
+
+        bool insertIntoDram_(const std::string& keystr, const Value& value); // Return if value is allocated in DRAM successfully
+        void demoteDramVictims_() const; // Demote DRAM victims into NVM until DRAM usage <= DRAM capacity
+        Lru2QCacheItem* findDramVictim_(const uint64_t& required_size) const; // NOTE: the returned victim has been evicted from DRAM (and written into NVM if admitted) by Cachelib
+        void onItemDestroyed_(const Lru2QDestructorData& data); // Invoked by Cachelib when an object is removed from both DRAM and NVM
+
+        // Member variables
+
+        // Const variable
+        std::string instance_name_;
+        uint32_t max_allocation_class_size_; // 4MiB in Cachelib by default
+        uint64_t dram_capacity_bytes_;
+        uint64_t nvm_capacity_bytes_;
+        std::string nvm_filepath_; // Per-edge file-backed NVM device
+
+        // Non-const shared variables
+        std::unique_ptr<CachelibLru2QCache> cachelib_cache_ptr_; // Data and metadata for local edge cache
+        facebook::cachelib::PoolId cachelib_poolid_; // Pool ID for DRAM tier
+
+        // NOTE: cached objects are updated by both local edge cache operations and the item destructor of Cachelib (e.g., from Navy threads), so we need a mutex
+        mutable std::mutex cached_objinfos_mutex_;
+        mutable std::unordered_map<Key, std::pair<uint32_t, bool>, KeyHasher> cached_objinfos_; // Value size and whether in NVM (i.e., NOT in DRAM) of each cached object across both tiers
+        mutable uint64_t nvm_used_bytes_; // Total object size of cached objects in NVM
+        mutable std::unordered_map<Key, Value, KeyHasher> pending_victims_; // Objects already removed from both tiers yet NOT reported to EdgeWrapper
+        mutable uint64_t pending_victim_bytes_; // Total object size of pending victims (still counted into cache size for capacity)
+
+        // Per-tier statistics
+        mutable std::atomic<uint64_t> dram_hitcnt_;
+        mutable std::atomic<uint64_t> nvm_hitcnt_;
+        mutable std::atomic<uint64_t> misscnt_;
+        mutable std::atomic<uint64_t> demotecnt_; // DRAM victims written into NVM
+        mutable std::atomic<uint64_t> nvm_rejectcnt_; // DRAM victims rejected by NVM admission
+        std::atomic<uint64_t> nvm_evictcnt_; // Objects evicted by Navy
+    };
+}
+
+#endif
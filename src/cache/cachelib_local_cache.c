@@ -6,6 +6,7 @@
 #include <cachelib/cachebench/util/CacheConfig.h>
 #include <folly/init/Init.h>
 
+#include "common/config.h"
 #include "common/util.h"
 
 namespace covered
@@ -88,7 +89,14 @@ namespace covered
         if (is_local_cached)
         {
             //std::string value_string{reinterpret_cast<const char*>(handle->getMemory()), handle->getSize()};
-            value = Value(handle->getSize());
+            if (Config::isRealValuePayload())
+            {
+                value = Value(reinterpret_cast<const char*>(handle->getMemory()), handle->getSize());
+            }
+            else
+            {
+                value = Value(handle->getSize());
+            }
         }
 
         return is_local_cached;
@@ -333,24 +341,6 @@ namespace covered
 
     // (4) Other functions
 
-    void CachelibLocalCache::invokeCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr)
-    {
-        std::ostringstream oss;
-        oss << "invokeCustomFunctionInternal_() does NOT support func_name " << func_name;
-        Util::dumpErrorMsg(instance_name_, oss.str());
-        exit(1);
-        return;
-    }
-
-    void CachelibLocalCache::invokeConstCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const
-    {
-        std::ostringstream oss;
-        oss << "invokeConstCustomFunctionInternal_() does NOT support func_name " << func_name;
-        Util::dumpErrorMsg(instance_name_, oss.str());
-        exit(1);
-        return;
-    }
-
     uint64_t CachelibLocalCache::getSizeForCapacityInternal_() const
     {
         // NOTE: should NOT use cachelib_cache_ptr_->getCacheMemoryStats().ramCacheSize, which is usable cache size (i.e. capacity) instead of used size
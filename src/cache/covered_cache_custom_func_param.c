@@ -6,8 +6,6 @@ namespace covered
 
     const std::string UpdateIsNeighborCachedFlagFuncParam::kClassName("UpdateIsNeighborCachedFlagFuncParam");
 
-    const std::string UpdateIsNeighborCachedFlagFuncParam::FUNCNAME("update_is_neighbor_cached_flag");
-
     UpdateIsNeighborCachedFlagFuncParam::UpdateIsNeighborCachedFlagFuncParam(const Key& key, const bool& is_neighbor_cached)
         : CacheCustomFuncParamBase(true, true, key, true), is_neighbor_cached_(is_neighbor_cached)
     {
@@ -26,8 +24,6 @@ namespace covered
 
     const std::string GetLocalSyncedVictimCacheinfosParam::kClassName("GetLocalSyncedVictimCacheinfosParam");
 
-    const std::string GetLocalSyncedVictimCacheinfosParam::FUNCNAME("get_local_synced_victim_cacheinfos");
-
     GetLocalSyncedVictimCacheinfosParam::GetLocalSyncedVictimCacheinfosParam()
         : CacheCustomFuncParamBase(false, false, Key(), false)
     {
@@ -58,8 +54,6 @@ namespace covered
 
     const std::string GetCollectedPopularityParam::kClassName("GetCollectedPopularityParam");
 
-    const std::string GetCollectedPopularityParam::FUNCNAME("get_collected_popularity");
-
     GetCollectedPopularityParam::GetCollectedPopularityParam(const Key& key)
         : CacheCustomFuncParamBase(true, false, key, false)
     {
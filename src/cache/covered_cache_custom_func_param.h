@@ -17,13 +17,11 @@
 
 namespace covered
 {
-    // UpdateIsNeighborCachedFlagFuncParam
+    // UpdateIsNeighborCachedFlagFuncParam: update is_neighbor_cached flag in local cached metadata (for beacon-based local cache metadata udpate)
 
     class UpdateIsNeighborCachedFlagFuncParam : public CacheCustomFuncParamBase
     {
     public:
-        static const std::string FUNCNAME; // Update is_neighbor_cached flag in local cached metadata (for beacon-based local cache metadata udpate)
-
         UpdateIsNeighborCachedFlagFuncParam(const Key& key, const bool& is_neighbor_cached);
         virtual ~UpdateIsNeighborCachedFlagFuncParam();
 
@@ -34,13 +32,11 @@ namespace covered
         const bool is_neighbor_cached_;
     };
 
-    // GetLocalSyncedVictimCacheinfosParam
+    // GetLocalSyncedVictimCacheinfosParam: get up to peredge_synced_victimcnt local synced victims with the least local rewards (for victim synchronization)
 
     class GetLocalSyncedVictimCacheinfosParam : public CacheCustomFuncParamBase
     {
     public:
-        static const std::string FUNCNAME; // Get up to peredge_synced_victimcnt local synced victims with the least local rewards (for victim synchronization)
-
         GetLocalSyncedVictimCacheinfosParam();
         virtual ~GetLocalSyncedVictimCacheinfosParam();
 
@@ -52,13 +48,11 @@ namespace covered
         std::list<VictimCacheinfo> victim_cacheinfos_;
     };
 
-    // GetCollectedPopularityParam
+    // GetCollectedPopularityParam: get collected popularity of local uncached objects (for piggybacking-based popularity colleciton)
 
     class GetCollectedPopularityParam : public CacheCustomFuncParamBase
     {
     public:
-        static const std::string FUNCNAME; // Get collected popularity of local uncached objects (for piggybacking-based popularity colleciton)
-
         GetCollectedPopularityParam(const Key& key);
         virtual ~GetCollectedPopularityParam();
 
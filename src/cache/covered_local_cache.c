@@ -496,25 +496,6 @@ namespace covered
 
     // (4) Other functions
 
-    void CoveredLocalCache::invokeCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr)
-    {
-        assert(func_param_ptr != NULL);
-
-        if (func_name == UpdateIsNeighborCachedFlagFuncParam::FUNCNAME)
-        {
-            UpdateIsNeighborCachedFlagFuncParam* tmp_param_ptr = static_cast<UpdateIsNeighborCachedFlagFuncParam*>(func_param_ptr);
-            updateIsNeighborCachedInternal_(tmp_param_ptr->getKey(), tmp_param_ptr->isNeighborCached());            
-        }
-        else
-        {
-            std::ostringstream oss;
-            oss << "invokeCustomFunctionInternal_() does NOT support func_name " << func_name;
-            Util::dumpErrorMsg(instance_name_, oss.str());
-            exit(1);
-        }
-        return;
-    }
-
     void CoveredLocalCache::updateIsNeighborCachedInternal_(const Key& key, const bool& is_neighbor_cached)
     {
         const bool is_exist = local_cached_metadata_.isKeyExist(key);
@@ -526,50 +507,6 @@ namespace covered
         return;
     }
 
-    void CoveredLocalCache::invokeConstCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const
-    {
-        assert(func_param_ptr != NULL);
-
-        if (func_name == GetLocalSyncedVictimCacheinfosParam::FUNCNAME)
-        {
-            GetLocalSyncedVictimCacheinfosParam* tmp_param_ptr = static_cast<GetLocalSyncedVictimCacheinfosParam*>(func_param_ptr);
-            getLocalSyncedVictimCacheinfosFromLocalCacheInternal_(tmp_param_ptr->getVictimCacheinfosRef());
-
-            // Object size checking
-            const std::list<VictimCacheinfo>& victim_cacheinfos_const_ref = tmp_param_ptr->getVictimCacheinfosConstRef();
-            for (std::list<VictimCacheinfo>::const_iterator victim_const_iter = victim_cacheinfos_const_ref.begin(); victim_const_iter != victim_cacheinfos_const_ref.end(); victim_const_iter++)
-            {
-                ObjectSize tmp_victim_objsize = 0;
-                bool is_complete = victim_const_iter->getObjectSize(tmp_victim_objsize);
-                assert(is_complete);
-                const bool is_valid_objsize = isValidObjsize_(tmp_victim_objsize);
-                assert(is_valid_objsize);
-            }
-        }
-        else if (func_name == GetCollectedPopularityParam::FUNCNAME)
-        {
-            GetCollectedPopularityParam* tmp_param_ptr = static_cast<GetCollectedPopularityParam*>(func_param_ptr);
-            getCollectedPopularityFromLocalCacheInternal_(tmp_param_ptr->getKey(), tmp_param_ptr->getCollectedPopularityRef());
-
-            // Object size checking
-            const CollectedPopularity& collected_popularity_const_ref = tmp_param_ptr->getCollectedPopularityConstRef();
-            if (collected_popularity_const_ref.isTracked())
-            {
-                const bool is_valid_objsize = isValidObjsize_(collected_popularity_const_ref.getObjectSize());
-                assert(is_valid_objsize);
-            }
-        }
-        else
-        {
-            std::ostringstream oss;
-            oss << "invokeConstCustomFunctionInternal_() does NOT support func_name " << func_name;
-            Util::dumpErrorMsg(instance_name_, oss.str());
-            exit(1);
-        }
-
-        return;
-    }
-
     void CoveredLocalCache::getLocalSyncedVictimCacheinfosFromLocalCacheInternal_(std::list<VictimCacheinfo>& victim_cacheinfos) const
     {
         for (uint32_t least_popular_rank = 0; least_popular_rank < peredge_synced_victimcnt_; least_popular_rank++)
@@ -671,7 +608,7 @@ namespace covered
 
     uint32_t CoveredLocalCache::hashForTommyds_(const Key& key) const
     {
-        return tommy_hash_u32(0, key.getKeystr().c_str(), key.getKeyLength());
+        return static_cast<uint32_t>(key.getKeyHash()); // NOTE: reuse the precomputed key hash w/o hashing key string again
     }
 
     #ifdef ENABLE_SMALL_LRU_CACHE
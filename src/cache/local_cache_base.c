@@ -7,6 +7,7 @@
 #include "cache/adaptsize_local_cache.h"
 #include "cache/arc_local_cache.h"
 #include "cache/bestguess_local_cache.h"
+#include "cache/cachelib_hybrid_local_cache.h"
 #include "cache/cachelib_local_cache.h"
 #include "cache/covered_local_cache.h"
 #include "cache/fifo_local_cache.h"
@@ -20,6 +21,7 @@
 #include "cache/greedy_dual_local_cache.h"
 #include "cache/s3fifo_local_cache.h"
 #include "cache/segcache_local_cache.h"
+#include "cache/sharded_local_cache.h"
 #include "cache/sieve_local_cache.h"
 #include "cache/slru_local_cache.h"
 #include "cache/wtinylfu_local_cache.h"
@@ -28,7 +30,31 @@ namespace covered
 {
     const std::string LocalCacheBase::kClassName("LocalCacheBase");
 
-    LocalCacheBase* LocalCacheBase::getLocalCacheByCacheName(const EdgeWrapperBase* edge_wrapper_ptr, const std::string& cache_name, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const uint32_t& dataset_keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& peredge_synced_victimcnt)
+    LocalCacheBase* LocalCacheBase::getLocalCacheByCacheName(const EdgeWrapperBase* edge_wrapper_ptr, const std::string& cache_name, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const uint32_t& dataset_keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& peredge_synced_victimcnt, const uint32_t& local_cache_shardcnt, const CachelibNvmInfo& cachelib_nvm_info)
+    {
+        LocalCacheBase* local_cache_ptr = NULL;
+        if (local_cache_shardcnt > 1 && ShardedLocalCache::isShardable(cache_name))
+        {
+            // Split key space into independently locked sub-caches
+            local_cache_ptr = new ShardedLocalCache(edge_wrapper_ptr, cache_name, edge_idx, capacity_bytes, dataset_keycnt, local_uncached_capacity_bytes, local_uncached_lru_bytes, peredge_synced_victimcnt, local_cache_shardcnt);
+        }
+        else
+        {
+            if (local_cache_shardcnt > 1)
+            {
+                std::ostringstream oss;
+                oss << "local edge cache " << cache_name << " does not support sharding -> fallback to a single shard (local_cache_shardcnt = " << local_cache_shardcnt << ")";
+                Util::dumpWarnMsg(kClassName, oss.str());
+            }
+
+            local_cache_ptr = createLocalCacheByCacheName_(edge_wrapper_ptr, cache_name, edge_idx, capacity_bytes, dataset_keycnt, local_uncached_capacity_bytes, local_uncached_lru_bytes, peredge_synced_victimcnt, cachelib_nvm_info);
+        }
+
+        assert(local_cache_ptr != NULL);
+        return local_cache_ptr;
+    }
+
+    LocalCacheBase* LocalCacheBase::createLocalCacheByCacheName_(const EdgeWrapperBase* edge_wrapper_ptr, const std::string& cache_name, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const uint32_t& dataset_keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& peredge_synced_victimcnt, const CachelibNvmInfo& cachelib_nvm_info)
     {
         LocalCacheBase* local_cache_ptr = NULL;
         if (cache_name == Util::ADAPTSIZE_CACHE_NAME || cache_name == Util::SHARK_EXTENDED_ADAPTSIZE_CACHE_NAME || cache_name == Util::MAGNET_EXTENDED_ADAPTSIZE_CACHE_NAME)
@@ -47,6 +73,10 @@ namespace covered
         {
             local_cache_ptr = new CachelibLocalCache(edge_wrapper_ptr, edge_idx, capacity_bytes);
         }
+        else if (cache_name == Util::CACHELIB_HYBRID_CACHE_NAME)
+        {
+            local_cache_ptr = new CachelibHybridLocalCache(edge_wrapper_ptr, edge_idx, capacity_bytes, cachelib_nvm_info);
+        }
         else if (cache_name == Util::FIFO_CACHE_NAME || cache_name == Util::SHARK_EXTENDED_FIFO_CACHE_NAME || cache_name == Util::MAGNET_EXTENDED_FIFO_CACHE_NAME)
         {
             local_cache_ptr = new FifoLocalCache(edge_wrapper_ptr, edge_idx, capacity_bytes);
@@ -119,25 +149,32 @@ namespace covered
         return local_cache_ptr;
     }
 
-    LocalCacheBase::LocalCacheBase(const EdgeWrapperBase* edge_wrapper_ptr, const uint32_t& edge_idx, const uint64_t& capacity_bytes) : capacity_bytes_(capacity_bytes), edge_wrapper_ptr_(edge_wrapper_ptr)
+    LocalCacheBase::LocalCacheBase(const EdgeWrapperBase* edge_wrapper_ptr, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const bool& need_local_cache_rwlock) : capacity_bytes_(capacity_bytes), edge_wrapper_ptr_(edge_wrapper_ptr), need_local_cache_rwlock_(need_local_cache_rwlock)
     {
         // Differentiate local edge cache in different edge nodes
         std::ostringstream oss;
         oss << kClassName << " edge" << edge_idx;
         base_instance_name_ = oss.str();
 
-        oss.clear();
-        oss.str("");
-        oss << base_instance_name_ << " " << "rwlock_for_local_cache_ptr_";
-        rwlock_for_local_cache_ptr_ = new Rwlock(oss.str());
-        assert(rwlock_for_local_cache_ptr_ != NULL);
+        rwlock_for_local_cache_ptr_ = NULL;
+        if (need_local_cache_rwlock_)
+        {
+            oss.clear();
+            oss.str("");
+            oss << base_instance_name_ << " " << "rwlock_for_local_cache_ptr_";
+            rwlock_for_local_cache_ptr_ = new Rwlock(oss.str());
+            assert(rwlock_for_local_cache_ptr_ != NULL);
+        }
     }
 
     LocalCacheBase::~LocalCacheBase()
     {
-        assert(rwlock_for_local_cache_ptr_ != NULL);
-        delete rwlock_for_local_cache_ptr_;
-        rwlock_for_local_cache_ptr_ = NULL;
+        if (need_local_cache_rwlock_)
+        {
+            assert(rwlock_for_local_cache_ptr_ != NULL);
+            delete rwlock_for_local_cache_ptr_;
+            rwlock_for_local_cache_ptr_ = NULL;
+        }
     }
 
     // (1) Check is cached and access validity
@@ -147,12 +184,12 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock to check local metadata atomically
-        std::string context_name = "LocalCacheBase::isLocalCached()";
-        rwlock_for_local_cache_ptr_->acquire_lock_shared(context_name);
+        const char* context_name = "LocalCacheBase::isLocalCached()";
+        acquireLocalCacheLockShared_(context_name);
 
         bool is_cached = isLocalCachedInternal_(key);
 
-        rwlock_for_local_cache_ptr_->unlock_shared(context_name);
+        unlockLocalCacheLockShared_(context_name);
         return is_cached;
     }
 
@@ -163,8 +200,8 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock to update local metadata atomically
-        std::string context_name = "LocalCacheBase::getLocalCache()";
-        rwlock_for_local_cache_ptr_->acquire_lock(context_name);
+        const char* context_name = "LocalCacheBase::getLocalCache()";
+        acquireLocalCacheLock_(context_name);
 
         bool is_local_cached = getLocalCacheInternal_(key, is_redirected, value, affect_victim_tracker);
 
@@ -175,7 +212,7 @@ namespace covered
             assert(is_valid_objsize);
         }
 
-        rwlock_for_local_cache_ptr_->unlock(context_name);
+        unlockLocalCacheLock_(context_name);
 
         return is_local_cached;
     }
@@ -185,8 +222,8 @@ namespace covered
         checkPointers_();
         assert(is_redirected);
         // Acquire a write lock to update local metadata atomically
-        std::string context_name = "LocalCacheBase::getLocalCache_p2p()";
-        rwlock_for_local_cache_ptr_->acquire_lock(context_name);
+        const char* context_name = "LocalCacheBase::getLocalCache_p2p()";
+        acquireLocalCacheLock_(context_name);
 
         bool is_local_cached = getLocalCacheInternal_p2p_(key, is_redirected, value, affect_victim_tracker, redirected_reward);
 
@@ -197,7 +234,7 @@ namespace covered
             assert(is_valid_objsize);
         }
 
-        rwlock_for_local_cache_ptr_->unlock(context_name);
+        unlockLocalCacheLock_(context_name);
 
         return is_local_cached;
     }
@@ -207,13 +244,13 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock for local metadata to update local metadata atomically (so no need to hack LFU cache)
-        std::string context_name = "LocalCacheBase::updateLocalCache()";
-        rwlock_for_local_cache_ptr_->acquire_lock(context_name);
+        const char* context_name = "LocalCacheBase::updateLocalCache()";
+        acquireLocalCacheLock_(context_name);
 
         is_successful = false;
         bool is_local_cached = updateLocalCacheInternal_(key, value, is_getrsp, is_global_cached, affect_victim_tracker, is_successful);
 
-        rwlock_for_local_cache_ptr_->unlock(context_name);
+        unlockLocalCacheLock_(context_name);
         return is_local_cached;
     }
 
@@ -231,12 +268,12 @@ namespace covered
         }
 
         // Acquire a write lock for local metadata to update local metadata atomically (so no need to hack LFU cache)
-        std::string context_name = "LocalCacheBase::needIndependentAdmit()";
-        rwlock_for_local_cache_ptr_->acquire_lock(context_name);
+        const char* context_name = "LocalCacheBase::needIndependentAdmit()";
+        acquireLocalCacheLock_(context_name);
 
         bool need_independent_admit = needIndependentAdmitInternal_(key, value);
 
-        rwlock_for_local_cache_ptr_->unlock(context_name);
+        unlockLocalCacheLock_(context_name);
         return need_independent_admit;
     }
 
@@ -245,8 +282,8 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock for local metadata to update local metadata atomically
-        std::string context_name = "LocalCacheBase::admitLocalCache()";
-        rwlock_for_local_cache_ptr_->acquire_lock(context_name);
+        const char* context_name = "LocalCacheBase::admitLocalCache()";
+        acquireLocalCacheLock_(context_name);
 
         // NOTE: MUST with valid object size, as baselines always return false in needIndependentAdmitInternal_() if object size is too large, while COVERED NEVER track large objects in local uncached metadata and hence NEVER trigger normal/fast-path placement for them
         const bool is_valid_objsize = isValidObjsize_(key, value);
@@ -255,7 +292,7 @@ namespace covered
         is_successful = false;
         admitLocalCacheInternal_(key, value, is_neighbor_cached, affect_victim_tracker, is_successful, miss_latency_us);
 
-        rwlock_for_local_cache_ptr_->unlock(context_name);
+        unlockLocalCacheLock_(context_name);
         return;
     }
 
@@ -266,8 +303,8 @@ namespace covered
         assert(hasFineGrainedManagement());
 
         // Acquire a read lock for local metadata to update local metadata atomically
-        std::string context_name = "LocalCacheBase::getLocalCacheVictimKeys()";
-        rwlock_for_local_cache_ptr_->acquire_lock_shared(context_name);
+        const char* context_name = "LocalCacheBase::getLocalCacheVictimKeys()";
+        acquireLocalCacheLockShared_(context_name);
 
         // NOTE: although we ONLY track and admit popular uncached objects w/ reasonable object sizes, required size could still exceed max valid object size due to multiple admissions in parallel -> NO need to check required size
         //assert(isValidObjsize_(static_cast<uint32_t>(required_size)));
@@ -284,7 +321,7 @@ namespace covered
             assert(is_valid_objsize);
         }
 
-        rwlock_for_local_cache_ptr_->unlock_shared(context_name);
+        unlockLocalCacheLockShared_(context_name);
         return has_victim_key;
     }
 
@@ -295,8 +332,8 @@ namespace covered
         assert(hasFineGrainedManagement());
 
         // Acquire a write lock for local metadata to update local metadata atomically
-        std::string context_name = "LocalCacheBase::evictLocalCacheIfKeyMatch()";
-        rwlock_for_local_cache_ptr_->acquire_lock(context_name);
+        const char* context_name = "LocalCacheBase::evictLocalCacheIfKeyMatch()";
+        acquireLocalCacheLock_(context_name);
 
         bool is_evict = evictLocalCacheWithGivenKeyInternal_(key, value);
 
@@ -307,7 +344,7 @@ namespace covered
             assert(is_valid_objsize);
         }
 
-        rwlock_for_local_cache_ptr_->unlock(context_name);
+        unlockLocalCacheLock_(context_name);
         return is_evict;
     }
 
@@ -318,8 +355,8 @@ namespace covered
         assert(!hasFineGrainedManagement());
 
         // Acquire a write lock for local metadata to update local metadata atomically
-        std::string context_name = "LocalCacheBase::evictLocalCache()";
-        rwlock_for_local_cache_ptr_->acquire_lock(context_name);
+        const char* context_name = "LocalCacheBase::evictLocalCache()";
+        acquireLocalCacheLock_(context_name);
 
         evictLocalCacheNoGivenKeyInternal_(victims, required_size);
 
@@ -333,85 +370,218 @@ namespace covered
             assert(is_valid_objsize);
         }
 
-        rwlock_for_local_cache_ptr_->unlock(context_name);
+        unlockLocalCacheLock_(context_name);
         return;
     }
 
     // (4) Other functions
 
-    void LocalCacheBase::invokeCustomFunction(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr)
+    void LocalCacheBase::invokeCustomFunction(UpdateIsNeighborCachedFlagFuncParam* func_param_ptr)
+    {
+        checkPointers_();
+        assert(func_param_ptr != NULL);
+
+        const char* context_name = "LocalCacheBase::invokeCustomFunction(UpdateIsNeighborCachedFlagFuncParam)";
+
+        preInvokeCustomFunction_(context_name, func_param_ptr);
+
+        updateIsNeighborCachedInternal_(func_param_ptr->getKey(), func_param_ptr->isNeighborCached());
+
+        postInvokeCustomFunction_(context_name, func_param_ptr);
+
+        return;
+    }
+
+    void LocalCacheBase::invokeCustomFunction(UpdateNeighborVictimVtimeParam* func_param_ptr)
+    {
+        checkPointers_();
+        assert(func_param_ptr != NULL);
+
+        const char* context_name = "LocalCacheBase::invokeCustomFunction(UpdateNeighborVictimVtimeParam)";
+
+        preInvokeCustomFunction_(context_name, func_param_ptr);
+
+        updateNeighborVictimVtimeInternal_(func_param_ptr->getNeighborEdgeIdx(), func_param_ptr->getNeighborVictimVtime());
+
+        postInvokeCustomFunction_(context_name, func_param_ptr);
+
+        return;
+    }
+
+    void LocalCacheBase::invokeConstCustomFunction(GetLocalSyncedVictimCacheinfosParam* func_param_ptr) const
+    {
+        checkPointers_();
+        assert(func_param_ptr != NULL);
+
+        const char* context_name = "LocalCacheBase::invokeConstCustomFunction(GetLocalSyncedVictimCacheinfosParam)";
+
+        preInvokeCustomFunction_(context_name, func_param_ptr);
+
+        getLocalSyncedVictimCacheinfosFromLocalCacheInternal_(func_param_ptr->getVictimCacheinfosRef());
+
+        // Object size checking
+        const std::list<VictimCacheinfo>& victim_cacheinfos_const_ref = func_param_ptr->getVictimCacheinfosConstRef();
+        for (std::list<VictimCacheinfo>::const_iterator victim_const_iter = victim_cacheinfos_const_ref.begin(); victim_const_iter != victim_cacheinfos_const_ref.end(); victim_const_iter++)
+        {
+            ObjectSize tmp_victim_objsize = 0;
+            bool is_complete = victim_const_iter->getObjectSize(tmp_victim_objsize);
+            assert(is_complete);
+            UNUSED(is_complete);
+            const bool is_valid_objsize = isValidObjsize_(tmp_victim_objsize);
+            assert(is_valid_objsize);
+            UNUSED(is_valid_objsize);
+        }
+
+        postInvokeCustomFunction_(context_name, func_param_ptr);
+
+        return;
+    }
+
+    void LocalCacheBase::invokeConstCustomFunction(GetCollectedPopularityParam* func_param_ptr) const
+    {
+        checkPointers_();
+        assert(func_param_ptr != NULL);
+
+        const char* context_name = "LocalCacheBase::invokeConstCustomFunction(GetCollectedPopularityParam)";
+
+        preInvokeCustomFunction_(context_name, func_param_ptr);
+
+        getCollectedPopularityFromLocalCacheInternal_(func_param_ptr->getKey(), func_param_ptr->getCollectedPopularityRef());
+
+        // Object size checking
+        const CollectedPopularity& collected_popularity_const_ref = func_param_ptr->getCollectedPopularityConstRef();
+        if (collected_popularity_const_ref.isTracked())
+        {
+            const bool is_valid_objsize = isValidObjsize_(collected_popularity_const_ref.getObjectSize());
+            assert(is_valid_objsize);
+            UNUSED(is_valid_objsize);
+        }
+
+        postInvokeCustomFunction_(context_name, func_param_ptr);
+
+        return;
+    }
+
+    void LocalCacheBase::invokeConstCustomFunction(GetLocalVictimVtimeFuncParam* func_param_ptr) const
     {
         checkPointers_();
+        assert(func_param_ptr != NULL);
 
-        std::string context_name = "LocalCacheBase::invokeCustomFunction(" + func_name + ")";
+        const char* context_name = "LocalCacheBase::invokeConstCustomFunction(GetLocalVictimVtimeFuncParam)";
 
         preInvokeCustomFunction_(context_name, func_param_ptr);
 
-        invokeCustomFunctionInternal_(func_name, func_param_ptr);
+        getLocalVictimVtimeInternal_(func_param_ptr->getLocalVictimVtimeRef());
 
         postInvokeCustomFunction_(context_name, func_param_ptr);
 
         return;
     }
 
-    void LocalCacheBase::invokeConstCustomFunction(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const
+    void LocalCacheBase::invokeConstCustomFunction(GetPlacementEdgeIdxParam* func_param_ptr) const
     {
         checkPointers_();
+        assert(func_param_ptr != NULL);
 
-        std::string context_name = "LocalCacheBase::invokeConstCustomFunction(" + func_name + ")";
+        const char* context_name = "LocalCacheBase::invokeConstCustomFunction(GetPlacementEdgeIdxParam)";
 
         preInvokeCustomFunction_(context_name, func_param_ptr);
 
-        invokeConstCustomFunctionInternal_(func_name, func_param_ptr);
+        getPlacementEdgeIdxInternal_(func_param_ptr->getPlacementEdgeIdxRef());
 
         postInvokeCustomFunction_(context_name, func_param_ptr);
 
         return;
     }
 
-    void LocalCacheBase::preInvokeCustomFunction_(const std::string& context_name, CacheCustomFuncParamBase* func_param_ptr) const
+    void LocalCacheBase::preInvokeCustomFunction_(const char* context_name, CacheCustomFuncParamBase* func_param_ptr) const
     {
         const bool is_local_cache_write_lock = func_param_ptr->isLocalCacheWriteLock();
         if (is_local_cache_write_lock)
         {
             // Acquire a write lock for local metadata to invoke method-specific function atomically
-            rwlock_for_local_cache_ptr_->acquire_lock(context_name);
+            acquireLocalCacheLock_(context_name);
         }
         else
         {
             // Acquire a read lock for local metadata to invoke method-specific function atomically
-            rwlock_for_local_cache_ptr_->acquire_lock_shared(context_name);
+            acquireLocalCacheLockShared_(context_name);
         }
 
         return;
     }
 
-    void LocalCacheBase::postInvokeCustomFunction_(const std::string& context_name, CacheCustomFuncParamBase* func_param_ptr) const
+    void LocalCacheBase::postInvokeCustomFunction_(const char* context_name, CacheCustomFuncParamBase* func_param_ptr) const
     {
         const bool is_local_cache_write_lock = func_param_ptr->isLocalCacheWriteLock();
         if (is_local_cache_write_lock)
         {
-            rwlock_for_local_cache_ptr_->unlock(context_name);
+            unlockLocalCacheLock_(context_name);
         }
         else
         {
-            rwlock_for_local_cache_ptr_->unlock_shared(context_name);
+            unlockLocalCacheLockShared_(context_name);
         }
 
         return;
     }
 
+    void LocalCacheBase::updateIsNeighborCachedInternal_(const Key& key, const bool& is_neighbor_cached)
+    {
+        dumpUnsupportedCustomFunction_("updateIsNeighborCachedInternal_()");
+        return;
+    }
+
+    void LocalCacheBase::updateNeighborVictimVtimeInternal_(const uint32_t& neighbor_edge_idx, const uint64_t& neighbor_victim_vtime)
+    {
+        dumpUnsupportedCustomFunction_("updateNeighborVictimVtimeInternal_()");
+        return;
+    }
+
+    void LocalCacheBase::getLocalSyncedVictimCacheinfosFromLocalCacheInternal_(std::list<VictimCacheinfo>& victim_cacheinfos) const
+    {
+        dumpUnsupportedCustomFunction_("getLocalSyncedVictimCacheinfosFromLocalCacheInternal_()");
+        return;
+    }
+
+    void LocalCacheBase::getCollectedPopularityFromLocalCacheInternal_(const Key& key, CollectedPopularity& collected_popularity) const
+    {
+        dumpUnsupportedCustomFunction_("getCollectedPopularityFromLocalCacheInternal_()");
+        return;
+    }
+
+    void LocalCacheBase::getLocalVictimVtimeInternal_(uint64_t& local_victim_vtime) const
+    {
+        dumpUnsupportedCustomFunction_("getLocalVictimVtimeInternal_()");
+        return;
+    }
+
+    void LocalCacheBase::getPlacementEdgeIdxInternal_(uint32_t& placement_edge_idx) const
+    {
+        dumpUnsupportedCustomFunction_("getPlacementEdgeIdxInternal_()");
+        return;
+    }
+
+    void LocalCacheBase::dumpUnsupportedCustomFunction_(const char* func_name) const
+    {
+        std::ostringstream oss;
+        oss << "local edge cache does NOT support custom function " << func_name;
+        Util::dumpErrorMsg(base_instance_name_, oss.str());
+        exit(1);
+        return;
+    }
+
     uint64_t LocalCacheBase::getSizeForCapacity() const
     {
         checkPointers_();
 
         // Acquire a read lock for local metadata to update local metadata atomically
-        std::string context_name = "LocalCacheBase::getSizeForCapacity()";
-        rwlock_for_local_cache_ptr_->acquire_lock_shared(context_name);
+        const char* context_name = "LocalCacheBase::getSizeForCapacity()";
+        acquireLocalCacheLockShared_(context_name);
 
         uint64_t internal_size = getSizeForCapacityInternal_();
 
-        rwlock_for_local_cache_ptr_->unlock_shared(context_name);
+        unlockLocalCacheLockShared_(context_name);
 
         return internal_size;
     }
@@ -419,11 +589,50 @@ namespace covered
     void LocalCacheBase::checkPointers_() const
     {
         assert(edge_wrapper_ptr_ != NULL);
-        assert(rwlock_for_local_cache_ptr_ != NULL);
+        if (need_local_cache_rwlock_)
+        {
+            assert(rwlock_for_local_cache_ptr_ != NULL);
+        }
         checkPointersInternal_();
         return;
     }
 
+    void LocalCacheBase::acquireLocalCacheLockShared_(const char* context_name) const
+    {
+        if (need_local_cache_rwlock_)
+        {
+            rwlock_for_local_cache_ptr_->acquire_lock_shared(context_name);
+        }
+        return;
+    }
+
+    void LocalCacheBase::unlockLocalCacheLockShared_(const char* context_name) const
+    {
+        if (need_local_cache_rwlock_)
+        {
+            rwlock_for_local_cache_ptr_->unlock_shared(context_name);
+        }
+        return;
+    }
+
+    void LocalCacheBase::acquireLocalCacheLock_(const char* context_name) const
+    {
+        if (need_local_cache_rwlock_)
+        {
+            rwlock_for_local_cache_ptr_->acquire_lock(context_name);
+        }
+        return;
+    }
+
+    void LocalCacheBase::unlockLocalCacheLock_(const char* context_name) const
+    {
+        if (need_local_cache_rwlock_)
+        {
+            rwlock_for_local_cache_ptr_->unlock(context_name);
+        }
+        return;
+    }
+
     bool LocalCacheBase::isValidObjsize_(const ObjectSize& objsize) const
     {
         bool is_valid_objsize = false;
@@ -14,7 +14,9 @@
 #include <unordered_set>
 #include <vector>
 
+#include "cache/basic_cache_custom_func_param.h"
 #include "cache/cache_custom_func_param_base.h"
+#include "cache/covered_cache_custom_func_param.h"
 
 namespace covered
 {
@@ -22,6 +24,7 @@ namespace covered
     class LocalCacheBase;
 }
 
+#include "common/cachelib_nvm_info.h"
 #include "common/key.h"
 #include "common/value.h"
 #include "concurrency/rwlock.h"
@@ -34,9 +37,10 @@ namespace covered
     class LocalCacheBase
     {
     public:
-        static LocalCacheBase* getLocalCacheByCacheName(const EdgeWrapperBase* edge_wrapper_ptr, const std::string& cache_name, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const uint32_t& dataset_keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& peredge_synced_victimcnt);
+        static LocalCacheBase* getLocalCacheByCacheName(const EdgeWrapperBase* edge_wrapper_ptr, const std::string& cache_name, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const uint32_t& dataset_keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& peredge_synced_victimcnt, const uint32_t& local_cache_shardcnt = 1, const CachelibNvmInfo& cachelib_nvm_info = CachelibNvmInfo());
 
-        LocalCacheBase(const EdgeWrapperBase* edge_wrapper_ptr, const uint32_t& edge_idx, const uint64_t& capacity_bytes);
+        // NOTE: need_local_cache_rwlock = false ONLY if the derived class guarantees thread safety by itself (e.g., ShardedLocalCache w/ per-shard rwlocks)
+        LocalCacheBase(const EdgeWrapperBase* edge_wrapper_ptr, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const bool& need_local_cache_rwlock = true);
         virtual ~LocalCacheBase();
 
         // (1) Check is cached and access validity
@@ -69,10 +73,15 @@ namespace covered
 
         // (4) Other functions
 
-        void invokeCustomFunction(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr); // Invoke some method-specific function for local edge cache
-        void invokeConstCustomFunction(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const; // Invoke some method-specific function for local edge cache
-        void preInvokeCustomFunction_(const std::string& context_name, CacheCustomFuncParamBase* func_param_ptr) const;
-        void postInvokeCustomFunction_(const std::string& context_name, CacheCustomFuncParamBase* func_param_ptr) const;
+        // Invoke some method-specific function for local edge cache (overloaded by param type; unsupported functions are rejected by the default *Internal_() hooks below)
+        void invokeCustomFunction(UpdateIsNeighborCachedFlagFuncParam* func_param_ptr); // For COVERED
+        void invokeCustomFunction(UpdateNeighborVictimVtimeParam* func_param_ptr); // For BestGuess
+        void invokeConstCustomFunction(GetLocalSyncedVictimCacheinfosParam* func_param_ptr) const; // For COVERED
+        void invokeConstCustomFunction(GetCollectedPopularityParam* func_param_ptr) const; // For COVERED
+        void invokeConstCustomFunction(GetLocalVictimVtimeFuncParam* func_param_ptr) const; // For BestGuess
+        void invokeConstCustomFunction(GetPlacementEdgeIdxParam* func_param_ptr) const; // For BestGuess
+        void preInvokeCustomFunction_(const char* context_name, CacheCustomFuncParamBase* func_param_ptr) const;
+        void postInvokeCustomFunction_(const char* context_name, CacheCustomFuncParamBase* func_param_ptr) const;
         
         // In units of bytes
         uint64_t getSizeForCapacity() const; // Get size of data and metadata for local edge cache
@@ -95,8 +104,20 @@ namespace covered
         bool isValidObjsize_(const Key& key, const Value& value) const;
         virtual bool checkObjsizeInternal_(const ObjectSize& objsize) const = 0;
     private:
+        // NOTE: ShardedLocalCache creates its per-shard local caches by createLocalCacheByCacheName_() and checks object sizes by each shard
+        friend class ShardedLocalCache;
+
         static const std::string kClassName;
 
+        static LocalCacheBase* createLocalCacheByCacheName_(const EdgeWrapperBase* edge_wrapper_ptr, const std::string& cache_name, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const uint32_t& dataset_keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& peredge_synced_victimcnt, const CachelibNvmInfo& cachelib_nvm_info = CachelibNvmInfo()); // Unsharded local edge cache
+
+        // (0) Acquire/release rwlock_for_local_cache_ptr_ if necessary
+
+        void acquireLocalCacheLockShared_(const char* context_name) const;
+        void unlockLocalCacheLockShared_(const char* context_name) const;
+        void acquireLocalCacheLock_(const char* context_name) const;
+        void unlockLocalCacheLock_(const char* context_name) const;
+
         // (1) Check is cached and access validity
 
         virtual bool isLocalCachedInternal_(const Key& key) const = 0;
@@ -120,8 +141,14 @@ namespace covered
 
         // (4) Other functions
 
-        virtual void invokeCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) = 0; // Invoke some method-specific function for local edge cache
-        virtual void invokeConstCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const = 0; // Invoke some method-specific function for local edge cache
+        // NOTE: method-specific functions are NOT pure virtual -> only local caches supporting them need to override; others dump an error and exit by default
+        virtual void updateIsNeighborCachedInternal_(const Key& key, const bool& is_neighbor_cached); // Update is_neighbor_cached flag in local cached metadata (for COVERED)
+        virtual void updateNeighborVictimVtimeInternal_(const uint32_t& neighbor_edge_idx, const uint64_t& neighbor_victim_vtime); // Update victim vtime of the given neighbor edge node (for BestGuess)
+        virtual void getLocalSyncedVictimCacheinfosFromLocalCacheInternal_(std::list<VictimCacheinfo>& victim_cacheinfos) const; // Get local synced victims with the least local rewards (for COVERED)
+        virtual void getCollectedPopularityFromLocalCacheInternal_(const Key& key, CollectedPopularity& collected_popularity) const; // Get collected popularity of local uncached objects (for COVERED)
+        virtual void getLocalVictimVtimeInternal_(uint64_t& local_victim_vtime) const; // Get victim vtime of current edge node (for BestGuess)
+        virtual void getPlacementEdgeIdxInternal_(uint32_t& placement_edge_idx) const; // Get placement edge idx under best-guess replacement policy (for BestGuess)
+        void dumpUnsupportedCustomFunction_(const char* func_name) const;
 
         virtual uint64_t getSizeForCapacityInternal_() const = 0; // Get size of data and metadata for local edge cache
 
@@ -132,8 +159,9 @@ namespace covered
         std::string base_instance_name_; // Const shared variable
 
         // NOTE: we use a single read-write lock for thread safety of local edge cache, including concurrent accesses of cached objects and local metadata with fair comparison
-        // NOTE: we do NOT hack each cache for fine-grained locking to avoid extensive complexity
-        mutable Rwlock* rwlock_for_local_cache_ptr_; // Guarantee the atomicity of local edge cache and local metadata
+        // NOTE: we do NOT hack each cache for fine-grained locking to avoid extensive complexity (use ShardedLocalCache instead to split key space into independently locked sub-caches)
+        const bool need_local_cache_rwlock_; // Const shared variable
+        mutable Rwlock* rwlock_for_local_cache_ptr_; // Guarantee the atomicity of local edge cache and local metadata (NULL if need_local_cache_rwlock_ is false)
     };
 }
 
@@ -605,11 +605,39 @@ LRBCache::LRBCache(const uint32_t& dataset_keycnt) : Cache(), n_edc_feature(10),
     eviction_training_data = NULL;
 #endif
     booster = nullptr;
+
+    // NOTE: for background asynchronous training
+    is_background_training = false;
+    background_training_data = NULL;
+    training_thread = NULL;
+    is_training_pending = false;
+    is_training_stop = false;
+    n_model_swap = 0;
 }
 
 // Siyuan: free heap memory
 LRBCache::~LRBCache()
 {
+    // NOTE: stop training_thread before releasing training data and boosters (wait for the ongoing training if any)
+    if (training_thread != NULL)
+    {
+        {
+            std::lock_guard<std::mutex> lock(training_mutex);
+            is_training_stop = true;
+        }
+        training_cv.notify_one();
+        training_thread->join();
+        delete training_thread;
+        training_thread = NULL;
+    }
+    if (background_training_data != NULL)
+    {
+        delete background_training_data;
+        background_training_data = NULL;
+    }
+    BoosterHandle uninstalled_booster = trained_booster.exchange(nullptr);
+    if (uninstalled_booster) LGBM_BoosterFree(uninstalled_booster);
+
     if (training_data != NULL)
     {
         delete training_data;
@@ -650,6 +678,8 @@ void LRBCache::init_with_params(const std::map<std::string, std::string> &params
             training_params["num_leaves"] = it.second;
         } else if (it.first == "byte_million_req") {
             byte_million_req = stoull(it.second);
+        } else if (it.first == "background_training") { // NOTE: for background asynchronous training
+            is_background_training = (stoi(it.second) != 0);
 #ifdef EVICTION_LOGGING
             } else if (it.first == "n_early_stop") {
                 n_early_stop = stoll((it.second));
@@ -714,6 +744,13 @@ void LRBCache::init_with_params(const std::map<std::string, std::string> &params
 //        inference_params["num_threads"] = "4";
     training_data = new TrainingData(this);
     assert(training_data != NULL); // Siyuan: allocate heap memory for TrainingData
+    if (is_background_training) {
+        // NOTE: allocate the other buffer of training data and launch training thread for background asynchronous training
+        background_training_data = new TrainingData(this);
+        assert(background_training_data != NULL);
+        training_thread = new std::thread(&LRBCache::background_train, this);
+        assert(training_thread != NULL);
+    }
 #ifdef EVICTION_LOGGING
     eviction_training_data = new LRBEvictionTrainingData(this);
     assert(eviction_training_data != NULL); // Siyuan: allocate heap memory for TrainingData
@@ -730,19 +767,28 @@ void LRBCache::init_with_params(const std::map<std::string, std::string> &params
 }
     
 void LRBCache::train() {
+    if (booster) LGBM_BoosterFree(booster);
+    booster = train_booster(training_data);
+    ++n_model_swap;
+    model_install_time = std::chrono::steady_clock::now();
+}
+
+// NOTE: train a new booster on the given training data, which is either training_data (inline training) or a snapshot owned by training_thread (background training)
+BoosterHandle LRBCache::train_booster(TrainingData *snapshot) {
+    assert(snapshot != NULL);
     ++n_retrain;
     auto timeBegin = std::chrono::system_clock::now();
-    if (booster) LGBM_BoosterFree(booster);
+    BoosterHandle new_booster = nullptr;
     // create training dataset
     DatasetHandle trainData;
     LGBM_DatasetCreateFromCSR(
-            static_cast<void *>(training_data->indptr.data()),
+            static_cast<void *>(snapshot->indptr.data()),
             C_API_DTYPE_INT32,
-            training_data->indices.data(),
-            static_cast<void *>(training_data->data.data()),
+            snapshot->indices.data(),
+            static_cast<void *>(snapshot->data.data()),
             C_API_DTYPE_FLOAT64,
-            training_data->indptr.size(),
-            training_data->data.size(),
+            snapshot->indptr.size(),
+            snapshot->data.size(),
             n_feature,  //remove future t
             training_params,
             nullptr,
@@ -750,31 +796,31 @@ void LRBCache::train() {
 
     LGBM_DatasetSetField(trainData,
                         "label",
-                        static_cast<void *>(training_data->labels.data()),
-                        training_data->labels.size(),
+                        static_cast<void *>(snapshot->labels.data()),
+                        snapshot->labels.size(),
                         C_API_DTYPE_FLOAT32);
 
     // init booster
-    LGBM_BoosterCreate(trainData, training_params, &booster);
+    LGBM_BoosterCreate(trainData, training_params, &new_booster);
     // train
     for (int i = 0; i < stoi(training_params["num_iterations"]); i++) {
         int isFinished;
-        LGBM_BoosterUpdateOneIter(booster, &isFinished);
+        LGBM_BoosterUpdateOneIter(new_booster, &isFinished);
         if (isFinished) {
             break;
         }
     }
 
     int64_t len;
-    std::vector<double> result(training_data->indptr.size() - 1);
-    LGBM_BoosterPredictForCSR(booster,
-                            static_cast<void *>(training_data->indptr.data()),
+    std::vector<double> result(snapshot->indptr.size() - 1);
+    LGBM_BoosterPredictForCSR(new_booster,
+                            static_cast<void *>(snapshot->indptr.data()),
                             C_API_DTYPE_INT32,
-                            training_data->indices.data(),
-                            static_cast<void *>(training_data->data.data()),
+                            snapshot->indices.data(),
+                            static_cast<void *>(snapshot->data.data()),
                             C_API_DTYPE_FLOAT64,
-                            training_data->indptr.size(),
-                            training_data->data.size(),
+                            snapshot->indptr.size(),
+                            snapshot->data.size(),
                             n_feature,  //remove future t
                             C_API_PREDICT_NORMAL,
                             0,
@@ -785,14 +831,95 @@ void LRBCache::train() {
 
     double se = 0;
     for (int i = 0; i < result.size(); ++i) {
-        auto diff = result[i] - training_data->labels[i];
+        auto diff = result[i] - snapshot->labels[i];
         se += diff * diff;
     }
-    training_loss = training_loss * 0.99 + se / batch_size * 0.01;
+    training_loss = training_loss * 0.99 + se / snapshot->labels.size() * 0.01; // NOTE: snapshot may slightly exceed batch_size, as each mature object appends all its sample times
 
     LGBM_DatasetFree(trainData);
     training_time = 0.95 * training_time +
                     0.05 * std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now() - timeBegin).count();
+    return new_booster;
+}
+
+// NOTE: invoked by the request path once training data is full
+void LRBCache::retrain() {
+    if (!is_background_training) {
+        train();
+        training_data->clear();
+        return;
+    }
+
+    // NOTE: NEVER block the request path -> start a new batch if training_thread is still busy with the previous snapshot, which caps training_data at about batch_size (the same as inline training) instead of accumulating it unboundedly
+    std::unique_lock<std::mutex> lock(training_mutex, std::try_to_lock);
+    if (!lock.owns_lock() || is_training_pending) {
+        training_data->clear();
+        return;
+    }
+    assert(background_training_data->labels.empty());
+    std::swap(training_data, background_training_data); // O(1) snapshot
+    is_training_pending = true;
+    lock.unlock();
+    training_cv.notify_one();
+}
+
+// NOTE: main loop of training_thread
+void LRBCache::background_train() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(training_mutex);
+            training_cv.wait(lock, [this] { return is_training_pending || is_training_stop; });
+            if (is_training_stop) {
+                break;
+            }
+        }
+
+        // NOTE: background_training_data is owned by training_thread while is_training_pending is true
+        BoosterHandle new_booster = train_booster(background_training_data);
+        background_training_data->clear();
+
+        // Publish the new booster; a previously published yet uninstalled booster has never been used by inference
+        BoosterHandle stale_booster = trained_booster.exchange(new_booster);
+        if (stale_booster) LGBM_BoosterFree(stale_booster);
+
+        {
+            std::lock_guard<std::mutex> lock(training_mutex);
+            is_training_pending = false;
+        }
+    }
+}
+
+// NOTE: invoked by the request path before inference
+void LRBCache::install_trained_booster() {
+    if (trained_booster.load(std::memory_order_relaxed) == nullptr) {
+        return; // Fast path w/o atomic RMW
+    }
+    BoosterHandle new_booster = trained_booster.exchange(nullptr);
+    if (new_booster) {
+        if (booster) LGBM_BoosterFree(booster); // NOTE: booster is ONLY used by the request path
+        booster = new_booster;
+        ++n_model_swap;
+        model_install_time = std::chrono::steady_clock::now();
+    }
+}
+
+double LRBCache::getTrainingTimeMs() const {
+    return training_time.load();
+}
+
+double LRBCache::getInferenceTimeUs() const {
+    return inference_time;
+}
+
+uint64_t LRBCache::getModelAgeMs() const {
+    if (!booster) {
+        return 0;
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - model_install_time).count();
+}
+
+uint64_t LRBCache::getModelSwapCnt() const {
+    return n_model_swap;
 }
 
 void LRBCache::sample() {
@@ -868,7 +995,8 @@ void LRBCache::update_stat_periodic() {
             << "n_training: " << training_data->labels.size() << std::endl
             //            << "training loss: " << training_loss << std::endl
             << "training_time: " << training_time << " ms" << std::endl
-            << "inference_time: " << inference_time << " us" << std::endl;
+            << "inference_time: " << inference_time << " us" << std::endl
+            << "model_age: " << getModelAgeMs() << " ms" << std::endl;
     assert(in_cache_metas.size() + out_cache_metas.size() == key_map.size());
 }
 
@@ -940,8 +1068,7 @@ bool LRBCache::access(SimpleRequest &req, const bool& is_update) {
             }
             //batch_size ~>= batch_size
             if (training_data->labels.size() >= batch_size) {
-                train();
-                training_data->clear();
+                retrain(); // NOTE: train inline or in background
             }
             meta._sample_times.clear(); // Siyuan: this will clear sample times decrease cache size usage
             meta._sample_times.shrink_to_fit();
@@ -1057,8 +1184,7 @@ void LRBCache::forget() {
             }
             //batch_size ~>= batch_size
             if (training_data->labels.size() >= batch_size) {
-                train();
-                training_data->clear();
+                retrain(); // NOTE: train inline or in background
             }
             uint64_t original_out_cache_meta_size = meta.getSizeForCapacity(); // Siyuan: for correct cache size calculation
             meta._sample_times.clear(); // Siyuan: this will clear sample times to reduce cache size usage of out-cache object-level meta
@@ -1189,6 +1315,8 @@ void LRBCache::admit(const SimpleRequest &req) {
 
 //std::pair<uint64_t, uint32_t> LRBCache::rank() {
 std::pair<std::string, uint32_t> LRBCache::rank() { // Siyuan: for key-value caching
+    install_trained_booster(); // NOTE: switch to the latest booster of background training if any
+
     {
         //if not trained yet, or in_cache_lru past memory window, use LRU
         auto &candidate_key = in_cache_lru_queue.dq.back();
@@ -1433,8 +1561,7 @@ bool LRBCache::evict(const std::string& keystr, std::string& valuestr) {
             }
             //batch_size ~>= batch_size
             if (training_data->labels.size() >= batch_size) {
-                train();
-                training_data->clear();
+                retrain(); // NOTE: train inline or in background
             }
             meta._sample_times.clear(); // Siyuan: victim_in_cache_meta_size already contains cache size usage of sample times
             meta._sample_times.shrink_to_fit();
@@ -1581,6 +1708,10 @@ void LRBCache::update_stat(bsoncxx::v_noabi::builder::basic::document &doc) {
     doc.append(kvp("feature_overhead", feature_overhead));
     doc.append(kvp("sample_overhead", sample_overhead));
     doc.append(kvp("n_force_eviction", n_force_eviction));
+    doc.append(kvp("training_time_ms", getTrainingTimeMs()));
+    doc.append(kvp("inference_time_us", getInferenceTimeUs()));
+    doc.append(kvp("model_age_ms", static_cast<int64_t>(getModelAgeMs())));
+    doc.append(kvp("n_model_swap", static_cast<int64_t>(n_model_swap)));
 
     int res;
     auto importances = std::vector<double>(n_feature, 0);
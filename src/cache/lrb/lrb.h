@@ -6,11 +6,16 @@
 #define WEBCACHESIM_LRB_H
 
 #include <assert.h>
+#include <atomic> // std::atomic
+#include <chrono>
 #include <cmath>
+#include <condition_variable> // std::condition_variable
 #include <fstream>
 #include <list>
+#include <mutex> // std::mutex
 #include <random>
 #include <string>
+#include <thread> // std::thread
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -286,16 +291,31 @@ public:
     LRBEvictionTrainingData *eviction_training_data;
 #endif
 
+    // NOTE: background asynchronous training, which trains on a snapshot of training data in training_thread instead of stalling the request path under the local edge cache lock
+    // NOTE: training_data and background_training_data are double buffers swapped in O(1) by the request path; background_training_data is owned by training_thread while is_training_pending is true
+    bool is_background_training = false;
+    TrainingData *background_training_data = nullptr;
+    std::thread *training_thread = nullptr;
+    std::mutex training_mutex; // Protect is_training_pending and is_training_stop
+    std::condition_variable training_cv;
+    bool is_training_pending = false;
+    bool is_training_stop = false;
+    std::atomic<BoosterHandle> trained_booster{nullptr}; // Published by training_thread, and swapped into booster by the request path (NOT block inference)
+
     // sample_size: use n_memorize keys + random choose (sample_rate - n_memorize) keys
     uint sample_rate = 64;
 
-    double training_loss = 0;
+    std::atomic<double> training_loss{0}; // NOTE: updated by training_thread if background training
     int32_t n_force_eviction = 0;
 
-    double training_time = 0;
+    std::atomic<double> training_time{0}; // NOTE: updated by training_thread if background training
     double inference_time = 0;
 
-    BoosterHandle booster = nullptr;
+    BoosterHandle booster = nullptr; // NOTE: ONLY accessed by the request path
+
+    // NOTE: counters for model freshness
+    uint64_t n_model_swap = 0; // # of trained boosters installed for inference
+    std::chrono::steady_clock::time_point model_install_time; // When the current booster is installed
 
     std::unordered_map<std::string, std::string> training_params = {
             //don't use alias here. C api may not recongize
@@ -327,7 +347,7 @@ public:
     uint32_t training_data_distribution[2];  //1: pos, 0: neg
     std::vector<float> segment_positive_example_ratio;
     std::vector<double> segment_percent_beyond;
-    int n_retrain = 0;
+    std::atomic<int> n_retrain{0}; // NOTE: updated by training_thread if background training
     std::vector<int> segment_n_retrain;
     bool is_sampling = false;
 
@@ -369,6 +389,18 @@ public:
 
     void train();
 
+    // NOTE: for background asynchronous training
+    void retrain(); // Train inline or hand over a snapshot of training data to training_thread once training data is full
+    BoosterHandle train_booster(TrainingData *snapshot); // Train a new booster on the given training data (NOT touch booster)
+    void background_train(); // Main loop of training_thread
+    void install_trained_booster(); // Atomically swap in the latest booster trained by training_thread if any
+
+    // NOTE: counters of training and inference
+    double getTrainingTimeMs() const; // EWMA of training time
+    double getInferenceTimeUs() const; // EWMA of sampled inference time
+    uint64_t getModelAgeMs() const; // Time since the current booster is installed (0 if not trained yet)
+    uint64_t getModelSwapCnt() const;
+
     void sample();
 
     void update_stat_periodic() override;
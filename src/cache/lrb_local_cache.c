@@ -3,6 +3,7 @@
 #include <assert.h>
 #include <sstream>
 
+#include "common/config.h"
 #include "common/util.h"
 
 namespace covered
@@ -21,12 +22,20 @@ namespace covered
 
         // NOTE: refer to lib/lrb/src/simulation.cpp to configure LRB cache after initializing the instance
         lrb_cache_ptr_->setSize(capacity_bytes);
-        lrb_cache_ptr_->init_with_params(std::map<std::string, std::string>()); // Use default parameter settings
+        std::map<std::string, std::string> lrb_params; // Use default parameter settings except training mode
+        lrb_params["background_training"] = Config::isLrbBackgroundTraining() ? "1" : "0";
+        lrb_cache_ptr_->init_with_params(lrb_params);
     }
     
     LrbLocalCache::~LrbLocalCache()
     {
         assert(lrb_cache_ptr_ != NULL);
+
+        // Dump counters of model training and inference
+        std::ostringstream oss;
+        oss << "training mode: " << (Config::isLrbBackgroundTraining() ? "background" : "inline") << "; training time (EWMA): " << lrb_cache_ptr_->getTrainingTimeMs() << " ms; model age: " << lrb_cache_ptr_->getModelAgeMs() << " ms; model swap count: " << lrb_cache_ptr_->getModelSwapCnt() << "; inference latency (EWMA): " << lrb_cache_ptr_->getInferenceTimeUs() << " us";
+        Util::dumpNormalMsg(instance_name_, oss.str());
+
         delete lrb_cache_ptr_;
         lrb_cache_ptr_ = NULL;
     }
@@ -55,7 +64,14 @@ namespace covered
         SimpleRequest req = buildRequest_(key);
         const bool is_update = false;
         bool is_local_cached = lrb_cache_ptr_->access(req, is_update);
-        value = Value(req.valuestr.length());
+        if (Config::isRealValuePayload())
+        {
+            value = Value(req.valuestr.data(), req.valuestr.length());
+        }
+        else
+        {
+            value = Value(req.valuestr.length());
+        }
 
         return is_local_cached;
     }
@@ -172,24 +188,6 @@ namespace covered
 
     // (4) Other functions
 
-    void LrbLocalCache::invokeCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr)
-    {
-        std::ostringstream oss;
-        oss << "invokeCustomFunctionInternal_() does NOT support func_name " << func_name;
-        Util::dumpErrorMsg(instance_name_, oss.str());
-        exit(1);
-        return;
-    }
-
-    void LrbLocalCache::invokeConstCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const
-    {
-        std::ostringstream oss;
-        oss << "invokeConstCustomFunctionInternal_() does NOT support func_name " << func_name;
-        Util::dumpErrorMsg(instance_name_, oss.str());
-        exit(1);
-        return;
-    }
-
     uint64_t LrbLocalCache::getSizeForCapacityInternal_() const
     {
         uint64_t internal_size = lrb_cache_ptr_->getCurrentSize();
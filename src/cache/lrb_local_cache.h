@@ -2,6 +2,8 @@
  * LrbLocalCache: local edge cache with LRB policy (refer to https://github.com/sunnyszy/lrb).
  *
  * NOTE: we use 10 * dataset keycnt (the same as warmup reqcnt) as batch size (see src/cache/lrb/lrb.cpp) to avoid too frequent retraining for warmup speedup -> NOT affect cache stable performance.
+ *
+ * NOTE: LRB trains its model in a background thread on a snapshot of training data by default (is_lrb_background_training in config.json; always inline for single-node simulator to keep determinism), and the request path atomically switches to the new booster before the next inference -> NOT stall all cache server workers under the local edge cache lock during training.
  * 
  * By Siyuan Sheng (2024.01.13).
  */
@@ -47,9 +49,6 @@ namespace covered
 
         // (4) Other functions
 
-        virtual void invokeCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) override; // Invoke some method-specific function for local edge cache
-        virtual void invokeConstCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const override; // Invoke some method-specific function for local edge cache
-
         // In units of bytes
         virtual uint64_t getSizeForCapacityInternal_() const override;
 
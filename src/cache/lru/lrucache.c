@@ -172,4 +172,9 @@ namespace covered
 	{
 		return size_;
 	}
+
+	uint64_t LruCache::getObjsizeForCapacity(const Key& key, const Value& value)
+	{
+		return static_cast<uint64_t>(key.getKeyLength() + value.getValuesize()) + static_cast<uint64_t>(key.getKeyLength() + sizeof(list_iterator_t));
+	}
 }
\ No newline at end of file
@@ -38,6 +38,8 @@ namespace covered {
 		bool exists(const Key& key) const;
 		
 		uint64_t getSizeForCapacity() const;
+
+		static uint64_t getObjsizeForCapacity(const Key& key, const Value& value); // Bytes charged for an admitted object (key-value pair in list + key and list iterator in map)
 		
 	private:
 		static const std::string kClassName;
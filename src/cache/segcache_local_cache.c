@@ -14,6 +14,7 @@ extern "C" { // Such that compiler will use C naming convention for functions in
 #include "cache/segcache/src/time/time.h" // delta_time_i
 }
 
+#include "common/config.h"
 #include "common/util.h"
 
 namespace covered
@@ -153,7 +154,14 @@ namespace covered
             value = Value(tmp_value_size);
             #else
             //std::string value_str(item_val(item_ptr), item_nval(item_ptr));
-            value = Value(item_nval(item_ptr));
+            if (Config::isRealValuePayload())
+            {
+                value = Value(item_val(item_ptr), item_nval(item_ptr));
+            }
+            else
+            {
+                value = Value(item_nval(item_ptr));
+            }
             #endif
             
             item_release(item_ptr, segcache_cache_ptr_); // Decrease read refcnt of segment
@@ -349,24 +357,6 @@ namespace covered
 
     // (4) Other functions
 
-    void SegcacheLocalCache::invokeCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr)
-    {
-        std::ostringstream oss;
-        oss << "invokeCustomFunctionInternal_() does NOT support func_name " << func_name;
-        Util::dumpErrorMsg(instance_name_, oss.str());
-        exit(1);
-        return;
-    }
-
-    void SegcacheLocalCache::invokeConstCustomFunctionInternal_(const std::string& func_name, CacheCustomFuncParamBase* func_param_ptr) const
-    {
-        std::ostringstream oss;
-        oss << "invokeConstCustomFunctionInternal_() does NOT support func_name " << func_name;
-        Util::dumpErrorMsg(instance_name_, oss.str());
-        exit(1);
-        return;
-    }
-
     uint64_t SegcacheLocalCache::getSizeForCapacityInternal_() const
     {
         uint64_t internal_size = get_segcache_size_bytes(segcache_cache_ptr_);
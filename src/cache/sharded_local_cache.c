@@ -0,0 +1,287 @@
+#include "cache/sharded_local_cache.h"
+
+#include <assert.h>
+#include <sstream>
+
+#include "cache/covered_cache_custom_func_param.h"
+#include "common/util.h"
+
+namespace covered
+{
+    const std::string ShardedLocalCache::kClassName("ShardedLocalCache");
+
+    bool ShardedLocalCache::isShardable(const std::string& cache_name)
+    {
+        // NOTE: coarse-grained caches evict w/o given keys, which CANNOT be split into independent shards
+        bool is_shardable = false;
+        if (cache_name == Util::LRU_CACHE_NAME || cache_name == Util::SHARK_EXTENDED_LRU_CACHE_NAME || cache_name == Util::MAGNET_EXTENDED_LRU_CACHE_NAME)
+        {
+            is_shardable = true;
+        }
+        else if (cache_name == Util::SLRU_CACHE_NAME || cache_name == Util::SHARK_EXTENDED_SLRU_CACHE_NAME || cache_name == Util::MAGNET_EXTENDED_SLRU_CACHE_NAME)
+        {
+            is_shardable = true;
+        }
+        else if (cache_name == Util::SIEVE_CACHE_NAME || cache_name == Util::SHARK_EXTENDED_SIEVE_CACHE_NAME || cache_name == Util::MAGNET_EXTENDED_SIEVE_CACHE_NAME)
+        {
+            is_shardable = true;
+        }
+        else if (cache_name == Util::ARC_CACHE_NAME || cache_name == Util::SHARK_EXTENDED_ARC_CACHE_NAME || cache_name == Util::MAGNET_EXTENDED_ARC_CACHE_NAME)
+        {
+            is_shardable = true;
+        }
+        else if (cache_name == Util::LFU_CACHE_NAME || cache_name == Util::SHARK_EXTENDED_LFU_CACHE_NAME || cache_name == Util::MAGNET_EXTENDED_LFU_CACHE_NAME)
+        {
+            is_shardable = true;
+        }
+        else if (cache_name == Util::GDSF_CACHE_NAME || cache_name == Util::SHARK_EXTENDED_GDSF_CACHE_NAME || cache_name == Util::MAGNET_EXTENDED_GDSF_CACHE_NAME)
+        {
+            is_shardable = true;
+        }
+        else if (cache_name == Util::COVERED_CACHE_NAME)
+        {
+            is_shardable = true;
+        }
+        return is_shardable;
+    }
+
+    ShardedLocalCache::ShardedLocalCache(const EdgeWrapperBase* edge_wrapper_ptr, const std::string& cache_name, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const uint32_t& dataset_keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& peredge_synced_victimcnt, const uint32_t& shardcnt) : LocalCacheBase(edge_wrapper_ptr, edge_idx, capacity_bytes, false), shardcnt_(shardcnt), peredge_synced_victimcnt_(peredge_synced_victimcnt)
+    {
+        assert(isShardable(cache_name));
+        assert(shardcnt > 1);
+
+        // Differentiate local edge cache in different edge nodes
+        std::ostringstream oss;
+        oss << kClassName << " edge" << edge_idx;
+        instance_name_ = oss.str();
+
+        // NOTE: the same hash function (w/ the same seed) as CacheServerBase::partitionRequest_()
+        hash_wrapper_ptr_ = HashWrapperBase::getHashWrapperByHashName(Util::MMH3_HASH_NAME);
+        assert(hash_wrapper_ptr_ != NULL);
+
+        // Each shard has an equal share of capacity (and local uncached metadata for COVERED)
+        const uint64_t pershard_capacity_bytes = capacity_bytes / shardcnt;
+        const uint32_t pershard_dataset_keycnt = (dataset_keycnt - 1) / shardcnt + 1;
+        const uint64_t pershard_local_uncached_capacity_bytes = local_uncached_capacity_bytes / shardcnt;
+        const uint64_t pershard_local_uncached_lru_bytes = local_uncached_lru_bytes / shardcnt;
+        shard_ptrs_.resize(shardcnt, NULL);
+        for (uint32_t shard_idx = 0; shard_idx < shardcnt; shard_idx++)
+        {
+            shard_ptrs_[shard_idx] = LocalCacheBase::createLocalCacheByCacheName_(edge_wrapper_ptr, cache_name, edge_idx, pershard_capacity_bytes, pershard_dataset_keycnt, pershard_local_uncached_capacity_bytes, pershard_local_uncached_lru_bytes, peredge_synced_victimcnt);
+            assert(shard_ptrs_[shard_idx] != NULL);
+            assert(shard_ptrs_[shard_idx]->hasFineGrainedManagement());
+        }
+    }
+
+    ShardedLocalCache::~ShardedLocalCache()
+    {
+        for (uint32_t shard_idx = 0; shard_idx < shard_ptrs_.size(); shard_idx++)
+        {
+            assert(shard_ptrs_[shard_idx] != NULL);
+            delete shard_ptrs_[shard_idx];
+            shard_ptrs_[shard_idx] = NULL;
+        }
+
+        assert(hash_wrapper_ptr_ != NULL);
+        delete hash_wrapper_ptr_;
+        hash_wrapper_ptr_ = NULL;
+    }
+
+    const bool ShardedLocalCache::hasFineGrainedManagement() const
+    {
+        return true; // Key-level (i.e., object-level) cache management
+    }
+
+    // (1) Check is cached and access validity
+
+    bool ShardedLocalCache::isLocalCachedInternal_(const Key& key) const
+    {
+        return getShardPtr_(key)->isLocalCached(key);
+    }
+
+    // (2) Access local edge cache (KV data and local metadata)
+
+    bool ShardedLocalCache::getLocalCacheInternal_(const Key& key, const bool& is_redirected, Value& value, bool& affect_victim_tracker) const
+    {
+        return getShardPtr_(key)->getLocalCache(key, is_redirected, value, affect_victim_tracker);
+    }
+
+    bool ShardedLocalCache::getLocalCacheInternal_p2p_(const Key& key, const bool& is_redirected, Value& value, bool& affect_victim_tracker, const uint32_t redirected_reward) const
+    {
+        return getShardPtr_(key)->getLocalCache_p2p(key, is_redirected, value, affect_victim_tracker, redirected_reward);
+    }
+
+    bool ShardedLocalCache::updateLocalCacheInternal_(const Key& key, const Value& value, const bool& is_getrsp, const bool& is_global_cached, bool& affect_victim_tracker, bool& is_successful)
+    {
+        return getShardPtr_(key)->updateLocalCache(key, value, is_getrsp, is_global_cached, affect_victim_tracker, is_successful);
+    }
+
+    // (3) Local edge cache management
+
+    bool ShardedLocalCache::needIndependentAdmitInternal_(const Key& key, const Value& value) const
+    {
+        return getShardPtr_(key)->needIndependentAdmit(key, value);
+    }
+
+    void ShardedLocalCache::admitLocalCacheInternal_(const Key& key, const Value& value, const bool& is_neighbor_cached, bool& affect_victim_tracker, bool& is_successful, const uint64_t& miss_latency_us)
+    {
+        getShardPtr_(key)->admitLocalCache(key, value, is_neighbor_cached, affect_victim_tracker, is_successful, miss_latency_us);
+        return;
+    }
+
+    bool ShardedLocalCache::getLocalCacheVictimKeysInternal_(std::unordered_set<Key, KeyHasher>& keys, std::list<VictimCacheinfo>& victim_cacheinfos, const uint64_t& required_size) const
+    {
+        assert(hasFineGrainedManagement());
+
+        // NOTE: each shard has its own eviction state, so we always evict from the shard exceeding its capacity share the most
+        const uint32_t victim_shard_idx = getMostOccupiedShardIdx_();
+        bool has_victim_key = shard_ptrs_[victim_shard_idx]->getLocalCacheVictimKeys(keys, victim_cacheinfos, required_size);
+
+        return has_victim_key;
+    }
+
+    bool ShardedLocalCache::evictLocalCacheWithGivenKeyInternal_(const Key& key, Value& value)
+    {
+        assert(hasFineGrainedManagement());
+
+        return getShardPtr_(key)->evictLocalCacheWithGivenKey(key, value);
+    }
+
+    void ShardedLocalCache::evictLocalCacheNoGivenKeyInternal_(std::unordered_map<Key, Value, KeyHasher>& victims, const uint64_t& required_size)
+    {
+        assert(!hasFineGrainedManagement());
+
+        Util::dumpErrorMsg(instance_name_, "evictLocalCacheNoGivenKeyInternal_() is not supported due to fine-grained management");
+        exit(1);
+
+        return;
+    }
+
+    // (4) Other functions
+
+    void ShardedLocalCache::updateIsNeighborCachedInternal_(const Key& key, const bool& is_neighbor_cached)
+    {
+        // Key-specific function -> forward to the shard owning the key
+        UpdateIsNeighborCachedFlagFuncParam tmp_shard_param(key, is_neighbor_cached);
+        getShardPtr_(key)->invokeCustomFunction(&tmp_shard_param);
+        return;
+    }
+
+    void ShardedLocalCache::getLocalSyncedVictimCacheinfosFromLocalCacheInternal_(std::list<VictimCacheinfo>& victim_cacheinfos) const
+    {
+        // Get up to peredge_synced_victimcnt local synced victims from each shard
+        for (uint32_t shard_idx = 0; shard_idx < shardcnt_; shard_idx++)
+        {
+            GetLocalSyncedVictimCacheinfosParam tmp_shard_param;
+            shard_ptrs_[shard_idx]->invokeConstCustomFunction(&tmp_shard_param);
+            victim_cacheinfos.splice(victim_cacheinfos.end(), tmp_shard_param.getVictimCacheinfosRef());
+        }
+
+        // Keep peredge_synced_victimcnt victims with the least local rewards across all shards
+        VictimCacheinfo::sortByLocalRewards(victim_cacheinfos);
+        while (victim_cacheinfos.size() > peredge_synced_victimcnt_)
+        {
+            victim_cacheinfos.pop_back();
+        }
+
+        return;
+    }
+
+    void ShardedLocalCache::getCollectedPopularityFromLocalCacheInternal_(const Key& key, CollectedPopularity& collected_popularity) const
+    {
+        // Key-specific function -> forward to the shard owning the key
+        GetCollectedPopularityParam tmp_shard_param(key);
+        getShardPtr_(key)->invokeConstCustomFunction(&tmp_shard_param);
+        collected_popularity = tmp_shard_param.getCollectedPopularityConstRef();
+        return;
+    }
+
+    uint64_t ShardedLocalCache::getSizeForCapacityInternal_() const
+    {
+        uint64_t internal_size = 0;
+        for (uint32_t shard_idx = 0; shard_idx < shardcnt_; shard_idx++)
+        {
+            internal_size = Util::uint64Add(internal_size, shard_ptrs_[shard_idx]->getSizeForCapacity());
+        }
+
+        return internal_size;
+    }
+
+    void ShardedLocalCache::checkPointersInternal_() const
+    {
+        assert(hash_wrapper_ptr_ != NULL);
+        assert(shard_ptrs_.size() == shardcnt_);
+        return;
+    }
+
+    bool ShardedLocalCache::checkObjsizeInternal_(const ObjectSize& objsize) const
+    {
+        // NOTE: an object MUST fit in the capacity share of a single shard (all shards have the same capacity share and policy)
+        const bool is_valid_objsize = shard_ptrs_[0]->isValidObjsize_(objsize);
+        return is_valid_objsize;
+    }
+
+    // Shard utilities
+
+    LocalCacheBase* ShardedLocalCache::getShardPtr_(const Key& key) const
+    {
+        const uint32_t shard_idx = hash_wrapper_ptr_->hash(key) % shardcnt_;
+        assert(shard_idx < shard_ptrs_.size());
+        return shard_ptrs_[shard_idx];
+    }
+
+    uint32_t ShardedLocalCache::getMostOccupiedShardIdx_() const
+    {
+        // NOTE: all shards have the same capacity share, so the most occupied shard exceeds its capacity share the most
+        uint32_t most_occupied_shard_idx = 0;
+        uint64_t most_occupied_size = 0;
+        for (uint32_t shard_idx = 0; shard_idx < shardcnt_; shard_idx++)
+        {
+            const uint64_t tmp_size = shard_ptrs_[shard_idx]->getSizeForCapacity();
+            if (shard_idx == 0 || tmp_size > most_occupied_size)
+            {
+                most_occupied_shard_idx = shard_idx;
+                most_occupied_size = tmp_size;
+            }
+        }
+        return most_occupied_shard_idx;
+    }
+
+    // (5) Dump/load cache metadata for cache snapshot
+
+    void ShardedLocalCache::dumpCacheMetadata(std::fstream* fs_ptr) const
+    {
+        assert(fs_ptr != NULL);
+
+        // NOTE: shards are dumped in order, so loadCacheMetadata() MUST use the same local_cache_shardcnt
+        fs_ptr->write((const char*)&shardcnt_, sizeof(uint32_t));
+        for (uint32_t shard_idx = 0; shard_idx < shardcnt_; shard_idx++)
+        {
+            shard_ptrs_[shard_idx]->dumpCacheMetadata(fs_ptr);
+        }
+
+        return;
+    }
+
+    void ShardedLocalCache::loadCacheMetadata(std::fstream* fs_ptr)
+    {
+        assert(fs_ptr != NULL);
+
+        uint32_t dumped_shardcnt = 0;
+        fs_ptr->read((char*)&dumped_shardcnt, sizeof(uint32_t));
+        if (dumped_shardcnt != shardcnt_)
+        {
+            std::ostringstream oss;
+            oss << "dumped shardcnt " << dumped_shardcnt << " is inconsistent with local_cache_shardcnt " << shardcnt_ << " for loadCacheMetadata()!";
+            Util::dumpErrorMsg(instance_name_, oss.str());
+            exit(1);
+        }
+
+        for (uint32_t shard_idx = 0; shard_idx < shardcnt_; shard_idx++)
+        {
+            shard_ptrs_[shard_idx]->loadCacheMetadata(fs_ptr);
+        }
+
+        return;
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * ShardedLocalCache: split the key space of local edge cache into multiple independently locked sub-caches (i.e., shards) for fine-grained cache management policies.
+ *
+ * NOTE: each shard is a normal local edge cache (w/ its own rwlock_for_local_cache_ptr_, capacity share, and eviction state), so cache server workers accessing different shards will NOT serialize on a single lock.
+ *
+ * NOTE: we use the same hash function as CacheServerBase::partitionRequest_() to locate shards, so each cache server worker only touches a single shard for local requests if local_cache_shardcnt equals percacheserver_workercnt.
+ */
+
+#ifndef SHARDED_LOCAL_CACHE_H
+#define SHARDED_LOCAL_CACHE_H
+
+#include <string>
+#include <vector>
+
+#include "cache/local_cache_base.h"
+#include "hash/hash_wrapper_base.h"
+
+namespace covered
+{
+    class ShardedLocalCache : public LocalCacheBase
+    {
+    public:
+        static bool isShardable(const std::string& cache_name); // ONLY support fine-grained cache management policies
+
+        ShardedLocalCache(const EdgeWrapperBase* edge_wrapper_ptr, const std::string& cache_name, const uint32_t& edge_idx, const uint64_t& capacity_bytes, const uint32_t& dataset_keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& peredge_synced_victimcnt, const uint32_t& shardcnt);
+        virtual ~ShardedLocalCache();
+
+        virtual const bool hasFineGrainedManagement() const;
+
+        // (5) Dump/load cache metadata for cache snapshot
+        virtual void dumpCacheMetadata(std::fstream* fs_ptr) const override;
+        virtual void loadCacheMetadata(std::fstream* fs_ptr) override;
+    private:
+        static const std::string kClassName;
+
+        // (1) Check is cached and access validity
+
+        virtual bool isLocalCachedInternal_(const Key& key) const override;
+
+        // (2) Access local edge cache (KV data and local metadata)
+
+        virtual bool getLocalCacheInternal_(const Key& key, const bool& is_redirected, Value& value, bool& affect_victim_tracker) const override;
+        virtual bool getLocalCacheInternal_p2p_(const Key& key, const bool& is_redirected, Value& value, bool& affect_victim_tracker, const uint32_t redirected_reward) const override;
+
+        virtual bool updateLocalCacheInternal_(const Key& key, const Value& value, const bool& is_getrsp, const bool& is_global_cached, bool& affect_victim_tracker, bool& is_successful) override; // Return if key is local cached for getrsp/put/delreq (is_getrsp indicates getrsp w/ invalid hit or cache miss; is_successful indicates whether value is updated successfully)
+
+        // (3) Local edge cache management
+
+        virtual bool needIndependentAdmitInternal_(const Key& key, const Value& value) const override;
+        virtual void admitLocalCacheInternal_(const Key& key, const Value& value, const bool& is_neighbor_cached, bool& affect_victim_tracker, bool& is_successful, const uint64_t& miss_latency_us = 0) override;
+        virtual bool getLocalCacheVictimKeysInternal_(std::unordered_set<Key, KeyHasher>& keys, std::list<VictimCacheinfo>& victim_cacheinfos, const uint64_t& required_size) const override;
+        virtual bool evictLocalCacheWithGivenKeyInternal_(const Key& key, Value& value) override;
+        virtual void evictLocalCacheNoGivenKeyInternal_(std::unordered_map<Key, Value, KeyHasher>& victims, const uint64_t& required_size) override;
+
+        // (4) Other functions
+
+        // NOTE: BestGuess-specific functions are NOT supported by sharding, which keeps the default hooks of LocalCacheBase
+        virtual void updateIsNeighborCachedInternal_(const Key& key, const bool& is_neighbor_cached) override; // Forward to the shard of the given key
+        virtual void getLocalSyncedVictimCacheinfosFromLocalCacheInternal_(std::list<VictimCacheinfo>& victim_cacheinfos) const override; // Merge local synced victims across all shards
+        virtual void getCollectedPopularityFromLocalCacheInternal_(const Key& key, CollectedPopularity& collected_popularity) const override; // Forward to the shard of the given key
+
+        // In units of bytes
+        virtual uint64_t getSizeForCapacityInternal_() const override;
+
+        virtual void checkPointersInternal_() const override;
+        virtual bool checkObjsizeInternal_(const ObjectSize& objsize) const override;
+
+        // Shard utilities
+
+        LocalCacheBase* getShardPtr_(const Key& key) const;
+        uint32_t getMostOccupiedShardIdx_() const; // Shard exceeding its capacity share the most (for eviction)
+
+        // Member variables
+
+        // Const variables
+        std::string instance_name_;
+        const uint32_t shardcnt_;
+        const uint32_t peredge_synced_victimcnt_; // ONLY used by COVERED to merge local synced victims of all shards
+        HashWrapperBase* hash_wrapper_ptr_; // Locate shard for each key
+
+        // Non-const shared variables (each shard is thread safe by itself)
+        std::vector<LocalCacheBase*> shard_ptrs_;
+    };
+}
+
+#endif
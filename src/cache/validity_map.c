@@ -9,8 +9,6 @@ namespace covered
 {
     // ValidityFlag
 
-    const std::string ValidityFlag::IS_VALID_FLAG_FUNCNAME("isValidFlag");
-
     const std::string ValidityFlag::kClassName("ValidityFlag");
 
     ValidityFlag::ValidityFlag()
@@ -39,36 +37,6 @@ namespace covered
         return sizeof(bool);
     }
 
-    bool ValidityFlag::call(const std::string& function_name, void* param_ptr)
-    {
-        bool is_erase = false;
-
-        Util::dumpErrorMsg(kClassName, "NOT need call() for ConcurrentHashtable::insertOrCall()/callIfExist()!");
-        exit(1);
-
-        return is_erase;
-    }
-
-    void ValidityFlag::constCall(const std::string& function_name, void* param_ptr) const
-    {
-        assert(param_ptr != NULL);
-
-        if (function_name == IS_VALID_FLAG_FUNCNAME)
-        {
-            IsValidFlagParam* tmp_param_ptr = static_cast<IsValidFlagParam*>(param_ptr);
-            tmp_param_ptr->is_valid = isValidFlag();
-        }
-        else
-        {
-            std::ostringstream oss;
-            oss << "invalid function name " << function_name << " for constCall()!";
-            Util::dumpErrorMsg(kClassName, oss.str());
-            exit(1);
-        }
-
-        return;
-    }
-
     const ValidityFlag& ValidityFlag::operator=(const ValidityFlag& other)
     {
         is_valid_ = other.is_valid_;
@@ -98,11 +66,11 @@ namespace covered
 
     bool ValidityMap::isValidFlagForKey(const Key& key, bool& is_exist) const
     {
-        // Prepare IsValidFlagParam
-        ValidityFlag::IsValidFlagParam tmp_param = {false};
-
-        perkey_validity_.constCallIfExist(key, is_exist, ValidityFlag::IS_VALID_FLAG_FUNCNAME, &tmp_param);
-        return tmp_param.is_valid;
+        bool is_valid = false;
+        perkey_validity_.constCallIfExist(key, is_exist, [&is_valid](const ValidityFlag& validity_flag) {
+            is_valid = validity_flag.isValidFlag();
+        });
+        return is_valid;
     }
 
     void ValidityMap::invalidateFlagForKey(const Key& key, bool& is_exist)
@@ -20,13 +20,6 @@ namespace covered
     class ValidityFlag
     {
     public:
-        struct IsValidFlagParam
-        {
-            bool is_valid;
-        };
-
-        static const std::string IS_VALID_FLAG_FUNCNAME;
-
         ValidityFlag();
         ValidityFlag(const bool& is_valid);
         ~ValidityFlag();
@@ -38,8 +31,6 @@ namespace covered
         // (2) For ConcurrentHashtable
 
         uint64_t getSizeForCapacity() const;
-        bool call(const std::string& function_name, void* param_ptr);
-        void constCall(const std::string& function_name, void* param_ptr) const;
 
         const ValidityFlag& operator=(const ValidityFlag& other);
     private:
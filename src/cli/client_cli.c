@@ -10,6 +10,9 @@ namespace covered
     const uint32_t ClientCLI::DEFAULT_PERCLIENT_OPCNT = 1000000;
     const uint32_t ClientCLI::DEFAULT_PERCLIENT_WORKERCNT = 1;
     const uint32_t ClientCLI::DEFAULT_WARMUP_REQCNT_SCALE = 10; // Use 10 * keycnt as warmup reqcnt to warmup all methods sufficiently
+    const std::string ClientCLI::DEFAULT_CLIENT_LOAD_MODE = "closed"; // The same as Util::CLIENT_LOAD_CLOSED_MODE_NAME
+    const uint32_t ClientCLI::DEFAULT_PERCLIENT_TARGET_RATE = 0; // MUST be specified for open-loop modes
+    const uint32_t ClientCLI::DEFAULT_PERCLIENTWORKER_MAX_OUTSTANDING_REQCNT = 64;
 
     const std::string ClientCLI::kClassName("ClientCLI");
 
@@ -19,6 +22,10 @@ namespace covered
         is_warmup_speedup_ = true;
         perclient_opcnt_ = 0;
         perclient_workercnt_ = 0;
+        warmup_reqcnt_scale_ = 0;
+        client_load_mode_ = "";
+        perclient_target_rate_ = 0;
+        perclientworker_max_outstanding_reqcnt_ = 0;
     }
 
     ClientCLI::ClientCLI(int argc, char **argv) : EdgescaleCLI(), PropagationCLI(), WorkloadCLI(), is_add_cli_parameters_(false), is_set_param_and_config_(false), is_dump_cli_parameters_(false), is_create_required_directories_(false), is_to_cli_string_(false)
@@ -53,6 +60,21 @@ namespace covered
         return warmup_reqcnt_scale_;
     }
 
+    std::string ClientCLI::getClientLoadMode() const
+    {
+        return client_load_mode_;
+    }
+
+    uint32_t ClientCLI::getPerclientTargetRate() const
+    {
+        return perclient_target_rate_;
+    }
+
+    uint32_t ClientCLI::getPerclientworkerMaxOutstandingReqcnt() const
+    {
+        return perclientworker_max_outstanding_reqcnt_;
+    }
+
     std::string ClientCLI::toCliString()
     {
         std::ostringstream oss;
@@ -88,6 +110,18 @@ namespace covered
             {
                 oss << " --warmup_reqcnt_scale " << warmup_reqcnt_scale_;
             }
+            if (client_load_mode_ != DEFAULT_CLIENT_LOAD_MODE)
+            {
+                oss << " --client_load_mode " << client_load_mode_;
+            }
+            if (perclient_target_rate_ != DEFAULT_PERCLIENT_TARGET_RATE)
+            {
+                oss << " --perclient_target_rate " << perclient_target_rate_;
+            }
+            if (perclientworker_max_outstanding_reqcnt_ != DEFAULT_PERCLIENTWORKER_MAX_OUTSTANDING_REQCNT)
+            {
+                oss << " --perclientworker_max_outstanding_reqcnt " << perclientworker_max_outstanding_reqcnt_;
+            }
 
             is_to_cli_string_ = true;
         }
@@ -116,6 +150,7 @@ namespace covered
             // (1) Create CLI parameter description
 
             std::string perclient_opcnt_descstr = "the number of operations used to represent workload distribution (NOT affect workload sequence size; NOT affect " + Util::getReplayedWorkloadHintstr() + ")";
+            std::string client_load_mode_descstr = "client load mode of stresstest phase: " + Util::CLIENT_LOAD_CLOSED_MODE_NAME + " (closed-loop), " + Util::CLIENT_LOAD_POISSON_MODE_NAME + " or " + Util::CLIENT_LOAD_CONSTANT_MODE_NAME + " (open-loop arrivals with latency measured from scheduled send time; warmup phase is always closed-loop)";
 
             // Dynamic configurations for client
             argument_desc_.add_options()
@@ -124,6 +159,9 @@ namespace covered
                 ("perclient_opcnt", boost::program_options::value<uint32_t>()->default_value(DEFAULT_PERCLIENT_OPCNT), perclient_opcnt_descstr.c_str())
                 ("perclient_workercnt", boost::program_options::value<uint32_t>()->default_value(DEFAULT_PERCLIENT_WORKERCNT), "the number of worker threads for each client")
                 ("warmup_reqcnt_scale", boost::program_options::value<uint32_t>()->default_value(DEFAULT_WARMUP_REQCNT_SCALE), "scale of warmup request count (-> warmup_reqcnt_scale * keycnt)")
+                ("client_load_mode", boost::program_options::value<std::string>()->default_value(DEFAULT_CLIENT_LOAD_MODE), client_load_mode_descstr.c_str())
+                ("perclient_target_rate", boost::program_options::value<uint32_t>()->default_value(DEFAULT_PERCLIENT_TARGET_RATE), "the offered load (requests per second) of each client for open-loop client load modes")
+                ("perclientworker_max_outstanding_reqcnt", boost::program_options::value<uint32_t>()->default_value(DEFAULT_PERCLIENTWORKER_MAX_OUTSTANDING_REQCNT), "the max number of outstanding requests of each client worker for open-loop client load modes")
             ;
 
             is_add_cli_parameters_ = true;
@@ -151,6 +189,9 @@ namespace covered
             uint32_t perclient_opcnt = argument_info_["perclient_opcnt"].as<uint32_t>();
             uint32_t perclient_workercnt = argument_info_["perclient_workercnt"].as<uint32_t>();
             uint32_t warmup_reqcnt_scale = argument_info_["warmup_reqcnt_scale"].as<uint32_t>();
+            std::string client_load_mode = argument_info_["client_load_mode"].as<std::string>();
+            uint32_t perclient_target_rate = argument_info_["perclient_target_rate"].as<uint32_t>();
+            uint32_t perclientworker_max_outstanding_reqcnt = argument_info_["perclientworker_max_outstanding_reqcnt"].as<uint32_t>();
 
             // Store client CLI parameters for dynamic configurations
             // clientcnt_ = clientcnt;
@@ -168,6 +209,9 @@ namespace covered
             perclient_opcnt_ = perclient_opcnt;
             perclient_workercnt_ = perclient_workercnt;
             warmup_reqcnt_scale_ = warmup_reqcnt_scale;
+            client_load_mode_ = client_load_mode;
+            perclient_target_rate_ = perclient_target_rate;
+            perclientworker_max_outstanding_reqcnt_ = perclientworker_max_outstanding_reqcnt;
 
             is_set_param_and_config_ = true;
         }
@@ -193,7 +237,13 @@ namespace covered
             oss << "Warmup speedup flag: " << (is_warmup_speedup_?"true":"false") << std::endl;
             oss << "Per-client operation count (just an impl trick for distribution precision, yet not affect workload sequence size): " << perclient_opcnt_ << std::endl;
             oss << "Per-client worker count: " << perclient_workercnt_ << std::endl;
-            oss << "Warmup request count scale: " << warmup_reqcnt_scale_;
+            oss << "Warmup request count scale: " << warmup_reqcnt_scale_ << std::endl;
+            oss << "Client load mode: " << client_load_mode_;
+            if (Util::isOpenloopClientLoadMode(client_load_mode_))
+            {
+                oss << std::endl << "Per-client target rate (requests per second): " << perclient_target_rate_ << std::endl;
+                oss << "Per-client-worker max outstanding request count: " << perclientworker_max_outstanding_reqcnt_;
+            }
             Util::dumpDebugMsg(kClassName, oss.str());
 
             is_dump_cli_parameters_ = true;
@@ -251,6 +301,31 @@ namespace covered
 
         assert(perclient_workercnt_ > 0);
 
+        if (client_load_mode_ != Util::CLIENT_LOAD_CLOSED_MODE_NAME && !Util::isOpenloopClientLoadMode(client_load_mode_))
+        {
+            std::ostringstream oss;
+            oss << "client load mode " << client_load_mode_ << " is not supported!";
+            Util::dumpErrorMsg(kClassName, oss.str());
+            exit(1);
+        }
+        if (Util::isOpenloopClientLoadMode(client_load_mode_))
+        {
+            if (perclient_target_rate_ < perclient_workercnt_)
+            {
+                std::ostringstream oss;
+                oss << "per-client target rate " << perclient_target_rate_ << " should >= perclient_workercnt " << perclient_workercnt_ << " for open-loop client load mode " << client_load_mode_ << "!";
+                Util::dumpErrorMsg(kClassName, oss.str());
+                exit(1);
+            }
+            if (perclientworker_max_outstanding_reqcnt_ == 0 || perclientworker_max_outstanding_reqcnt_ * perclient_workercnt_ > Config::getPropagationItemBufferSizeClientToedge())
+            {
+                std::ostringstream oss;
+                oss << "perclientworker_max_outstanding_reqcnt " << perclientworker_max_outstanding_reqcnt_ << " should > 0 and fit in client-to-edge propagation item buffer size " << Config::getPropagationItemBufferSizeClientToedge() << " for " << perclient_workercnt_ << " client workers!";
+                Util::dumpErrorMsg(kClassName, oss.str());
+                exit(1);
+            }
+        }
+
         // uint32_t edgecnt = getEdgecnt();
         // if (clientcnt_ < edgecnt)
         // {
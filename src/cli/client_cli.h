@@ -29,6 +29,9 @@ namespace covered
         uint32_t getPerclientOpcnt() const;
         uint32_t getPerclientWorkercnt() const;
         uint32_t getWarmupReqcntScale() const;
+        std::string getClientLoadMode() const;
+        uint32_t getPerclientTargetRate() const;
+        uint32_t getPerclientworkerMaxOutstandingReqcnt() const;
 
         std::string toCliString(); // NOT virtual for cilutil
         virtual void clearIsToCliString(); // Idempotent operation: clear is_to_cli_string_ for the next toCliString()
@@ -38,6 +41,9 @@ namespace covered
         static const uint32_t DEFAULT_PERCLIENT_OPCNT;
         static const uint32_t DEFAULT_PERCLIENT_WORKERCNT;
         static const uint32_t DEFAULT_WARMUP_REQCNT_SCALE;
+        static const std::string DEFAULT_CLIENT_LOAD_MODE;
+        static const uint32_t DEFAULT_PERCLIENT_TARGET_RATE;
+        static const uint32_t DEFAULT_PERCLIENTWORKER_MAX_OUTSTANDING_REQCNT;
 
         static const std::string kClassName;
 
@@ -55,6 +61,9 @@ namespace covered
         uint32_t perclient_opcnt_;
         uint32_t perclient_workercnt_;
         uint32_t warmup_reqcnt_scale_; // Client needs it for per-client-worker warmup reqcnt limitation; evaluator needs it for switching warmup/stresstest phase
+        std::string client_load_mode_; // Closed-loop, or open-loop (Poisson/constant arrivals) for stresstest phase
+        uint32_t perclient_target_rate_; // Offered load (requests per second) of each client for open-loop modes (evenly split across client workers)
+        uint32_t perclientworker_max_outstanding_reqcnt_; // Max # of in-flight requests of each client worker for open-loop modes
     protected:
         virtual void addCliParameters_() override;
         virtual void setParamAndConfig_(const std::string& main_class_name) override;
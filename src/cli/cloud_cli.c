@@ -6,12 +6,14 @@
 namespace covered
 {
     const std::string CloudCLI::DEFAULT_CLOUD_STORAGE = "hdd"; // NOTE: NOT use UTil::HDD_NAME due to undefined initialization order of C++ static variables
+    const uint32_t CloudCLI::DEFAULT_DATA_SERVER_WORKERCNT = 1;
 
     const std::string CloudCLI::kClassName("CloudCLI");
 
     CloudCLI::CloudCLI() : PropagationCLI(), WorkloadCLI(), is_add_cli_parameters_(false), is_set_param_and_config_(false), is_dump_cli_parameters_(false), is_create_required_directories_(false), is_to_cli_string_(false)
     {
         cloud_storage_ = "";
+        data_server_workercnt_ = 0;
     }
 
     CloudCLI::CloudCLI(int argc, char **argv) : PropagationCLI(), WorkloadCLI(), is_add_cli_parameters_(false), is_set_param_and_config_(false), is_dump_cli_parameters_(false), is_create_required_directories_(false), is_to_cli_string_(false)
@@ -26,6 +28,11 @@ namespace covered
         return cloud_storage_;
     }
 
+    uint32_t CloudCLI::getDataServerWorkercnt() const
+    {
+        return data_server_workercnt_;
+    }
+
     std::string CloudCLI::toCliString()
     {
         std::ostringstream oss;
@@ -43,6 +50,10 @@ namespace covered
             {
                 oss << " --cloud_storage " << cloud_storage_;
             }
+            if (data_server_workercnt_ != DEFAULT_DATA_SERVER_WORKERCNT)
+            {
+                oss << " --data_server_workercnt " << data_server_workercnt_;
+            }
 
             is_to_cli_string_ = true;
         }
@@ -73,6 +84,7 @@ namespace covered
             // Dynamic configurations for client
             argument_desc_.add_options()
                 ("cloud_storage", boost::program_options::value<std::string>()->default_value(DEFAULT_CLOUD_STORAGE), cloud_storage_descstr.c_str())
+                ("data_server_workercnt", boost::program_options::value<uint32_t>()->default_value(DEFAULT_DATA_SERVER_WORKERCNT), "the number of worker threads for cloud data server, each owning a hash partition of keys and batching RocksDB accesses (1 means receiving and processing global requests one by one in a single thread)")
             ;
 
             is_add_cli_parameters_ = true;
@@ -91,9 +103,11 @@ namespace covered
             // (3) Get CLI parameters for client dynamic configurations
 
             std::string cloud_storage = argument_info_["cloud_storage"].as<std::string>();
+            uint32_t data_server_workercnt = argument_info_["data_server_workercnt"].as<uint32_t>();
 
             // Store cloud CLI parameters for dynamic configurations and mark CloudParam as valid
             cloud_storage_ = cloud_storage;
+            data_server_workercnt_ = data_server_workercnt;
 
             is_set_param_and_config_ = true;
         }
@@ -109,12 +123,14 @@ namespace covered
             WorkloadCLI::verifyAndDumpCliParameters_(main_class_name);
 
             checkCloudStorage_();
+            checkDataServerWorkercnt_();
 
             // (6) Dump stored CLI parameters and parsed config information if debug
 
             std::ostringstream oss;
             oss << "[Dynamic configurations from CLI parameters in " << kClassName << "]" << std::endl;
-            oss << "Cloud storage: " << cloud_storage_;
+            oss << "Cloud storage: " << cloud_storage_ << std::endl;
+            oss << "Data server worker count: " << data_server_workercnt_;
             Util::dumpDebugMsg(kClassName, oss.str());
 
             is_dump_cli_parameters_ = true;
@@ -143,4 +159,16 @@ namespace covered
         }
         return;
     }
+
+    void CloudCLI::checkDataServerWorkercnt_() const
+    {
+        if (data_server_workercnt_ == 0)
+        {
+            std::ostringstream oss;
+            oss << "data server worker count " << data_server_workercnt_ << " should be positive!";
+            Util::dumpErrorMsg(kClassName, oss.str());
+            exit(1);
+        }
+        return;
+    }
 }
\ No newline at end of file
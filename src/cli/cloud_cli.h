@@ -24,15 +24,18 @@ namespace covered
         virtual ~CloudCLI();
 
         std::string getCloudStorage() const;
+        uint32_t getDataServerWorkercnt() const;
 
         std::string toCliString(); // NOT virtual for cilutil
         virtual void clearIsToCliString(); // Idempotent operation: clear is_to_cli_string_ for the next toCliString()
     private:
         static const std::string DEFAULT_CLOUD_STORAGE;
+        static const uint32_t DEFAULT_DATA_SERVER_WORKERCNT;
 
         static const std::string kClassName;
 
         void checkCloudStorage_() const;
+        void checkDataServerWorkercnt_() const;
 
         bool is_add_cli_parameters_;
         bool is_set_param_and_config_;
@@ -42,6 +45,7 @@ namespace covered
         bool is_to_cli_string_;
 
         std::string cloud_storage_;
+        uint32_t data_server_workercnt_; // # of cloud data server workers, each owning a hash partition of keys and accessing RocksDB in batches (1: single-threaded data server)
     protected:
         virtual void addCliParameters_() override;
         virtual void setParamAndConfig_(const std::string& main_class_name) override;
@@ -8,6 +8,9 @@ namespace covered
     const std::string EdgeCLI::DEFAULT_CACHE_NAME = "lru"; // NOTE: NOT use UTil::LRU_CACHE_NAME due to undefined initialization order of C++ static variables
     const std::string EdgeCLI::DEFAULT_HASH_NAME = "mmh3"; // NOTE: NOT use UTil::MMH3_HASH_NAME due to undefined initialization order of C++ static variables
     const uint32_t EdgeCLI::DEFAULT_PERCACHESERVER_WORKERCNT = 1;
+    const uint32_t EdgeCLI::DEFAULT_LOCAL_CACHE_SHARDCNT = 1;
+    const uint32_t EdgeCLI::DEFAULT_CACHE_SERVER_WORKER_INFLIGHTCNT = 1;
+    const uint32_t EdgeCLI::DEFAULT_PERBEACONSERVER_WORKERCNT = 1;
     const uint64_t EdgeCLI::DEFAULT_COVERED_LOCAL_UNCACHED_MAX_MEM_USAGE_MB = 1;
     const uint64_t EdgeCLI::DEFAULT_COVERED_LOCAL_UNCACHED_LRU_MAX_MB = 1;
     const uint32_t EdgeCLI::DEFAULT_COVERED_PEREDGE_SYNCED_VICTIMCNT = 3;
@@ -15,6 +18,9 @@ namespace covered
     const uint64_t EdgeCLI::DEFAULT_COVERED_POPULARITY_AGGREGATION_MAX_MEM_USAGE_MB = 1;
     const double EdgeCLI::DEFAULT_COVERED_POPULARITY_COLLECTION_CHANGE_RATIO = double(0.1);
     const uint32_t EdgeCLI::DEFAULT_COVERED_TOPK_EDGECNT = 1;
+    const std::string EdgeCLI::DEFAULT_CACHELIB_NVM_FILEPATH = "/tmp/covered_cachelib_nvm";
+    const uint64_t EdgeCLI::DEFAULT_CACHELIB_NVM_CAPACITY_MB = 1024;
+    const double EdgeCLI::DEFAULT_CACHELIB_NVM_ADMIT_PROBABILITY = double(1.0);
 
     const std::string EdgeCLI::kClassName("EdgeCLI");
 
@@ -23,6 +29,9 @@ namespace covered
         cache_name_ = "";
         hash_name_ = "";
         percacheserver_workercnt_ = 0;
+        local_cache_shardcnt_ = 0;
+        cache_server_worker_inflightcnt_ = 0;
+        perbeaconserver_workercnt_ = 0;
 
         // ONLY used by COVERED
         covered_local_uncached_max_mem_usage_bytes_ = 0;
@@ -32,6 +41,9 @@ namespace covered
         covered_popularity_aggregation_max_mem_usage_bytes_ = 0;
         covered_popularity_collection_change_ratio_ = double(0.0);
         covered_topk_edgecnt_ = 0;
+
+        // ONLY used by CacheLib w/ DRAM+NVM tiers
+        cachelib_nvm_info_ = CachelibNvmInfo();
     }
 
     EdgeCLI::EdgeCLI(int argc, char **argv) : WorkloadCLI(), EdgescaleCLI(), PropagationCLI(), is_add_cli_parameters_(false), is_set_param_and_config_(false), is_dump_cli_parameters_(false), is_create_required_directories_(false), is_to_cli_string_(false)
@@ -56,6 +68,21 @@ namespace covered
         return percacheserver_workercnt_;
     }
 
+    uint32_t EdgeCLI::getLocalCacheShardcnt() const
+    {
+        return local_cache_shardcnt_;
+    }
+
+    uint32_t EdgeCLI::getCacheServerWorkerInflightcnt() const
+    {
+        return cache_server_worker_inflightcnt_;
+    }
+
+    uint32_t EdgeCLI::getPerbeaconserverWorkercnt() const
+    {
+        return perbeaconserver_workercnt_;
+    }
+
     // ONLY used by COVERED
 
     uint64_t EdgeCLI::getCoveredLocalUncachedMaxMemUsageBytes() const
@@ -93,6 +120,13 @@ namespace covered
         return covered_topk_edgecnt_;
     }
 
+    // ONLY used by CacheLib w/ DRAM+NVM tiers
+
+    CachelibNvmInfo EdgeCLI::getCachelibNvmInfo() const
+    {
+        return cachelib_nvm_info_;
+    }
+
     std::string EdgeCLI::toCliString()
     {
         std::ostringstream oss;
@@ -119,6 +153,18 @@ namespace covered
             {
                 oss << " --percacheserver_workercnt " << percacheserver_workercnt_;
             }
+            if (local_cache_shardcnt_ != DEFAULT_LOCAL_CACHE_SHARDCNT)
+            {
+                oss << " --local_cache_shardcnt " << local_cache_shardcnt_;
+            }
+            if (cache_server_worker_inflightcnt_ != DEFAULT_CACHE_SERVER_WORKER_INFLIGHTCNT)
+            {
+                oss << " --cache_server_worker_inflightcnt " << cache_server_worker_inflightcnt_;
+            }
+            if (perbeaconserver_workercnt_ != DEFAULT_PERBEACONSERVER_WORKERCNT)
+            {
+                oss << " --perbeaconserver_workercnt " << perbeaconserver_workercnt_;
+            }
             // ONLY used by COVERED
             if (cache_name_ == Util::COVERED_CACHE_NAME)
             {
@@ -151,6 +197,22 @@ namespace covered
                     oss << " --covered_topk_edgecnt " << covered_topk_edgecnt_;
                 }
             }
+            // ONLY used by CacheLib w/ DRAM+NVM tiers
+            if (cache_name_ == Util::CACHELIB_HYBRID_CACHE_NAME)
+            {
+                if (cachelib_nvm_info_.getNvmFilepath() != DEFAULT_CACHELIB_NVM_FILEPATH)
+                {
+                    oss << " --cachelib_nvm_filepath " << cachelib_nvm_info_.getNvmFilepath();
+                }
+                if (cachelib_nvm_info_.getNvmCapacityBytes() != MB2B(DEFAULT_CACHELIB_NVM_CAPACITY_MB))
+                {
+                    oss << " --cachelib_nvm_capacity_mb " << B2MB(cachelib_nvm_info_.getNvmCapacityBytes());
+                }
+                if (cachelib_nvm_info_.getNvmAdmitProbability() != DEFAULT_CACHELIB_NVM_ADMIT_PROBABILITY)
+                {
+                    oss << " --cachelib_nvm_admit_probability " << cachelib_nvm_info_.getNvmAdmitProbability();
+                }
+            }
 
             is_to_cli_string_ = true;
         }
@@ -186,6 +248,9 @@ namespace covered
                 ("cache_name", boost::program_options::value<std::string>()->default_value(DEFAULT_CACHE_NAME), cache_name_descstr.c_str())
                 ("hash_name", boost::program_options::value<std::string>()->default_value(DEFAULT_HASH_NAME), hash_name_descstr.c_str())
                 ("percacheserver_workercnt", boost::program_options::value<uint32_t>()->default_value(DEFAULT_PERCACHESERVER_WORKERCNT), "the number of worker threads for each cache server")
+                ("local_cache_shardcnt", boost::program_options::value<uint32_t>()->default_value(DEFAULT_LOCAL_CACHE_SHARDCNT), "the number of independently locked shards of local edge cache (only used by fine-grained cache management policies; 1 means no sharding)")
+                ("cache_server_worker_inflightcnt", boost::program_options::value<uint32_t>()->default_value(DEFAULT_CACHE_SERVER_WORKER_INFLIGHTCNT), "the maximum number of in-flight local requests multiplexed by each cache server worker, whose responses are matched by msg seqnum (1 means blocking one-request-at-a-time)")
+                ("perbeaconserver_workercnt", boost::program_options::value<uint32_t>()->default_value(DEFAULT_PERBEACONSERVER_WORKERCNT), "the number of worker threads for each beacon server, each owning a hash partition of beaconed keys (1 means receiving and processing control requests in a single thread)")
                 ("covered_local_uncached_max_mem_usage_mb", boost::program_options::value<uint64_t>()->default_value(DEFAULT_COVERED_LOCAL_UNCACHED_MAX_MEM_USAGE_MB), "the maximum memory usage for local uncached metadata in units of MiB (only used by COVERED)")
                 ("covered_local_uncached_lru_max_mb", boost::program_options::value<uint64_t>()->default_value(DEFAULT_COVERED_LOCAL_UNCACHED_LRU_MAX_MB), "the maximum memory usage for local uncached LRU in units of MiB (only used for COVERED if enabled)")
                 ("covered_peredge_synced_victimcnt", boost::program_options::value<uint32_t>()->default_value(DEFAULT_COVERED_PEREDGE_SYNCED_VICTIMCNT), "per-edge number of victims synced to each neighbor (only used by COVERED)")
@@ -193,6 +258,9 @@ namespace covered
                 ("covered_popularity_aggregation_max_mem_usage_mb", boost::program_options::value<uint64_t>()->default_value(DEFAULT_COVERED_POPULARITY_AGGREGATION_MAX_MEM_USAGE_MB), "the maximum memory usage for popularity aggregation in units of MiB (only used by COVERED)")
                 ("covered_popularity_collection_change_ratio", boost::program_options::value<double>()->default_value(DEFAULT_COVERED_POPULARITY_COLLECTION_CHANGE_RATIO), "the ratio for local uncached popularity changes to trigger popularity collection (only used by COVERED)")
                 ("covered_topk_edgecnt", boost::program_options::value<uint32_t>()->default_value(DEFAULT_COVERED_TOPK_EDGECNT), "the number of top-k edge nodes for popularity aggregation and trade-off-aware cache placement (only used by COVERED)")
+                ("cachelib_nvm_filepath", boost::program_options::value<std::string>()->default_value(DEFAULT_CACHELIB_NVM_FILEPATH), "the path prefix of the file-backed NVM device, suffixed by edge index (only used by cachelib_hybrid)")
+                ("cachelib_nvm_capacity_mb", boost::program_options::value<uint64_t>()->default_value(DEFAULT_CACHELIB_NVM_CAPACITY_MB), "the NVM capacity in units of MiB, which is part of the total capacity and the rest is DRAM (only used by cachelib_hybrid)")
+                ("cachelib_nvm_admit_probability", boost::program_options::value<double>()->default_value(DEFAULT_CACHELIB_NVM_ADMIT_PROBABILITY), "the probability to write a DRAM victim into NVM, otherwise evicted directly (only used by cachelib_hybrid)")
             ;
 
             is_add_cli_parameters_ = true;
@@ -214,6 +282,9 @@ namespace covered
             std::string cache_name = argument_info_["cache_name"].as<std::string>();
             std::string hash_name = argument_info_["hash_name"].as<std::string>();
             uint32_t percacheserver_workercnt = argument_info_["percacheserver_workercnt"].as<uint32_t>();
+            uint32_t local_cache_shardcnt = argument_info_["local_cache_shardcnt"].as<uint32_t>();
+            uint32_t cache_server_worker_inflightcnt = argument_info_["cache_server_worker_inflightcnt"].as<uint32_t>();
+            uint32_t perbeaconserver_workercnt = argument_info_["perbeaconserver_workercnt"].as<uint32_t>();
             // ONLY used by COVERED
             uint64_t covered_local_uncached_max_mem_usage_bytes = MB2B(argument_info_["covered_local_uncached_max_mem_usage_mb"].as<uint64_t>()); // In units of bytes
             uint64_t covered_local_uncached_lru_max_bytes = MB2B(argument_info_["covered_local_uncached_lru_max_mb"].as<uint64_t>()); // In units of bytes
@@ -222,11 +293,18 @@ namespace covered
             uint64_t covered_popularity_aggregation_max_mem_usage_bytes = MB2B(argument_info_["covered_popularity_aggregation_max_mem_usage_mb"].as<uint64_t>()); // In units of bytes
             double covered_popularity_collection_change_ratio = argument_info_["covered_popularity_collection_change_ratio"].as<double>();
             uint32_t covered_topk_edgecnt = argument_info_["covered_topk_edgecnt"].as<uint32_t>();
+            // ONLY used by CacheLib w/ DRAM+NVM tiers
+            std::string cachelib_nvm_filepath = argument_info_["cachelib_nvm_filepath"].as<std::string>();
+            uint64_t cachelib_nvm_capacity_bytes = MB2B(argument_info_["cachelib_nvm_capacity_mb"].as<uint64_t>()); // In units of bytes
+            double cachelib_nvm_admit_probability = argument_info_["cachelib_nvm_admit_probability"].as<double>();
 
             // Store edgecnt CLI parameters for dynamic configurations
             cache_name_ = cache_name;
             hash_name_ = hash_name;
             percacheserver_workercnt_ = percacheserver_workercnt;
+            local_cache_shardcnt_ = local_cache_shardcnt;
+            cache_server_worker_inflightcnt_ = cache_server_worker_inflightcnt;
+            perbeaconserver_workercnt_ = perbeaconserver_workercnt;
             // ONLY used by COVERED
             if (cache_name == Util::COVERED_CACHE_NAME)
             {
@@ -260,6 +338,11 @@ namespace covered
                 covered_popularity_collection_change_ratio_ = covered_popularity_collection_change_ratio;
                 covered_topk_edgecnt_ = covered_topk_edgecnt;
             }
+            // ONLY used by CacheLib w/ DRAM+NVM tiers
+            if (cache_name == Util::CACHELIB_HYBRID_CACHE_NAME)
+            {
+                cachelib_nvm_info_ = CachelibNvmInfo(cachelib_nvm_filepath, cachelib_nvm_capacity_bytes, cachelib_nvm_admit_probability);
+            }
 
             is_set_param_and_config_ = true;
         }
@@ -285,7 +368,10 @@ namespace covered
             oss << "[Dynamic configurations from CLI parameters in " << kClassName << "]" << std::endl;
             oss << "Cache name: " << cache_name_ << std::endl;
             oss << "Hash name: " << hash_name_ << std::endl;
-            oss << "Per-cache-server worker count:" << percacheserver_workercnt_;
+            oss << "Per-cache-server worker count:" << percacheserver_workercnt_ << std::endl;
+            oss << "Local cache shard count:" << local_cache_shardcnt_ << std::endl;
+            oss << "Cache server worker in-flight count:" << cache_server_worker_inflightcnt_ << std::endl;
+            oss << "Per-beacon-server worker count:" << perbeaconserver_workercnt_;
             if (cache_name_ == Util::COVERED_CACHE_NAME)
             {
                 // ONLY used by COVERED
@@ -297,6 +383,13 @@ namespace covered
                 oss << "Covered popularity collection change ratio: " << covered_popularity_collection_change_ratio_ << std::endl;
                 oss << "Covered top-k edge count: " << covered_topk_edgecnt_;
             }
+            if (cache_name_ == Util::CACHELIB_HYBRID_CACHE_NAME)
+            {
+                // ONLY used by CacheLib w/ DRAM+NVM tiers
+                oss << std::endl << "Cachelib NVM filepath: " << cachelib_nvm_info_.getNvmFilepath() << std::endl;
+                oss << "Cachelib NVM capacity (bytes): " << cachelib_nvm_info_.getNvmCapacityBytes() << std::endl;
+                oss << "Cachelib NVM admit probability: " << cachelib_nvm_info_.getNvmAdmitProbability();
+            }
             Util::dumpDebugMsg(kClassName, oss.str());
 
             is_dump_cli_parameters_ = true;
@@ -380,6 +473,9 @@ namespace covered
     void EdgeCLI::verifyIntegrity_() const
     {
         assert(percacheserver_workercnt_ > 0);
+        assert(local_cache_shardcnt_ > 0);
+        assert(cache_server_worker_inflightcnt_ > 0);
+        assert(perbeaconserver_workercnt_ > 0);
         // ONLY used by COVERED
         if (cache_name_ == Util::COVERED_CACHE_NAME)
         {
@@ -392,6 +488,20 @@ namespace covered
             assert(covered_popularity_collection_change_ratio_ >= 0.0);
             assert(covered_topk_edgecnt_ > 0 && covered_topk_edgecnt_ <= getEdgecnt());
         }
+        // ONLY used by CacheLib w/ DRAM+NVM tiers
+        if (cache_name_ == Util::CACHELIB_HYBRID_CACHE_NAME)
+        {
+            const uint64_t capacity_bytes = EdgescaleCLI::getCapacityBytes();
+            if (cachelib_nvm_info_.getNvmCapacityBytes() == 0 || cachelib_nvm_info_.getNvmCapacityBytes() >= capacity_bytes)
+            {
+                std::ostringstream oss;
+                oss << "NVM capacity " << cachelib_nvm_info_.getNvmCapacityBytes() << " bytes should be in (0, capacity " << capacity_bytes << " bytes) for " << cache_name_;
+                Util::dumpErrorMsg(kClassName, oss.str());
+                exit(1);
+            }
+            assert(cachelib_nvm_info_.getNvmFilepath() != "");
+            assert(cachelib_nvm_info_.getNvmAdmitProbability() > 0.0 && cachelib_nvm_info_.getNvmAdmitProbability() <= 1.0);
+        }
         
         return;
     }
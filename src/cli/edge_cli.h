@@ -14,6 +14,7 @@
 #include "cli/edgescale_cli.h"
 #include "cli/propagation_cli.h"
 #include "cli/workload_cli.h"
+#include "common/cachelib_nvm_info.h"
 
 namespace covered
 {
@@ -27,6 +28,9 @@ namespace covered
         std::string getCacheName() const;
         std::string getHashName() const;
         uint32_t getPercacheserverWorkercnt() const;
+        uint32_t getLocalCacheShardcnt() const;
+        uint32_t getCacheServerWorkerInflightcnt() const;
+        uint32_t getPerbeaconserverWorkercnt() const;
 
         // ONLY used by COVERED
         uint64_t getCoveredLocalUncachedMaxMemUsageBytes() const;
@@ -37,12 +41,18 @@ namespace covered
         double getCoveredPopularityCollectionChangeRatio() const;
         uint32_t getCoveredTopkEdgecnt() const;
 
+        // ONLY used by CacheLib w/ DRAM+NVM tiers
+        CachelibNvmInfo getCachelibNvmInfo() const;
+
         std::string toCliString(); // NOT virtual for cilutil
         virtual void clearIsToCliString(); // Idempotent operation: clear is_to_cli_string_ for the next toCliString()
     private:
         static const std::string DEFAULT_CACHE_NAME;
         static const std::string DEFAULT_HASH_NAME;
         static const uint32_t DEFAULT_PERCACHESERVER_WORKERCNT;
+        static const uint32_t DEFAULT_LOCAL_CACHE_SHARDCNT;
+        static const uint32_t DEFAULT_CACHE_SERVER_WORKER_INFLIGHTCNT;
+        static const uint32_t DEFAULT_PERBEACONSERVER_WORKERCNT;
         static const uint64_t DEFAULT_COVERED_LOCAL_UNCACHED_MAX_MEM_USAGE_MB; // For local uncached metadata
         static const uint64_t DEFAULT_COVERED_LOCAL_UNCACHED_LRU_MAX_MB; // For local uncached LRU (if enabled)
         static const uint32_t DEFAULT_COVERED_PEREDGE_SYNCED_VICTIMCNT;
@@ -50,6 +60,9 @@ namespace covered
         static const uint64_t DEFAULT_COVERED_POPULARITY_AGGREGATION_MAX_MEM_USAGE_MB;
         static const double DEFAULT_COVERED_POPULARITY_COLLECTION_CHANGE_RATIO;
         static const uint32_t DEFAULT_COVERED_TOPK_EDGECNT;
+        static const std::string DEFAULT_CACHELIB_NVM_FILEPATH;
+        static const uint64_t DEFAULT_CACHELIB_NVM_CAPACITY_MB;
+        static const double DEFAULT_CACHELIB_NVM_ADMIT_PROBABILITY;
 
         static const std::string kClassName;
 
@@ -67,6 +80,9 @@ namespace covered
         std::string cache_name_;
         std::string hash_name_;
         uint32_t percacheserver_workercnt_;
+        uint32_t local_cache_shardcnt_; // # of independently locked shards of local edge cache (ONLY for fine-grained cache management policies)
+        uint32_t cache_server_worker_inflightcnt_; // Max # of in-flight local requests multiplexed by each cache server worker (1: blocking one-request-at-a-time)
+        uint32_t perbeaconserver_workercnt_; // # of beacon server workers, each owning a hash partition of beaconed keys (1: single-threaded beacon server)
 
         // ONLY used by COVERED
         uint64_t covered_local_uncached_max_mem_usage_bytes_; // For local uncached metadata
@@ -77,6 +93,9 @@ namespace covered
         double covered_popularity_collection_change_ratio_;
         uint32_t covered_topk_edgecnt_;
 
+        // ONLY used by CacheLib w/ DRAM+NVM tiers
+        CachelibNvmInfo cachelib_nvm_info_; // NVM tier of local edge cache (included in capacity_bytes)
+
     protected:
         virtual void addCliParameters_() override;
         virtual void setParamAndConfig_(const std::string& main_class_name) override;
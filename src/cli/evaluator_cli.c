@@ -8,6 +8,8 @@ namespace covered
 {
     const uint32_t EvaluatorCLI::DEFAULT_WARMUP_MAX_DURATION_SEC = 30;
     const uint32_t EvaluatorCLI::DEFAULT_STRESSTEST_DURATION_SEC = 30;
+    const uint32_t EvaluatorCLI::DEFAULT_OPENLOOP_SWEEP_RATE_STEP = 0; // Disable throughput-latency sweep by default
+    const uint32_t EvaluatorCLI::DEFAULT_OPENLOOP_SWEEP_PERIOD_SEC = 10;
 
     const std::string EvaluatorCLI::kClassName("EvaluatorCLI");
 
@@ -32,6 +34,16 @@ namespace covered
         return stresstest_duration_sec_;
     }
 
+    uint32_t EvaluatorCLI::getOpenloopSweepRateStep() const
+    {
+        return openloop_sweep_rate_step_;
+    }
+
+    uint32_t EvaluatorCLI::getOpenloopSweepPeriodSec() const
+    {
+        return openloop_sweep_period_sec_;
+    }
+
     std::string EvaluatorCLI::toCliString()
     {
         std::ostringstream oss;
@@ -55,6 +67,14 @@ namespace covered
             {
                 oss << " --stresstest_duration_sec " << stresstest_duration_sec_;
             }
+            if (openloop_sweep_rate_step_ != DEFAULT_OPENLOOP_SWEEP_RATE_STEP)
+            {
+                oss << " --openloop_sweep_rate_step " << openloop_sweep_rate_step_;
+            }
+            if (openloop_sweep_period_sec_ != DEFAULT_OPENLOOP_SWEEP_PERIOD_SEC)
+            {
+                oss << " --openloop_sweep_period_sec " << openloop_sweep_period_sec_;
+            }
 
             is_to_cli_string_ = true;
         }
@@ -86,6 +106,8 @@ namespace covered
                 ("warmup_max_duration_sec", boost::program_options::value<uint32_t>()->default_value(DEFAULT_WARMUP_MAX_DURATION_SEC), "maximum duration of warmup phase (seconds)")
                 #endif
                 ("stresstest_duration_sec", boost::program_options::value<uint32_t>()->default_value(DEFAULT_STRESSTEST_DURATION_SEC), "duration of stresstest phase (seconds)")
+                ("openloop_sweep_rate_step", boost::program_options::value<uint32_t>()->default_value(DEFAULT_OPENLOOP_SWEEP_RATE_STEP), "increase per-client target rate by the step (requests per second) for each sweep period in stresstest phase to find the saturation point (0: disable; ONLY for open-loop client load modes)")
+                ("openloop_sweep_period_sec", boost::program_options::value<uint32_t>()->default_value(DEFAULT_OPENLOOP_SWEEP_PERIOD_SEC), "duration of each target rate during throughput-latency sweep (seconds)")
             ;
 
             is_add_cli_parameters_ = true;
@@ -107,6 +129,8 @@ namespace covered
             uint32_t warmup_max_duration_sec = argument_info_["warmup_max_duration_sec"].as<uint32_t>();
             #endif
             uint32_t stresstest_duration_sec = argument_info_["stresstest_duration_sec"].as<uint32_t>();
+            uint32_t openloop_sweep_rate_step = argument_info_["openloop_sweep_rate_step"].as<uint32_t>();
+            uint32_t openloop_sweep_period_sec = argument_info_["openloop_sweep_period_sec"].as<uint32_t>();
 
             // Store client CLI parameters for dynamic configurations
             #ifdef ENABLE_WARMUP_MAX_DURATION
@@ -116,6 +140,8 @@ namespace covered
             warmup_max_duration_sec_ = 0;
             #endif
             stresstest_duration_sec_ = stresstest_duration_sec;
+            openloop_sweep_rate_step_ = openloop_sweep_rate_step;
+            openloop_sweep_period_sec_ = openloop_sweep_period_sec;
 
             is_set_param_and_config_ = true;
         }
@@ -140,6 +166,11 @@ namespace covered
             oss << "Warmup maximum duration seconds: " << warmup_max_duration_sec_ << std::endl;
             #endif
             oss << "Stresstest duration seconds: " << stresstest_duration_sec_;
+            if (openloop_sweep_rate_step_ > 0)
+            {
+                oss << std::endl << "Open-loop sweep rate step (requests per second): " << openloop_sweep_rate_step_ << std::endl;
+                oss << "Open-loop sweep period seconds: " << openloop_sweep_period_sec_;
+            }
             Util::dumpDebugMsg(kClassName, oss.str());
 
             is_dump_cli_parameters_ = true;
@@ -196,7 +227,24 @@ namespace covered
 
     void EvaluatorCLI::verifyIntegrity_() const
     {
-        // Do nothing
+        if (openloop_sweep_rate_step_ > 0)
+        {
+            if (!Util::isOpenloopClientLoadMode(getClientLoadMode()))
+            {
+                std::ostringstream oss;
+                oss << "throughput-latency sweep (openloop_sweep_rate_step " << openloop_sweep_rate_step_ << ") requires open-loop client load mode instead of " << getClientLoadMode() << "!";
+                Util::dumpErrorMsg(kClassName, oss.str());
+                exit(1);
+            }
+            if (openloop_sweep_period_sec_ == 0 || openloop_sweep_period_sec_ < Config::getClientRawStatisticsSlotIntervalSec() || openloop_sweep_period_sec_ > stresstest_duration_sec_)
+            {
+                std::ostringstream oss;
+                oss << "openloop_sweep_period_sec " << openloop_sweep_period_sec_ << " should be in [client_raw_statistics_slot_interval_sec " << Config::getClientRawStatisticsSlotIntervalSec() << ", stresstest_duration_sec " << stresstest_duration_sec_ << "]!";
+                Util::dumpErrorMsg(kClassName, oss.str());
+                exit(1);
+            }
+        }
+
         return;
     }
 }
\ No newline at end of file
@@ -25,12 +25,16 @@ namespace covered
 
         uint32_t getWarmupMaxDurationSec() const;
         uint32_t getStresstestDurationSec() const;
+        uint32_t getOpenloopSweepRateStep() const;
+        uint32_t getOpenloopSweepPeriodSec() const;
 
         std::string toCliString(); // NOT virtual for cilutil
         virtual void clearIsToCliString(); // Idempotent operation: clear is_to_cli_string_ for the next toCliString()
     private:
         static const uint32_t DEFAULT_WARMUP_MAX_DURATION_SEC;
         static const uint32_t DEFAULT_STRESSTEST_DURATION_SEC;
+        static const uint32_t DEFAULT_OPENLOOP_SWEEP_RATE_STEP;
+        static const uint32_t DEFAULT_OPENLOOP_SWEEP_PERIOD_SEC;
 
         static const std::string kClassName;
 
@@ -45,6 +49,8 @@ namespace covered
 
         uint32_t warmup_max_duration_sec_;
         uint32_t stresstest_duration_sec_;
+        uint32_t openloop_sweep_rate_step_; // Increase per-client target rate by the step for each sweep period in stresstest phase (0: disable throughput-latency sweep)
+        uint32_t openloop_sweep_period_sec_;
     protected:
         virtual void addCliParameters_() override;
         virtual void setParamAndConfig_(const std::string& main_class_name) override;
@@ -7,6 +7,12 @@ namespace covered
 {
     const uint32_t SingleNodeCLI::DEFAULT_SIMULATOR_WORKLOADCNT = 1; // NOTE: workloadcnt just used to fix memory issue of large-scale simulation (yet each client worker still has an individual workload worker), yet NOT affect simulator results (already verified)!
     const uint32_t SingleNodeCLI::DEFAULT_SIMULATOR_RANDOMNESS = 0;
+    const uint32_t SingleNodeCLI::DEFAULT_SIMULATOR_LOOKUP_THREADCNT = 1;
+    const uint32_t SingleNodeCLI::DEFAULT_SIMULATOR_EPOCH_ROUNDCNT = 0; // NOTE: sequential simulation by default
+    const uint64_t SingleNodeCLI::DEFAULT_SIMULATOR_STRESSTEST_REQCNT = 0; // NOTE: wall-clock-driven stresstest by default
+    const uint64_t SingleNodeCLI::DEFAULT_SIMULATOR_INTERVAL_REQCNT = 1000000;
+    const uint32_t SingleNodeCLI::DEFAULT_SIMULATOR_MRC_POINTCNT = 0; // NOTE: disable MRC profiling by default
+    const double SingleNodeCLI::DEFAULT_SIMULATOR_MRC_SAMPLE_RATIO = 0.01;
 
     const std::string SingleNodeCLI::kClassName("SingleNodeCLI");
 
@@ -14,6 +20,12 @@ namespace covered
     {
         simulator_workloadcnt_ = 0;
         simulator_randomness_ = 0;
+        simulator_lookup_threadcnt_ = 0;
+        simulator_epoch_roundcnt_ = 0;
+        simulator_stresstest_reqcnt_ = 0;
+        simulator_interval_reqcnt_ = 0;
+        simulator_mrc_pointcnt_ = 0;
+        simulator_mrc_sample_ratio_ = 0.0;
     }
 
     SingleNodeCLI::SingleNodeCLI(int argc, char **argv) : CloudCLI(), EvaluatorCLI(), is_add_cli_parameters_(false), is_set_param_and_config_(false), is_dump_cli_parameters_(false), is_create_required_directories_(false), is_to_cli_string_(false)
@@ -33,6 +45,36 @@ namespace covered
         return simulator_randomness_;
     }
 
+    uint32_t SingleNodeCLI::getSimulatorLookupThreadcnt() const
+    {
+        return simulator_lookup_threadcnt_;
+    }
+
+    uint32_t SingleNodeCLI::getSimulatorEpochRoundcnt() const
+    {
+        return simulator_epoch_roundcnt_;
+    }
+
+    uint64_t SingleNodeCLI::getSimulatorStresstestReqcnt() const
+    {
+        return simulator_stresstest_reqcnt_;
+    }
+
+    uint64_t SingleNodeCLI::getSimulatorIntervalReqcnt() const
+    {
+        return simulator_interval_reqcnt_;
+    }
+
+    uint32_t SingleNodeCLI::getSimulatorMrcPointcnt() const
+    {
+        return simulator_mrc_pointcnt_;
+    }
+
+    double SingleNodeCLI::getSimulatorMrcSampleRatio() const
+    {
+        return simulator_mrc_sample_ratio_;
+    }
+
     std::string SingleNodeCLI::toCliString()
     {
         std::ostringstream oss;
@@ -54,6 +96,30 @@ namespace covered
             {
                 oss << " --simulator_randomness " << simulator_randomness_;
             }
+            if (simulator_lookup_threadcnt_ != DEFAULT_SIMULATOR_LOOKUP_THREADCNT)
+            {
+                oss << " --simulator_lookup_threadcnt " << simulator_lookup_threadcnt_;
+            }
+            if (simulator_epoch_roundcnt_ != DEFAULT_SIMULATOR_EPOCH_ROUNDCNT)
+            {
+                oss << " --simulator_epoch_roundcnt " << simulator_epoch_roundcnt_;
+            }
+            if (simulator_stresstest_reqcnt_ != DEFAULT_SIMULATOR_STRESSTEST_REQCNT)
+            {
+                oss << " --simulator_stresstest_reqcnt " << simulator_stresstest_reqcnt_;
+            }
+            if (simulator_interval_reqcnt_ != DEFAULT_SIMULATOR_INTERVAL_REQCNT)
+            {
+                oss << " --simulator_interval_reqcnt " << simulator_interval_reqcnt_;
+            }
+            if (simulator_mrc_pointcnt_ != DEFAULT_SIMULATOR_MRC_POINTCNT)
+            {
+                oss << " --simulator_mrc_pointcnt " << simulator_mrc_pointcnt_;
+            }
+            if (simulator_mrc_sample_ratio_ != DEFAULT_SIMULATOR_MRC_SAMPLE_RATIO)
+            {
+                oss << " --simulator_mrc_sample_ratio " << simulator_mrc_sample_ratio_;
+            }
 
             is_to_cli_string_ = true;
         }
@@ -80,7 +146,13 @@ namespace covered
             // Dynamic configurations for single-node prototype/simulator
             argument_desc_.add_options()
                 ("simulator_workloadcnt", boost::program_options::value<uint32_t>(&simulator_workloadcnt_)->default_value(DEFAULT_SIMULATOR_WORKLOADCNT), "Number of workload generators (ONLY for single-node simulator)")
-                ("simulator_randomness", boost::program_options::value<uint32_t>(&simulator_randomness_)->default_value(DEFAULT_SIMULATOR_RANDOMNESS), "Randomness (ONLY for single-node simulator)");
+                ("simulator_randomness", boost::program_options::value<uint32_t>(&simulator_randomness_)->default_value(DEFAULT_SIMULATOR_RANDOMNESS), "Randomness (ONLY for single-node simulator)")
+                ("simulator_lookup_threadcnt", boost::program_options::value<uint32_t>(&simulator_lookup_threadcnt_)->default_value(DEFAULT_SIMULATOR_LOOKUP_THREADCNT), "Number of threads ONLY for local cache lookups of GET requests on different edge nodes in epoch-batched simulation (writes, cross-edge interactions, and cache management are serial; ONLY for single-node simulator)")
+                ("simulator_epoch_roundcnt", boost::program_options::value<uint32_t>(&simulator_epoch_roundcnt_)->default_value(DEFAULT_SIMULATOR_EPOCH_ROUNDCNT), "Number of client-worker rounds per epoch for epoch-batched simulation (0: sequential simulation; ONLY for single-node simulator)")
+                ("simulator_stresstest_reqcnt", boost::program_options::value<uint64_t>(&simulator_stresstest_reqcnt_)->default_value(DEFAULT_SIMULATOR_STRESSTEST_REQCNT), "Number of stresstest requests for wall-clock-independent simulation (0: stop by stresstest_duration_sec; ONLY for single-node simulator)")
+                ("simulator_interval_reqcnt", boost::program_options::value<uint64_t>(&simulator_interval_reqcnt_)->default_value(DEFAULT_SIMULATOR_INTERVAL_REQCNT), "Number of requests per interval dump for wall-clock-independent simulation (ONLY for single-node simulator)")
+                ("simulator_mrc_pointcnt", boost::program_options::value<uint32_t>(&simulator_mrc_pointcnt_)->default_value(DEFAULT_SIMULATOR_MRC_POINTCNT), "Number of cache capacities evenly spaced in (0, capacity_mb] for one-pass MRC profiling of a single non-cooperative and non-hybrid cache (0: disable; ONLY for single-node simulator)")
+                ("simulator_mrc_sample_ratio", boost::program_options::value<double>(&simulator_mrc_sample_ratio_)->default_value(DEFAULT_SIMULATOR_MRC_SAMPLE_RATIO), "Spatial sample ratio in (0, 1] for one-pass MRC profiling (ONLY for single-node simulator)");
 
             is_add_cli_parameters_ = true;
         }
@@ -98,10 +170,22 @@ namespace covered
             // ONLY for single-node simulator
             uint32_t simulator_workloadcnt = argument_info_["simulator_workloadcnt"].as<uint32_t>();
             uint32_t simulator_randomness = argument_info_["simulator_randomness"].as<uint32_t>();
+            uint32_t simulator_lookup_threadcnt = argument_info_["simulator_lookup_threadcnt"].as<uint32_t>();
+            uint32_t simulator_epoch_roundcnt = argument_info_["simulator_epoch_roundcnt"].as<uint32_t>();
+            uint64_t simulator_stresstest_reqcnt = argument_info_["simulator_stresstest_reqcnt"].as<uint64_t>();
+            uint64_t simulator_interval_reqcnt = argument_info_["simulator_interval_reqcnt"].as<uint64_t>();
+            uint32_t simulator_mrc_pointcnt = argument_info_["simulator_mrc_pointcnt"].as<uint32_t>();
+            double simulator_mrc_sample_ratio = argument_info_["simulator_mrc_sample_ratio"].as<double>();
 
             // Store edgecnt CLI parameters for dynamic configurations
             simulator_workloadcnt_ = simulator_workloadcnt;
             simulator_randomness_ = simulator_randomness;
+            simulator_lookup_threadcnt_ = simulator_lookup_threadcnt;
+            simulator_epoch_roundcnt_ = simulator_epoch_roundcnt;
+            simulator_stresstest_reqcnt_ = simulator_stresstest_reqcnt;
+            simulator_interval_reqcnt_ = simulator_interval_reqcnt;
+            simulator_mrc_pointcnt_ = simulator_mrc_pointcnt;
+            simulator_mrc_sample_ratio_ = simulator_mrc_sample_ratio;
 
             is_set_param_and_config_ = true;
         }
@@ -141,6 +225,9 @@ namespace covered
     {
         // ONLY for single-node simulator
         assert(simulator_workloadcnt_ > 0);
+        assert(simulator_lookup_threadcnt_ > 0);
+        assert(simulator_interval_reqcnt_ > 0);
+        assert(simulator_mrc_sample_ratio_ > 0.0 && simulator_mrc_sample_ratio_ <= 1.0);
         
         return;
     }
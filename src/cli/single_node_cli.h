@@ -28,6 +28,12 @@ namespace covered
         // ONLY for single-node simulator
         uint32_t getSimulatorWorkloadcnt() const;
         uint32_t getSimulatorRandomness() const;
+        uint32_t getSimulatorLookupThreadcnt() const;
+        uint32_t getSimulatorEpochRoundcnt() const;
+        uint64_t getSimulatorStresstestReqcnt() const;
+        uint64_t getSimulatorIntervalReqcnt() const;
+        uint32_t getSimulatorMrcPointcnt() const;
+        double getSimulatorMrcSampleRatio() const;
         std::string getP2PLatencyMatrixPath() const;
 
         std::string toCliString(); // NOT virtual for cilutil
@@ -35,6 +41,12 @@ namespace covered
     private:
         static const uint32_t DEFAULT_SIMULATOR_WORKLOADCNT;
         static const uint32_t DEFAULT_SIMULATOR_RANDOMNESS;
+        static const uint32_t DEFAULT_SIMULATOR_LOOKUP_THREADCNT;
+        static const uint32_t DEFAULT_SIMULATOR_EPOCH_ROUNDCNT;
+        static const uint64_t DEFAULT_SIMULATOR_STRESSTEST_REQCNT;
+        static const uint64_t DEFAULT_SIMULATOR_INTERVAL_REQCNT;
+        static const uint32_t DEFAULT_SIMULATOR_MRC_POINTCNT;
+        static const double DEFAULT_SIMULATOR_MRC_SAMPLE_RATIO;
 
         static const std::string kClassName;
 
@@ -50,6 +62,12 @@ namespace covered
         // ONLY for single-node simulator
         uint32_t simulator_workloadcnt_; // NOTE: workloadcnt may affect absolute performance, yet does NOT affect simulator results!
         uint32_t simulator_randomness_; // NOTE: randomness introduces variances, yet does NOT affector simulator results!
+        uint32_t simulator_lookup_threadcnt_; // NOTE: lookup threadcnt only affects absolute performance of the lookup phase in epoch-batched simulation, yet does NOT affect simulator results!
+        uint32_t simulator_epoch_roundcnt_; // 0: sequential simulation; > 0: epoch-batched simulation with # of client-worker rounds per epoch
+        uint64_t simulator_stresstest_reqcnt_; // 0: stop stresstest by stresstest_duration_sec of wall-clock time; > 0: stop stresstest after the given # of requests (wall-clock-independent)
+        uint64_t simulator_interval_reqcnt_; // # of requests per interval dump (ONLY used if simulator_stresstest_reqcnt_ > 0)
+        uint32_t simulator_mrc_pointcnt_; // 0: normal simulation; > 0: one-pass MRC profiling of a single cache w/ # of capacities evenly spaced in (0, capacity_bytes]
+        double simulator_mrc_sample_ratio_; // Spatial sample ratio of MRC profiling
     protected:
         virtual void addCliParameters_() override;
         virtual void setParamAndConfig_(const std::string& main_class_name) override;
@@ -59,14 +59,14 @@ namespace covered
         uint32_t cloud_idx = cloud_wrapper_param.getCloudIdx();
         CloudCLI* cloud_cli_ptr = cloud_wrapper_param.getCloudCLIPtr();
 
-        CloudWrapper local_cloud(cloud_idx, cloud_cli_ptr->getCloudStorage(), cloud_cli_ptr->getKeycnt(), cloud_cli_ptr->getCLILatencyInfo(), cloud_cli_ptr->getWorkloadName(), cloud_cli_ptr->getZipfAlpha(), cloud_cli_ptr->getWorkloadPatternName(), cloud_cli_ptr->getDynamicChangePeriod(), cloud_cli_ptr->getDynamicChangeKeycnt(), cloud_cli_ptr->getRealnetOption());
+        CloudWrapper local_cloud(cloud_idx, cloud_cli_ptr->getCloudStorage(), cloud_cli_ptr->getDataServerWorkercnt(), cloud_cli_ptr->getKeycnt(), cloud_cli_ptr->getCLILatencyInfo(), cloud_cli_ptr->getWorkloadName(), cloud_cli_ptr->getZipfAlpha(), cloud_cli_ptr->getWorkloadPatternName(), cloud_cli_ptr->getDynamicChangePeriod(), cloud_cli_ptr->getDynamicChangeKeycnt(), cloud_cli_ptr->getRealnetOption());
         local_cloud.start();
         
         pthread_exit(NULL);
         return NULL;
     }
 
-    CloudWrapper::CloudWrapper(const uint32_t& cloud_idx, const std::string& cloud_storage, const uint32_t& keycnt, const CLILatencyInfo& cli_latency_info, const std::string& workload_name, const float& zipf_alpha, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period, const uint32_t& dynamic_change_keycnt, const std::string& realnet_option) : NodeWrapperBase(NodeWrapperBase::CLOUD_NODE_ROLE, cloud_idx, 1, true)
+    CloudWrapper::CloudWrapper(const uint32_t& cloud_idx, const std::string& cloud_storage, const uint32_t& data_server_workercnt, const uint32_t& keycnt, const CLILatencyInfo& cli_latency_info, const std::string& workload_name, const float& zipf_alpha, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period, const uint32_t& dynamic_change_keycnt, const std::string& realnet_option) : NodeWrapperBase(NodeWrapperBase::CLOUD_NODE_ROLE, cloud_idx, 1, true), data_server_workercnt_(data_server_workercnt)
     {
         assert(cloud_idx == 0); // TODO: only support 1 cloud node now!
 
@@ -137,6 +137,11 @@ namespace covered
         cloud_data_server_param_ptr_ = NULL;
     }
 
+    uint32_t CloudWrapper::getDataServerWorkercnt() const
+    {
+        return data_server_workercnt_;
+    }
+
     WorkloadWrapperBase* CloudWrapper::getWorkloadGeneratorPtr() const
     {
         assert(workload_generator_ptr_ != NULL);
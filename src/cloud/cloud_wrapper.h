@@ -44,9 +44,10 @@ namespace covered
     public:
         static void* launchCloud(void* cloud_wrapper_param_ptr);
 
-        CloudWrapper(const uint32_t& cloud_idx, const std::string& cloud_storage, const uint32_t& keycnt, const CLILatencyInfo& cli_latency_info, const std::string& workload_name, const float& zipf_alpha, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period, const uint32_t& dynamic_change_keycnt, const std::string& realnet_option);
+        CloudWrapper(const uint32_t& cloud_idx, const std::string& cloud_storage, const uint32_t& data_server_workercnt, const uint32_t& keycnt, const CLILatencyInfo& cli_latency_info, const std::string& workload_name, const float& zipf_alpha, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period, const uint32_t& dynamic_change_keycnt, const std::string& realnet_option);
         ~CloudWrapper();
 
+        uint32_t getDataServerWorkercnt() const;
         WorkloadWrapperBase* getWorkloadGeneratorPtr() const;
         RocksdbWrapper* getCloudRocksdbPtr() const;
         PropagationSimulatorParam* getCloudToedgePropagationSimulatorParamPtr() const;
@@ -61,6 +62,7 @@ namespace covered
         void checkPointers_() const;
 
         std::string instance_name_;
+        const uint32_t data_server_workercnt_;
         WorkloadWrapperBase* workload_generator_ptr_; // for warmup speedup to skip disk I/O latency in cloud (thread safe)
         RocksdbWrapper* cloud_rocksdb_ptr_;
 
@@ -1,7 +1,11 @@
 #include "cloud/data_server/data_server.h"
 
-#include "common/bandwidth_usage.h"
+#include <pthread.h>
+#include <unistd.h> // usleep
+
+#include "cloud/data_server/data_server_worker.h"
 #include "common/config.h"
+#include "common/thread_launcher.h"
 #include "common/util.h"
 #include "core/popularity/edgeset.h"
 #include "message/data_message.h"
@@ -47,6 +51,25 @@ namespace covered
         NetworkAddr recvreq_host_addr(Util::ANY_IPSTR, cloud_recvreq_port);
         cloud_recvreq_socket_server_ptr_ = new UdpMsgSocketServer(recvreq_host_addr);
         assert(cloud_recvreq_socket_server_ptr_ != NULL);
+
+        // For data server workers
+        hash_wrapper_ptr_ = NULL;
+        const uint32_t data_server_workercnt = tmp_cloud_wrapper_ptr->getDataServerWorkercnt();
+        assert(data_server_workercnt > 0);
+        if (data_server_workercnt > 1)
+        {
+            hash_wrapper_ptr_ = HashWrapperBase::getHashWrapperByHashName(Util::MMH3_HASH_NAME);
+            assert(hash_wrapper_ptr_ != NULL);
+
+            // Prepare parameters for data server worker threads
+            // NOTE: reuse the buffer size of edge-to-cloud propagated messages, as each data server worker ONLY serves global requests issued by edge nodes
+            for (uint32_t local_data_server_worker_idx = 0; local_data_server_worker_idx < data_server_workercnt; local_data_server_worker_idx++)
+            {
+                DataServerWorkerParam* tmp_data_server_worker_param_ptr = new DataServerWorkerParam(cloud_component_param_ptr, local_data_server_worker_idx, Config::getPropagationItemBufferSizeEdgeTocloud());
+                assert(tmp_data_server_worker_param_ptr != NULL);
+                data_server_worker_param_ptrs_.push_back(tmp_data_server_worker_param_ptr);
+            }
+        }
     }
 
     DataServer::~DataServer()
@@ -57,12 +80,46 @@ namespace covered
         assert(cloud_recvreq_socket_server_ptr_ != NULL);
         delete cloud_recvreq_socket_server_ptr_;
         cloud_recvreq_socket_server_ptr_ = NULL;
+
+        // Release data server worker params if any (NOTE: data server workers have been joined in start())
+        for (uint32_t local_data_server_worker_idx = 0; local_data_server_worker_idx < data_server_worker_param_ptrs_.size(); local_data_server_worker_idx++)
+        {
+            assert(data_server_worker_param_ptrs_[local_data_server_worker_idx] != NULL);
+            delete data_server_worker_param_ptrs_[local_data_server_worker_idx];
+            data_server_worker_param_ptrs_[local_data_server_worker_idx] = NULL;
+        }
+        data_server_worker_param_ptrs_.clear();
+
+        if (hash_wrapper_ptr_ != NULL)
+        {
+            delete hash_wrapper_ptr_;
+            hash_wrapper_ptr_ = NULL;
+        }
     }
 
     void DataServer::start()
     {
         checkPointers_();
         CloudWrapper* tmp_cloud_wrapper_ptr = cloud_component_param_ptr_->getCloudWrapperPtr();
+        const uint32_t cloud_idx = tmp_cloud_wrapper_ptr->getNodeIdx();
+        const uint32_t data_server_workercnt = data_server_worker_param_ptrs_.size(); // 0 for single-threaded data server
+
+        // Launch data server workers if any
+        std::vector<pthread_t> data_server_worker_threads(data_server_workercnt);
+        for (uint32_t local_data_server_worker_idx = 0; local_data_server_worker_idx < data_server_workercnt; local_data_server_worker_idx++)
+        {
+            std::string tmp_thread_name = "cloud-data-server-worker-" + std::to_string(cloud_idx) + "-" + std::to_string(local_data_server_worker_idx);
+            ThreadLauncher::pthreadCreateHighPriority(ThreadLauncher::CLOUD_THREAD_ROLE, tmp_thread_name, &data_server_worker_threads[local_data_server_worker_idx], DataServerWorker::launchDataServerWorker, (void*)(data_server_worker_param_ptrs_[local_data_server_worker_idx]));
+        }
+
+        // Wait data server workers to finish initialization
+        for (uint32_t local_data_server_worker_idx = 0; local_data_server_worker_idx < data_server_workercnt; local_data_server_worker_idx++)
+        {
+            while (!data_server_worker_param_ptrs_[local_data_server_worker_idx]->isFinishInitialization())
+            {
+                usleep(SubthreadParamBase::INITIALIZATION_WAIT_INTERVAL_US);
+            }
+        }
 
         // Notify cloud wrapper that cloud data server has finished initialization
         cloud_component_param_ptr_->markFinishInitialization();
@@ -79,9 +136,18 @@ namespace covered
             } // End of (is_timeout == true)
             else
             {
+                struct timespec recvreq_timestamp = Util::getCurrentTimespec();
                 MessageBase* request_ptr = MessageBase::getRequestFromMsgPayload(global_request_msg_payload);
                 assert(request_ptr != NULL);
 
+                if (data_server_workercnt > 0 && request_ptr->isGlobalDataRequest())
+                {
+                    // Pass received request to the data server worker owning its key by ring buffer
+                    // NOTE: received request will be released by the corresponding data server worker
+                    partitionRequest_(request_ptr, recvreq_timestamp);
+                    continue;
+                }
+
                 if (request_ptr->isGlobalDataRequest()) // Global requests
                 {
                     NetworkAddr edge_cache_server_worker_recvrsp_dst_addr = request_ptr->getSourceAddr();
@@ -106,10 +172,100 @@ namespace covered
                 }
             } // End of (is_timeout == false)
         } // End of while loop
+
+        // Wait for data server workers if any (NOTE: each data server worker polls its ring buffer and exits after cloud is finished)
+        for (uint32_t local_data_server_worker_idx = 0; local_data_server_worker_idx < data_server_workercnt; local_data_server_worker_idx++)
+        {
+            int pthread_returncode = pthread_join(data_server_worker_threads[local_data_server_worker_idx], NULL); // void* retval = NULL
+            if (pthread_returncode != 0)
+            {
+                std::ostringstream oss;
+                oss << "cloud " << cloud_idx << " failed to join data server worker " << local_data_server_worker_idx << " (error code: " << pthread_returncode << ")" << std::endl;
+                Util::dumpErrorMsg(instance_name_, oss.str());
+                exit(1);
+            }
+        }
         
         return;
     }
 
+    MessageBase* DataServer::getGlobalResponse(MessageBase* global_request_ptr, const Value& value, const uint32_t& cloud_idx, const NetworkAddr& cloud_recvreq_source_addr, const BandwidthUsage& total_bandwidth_usage, const EventList& event_list)
+    {
+        assert(global_request_ptr != NULL);
+
+        const Key tmp_key = MessageBase::getKeyFromMessage(global_request_ptr);
+        const ExtraCommonMsghdr extra_common_msghdr = global_request_ptr->getExtraCommonMsghdr();
+
+        MessageBase* global_response_ptr = NULL;
+        switch (global_request_ptr->getMessageType())
+        {
+            case MessageType::kGlobalGetRequest:
+            {
+                // Prepare global get response message
+                global_response_ptr = new GlobalGetResponse(tmp_key, value, cloud_idx, cloud_recvreq_source_addr, total_bandwidth_usage, event_list, extra_common_msghdr); // Edge-assigned seqnum to fix duplicate reponses for timeout-and-retry
+                assert(global_response_ptr != NULL);
+                break;
+            }
+            case MessageType::kGlobalPutRequest:
+            {
+                // Prepare global put response message
+                global_response_ptr = new GlobalPutResponse(tmp_key, cloud_idx, cloud_recvreq_source_addr, total_bandwidth_usage, event_list, extra_common_msghdr); // Edge-assigned seqnum to fix duplicate reponses for timeout-and-retry
+                assert(global_response_ptr != NULL);
+                break;
+            }
+            case MessageType::kGlobalDelRequest:
+            {
+                // Prepare global del response message
+                global_response_ptr = new GlobalDelResponse(tmp_key, cloud_idx, cloud_recvreq_source_addr, total_bandwidth_usage, event_list, extra_common_msghdr); // Edge-assigned seqnum to fix duplicate reponses for timeout-and-retry
+                assert(global_response_ptr != NULL);
+                break;
+            }
+            case MessageType::kCoveredBgfetchGlobalGetRequest: // ONLY used by COVERED
+            {
+                const CoveredBgfetchGlobalGetRequest* const covered_placement_global_get_request_ptr = static_cast<const CoveredBgfetchGlobalGetRequest*>(global_request_ptr);
+
+                // NOTE: NOT assert here as cloud does NOT need to know topk_edgecnt_
+                //assert(covered_placement_global_get_request_ptr->getEdgesetRef().size() <= topk_edgecnt_); // At most k placement edge nodes each time
+
+                // Prepare covered placement global get response message
+                global_response_ptr = new CoveredBgfetchGlobalGetResponse(tmp_key, value, covered_placement_global_get_request_ptr->getEdgesetRef(), cloud_idx, cloud_recvreq_source_addr, total_bandwidth_usage, event_list, extra_common_msghdr); // Client-/edge-assigned seqnum (NOT used due to NO timeout-and-retry)
+                assert(global_response_ptr != NULL);
+                break;
+            }
+            default:
+            {
+                std::ostringstream oss;
+                oss << "invalid message type " << MessageBase::messageTypeToString(global_request_ptr->getMessageType()) << " for getGlobalResponse()!";
+                Util::dumpErrorMsg(kClassName, oss.str());
+                exit(1);
+            }
+        }
+
+        assert(global_response_ptr != NULL);
+        assert(global_response_ptr->isGlobalDataResponse());
+        return global_response_ptr;
+    }
+
+    void DataServer::checkAbnormalRocksdbLatency(const std::string& instance_name, const uint32_t& access_rocksdb_latency_us)
+    {
+        uint32_t abnormal_latency_threshold_us = 0;
+        if (UdpPktSocket::SOCKET_TIMEOUT_SECONDS > 1)
+        {
+            abnormal_latency_threshold_us = (UdpPktSocket::SOCKET_TIMEOUT_SECONDS - 1) * 1000000;
+        }
+        else
+        {
+            abnormal_latency_threshold_us = 1 * 1000000;
+        }
+        if (access_rocksdb_latency_us >= abnormal_latency_threshold_us) // Too large processing latency
+        {
+            std::ostringstream oss;
+            oss << "cloud rocksdb access latency " << access_rocksdb_latency_us << " us >= abnormal latency threshold " << abnormal_latency_threshold_us << " us";
+            Util::dumpWarnMsg(instance_name, oss.str());
+        }
+        return;
+    }
+
     bool DataServer::processGlobalRequest_(MessageBase* global_request_ptr, const NetworkAddr& edge_cache_server_worker_recvrsp_dst_addr)
     {
         checkPointers_();
@@ -131,7 +287,6 @@ namespace covered
         MessageType global_request_message_type = global_request_ptr->getMessageType();
         Key tmp_key;
         Value tmp_value;
-        Edgeset tmp_placement_edgeset;
         const ExtraCommonMsghdr extra_common_msghdr = global_request_ptr->getExtraCommonMsghdr();
         const bool skip_propagation_latency = extra_common_msghdr.isSkipPropagationLatency();
         std::string event_name;
@@ -211,7 +366,6 @@ namespace covered
             {
                 const CoveredBgfetchGlobalGetRequest* const covered_placement_global_get_request_ptr = static_cast<const CoveredBgfetchGlobalGetRequest*>(global_request_ptr);
                 tmp_key = covered_placement_global_get_request_ptr->getKey();
-                tmp_placement_edgeset = covered_placement_global_get_request_ptr->getEdgesetRef();
 
                 // Get value from RocksDB KVS
                 #ifdef ENABLE_CLOUD_WARMUP_SPEEDUP
@@ -251,21 +405,7 @@ namespace covered
         event_list.addEvent(event_name, access_rocksdb_latency_us);
 
         // Report abnormal rocksdb accesses with extremely large latency
-        uint32_t abnormal_latency_threshold_us = 0;
-        if (UdpPktSocket::SOCKET_TIMEOUT_SECONDS > 1)
-        {
-            abnormal_latency_threshold_us = (UdpPktSocket::SOCKET_TIMEOUT_SECONDS - 1) * 1000000;
-        }
-        else
-        {
-            abnormal_latency_threshold_us = 1 * 1000000;
-        }
-        if (access_rocksdb_latency_us >= abnormal_latency_threshold_us) // Too large processing latency
-        {
-            std::ostringstream oss;
-            oss << "cloud rocksdb access latency " << access_rocksdb_latency_us << " us >= abnormal latency threshold " << abnormal_latency_threshold_us << " us";
-            Util::dumpWarnMsg(instance_name_, oss.str());
-        }
+        checkAbnormalRocksdbLatency(instance_name_, access_rocksdb_latency_us);
 
         if (is_finish) // Check is_finish
         {
@@ -273,46 +413,7 @@ namespace covered
         }
 
         // Prepare global response
-        MessageBase* global_response_ptr = NULL;
-        switch (global_request_message_type)
-        {
-            case MessageType::kGlobalGetRequest:
-            {
-                // Prepare global get response message
-                global_response_ptr = new GlobalGetResponse(tmp_key, tmp_value, cloud_idx, cloud_recvreq_source_addr_, total_bandwidth_usage, event_list, extra_common_msghdr); // Edge-assigned seqnum to fix duplicate reponses for timeout-and-retry
-                assert(global_response_ptr != NULL);
-                break;
-            }
-            case MessageType::kGlobalPutRequest:
-            {
-                // Prepare global put response message
-                global_response_ptr = new GlobalPutResponse(tmp_key, cloud_idx, cloud_recvreq_source_addr_, total_bandwidth_usage, event_list, extra_common_msghdr); // Edge-assigned seqnum to fix duplicate reponses for timeout-and-retry
-                assert(global_response_ptr != NULL);
-                break;
-            }
-            case MessageType::kGlobalDelRequest:
-            {
-                // Prepare global del response message
-                global_response_ptr = new GlobalDelResponse(tmp_key, cloud_idx, cloud_recvreq_source_addr_, total_bandwidth_usage, event_list, extra_common_msghdr); // Edge-assigned seqnum to fix duplicate reponses for timeout-and-retry
-                assert(global_response_ptr != NULL);
-                break;
-            }
-            case MessageType::kCoveredBgfetchGlobalGetRequest: // ONLY used by COVERED
-            {
-                // NOTE: NOT assert here as cloud does NOT need to know topk_edgecnt_
-                //assert(tmp_placement_edgeset.size() <= topk_edgecnt_); // At most k placement edge nodes each time
-
-                // Prepare covered placement global get response message
-                global_response_ptr = new CoveredBgfetchGlobalGetResponse(tmp_key, tmp_value, tmp_placement_edgeset, cloud_idx, cloud_recvreq_source_addr_, total_bandwidth_usage, event_list, extra_common_msghdr); // Client-/edge-assigned seqnum (NOT used due to NO timeout-and-retry)
-                assert(global_response_ptr != NULL);
-                break;
-            }
-            default:
-            {
-                Util::dumpErrorMsg(instance_name_, "cannot arrive here!");
-                exit(1);
-            }
-        }
+        MessageBase* global_response_ptr = getGlobalResponse(global_request_ptr, tmp_value, cloud_idx, cloud_recvreq_source_addr_, total_bandwidth_usage, event_list);
 
         // Push the global response message into cloud-to-edge propagation simulator to edge cache server worker
         assert(global_response_ptr != NULL);
@@ -326,6 +427,32 @@ namespace covered
         return is_finish;
     }
 
+    void DataServer::partitionRequest_(MessageBase* global_request_ptr, const struct timespec& recvreq_timestamp)
+    {
+        assert(global_request_ptr != NULL);
+        assert(hash_wrapper_ptr_ != NULL);
+
+        const uint32_t data_server_workercnt = data_server_worker_param_ptrs_.size();
+        assert(data_server_workercnt > 1);
+
+        // Calculate the corresponding data server worker index by hashing
+        Key tmp_key = MessageBase::getKeyFromMessage(global_request_ptr);
+        uint32_t local_data_server_worker_idx = hash_wrapper_ptr_->hash(tmp_key) % data_server_workercnt;
+        assert(local_data_server_worker_idx < data_server_workercnt);
+
+        // Pass item into ring buffer of the corresponding data server worker
+        DataServerItem tmp_data_server_item(global_request_ptr, recvreq_timestamp);
+        bool is_successful = data_server_worker_param_ptrs_[local_data_server_worker_idx]->push(tmp_data_server_item);
+        if (!is_successful) // Ring buffer is full under overload (see Config::ring_buffer_overload_policy_)
+        {
+            // NOTE: drop the global request, which has been counted by the ring buffer and will be resent by the edge node after timeout
+            delete global_request_ptr;
+            global_request_ptr = NULL;
+        }
+
+        return;
+    }
+
     void DataServer::checkPointers_() const
     {
         assert(cloud_component_param_ptr_ != NULL);
@@ -1,5 +1,7 @@
 /*
  * DataServer: data server thread launched by cloud to process global requests and reply global responses.
+ *
+ * NOTE: if with multiple data server workers, data server only receives global requests and partitions them into data server workers by key hashing, while each data server worker accesses RocksDB in batches (see DataServerWorker).
  * 
  * By Siyuan Sheng (2023.07.28).
  */
@@ -10,9 +12,15 @@
 //#define DEBUG_DATA_SERVER
 
 #include <string>
+#include <vector>
 
 #include "cloud/cloud_component_param.h"
 #include "cloud/cloud_wrapper.h"
+#include "cloud/data_server/data_server_worker_param.h"
+#include "common/bandwidth_usage.h"
+#include "common/value.h"
+#include "event/event_list.h"
+#include "hash/hash_wrapper_base.h"
 #include "message/message_base.h"
 #include "network/network_addr.h"
 #include "network/udp_msg_socket_server.h"
@@ -31,10 +39,15 @@ namespace covered
         ~DataServer();
 
         void start();
+
+        // Shared by data server and data server workers
+        static MessageBase* getGlobalResponse(MessageBase* global_request_ptr, const Value& value, const uint32_t& cloud_idx, const NetworkAddr& cloud_recvreq_source_addr, const BandwidthUsage& total_bandwidth_usage, const EventList& event_list);
+        static void checkAbnormalRocksdbLatency(const std::string& instance_name, const uint32_t& access_rocksdb_latency_us); // Report abnormal rocksdb accesses with extremely large latency
     private:
         static const std::string kClassName;
 
         bool processGlobalRequest_(MessageBase* request_ptr, const NetworkAddr& edge_cache_server_worker_recvrsp_dst_addr);
+        void partitionRequest_(MessageBase* global_request_ptr, const struct timespec& recvreq_timestamp);
 
         void checkPointers_() const;
 
@@ -44,6 +57,10 @@ namespace covered
         // For receiving global requests
         NetworkAddr cloud_recvreq_source_addr_; // The same as that used by edge cache server worker to send global requests (const individual variable)
         UdpMsgSocketServer* cloud_recvreq_socket_server_ptr_; // Used by cloud to receive global requests from edge cache server worker (non-const individual variable)
+
+        // For data server workers (empty for single-threaded data server)
+        std::vector<DataServerWorkerParam*> data_server_worker_param_ptrs_;
+        HashWrapperBase* hash_wrapper_ptr_; // Partition global requests into data server workers (NULL for single-threaded data server)
     };
 }
 
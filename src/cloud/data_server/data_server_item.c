@@ -0,0 +1,45 @@
+#include "cloud/data_server/data_server_item.h"
+
+#include <assert.h>
+
+namespace covered
+{
+    const std::string DataServerItem::kClassName("DataServerItem");
+
+    DataServerItem::DataServerItem()
+    {
+        request_ptr_ = NULL;
+        recvreq_timestamp_.tv_sec = 0;
+        recvreq_timestamp_.tv_nsec = 0;
+    }
+
+    DataServerItem::DataServerItem(MessageBase* request_ptr, const struct timespec& recvreq_timestamp)
+    {
+        assert(request_ptr != NULL);
+        request_ptr_ = request_ptr;
+        recvreq_timestamp_ = recvreq_timestamp;
+    }
+
+    DataServerItem::~DataServerItem()
+    {
+        // NOTE: no need to release request_ptr_, which will be released outside DataServerItem (by the corresponding data server worker)
+    }
+
+    MessageBase* DataServerItem::getRequestPtr() const
+    {
+        assert(request_ptr_ != NULL);
+        return request_ptr_;
+    }
+
+    struct timespec DataServerItem::getRecvreqTimestamp() const
+    {
+        return recvreq_timestamp_;
+    }
+
+    const DataServerItem& DataServerItem::operator=(const DataServerItem& other)
+    {
+        request_ptr_ = other.request_ptr_; // Shallow copy
+        recvreq_timestamp_ = other.recvreq_timestamp_;
+        return *this;
+    }
+}
\ No newline at end of file
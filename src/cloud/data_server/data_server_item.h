@@ -0,0 +1,36 @@
+/*
+ * DataServerItem: an item passed from cloud data server to cloud data server workers.
+ *
+ * NOTE: we track the timestamp when cloud data server receives the global request, so data server worker can report cloud-side queueing latency separately from RocksDB service latency.
+ */
+
+#ifndef DATA_SERVER_ITEM_H
+#define DATA_SERVER_ITEM_H
+
+#include <string>
+#include <time.h> // struct timespec
+
+#include "message/message_base.h"
+
+namespace covered
+{
+    class DataServerItem
+    {
+    public:
+        DataServerItem();
+        DataServerItem(MessageBase* request_ptr, const struct timespec& recvreq_timestamp);
+        ~DataServerItem();
+
+        MessageBase* getRequestPtr() const;
+        struct timespec getRecvreqTimestamp() const;
+
+        const DataServerItem& operator=(const DataServerItem& other);
+    private:
+        static const std::string kClassName;
+
+        MessageBase* request_ptr_;
+        struct timespec recvreq_timestamp_;
+    };
+}
+
+#endif
@@ -0,0 +1,324 @@
+#include "cloud/data_server/data_server_worker.h"
+
+#include <assert.h>
+#include <sstream>
+
+#include "cloud/data_server/data_server.h"
+#include "common/bandwidth_usage.h"
+#include "common/config.h"
+#include "common/util.h"
+#include "event/event_list.h"
+#include "message/data_message.h"
+
+namespace covered
+{
+    const std::string DataServerWorker::kClassName("DataServerWorker");
+
+    const uint32_t DataServerWorker::MAX_BATCH_SIZE = 32;
+    const uint32_t DataServerWorker::MAX_IDLE_WAIT_US = 1000; // 1 ms
+
+    void* DataServerWorker::launchDataServerWorker(void* data_server_worker_param_ptr)
+    {
+        DataServerWorker data_server_worker((DataServerWorkerParam*)data_server_worker_param_ptr);
+        data_server_worker.start();
+
+        pthread_exit(NULL);
+        return NULL;
+    }
+
+    DataServerWorker::DataServerWorker(DataServerWorkerParam* data_server_worker_param_ptr) : data_server_worker_param_ptr_(data_server_worker_param_ptr)
+    {
+        assert(data_server_worker_param_ptr != NULL);
+        CloudWrapper* tmp_cloud_wrapper_ptr = data_server_worker_param_ptr->getCloudDataServerParamPtr()->getCloudWrapperPtr();
+        assert(tmp_cloud_wrapper_ptr != NULL);
+        uint32_t cloud_idx = tmp_cloud_wrapper_ptr->getNodeIdx();
+
+        // Differentiate data server workers in different clouds
+        std::ostringstream oss;
+        oss << kClassName << " cloud" << cloud_idx << "-worker" << data_server_worker_param_ptr->getLocalDataServerWorkerIdx();
+        instance_name_ = oss.str();
+
+        // For global responses
+
+        // Get source address of cloud recvreq (the same as DataServer)
+        const bool is_private_cloud_ipstr = false; // NOTE: cloud communicates with edges via public IP address
+        const bool is_launch_cloud = true; // The cloud data server worker belons to the logical cloud node launched in the current physical machine
+        std::string cloud_ipstr = Config::getCloudIpstr(is_private_cloud_ipstr, is_launch_cloud);
+        uint16_t cloud_recvreq_port = Util::getCloudRecvreqPort(cloud_idx);
+        cloud_recvreq_source_addr_ = NetworkAddr(cloud_ipstr, cloud_recvreq_port);
+    }
+
+    DataServerWorker::~DataServerWorker()
+    {
+        // NOTE: no need to release data_server_worker_param_ptr_, which will be released outside DataServerWorker (by DataServer)
+    }
+
+    void DataServerWorker::start()
+    {
+        checkPointers_();
+        CloudWrapper* tmp_cloud_wrapper_ptr = data_server_worker_param_ptr_->getCloudDataServerParamPtr()->getCloudWrapperPtr();
+
+        // Notify cloud data server that the current data server worker has finished initialization
+        data_server_worker_param_ptr_->markFinishInitialization();
+
+        std::vector<DataServerItem> data_server_items;
+        data_server_items.reserve(MAX_BATCH_SIZE);
+        while (tmp_cloud_wrapper_ptr->isNodeRunning()) // cloud_running_ is set as true by default
+        {
+            // NOTE: get push count before popping, so any item pushed after popping will wake up the following wait
+            const uint32_t prev_pushcnt = data_server_worker_param_ptr_->getPushCnt();
+
+            // Try to get pending global requests (if any) from ring buffer partitioned by data server in a batch without waiting
+            data_server_items.clear();
+            uint32_t popped_cnt = data_server_worker_param_ptr_->popBatch(data_server_items, MAX_BATCH_SIZE);
+            if (popped_cnt == 0)
+            {
+                // Wait for any new item instead of spinning (bounded to check if cloud is still running)
+                data_server_worker_param_ptr_->waitForPush(prev_pushcnt, Util::getCurrentMonotonicTimeUs() + MAX_IDLE_WAIT_US);
+                continue; // Retry to receive an item if cloud is still running
+            }
+
+            // NOTE: received requests will be released in processGlobalRequestBatch_()
+            processGlobalRequestBatch_(data_server_items);
+        }
+
+        return;
+    }
+
+    bool DataServerWorker::isGlobalReadRequest_(const MessageBase* global_request_ptr)
+    {
+        assert(global_request_ptr != NULL);
+
+        const MessageType global_request_message_type = global_request_ptr->getMessageType();
+        bool is_read = false;
+        switch (global_request_message_type)
+        {
+            case MessageType::kGlobalGetRequest:
+            case MessageType::kCoveredBgfetchGlobalGetRequest: // ONLY used by COVERED
+            {
+                is_read = true;
+                break;
+            }
+            case MessageType::kGlobalPutRequest:
+            case MessageType::kGlobalDelRequest:
+            {
+                is_read = false;
+                break;
+            }
+            default:
+            {
+                std::ostringstream oss;
+                oss << "invalid message type " << MessageBase::messageTypeToString(global_request_message_type) << " for isGlobalReadRequest_()!";
+                Util::dumpErrorMsg(kClassName, oss.str());
+                exit(1);
+            }
+        }
+        return is_read;
+    }
+
+    void DataServerWorker::processGlobalRequestBatch_(const std::vector<DataServerItem>& data_server_items)
+    {
+        assert(data_server_items.size() > 0);
+
+        // Split the batch into consecutive runs of reads and writes, such that a read never bypasses an earlier write of the same key (and vice versa)
+        uint32_t run_begin_idx = 0;
+        while (run_begin_idx < data_server_items.size())
+        {
+            const bool is_read_run = isGlobalReadRequest_(data_server_items[run_begin_idx].getRequestPtr());
+            uint32_t run_end_idx = run_begin_idx + 1;
+            while (run_end_idx < data_server_items.size() && isGlobalReadRequest_(data_server_items[run_end_idx].getRequestPtr()) == is_read_run)
+            {
+                run_end_idx++;
+            }
+
+            processGlobalRequestRun_(data_server_items, run_begin_idx, run_end_idx, is_read_run);
+            run_begin_idx = run_end_idx;
+        }
+
+        return;
+    }
+
+    void DataServerWorker::processGlobalRequestRun_(const std::vector<DataServerItem>& data_server_items, const uint32_t& run_begin_idx, const uint32_t& run_end_idx, const bool& is_read_run)
+    {
+        checkPointers_();
+        assert(run_begin_idx < run_end_idx);
+        assert(run_end_idx <= data_server_items.size());
+
+        CloudWrapper* tmp_cloud_wrapper_ptr = data_server_worker_param_ptr_->getCloudDataServerParamPtr()->getCloudWrapperPtr();
+        const uint32_t cloud_idx = tmp_cloud_wrapper_ptr->getNodeIdx();
+        const uint32_t runsize = run_end_idx - run_begin_idx;
+
+        struct timespec access_rocksdb_start_timestamp = Util::getCurrentTimespec();
+
+        // Process global requests by RocksDB KVS
+        std::vector<Value> run_values(runsize); // Values of reads, or values of writes (deleted value for removes)
+        std::vector<Key> rocksdb_keys; // Keys accessing RocksDB KVS in the current run
+        std::vector<Value> rocksdb_values; // Values accessing RocksDB KVS in the current run
+        std::vector<uint32_t> rocksdb_run_offsets; // Offsets of RocksDB accesses in the current run
+        rocksdb_keys.reserve(runsize);
+        rocksdb_values.reserve(runsize);
+        rocksdb_run_offsets.reserve(runsize);
+        for (uint32_t run_offset = 0; run_offset < runsize; run_offset++)
+        {
+            MessageBase* tmp_global_request_ptr = data_server_items[run_begin_idx + run_offset].getRequestPtr();
+            const Key tmp_key = MessageBase::getKeyFromMessage(tmp_global_request_ptr);
+            if (tmp_global_request_ptr->getMessageType() == MessageType::kGlobalPutRequest)
+            {
+                run_values[run_offset] = static_cast<const GlobalPutRequest*>(tmp_global_request_ptr)->getValue();
+                assert(run_values[run_offset].isDeleted() == false);
+            }
+            else
+            {
+                run_values[run_offset] = Value(); // Default value with is_deleted = true for removes (overwritten by reads)
+            }
+
+            #ifdef ENABLE_CLOUD_WARMUP_SPEEDUP
+            const bool skip_propagation_latency = tmp_global_request_ptr->getExtraCommonMsghdr().isSkipPropagationLatency();
+            if (skip_propagation_latency) // Warmup speedup is enabled
+            {
+                // NOTE: we use an impl trick to NOT reflect writes into rocksdb for warmup speedup (NOT affect evaluation results on cache stable performance)
+                // NOTE: in-memory dataset is updated in place and keys of the same partition are ONLY accessed by the current data server worker
+                switch (tmp_global_request_ptr->getMessageType())
+                {
+                    case MessageType::kGlobalGetRequest:
+                    case MessageType::kCoveredBgfetchGlobalGetRequest:
+                    {
+                        tmp_cloud_wrapper_ptr->getWorkloadGeneratorPtr()->quickDatasetGet(tmp_key, run_values[run_offset]);
+                        break;
+                    }
+                    case MessageType::kGlobalPutRequest:
+                    {
+                        tmp_cloud_wrapper_ptr->getWorkloadGeneratorPtr()->quickDatasetPut(tmp_key, run_values[run_offset]);
+                        break;
+                    }
+                    case MessageType::kGlobalDelRequest:
+                    {
+                        tmp_cloud_wrapper_ptr->getWorkloadGeneratorPtr()->quickDatasetDel(tmp_key);
+                        break;
+                    }
+                    default:
+                    {
+                        Util::dumpErrorMsg(instance_name_, "cannot arrive here!");
+                        exit(1);
+                    }
+                }
+                continue;
+            }
+            #endif
+
+            // Normal backend storage access (evaluation phase, or warmup phase without warmup speedup)
+            rocksdb_keys.push_back(tmp_key);
+            rocksdb_values.push_back(run_values[run_offset]);
+            rocksdb_run_offsets.push_back(run_offset);
+        }
+
+        if (rocksdb_keys.size() > 0)
+        {
+            if (is_read_run)
+            {
+                // Get values from RocksDB KVS by a single MultiGet
+                tmp_cloud_wrapper_ptr->getCloudRocksdbPtr()->multiGet(rocksdb_keys, rocksdb_values);
+                assert(rocksdb_values.size() == rocksdb_run_offsets.size());
+                for (uint32_t i = 0; i < rocksdb_run_offsets.size(); i++)
+                {
+                    run_values[rocksdb_run_offsets[i]] = rocksdb_values[i];
+                }
+            }
+            else
+            {
+                // Put/remove values into/from RocksDB KVS by a single WriteBatch
+                tmp_cloud_wrapper_ptr->getCloudRocksdbPtr()->writeBatch(rocksdb_keys, rocksdb_values);
+            }
+        }
+
+        // NOTE: all requests in the same run share the RocksDB access latency of the run
+        struct timespec access_rocksdb_end_timestamp = Util::getCurrentTimespec();
+        uint32_t access_rocksdb_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(access_rocksdb_end_timestamp, access_rocksdb_start_timestamp));
+
+        // Report abnormal rocksdb accesses with extremely large latency
+        DataServer::checkAbnormalRocksdbLatency(instance_name_, access_rocksdb_latency_us);
+
+        #ifdef DEBUG_DATA_SERVER_WORKER
+        std::ostringstream oss;
+        oss << "process a run of " << runsize << " global " << (is_read_run ? "reads" : "writes") << " (" << rocksdb_keys.size() << " RocksDB accesses) in " << access_rocksdb_latency_us << " us";
+        Util::dumpDebugMsg(instance_name_, oss.str());
+        #endif
+
+        // Reply global responses and release global requests
+        for (uint32_t run_offset = 0; run_offset < runsize; run_offset++)
+        {
+            const DataServerItem& tmp_data_server_item = data_server_items[run_begin_idx + run_offset];
+            MessageBase* tmp_global_request_ptr = tmp_data_server_item.getRequestPtr();
+            const MessageType global_request_message_type = tmp_global_request_ptr->getMessageType();
+
+            // Update total bandwidth usage for received global get/put/del request
+            BandwidthUsage total_bandwidth_usage;
+            uint32_t edge_cloud_global_req_bandwidth_bytes = tmp_global_request_ptr->getMsgBandwidthSize();
+            total_bandwidth_usage.update(BandwidthUsage(0, 0, edge_cloud_global_req_bandwidth_bytes, 0, 0, 1, global_request_message_type, tmp_global_request_ptr->getVictimSyncsetBytes()));
+
+            // Add intermediate events if with event tracking
+            EventList event_list;
+            uint32_t queueing_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(access_rocksdb_start_timestamp, tmp_data_server_item.getRecvreqTimestamp()));
+            std::string queueing_event_name = Event::CLOUD_DATA_SERVER_WORKER_QUEUEING_EVENT_NAME;
+            std::string rocksdb_event_name;
+            switch (global_request_message_type)
+            {
+                case MessageType::kGlobalGetRequest:
+                {
+                    rocksdb_event_name = Event::CLOUD_GET_ROCKSDB_EVENT_NAME;
+                    break;
+                }
+                case MessageType::kGlobalPutRequest:
+                {
+                    rocksdb_event_name = Event::CLOUD_PUT_ROCKSDB_EVENT_NAME;
+                    break;
+                }
+                case MessageType::kGlobalDelRequest:
+                {
+                    rocksdb_event_name = Event::CLOUD_DEL_ROCKSDB_EVENT_NAME;
+                    break;
+                }
+                case MessageType::kCoveredBgfetchGlobalGetRequest: // ONLY used by COVERED
+                {
+                    queueing_event_name = Event::BG_CLOUD_DATA_SERVER_WORKER_QUEUEING_EVENT_NAME;
+                    rocksdb_event_name = Event::BG_CLOUD_GET_ROCKSDB_EVENT_NAME;
+                    break;
+                }
+                default:
+                {
+                    Util::dumpErrorMsg(instance_name_, "cannot arrive here!");
+                    exit(1);
+                }
+            }
+            event_list.addEvent(queueing_event_name, queueing_latency_us);
+            event_list.addEvent(rocksdb_event_name, access_rocksdb_latency_us);
+
+            // Prepare global response
+            MessageBase* global_response_ptr = DataServer::getGlobalResponse(tmp_global_request_ptr, run_values[run_offset], cloud_idx, cloud_recvreq_source_addr_, total_bandwidth_usage, event_list);
+
+            // Push the global response message into cloud-to-edge propagation simulator to edge cache server worker
+            assert(global_response_ptr != NULL);
+            NetworkAddr edge_cache_server_worker_recvrsp_dst_addr = tmp_global_request_ptr->getSourceAddr();
+            bool is_successful = tmp_cloud_wrapper_ptr->getCloudToedgePropagationSimulatorParamPtr()->push(global_response_ptr, edge_cache_server_worker_recvrsp_dst_addr);
+            assert(is_successful);
+            UNUSED(is_successful);
+
+            // NOTE: global_response_ptr will be released by cloud-to-edge propagation simulator
+            global_response_ptr = NULL;
+
+            // Release global request by the corresponding data server worker
+            delete tmp_global_request_ptr;
+            tmp_global_request_ptr = NULL;
+        }
+
+        return;
+    }
+
+    void DataServerWorker::checkPointers_() const
+    {
+        assert(data_server_worker_param_ptr_ != NULL);
+        assert(data_server_worker_param_ptr_->getCloudDataServerParamPtr() != NULL);
+        assert(data_server_worker_param_ptr_->getCloudDataServerParamPtr()->getCloudWrapperPtr() != NULL);
+        return;
+    }
+}
\ No newline at end of file
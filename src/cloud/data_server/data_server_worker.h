@@ -0,0 +1,54 @@
+/*
+ * DataServerWorker: data server worker thread launched by cloud data server to process global requests of a hash partition in batches.
+ *
+ * NOTE: each data server worker drains pending global requests from its ring buffer (at most MAX_BATCH_SIZE at a time), and splits them into consecutive runs of reads and writes to preserve per-key order: each run of reads issues a single RocksDB MultiGet, while each run of writes (puts/removes) is applied by a single RocksDB WriteBatch. Responses are pushed per request once the run finishes, so they may be out of order across data server workers.
+ *
+ * NOTE: each global response reports the time from receiving the request by data server to starting its run (cloud::data_server_worker::queueing), separately from RocksDB access latency of the run (cloud::*_rocksdb).
+ */
+
+#ifndef DATA_SERVER_WORKER_H
+#define DATA_SERVER_WORKER_H
+
+//#define DEBUG_DATA_SERVER_WORKER
+
+#include <string>
+#include <vector>
+
+#include "cloud/data_server/data_server_item.h"
+#include "cloud/data_server/data_server_worker_param.h"
+#include "message/message_base.h"
+#include "network/network_addr.h"
+
+namespace covered
+{
+    class DataServerWorker
+    {
+    public:
+        static void* launchDataServerWorker(void* data_server_worker_param_ptr);
+
+        DataServerWorker(DataServerWorkerParam* data_server_worker_param_ptr);
+        ~DataServerWorker();
+
+        void start();
+    private:
+        static const std::string kClassName;
+
+        static const uint32_t MAX_BATCH_SIZE; // Maximum # of global requests drained from ring buffer at a time
+        static const uint32_t MAX_IDLE_WAIT_US; // Upper bound of each wait for global requests to check if cloud is finished
+
+        static bool isGlobalReadRequest_(const MessageBase* global_request_ptr);
+
+        void processGlobalRequestBatch_(const std::vector<DataServerItem>& data_server_items);
+        void processGlobalRequestRun_(const std::vector<DataServerItem>& data_server_items, const uint32_t& run_begin_idx, const uint32_t& run_end_idx, const bool& is_read_run); // Process data_server_items[run_begin_idx, run_end_idx) (all reads or all writes)
+
+        void checkPointers_() const;
+
+        std::string instance_name_;
+        DataServerWorkerParam* data_server_worker_param_ptr_;
+
+        // For global responses
+        NetworkAddr cloud_recvreq_source_addr_; // The same as that used by edge cache server worker to send global requests (const individual variable)
+    };
+}
+
+#endif
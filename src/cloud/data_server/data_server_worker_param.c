@@ -0,0 +1,114 @@
+#include "cloud/data_server/data_server_worker_param.h"
+
+#include <assert.h>
+#include <linux/futex.h> // FUTEX_WAIT_BITSET_PRIVATE, FUTEX_WAKE_PRIVATE, FUTEX_BITSET_MATCH_ANY
+#include <sstream>
+#include <sys/syscall.h> // SYS_futex
+#include <unistd.h> // syscall
+#include <vector>
+
+#include "common/config.h"
+#include "common/util.h"
+
+namespace covered
+{
+    const std::string DataServerWorkerParam::kClassName("DataServerWorkerParam");
+
+    DataServerWorkerParam::DataServerWorkerParam(CloudComponentParam* cloud_data_server_param_ptr, const uint32_t& local_data_server_worker_idx, const uint32_t& global_request_buffer_size) : SubthreadParamBase(), pushcnt_(0), is_worker_waiting_(false)
+    {
+        assert(cloud_data_server_param_ptr != NULL);
+
+        cloud_data_server_param_ptr_ = cloud_data_server_param_ptr;
+        local_data_server_worker_idx_ = local_data_server_worker_idx;
+
+        // Allocate ring buffer for global requests
+        const bool with_multi_providers = false; // ONLY one provider (i.e., cloud data server) for global requests
+        const bool is_block_when_full = Config::isRingBufferBlockWhenFull(); // Overload policy of ingress global requests
+        global_request_buffer_ptr_ = new RingBuffer<DataServerItem>(DataServerItem(), global_request_buffer_size, with_multi_providers, is_block_when_full);
+        assert(global_request_buffer_ptr_ != NULL);
+    }
+
+    DataServerWorkerParam::~DataServerWorkerParam()
+    {
+        // NOTE: no need to release cloud_data_server_param_ptr_, which will be released outside DataServerWorkerParam (e.g., by CloudWrapper)
+
+        assert(global_request_buffer_ptr_ != NULL);
+
+        // Dump queue-depth statistics
+        std::ostringstream oss;
+        oss << "global request ring buffer of local data server worker " << local_data_server_worker_idx_ << ": " << global_request_buffer_ptr_->getStatisticsStr();
+        Util::dumpInfoMsg(kClassName, oss.str());
+
+        // Release messages in remaining items
+        std::vector<DataServerItem> remaining_elements;
+        global_request_buffer_ptr_->getAllToRelease(remaining_elements);
+        for (uint32_t i = 0; i < remaining_elements.size(); i++)
+        {
+            MessageBase* tmp_remaining_message_ptr = remaining_elements[i].getRequestPtr();
+            assert(tmp_remaining_message_ptr != NULL);
+            delete tmp_remaining_message_ptr;
+            tmp_remaining_message_ptr = NULL;
+        }
+
+        delete global_request_buffer_ptr_;
+        global_request_buffer_ptr_ = NULL;
+    }
+
+    CloudComponentParam* DataServerWorkerParam::getCloudDataServerParamPtr() const
+    {
+        assert(cloud_data_server_param_ptr_ != NULL);
+        return cloud_data_server_param_ptr_;
+    }
+
+    uint32_t DataServerWorkerParam::getLocalDataServerWorkerIdx() const
+    {
+        return local_data_server_worker_idx_;
+    }
+
+    bool DataServerWorkerParam::push(const DataServerItem& data_server_item)
+    {
+        assert(global_request_buffer_ptr_ != NULL);
+
+        bool is_successful = global_request_buffer_ptr_->push(data_server_item);
+        if (!is_successful)
+        {
+            return is_successful; // NOTE: NO need to wake up data server worker for dropped item
+        }
+
+        // Wake up data server worker if it is waiting for new items
+        // NOTE: use seq_cst for the store-load handshake with waitForPush() (the same as PropagationSimulatorParam)
+        pushcnt_.fetch_add(1, std::memory_order_seq_cst);
+        if (is_worker_waiting_.load(std::memory_order_seq_cst))
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&pushcnt_), FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        }
+
+        return is_successful;
+    }
+
+    uint32_t DataServerWorkerParam::popBatch(std::vector<DataServerItem>& data_server_items, const uint32_t& max_cnt)
+    {
+        assert(global_request_buffer_ptr_ != NULL);
+        return global_request_buffer_ptr_->popBatch(data_server_items, max_cnt);
+    }
+
+    uint32_t DataServerWorkerParam::getPushCnt() const
+    {
+        return pushcnt_.load(std::memory_order_seq_cst);
+    }
+
+    void DataServerWorkerParam::waitForPush(const uint32_t& prev_pushcnt, const uint64_t& deadline_us)
+    {
+        // NOTE: data server updates pushcnt_ before checking is_worker_waiting_, while we update is_worker_waiting_ before futex checks pushcnt_ atomically in kernel -> no lost wakeup under seq_cst
+        is_worker_waiting_.store(true, std::memory_order_seq_cst);
+        if (pushcnt_.load(std::memory_order_seq_cst) == prev_pushcnt)
+        {
+            struct timespec deadline_timespec;
+            deadline_timespec.tv_sec = static_cast<time_t>(deadline_us / 1000000);
+            deadline_timespec.tv_nsec = static_cast<long>((deadline_us % 1000000) * 1000);
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&pushcnt_), FUTEX_WAIT_BITSET_PRIVATE, prev_pushcnt, &deadline_timespec, NULL, FUTEX_BITSET_MATCH_ANY); // Return on wakeup, timeout, EAGAIN (pushcnt_ changed), or EINTR -> caller re-checks anyway
+        }
+        is_worker_waiting_.store(false, std::memory_order_seq_cst);
+        return;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,52 @@
+/*
+ * DataServerWorkerParam: parameters to launch a data server worker in a cloud node (thread safe).
+ *
+ * NOTE: each data server worker owns a hash partition of keys; data server receives global requests and passes each of them into the ring buffer of the worker owning its key, so requests of the same key are still processed in order.
+ *
+ * NOTE: an idle data server worker parks on a futex of push count (woken up by push() of data server) instead of spinning on the empty ring buffer (the same as PropagationSimulatorParam).
+ */
+
+#ifndef DATA_SERVER_WORKER_PARAM_H
+#define DATA_SERVER_WORKER_PARAM_H
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace covered
+{
+    class DataServerWorkerParam;
+}
+
+#include "cloud/cloud_component_param.h"
+#include "cloud/data_server/data_server_item.h"
+#include "common/subthread_param_base.h"
+#include "concurrency/ring_buffer_impl.h"
+
+namespace covered
+{
+    class DataServerWorkerParam : public SubthreadParamBase
+    {
+    public:
+        DataServerWorkerParam(CloudComponentParam* cloud_data_server_param_ptr, const uint32_t& local_data_server_worker_idx, const uint32_t& global_request_buffer_size);
+        ~DataServerWorkerParam();
+
+        CloudComponentParam* getCloudDataServerParamPtr() const;
+        uint32_t getLocalDataServerWorkerIdx() const;
+
+        bool push(const DataServerItem& data_server_item); // Return false if the item is dropped under overload (ONLY invoked by data server)
+        uint32_t popBatch(std::vector<DataServerItem>& data_server_items, const uint32_t& max_cnt); // Only invoked by data server worker (append at most max_cnt items into data_server_items)
+        uint32_t getPushCnt() const; // Only invoked by data server worker
+        void waitForPush(const uint32_t& prev_pushcnt, const uint64_t& deadline_us); // Only invoked by data server worker (return if any item is pushed after getting prev_pushcnt, or until deadline_us from Util::getCurrentMonotonicTimeUs())
+    private:
+        static const std::string kClassName;
+
+        CloudComponentParam* cloud_data_server_param_ptr_; // thread safe
+        uint32_t local_data_server_worker_idx_; // const shared variable
+        RingBuffer<DataServerItem>* global_request_buffer_ptr_; // thread safe
+        std::atomic<uint32_t> pushcnt_; // # of pushed items (wrap-around) as the futex word to wake up data server worker
+        std::atomic<bool> is_worker_waiting_; // Avoid futex syscall in push() if data server worker is NOT waiting
+    };
+}
+
+#endif
@@ -3,6 +3,9 @@
 #include <assert.h>
 #include <sstream>
 
+#include <rocksdb/write_batch.h>
+
+#include "common/config.h"
 #include "common/util.h"
 
 namespace covered
@@ -52,6 +55,18 @@ namespace covered
         oss << kClassName << " cloud" << cloud_idx;
         instance_name_ = oss.str();
 
+        #ifdef ENABLE_ROCKSDB_NO_VALUESTR
+        if (Config::isRealValuePayload())
+        {
+            // NOTE: RocksDB ONLY stores value sizes, so cloud cannot return real value bytes to edges
+            oss.clear();
+            oss.str("");
+            oss << Config::IS_REAL_VALUE_PAYLOAD_KEYSTR << " MUST be 0 under ENABLE_ROCKSDB_NO_VALUESTR (please undefine it in cloud/rocksdb_wrapper.h and reload the dataset)!";
+            Util::dumpErrorMsg(instance_name_, oss.str());
+            exit(1);
+        }
+        #endif
+
         oss.clear();
         oss.str("");
         oss << "open RocksDB from directory " << db_dirpath << "...";
@@ -99,7 +114,14 @@ namespace covered
             uint32_t value_size = *((uint32_t*)valuesize_str.data());
             value = Value(value_size);
             #else
-            value = Value(value_str.length());
+            if (Config::isRealValuePayload())
+            {
+                value = Value(value_str.data(), value_str.length());
+            }
+            else
+            {
+                value = Value(value_str.length());
+            }
             #endif
         }
         else if (rocksdb_status.IsNotFound())
@@ -141,6 +163,91 @@ namespace covered
         return;
     }
 
+    void RocksdbWrapper::multiGet(const std::vector<Key>& keys, std::vector<Value>& values)
+    {
+        // NOTE: rocksdb::Slice does NOT own bytes, so we keep key strings alive until MultiGet returns
+        std::vector<std::string> key_strs(keys.size());
+        std::vector<rocksdb::Slice> key_slices(keys.size());
+        for (uint32_t i = 0; i < keys.size(); i++)
+        {
+            key_strs[i] = keys[i].getKeystr();
+            key_slices[i] = rocksdb::Slice(key_strs[i]);
+        }
+
+        // NOTE: value strings store value sizes instead of value contents if ENABLE_ROCKSDB_NO_VALUESTR
+        std::vector<std::string> value_strs;
+        std::vector<rocksdb::Status> rocksdb_statuses = db_ptr_->MultiGet(rocksdb::ReadOptions(), key_slices, &value_strs);
+        assert(rocksdb_statuses.size() == keys.size());
+        assert(value_strs.size() == keys.size());
+
+        values.resize(keys.size());
+        for (uint32_t i = 0; i < keys.size(); i++)
+        {
+            const rocksdb::Status& tmp_rocksdb_status = rocksdb_statuses[i];
+            if (tmp_rocksdb_status.ok())
+            {
+                #ifdef ENABLE_ROCKSDB_NO_VALUESTR
+                uint32_t value_size = *((uint32_t*)value_strs[i].data());
+                values[i] = Value(value_size);
+                #else
+                if (Config::isRealValuePayload())
+                {
+                    values[i] = Value(value_strs[i].data(), value_strs[i].length());
+                }
+                else
+                {
+                    values[i] = Value(value_strs[i].length());
+                }
+                #endif
+            }
+            else if (tmp_rocksdb_status.IsNotFound())
+            {
+                values[i] = Value();
+            }
+            else
+            {
+                std::ostringstream oss;
+                oss << "fail to multi-get key " << keys[i].getKeyDebugstr() << " from RocksDB KVS (status: " << tmp_rocksdb_status.ToString() << ")";
+                Util::dumpErrorMsg(instance_name_, oss.str());
+                exit(1);
+            }
+        }
+        return;
+    }
+
+    void RocksdbWrapper::writeBatch(const std::vector<Key>& keys, const std::vector<Value>& values)
+    {
+        assert(keys.size() == values.size());
+
+        rocksdb::WriteBatch rocksdb_write_batch;
+        for (uint32_t i = 0; i < keys.size(); i++)
+        {
+            std::string key_str = keys[i].getKeystr();
+            rocksdb::Status rocksdb_status;
+            if (values[i].isDeleted()) // Remove
+            {
+                rocksdb_status = rocksdb_write_batch.Delete(key_str);
+            }
+            else // Put
+            {
+                #ifdef ENABLE_ROCKSDB_NO_VALUESTR
+                uint32_t value_size = values[i].getValuesize();
+                std::string valuesize_str = std::string((char*)&value_size, sizeof(uint32_t));
+                rocksdb_status = rocksdb_write_batch.Put(key_str, valuesize_str);
+                #else
+                std::string value_str = values[i].generateValuestrForStorage();
+                rocksdb_status = rocksdb_write_batch.Put(key_str, value_str);
+                #endif
+            }
+            assert(rocksdb_status.ok());
+        }
+
+        // NOTE: WriteBatch amortizes WAL appends and memtable insertions (i.e., one write group) across all writes in the batch
+        rocksdb::Status rocksdb_status = db_ptr_->Write(rocksdb::WriteOptions(), &rocksdb_write_batch);
+        assert(rocksdb_status.ok());
+        return;
+    }
+
     void RocksdbWrapper::open_(const std::string& cloud_storage, const std::string& db_dirpath)
     {
         rocksdb::Options rocksdb_options;
@@ -5,6 +5,7 @@
  */
 
 #include <string>
+#include <vector>
 
 #include <rocksdb/db.h>
 #include <rocksdb/cache.h>
@@ -69,6 +70,10 @@ namespace covered
         void get(const Key& key, Value& value);
         void put(const Key& key, const Value& value);
         void remove(const Key& key);
+
+        // Batched accesses for cloud data server workers
+        void multiGet(const std::vector<Key>& keys, std::vector<Value>& values); // Issue a single RocksDB MultiGet for all keys
+        void writeBatch(const std::vector<Key>& keys, const std::vector<Value>& values); // Apply puts (or removes for deleted values) atomically by a single RocksDB WriteBatch
     private:
         static const std::string kClassName;
 
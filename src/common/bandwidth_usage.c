@@ -102,6 +102,9 @@ namespace covered
         cross_edge_control_others_msgcnt_ = other.cross_edge_control_others_msgcnt_;
         cross_edge_data_msgcnt_ = other.cross_edge_data_msgcnt_;
         edge_cloud_msgcnt_ = other.edge_cloud_msgcnt_;
+
+        coalesced_reqcnt_ = other.coalesced_reqcnt_;
+        coalesced_saved_bandwidth_bytes_ = other.coalesced_saved_bandwidth_bytes_;
     }
 
     BandwidthUsage::~BandwidthUsage() {}
@@ -124,6 +127,9 @@ namespace covered
         cross_edge_control_others_msgcnt_ += other.cross_edge_control_others_msgcnt_;
         edge_cloud_msgcnt_ += other.edge_cloud_msgcnt_;
 
+        coalesced_reqcnt_ += other.coalesced_reqcnt_;
+        coalesced_saved_bandwidth_bytes_ += other.coalesced_saved_bandwidth_bytes_;
+
         return;
     }
 
@@ -177,6 +183,13 @@ namespace covered
         return;
     }
 
+    void BandwidthUsage::updateCoalescedReqcntAndSavedBandwidth(const uint64_t& saved_bandwidth_bytes, const uint64_t& reqcnt)
+    {
+        coalesced_saved_bandwidth_bytes_ += saved_bandwidth_bytes;
+        coalesced_reqcnt_ += reqcnt;
+        return;
+    }
+
     uint64_t BandwidthUsage::getClientEdgeBandwidthBytes() const
     {
         return client_edge_bandwidth_bytes_;
@@ -252,6 +265,16 @@ namespace covered
         return edge_cloud_msgcnt_;
     }
 
+    uint64_t BandwidthUsage::getCoalescedReqcnt() const
+    {
+        return coalesced_reqcnt_;
+    }
+
+    uint64_t BandwidthUsage::getCoalescedSavedBandwidthBytes() const
+    {
+        return coalesced_saved_bandwidth_bytes_;
+    }
+
     uint32_t BandwidthUsage::getBandwidthUsagePayloadSize()
     {
         // client-edge bandwidth usage + cross-edge bandwidth usage (control * 3 and data + victim syncset) + edge-cloud bandwidth usage
@@ -259,8 +282,18 @@ namespace covered
 
         // client-edge message count + cross-edge message count (control * 3 and data) + edge-cloud message count
         uint32_t msgcnt_payload = sizeof(uint64_t) + sizeof(uint64_t) * 4 + sizeof(uint64_t);
+        // coalesced request count + coalesced saved bandwidth usage
+        uint32_t coalesced_payload = sizeof(uint64_t) + sizeof(uint64_t);
+
+        return bandwidth_bytes_payload + msgcnt_payload + coalesced_payload;
+    }
 
-        return bandwidth_bytes_payload + msgcnt_payload;
+    uint32_t BandwidthUsage::getBandwidthUsageBandwidthSize()
+    {
+        // NOTE: coalesced counters are ONLY for statistics, which should NOT affect the measured bandwidth usage of each message
+        uint32_t coalesced_payload = sizeof(uint64_t) + sizeof(uint64_t);
+
+        return getBandwidthUsagePayloadSize() - coalesced_payload;
     }
 
     /*uint32_t BandwidthUsage::serialize(DynamicArray& msg_payload, const uint32_t& position) const
@@ -327,6 +360,10 @@ namespace covered
         size += sizeof(uint64_t);
         msg_payload.deserialize(size, (const char*)&edge_cloud_msgcnt_, sizeof(uint64_t));
         size += sizeof(uint64_t);
+        msg_payload.deserialize(size, (const char*)&coalesced_reqcnt_, sizeof(uint64_t));
+        size += sizeof(uint64_t);
+        msg_payload.deserialize(size, (const char*)&coalesced_saved_bandwidth_bytes_, sizeof(uint64_t));
+        size += sizeof(uint64_t);
         return size - position;
     }
 
@@ -361,6 +398,10 @@ namespace covered
         size += sizeof(uint64_t);
         msg_payload.serialize(size, (char*)&edge_cloud_msgcnt_, sizeof(uint64_t));
         size += sizeof(uint64_t);
+        msg_payload.serialize(size, (char*)&coalesced_reqcnt_, sizeof(uint64_t));
+        size += sizeof(uint64_t);
+        msg_payload.serialize(size, (char*)&coalesced_saved_bandwidth_bytes_, sizeof(uint64_t));
+        size += sizeof(uint64_t);
         return size - position;
     }
 
@@ -382,6 +423,9 @@ namespace covered
         cross_edge_data_msgcnt_ = other.cross_edge_data_msgcnt_;
         edge_cloud_msgcnt_ = other.edge_cloud_msgcnt_;
 
+        coalesced_reqcnt_ = other.coalesced_reqcnt_;
+        coalesced_saved_bandwidth_bytes_ = other.coalesced_saved_bandwidth_bytes_;
+
         return *this;
     }
 
@@ -403,6 +447,9 @@ namespace covered
         cross_edge_data_msgcnt_ = 0;
         edge_cloud_msgcnt_ = 0;
 
+        coalesced_reqcnt_ = 0;
+        coalesced_saved_bandwidth_bytes_ = 0;
+
         return;
     }
 }
\ No newline at end of file
@@ -5,6 +5,10 @@
  * 
  * NOTE: use uint64_t for bandwidth bytes to avoid integer overflow.
  * 
+ * NOTE: coalesced request count and saved bandwidth bytes track local get requests served by the in-flight fetch of a previous request of the same key (single-flight); saved bandwidth is NOT included in any other bandwidth usage.
+ *
+ * NOTE: coalesced counters are statistics piggybacked in responses, which are NOT counted into ideal message bandwidth size (see getBandwidthUsageBandwidthSize()) to keep bandwidth results comparable w/ and w/o coalescing.
+ * 
  * By Siyuan Sheng (2023.09.14).
  */
 
@@ -36,6 +40,7 @@ namespace covered
         void updateCrossEdgeDataBandwidthAndMsgcnt(const uint64_t& bandwidth_bytes, const uint64_t& msgcnt);
         void updateEdgeCloudBandwidthAndMsgcnt(const uint64_t& bandwidth_bytes, const uint64_t& msgcnt);
         void updateVictimSyncsetBandwidth(const uint32_t& bandwidth_bytes);
+        void updateCoalescedReqcntAndSavedBandwidth(const uint64_t& saved_bandwidth_bytes, const uint64_t& reqcnt);
 
         uint64_t getClientEdgeBandwidthBytes() const;
         uint64_t getCrossEdgeControlContentDiscoveryBandwidthBytes() const;
@@ -55,7 +60,11 @@ namespace covered
         uint64_t getCrossEdgeDataMsgcnt() const;
         uint64_t getEdgeCloudMsgcnt() const;
 
-        static uint32_t getBandwidthUsagePayloadSize();
+        uint64_t getCoalescedReqcnt() const;
+        uint64_t getCoalescedSavedBandwidthBytes() const;
+
+        static uint32_t getBandwidthUsagePayloadSize(); // Real transmitted bytes (including coalesced counters)
+        static uint32_t getBandwidthUsageBandwidthSize(); // Ideal transmitted bytes for bandwidth usage calculation (excluding coalesced counters)
         uint32_t serialize(DynamicArray& msg_payload, const uint32_t& position) const;
         uint32_t deserialize(const DynamicArray& msg_payload, const uint32_t& position);
 
@@ -80,6 +89,9 @@ namespace covered
         uint64_t cross_edge_control_others_msgcnt_; // Message count of cross-edge control messages for other purposes
         uint64_t cross_edge_data_msgcnt_; // Message count of cross-edge data messages
         uint64_t edge_cloud_msgcnt_; // Must be data messages
+
+        uint64_t coalesced_reqcnt_; // # of local get requests coalesced into in-flight fetches of the same key
+        uint64_t coalesced_saved_bandwidth_bytes_; // Cross-edge and edge-cloud bandwidth bytes saved by coalesced requests
     };
 }
 
@@ -0,0 +1,48 @@
+#include "common/cachelib_nvm_info.h"
+
+namespace covered
+{
+    const std::string CachelibNvmInfo::kClassName("CachelibNvmInfo");
+
+    CachelibNvmInfo::CachelibNvmInfo()
+    {
+        nvm_filepath_ = "";
+        nvm_capacity_bytes_ = 0;
+        nvm_admit_probability_ = 1.0;
+    }
+
+    CachelibNvmInfo::CachelibNvmInfo(const std::string& nvm_filepath, const uint64_t& nvm_capacity_bytes, const double& nvm_admit_probability)
+    {
+        nvm_filepath_ = nvm_filepath;
+        nvm_capacity_bytes_ = nvm_capacity_bytes;
+        nvm_admit_probability_ = nvm_admit_probability;
+    }
+
+    CachelibNvmInfo::~CachelibNvmInfo() {}
+
+    std::string CachelibNvmInfo::getNvmFilepath() const
+    {
+        return nvm_filepath_;
+    }
+
+    uint64_t CachelibNvmInfo::getNvmCapacityBytes() const
+    {
+        return nvm_capacity_bytes_;
+    }
+
+    double CachelibNvmInfo::getNvmAdmitProbability() const
+    {
+        return nvm_admit_probability_;
+    }
+
+    CachelibNvmInfo& CachelibNvmInfo::operator=(const CachelibNvmInfo& other)
+    {
+        if (this != &other)
+        {
+            nvm_filepath_ = other.nvm_filepath_;
+            nvm_capacity_bytes_ = other.nvm_capacity_bytes_;
+            nvm_admit_probability_ = other.nvm_admit_probability_;
+        }
+        return *this;
+    }
+}
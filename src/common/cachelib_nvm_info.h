@@ -0,0 +1,33 @@
+/*
+ * CachelibNvmInfo: store the CLI parameters of the NVM tier (Navy BlockCache + BigHash on a file-backed device) for the hybrid DRAM+NVM local edge cache based on Cachelib.
+ */
+
+#ifndef CACHELIB_NVM_INFO_H
+#define CACHELIB_NVM_INFO_H
+
+#include <string>
+
+namespace covered
+{
+    class CachelibNvmInfo
+    {
+    public:
+        CachelibNvmInfo(); // NVM tier disabled
+        CachelibNvmInfo(const std::string& nvm_filepath, const uint64_t& nvm_capacity_bytes, const double& nvm_admit_probability);
+        ~CachelibNvmInfo();
+
+        std::string getNvmFilepath() const;
+        uint64_t getNvmCapacityBytes() const;
+        double getNvmAdmitProbability() const;
+
+        CachelibNvmInfo& operator=(const CachelibNvmInfo& other);
+    private:
+        static const std::string kClassName;
+
+        std::string nvm_filepath_; // Path prefix of the file-backed NVM device (each edge node appends its own suffix)
+        uint64_t nvm_capacity_bytes_; // NVM share of the local edge cache capacity
+        double nvm_admit_probability_; // Probability to write a DRAM victim into NVM (otherwise evicted from the hybrid cache directly)
+    };
+}
+
+#endif
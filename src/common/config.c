@@ -84,12 +84,16 @@ namespace covered
     const std::string Config::COVERED_LOCAL_UNCACHED_LRU_MAX_RATIO_KEYSTR("covered_local_uncached_lru_max_ratio");
     const std::string Config::COVERED_POPULARITY_AGGREGATION_MAX_MEM_USAGE_RATIO_KEYSTR("covered_popularity_aggregation_max_mem_usage_ratio");
     const std::string Config::DATASET_LOADER_SLEEP_FOR_COMPACTION_SEC_KEYSTR("dataset_loader_sleep_for_compaction_sec");
+    const std::string Config::DHT_EDGE_WEIGHTS_KEYSTR("dht_edge_weights");
+    const std::string Config::DHT_PLACEMENT_NAME_KEYSTR("dht_placement_name");
+    const std::string Config::DHT_VNODECNT_PEREDGE_KEYSTR("dht_vnodecnt_peredge");
     const std::string Config::DYNAMIC_RULECNT_KEYSTR("dynamic_rulecnt");
     const std::string Config::EDGE_BEACON_SERVER_RECVREQ_STARTPORT_KEYSTR("edge_beacon_server_recvreq_startport");
     const std::string Config::EDGE_BEACON_SERVER_RECVRSP_STARTPORT_KEYSTR("edge_beacon_server_recvrsp_startport");
     const std::string Config::EDGE_CACHE_SERVER_DATA_REQUEST_BUFFER_SIZE_KEYSTR("edge_cache_server_data_request_buffer_size");
     const std::string Config::EDGE_CACHE_SERVER_RECVREQ_STARTPORT_KEYSTR("edge_cache_server_recvreq_startport");
     const std::string Config::EDGE_CACHE_SERVER_PLACEMENT_PROCESSOR_RECVRSP_STARTPORT_KEYSTR("edge_cache_server_placement_processor_recvrsp_startport");
+    const std::string Config::EDGE_CACHE_SERVER_WORKER_ASYNC_RECVRSP_STARTPORT_KEYSTR("edge_cache_server_worker_async_recvrsp_startport");
     const std::string Config::EDGE_CACHE_SERVER_WORKER_RECVREQ_STARTPORT_KEYSTR("edge_cache_server_worker_recvreq_startport");
     const std::string Config::EDGE_CACHE_SERVER_WORKER_RECVRSP_STARTPORT_KEYSTR("edge_cache_server_worker_recvrsp_startport");
     const std::string Config::EDGE_DEDICATED_CORECNT_KEYSTR("edge_dedicated_corecnt");
@@ -106,7 +110,9 @@ namespace covered
     const std::string Config::IS_INFO_KEYSTR("is_info");
     const std::string Config::IS_GENERATE_RANDOM_VALUESTR_KEYSTR("is_generate_random_valuestr");
     const std::string Config::IS_TRACK_EVENT_KEYSTR("is_track_event");
-    const std::string Config::LATENCY_HISTOGRAM_SIZE_KEYSTR("latency_histogram_size");
+    const std::string Config::IS_LRB_BACKGROUND_TRAINING_KEYSTR("is_lrb_background_training");
+    const std::string Config::IS_REAL_VALUE_PAYLOAD_KEYSTR("is_real_value_payload");
+    const std::string Config::LATENCY_HISTOGRAM_SIGNIFICANT_BITS_KEYSTR("latency_histogram_significant_bits");
     //const std::string Config::MIN_CAPACITY_MB_KEYSTR("min_capacity_mb"); // <"min_capacity_mb": 10,> in config.json
     const std::string Config::OUTPUT_DIRPATH_KEYSTR("output_dirpath");
     const std::string Config::PARALLEL_EVICTION_MAX_VICTIMCNT_KEYSTR("parallel_eviction_max_victimcnt");
@@ -115,6 +121,7 @@ namespace covered
     const std::string Config::PROPAGATION_ITEM_BUFFER_SIZE_EDGE_TOEDGE_KEYSTR("propagation_item_buffer_size_edge_toedge");
     const std::string Config::PROPAGATION_ITEM_BUFFER_SIZE_EDGE_TOCLOUD_KEYSTR("propagation_item_buffer_size_edge_tocloud");
     const std::string Config::PROPAGATION_ITEM_BUFFER_SIZE_CLOUD_TOEDGE_KEYSTR("propagation_item_buffer_size_cloud_toedge");
+    const std::string Config::RING_BUFFER_OVERLOAD_POLICY_KEYSTR("ring_buffer_overload_policy");
     const std::string Config::TRACE_DIRPATH_KEYSTR("trace_dirpath");
     const std::string Config::TRACE_DIRPATH_RELATIVE_WIKIIMAGE_TRACE_FILEPATHS_KEYSTR("trace_dirpath_relative_wikiimage_trace_filepaths");
     const std::string Config::TRACE_DIRPATH_RELATIVE_WIKITEXT_TRACE_FILEPATHS_KEYSTR("trace_dirpath_relative_wikitext_trace_filepaths");
@@ -149,12 +156,16 @@ namespace covered
     double Config::covered_local_uncached_lru_max_ratio_ = 0.01;
     double Config::covered_popularity_aggregation_max_mem_usage_ratio_ = 0.01;
     uint32_t Config::dataset_loader_sleep_for_compaction_sec_ = 30;
+    std::vector<uint32_t> Config::dht_edge_weights_(0);
+    std::string Config::dht_placement_name_ = Util::DHT_RANGE_PLACEMENT_NAME;
+    uint32_t Config::dht_vnodecnt_peredge_ = 128;
     uint32_t Config::dynamic_rulecnt_ = 10000;
     uint16_t Config::edge_beacon_server_recvreq_startport_ = 4500; // [4096, 65536]
     uint16_t Config::edge_beacon_server_recvrsp_startport_ = 4600; // [4096, 65536]
     uint32_t Config::edge_cache_server_data_request_buffer_size_ = 10000;
     uint16_t Config::edge_cache_server_recvreq_startport_ = 4700; // [4096, 65536]
     uint16_t Config::edge_cache_server_placement_processor_recvrsp_startport_ = 4800; // [4096, 65536]
+    uint16_t Config::edge_cache_server_worker_async_recvrsp_startport_ = 5300; // [4096, 65536]
     uint16_t Config::edge_cache_server_worker_recvreq_startport_ = 4900; // [4096, 65536]
     uint16_t Config::edge_cache_server_worker_recvrsp_startport_ = 5000; // [4096, 65536]
     uint32_t Config::edge_dedicated_corecnt_ = 8;
@@ -171,7 +182,9 @@ namespace covered
     bool Config::is_info_ = false;
     bool Config::is_generate_random_valuestr_ = false;
     bool Config::is_track_event_ = false;
-    uint32_t Config::latency_histogram_size_ = 1000000; // Track latency up to 1000 ms
+    bool Config::is_lrb_background_training_ = true;
+    bool Config::is_real_value_payload_ = false;
+    uint32_t Config::latency_histogram_significant_bits_ = 8; // Relative error of at most 2^-7 (< 1%) with 3328 buckets for all uint32_t latencies
     //uint64_t Config::min_capacity_mb_ = 10;
     std::string Config::output_dirpath_("output");
     uint32_t Config::parallel_eviction_max_victimcnt_ = 1000; // NOTE: MUST < the ring buffer sizes for edge-to-edge propagation simulator, cache server, edge-to-cloud & cloud-to-edge propagation simulator
@@ -180,6 +193,7 @@ namespace covered
     uint32_t Config::propagation_item_buffer_size_edge_toedge_ = 10000;
     uint32_t Config::propagation_item_buffer_size_edge_tocloud_ = 10000;
     uint32_t Config::propagation_item_buffer_size_cloud_toedge_ = 10000;
+    std::string Config::ring_buffer_overload_policy_("drop"); // NOTE: NOT use Util::RING_BUFFER_DROP_POLICY_NAME due to undefined initialization order of static variables across translation units
     std::string Config::trace_dirpath_("data");
     std::vector<std::string> Config::wikiimage_trace_filepaths_(0);
     std::vector<std::string> Config::wikitext_trace_filepaths_(0);
@@ -279,6 +293,47 @@ namespace covered
                     int64_t tmp_sec = kv_ptr->value().get_int64();
                     dataset_loader_sleep_for_compaction_sec_ = Util::toUint32(tmp_sec);
                 }
+                kv_ptr = find_(DHT_EDGE_WEIGHTS_KEYSTR);
+                if (kv_ptr != NULL)
+                {
+                    for (boost::json::array::iterator iter = kv_ptr->value().get_array().begin(); iter != kv_ptr->value().get_array().end(); iter++)
+                    {
+                        int64_t tmp_weight = iter->get_int64();
+                        if (tmp_weight <= 0)
+                        {
+                            std::ostringstream oss;
+                            oss << "invalid weight " << tmp_weight << " in " << DHT_EDGE_WEIGHTS_KEYSTR << ", which should be positive!";
+                            Util::dumpErrorMsg(kClassName, oss.str());
+                            exit(1);
+                        }
+                        dht_edge_weights_.push_back(Util::toUint32(tmp_weight));
+                    }
+                }
+                kv_ptr = find_(DHT_PLACEMENT_NAME_KEYSTR);
+                if (kv_ptr != NULL)
+                {
+                    dht_placement_name_ = std::string(kv_ptr->value().get_string().c_str());
+                    if (!Util::isValidDhtPlacementName(dht_placement_name_))
+                    {
+                        std::ostringstream oss;
+                        oss << "invalid " << DHT_PLACEMENT_NAME_KEYSTR << " " << dht_placement_name_ << ", which should be " << Util::DHT_RANGE_PLACEMENT_NAME << ", " << Util::DHT_RING_PLACEMENT_NAME << ", or " << Util::DHT_JUMP_PLACEMENT_NAME << "!";
+                        Util::dumpErrorMsg(kClassName, oss.str());
+                        exit(1);
+                    }
+                }
+                kv_ptr = find_(DHT_VNODECNT_PEREDGE_KEYSTR);
+                if (kv_ptr != NULL)
+                {
+                    int64_t tmp_vnodecnt = kv_ptr->value().get_int64();
+                    dht_vnodecnt_peredge_ = Util::toUint32(tmp_vnodecnt);
+                    if (dht_vnodecnt_peredge_ == 0)
+                    {
+                        std::ostringstream oss;
+                        oss << "invalid " << DHT_VNODECNT_PEREDGE_KEYSTR << " " << dht_vnodecnt_peredge_ << ", which should be positive!";
+                        Util::dumpErrorMsg(kClassName, oss.str());
+                        exit(1);
+                    }
+                }
                 kv_ptr = find_(DYNAMIC_RULECNT_KEYSTR);
                 if (kv_ptr != NULL)
                 {
@@ -295,6 +350,7 @@ namespace covered
                 }
                 tryToFindStartport_(EDGE_CACHE_SERVER_RECVREQ_STARTPORT_KEYSTR, &edge_cache_server_recvreq_startport_);
                 tryToFindStartport_(EDGE_CACHE_SERVER_PLACEMENT_PROCESSOR_RECVRSP_STARTPORT_KEYSTR, &edge_cache_server_placement_processor_recvrsp_startport_);
+                tryToFindStartport_(EDGE_CACHE_SERVER_WORKER_ASYNC_RECVRSP_STARTPORT_KEYSTR, &edge_cache_server_worker_async_recvrsp_startport_);
                 tryToFindStartport_(EDGE_CACHE_SERVER_WORKER_RECVREQ_STARTPORT_KEYSTR, &edge_cache_server_worker_recvreq_startport_);
                 tryToFindStartport_(EDGE_CACHE_SERVER_WORKER_RECVRSP_STARTPORT_KEYSTR, &edge_cache_server_worker_recvrsp_startport_);
                 kv_ptr = find_(EDGE_DEDICATED_CORECNT_KEYSTR);
@@ -372,11 +428,36 @@ namespace covered
                     int64_t tmp_value = kv_ptr->value().get_int64();
                     is_track_event_ = tmp_value==1?true:false;
                 }
-                kv_ptr = find_(LATENCY_HISTOGRAM_SIZE_KEYSTR);
+                kv_ptr = find_(IS_LRB_BACKGROUND_TRAINING_KEYSTR);
                 if (kv_ptr != NULL)
                 {
-                    int64_t tmp_size = kv_ptr->value().get_int64();
-                    latency_histogram_size_ = Util::toUint32(tmp_size);
+                    int64_t tmp_value = kv_ptr->value().get_int64();
+                    is_lrb_background_training_ = tmp_value==1?true:false;
+                }
+                if (is_lrb_background_training_ && main_class_name_ == Util::SINGLE_NODE_SIMULATOR_MAIN_NAME)
+                {
+                    // NOTE: background training makes model swaps depend on thread scheduling -> single-node simulator always trains LRB inline to keep deterministic results under fixed random seeds
+                    Util::dumpWarnMsg(kClassName, "force inline LRB training for single-node simulator to keep determinism!");
+                    is_lrb_background_training_ = false;
+                }
+                kv_ptr = find_(IS_REAL_VALUE_PAYLOAD_KEYSTR);
+                if (kv_ptr != NULL)
+                {
+                    int64_t tmp_value = kv_ptr->value().get_int64();
+                    is_real_value_payload_ = tmp_value==1?true:false;
+                }
+                kv_ptr = find_(LATENCY_HISTOGRAM_SIGNIFICANT_BITS_KEYSTR);
+                if (kv_ptr != NULL)
+                {
+                    int64_t tmp_bits = kv_ptr->value().get_int64();
+                    latency_histogram_significant_bits_ = Util::toUint32(tmp_bits);
+                    if (latency_histogram_significant_bits_ < 1 || latency_histogram_significant_bits_ > 16)
+                    {
+                        std::ostringstream oss;
+                        oss << "invalid " << LATENCY_HISTOGRAM_SIGNIFICANT_BITS_KEYSTR << " " << latency_histogram_significant_bits_ << ", which should be within [1, 16]!";
+                        Util::dumpErrorMsg(kClassName, oss.str());
+                        exit(1);
+                    }
                 }
                 // kv_ptr = find_(MIN_CAPACITY_MB_KEYSTR);
                 // if (kv_ptr != NULL)
@@ -425,6 +506,11 @@ namespace covered
                     int64_t tmp_size = kv_ptr->value().get_int64();
                     propagation_item_buffer_size_cloud_toedge_ = Util::toUint32(tmp_size);
                 }
+                kv_ptr = find_(RING_BUFFER_OVERLOAD_POLICY_KEYSTR);
+                if (kv_ptr != NULL)
+                {
+                    ring_buffer_overload_policy_ = std::string(kv_ptr->value().get_string().c_str());
+                }
                 kv_ptr = find_(TRACE_DIRPATH_KEYSTR);
                 if (kv_ptr != NULL)
                 {
@@ -644,6 +730,24 @@ namespace covered
         return dataset_loader_sleep_for_compaction_sec_;
     }
 
+    std::vector<uint32_t> Config::getDhtEdgeWeights()
+    {
+        checkIsValid_();
+        return dht_edge_weights_;
+    }
+
+    std::string Config::getDhtPlacementName()
+    {
+        checkIsValid_();
+        return dht_placement_name_;
+    }
+
+    uint32_t Config::getDhtVnodecntPeredge()
+    {
+        checkIsValid_();
+        return dht_vnodecnt_peredge_;
+    }
+
     uint32_t Config::getDynamicRulecnt()
     {
         checkIsValid_();
@@ -680,6 +784,12 @@ namespace covered
         return edge_cache_server_placement_processor_recvrsp_startport_;
     }
 
+    uint16_t Config::getEdgeCacheServerWorkerAsyncRecvrspStartport()
+    {
+        checkIsValid_();
+        return edge_cache_server_worker_async_recvrsp_startport_;
+    }
+
     uint16_t Config::getEdgeCacheServerWorkerRecvreqStartport()
     {
         checkIsValid_();
@@ -840,10 +950,22 @@ namespace covered
         return is_track_event_;
     }
 
-    uint32_t Config::getLatencyHistogramSize()
+    bool Config::isLrbBackgroundTraining()
+    {
+        checkIsValid_();
+        return is_lrb_background_training_;
+    }
+
+    bool Config::isRealValuePayload()
+    {
+        checkIsValid_();
+        return is_real_value_payload_;
+    }
+
+    uint32_t Config::getLatencyHistogramSignificantBits()
     {
         checkIsValid_();
-        return latency_histogram_size_;
+        return latency_histogram_significant_bits_;
     }
 
     // uint64_t Config::getMinCapacityMB()
@@ -894,6 +1016,18 @@ namespace covered
         return propagation_item_buffer_size_cloud_toedge_;
     }
 
+    std::string Config::getRingBufferOverloadPolicy()
+    {
+        checkIsValid_();
+        return ring_buffer_overload_policy_;
+    }
+
+    bool Config::isRingBufferBlockWhenFull()
+    {
+        checkIsValid_();
+        return ring_buffer_overload_policy_ == Util::RING_BUFFER_BLOCK_POLICY_NAME;
+    }
+
     std::string Config::getTraceDirpath()
     {
         checkIsValid_();
@@ -1116,6 +1250,30 @@ namespace covered
         return;
     }
 
+    bool Config::isPortWithinStartportRange(const uint16_t& startport, const uint16_t& port)
+    {
+        std::map<uint16_t, std::string>::const_iterator startport_keystr_map_const_iter = startport_keystr_map_.find(startport);
+        if (startport_keystr_map_const_iter == startport_keystr_map_.end())
+        {
+            // NOTE: start port MUST exist in Config module
+            std::cout << "[ERROR] start port " << startport << " does NOT exist in Config module!" << std::endl;
+            exit(1);
+        }
+
+        if (port < startport)
+        {
+            return false;
+        }
+
+        startport_keystr_map_const_iter++; // Move to the next start port
+        if (startport_keystr_map_const_iter != startport_keystr_map_.end() && port >= startport_keystr_map_const_iter->first)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
     std::string Config::toString()
     {
         checkIsValid_();
@@ -1141,11 +1299,20 @@ namespace covered
         oss << "Covered local uncached LRU max ratio: " << covered_local_uncached_lru_max_ratio_ << std::endl; // ONLY used by COVERED
         oss << "Covered popularity aggregation max mem usage ratio: " << covered_popularity_aggregation_max_mem_usage_ratio_ << std::endl; // ONLY used by COVERED
         oss << "Dataset loader sleep for compaction seconds: " << dataset_loader_sleep_for_compaction_sec_ << std::endl;
+        oss << "DHT edge weights: ";
+        for (uint32_t i = 0; i < dht_edge_weights_.size(); i++)
+        {
+            oss << dht_edge_weights_[i] << " ";
+        }
+        oss << std::endl;
+        oss << "DHT placement name: " << dht_placement_name_ << std::endl;
+        oss << "DHT vnodecnt per edge: " << dht_vnodecnt_peredge_ << std::endl;
         oss << "Dynamic rulecnt: " << dynamic_rulecnt_ << std::endl;
         oss << "Edge beacon server recvreq startport: " << edge_beacon_server_recvreq_startport_ << std::endl;
         oss << "Edge cache server data request buffer size: " << edge_cache_server_data_request_buffer_size_ << std::endl;
         oss << "Edge cache server recvreq startport: " << edge_cache_server_recvreq_startport_ << std::endl;
         oss << "Edge cache server placement processor recvrsp startport: " << edge_cache_server_placement_processor_recvrsp_startport_ << std::endl;
+        oss << "Edge cache server worker async recvrsp startport: " << edge_cache_server_worker_async_recvrsp_startport_ << std::endl;
         oss << "Edge cache server worker recvreq startport: " << edge_cache_server_worker_recvreq_startport_ << std::endl;
         oss << "Edge cache server worker recvrsp startport: " << edge_cache_server_worker_recvrsp_startport_ << std::endl;
         oss << "Edge dedicated corecnt: " << edge_dedicated_corecnt_ << std::endl;
@@ -1167,7 +1334,9 @@ namespace covered
         oss << "Is info: " << (is_info_?"true":"false") << std::endl;
         oss << "Is generate random valuestr: " << (is_generate_random_valuestr_?"true":"false") << std::endl;
         oss << "Is track event: " << (is_track_event_?"true":"false") << std::endl;
-        oss << "Latency histogram size: " << latency_histogram_size_ << std::endl;
+        oss << "Is LRB background training: " << (is_lrb_background_training_?"true":"false") << std::endl;
+        oss << "Is real value payload: " << (is_real_value_payload_?"true":"false") << std::endl;
+        oss << "Latency histogram significant bits: " << latency_histogram_significant_bits_ << std::endl;
         //oss << "Min capacity MiB: " << min_capacity_mb_ << std::endl;
         oss << "Output dirpath: " << output_dirpath_ << std::endl;
         oss << "Parallel eviction max victimcnt: " << parallel_eviction_max_victimcnt_ << std::endl;
@@ -1176,6 +1345,7 @@ namespace covered
         oss << "Propagation item buffer size from edge to edge: " << propagation_item_buffer_size_edge_toedge_ << std::endl;
         oss << "Propagation item buffer size from edge to cloud: " << propagation_item_buffer_size_edge_tocloud_ << std::endl;
         oss << "Propagation item buffer size from cloud to edge: " << propagation_item_buffer_size_cloud_toedge_ << std::endl;
+        oss << "Ring buffer overload policy: " << ring_buffer_overload_policy_ << std::endl;
         oss << "Trace dirpath: " << trace_dirpath_ << std::endl;
         oss << "Wikiimage trace filepaths (unsampled traces): ";
         for (uint32_t i = 0; i < wikiimage_trace_filepaths_.size(); i++)
@@ -1639,6 +1809,15 @@ namespace covered
         assert(parallel_eviction_max_victimcnt_ < propagation_item_buffer_size_edge_tocloud_);
         assert(parallel_eviction_max_victimcnt_ < propagation_item_buffer_size_cloud_toedge_);
 
+        // (2) ring_buffer_overload_policy_ MUST be a supported overload policy
+        if (ring_buffer_overload_policy_ != Util::RING_BUFFER_DROP_POLICY_NAME && ring_buffer_overload_policy_ != Util::RING_BUFFER_BLOCK_POLICY_NAME)
+        {
+            std::ostringstream oss;
+            oss << "ring buffer overload policy " << ring_buffer_overload_policy_ << " is not supported!";
+            Util::dumpErrorMsg(kClassName, oss.str());
+            exit(1);
+        }
+
         return;
     }
 }
\ No newline at end of file
@@ -67,12 +67,16 @@ namespace covered
         static const std::string COVERED_LOCAL_UNCACHED_LRU_MAX_RATIO_KEYSTR;
         static const std::string COVERED_POPULARITY_AGGREGATION_MAX_MEM_USAGE_RATIO_KEYSTR;
         static const std::string DATASET_LOADER_SLEEP_FOR_COMPACTION_SEC_KEYSTR;
+        static const std::string DHT_EDGE_WEIGHTS_KEYSTR;
+        static const std::string DHT_PLACEMENT_NAME_KEYSTR;
+        static const std::string DHT_VNODECNT_PEREDGE_KEYSTR;
         static const std::string DYNAMIC_RULECNT_KEYSTR;
         static const std::string EDGE_BEACON_SERVER_RECVREQ_STARTPORT_KEYSTR;
         static const std::string EDGE_BEACON_SERVER_RECVRSP_STARTPORT_KEYSTR;
         static const std::string EDGE_CACHE_SERVER_DATA_REQUEST_BUFFER_SIZE_KEYSTR;
         static const std::string EDGE_CACHE_SERVER_RECVREQ_STARTPORT_KEYSTR;
         static const std::string EDGE_CACHE_SERVER_PLACEMENT_PROCESSOR_RECVRSP_STARTPORT_KEYSTR;
+        static const std::string EDGE_CACHE_SERVER_WORKER_ASYNC_RECVRSP_STARTPORT_KEYSTR;
         static const std::string EDGE_CACHE_SERVER_WORKER_RECVREQ_STARTPORT_KEYSTR;
         static const std::string EDGE_CACHE_SERVER_WORKER_RECVRSP_STARTPORT_KEYSTR;
         static const std::string EDGE_DEDICATED_CORECNT_KEYSTR;
@@ -89,7 +93,9 @@ namespace covered
         static const std::string IS_INFO_KEYSTR;
         static const std::string IS_GENERATE_RANDOM_VALUESTR_KEYSTR;
         static const std::string IS_TRACK_EVENT_KEYSTR;
-        static const std::string LATENCY_HISTOGRAM_SIZE_KEYSTR;
+        static const std::string IS_LRB_BACKGROUND_TRAINING_KEYSTR;
+        static const std::string IS_REAL_VALUE_PAYLOAD_KEYSTR;
+        static const std::string LATENCY_HISTOGRAM_SIGNIFICANT_BITS_KEYSTR;
         //static const std::string MIN_CAPACITY_MB_KEYSTR;
         static const std::string OUTPUT_DIRPATH_KEYSTR;
         static const std::string PARALLEL_EVICTION_MAX_VICTIMCNT_KEYSTR;
@@ -98,6 +104,7 @@ namespace covered
         static const std::string PROPAGATION_ITEM_BUFFER_SIZE_EDGE_TOEDGE_KEYSTR;
         static const std::string PROPAGATION_ITEM_BUFFER_SIZE_EDGE_TOCLOUD_KEYSTR;
         static const std::string PROPAGATION_ITEM_BUFFER_SIZE_CLOUD_TOEDGE_KEYSTR;
+        static const std::string RING_BUFFER_OVERLOAD_POLICY_KEYSTR;
         static const std::string TRACE_DIRPATH_KEYSTR;
         static const std::string TRACE_DIRPATH_RELATIVE_WIKIIMAGE_TRACE_FILEPATHS_KEYSTR;
         static const std::string TRACE_DIRPATH_RELATIVE_WIKITEXT_TRACE_FILEPATHS_KEYSTR;
@@ -129,12 +136,16 @@ namespace covered
         static double getCoveredLocalUncachedLruMaxRatio();
         static double getCoveredPopularityAggregationMaxMemUsageRatio();
         static uint32_t getDatasetLoaderSleepForCompactionSec();
+        static std::vector<uint32_t> getDhtEdgeWeights();
+        static std::string getDhtPlacementName();
+        static uint32_t getDhtVnodecntPeredge();
         static uint32_t getDynamicRulecnt();
         static uint16_t getEdgeBeaconServerRecvreqStartport();
         static uint16_t getEdgeBeaconServerRecvrspStartport();
         static uint32_t getEdgeCacheServerDataRequestBufferSize();
         static uint16_t getEdgeCacheServerRecvreqStartport();
         static uint16_t getEdgeCacheServerPlacementProcessorRecvrspStartport();
+        static uint16_t getEdgeCacheServerWorkerAsyncRecvrspStartport();
         static uint16_t getEdgeCacheServerWorkerRecvreqStartport();
         static uint16_t getEdgeCacheServerWorkerRecvrspStartport();
 
@@ -154,7 +165,9 @@ namespace covered
         static bool isInfo();
         static bool isGenerateRandomValuestr();
         static bool isTrackEvent();
-        static uint32_t getLatencyHistogramSize();
+        static bool isLrbBackgroundTraining();
+        static bool isRealValuePayload();
+        static uint32_t getLatencyHistogramSignificantBits();
         //static uint64_t getMinCapacityMB();
         static std::string getOutputDirpath();
         static uint32_t getParallelEvictionMaxVictimcnt();
@@ -163,6 +176,8 @@ namespace covered
         static uint32_t getPropagationItemBufferSizeEdgeToedge();
         static uint32_t getPropagationItemBufferSizeEdgeTocloud();
         static uint32_t getPropagationItemBufferSizeCloudToedge();
+        static std::string getRingBufferOverloadPolicy();
+        static bool isRingBufferBlockWhenFull(); // Whether ingress ring buffers block (instead of drop) if full
         static std::string getTraceDirpath();
         static std::vector<std::string> getWikiimageTraceFilepaths();
         static std::vector<std::string> getWikitextTraceFilepaths();
@@ -182,6 +197,7 @@ namespace covered
 
         // For port verification
         static void portVerification(const uint16_t& startport, const uint16_t& finalport);
+        static bool isPortWithinStartportRange(const uint16_t& startport, const uint16_t& port); // Return if port >= startport yet < the next start port if any
 
         static std::string toString();
     private:
@@ -228,12 +244,16 @@ namespace covered
         static double covered_local_uncached_lru_max_ratio_; // The maximum memory usage ratio for local uncached LRU (ONLY used for COVERED if enabled)
         static double covered_popularity_aggregation_max_mem_usage_ratio_; // The maximum memory usage ratio for popularity aggregation (ONLY used by COVERED)
         static uint32_t dataset_loader_sleep_for_compaction_sec_; // Sleep time for dataset loader to wait for compaction in units of seconds
+        static std::vector<uint32_t> dht_edge_weights_; // Relative weights of edge nodes for consistent hashing ring (# of virtual nodes of edge i = dht_vnodecnt_peredge_ * weight i; empty means equal weights) -> ONLY used by DHT ring placement
+        static std::string dht_placement_name_; // How DhtWrapper maps keys to beacon edge nodes (range, ring, or jump)
+        static uint32_t dht_vnodecnt_peredge_; // # of virtual nodes per unit weight of edge node in consistent hashing ring (more virtual nodes balance beacon load better yet with a larger token array) -> ONLY used by DHT ring placement
         static uint32_t dynamic_rulecnt_; // The number of rules maintained by workload wrapper for dynamic workload patterns (NOTE: under skewed workloads, dynamic_rulecnt_ does NOT need to be too large; otherwise it will incur large rule update overhead under dynamic workload patterns)
         static uint16_t edge_beacon_server_recvreq_startport_; // Start UDP port for edge beacon server to receive cooperation control requests
         static uint16_t edge_beacon_server_recvrsp_startport_; // Start UDP port for edge beacon server to receive cooperation control responses
         static uint32_t edge_cache_server_data_request_buffer_size_; // Buffer size for edge cache server to store local/redirected data requests (for cache server workers and processors; placement processor has a message ring buffer and local admission ring buffer)
         static uint16_t edge_cache_server_recvreq_startport_; // Start UDP port for edge cache server to receive local/redirected requests
         static uint16_t edge_cache_server_placement_processor_recvrsp_startport_; // Start UDP port for edge cache server placement processor to receive cooperation control responses
+        static uint16_t edge_cache_server_worker_async_recvrsp_startport_; // Start UDP port for edge cache server worker to receive responses of multiplexed in-flight requests (ONLY used if cache_server_worker_inflightcnt > 1)
         static uint16_t edge_cache_server_worker_recvreq_startport_; // Start UDP port for edge cache server worker to receive cooperation control requests
         static uint16_t edge_cache_server_worker_recvrsp_startport_; // Start UDP port for edge cache server worker to receive global responses
         static uint16_t edge_invalidation_server_recvreq_startport_; // Start UDP port for edge invalidation server to receive cooperation control requests
@@ -251,7 +271,9 @@ namespace covered
         static bool is_info_; // Whether to dump info log -> NOT affect evaluation and NOT changed during evaluation
         static bool is_generate_random_valuestr_; // Whether to generate random string to fill up value content
         static bool is_track_event_; // Whether to track per-message events for debugging -> NOT affect evaluation results and NOT changed during evaluation
-        static uint32_t latency_histogram_size_; // Size of latency histogram
+        static bool is_lrb_background_training_; // Whether LRB trains its model in a background thread on a snapshot of training data (otherwise inline in the request path under the local edge cache lock) -> ONLY used by LRB (always false for single-node simulator)
+        static bool is_real_value_payload_; // Whether values carry real bytes, which are stored in per-edge slab arenas and transmitted in full (otherwise only value sizes are tracked and value content is capped by Value::MAX_VALUE_CONTENT_SIZE in network packets)
+        static uint32_t latency_histogram_significant_bits_; // # of significant bits of log-linear latency histogram (i.e., latencies < 2^bits are exact, and larger latencies have relative error of at most 2^-(bits-1))
         //static uint64_t min_capacity_mb_; // Size of minimum capacity in units of MiB (avoid too small cache capacity which cannot work due to large-value objects and necessary memory usage of CacheLib engine)
         static std::string output_dirpath_; // Dirpath for output files (including logs dumped by exp scripts, statistics dumped by statistics tracker, and snapshots dumped by edge wrappers for realnet exps)
         static uint32_t parallel_eviction_max_victimcnt_; // Max # of victims for parallel eviction (MUST < the ring buffer sizes for edge-to-edge propagation simulator, cache server, edge-to-cloud & cloud-to-edge propagation simulator) -> evicting too many victims each time may incur ring buffer overflow and UDP buffer overflow (even worse if we transmit value content in messages)
@@ -260,6 +282,7 @@ namespace covered
         static uint32_t propagation_item_buffer_size_edge_toedge_; // Buffer size for edge-to-edge propagated messages
         static uint32_t propagation_item_buffer_size_edge_tocloud_; // Buffer size for edge-to-cloud propagated messages
         static uint32_t propagation_item_buffer_size_cloud_toedge_; // Buffer size for cloud-to-edge propagated messages
+        static std::string ring_buffer_overload_policy_; // Overload policy of ingress ring buffers from cache/data server to workers/processors if full (drop: release the request and count it, which will be resent by client timeout; block: yield until free space)
         static std::string trace_dirpath_; // Dirpath for trace files and dataset/workload files dumped by trace preprocessor
         static std::vector<std::string> wikiimage_trace_filepaths_; // Wikipedia image trace file paths (unsampled traces) under trace dirpath
         static std::vector<std::string> wikitext_trace_filepaths_; // Wikipedia text trace file paths (unsampled traces) under trace dirpath
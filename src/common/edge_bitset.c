@@ -0,0 +1,406 @@
+#include "common/edge_bitset.h"
+
+#include <algorithm> // std::min
+#include <assert.h>
+#include <cstring> // memset
+#include <sstream>
+
+#include "common/util.h"
+
+namespace covered
+{
+    const uint32_t EdgeBitset::INLINE_WORDCNT = 4;
+    const uint32_t EdgeBitset::WORD_BITCNT = 64;
+    const uint32_t EdgeBitset::INLINE_EDGECNT = INLINE_WORDCNT * WORD_BITCNT;
+    const uint32_t EdgeBitset::END_EDGE_IDX = UINT32_MAX;
+
+    const std::string EdgeBitset::kClassName("EdgeBitset");
+
+    // (1) const_iterator
+
+    EdgeBitset::const_iterator::const_iterator() : edge_bitset_ptr_(NULL), edge_idx_(END_EDGE_IDX) {}
+
+    EdgeBitset::const_iterator::const_iterator(const EdgeBitset* edge_bitset_ptr, const uint32_t& edge_idx) : edge_bitset_ptr_(edge_bitset_ptr), edge_idx_(edge_idx) {}
+
+    uint32_t EdgeBitset::const_iterator::operator*() const
+    {
+        assert(edge_bitset_ptr_ != NULL);
+        assert(edge_idx_ != END_EDGE_IDX);
+        return edge_idx_;
+    }
+
+    EdgeBitset::const_iterator& EdgeBitset::const_iterator::operator++()
+    {
+        assert(edge_bitset_ptr_ != NULL);
+        assert(edge_idx_ != END_EDGE_IDX);
+        edge_idx_ = edge_bitset_ptr_->findNextEdgeIdx_(edge_idx_ + 1);
+        return *this;
+    }
+
+    EdgeBitset::const_iterator EdgeBitset::const_iterator::operator++(int)
+    {
+        const_iterator tmp_iter = *this;
+        ++(*this);
+        return tmp_iter;
+    }
+
+    bool EdgeBitset::const_iterator::operator==(const const_iterator& other) const
+    {
+        return (edge_bitset_ptr_ == other.edge_bitset_ptr_) && (edge_idx_ == other.edge_idx_);
+    }
+
+    bool EdgeBitset::const_iterator::operator!=(const const_iterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    // (2) EdgeBitset
+
+    EdgeBitset::EdgeBitset() : overflow_words_()
+    {
+        assert(sizeof(inline_words_) == INLINE_WORDCNT * sizeof(uint64_t));
+        memset(inline_words_, 0, sizeof(inline_words_));
+    }
+
+    EdgeBitset::~EdgeBitset() {}
+
+    bool EdgeBitset::isExist(const uint32_t& edge_idx) const
+    {
+        const uint32_t word_idx = edge_idx / WORD_BITCNT;
+        if (word_idx >= getWordcnt_())
+        {
+            return false;
+        }
+        return ((getWord_(word_idx) >> (edge_idx % WORD_BITCNT)) & 1) == 1;
+    }
+
+    uint32_t EdgeBitset::size() const
+    {
+        uint32_t edgecnt = 0;
+        for (uint32_t i = 0; i < INLINE_WORDCNT; i++)
+        {
+            edgecnt += __builtin_popcountll(inline_words_[i]);
+        }
+        for (uint32_t i = 0; i < overflow_words_.size(); i++)
+        {
+            edgecnt += __builtin_popcountll(overflow_words_[i]);
+        }
+        return edgecnt;
+    }
+
+    bool EdgeBitset::empty() const
+    {
+        uint64_t tmp_bits = 0;
+        for (uint32_t i = 0; i < INLINE_WORDCNT; i++)
+        {
+            tmp_bits |= inline_words_[i];
+        }
+        for (uint32_t i = 0; i < overflow_words_.size(); i++)
+        {
+            tmp_bits |= overflow_words_[i];
+        }
+        return tmp_bits == 0;
+    }
+
+    uint32_t EdgeBitset::getEdgeIdxByRank(const uint32_t& rank) const
+    {
+        uint32_t remaining_rank = rank;
+        const uint32_t wordcnt = getWordcnt_();
+        for (uint32_t word_idx = 0; word_idx < wordcnt; word_idx++)
+        {
+            uint64_t tmp_word = getWord_(word_idx);
+            const uint32_t tmp_edgecnt = __builtin_popcountll(tmp_word);
+            if (remaining_rank >= tmp_edgecnt)
+            {
+                remaining_rank -= tmp_edgecnt;
+                continue;
+            }
+
+            // Clear the lowest remaining_rank bits
+            for (uint32_t i = 0; i < remaining_rank; i++)
+            {
+                tmp_word &= (tmp_word - 1);
+            }
+            return word_idx * WORD_BITCNT + __builtin_ctzll(tmp_word);
+        }
+
+        std::ostringstream oss;
+        oss << "rank " << rank << " should < edge bitset size " << size();
+        Util::dumpErrorMsg(kClassName, oss.str());
+        exit(1);
+        return END_EDGE_IDX;
+    }
+
+    void EdgeBitset::getEdgeIdxes(std::list<uint32_t>& edge_idxes) const
+    {
+        edge_idxes.clear();
+        for (const_iterator iter = begin(); iter != end(); iter++)
+        {
+            edge_idxes.push_back(*iter);
+        }
+        return;
+    }
+
+    EdgeBitset::const_iterator EdgeBitset::begin() const
+    {
+        return const_iterator(this, findNextEdgeIdx_(0));
+    }
+
+    EdgeBitset::const_iterator EdgeBitset::end() const
+    {
+        return const_iterator(this, END_EDGE_IDX);
+    }
+
+    EdgeBitset::const_iterator EdgeBitset::find(const uint32_t& edge_idx) const
+    {
+        if (isExist(edge_idx))
+        {
+            return const_iterator(this, edge_idx);
+        }
+        return end();
+    }
+
+    void EdgeBitset::clear()
+    {
+        memset(inline_words_, 0, sizeof(inline_words_));
+        overflow_words_.clear();
+        return;
+    }
+
+    bool EdgeBitset::insert(const uint32_t& edge_idx)
+    {
+        assert(edge_idx != END_EDGE_IDX);
+
+        const uint32_t word_idx = edge_idx / WORD_BITCNT;
+        if (word_idx >= getWordcnt_()) // Dynamic fallback for large edge index
+        {
+            overflow_words_.resize(word_idx + 1 - INLINE_WORDCNT, 0);
+        }
+
+        uint64_t& tmp_word_ref = getWordRef_(word_idx);
+        const uint64_t tmp_mask = (uint64_t)1 << (edge_idx % WORD_BITCNT);
+        const bool is_insert = ((tmp_word_ref & tmp_mask) == 0);
+        tmp_word_ref |= tmp_mask;
+        return is_insert;
+    }
+
+    bool EdgeBitset::erase(const uint32_t& edge_idx)
+    {
+        const uint32_t word_idx = edge_idx / WORD_BITCNT;
+        if (word_idx >= getWordcnt_())
+        {
+            return false;
+        }
+
+        uint64_t& tmp_word_ref = getWordRef_(word_idx);
+        const uint64_t tmp_mask = (uint64_t)1 << (edge_idx % WORD_BITCNT);
+        const bool is_erase = ((tmp_word_ref & tmp_mask) != 0);
+        tmp_word_ref &= ~tmp_mask;
+        return is_erase;
+    }
+
+    void EdgeBitset::unionWith(const EdgeBitset& other)
+    {
+        for (uint32_t i = 0; i < INLINE_WORDCNT; i++)
+        {
+            inline_words_[i] |= other.inline_words_[i];
+        }
+
+        if (overflow_words_.size() < other.overflow_words_.size())
+        {
+            overflow_words_.resize(other.overflow_words_.size(), 0);
+        }
+        for (uint32_t i = 0; i < other.overflow_words_.size(); i++)
+        {
+            overflow_words_[i] |= other.overflow_words_[i];
+        }
+        return;
+    }
+
+    void EdgeBitset::intersectWith(const EdgeBitset& other)
+    {
+        for (uint32_t i = 0; i < INLINE_WORDCNT; i++)
+        {
+            inline_words_[i] &= other.inline_words_[i];
+        }
+
+        if (overflow_words_.size() > other.overflow_words_.size())
+        {
+            overflow_words_.resize(other.overflow_words_.size()); // Edges beyond other MUST NOT be in the intersection
+        }
+        for (uint32_t i = 0; i < overflow_words_.size(); i++)
+        {
+            overflow_words_[i] &= other.overflow_words_[i];
+        }
+        return;
+    }
+
+    void EdgeBitset::differenceWith(const EdgeBitset& other)
+    {
+        for (uint32_t i = 0; i < INLINE_WORDCNT; i++)
+        {
+            inline_words_[i] &= ~other.inline_words_[i];
+        }
+
+        const uint32_t common_overflow_wordcnt = std::min(overflow_words_.size(), other.overflow_words_.size());
+        for (uint32_t i = 0; i < common_overflow_wordcnt; i++)
+        {
+            overflow_words_[i] &= ~other.overflow_words_[i];
+        }
+        return;
+    }
+
+    bool EdgeBitset::isSubsetOf(const EdgeBitset& other) const
+    {
+        uint64_t tmp_extra_bits = 0;
+        for (uint32_t i = 0; i < INLINE_WORDCNT; i++)
+        {
+            tmp_extra_bits |= (inline_words_[i] & ~other.inline_words_[i]);
+        }
+        for (uint32_t i = 0; i < overflow_words_.size(); i++)
+        {
+            const uint64_t tmp_other_word = (i < other.overflow_words_.size()) ? other.overflow_words_[i] : 0;
+            tmp_extra_bits |= (overflow_words_[i] & ~tmp_other_word);
+        }
+        return tmp_extra_bits == 0;
+    }
+
+    uint32_t EdgeBitset::getEdgeBitsetPayloadSize() const
+    {
+        return sizeof(uint16_t) + getBitmapBytecnt_();
+    }
+
+    uint32_t EdgeBitset::serialize(DynamicArray& msg_payload, const uint32_t& position) const
+    {
+        uint32_t size = position;
+        const uint32_t bitmap_bytecnt = getBitmapBytecnt_();
+        assert(bitmap_bytecnt <= UINT16_MAX);
+        const uint16_t tmp_bitmap_bytecnt = static_cast<uint16_t>(bitmap_bytecnt);
+        msg_payload.deserialize(size, (const char*)&tmp_bitmap_bytecnt, sizeof(uint16_t));
+        size += sizeof(uint16_t);
+
+        const uint32_t inline_bytecnt = std::min(bitmap_bytecnt, static_cast<uint32_t>(sizeof(inline_words_)));
+        if (inline_bytecnt > 0)
+        {
+            msg_payload.deserialize(size, (const char*)inline_words_, inline_bytecnt);
+            size += inline_bytecnt;
+        }
+        if (bitmap_bytecnt > inline_bytecnt)
+        {
+            const uint32_t overflow_bytecnt = bitmap_bytecnt - inline_bytecnt;
+            msg_payload.deserialize(size, (const char*)overflow_words_.data(), overflow_bytecnt);
+            size += overflow_bytecnt;
+        }
+        return size - position;
+    }
+
+    uint32_t EdgeBitset::deserialize(const DynamicArray& msg_payload, const uint32_t& position)
+    {
+        clear();
+
+        uint32_t size = position;
+        uint16_t tmp_bitmap_bytecnt = 0;
+        msg_payload.serialize(size, (char*)&tmp_bitmap_bytecnt, sizeof(uint16_t));
+        size += sizeof(uint16_t);
+        const uint32_t bitmap_bytecnt = tmp_bitmap_bytecnt;
+
+        const uint32_t inline_bytecnt = std::min(bitmap_bytecnt, static_cast<uint32_t>(sizeof(inline_words_)));
+        if (inline_bytecnt > 0)
+        {
+            msg_payload.serialize(size, (char*)inline_words_, inline_bytecnt);
+            size += inline_bytecnt;
+        }
+        if (bitmap_bytecnt > inline_bytecnt)
+        {
+            const uint32_t overflow_bytecnt = bitmap_bytecnt - inline_bytecnt;
+            overflow_words_.resize((overflow_bytecnt + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0);
+            msg_payload.serialize(size, (char*)overflow_words_.data(), overflow_bytecnt);
+            size += overflow_bytecnt;
+        }
+        return size - position;
+    }
+
+    std::string EdgeBitset::toString() const
+    {
+        std::ostringstream oss;
+        oss << "edge bitset size: " << size() << "; edges: [";
+        for (const_iterator iter = begin(); iter != end(); iter++)
+        {
+            if (iter != begin())
+            {
+                oss << ", ";
+            }
+            oss << *iter;
+        }
+        oss << "]";
+        return oss.str();
+    }
+
+    uint32_t EdgeBitset::getWordcnt_() const
+    {
+        return INLINE_WORDCNT + overflow_words_.size();
+    }
+
+    uint64_t EdgeBitset::getWord_(const uint32_t& word_idx) const
+    {
+        if (word_idx < INLINE_WORDCNT)
+        {
+            return inline_words_[word_idx];
+        }
+        assert(word_idx - INLINE_WORDCNT < overflow_words_.size());
+        return overflow_words_[word_idx - INLINE_WORDCNT];
+    }
+
+    uint64_t& EdgeBitset::getWordRef_(const uint32_t& word_idx)
+    {
+        if (word_idx < INLINE_WORDCNT)
+        {
+            return inline_words_[word_idx];
+        }
+        assert(word_idx - INLINE_WORDCNT < overflow_words_.size());
+        return overflow_words_[word_idx - INLINE_WORDCNT];
+    }
+
+    uint32_t EdgeBitset::getBitmapBytecnt_() const
+    {
+        uint32_t word_idx = getWordcnt_();
+        while (word_idx > 0) // Find the last non-zero word
+        {
+            const uint64_t tmp_word = getWord_(word_idx - 1);
+            if (tmp_word != 0)
+            {
+                const uint32_t largest_edge_idx = (word_idx - 1) * WORD_BITCNT + (WORD_BITCNT - 1 - __builtin_clzll(tmp_word));
+                return largest_edge_idx / 8 + 1;
+            }
+            word_idx--;
+        }
+        return 0;
+    }
+
+    uint32_t EdgeBitset::findNextEdgeIdx_(const uint32_t& start_edge_idx) const
+    {
+        const uint32_t wordcnt = getWordcnt_();
+        uint32_t word_idx = start_edge_idx / WORD_BITCNT;
+        if (word_idx >= wordcnt)
+        {
+            return END_EDGE_IDX;
+        }
+
+        uint64_t tmp_word = getWord_(word_idx) & (~(uint64_t)0 << (start_edge_idx % WORD_BITCNT)); // Ignore edges before start_edge_idx
+        while (true)
+        {
+            if (tmp_word != 0)
+            {
+                return word_idx * WORD_BITCNT + __builtin_ctzll(tmp_word);
+            }
+
+            word_idx++;
+            if (word_idx >= wordcnt)
+            {
+                break;
+            }
+            tmp_word = getWord_(word_idx);
+        }
+        return END_EDGE_IDX;
+    }
+}
@@ -0,0 +1,97 @@
+/*
+ * EdgeBitset: a compact set of edge indexes in bitmap form, used by Edgeset and DirinfoSet for placement and victim synchronization.
+ *
+ * NOTE: the first INLINE_EDGECNT edges are stored inline without heap allocation (enough for the number of edge nodes in our evaluation), while larger edge indexes fall back to dynamic words; size is calculated by popcount, and union/intersection/difference are performed word by word (64 edges per operation; the fixed-length loop over inline words is vectorized by the compiler).
+ *
+ * NOTE: EdgeBitset is serialized as a compact bitmap (bytecnt + bitmap bytes trimmed after the largest edge index), where we follow the host byte order as other fields in messages.
+ */
+
+#ifndef EDGE_BITSET_H
+#define EDGE_BITSET_H
+
+#include <cstddef> // ptrdiff_t
+#include <iterator> // std::forward_iterator_tag
+#include <list>
+#include <string>
+#include <vector>
+
+#include "common/dynamic_array.h"
+
+namespace covered
+{
+    class EdgeBitset
+    {
+    public:
+        static const uint32_t INLINE_EDGECNT;
+
+        // Iterate edge indexes in ascending order
+        class const_iterator
+        {
+        public:
+            typedef std::forward_iterator_tag iterator_category;
+            typedef uint32_t value_type;
+            typedef ptrdiff_t difference_type;
+            typedef const uint32_t* pointer;
+            typedef uint32_t reference;
+
+            const_iterator();
+            const_iterator(const EdgeBitset* edge_bitset_ptr, const uint32_t& edge_idx);
+
+            uint32_t operator*() const;
+            const_iterator& operator++();
+            const_iterator operator++(int);
+            bool operator==(const const_iterator& other) const;
+            bool operator!=(const const_iterator& other) const;
+        private:
+            const EdgeBitset* edge_bitset_ptr_;
+            uint32_t edge_idx_; // END_EDGE_IDX for end()
+        };
+
+        EdgeBitset();
+        ~EdgeBitset();
+
+        bool isExist(const uint32_t& edge_idx) const;
+        uint32_t size() const;
+        bool empty() const;
+        uint32_t getEdgeIdxByRank(const uint32_t& rank) const; // Get the (rank+1)-th smallest edge index (rank MUST < size())
+        void getEdgeIdxes(std::list<uint32_t>& edge_idxes) const;
+
+        const_iterator begin() const;
+        const_iterator end() const;
+        const_iterator find(const uint32_t& edge_idx) const;
+
+        void clear();
+        bool insert(const uint32_t& edge_idx); // Return if edge_idx is newly inserted
+        bool erase(const uint32_t& edge_idx); // Return if edge_idx is erased
+
+        // Set operations in place
+        void unionWith(const EdgeBitset& other);
+        void intersectWith(const EdgeBitset& other);
+        void differenceWith(const EdgeBitset& other); // Remove edges of other
+        bool isSubsetOf(const EdgeBitset& other) const;
+
+        uint32_t getEdgeBitsetPayloadSize() const;
+        uint32_t serialize(DynamicArray& msg_payload, const uint32_t& position) const;
+        uint32_t deserialize(const DynamicArray& msg_payload, const uint32_t& position);
+
+        std::string toString() const;
+    private:
+        static const std::string kClassName;
+
+        static const uint32_t INLINE_WORDCNT;
+        static const uint32_t WORD_BITCNT;
+        static const uint32_t END_EDGE_IDX;
+
+        uint32_t getWordcnt_() const;
+        uint64_t getWord_(const uint32_t& word_idx) const;
+        uint64_t& getWordRef_(const uint32_t& word_idx);
+        uint32_t getBitmapBytecnt_() const; // # of bytes up to the largest edge index (0 if empty)
+
+        uint32_t findNextEdgeIdx_(const uint32_t& start_edge_idx) const; // Return END_EDGE_IDX if NOT found
+
+        uint64_t inline_words_[4]; // NOTE: MUST be consistent with INLINE_WORDCNT
+        std::vector<uint64_t> overflow_words_; // For edge indexes >= INLINE_EDGECNT (empty in most cases)
+    };
+}
+
+#endif
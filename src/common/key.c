@@ -4,49 +4,81 @@
 #include <assert.h>
 #include <cstring> // memcpy
 #include <fstream> // std::fstream
+#include <utility> // std::move
+
+#include "MurmurHash3.h"
 
 namespace covered
 {
     const std::string Key::kClassName("Key");
+    const uint32_t Key::INLINE_KEYSTR_CAPACITY;
 
-    Key::Key()
+    Key::Key() : keyhash_(0), keylen_(0)
     {
-        keystr_ = "";
+        assign_(NULL, 0);
     }
 
-    Key::Key(const std::string& keystr)
+    Key::Key(const std::string& keystr) : keyhash_(0), keylen_(0)
     {
-        keystr_ = keystr;
+        assign_(keystr.data(), keystr.length());
     }
 
-    Key::~Key() {}
+    Key::Key(const char* keybytes, const uint32_t& keylen) : keyhash_(0), keylen_(0)
+    {
+        assign_(keybytes, keylen);
+    }
+
+    Key::Key(const Key& other) : keyhash_(0), keylen_(0)
+    {
+        *this = other;
+    }
+
+    Key::Key(Key&& other) noexcept : keyhash_(0), keylen_(0)
+    {
+        *this = std::move(other);
+    }
+
+    Key::~Key()
+    {
+        releaseKeyBytes_();
+    }
 
     uint32_t Key::getKeyLength() const
     {
-        return keystr_.length();
+        return keylen_;
     }
 
     std::string Key::getKeystr() const
     {
-        return keystr_;
+        return std::string(getKeyBytes_(), keylen_);
+    }
+
+    std::string_view Key::getKeystrView() const
+    {
+        return std::string_view(getKeyBytes_(), keylen_);
+    }
+
+    uint64_t Key::getKeyHash() const
+    {
+        return keyhash_;
     }
 
     std::string Key::getKeyIntstr() const
     {
-        const uint32_t keylen = keystr_.length();
+        const uint32_t keylen = keylen_;
         //assert(keylen == 4 || keylen == 8);
 
         std::string key_intstr = "";
         if (keylen == 4)
         {
             int32_t keyint = 0;
-            memcpy(&keyint, keystr_.c_str(), sizeof(int32_t));
+            memcpy(&keyint, getKeyBytes_(), sizeof(int32_t));
             key_intstr = std::to_string(keyint);
         }
         else if (keylen == 8)
         {
             int64_t keyint = 0;
-            memcpy(&keyint, keystr_.c_str(), sizeof(int64_t));
+            memcpy(&keyint, getKeyBytes_(), sizeof(int64_t));
             key_intstr = std::to_string(keyint);
         }
 
@@ -58,25 +90,25 @@ namespace covered
         const std::string key_intstr = getKeyIntstr();
         if (key_intstr != "")
         {
-            return keystr_ + " (" + key_intstr + ")";
+            return getKeystr() + " (" + key_intstr + ")";
         }
-        return keystr_;
+        return getKeystr();
     }
     
     uint32_t Key::getKeyPayloadSize() const
     {
         // key size + key
-        return sizeof(uint32_t) + keystr_.length();
+        return sizeof(uint32_t) + keylen_;
     }
 
     uint32_t Key::serialize(DynamicArray& msg_payload, const uint32_t& position) const
     {
         uint32_t size = position;
-        uint32_t bigendian_keysize = htonl(keystr_.length());
+        uint32_t bigendian_keysize = htonl(keylen_);
         msg_payload.deserialize(size, (const char*)&bigendian_keysize, sizeof(uint32_t));
         size += sizeof(uint32_t);
-        msg_payload.deserialize(size, (const char*)(keystr_.data()), keystr_.length());
-        size += keystr_.length();
+        msg_payload.deserialize(size, getKeyBytes_(), keylen_);
+        size += keylen_;
         return size - position;
     }
 
@@ -85,11 +117,11 @@ namespace covered
         assert(fs_ptr != NULL);
 
         uint32_t size = 0;
-        uint32_t bigendian_keysize = htonl(keystr_.length());
+        uint32_t bigendian_keysize = htonl(keylen_);
         fs_ptr->write((const char*)&bigendian_keysize, sizeof(uint32_t));
         size += sizeof(uint32_t);
-        fs_ptr->write((const char*)keystr_.data(), keystr_.length());
-        size += keystr_.length();
+        fs_ptr->write(getKeyBytes_(), keylen_);
+        size += keylen_;
         return size;
     }
 
@@ -100,9 +132,9 @@ namespace covered
         msg_payload.serialize(size, (char *)&bigendian_keysize, sizeof(uint32_t));
         uint32_t keysize = ntohl(bigendian_keysize);
         size += sizeof(uint32_t);
-        DynamicArray keybytes(keysize);
-        msg_payload.arraycpy(size, keybytes, 0, keysize);
-        keystr_ = std::string(keybytes.getBytesConstRef().data(), keysize);
+        char* keybytes = allocateKeyBytes_(keysize); // Deserialize into key bytes directly w/o temporary copies
+        msg_payload.serialize(size, keybytes, keysize);
+        keyhash_ = computeKeyHash_(keybytes, keysize);
         size += keysize;
         return size - position;
     }
@@ -116,9 +148,9 @@ namespace covered
         fs_ptr->read((char*)&bitendian_keysize, sizeof(uint32_t));
         uint32_t keysize = ntohl(bitendian_keysize);
         size += sizeof(uint32_t);
-        DynamicArray keybytes(keysize);
-        fs_ptr->read(keybytes.getBytesRef().data(), keysize);
-        keystr_ = std::string(keybytes.getBytesRef().data(), keysize);
+        char* keybytes = allocateKeyBytes_(keysize); // Deserialize into key bytes directly w/o temporary copies
+        fs_ptr->read(keybytes, keysize);
+        keyhash_ = computeKeyHash_(keybytes, keysize);
         size += keysize;
         return size;
     }
@@ -126,7 +158,7 @@ namespace covered
     bool Key::operator<(const Key& other) const
     {
         bool is_smaller = false;
-        if (keystr_.compare(other.keystr_) < 0) // Current keystr length is smaller than other, or the first unmatched char is smaller than other
+        if (getKeystrView().compare(other.getKeystrView()) < 0) // Current keystr length is smaller than other, or the first unmatched char is smaller than other
         {
             is_smaller = true;
         }
@@ -135,20 +167,105 @@ namespace covered
 
     bool Key::operator==(const Key& other) const
     {
-        return keystr_ == other.keystr_;
+        // NOTE: compare precomputed hash first to avoid byte comparison for most unmatched keys
+        return keyhash_ == other.keyhash_ && keylen_ == other.keylen_ && memcmp(getKeyBytes_(), other.getKeyBytes_(), keylen_) == 0;
     }
 
     bool Key::operator!=(const Key& other) const
     {
-        return keystr_ != other.keystr_;
+        return !(*this == other);
     }
 
     const Key& Key::operator=(const Key& other)
     {
-        keystr_ = other.keystr_; // Deep copy
+        if (this != &other)
+        {
+            // Deep copy
+            char* keybytes = allocateKeyBytes_(other.keylen_);
+            memcpy(keybytes, other.getKeyBytes_(), other.keylen_);
+            keyhash_ = other.keyhash_; // NOT re-hash
+        }
+        return *this;
+    }
+
+    const Key& Key::operator=(Key&& other) noexcept
+    {
+        if (this != &other)
+        {
+            releaseKeyBytes_();
+
+            keyhash_ = other.keyhash_;
+            keylen_ = other.keylen_;
+            if (other.keylen_ <= INLINE_KEYSTR_CAPACITY)
+            {
+                memcpy(inline_keybytes_, other.inline_keybytes_, other.keylen_);
+            }
+            else
+            {
+                heap_keybytes_ = other.heap_keybytes_; // Steal heap bytes
+            }
+
+            // Reset other as an empty key
+            other.keylen_ = 0;
+            other.keyhash_ = computeKeyHash_(NULL, 0);
+        }
         return *this;
     }
 
+    uint64_t Key::computeKeyHash_(const char* keybytes, const uint32_t& keylen)
+    {
+        // NOTE: use the lower 64 bits of MurmurHash3 x64 128-bit hash
+        uint64_t hash_values[2] = {0, 0};
+        MurmurHash3_x64_128((const void*)keybytes, static_cast<int>(keylen), 0, (void*)hash_values);
+        return hash_values[0];
+    }
+
+    const char* Key::getKeyBytes_() const
+    {
+        if (keylen_ <= INLINE_KEYSTR_CAPACITY)
+        {
+            return inline_keybytes_;
+        }
+        return heap_keybytes_;
+    }
+
+    char* Key::allocateKeyBytes_(const uint32_t& keylen)
+    {
+        releaseKeyBytes_();
+
+        keylen_ = keylen;
+        if (keylen <= INLINE_KEYSTR_CAPACITY)
+        {
+            return inline_keybytes_;
+        }
+        heap_keybytes_ = new char[keylen];
+        assert(heap_keybytes_ != NULL);
+        return heap_keybytes_;
+    }
+
+    void Key::releaseKeyBytes_()
+    {
+        if (keylen_ > INLINE_KEYSTR_CAPACITY)
+        {
+            assert(heap_keybytes_ != NULL);
+            delete[] heap_keybytes_;
+            heap_keybytes_ = NULL;
+        }
+        keylen_ = 0;
+        return;
+    }
+
+    void Key::assign_(const char* keybytes, const uint32_t& keylen)
+    {
+        char* tmp_keybytes = allocateKeyBytes_(keylen);
+        if (keylen > 0)
+        {
+            memcpy(tmp_keybytes, keybytes, keylen);
+        }
+        keyhash_ = computeKeyHash_(tmp_keybytes, keylen);
+        return;
+    }
+
     bool KeyHasher::equal(const Key& keya, const Key& keyb) const
     {
         return keya == keyb;
@@ -156,11 +273,11 @@ namespace covered
 
     size_t KeyHasher::hash(const Key& key) const
     {
-        return std::hash<std::string>{}(key.getKeystr());
+        return static_cast<size_t>(key.getKeyHash());
     }
 
     size_t KeyHasher::operator()(const Key& key) const
     {
-        return std::hash<std::string>{}(key.getKeystr());
+        return static_cast<size_t>(key.getKeyHash());
     }
-}
\ No newline at end of file
+}
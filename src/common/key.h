@@ -1,5 +1,9 @@
 /*
  * Key: a general key with variable length to encapsulate underlying workload generators.
+ *
+ * NOTE: Key precomputes a 64-bit hash (MurmurHash3 x64 w/ seed 0) once on construction/deserialization, which is reused by KeyHasher (std::unordered_map), HashWrapperBase (DHT, per-key rwlocks, and cache server partitioning), and so on, instead of copying and re-hashing the key string for each lookup.
+ *
+ * NOTE: keys no longer than INLINE_KEYSTR_CAPACITY bytes are stored inline w/o heap allocation.
  * 
  * By Siyuan Sheng (2023.04.18).
  */
@@ -9,6 +13,7 @@
 
 #include <list>
 #include <string>
+#include <string_view>
 
 #include "common/dynamic_array.h"
 
@@ -19,10 +24,15 @@ namespace covered
     public:
         Key();
         Key(const std::string& keystr);
+        Key(const char* keybytes, const uint32_t& keylen);
+        Key(const Key& other);
+        Key(Key&& other) noexcept;
         ~Key();
 
         uint32_t getKeyLength() const;
-        std::string getKeystr() const; // Used for network and disk I/O
+        std::string getKeystr() const; // Deep copy (ONLY used for third-party libraries requiring std::string and debug info)
+        std::string_view getKeystrView() const; // Zero copy (valid until the key is modified or destroyed)
+        uint64_t getKeyHash() const; // Precomputed 64-bit hash
 
         std::string getKeyIntstr() const; // Used to dump debug info if key is an integer
         std::string getKeyDebugstr() const; // Used to dump debug info (keystr + key intstr if not empty)
@@ -37,13 +47,28 @@ namespace covered
         bool operator==(const Key& other) const; // To be used as key in std::unordered_map
         bool operator!=(const Key& other) const; // To be used as key in TommyDS
         const Key& operator=(const Key& other);
+        const Key& operator=(Key&& other) noexcept;
     private:
         static const std::string kClassName;
+        static const uint32_t INLINE_KEYSTR_CAPACITY = 24; // NOTE: NOT larger than the union of inline_keybytes_ and heap_keybytes_ to keep sizeof(Key) as 40 bytes
 
-        std::string keystr_;
+        static uint64_t computeKeyHash_(const char* keybytes, const uint32_t& keylen);
+
+        const char* getKeyBytes_() const;
+        char* allocateKeyBytes_(const uint32_t& keylen); // Release original bytes and allocate writable bytes for keylen (NOT update keyhash_)
+        void releaseKeyBytes_();
+        void assign_(const char* keybytes, const uint32_t& keylen); // Deep copy and compute keyhash_
+
+        uint64_t keyhash_;
+        uint32_t keylen_;
+        union
+        {
+            char inline_keybytes_[INLINE_KEYSTR_CAPACITY]; // Used if keylen_ <= INLINE_KEYSTR_CAPACITY
+            char* heap_keybytes_; // Used if keylen_ > INLINE_KEYSTR_CAPACITY
+        };
     };
 
-    // To be used by key in std::unordered_map
+    // To be used by key in std::unordered_map (NOTE: return the precomputed key hash w/o hashing key string again)
     class KeyHasher
     {
     public:
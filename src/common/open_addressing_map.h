@@ -0,0 +1,99 @@
+/*
+ * OpenAddressingMap: a flat hash map with open addressing (linear probing) for small key-value pairs (NOT thread safe).
+ *
+ * NOTE: unlike std::unordered_map, key-value pairs are stored in a contiguous slot array without a heap node per pair, and each slot has a 1-byte tag of key hash to skip most key comparisons during probing.
+ *
+ * NOTE: insert() may rehash and erase() uses backward-shift deletion (i.e., NO tombstones), so both invalidate iterators; ONLY use the map if you erase by the iterator just returned by find() (e.g., in ConcurrentHashtable).
+ */
+
+#ifndef OPEN_ADDRESSING_MAP_H
+#define OPEN_ADDRESSING_MAP_H
+
+#include <string>
+#include <utility> // std::pair
+#include <vector>
+
+namespace covered
+{
+    // NOTE: class K and V must support default constructor and move assignment; Hasher must be default-constructible with operator()(const K&)
+    template<class K, class V, class Hasher>
+    class OpenAddressingMap
+    {
+    public:
+        typedef std::pair<K, V> value_type;
+
+        class iterator
+        {
+        public:
+            iterator(OpenAddressingMap* map_ptr, const uint32_t& slot_idx);
+
+            value_type& operator*() const;
+            value_type* operator->() const;
+            iterator& operator++();
+            iterator operator++(int);
+            bool operator==(const iterator& other) const;
+            bool operator!=(const iterator& other) const;
+        private:
+            friend class OpenAddressingMap;
+
+            OpenAddressingMap* map_ptr_;
+            uint32_t slot_idx_; // capacity_ for end()
+        };
+
+        class const_iterator
+        {
+        public:
+            const_iterator(const OpenAddressingMap* map_ptr, const uint32_t& slot_idx);
+
+            const value_type& operator*() const;
+            const value_type* operator->() const;
+            const_iterator& operator++();
+            const_iterator operator++(int);
+            bool operator==(const const_iterator& other) const;
+            bool operator!=(const const_iterator& other) const;
+        private:
+            const OpenAddressingMap* map_ptr_;
+            uint32_t slot_idx_; // capacity_ for end()
+        };
+
+        OpenAddressingMap();
+        ~OpenAddressingMap();
+
+        uint32_t size() const;
+        bool empty() const;
+
+        iterator find(const K& key);
+        const_iterator find(const K& key) const;
+        iterator begin();
+        iterator end();
+        const_iterator begin() const;
+        const_iterator end() const;
+
+        std::pair<iterator, bool> insert(const value_type& kvpair); // NOT update value if key exists (the same as std::unordered_map)
+        void erase(iterator iter);
+        void clear();
+    private:
+        static const std::string kClassName;
+
+        static const uint32_t MIN_CAPACITY; // MUST be power of 2
+        static const uint32_t MAX_LOAD_FACTOR_NUMERATOR;
+        static const uint32_t MAX_LOAD_FACTOR_DENOMINATOR;
+        static const uint8_t EMPTY_TAG;
+
+        static uint64_t getHash_(const K& key);
+        static uint8_t getTag_(const uint64_t& hash); // NOTE: NEVER return EMPTY_TAG
+        uint32_t getHomeSlotIdx_(const uint64_t& hash) const;
+
+        uint32_t findSlotIdx_(const K& key) const; // Return capacity_ if NOT found
+        uint32_t findNextOccupiedSlotIdx_(const uint32_t& start_slot_idx) const; // Return capacity_ if NOT found
+        void rehash_(const uint32_t& new_capacity);
+
+        uint32_t capacity_; // Power of 2 (0 before the first insertion)
+        uint32_t capacity_bitcnt_; // log2(capacity_)
+        uint32_t size_;
+        std::vector<uint8_t> tags_; // EMPTY_TAG for empty slot
+        std::vector<value_type> slots_;
+    };
+}
+
+#endif
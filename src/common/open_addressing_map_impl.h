@@ -0,0 +1,342 @@
+#ifndef OPEN_ADDRESSING_MAP_IMPL_H
+#define OPEN_ADDRESSING_MAP_IMPL_H
+
+#include "common/open_addressing_map.h"
+
+#include <assert.h>
+
+namespace covered
+{
+    template<class K, class V, class Hasher>
+    const std::string OpenAddressingMap<K, V, Hasher>::kClassName("OpenAddressingMap");
+
+    template<class K, class V, class Hasher>
+    const uint32_t OpenAddressingMap<K, V, Hasher>::MIN_CAPACITY = 8;
+
+    template<class K, class V, class Hasher>
+    const uint32_t OpenAddressingMap<K, V, Hasher>::MAX_LOAD_FACTOR_NUMERATOR = 3;
+
+    template<class K, class V, class Hasher>
+    const uint32_t OpenAddressingMap<K, V, Hasher>::MAX_LOAD_FACTOR_DENOMINATOR = 4;
+
+    template<class K, class V, class Hasher>
+    const uint8_t OpenAddressingMap<K, V, Hasher>::EMPTY_TAG = 0;
+
+    // (1) iterator and const_iterator
+
+    template<class K, class V, class Hasher>
+    OpenAddressingMap<K, V, Hasher>::iterator::iterator(OpenAddressingMap* map_ptr, const uint32_t& slot_idx) : map_ptr_(map_ptr), slot_idx_(slot_idx) {}
+
+    template<class K, class V, class Hasher>
+    typename OpenAddressingMap<K, V, Hasher>::value_type& OpenAddressingMap<K, V, Hasher>::iterator::operator*() const
+    {
+        assert(slot_idx_ < map_ptr_->capacity_);
+        return map_ptr_->slots_[slot_idx_];
+    }
+
+    template<class K, class V, class Hasher>
+    typename OpenAddressingMap<K, V, Hasher>::value_type* OpenAddressingMap<K, V, Hasher>::iterator::operator->() const
+    {
+        assert(slot_idx_ < map_ptr_->capacity_);
+        return &(map_ptr_->slots_[slot_idx_]);
+    }
+
+    template<class K, class V, class Hasher>
+    typename OpenAddressingMap<K, V, Hasher>::iterator& OpenAddressingMap<K, V, Hasher>::iterator::operator++()
+    {
+        slot_idx_ = map_ptr_->findNextOccupiedSlotIdx_(slot_idx_ + 1);
+        return *this;
+    }
+
+    template<class K, class V, class Hasher>
+    typename OpenAddressingMap<K, V, Hasher>::iterator OpenAddressingMap<K, V, Hasher>::iterator::operator++(int)
+    {
+        iterator tmp_iter = *this;
+        ++(*this);
+        return tmp_iter;
+    }
+
+    template<class K, class V, class Hasher>
+    bool OpenAddressingMap<K, V, Hasher>::iterator::operator==(const iterator& other) const
+    {
+        return (map_ptr_ == other.map_ptr_) && (slot_idx_ == other.slot_idx_);
+    }
+
+    template<class K, class V, class Hasher>
+    bool OpenAddressingMap<K, V, Hasher>::iterator::operator!=(const iterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    template<class K, class V, class Hasher>
+    OpenAddressingMap<K, V, Hasher>::const_iterator::const_iterator(const OpenAddressingMap* map_ptr, const uint32_t& slot_idx) : map_ptr_(map_ptr), slot_idx_(slot_idx) {}
+
+    template<class K, class V, class Hasher>
+    const typename OpenAddressingMap<K, V, Hasher>::value_type& OpenAddressingMap<K, V, Hasher>::const_iterator::operator*() const
+    {
+        assert(slot_idx_ < map_ptr_->capacity_);
+        return map_ptr_->slots_[slot_idx_];
+    }
+
+    template<class K, class V, class Hasher>
+    const typename OpenAddressingMap<K, V, Hasher>::value_type* OpenAddressingMap<K, V, Hasher>::const_iterator::operator->() const
+    {
+        assert(slot_idx_ < map_ptr_->capacity_);
+        return &(map_ptr_->slots_[slot_idx_]);
+    }
+
+    template<class K, class V, class Hasher>
+    typename OpenAddressingMap<K, V, Hasher>::const_iterator& OpenAddressingMap<K, V, Hasher>::const_iterator::operator++()
+    {
+        slot_idx_ = map_ptr_->findNextOccupiedSlotIdx_(slot_idx_ + 1);
+        return *this;
+    }
+
+    template<class K, class V, class Hasher>
+    typename OpenAddressingMap<K, V, Hasher>::const_iterator OpenAddressingMap<K, V, Hasher>::const_iterator::operator++(int)
+    {
+        const_iterator tmp_iter = *this;
+        ++(*this);
+        return tmp_iter;
+    }
+
+    template<class K, class V, class Hasher>
+    bool OpenAddressingMap<K, V, Hasher>::const_iterator::operator==(const const_iterator& other) const
+    {
+        return (map_ptr_ == other.map_ptr_) && (slot_idx_ == other.slot_idx_);
+    }
+
+    template<class K, class V, class Hasher>
+    bool OpenAddressingMap<K, V, Hasher>::const_iterator::operator!=(const const_iterator& other) const
+    {
+        return !(*this == other);
+    }
+
+    // (2) OpenAddressingMap
+
+    template<class K, class V, class Hasher>
+    OpenAddressingMap<K, V, Hasher>::OpenAddressingMap() : capacity_(0), capacity_bitcnt_(0), size_(0), tags_(), slots_()
+    {
+        // NOTE: NOT allocate slots until the first insertion, as ConcurrentHashtable creates a map for each per-key rwlock
+    }
+
+    template<class K, class V, class Hasher>
+    OpenAddressingMap<K, V, Hasher>::~OpenAddressingMap() {}
+
+    template<class K, class V, class Hasher>
+    uint32_t OpenAddressingMap<K, V, Hasher>::size() const
+    {
+        return size_;
+    }
+
+    template<class K, class V, class Hasher>
+    bool OpenAddressingMap<K, V, Hasher>::empty() const
+    {
+        return size_ == 0;
+    }
+
+    template<class K, class V, class Hasher>
+    typename OpenAddressingMap<K, V, Hasher>::iterator OpenAddressingMap<K, V, Hasher>::find(const K& key)
+    {
+        return iterator(this, findSlotIdx_(key));
+    }
+
+    template<class K, class V, class Hasher>
+    typename OpenAddressingMap<K, V, Hasher>::const_iterator OpenAddressingMap<K, V, Hasher>::find(const K& key) const
+    {
+        return const_iterator(this, findSlotIdx_(key));
+    }
+
+    template<class K, class V, class Hasher>
+    typename OpenAddressingMap<K, V, Hasher>::iterator OpenAddressingMap<K, V, Hasher>::begin()
+    {
+        return iterator(this, findNextOccupiedSlotIdx_(0));
+    }
+
+    template<class K, class V, class Hasher>
+    typename OpenAddressingMap<K, V, Hasher>::iterator OpenAddressingMap<K, V, Hasher>::end()
+    {
+        return iterator(this, capacity_);
+    }
+
+    template<class K, class V, class Hasher>
+    typename OpenAddressingMap<K, V, Hasher>::const_iterator OpenAddressingMap<K, V, Hasher>::begin() const
+    {
+        return const_iterator(this, findNextOccupiedSlotIdx_(0));
+    }
+
+    template<class K, class V, class Hasher>
+    typename OpenAddressingMap<K, V, Hasher>::const_iterator OpenAddressingMap<K, V, Hasher>::end() const
+    {
+        return const_iterator(this, capacity_);
+    }
+
+    template<class K, class V, class Hasher>
+    std::pair<typename OpenAddressingMap<K, V, Hasher>::iterator, bool> OpenAddressingMap<K, V, Hasher>::insert(const value_type& kvpair)
+    {
+        // Grow before probing to keep probe sequences short
+        if (static_cast<uint64_t>(size_ + 1) * MAX_LOAD_FACTOR_DENOMINATOR > static_cast<uint64_t>(capacity_) * MAX_LOAD_FACTOR_NUMERATOR)
+        {
+            rehash_((capacity_ == 0) ? MIN_CAPACITY : capacity_ * 2);
+        }
+
+        const uint64_t hash = getHash_(kvpair.first);
+        const uint8_t tag = getTag_(hash);
+        const uint32_t capacity_mask = capacity_ - 1;
+        uint32_t slot_idx = getHomeSlotIdx_(hash);
+        while (tags_[slot_idx] != EMPTY_TAG)
+        {
+            if (tags_[slot_idx] == tag && slots_[slot_idx].first == kvpair.first) // Key already exists
+            {
+                return std::pair<iterator, bool>(iterator(this, slot_idx), false);
+            }
+            slot_idx = (slot_idx + 1) & capacity_mask;
+        }
+
+        tags_[slot_idx] = tag;
+        slots_[slot_idx] = kvpair;
+        size_++;
+        return std::pair<iterator, bool>(iterator(this, slot_idx), true);
+    }
+
+    template<class K, class V, class Hasher>
+    void OpenAddressingMap<K, V, Hasher>::erase(iterator iter)
+    {
+        assert(iter.map_ptr_ == this);
+        assert(iter.slot_idx_ < capacity_);
+        assert(tags_[iter.slot_idx_] != EMPTY_TAG);
+
+        const uint32_t capacity_mask = capacity_ - 1;
+        uint32_t hole_slot_idx = iter.slot_idx_;
+        tags_[hole_slot_idx] = EMPTY_TAG;
+        slots_[hole_slot_idx] = value_type(); // Release resources of the erased pair (e.g., heap key bytes)
+        size_--;
+
+        // Backward-shift deletion: move subsequent pairs of the same cluster into the hole if their home slots are NOT within (hole, current]
+        uint32_t cur_slot_idx = (hole_slot_idx + 1) & capacity_mask;
+        while (tags_[cur_slot_idx] != EMPTY_TAG)
+        {
+            const uint32_t home_slot_idx = getHomeSlotIdx_(getHash_(slots_[cur_slot_idx].first));
+            const uint32_t cur_distance = (cur_slot_idx - home_slot_idx) & capacity_mask;
+            const uint32_t hole_distance = (cur_slot_idx - hole_slot_idx) & capacity_mask;
+            if (cur_distance >= hole_distance) // The pair can be probed from its home slot via the hole
+            {
+                tags_[hole_slot_idx] = tags_[cur_slot_idx];
+                slots_[hole_slot_idx] = std::move(slots_[cur_slot_idx]);
+                tags_[cur_slot_idx] = EMPTY_TAG;
+                slots_[cur_slot_idx] = value_type();
+                hole_slot_idx = cur_slot_idx;
+            }
+            cur_slot_idx = (cur_slot_idx + 1) & capacity_mask;
+        }
+        return;
+    }
+
+    template<class K, class V, class Hasher>
+    void OpenAddressingMap<K, V, Hasher>::clear()
+    {
+        capacity_ = 0;
+        capacity_bitcnt_ = 0;
+        size_ = 0;
+        std::vector<uint8_t>().swap(tags_);
+        std::vector<value_type>().swap(slots_);
+        return;
+    }
+
+    template<class K, class V, class Hasher>
+    uint64_t OpenAddressingMap<K, V, Hasher>::getHash_(const K& key)
+    {
+        return static_cast<uint64_t>(Hasher()(key));
+    }
+
+    template<class K, class V, class Hasher>
+    uint8_t OpenAddressingMap<K, V, Hasher>::getTag_(const uint64_t& hash)
+    {
+        return static_cast<uint8_t>(hash >> 57) | 0x80; // Highest 7 bits (NOT overlap with bits of home slot for small capacity)
+    }
+
+    template<class K, class V, class Hasher>
+    uint32_t OpenAddressingMap<K, V, Hasher>::getHomeSlotIdx_(const uint64_t& hash) const
+    {
+        assert(capacity_bitcnt_ > 0);
+
+        // NOTE: use Fibonacci hashing instead of the lowest bits, as keys in the same map of ConcurrentHashtable share the same hash value modulo the number of per-key rwlocks
+        return static_cast<uint32_t>((hash * 11400714819323198485ull) >> (64 - capacity_bitcnt_));
+    }
+
+    template<class K, class V, class Hasher>
+    uint32_t OpenAddressingMap<K, V, Hasher>::findSlotIdx_(const K& key) const
+    {
+        if (size_ == 0)
+        {
+            return capacity_;
+        }
+
+        const uint64_t hash = getHash_(key);
+        const uint8_t tag = getTag_(hash);
+        const uint32_t capacity_mask = capacity_ - 1;
+        uint32_t slot_idx = getHomeSlotIdx_(hash);
+        while (tags_[slot_idx] != EMPTY_TAG) // NOTE: MUST terminate due to MAX_LOAD_FACTOR < 1
+        {
+            if (tags_[slot_idx] == tag && slots_[slot_idx].first == key)
+            {
+                return slot_idx;
+            }
+            slot_idx = (slot_idx + 1) & capacity_mask;
+        }
+        return capacity_;
+    }
+
+    template<class K, class V, class Hasher>
+    uint32_t OpenAddressingMap<K, V, Hasher>::findNextOccupiedSlotIdx_(const uint32_t& start_slot_idx) const
+    {
+        uint32_t slot_idx = start_slot_idx;
+        while (slot_idx < capacity_ && tags_[slot_idx] == EMPTY_TAG)
+        {
+            slot_idx++;
+        }
+        return slot_idx;
+    }
+
+    template<class K, class V, class Hasher>
+    void OpenAddressingMap<K, V, Hasher>::rehash_(const uint32_t& new_capacity)
+    {
+        assert(new_capacity >= MIN_CAPACITY);
+        assert((new_capacity & (new_capacity - 1)) == 0); // Power of 2
+
+        std::vector<uint8_t> old_tags;
+        old_tags.swap(tags_);
+        std::vector<value_type> old_slots;
+        old_slots.swap(slots_);
+
+        capacity_ = new_capacity;
+        capacity_bitcnt_ = 0;
+        while ((static_cast<uint32_t>(1) << capacity_bitcnt_) < capacity_)
+        {
+            capacity_bitcnt_++;
+        }
+        tags_.resize(capacity_, EMPTY_TAG);
+        slots_.resize(capacity_);
+
+        // Re-insert existing pairs (NO duplicate keys)
+        const uint32_t capacity_mask = capacity_ - 1;
+        for (uint32_t old_slot_idx = 0; old_slot_idx < old_tags.size(); old_slot_idx++)
+        {
+            if (old_tags[old_slot_idx] == EMPTY_TAG)
+            {
+                continue;
+            }
+
+            uint32_t slot_idx = getHomeSlotIdx_(getHash_(old_slots[old_slot_idx].first));
+            while (tags_[slot_idx] != EMPTY_TAG)
+            {
+                slot_idx = (slot_idx + 1) & capacity_mask;
+            }
+            tags_[slot_idx] = old_tags[old_slot_idx];
+            slots_[slot_idx] = std::move(old_slots[old_slot_idx]);
+        }
+        return;
+    }
+}
+
+#endif
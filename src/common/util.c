@@ -66,6 +66,7 @@ namespace covered
     const std::string Util::ARC_CACHE_NAME("arc");
     const std::string Util::BESTGUESS_CACHE_NAME("bestguess"); // cooperative caching
     const std::string Util::CACHELIB_CACHE_NAME("cachelib");
+    const std::string Util::CACHELIB_HYBRID_CACHE_NAME("cachelib_hybrid"); // DRAM+NVM
     const std::string Util::FIFO_CACHE_NAME("fifo");
     const std::string Util::FROZENHOT_CACHE_NAME("frozenhot");
     const std::string Util::GLCACHE_CACHE_NAME("glcache");
@@ -137,6 +138,20 @@ namespace covered
     const std::string Util::REALNET_DUMP_OPTION_NAME("dump");
     const std::string Util::REALNET_LOAD_OPTION_NAME("load");
 
+    // Ring buffer overload policies
+    const std::string Util::RING_BUFFER_DROP_POLICY_NAME("drop");
+    const std::string Util::RING_BUFFER_BLOCK_POLICY_NAME("block");
+
+    // Client load modes
+    const std::string Util::CLIENT_LOAD_CLOSED_MODE_NAME("closed");
+    const std::string Util::CLIENT_LOAD_POISSON_MODE_NAME("poisson");
+    const std::string Util::CLIENT_LOAD_CONSTANT_MODE_NAME("constant");
+
+    // DHT placement names
+    const std::string Util::DHT_RANGE_PLACEMENT_NAME("range");
+    const std::string Util::DHT_RING_PLACEMENT_NAME("ring");
+    const std::string Util::DHT_JUMP_PLACEMENT_NAME("jump");
+
     // (2) For utility functions
 
     // Type conversion/checking
@@ -163,6 +178,7 @@ namespace covered
     const uint32_t Util::DATASET_KVPAIR_GENERATION_SEED = 0;
     //const uint32_t Util::WORKLOAD_KVPAIR_GENERATION_SEED = 1;
     const uint32_t Util::DATASET_KVPAIR_SAMPLE_SEED = 0;
+    const uint32_t Util::CLIENT_LOAD_ARRIVAL_SEED_BASE = 0;
 
     // Time measurement
     const int Util::START_YEAR = 1900;
@@ -199,7 +215,7 @@ namespace covered
 
     bool Util::isSingleNodeCache(const std::string cache_name)
     {
-        if (cache_name == ADAPTSIZE_CACHE_NAME || cache_name == ARC_CACHE_NAME || cache_name == CACHELIB_CACHE_NAME || cache_name == FIFO_CACHE_NAME || cache_name == FROZENHOT_CACHE_NAME || cache_name == GLCACHE_CACHE_NAME || cache_name == GDSF_CACHE_NAME || cache_name == GDSIZE_CACHE_NAME || cache_name == LFUDA_CACHE_NAME || cache_name == LRUK_CACHE_NAME || cache_name == LACACHE_CACHE_NAME || cache_name == LFU_CACHE_NAME || cache_name == LHD_CACHE_NAME || cache_name == LRB_CACHE_NAME || cache_name == LRU_CACHE_NAME || cache_name == S3FIFO_CACHE_NAME || cache_name == SEGCACHE_CACHE_NAME || cache_name == SIEVE_CACHE_NAME || cache_name == SLRU_CACHE_NAME || cache_name == WTINYLFU_CACHE_NAME)
+        if (cache_name == ADAPTSIZE_CACHE_NAME || cache_name == ARC_CACHE_NAME || cache_name == CACHELIB_CACHE_NAME || cache_name == CACHELIB_HYBRID_CACHE_NAME || cache_name == FIFO_CACHE_NAME || cache_name == FROZENHOT_CACHE_NAME || cache_name == GLCACHE_CACHE_NAME || cache_name == GDSF_CACHE_NAME || cache_name == GDSIZE_CACHE_NAME || cache_name == LFUDA_CACHE_NAME || cache_name == LRUK_CACHE_NAME || cache_name == LACACHE_CACHE_NAME || cache_name == LFU_CACHE_NAME || cache_name == LHD_CACHE_NAME || cache_name == LRB_CACHE_NAME || cache_name == LRU_CACHE_NAME || cache_name == S3FIFO_CACHE_NAME || cache_name == SEGCACHE_CACHE_NAME || cache_name == SIEVE_CACHE_NAME || cache_name == SLRU_CACHE_NAME || cache_name == WTINYLFU_CACHE_NAME)
         {
             return true;
         }
@@ -278,6 +294,26 @@ namespace covered
         return false;
     }
 
+    bool Util::isOpenloopClientLoadMode(const std::string client_load_mode)
+    {
+        if (client_load_mode == CLIENT_LOAD_POISSON_MODE_NAME || client_load_mode == CLIENT_LOAD_CONSTANT_MODE_NAME)
+        {
+            return true;
+        }
+
+        return false;
+    }
+
+    bool Util::isValidDhtPlacementName(const std::string dht_placement_name)
+    {
+        if (dht_placement_name == DHT_RANGE_PLACEMENT_NAME || dht_placement_name == DHT_RING_PLACEMENT_NAME || dht_placement_name == DHT_JUMP_PLACEMENT_NAME)
+        {
+            return true;
+        }
+
+        return false;
+    }
+
     // (1) I/O
 
     // (1.1) stdout/stderr I/O
@@ -505,6 +541,13 @@ namespace covered
         return static_cast<uint64_t>(current_time_us);
     }
 
+    uint64_t Util::getCurrentMonotonicTimeUs()
+    {
+        struct timespec current_timespec;
+        clock_gettime(CLOCK_MONOTONIC, &current_timespec);
+        return static_cast<uint64_t>(current_timespec.tv_sec) * 1000000 + static_cast<uint64_t>(current_timespec.tv_nsec) / 1000;
+    }
+
     std::string Util::getCurrentTimestr()
     {
         // Calculate reuiqred data
@@ -897,13 +940,16 @@ namespace covered
         return edge_beacon_server_recvreq_port;
     }
 
-    uint16_t Util::getEdgeBeaconServerRecvrspPort(const uint32_t& edge_idx, const uint32_t& edgecnt)
+    uint16_t Util::getEdgeBeaconServerWorkerRecvrspPort(const uint32_t& edge_idx, const uint32_t& edgecnt, const uint32_t& local_beacon_server_worker_idx, const uint32_t& perbeaconserver_workercnt)
     {
         int64_t edge_beacon_server_recvrsp_startport = static_cast<int64_t>(Config::getEdgeBeaconServerRecvrspStartport());
-        const uint16_t edge_beacon_server_recvrsp_port = getNodePort_(edge_beacon_server_recvrsp_startport, edge_idx, edgecnt, Config::getEdgeMachineCnt());
-        Config::portVerification(static_cast<uint16_t>(edge_beacon_server_recvrsp_startport), edge_beacon_server_recvrsp_port);
+        int64_t edge_beacon_server_recvrsp_port = static_cast<int64_t>(getNodePort_(edge_beacon_server_recvrsp_startport, edge_idx, edgecnt, Config::getEdgeMachineCnt()));
+
+        // Get beacon server worker recvrsp port
+        const uint16_t beacon_server_worker_recvrsp_port = Util::toUint16(edge_beacon_server_recvrsp_startport + (edge_beacon_server_recvrsp_port - edge_beacon_server_recvrsp_startport) * static_cast<int64_t>(perbeaconserver_workercnt) + static_cast<int64_t>(local_beacon_server_worker_idx));
+        Config::portVerification(static_cast<uint16_t>(edge_beacon_server_recvrsp_startport), beacon_server_worker_recvrsp_port);
 
-        return edge_beacon_server_recvrsp_port;
+        return beacon_server_worker_recvrsp_port;
     }
 
     uint16_t Util::getEdgeCacheServerRecvreqPort(const uint32_t& edge_idx, const uint32_t& edgecnt)
@@ -929,8 +975,25 @@ namespace covered
         std::string edge_ipstr = edge_cache_server_worker_recvrsp_addr.getIpstr();
 
         const uint16_t edge_cache_server_worker_recvrsp_port = edge_cache_server_worker_recvrsp_addr.getPort();
-        const uint16_t edge_cache_server_worker_recvrsp_startport = Config::getEdgeCacheServerWorkerRecvrspStartport();
-        assert(edge_cache_server_worker_recvrsp_port >= edge_cache_server_worker_recvrsp_startport);
+        const uint16_t edge_cache_server_worker_sync_recvrsp_startport = Config::getEdgeCacheServerWorkerRecvrspStartport();
+        const uint16_t edge_cache_server_worker_async_recvrsp_startport = Config::getEdgeCacheServerWorkerAsyncRecvrspStartport();
+        uint16_t edge_cache_server_worker_recvrsp_startport = 0;
+        if (Config::isPortWithinStartportRange(edge_cache_server_worker_sync_recvrsp_startport, edge_cache_server_worker_recvrsp_port))
+        {
+            edge_cache_server_worker_recvrsp_startport = edge_cache_server_worker_sync_recvrsp_startport;
+        }
+        else if (Config::isPortWithinStartportRange(edge_cache_server_worker_async_recvrsp_startport, edge_cache_server_worker_recvrsp_port))
+        {
+            // NOTE: multiplexed in-flight requests (e.g., directory lookup and acquire writelock) are sent from the async recvrsp port of the cache server worker
+            edge_cache_server_worker_recvrsp_startport = edge_cache_server_worker_async_recvrsp_startport;
+        }
+        else
+        {
+            std::ostringstream oss;
+            oss << "port " << edge_cache_server_worker_recvrsp_port << " is within neither the recvrsp port range (start port " << edge_cache_server_worker_sync_recvrsp_startport << ") nor the async recvrsp port range (start port " << edge_cache_server_worker_async_recvrsp_startport << ") of cache server workers!";
+            dumpErrorMsg(kClassName, oss.str());
+            exit(1);
+        }
 
         const uint16_t edge_cache_server_worker_recvreq_startport = Config::getEdgeCacheServerWorkerRecvreqStartport();
         const uint16_t edge_cache_server_worker_recvreq_port = edge_cache_server_worker_recvrsp_port - edge_cache_server_worker_recvrsp_startport + edge_cache_server_worker_recvreq_startport;
@@ -988,6 +1051,18 @@ namespace covered
         return cache_server_worker_recvrsp_port;
     }
 
+    uint16_t Util::getEdgeCacheServerWorkerAsyncRecvrspPort(const uint32_t& edge_idx, const uint32_t& edgecnt, const uint32_t& local_cache_server_worker_idx, const uint32_t& percacheserver_workercnt)
+    {
+        int64_t edge_cache_server_worker_async_recvrsp_startport = static_cast<int64_t>(Config::getEdgeCacheServerWorkerAsyncRecvrspStartport());
+        int64_t edge_cache_server_async_recvrsp_port = static_cast<int64_t>(getNodePort_(edge_cache_server_worker_async_recvrsp_startport, edge_idx, edgecnt, Config::getEdgeMachineCnt()));
+
+        // Get cache server worker async recvrsp port
+        const uint16_t cache_server_worker_async_recvrsp_port = Util::toUint16(edge_cache_server_worker_async_recvrsp_startport + (edge_cache_server_async_recvrsp_port - edge_cache_server_worker_async_recvrsp_startport) * static_cast<int64_t>(percacheserver_workercnt) + static_cast<int64_t>(local_cache_server_worker_idx));
+        Config::portVerification(static_cast<uint16_t>(edge_cache_server_worker_async_recvrsp_startport), cache_server_worker_async_recvrsp_port);
+
+        return cache_server_worker_async_recvrsp_port;
+    }
+
     // (4.3) Cloud
 
     uint16_t Util::getCloudRecvmsgPort(const uint32_t& cloud_idx)
@@ -1258,6 +1333,12 @@ namespace covered
         const std::string workload_pattern_name = evaluator_cli_ptr->getWorkloadPatternName();
         const uint32_t workload_change_period = evaluator_cli_ptr->getDynamicChangePeriod();
         const uint32_t workload_change_keycnt = evaluator_cli_ptr->getDynamicChangeKeycnt();
+        // For open-loop client load modes
+        const std::string client_load_mode = evaluator_cli_ptr->getClientLoadMode();
+        const uint32_t perclient_target_rate = evaluator_cli_ptr->getPerclientTargetRate();
+        const uint32_t perclientworker_max_outstanding_reqcnt = evaluator_cli_ptr->getPerclientworkerMaxOutstandingReqcnt();
+        const uint32_t openloop_sweep_rate_step = evaluator_cli_ptr->getOpenloopSweepRateStep();
+        const uint32_t openloop_sweep_period_sec = evaluator_cli_ptr->getOpenloopSweepPeriodSec();
         
         // ONLY used by COVERED
         uint64_t local_uncached_capacitymb = B2MB(evaluator_cli_ptr->getCoveredLocalUncachedMaxMemUsageBytes());
@@ -1282,6 +1363,14 @@ namespace covered
         {
             oss << workload_change_period << workload_change_keycnt;
         }
+        if (isOpenloopClientLoadMode(client_load_mode)) // NOTE: NOT change infix of closed-loop client load mode for backward compatibility
+        {
+            oss << "_" << client_load_mode << perclient_target_rate << "_maxoutstanding" << perclientworker_max_outstanding_reqcnt;
+            if (openloop_sweep_rate_step > 0)
+            {
+                oss << "_sweep" << openloop_sweep_rate_step << "x" << openloop_sweep_period_sec;
+            }
+        }
         // // (OBSOLETE due to too long filename) Example: covered_capacitymb1000_clientcnt1_warmupspeedup1_edgecnt1_hashnamemmh3_keycnt1000000_perclientopcnt1000000_percacheserverworkercnt1_perclientworkercnt1_propagationus100010000100000_warmupscale5_warmupmaxdurationsec0_stresstestdurationsec10_facebook
         // oss << cache_name << "_capacitymb" << B2MB(capacity_bytes) << "_clientcnt" << clientcnt << "_warmupspeedup" << (is_warmup_speedup?"1":"0") << "_edgecnt" << edgecnt << "_hashname" << hash_name << "_keycnt" << keycnt << "_perclientopcnt" << perclient_opcnt << "_percacheserverworkercnt" << percacheserver_workercnt << "_perclientworkercnt" << perclient_workercnt << "_propagationus" << propagation_latency_clientedge_avg_us << propagation_latency_crossedge_avg_us << propagation_latency_edgecloud_avg_us << "_warmupscale" << warmup_reqcnt_scale << "_warmupmaxdurationsec" << warmup_max_duration_sec << "_stresstestdurationsec" << stresstest_duration_sec << "_" << workload_name;
         if (cache_name == "covered")
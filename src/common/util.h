@@ -111,6 +111,7 @@ namespace covered
         static const std::string ARC_CACHE_NAME;
         static const std::string BESTGUESS_CACHE_NAME; // Canonical cooperaive caching
         static const std::string CACHELIB_CACHE_NAME;
+        static const std::string CACHELIB_HYBRID_CACHE_NAME; // Cachelib w/ DRAM+NVM tiers
         static const std::string FIFO_CACHE_NAME;
         static const std::string FROZENHOT_CACHE_NAME;
         static const std::string GLCACHE_CACHE_NAME;
@@ -182,6 +183,20 @@ namespace covered
         static const std::string REALNET_DUMP_OPTION_NAME;
         static const std::string REALNET_LOAD_OPTION_NAME;
 
+        // Ring buffer overload policies
+        static const std::string RING_BUFFER_DROP_POLICY_NAME;
+        static const std::string RING_BUFFER_BLOCK_POLICY_NAME;
+
+        // Client load modes
+        static const std::string CLIENT_LOAD_CLOSED_MODE_NAME; // Closed-loop: each client worker issues the next request after receiving the previous response
+        static const std::string CLIENT_LOAD_POISSON_MODE_NAME; // Open-loop: Poisson arrivals at the target rate with multiple outstanding requests
+        static const std::string CLIENT_LOAD_CONSTANT_MODE_NAME; // Open-loop: constant inter-arrival time at the target rate with multiple outstanding requests
+
+        // DHT placement names (i.e., how DhtWrapper maps keys to beacon edge nodes)
+        static const std::string DHT_RANGE_PLACEMENT_NAME; // Equal contiguous hash ranges per edge node (almost all keys are remapped if edgecnt changes)
+        static const std::string DHT_RING_PLACEMENT_NAME; // Consistent hashing ring w/ (weighted) virtual nodes per edge node
+        static const std::string DHT_JUMP_PLACEMENT_NAME; // Jump consistent hash w/o memory footprint (NOT support per-edge weights)
+
         // (2) For utility functions
 
         // Type conversion
@@ -209,6 +224,7 @@ namespace covered
         static const uint32_t DATASET_KVPAIR_GENERATION_SEED; // Deterministic seed to generate key-value objects for dataset (the same for all clients to ensure the same dataset; ONLY for non-replayed traces)
         //static const uint32_t WORKLOAD_KVPAIR_GENERATION_SEED; // (OBSOLETE: homogeneous cache access patterns is a WRONG assumption -> we should ONLY follow homogeneous workload distribution yet still with heterogeneous cache access patterns) Deterministic seed to generate key-value objects for workload (the same for all clients to ensure homogeneous cache access patterns)
         static const uint32_t DATASET_KVPAIR_SAMPLE_SEED; // Used to randomly sample dataset items during preprocessing (ONLY for replayed traces)
+        static const uint32_t CLIENT_LOAD_ARRIVAL_SEED_BASE; // Deterministic seed base (+ global client worker index) to generate open-loop request arrivals
 
         // Time measurement
         static const int START_YEAR;
@@ -251,6 +267,10 @@ namespace covered
 
         static bool isDynamicWorkloadPattern(const std::string workload_pattern_name);
 
+        static bool isOpenloopClientLoadMode(const std::string client_load_mode); // Will issue requests on a rate-controlled schedule instead of closed-loop
+
+        static bool isValidDhtPlacementName(const std::string dht_placement_name);
+
         // (1) I/O
 
         // (1.1) stdout/stderr I/O
@@ -278,6 +298,7 @@ namespace covered
 
         static struct timespec getCurrentTimespec();
         static uint64_t getCurrentTimeUs();
+        static uint64_t getCurrentMonotonicTimeUs(); // NOT affected by system time adjustment (e.g., absolute deadlines of timers)
         static std::string getCurrentTimestr();
         static double getDeltaTimeUs(const struct timespec& current_timespec, const struct timespec& previous_timespec); // In units of microseconds
 
@@ -321,13 +342,14 @@ namespace covered
         // UDP port for receiving requests is edge_XXX_recvreq_startport + edge_idx
         static uint16_t getEdgeRecvmsgPort(const uint32_t& edge_idx, const uint32_t& edgecnt);
         static uint16_t getEdgeBeaconServerRecvreqPort(const uint32_t& edge_idx, const uint32_t& edgecnt);
-        static uint16_t getEdgeBeaconServerRecvrspPort(const uint32_t& edge_idx, const uint32_t& edgecnt);
+        static uint16_t getEdgeBeaconServerWorkerRecvrspPort(const uint32_t& edge_idx, const uint32_t& edgecnt, const uint32_t& local_beacon_server_worker_idx, const uint32_t& perbeaconserver_workercnt); // NOTE: the same as the previous per-edge beacon server recvrsp port if perbeaconserver_workercnt = 1
         static uint16_t getEdgeCacheServerRecvreqPort(const uint32_t& edge_idx, const uint32_t& edgecnt);
         static uint16_t getEdgeCacheServerPlacementProcessorRecvrspPort(const uint32_t& edge_idx, const uint32_t& edgecnt);
-        static NetworkAddr getEdgeCacheServerWorkerRecvreqAddrFromRecvrspAddr(const NetworkAddr& edge_cache_server_worker_recvrsp_addr);
+        static NetworkAddr getEdgeCacheServerWorkerRecvreqAddrFromRecvrspAddr(const NetworkAddr& edge_cache_server_worker_recvrsp_addr); // NOTE: recvrsp addr can be either the blocking or the async recvrsp addr of the cache server worker
         static uint32_t getEdgeIdxFromCacheServerWorkerRecvreqAddr(const NetworkAddr& edge_cache_server_worker_recvreq_addr, const bool& is_private_ipstr, const uint32_t& edgecnt);
         static uint16_t getEdgeCacheServerWorkerRecvreqPort(const uint32_t& edge_idx, const uint32_t& edgecnt, const uint32_t& local_cache_server_worker_idx, const uint32_t& percacheserver_workercnt);
         static uint16_t getEdgeCacheServerWorkerRecvrspPort(const uint32_t& edge_idx, const uint32_t& edgecnt, const uint32_t& local_cache_server_worker_idx, const uint32_t& percacheserver_workercnt);
+        static uint16_t getEdgeCacheServerWorkerAsyncRecvrspPort(const uint32_t& edge_idx, const uint32_t& edgecnt, const uint32_t& local_cache_server_worker_idx, const uint32_t& percacheserver_workercnt);
 
         // (4.3) Cloud
         static uint16_t getCloudRecvmsgPort(const uint32_t& cloud_idx);
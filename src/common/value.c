@@ -1,6 +1,7 @@
 #include "common/value.h"
 
 #include <arpa/inet.h> // htonl ntohl
+#include <assert.h>
 
 #include "common/config.h"
 #include "common/util.h"
@@ -15,15 +16,47 @@ namespace covered
     {
         is_deleted_ = true;
         valuesize_ = 0;
+        payload_ptr_ = NULL;
     }
 
     Value::Value(const uint32_t& valuesize)
     {
         is_deleted_ = false;
         valuesize_ = valuesize;
+        payload_ptr_ = NULL;
     }
 
-    Value::~Value() {}
+    Value::Value(const char* data, const uint32_t& valuesize)
+    {
+        is_deleted_ = false;
+        valuesize_ = valuesize;
+        payload_ptr_ = ValuePayload::createOnHeap(data, valuesize);
+    }
+
+    Value::Value(const Value& other)
+    {
+        is_deleted_ = other.is_deleted_;
+        valuesize_ = other.valuesize_;
+        payload_ptr_ = other.payload_ptr_;
+        if (payload_ptr_ != NULL)
+        {
+            payload_ptr_->acquire();
+        }
+    }
+
+    Value::Value(ValuePayload* payload_ptr)
+    {
+        assert(payload_ptr != NULL);
+
+        is_deleted_ = false;
+        valuesize_ = payload_ptr->getSize();
+        payload_ptr_ = payload_ptr;
+    }
+
+    Value::~Value()
+    {
+        releasePayload_();
+    }
 
     bool Value::isDeleted() const
     {
@@ -41,8 +74,26 @@ namespace covered
         return valuesize_;
     }
 
+    bool Value::hasPayload() const
+    {
+        return payload_ptr_ != NULL;
+    }
+
+    const char* Value::getPayloadData() const
+    {
+        if (payload_ptr_ == NULL)
+        {
+            return NULL;
+        }
+        return payload_ptr_->getData();
+    }
+
     std::string Value::generateValuestrForStorage() const
     {
+        if (payload_ptr_ != NULL)
+        {
+            return std::string(payload_ptr_->getData(), valuesize_);
+        }
         return generateValuestr_(valuesize_);
     }
 
@@ -68,11 +119,26 @@ namespace covered
         size += sizeof(uint32_t);
         if (!is_space_efficient) // For network packets
         {
-            std::string valuestr_for_network = generateValuestrForNetwork_();
-            if (valuestr_for_network.length() > 0)
+            const uint32_t value_size_for_network = getValuesizeForNetwork_(valuesize_);
+            if (payload_ptr_ != NULL && value_size_for_network > 0)
             {
-                msg_payload.deserialize(size, (const char*)(valuestr_for_network.data()), valuestr_for_network.length());
-                size += valuestr_for_network.length();
+                // NOTE: copy value bytes from payload (e.g., arena chunk of local edge cache) into message payload directly w/o generating a temporary value string
+                msg_payload.deserialize(size, payload_ptr_->getData(), value_size_for_network);
+                size += value_size_for_network;
+            }
+            else if (value_size_for_network > 0 && !Config::isGenerateRandomValuestr())
+            {
+                msg_payload.arrayset(size, '0', value_size_for_network);
+                size += value_size_for_network;
+            }
+            else
+            {
+                std::string valuestr_for_network = generateValuestrForNetwork_();
+                if (valuestr_for_network.length() > 0)
+                {
+                    msg_payload.deserialize(size, (const char*)(valuestr_for_network.data()), valuestr_for_network.length());
+                    size += valuestr_for_network.length();
+                }
             }
         }
         return size - position;
@@ -88,11 +154,20 @@ namespace covered
         size += sizeof(uint32_t);
         if (!is_space_efficient) // For network packets
         {
-            std::string valuestr_for_network = generateValuestrForNetwork_();
-            if (valuestr_for_network.length() > 0)
+            const uint32_t value_size_for_network = getValuesizeForNetwork_(valuesize_);
+            if (payload_ptr_ != NULL && value_size_for_network > 0)
+            {
+                fs_ptr->write(payload_ptr_->getData(), value_size_for_network);
+                size += value_size_for_network;
+            }
+            else
             {
-                fs_ptr->write((const char*)valuestr_for_network.data(), valuestr_for_network.length());
-                size += valuestr_for_network.length();
+                std::string valuestr_for_network = generateValuestrForNetwork_();
+                if (valuestr_for_network.length() > 0)
+                {
+                    fs_ptr->write((const char*)valuestr_for_network.data(), valuestr_for_network.length());
+                    size += valuestr_for_network.length();
+                }
             }
         }
         return size;
@@ -100,6 +175,8 @@ namespace covered
 
     uint32_t Value::deserialize(const DynamicArray& msg_payload, const uint32_t& position, const bool& is_space_efficient)
     {
+        releasePayload_();
+
         uint32_t size = position;
         msg_payload.serialize(size, (char *)&is_deleted_, sizeof(bool));
         size += sizeof(bool);
@@ -109,9 +186,19 @@ namespace covered
         size += sizeof(uint32_t);
         if (!is_space_efficient) // For network packets
         {
-            // Note: we ignore the value content yet still consume space
             const uint32_t value_size_for_network = getValuesizeForNetwork_(valuesize_);
-            // msg_payload.arraycpy(size, value_content, 0, value_size_for_network);
+            if (Config::isRealValuePayload() && !is_deleted_)
+            {
+                // NOTE: the heap payload will be copied into ValueSlabArena if admitted/updated into local edge cache
+                assert(value_size_for_network == valuesize_);
+                assert(size + value_size_for_network <= msg_payload.getSize());
+                payload_ptr_ = ValuePayload::createOnHeap(msg_payload.getBytesConstRef().data() + size, value_size_for_network);
+            }
+            else
+            {
+                // Note: we ignore the value content yet still consume space
+                // msg_payload.arraycpy(size, value_content, 0, value_size_for_network);
+            }
             size += value_size_for_network;
         }
         return size - position;
@@ -119,6 +206,8 @@ namespace covered
 
     uint32_t Value::deserialize(std::fstream* fs_ptr, const bool& is_space_efficient)
     {
+        releasePayload_();
+
         uint32_t size = 0;
         fs_ptr->read((char*)&is_deleted_, sizeof(bool));
         size += sizeof(bool);
@@ -132,11 +221,31 @@ namespace covered
 
     const Value& Value::operator=(const Value& other)
     {
-        is_deleted_ = other.is_deleted_;
-        valuesize_ = other.valuesize_;
+        if (this != &other)
+        {
+            if (other.payload_ptr_ != NULL)
+            {
+                other.payload_ptr_->acquire();
+            }
+            releasePayload_();
+
+            is_deleted_ = other.is_deleted_;
+            valuesize_ = other.valuesize_;
+            payload_ptr_ = other.payload_ptr_;
+        }
         return *this;
     }
 
+    void Value::releasePayload_()
+    {
+        if (payload_ptr_ != NULL)
+        {
+            payload_ptr_->release();
+            payload_ptr_ = NULL;
+        }
+        return;
+    }
+
     std::string Value::generateValuestrForNetwork_() const
     {
         return generateValuestr_(getValuesizeForNetwork_(valuesize_));
@@ -144,6 +253,11 @@ namespace covered
 
     uint32_t Value::getValuesizeForNetwork_(const uint32_t& value_size)
     {
+        if (Config::isRealValuePayload()) // Transmit value content in full
+        {
+            return value_size;
+        }
+
         uint32_t value_size_for_network = 0;
         if (value_size > MAX_VALUE_CONTENT_SIZE)
         {
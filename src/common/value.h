@@ -8,6 +8,8 @@
  * (ii-ii) -> NOTE: as we do not simulate propagation latency during warmup, reducing emission latency can significantly speedup warmup;
  * (iii) We still use original value size to calculate bandwidth cost just like transmitting complete value content -> NOT affect evaluation bandwidth results;
  * (iv) Using other streaming-based network protocols (e.g., TCP or HTTPS) can solve this issue, yet it is just time-consuming engineering work and orthogonal with our problem design (leave in the future work).
+ *
+ * NOTE: if Config::isRealValuePayload() is true, value can carry real bytes (see ValuePayload) shared by its copies w/o extra allocation, which are stored in ValueSlabArena of local edge cache and transmitted in full in network packets (value w/o payload is transmitted as valuesize_ bytes of generated content).
  * 
  * By Siyuan Sheng (2023.04.18).
  */
@@ -18,6 +20,7 @@
 #include <string>
 
 #include "common/dynamic_array.h"
+#include "common/value_payload.h"
 
 namespace covered
 {
@@ -28,12 +31,16 @@ namespace covered
 
         Value();
         Value(const uint32_t& valuesize);
+        Value(const char* data, const uint32_t& valuesize); // Carry real bytes (copied into a heap payload)
+        Value(const Value& other);
         ~Value();
 
         bool isDeleted() const;
         //void remove();
         
         uint32_t getValuesize() const;
+        bool hasPayload() const;
+        const char* getPayloadData() const; // NULL if w/o payload
         std::string generateValuestrForStorage() const; // Generate value string as value content for edge/cloud storage (valuesize_ bytes)
 
         // Offset of value (position) is dynamically changed for different keys in message payload
@@ -47,8 +54,14 @@ namespace covered
 
         const Value& operator=(const Value& other);
     private:
+        friend class ValueSlabArena;
+
         static const std::string kClassName;
 
+        Value(ValuePayload* payload_ptr); // Take over one reference of the payload
+
+        void releasePayload_();
+
         std::string generateValuestrForNetwork_() const; // Generate value string as value content for network packets (up to MAX_VALUE_CONTENT_SIZE bytes)
 
         static uint32_t getValuesizeForNetwork_(const uint32_t& value_size); // Get value size for network packets (up to MAX_VALUE_CONTENT_SIZE bytes)
@@ -56,6 +69,7 @@ namespace covered
 
         bool is_deleted_;
         uint32_t valuesize_;
+        ValuePayload* payload_ptr_; // NULL for size-only value
     };
 }
 
@@ -0,0 +1,83 @@
+#include "common/value_payload.h"
+
+#include <assert.h>
+#include <cstdlib> // malloc free
+#include <cstring> // memcpy
+#include <new> // placement new
+
+#include "common/value_slab_arena.h"
+
+namespace covered
+{
+    const std::string ValuePayload::kClassName("ValuePayload");
+
+    ValuePayload* ValuePayload::createOnHeap(const char* data, const uint32_t& size)
+    {
+        void* buffer = malloc(getBufferSize(size));
+        assert(buffer != NULL);
+        ValuePayload* payload_ptr = new (buffer) ValuePayload(size, NULL, 0);
+        if (size > 0)
+        {
+            assert(data != NULL);
+            memcpy(payload_ptr->getMutableData_(), data, size);
+        }
+        return payload_ptr;
+    }
+
+    uint32_t ValuePayload::getBufferSize(const uint32_t& size)
+    {
+        return sizeof(ValuePayload) + size;
+    }
+
+    ValuePayload::ValuePayload(const uint32_t& size, ValueSlabArena* arena_ptr, const uint32_t& classid) : refcnt_(1), size_(size), classid_(classid), arena_ptr_(arena_ptr) {}
+
+    ValuePayload::~ValuePayload() {}
+
+    void ValuePayload::acquire()
+    {
+        refcnt_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    void ValuePayload::release()
+    {
+        const uint32_t prev_refcnt = refcnt_.fetch_sub(1, std::memory_order_acq_rel);
+        assert(prev_refcnt > 0);
+        if (prev_refcnt == 1) // The last reference
+        {
+            ValueSlabArena* arena_ptr = arena_ptr_;
+            const uint32_t classid = classid_;
+            const uint32_t buffer_size = getBufferSize(size_);
+            this->~ValuePayload();
+            if (arena_ptr == NULL)
+            {
+                free((void*)this);
+            }
+            else
+            {
+                arena_ptr->releaseChunk_((void*)this, classid, buffer_size);
+            }
+        }
+        return;
+    }
+
+    const char* ValuePayload::getData() const
+    {
+        return reinterpret_cast<const char*>(this + 1);
+    }
+
+    uint32_t ValuePayload::getSize() const
+    {
+        return size_;
+    }
+
+    const ValueSlabArena* ValuePayload::getArenaPtr() const
+    {
+        return arena_ptr_;
+    }
+
+    char* ValuePayload::getMutableData_()
+    {
+        return reinterpret_cast<char*>(this + 1);
+    }
+}
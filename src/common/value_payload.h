@@ -0,0 +1,46 @@
+/*
+ * ValuePayload: refcounted value bytes shared by copies of the same Value, where the header is followed by value bytes in the same buffer (either a heap buffer for transient values, or a chunk of ValueSlabArena for values cached in local edge cache).
+ *
+ * NOTE: ONLY used if Config::isRealValuePayload() is true; otherwise Value only tracks value size.
+ */
+
+#ifndef VALUE_PAYLOAD_H
+#define VALUE_PAYLOAD_H
+
+#include <atomic>
+#include <string>
+
+namespace covered
+{
+    class ValueSlabArena;
+
+    class ValuePayload
+    {
+    public:
+        static ValuePayload* createOnHeap(const char* data, const uint32_t& size); // Copy data into a heap buffer with refcnt = 1
+        static uint32_t getBufferSize(const uint32_t& size); // Header + value bytes
+
+        void acquire();
+        void release(); // Free heap buffer or return arena chunk when the last reference is released (NOT access the payload after release)
+
+        const char* getData() const;
+        uint32_t getSize() const;
+        const ValueSlabArena* getArenaPtr() const; // NULL for heap buffer
+    private:
+        friend class ValueSlabArena;
+
+        static const std::string kClassName;
+
+        ValuePayload(const uint32_t& size, ValueSlabArena* arena_ptr, const uint32_t& classid); // NOTE: MUST be placement-new at the beginning of a buffer with getBufferSize(size) bytes
+        ~ValuePayload();
+
+        char* getMutableData_();
+
+        std::atomic<uint32_t> refcnt_;
+        const uint32_t size_; // # of value bytes following the header
+        const uint32_t classid_; // Size class of the arena chunk (ONLY valid if arena_ptr_ != NULL)
+        ValueSlabArena* const arena_ptr_; // Owner arena (NULL for heap buffer)
+    };
+}
+
+#endif
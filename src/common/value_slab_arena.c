@@ -0,0 +1,215 @@
+#include "common/value_slab_arena.h"
+
+#include <algorithm> // std::lower_bound
+#include <assert.h>
+#include <cstdlib> // malloc free
+#include <cstring> // memcpy
+#include <limits> // std::numeric_limits
+#include <new> // placement new
+#include <sstream>
+
+#include "common/util.h"
+
+namespace covered
+{
+    const uint32_t ValueSlabArena::MIN_CHUNK_SIZE = 64; // At least one cache line for header + small values
+    const double ValueSlabArena::CHUNK_SIZE_GROWTH_FACTOR = 1.25; // The same as memcached
+    const uint32_t ValueSlabArena::SLAB_SIZE = MB2B(1);
+
+    const std::string ValueSlabArena::kClassName("ValueSlabArena");
+    const uint32_t ValueSlabArena::LARGE_CLASSID = std::numeric_limits<uint32_t>::max();
+
+    void ValueSlabArena::destroy(ValueSlabArena* arena_ptr)
+    {
+        assert(arena_ptr != NULL);
+
+        {
+            std::lock_guard<std::mutex> lock(arena_ptr->mutex_);
+            assert(!arena_ptr->is_destroyed_);
+            arena_ptr->is_destroyed_ = true;
+            if (arena_ptr->live_chunkcnt_ > 0)
+            {
+                // NOTE: the arena will be deleted by the release of the last live chunk
+                std::ostringstream oss;
+                oss << arena_ptr->live_chunkcnt_ << " chunks are still referenced by values when destroying the arena -> defer deleting the arena until they are released";
+                Util::dumpWarnMsg(arena_ptr->instance_name_, oss.str());
+                return;
+            }
+        }
+
+        delete arena_ptr;
+        return;
+    }
+
+    ValueSlabArena::ValueSlabArena(const uint32_t& edge_idx)
+    {
+        // Differentiate value slab arenas in different edge nodes
+        std::ostringstream oss;
+        oss << kClassName << " edge" << edge_idx;
+        instance_name_ = oss.str();
+
+        // Chunk sizes are aligned with 8 bytes for the header of ValuePayload
+        uint32_t tmp_chunk_size = MIN_CHUNK_SIZE;
+        while (tmp_chunk_size < SLAB_SIZE)
+        {
+            chunk_sizes_.push_back(tmp_chunk_size);
+            uint32_t tmp_next_chunk_size = static_cast<uint32_t>(tmp_chunk_size * CHUNK_SIZE_GROWTH_FACTOR);
+            tmp_next_chunk_size = (tmp_next_chunk_size + 7) / 8 * 8;
+            if (tmp_next_chunk_size <= tmp_chunk_size)
+            {
+                tmp_next_chunk_size = tmp_chunk_size + 8;
+            }
+            tmp_chunk_size = tmp_next_chunk_size;
+        }
+        chunk_sizes_.push_back(SLAB_SIZE);
+
+        perclass_free_chunks_.resize(chunk_sizes_.size());
+        slab_bytes_ = 0;
+        live_chunk_bytes_ = 0;
+        live_value_bytes_ = 0;
+        live_chunkcnt_ = 0;
+        is_destroyed_ = false;
+    }
+
+    ValueSlabArena::~ValueSlabArena()
+    {
+        // NOTE: NO need to acquire the lock, as NO value references the arena now
+        assert(is_destroyed_);
+        assert(live_chunkcnt_ == 0);
+
+        for (uint32_t i = 0; i < slabs_.size(); i++)
+        {
+            free(slabs_[i]);
+            slabs_[i] = NULL;
+        }
+        slabs_.clear();
+    }
+
+    Value ValueSlabArena::intern(const Value& value)
+    {
+        if (!value.hasPayload() || value.payload_ptr_->getArenaPtr() == this)
+        {
+            return value; // NOTE: copying a value only increases refcnt of its payload
+        }
+
+        const uint32_t valuesize = value.getValuesize();
+        uint32_t classid = 0;
+        void* chunk_ptr = allocateChunk_(ValuePayload::getBufferSize(valuesize), classid);
+        ValuePayload* payload_ptr = new (chunk_ptr) ValuePayload(valuesize, this, classid);
+        if (valuesize > 0)
+        {
+            memcpy(payload_ptr->getMutableData_(), value.getPayloadData(), valuesize);
+        }
+
+        return Value(payload_ptr);
+    }
+
+    uint64_t ValueSlabArena::getSlabBytes() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return slab_bytes_;
+    }
+
+    uint64_t ValueSlabArena::getOverheadBytes() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        assert(live_chunk_bytes_ >= live_value_bytes_);
+        return live_chunk_bytes_ - live_value_bytes_;
+    }
+
+    std::string ValueSlabArena::getStatisticsStr() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::ostringstream oss;
+        oss << "slab bytes: " << slab_bytes_ << "; live chunkcnt: " << live_chunkcnt_ << "; live chunk bytes: " << live_chunk_bytes_ << "; live value bytes: " << live_value_bytes_;
+        if (live_value_bytes_ > 0)
+        {
+            oss << "; memory overhead ratio: " << static_cast<double>(slab_bytes_ - live_value_bytes_) / static_cast<double>(live_value_bytes_);
+        }
+        return oss.str();
+    }
+
+    void* ValueSlabArena::allocateChunk_(const uint32_t& buffer_size, uint32_t& classid)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        void* chunk_ptr = NULL;
+        uint32_t chunk_size = 0;
+        if (buffer_size > SLAB_SIZE) // Allocate large value individually
+        {
+            classid = LARGE_CLASSID;
+            chunk_size = buffer_size;
+            chunk_ptr = malloc(chunk_size);
+            assert(chunk_ptr != NULL);
+            slab_bytes_ += chunk_size;
+        }
+        else
+        {
+            classid = std::lower_bound(chunk_sizes_.begin(), chunk_sizes_.end(), buffer_size) - chunk_sizes_.begin();
+            assert(classid < chunk_sizes_.size());
+            chunk_size = chunk_sizes_[classid];
+
+            std::vector<void*>& tmp_free_chunks = perclass_free_chunks_[classid];
+            if (tmp_free_chunks.empty()) // Carve a new slab into chunks of the size class
+            {
+                char* slab_ptr = static_cast<char*>(malloc(SLAB_SIZE));
+                assert(slab_ptr != NULL);
+                slabs_.push_back(slab_ptr);
+                slab_bytes_ += SLAB_SIZE;
+
+                const uint32_t tmp_chunkcnt = SLAB_SIZE / chunk_size;
+                tmp_free_chunks.reserve(tmp_free_chunks.size() + tmp_chunkcnt);
+                for (uint32_t i = tmp_chunkcnt; i > 0; i--) // NOTE: pop from the slab beginning first
+                {
+                    tmp_free_chunks.push_back(slab_ptr + (i - 1) * chunk_size);
+                }
+            }
+            chunk_ptr = tmp_free_chunks.back();
+            tmp_free_chunks.pop_back();
+        }
+
+        live_chunk_bytes_ += chunk_size;
+        live_value_bytes_ += buffer_size - sizeof(ValuePayload);
+        live_chunkcnt_++;
+
+        return chunk_ptr;
+    }
+
+    void ValueSlabArena::releaseChunk_(void* chunk_ptr, const uint32_t& classid, const uint32_t& buffer_size)
+    {
+        assert(chunk_ptr != NULL);
+
+        bool is_last_reference = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            uint32_t chunk_size = 0;
+            if (classid == LARGE_CLASSID)
+            {
+                chunk_size = buffer_size;
+                free(chunk_ptr);
+                slab_bytes_ -= chunk_size;
+            }
+            else
+            {
+                assert(classid < chunk_sizes_.size());
+                chunk_size = chunk_sizes_[classid];
+                perclass_free_chunks_[classid].push_back(chunk_ptr);
+            }
+
+            assert(live_chunkcnt_ > 0);
+            live_chunk_bytes_ -= chunk_size;
+            live_value_bytes_ -= buffer_size - sizeof(ValuePayload);
+            live_chunkcnt_--;
+
+            is_last_reference = is_destroyed_ && live_chunkcnt_ == 0;
+        } // NOTE: the lock MUST be released before deleting the arena
+
+        if (is_last_reference) // The owner has destroyed the arena and the last value referencing the arena is released
+        {
+            delete this;
+        }
+
+        return;
+    }
+}
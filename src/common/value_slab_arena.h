@@ -0,0 +1,67 @@
+/*
+ * ValueSlabArena: size-class slab allocator owned by each local edge cache (via CacheWrapper) to store real value bytes of cached objects, such that each cached object does NOT need a heap allocation for its value bytes (thread safe).
+ *
+ * NOTE: similar as memcached, chunk sizes of size classes grow by CHUNK_SIZE_GROWTH_FACTOR from MIN_CHUNK_SIZE to SLAB_SIZE, and each slab of SLAB_SIZE bytes is carved into equal-sized chunks of one size class on demand; values larger than a slab (rare in real-world traces) are allocated individually.
+ *
+ * NOTE: freed chunks are kept in per-class free lists and NOT returned to the system until the arena is destroyed.
+ *
+ * NOTE: live chunks hold the arena alive (i.e., live chunkcnt works as an intrusive refcnt of the arena, w/o extra bytes in each chunk): the owner MUST invoke destroy() instead of deleting the arena, which is deferred to the release of the last live chunk if any value (e.g., copied out of the local edge cache) outlives the owner.
+ */
+
+#ifndef VALUE_SLAB_ARENA_H
+#define VALUE_SLAB_ARENA_H
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "common/value.h"
+#include "common/value_payload.h"
+
+namespace covered
+{
+    class ValueSlabArena
+    {
+    public:
+        static const uint32_t MIN_CHUNK_SIZE;
+        static const double CHUNK_SIZE_GROWTH_FACTOR;
+        static const uint32_t SLAB_SIZE;
+
+        static void destroy(ValueSlabArena* arena_ptr); // Invoked by the owner (i.e., CacheWrapper) to release the arena after all live chunks are released
+
+        ValueSlabArena(const uint32_t& edge_idx);
+
+        Value intern(const Value& value); // Return a value whose bytes are in the arena (copy bytes into a chunk if from heap or another arena; NO change for size-only or deleted value)
+
+        // In units of bytes
+        uint64_t getSlabBytes() const; // Memory allocated from the system
+        uint64_t getOverheadBytes() const; // Chunk headers and rounding of live chunks (i.e., memory of live chunks beyond value bytes)
+        std::string getStatisticsStr() const;
+    private:
+        friend class ValuePayload;
+
+        static const std::string kClassName;
+        static const uint32_t LARGE_CLASSID; // For values larger than a slab
+
+        ~ValueSlabArena(); // NOTE: ONLY invoked by destroy() or the release of the last live chunk after destroy()
+
+        void* allocateChunk_(const uint32_t& buffer_size, uint32_t& classid);
+        void releaseChunk_(void* chunk_ptr, const uint32_t& classid, const uint32_t& buffer_size); // Invoked by ValuePayload::release() (NOTE: the arena may be deleted after releasing the last live chunk)
+
+        // Const shared variables
+        std::string instance_name_;
+        std::vector<uint32_t> chunk_sizes_; // Increasing chunk size of each size class
+
+        // Non-const shared variables
+        mutable std::mutex mutex_;
+        std::vector<std::vector<void*>> perclass_free_chunks_;
+        std::vector<void*> slabs_;
+        uint64_t slab_bytes_; // Including individually allocated large values
+        uint64_t live_chunk_bytes_;
+        uint64_t live_value_bytes_;
+        uint64_t live_chunkcnt_;
+        bool is_destroyed_; // Whether the owner has invoked destroy()
+    };
+}
+
+#endif
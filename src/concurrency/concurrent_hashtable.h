@@ -21,9 +21,11 @@
 
 namespace covered
 {
-    // NOTE: class V must support default constructor, operator=, getSizeForCapacity(), and call/constCall(const std::string& function_name, void* param_ptr)
-    // NOTE: V::call() returns a boolean indicating whether to erase the key-value pair or not
-    template<class V>
+    // NOTE: class V must support default constructor, operator=, and getSizeForCapacity()
+    // NOTE: class M is the map of each per-key rwlock (e.g., OpenAddressingMap for small values with a large number of keys), which must support find(), insert(), erase(iterator), begin(), and end() like std::unordered_map
+    // NOTE: operations on existing values are passed as callables (e.g., lambdas) instead of string-named functions, such that compiler can inline them into hashtable probes without string comparisons
+    // NOTE: func(V&) for insertOrCall()/callIfExist() returns a boolean indicating whether to erase the key-value pair or not; const_func(const V&) for constCallIfExist() returns nothing
+    template<class V, class M = std::unordered_map<Key, V, KeyHasher>>
     class ConcurrentHashtable
     {
     public:
@@ -34,9 +36,12 @@ namespace covered
         bool isExist(const Key& key) const;
         //V getIfExist(const Key& key, bool& is_exist) const; // Get if key exists
         void insertOrUpdate(const Key& key, const V& value, bool& is_exist); // Insert a new value if key does not exist, or update the value if key exists
-        void insertOrCall(const Key& key, const V& value, bool& is_exist, const std::string& function_name, void* param_ptr); // Insert a new value if key does not exist, or call value.function_name if key exists
-        void callIfExist(const Key& key, bool& is_exist, const std::string& function_name, void* param_ptr); // Call value.function_name if key exists
-        void constCallIfExist(const Key& key, bool& is_exist, const std::string& function_name, void* param_ptr) const; // Const call value.function_name if key exists
+        template<class Func>
+        void insertOrCall(const Key& key, const V& value, bool& is_exist, const Func& func); // Insert a new value if key does not exist, or call func(value) if key exists (func MUST NOT require erase)
+        template<class Func>
+        void callIfExist(const Key& key, bool& is_exist, const Func& func); // Call func(value) if key exists (erase key-value pair if func returns true)
+        template<class ConstFunc>
+        void constCallIfExist(const Key& key, bool& is_exist, const ConstFunc& const_func) const; // Call const_func(value) if key exists
         void eraseIfExist(const Key& key, bool& is_exist); // Erase if key exists
 
         uint64_t getTotalKeySizeForCapcity() const;
@@ -56,7 +61,7 @@ namespace covered
         const PerkeyRwlock* perkey_rwlock_ptr_;
 
         // Non-const shared variables
-        std::vector<std::unordered_map<Key, V, KeyHasher>> hashtables_;
+        std::vector<M> hashtables_;
 
         // NOn-const shared variables (thread safe)
         std::atomic<uint64_t> total_key_size_;
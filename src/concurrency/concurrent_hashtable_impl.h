@@ -10,11 +10,11 @@
 
 namespace covered
 {
-    template<class V>
-    const std::string ConcurrentHashtable<V>::kClassName("ConcurrentHashtable");
+    template<class V, class M>
+    const std::string ConcurrentHashtable<V, M>::kClassName("ConcurrentHashtable");
 
-    template<class V>
-    ConcurrentHashtable<V>::ConcurrentHashtable(const std::string& table_name, const V& default_value, const PerkeyRwlock* perkey_rwlock_ptr) : perkey_rwlock_ptr_(perkey_rwlock_ptr), total_key_size_(0), total_value_size_(0)
+    template<class V, class M>
+    ConcurrentHashtable<V, M>::ConcurrentHashtable(const std::string& table_name, const V& default_value, const PerkeyRwlock* perkey_rwlock_ptr) : perkey_rwlock_ptr_(perkey_rwlock_ptr), total_key_size_(0), total_value_size_(0)
     {
         std::ostringstream oss;
         oss << kClassName << " of " << table_name;
@@ -32,14 +32,14 @@ namespace covered
         }
     }
 
-    template<class V>
-    ConcurrentHashtable<V>::~ConcurrentHashtable()
+    template<class V, class M>
+    ConcurrentHashtable<V, M>::~ConcurrentHashtable()
     {
         // NOTE: no need to release perkey_rwlock_ptr_, which is maintained outside ConcurrentHashtable (e.g., in CacheWrapperBase and CooperationWrapperBase)
     }
 
-    template<class V>
-    bool ConcurrentHashtable<V>::isExist(const Key& key) const
+    template<class V, class M>
+    bool ConcurrentHashtable<V, M>::isExist(const Key& key) const
     {
         assert(perkey_rwlock_ptr_ != NULL);
 
@@ -49,8 +49,8 @@ namespace covered
 
         bool is_exist = false;
 
-        const std::unordered_map<Key, V, KeyHasher>& tmp_hashtable = hashtables_[hashidx];
-        typename std::unordered_map<Key, V, KeyHasher>::const_iterator iter = tmp_hashtable.find(key);
+        const M& tmp_hashtable = hashtables_[hashidx];
+        typename M::const_iterator iter = tmp_hashtable.find(key);
         is_exist = (iter != tmp_hashtable.end());
 
         // Must be protected by a read/write lock
@@ -59,8 +59,8 @@ namespace covered
         return is_exist;
     }
 
-    /*template<class V>
-    V ConcurrentHashtable<V>::getIfExist(const Key& key, bool& is_exist) const
+    /*template<class V, class M>
+    V ConcurrentHashtable<V, M>::getIfExist(const Key& key, bool& is_exist) const
     {
         assert(perkey_rwlock_ptr_ != NULL);
 
@@ -69,8 +69,8 @@ namespace covered
         uint32_t hashidx = perkey_rwlock_ptr_->getRwlockIndex(key);
 
         V value;
-        const std::unordered_map<Key, V, KeyHasher>& tmp_hashtable = hashtables_[hashidx];
-        typename std::unordered_map<Key, V, KeyHasher>::const_iterator iter = tmp_hashtable.find(key);
+        const M& tmp_hashtable = hashtables_[hashidx];
+        typename M::const_iterator iter = tmp_hashtable.find(key);
         if (iter != tmp_hashtable.end()) // key exists
         {
             value = iter->second;
@@ -88,8 +88,8 @@ namespace covered
         return value;
     }*/
 
-    template<class V>
-    void ConcurrentHashtable<V>::insertOrUpdate(const Key& key, const V& value, bool& is_exist)
+    template<class V, class M>
+    void ConcurrentHashtable<V, M>::insertOrUpdate(const Key& key, const V& value, bool& is_exist)
     {
         assert(perkey_rwlock_ptr_ != NULL);
 
@@ -103,8 +103,8 @@ namespace covered
         }
         uint32_t hashidx = perkey_rwlock_ptr_->getRwlockIndex(key);
 
-        std::unordered_map<Key, V, KeyHasher>& tmp_hashtable = hashtables_[hashidx];
-        typename std::unordered_map<Key, V, KeyHasher>::iterator iter = tmp_hashtable.find(key);
+        M& tmp_hashtable = hashtables_[hashidx];
+        typename M::iterator iter = tmp_hashtable.find(key);
         if (iter == tmp_hashtable.end()) // key NOT exist
         {
             tmp_hashtable.insert(std::pair<Key, V>(key, value));
@@ -130,8 +130,9 @@ namespace covered
         return;
     }
 
-    template<class V>
-    void ConcurrentHashtable<V>::insertOrCall(const Key& key, const V& value, bool& is_exist, const std::string& function_name, void* param_ptr)
+    template<class V, class M>
+    template<class Func>
+    void ConcurrentHashtable<V, M>::insertOrCall(const Key& key, const V& value, bool& is_exist, const Func& func)
     {
         assert(perkey_rwlock_ptr_ != NULL);
 
@@ -145,8 +146,8 @@ namespace covered
         }
         uint32_t hashidx = perkey_rwlock_ptr_->getRwlockIndex(key);
 
-        std::unordered_map<Key, V, KeyHasher>& tmp_hashtable = hashtables_[hashidx];
-        typename std::unordered_map<Key, V, KeyHasher>::iterator iter = tmp_hashtable.find(key);
+        M& tmp_hashtable = hashtables_[hashidx];
+        typename M::iterator iter = tmp_hashtable.find(key);
         if (iter == tmp_hashtable.end()) // key NOT exist
         {
             tmp_hashtable.insert(std::pair<Key, V>(key, value));
@@ -159,13 +160,14 @@ namespace covered
         {
             uint64_t original_value_size = iter->second.getSizeForCapacity();
 
-            // Call value's function
-            bool is_erase = iter->second.call(function_name, param_ptr);
+            // Call the function on value
+            bool is_erase = func(iter->second);
             is_exist = true;
 
             updateTotalValueSize_(iter->second.getSizeForCapacity(), original_value_size);
 
             assert(is_erase == false); // NOT erase key-value pair in insertOrCall()
+            UNUSED(is_erase);
         }
 
 
@@ -175,8 +177,9 @@ namespace covered
         return;
     }
 
-    template<class V>
-    void ConcurrentHashtable<V>::callIfExist(const Key& key, bool& is_exist, const std::string& function_name, void* param_ptr)
+    template<class V, class M>
+    template<class Func>
+    void ConcurrentHashtable<V, M>::callIfExist(const Key& key, bool& is_exist, const Func& func)
     {
         assert(perkey_rwlock_ptr_ != NULL);
 
@@ -190,15 +193,15 @@ namespace covered
         }
         uint32_t hashidx = perkey_rwlock_ptr_->getRwlockIndex(key);
 
-        std::unordered_map<Key, V, KeyHasher>& tmp_hashtable = hashtables_[hashidx];
-        typename std::unordered_map<Key, V, KeyHasher>::iterator iter = tmp_hashtable.find(key);
+        M& tmp_hashtable = hashtables_[hashidx];
+        typename M::iterator iter = tmp_hashtable.find(key);
 
         if (iter != tmp_hashtable.end()) // key exists
         {
             uint64_t original_value_size = iter->second.getSizeForCapacity();
 
-            // Call value's function
-            bool is_erase = iter->second.call(function_name, param_ptr);
+            // Call the function on value
+            bool is_erase = func(iter->second);
             is_exist = true;
 
             updateTotalValueSize_(iter->second.getSizeForCapacity(), original_value_size);
@@ -223,8 +226,9 @@ namespace covered
         return;
     }
 
-    template<class V>
-    void ConcurrentHashtable<V>::constCallIfExist(const Key& key, bool& is_exist, const std::string& function_name, void* param_ptr) const
+    template<class V, class M>
+    template<class ConstFunc>
+    void ConcurrentHashtable<V, M>::constCallIfExist(const Key& key, bool& is_exist, const ConstFunc& const_func) const
     {
         assert(perkey_rwlock_ptr_ != NULL);
 
@@ -232,13 +236,13 @@ namespace covered
         MYASSERT(perkey_rwlock_ptr_->isReadOrWriteLocked(key));
         uint32_t hashidx = perkey_rwlock_ptr_->getRwlockIndex(key);
 
-        const std::unordered_map<Key, V, KeyHasher>& tmp_hashtable = hashtables_[hashidx];
-        typename std::unordered_map<Key, V, KeyHasher>::const_iterator iter = tmp_hashtable.find(key);
+        const M& tmp_hashtable = hashtables_[hashidx];
+        typename M::const_iterator iter = tmp_hashtable.find(key);
 
         if (iter != tmp_hashtable.end()) // key exists
         {
-            // Call value's function
-            iter->second.constCall(function_name, param_ptr);
+            // Call the const function on value
+            const_func(iter->second);
             is_exist = true;
         }
         else // key NOT exist
@@ -252,8 +256,8 @@ namespace covered
         return;
     }
 
-    template<class V>
-    void ConcurrentHashtable<V>::eraseIfExist(const Key& key, bool& is_exist)
+    template<class V, class M>
+    void ConcurrentHashtable<V, M>::eraseIfExist(const Key& key, bool& is_exist)
     {
         assert(perkey_rwlock_ptr_ != NULL);
 
@@ -267,8 +271,8 @@ namespace covered
         }
         uint32_t hashidx = perkey_rwlock_ptr_->getRwlockIndex(key);
 
-        std::unordered_map<Key, V, KeyHasher>& tmp_hashtable = hashtables_[hashidx];
-        typename std::unordered_map<Key, V, KeyHasher>::iterator iter = tmp_hashtable.find(key);
+        M& tmp_hashtable = hashtables_[hashidx];
+        typename M::iterator iter = tmp_hashtable.find(key);
         if (iter != tmp_hashtable.end()) // key exists
         {
             uint64_t original_value_size = iter->second.getSizeForCapacity();
@@ -290,20 +294,20 @@ namespace covered
         return;
     }
 
-    template<class V>
-    uint64_t ConcurrentHashtable<V>::getTotalKeySizeForCapcity() const
+    template<class V, class M>
+    uint64_t ConcurrentHashtable<V, M>::getTotalKeySizeForCapcity() const
     {
         return total_key_size_.load(Util::LOAD_CONCURRENCY_ORDER);
     }
     
-    template<class V>
-    uint64_t ConcurrentHashtable<V>::getTotalValueSizeForCapcity() const
+    template<class V, class M>
+    uint64_t ConcurrentHashtable<V, M>::getTotalValueSizeForCapcity() const
     {
         return total_value_size_;
     }
 
-    template<class V>
-    void ConcurrentHashtable<V>::updateTotalValueSize_(uint64_t current_value_size, uint64_t original_value_size)
+    template<class V, class M>
+    void ConcurrentHashtable<V, M>::updateTotalValueSize_(uint64_t current_value_size, uint64_t original_value_size)
     {
         if (current_value_size >= original_value_size)
         {
@@ -318,14 +322,14 @@ namespace covered
 
     // ONLY used by edge snapshot (without locking)
 
-    template<class V>
-    void ConcurrentHashtable<V>::getAllKeyValuePairs(std::unordered_map<Key, V, KeyHasher>& kvpairs) const
+    template<class V, class M>
+    void ConcurrentHashtable<V, M>::getAllKeyValuePairs(std::unordered_map<Key, V, KeyHasher>& kvpairs) const
     {
         // NOTE: NO need to acquire any lock due to only used for snapshots
         for (uint32_t hashtable_idx = 0; hashtable_idx < hashtables_.size(); hashtable_idx++)
         {
-            const std::unordered_map<Key, V, KeyHasher>& tmp_hashtable_const_ref = hashtables_[hashtable_idx];
-            for (typename std::unordered_map<Key, V, KeyHasher>::const_iterator iter = tmp_hashtable_const_ref.begin(); iter != tmp_hashtable_const_ref.end(); iter++)
+            const M& tmp_hashtable_const_ref = hashtables_[hashtable_idx];
+            for (typename M::const_iterator iter = tmp_hashtable_const_ref.begin(); iter != tmp_hashtable_const_ref.end(); iter++)
             {
                 kvpairs.insert(*iter);
             }
@@ -333,16 +337,16 @@ namespace covered
         return;
     }
 
-    template<class V>
-    void ConcurrentHashtable<V>::putKeyValuePair(const Key& key, const V& value, bool& is_exist)
+    template<class V, class M>
+    void ConcurrentHashtable<V, M>::putKeyValuePair(const Key& key, const V& value, bool& is_exist)
     {
         // NOTE: NO need to acquire any lock due to only used for snapshots with only one thread for edge wrapper
 
         assert(perkey_rwlock_ptr_ != NULL);
         uint32_t hashidx = perkey_rwlock_ptr_->getRwlockIndex(key);
 
-        std::unordered_map<Key, V, KeyHasher>& tmp_hashtable = hashtables_[hashidx];
-        typename std::unordered_map<Key, V, KeyHasher>::iterator iter = tmp_hashtable.find(key);
+        M& tmp_hashtable = hashtables_[hashidx];
+        typename M::iterator iter = tmp_hashtable.find(key);
         if (iter == tmp_hashtable.end()) // key NOT exist
         {
             tmp_hashtable.insert(std::pair<Key, V>(key, value));
@@ -0,0 +1,197 @@
+#include "concurrency/futex_rwlock.h"
+
+#include <assert.h>
+#include <climits> // INT_MAX
+#include <linux/futex.h> // FUTEX_WAIT_PRIVATE, FUTEX_WAKE_PRIVATE
+#include <sys/syscall.h> // SYS_futex
+#include <thread> // std::this_thread::yield
+#include <unistd.h> // syscall
+
+#include "common/util.h"
+
+namespace covered
+{
+    // NOTE: futex syscall operates on the raw 32-bit word of state_
+    static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "std::atomic<uint32_t> MUST have the same layout as uint32_t for futex");
+
+    const uint32_t FutexRwlock::kSpinCnt = 128;
+    const uint32_t FutexRwlock::WRITER_FLAG = 0x80000000;
+    const uint32_t FutexRwlock::PENDING_WRITER_UNIT = 0x00010000;
+    const uint32_t FutexRwlock::PENDING_WRITER_MASK = 0x7FFF0000;
+    const uint32_t FutexRwlock::READER_MASK = 0x0000FFFF;
+
+    FutexRwlock::FutexRwlock() : state_(0), parked_cnt_(0) {}
+
+    FutexRwlock::~FutexRwlock() {}
+
+    void FutexRwlock::lock_shared()
+    {
+        uint32_t state = 0;
+
+        // Spin briefly for short critical sections
+        for (uint32_t i = 0; i < kSpinCnt; i++)
+        {
+            if (tryLockSharedOnce_(state))
+            {
+                return;
+            }
+            cpuRelax_();
+        }
+
+        // Park until writers release the lock
+        while (true)
+        {
+            if (tryLockSharedOnce_(state))
+            {
+                return;
+            }
+            if ((state & (WRITER_FLAG | PENDING_WRITER_MASK)) != 0) // NOT park if CAS fails due to concurrent readers
+            {
+                park_(state);
+            }
+        }
+        return;
+    }
+
+    bool FutexRwlock::try_lock_shared()
+    {
+        uint32_t state = 0;
+        return tryLockSharedOnce_(state);
+    }
+
+    void FutexRwlock::unlock_shared()
+    {
+        // NOTE: use seq_cst for the store-load handshake with park_()
+        const uint32_t prev_state = state_.fetch_sub(1, std::memory_order_seq_cst);
+        assert((prev_state & READER_MASK) > 0);
+
+        // ONLY the last reader can unblock pending writers
+        if ((prev_state & READER_MASK) == 1)
+        {
+            wakeIfNecessary_();
+        }
+        return;
+    }
+
+    void FutexRwlock::lock()
+    {
+        if (try_lock()) // Fast path w/o contention
+        {
+            return;
+        }
+
+        // Block new readers until we acquire the lock
+        state_.fetch_add(PENDING_WRITER_UNIT, std::memory_order_relaxed);
+
+        uint32_t state = 0;
+
+        // Spin briefly for short critical sections
+        for (uint32_t i = 0; i < kSpinCnt; i++)
+        {
+            if (tryLockPendingOnce_(state))
+            {
+                return;
+            }
+            cpuRelax_();
+        }
+
+        // Park until the current writer or all current readers release the lock
+        while (true)
+        {
+            if (tryLockPendingOnce_(state))
+            {
+                return;
+            }
+            if ((state & (WRITER_FLAG | READER_MASK)) != 0) // NOT park if CAS fails due to concurrent pending writers
+            {
+                park_(state);
+            }
+        }
+        return;
+    }
+
+    bool FutexRwlock::try_lock()
+    {
+        uint32_t state = state_.load(std::memory_order_relaxed);
+        if ((state & (WRITER_FLAG | READER_MASK)) != 0)
+        {
+            return false;
+        }
+        return state_.compare_exchange_strong(state, state | WRITER_FLAG, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    void FutexRwlock::unlock()
+    {
+        // NOTE: use seq_cst for the store-load handshake with park_()
+        const uint32_t prev_state = state_.fetch_sub(WRITER_FLAG, std::memory_order_seq_cst);
+        assert((prev_state & WRITER_FLAG) != 0);
+        UNUSED(prev_state);
+
+        wakeIfNecessary_();
+        return;
+    }
+
+    bool FutexRwlock::isReadLocked() const
+    {
+        return (state_.load(std::memory_order_acquire) & READER_MASK) > 0;
+    }
+
+    bool FutexRwlock::isWriteLocked() const
+    {
+        return (state_.load(std::memory_order_acquire) & WRITER_FLAG) != 0;
+    }
+
+    void FutexRwlock::cpuRelax_()
+    {
+        #if defined(__x86_64__) || defined(__i386__)
+        __builtin_ia32_pause();
+        #else
+        std::this_thread::yield();
+        #endif
+        return;
+    }
+
+    bool FutexRwlock::tryLockSharedOnce_(uint32_t& state)
+    {
+        state = state_.load(std::memory_order_relaxed);
+        if ((state & (WRITER_FLAG | PENDING_WRITER_MASK)) != 0) // Writer preference
+        {
+            return false;
+        }
+        assert((state & READER_MASK) < READER_MASK); // Reader count overflow
+        return state_.compare_exchange_weak(state, state + 1, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    bool FutexRwlock::tryLockPendingOnce_(uint32_t& state)
+    {
+        state = state_.load(std::memory_order_relaxed);
+        if ((state & (WRITER_FLAG | READER_MASK)) != 0)
+        {
+            return false;
+        }
+        assert((state & PENDING_WRITER_MASK) != 0); // The current writer MUST be pending
+        return state_.compare_exchange_weak(state, state - PENDING_WRITER_UNIT + WRITER_FLAG, std::memory_order_acquire, std::memory_order_relaxed);
+    }
+
+    void FutexRwlock::park_(const uint32_t& expected_state)
+    {
+        // NOTE: the releaser updates state_ before checking parked_cnt_, while we update parked_cnt_ before checking state_ -> at least one side observes the other under seq_cst (no lost wakeup); futex itself re-checks state_ atomically in kernel
+        parked_cnt_.fetch_add(1, std::memory_order_seq_cst);
+        if (state_.load(std::memory_order_seq_cst) == expected_state)
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&state_), FUTEX_WAIT_PRIVATE, expected_state, NULL, NULL, 0); // Return on wakeup, EAGAIN (state changed), or EINTR -> caller re-checks anyway
+        }
+        parked_cnt_.fetch_sub(1, std::memory_order_seq_cst);
+        return;
+    }
+
+    void FutexRwlock::wakeIfNecessary_()
+    {
+        if (parked_cnt_.load(std::memory_order_seq_cst) > 0)
+        {
+            // NOTE: wake up all parked threads, as both readers and writers may be parked on the same word
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&state_), FUTEX_WAKE_PRIVATE, INT_MAX, NULL, NULL, 0);
+        }
+        return;
+    }
+}
@@ -0,0 +1,52 @@
+/*
+ * FutexRwlock: a writer-preferring read-write lock which spins briefly and then parks the thread on a Linux futex.
+ *
+ * NOTE: boost::shared_mutex::try_lock() polling burns the whole (dedicated) core of each waiting thread under contention, while FutexRwlock sleeps in kernel after kSpinCnt failed attempts and is woken up by the releaser.
+ *
+ * NOTE: lock state is a single 32-bit word: bit 31 is the writer flag, bits 16-30 count pending writers (blocking new readers to avoid writer starvation), and bits 0-15 count current readers.
+ */
+
+#ifndef FUTEX_RWLOCK_H
+#define FUTEX_RWLOCK_H
+
+#include <atomic>
+#include <stdint.h>
+
+namespace covered
+{
+    class FutexRwlock
+    {
+    public:
+        FutexRwlock();
+        ~FutexRwlock();
+
+        // The same interfaces as libboost
+        void lock_shared();
+        bool try_lock_shared();
+        void unlock_shared();
+        void lock();
+        bool try_lock();
+        void unlock();
+
+        bool isReadLocked() const;
+        bool isWriteLocked() const;
+    private:
+        static const uint32_t kSpinCnt; // # of failed attempts before parking
+        static const uint32_t WRITER_FLAG;
+        static const uint32_t PENDING_WRITER_UNIT;
+        static const uint32_t PENDING_WRITER_MASK;
+        static const uint32_t READER_MASK;
+
+        static void cpuRelax_();
+
+        bool tryLockSharedOnce_(uint32_t& state);
+        bool tryLockPendingOnce_(uint32_t& state); // For writer which has been counted in pending writers
+        void park_(const uint32_t& expected_state);
+        void wakeIfNecessary_();
+
+        std::atomic<uint32_t> state_;
+        std::atomic<uint32_t> parked_cnt_; // # of threads parked (or about to park) on state_ (avoid futex syscall in unlock if zero)
+    };
+}
+
+#endif
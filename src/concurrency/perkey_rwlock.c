@@ -22,7 +22,7 @@ namespace covered
         }
 
         // Allocate space for rwlocks
-        rwlock_hashtable_ = new boost::shared_mutex[rwlock_cnt];
+        rwlock_hashtable_ = new FutexRwlock[rwlock_cnt];
         assert(rwlock_hashtable_ != NULL);
 
         #ifdef DEBUG_PERKEY_RWLOCK
@@ -33,22 +33,6 @@ namespace covered
         perlock_current_writer_.resize(rwlock_cnt);
         #endif
 
-        // Allocate space for read lock counts
-        read_lock_cnts_ = new std::atomic<uint32_t>[rwlock_cnt];
-        assert(read_lock_cnts_ != NULL);
-        for (uint32_t i = 0; i < rwlock_cnt; i++)
-        {
-            read_lock_cnts_[i].store(0, Util::STORE_CONCURRENCY_ORDER);
-        }
-
-        // Allocate space for write lock flags
-        write_lock_flags_ = new std::atomic<bool>[rwlock_cnt];
-        assert(write_lock_flags_ != NULL);
-        for (uint32_t i = 0; i < rwlock_cnt; i++)
-        {
-            write_lock_flags_[i].store(false, Util::STORE_CONCURRENCY_ORDER);
-        }
-
         // NOTE: hashing for rwlock index is orthogonal with hash partition for DHT-based content discovery
         hash_wrapper_ptr_ = HashWrapperBase::getHashWrapperByHashName(Util::MMH3_HASH_NAME);
         assert(hash_wrapper_ptr_ != NULL);
@@ -66,71 +50,39 @@ namespace covered
         perlock_mutex_for_debug_ = NULL;
         #endif
 
-        assert(read_lock_cnts_ != NULL);
-        delete[] read_lock_cnts_;
-        read_lock_cnts_ = NULL;
-
-        assert(write_lock_flags_ != NULL);
-        delete[] write_lock_flags_;
-        write_lock_flags_ = NULL;
-
         assert(hash_wrapper_ptr_ != NULL);
         delete hash_wrapper_ptr_;
         hash_wrapper_ptr_ = NULL;
     }
 
-    void PerkeyRwlock::acquire_lock_shared(const Key& key, const std::string& context_name)
-    {
-        while (true) // Frequent polling
-        {
-            if (try_lock_shared_(key, context_name))
-            {
-                #ifdef DEBUG_PERKEY_RWLOCK
-                uint32_t rwlock_index = getRwlockIndex(key);
-                perlock_mutex_for_debug_[rwlock_index].lock();
-                if (perlock_current_readers_[rwlock_index].find(context_name) == perlock_current_readers_[rwlock_index].end())
-                {
-                    perlock_current_readers_[rwlock_index].insert(std::pair(context_name, 1));
-                }
-                else
-                {
-                    perlock_current_readers_[rwlock_index][context_name] += 1;
-                }
-                perlock_mutex_for_debug_[rwlock_index].unlock();
-                #endif
-
-                break;
-            }
-        }
-        return;
-    }
-
-    bool PerkeyRwlock::try_lock_shared_(const Key& key, const std::string& context_name)
+    void PerkeyRwlock::acquire_lock_shared(const Key& key, const char* context_name)
     {
         assert(rwlock_hashtable_ != NULL);
-        assert(read_lock_cnts_ != NULL);
 
         uint32_t rwlock_index = getRwlockIndex(key);
-        bool result = rwlock_hashtable_[rwlock_index].try_lock_shared();
+        rwlock_hashtable_[rwlock_index].lock_shared(); // Spin briefly and then park
 
-        if (result)
+        #ifdef DEBUG_PERKEY_RWLOCK
+        perlock_mutex_for_debug_[rwlock_index].lock();
+        if (perlock_current_readers_[rwlock_index].find(context_name) == perlock_current_readers_[rwlock_index].end())
         {
-            read_lock_cnts_[rwlock_index].fetch_add(1, Util::RMW_CONCURRENCY_ORDER);
-
-            #ifdef DEBUG_PERKEY_RWLOCK
-            // std::ostringstream oss;
-            // oss << "acquire a read lock for key " << key.getKeyDebugstr() << " with rwlock_index " << rwlock_index << " in " << context_name;
-            // Util::dumpDebugMsg(instance_name_, oss.str());
-            #endif
+            perlock_current_readers_[rwlock_index].insert(std::pair<std::string, uint32_t>(context_name, 1));
         }
+        else
+        {
+            perlock_current_readers_[rwlock_index][context_name] += 1;
+        }
+        perlock_mutex_for_debug_[rwlock_index].unlock();
+        #else
+        UNUSED(context_name);
+        #endif
 
-        return result;
+        return;
     }
 
-    void PerkeyRwlock::unlock_shared(const Key& key, const std::string& context_name)
+    void PerkeyRwlock::unlock_shared(const Key& key, const char* context_name)
     {
         assert(rwlock_hashtable_ != NULL);
-        assert(read_lock_cnts_ != NULL);
 
         uint32_t rwlock_index = getRwlockIndex(key);
 
@@ -147,67 +99,36 @@ namespace covered
             perlock_current_readers_[rwlock_index].erase(tmp_iter);
         }
         perlock_mutex_for_debug_[rwlock_index].unlock();
-
-        // std::ostringstream oss;
-        // oss << "release a read lock for key " << key.getKeyDebugstr() << " with rwlock_index " << rwlock_index << " in " << context_name;
-        // Util::dumpDebugMsg(instance_name_, oss.str());
+        #else
+        UNUSED(context_name);
         #endif
 
-        read_lock_cnts_[rwlock_index].fetch_sub(1, Util::RMW_CONCURRENCY_ORDER);
         rwlock_hashtable_[rwlock_index].unlock_shared();
 
         return;
     }
 
-    void PerkeyRwlock::acquire_lock(const Key& key, const std::string& context_name)
-    {
-        while (true) // Frequent polling
-        {
-            if (try_lock_(key, context_name))
-            {
-                #ifdef DEBUG_PERKEY_RWLOCK
-                uint32_t rwlock_index = getRwlockIndex(key);
-                perlock_mutex_for_debug_[rwlock_index].lock();
-                perlock_current_writer_[rwlock_index] = context_name;
-                perlock_mutex_for_debug_[rwlock_index].unlock();
-                #endif
-
-                break;
-            }
-        }
-        return;
-    }
-
-    bool PerkeyRwlock::try_lock_(const Key& key, const std::string& context_name)
+    void PerkeyRwlock::acquire_lock(const Key& key, const char* context_name)
     {
         assert(rwlock_hashtable_ != NULL);
-        assert(write_lock_flags_ != NULL);
 
         uint32_t rwlock_index = getRwlockIndex(key);
-        bool result = rwlock_hashtable_[rwlock_index].try_lock();
-
-        if (result)
-        {
-            // Original write lock flag MUST be false
-            bool original_write_lock_flag = write_lock_flags_[rwlock_index].load(Util::LOAD_CONCURRENCY_ORDER);
-            assert(!original_write_lock_flag);
-
-            write_lock_flags_[rwlock_index].store(true, Util::STORE_CONCURRENCY_ORDER);
+        rwlock_hashtable_[rwlock_index].lock(); // Spin briefly and then park
 
-            #ifdef DEBUG_PERKEY_RWLOCK
-            // std::ostringstream oss;
-            // oss << "acquire a write lock for key " << key.getKeyDebugstr() << " with rwlock_index " << rwlock_index << " in " << context_name;
-            // Util::dumpDebugMsg(instance_name_, oss.str());
-            #endif
-        }
+        #ifdef DEBUG_PERKEY_RWLOCK
+        perlock_mutex_for_debug_[rwlock_index].lock();
+        perlock_current_writer_[rwlock_index] = context_name;
+        perlock_mutex_for_debug_[rwlock_index].unlock();
+        #else
+        UNUSED(context_name);
+        #endif
 
-        return result;
+        return;
     }
 
-    void PerkeyRwlock::unlock(const Key& key, const std::string& context_name)
+    void PerkeyRwlock::unlock(const Key& key, const char* context_name)
     {
         assert(rwlock_hashtable_ != NULL);
-        assert(write_lock_flags_ != NULL);
 
         uint32_t rwlock_index = getRwlockIndex(key);
 
@@ -215,13 +136,10 @@ namespace covered
         perlock_mutex_for_debug_[rwlock_index].lock();
         perlock_current_writer_[rwlock_index] = "";
         perlock_mutex_for_debug_[rwlock_index].unlock();
-
-        // std::ostringstream oss;
-        // oss << "release a write lock for key " << key.getKeyDebugstr() << " with rwlock_index " << rwlock_index << " in " << context_name;
-        // Util::dumpDebugMsg(instance_name_, oss.str());
+        #else
+        UNUSED(context_name);
         #endif
 
-        write_lock_flags_[rwlock_index].store(false, Util::STORE_CONCURRENCY_ORDER);
         rwlock_hashtable_[rwlock_index].unlock();
         
         return;
@@ -229,32 +147,31 @@ namespace covered
 
     bool PerkeyRwlock::isReadLocked(const Key& key) const
     {
-        assert(read_lock_cnts_ != NULL);
+        assert(rwlock_hashtable_ != NULL);
 
         uint32_t rwlock_index = getRwlockIndex(key);
-        bool is_read_locked = (read_lock_cnts_[rwlock_index].load(Util::LOAD_CONCURRENCY_ORDER) > 0);
+        bool is_read_locked = rwlock_hashtable_[rwlock_index].isReadLocked();
 
         return is_read_locked;
     }
 
     bool PerkeyRwlock::isWriteLocked(const Key& key) const
     {
-        assert(write_lock_flags_ != NULL);
+        assert(rwlock_hashtable_ != NULL);
 
         uint32_t rwlock_index = getRwlockIndex(key);
-        bool is_write_locked = (write_lock_flags_[rwlock_index].load(Util::LOAD_CONCURRENCY_ORDER) == true);
+        bool is_write_locked = rwlock_hashtable_[rwlock_index].isWriteLocked();
 
         return is_write_locked;
     }
 
     bool PerkeyRwlock::isReadOrWriteLocked(const Key& key) const
     {
-        assert(read_lock_cnts_ != NULL);
-        assert(write_lock_flags_ != NULL);
+        assert(rwlock_hashtable_ != NULL);
 
         uint32_t rwlock_index = getRwlockIndex(key);
-        bool is_read_locked = (read_lock_cnts_[rwlock_index].load(Util::LOAD_CONCURRENCY_ORDER) > 0);
-        bool is_write_locked = (write_lock_flags_[rwlock_index].load(Util::LOAD_CONCURRENCY_ORDER) == true);
+        bool is_read_locked = rwlock_hashtable_[rwlock_index].isReadLocked();
+        bool is_write_locked = rwlock_hashtable_[rwlock_index].isWriteLocked();
 
         return is_read_locked || is_write_locked;
     }
@@ -2,6 +2,8 @@
  * PerkeyRwlock: provide key-level read-write lock for fine-grained concurrency control.
  *
  * NOTE: if disable fine-grained locking, PerkeyRwlock will go back to a single read-write lock.
+ *
+ * NOTE: each per-key rwlock is a FutexRwlock (spin briefly and then park), whose lock state also answers isReadLocked()/isWriteLocked() w/o extra atomic counters; context names are compiled out unless DEBUG_PERKEY_RWLOCK is defined.
  * 
  * By Siyuan Sheng (2023.06.15).
  */
@@ -11,15 +13,16 @@
 
 //#define DEBUG_PERKEY_RWLOCK
 
-#include <atomic>
 #include <string>
 #ifdef DEBUG_PERKEY_RWLOCK
 #include <unordered_map>
-#endif
+#include <vector>
 
-#include <boost/thread/shared_mutex.hpp>
+#include <boost/thread/mutex.hpp>
+#endif
 
 #include "common/key.h"
+#include "concurrency/futex_rwlock.h"
 #include "hash/hash_wrapper_base.h"
 
 namespace covered
@@ -31,10 +34,11 @@ namespace covered
         ~PerkeyRwlock();
 
         // The same interfaces as libboost
-        void acquire_lock_shared(const Key& key, const std::string& context_name);
-        void unlock_shared(const Key& key, const std::string& context_name);
-        void acquire_lock(const Key& key, const std::string& context_name);
-        void unlock(const Key& key, const std::string& context_name);
+        // NOTE: context_name is a string literal (NOT std::string) to avoid constructing (and allocating) a string for each lock operation
+        void acquire_lock_shared(const Key& key, const char* context_name);
+        void unlock_shared(const Key& key, const char* context_name);
+        void acquire_lock(const Key& key, const char* context_name);
+        void unlock(const Key& key, const char* context_name);
 
         bool isReadLocked(const Key& key) const;
         bool isWriteLocked(const Key& key) const;
@@ -44,17 +48,12 @@ namespace covered
     private:
         static const std::string kClassName;
 
-        bool try_lock_shared_(const Key& key, const std::string& context_name);
-        bool try_lock_(const Key& key, const std::string& context_name);
-
         std::string instance_name_;
         const uint32_t fine_grained_locking_size_; // Come from Config::fine_grained_locking_size_
         const bool enable_fine_grained_locking_; // Determined by the specific local edge cache
 
-        // NOTE: we have to use dynamic array for boost::shared_mutex and std::atomic, as they do NOT have copy constructor and operator= for std::vector (e.g., resize() and push_back())
-        boost::shared_mutex* rwlock_hashtable_;
-        std::atomic<uint32_t>* read_lock_cnts_;
-        std::atomic<bool>* write_lock_flags_;
+        // NOTE: we have to use dynamic array for FutexRwlock, as it does NOT have copy constructor and operator= for std::vector (e.g., resize() and push_back())
+        FutexRwlock* rwlock_hashtable_;
         HashWrapperBase* hash_wrapper_ptr_;
 
         #ifdef DEBUG_PERKEY_RWLOCK
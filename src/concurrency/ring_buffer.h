@@ -1,5 +1,11 @@
 /*
- * RingBuffer: provide classical non-blocking/polling-based ring buffer interfaces for concurrency between provider(s) and a customer (lock free if w/ one provide; or based on locking if w/ multiple providers).
+ * RingBuffer: provide classical non-blocking/polling-based ring buffer interfaces for concurrency between provider(s) and a customer (lock free for both single provider (SPSC) and multiple providers (MPSC)).
+ *
+ * NOTE: capacity is rounded up to a power of two for mask indexing; each slot has a sequence number (similar as Vyukov's bounded queue), such that multiple providers claim slots by CAS on head_ and publish elements by release stores, while the only customer owns tail_.
+ *
+ * NOTE: if ring buffer is full, push() either drops the element immediately (default), or blocks by yielding until free space -> if an owner node is given, a blocked push waits until the node stops running (i.e., the customer may NOT pop any more); otherwise, it is bounded by BLOCK_WHEN_FULL_TIMEOUT_US to avoid hanging a provider after the customer finishes. Drops and blocked pushes are counted for queue-depth statistics.
+ *
+ * NOTE: the high-water mark of queue depth is sampled by the customer on the pop side, such that providers never read tail_ (avoid false sharing between provider(s) and customer).
  * 
  * By Siyuan Sheng (2023.06.14).
  */
@@ -7,49 +13,81 @@
 #ifndef RING_BUFFER_H
 #define RING_BUFFER_H
 
+#include <atomic>
 #include <string>
 #include <vector>
 
-#include "concurrency/rwlock.h"
-
 namespace covered
 {
+    class NodeWrapperBase;
+
     // NOTE: class T must support default constructor and operator=.
     template<class T>
     class RingBuffer
     {
     public:
-        RingBuffer(const T& default_element, const uint32_t& buffer_size, const bool& with_multi_providers);
+        static const uint64_t BLOCK_WHEN_FULL_TIMEOUT_US; // ONLY used if without owner node
+        static const uint32_t MAX_ELEMENTCNT_SAMPLE_INTERVAL; // Sample queue depth every MAX_ELEMENTCNT_SAMPLE_INTERVAL pops (MUST be power of two)
+
+        RingBuffer(const T& default_element, const uint32_t& buffer_size, const bool& with_multi_providers, const bool& is_block_when_full = false, const NodeWrapperBase* owner_node_wrapper_ptr = NULL);
         ~RingBuffer();
         void getAllToRelease(std::vector<T>& remaining_elements); // NOTE: NO need to acquire any lock due to ONLY being invoked once in deconstructor
 
         // NOTE: thread-safe structure cannot return a reference, which may violate atomicity
-        bool push(const T& element);
+        bool push(const T& element); // Return false if ring buffer is full (after blocking if is_block_when_full_ = true, i.e., the owner node stops or timeout)
+        uint32_t pushBatch(const std::vector<T>& elements); // Push elements in order until the first failure; return # of pushed elements
         bool pop(T& element); // Non-blocking pop: return false if ring buffer is empty
+        uint32_t popBatch(std::vector<T>& elements, const uint32_t& max_cnt); // Non-blocking pop of at most max_cnt elements appended into elements; return # of popped elements
 
         bool withMultiProviders() const;
+        bool isBlockWhenFull() const;
+        const NodeWrapperBase* getOwnerNodeWrapperPtr() const;
         uint32_t getElementCnt() const;
         uint32_t getBufferSize() const;
         T getDefaultElement() const;
 
-        //uint64_t getSizeForCapacity() const;
+        // Queue-depth statistics
+        uint64_t getPushcnt() const;
+        uint64_t getDropcnt() const;
+        uint64_t getBlockedPushcnt() const;
+        uint32_t getMaxElementCnt() const; // High-water mark of # of elements (sampled by the customer)
+        std::string getStatisticsStr() const;
 
-        // NOTE: if you want to use getElementsForDebug() for debugging under multiple providers/readers, providers/readers of ring buffer should be protected by read-write locking
-        //std::vector<T> getElementsForDebug() const;
+        //uint64_t getSizeForCapacity() const;
 
-        const RingBuffer<T>& operator=(const RingBuffer<T>& other);
+        const RingBuffer<T>& operator=(const RingBuffer<T>& other); // NOTE: NOT thread safe (ONLY used to deep copy subthread params before launching subthreads)
     private:
         static const std::string kClassName;
 
-        bool with_multi_providers_; // If need to support multiple providers
-        Rwlock* rwlock_for_multi_providers_ptr_; // Provide atomicity for multiple providers (only work if with_multi_providers_ is true)
+        class Slot
+        {
+        public:
+            std::atomic<uint64_t> seqnum; // Equal to position if free to push; position + 1 if pushed and NOT popped yet
+            T element;
+        };
+
+        void allocateSlots_(const uint32_t& buffer_size);
+        void releaseSlots_();
+        bool tryPush_(const T& element);
+        bool isBlockingAllowed_(const uint64_t& deadline_us) const;
+        void updateMaxElementCnt_(const uint64_t& tail_before_pop); // ONLY invoked by the customer
 
-        volatile uint32_t head_;
-		volatile uint32_t tail_;
-		volatile uint32_t buffer_size_; // Come from Config::data_request_buffer_size_
+        bool with_multi_providers_; // If need to support multiple providers (CAS on head_)
+        bool is_block_when_full_; // Overload policy if ring buffer is full (block: yield until free space; drop: fail immediately)
+        const NodeWrapperBase* owner_node_wrapper_ptr_; // Block until the node stops running if full (NULL: block until timeout)
+        uint32_t buffer_size_; // Come from Config::data_request_buffer_size_
+        uint32_t capacity_; // Power of two no smaller than buffer_size_
+        uint64_t capacity_mask_;
         T default_element_;
-        std::vector<T> ring_buffer_;
+        Slot* slots_;
+
+        // NOTE: pad indexes into different cache lines to avoid false sharing between provider(s) and customer
+        alignas(64) std::atomic<uint64_t> head_; // Next position to push (i.e., # of pushed elements)
+        alignas(64) std::atomic<uint64_t> tail_; // Next position to pop (i.e., # of popped elements; ONLY updated by the customer)
+        std::atomic<uint32_t> max_elementcnt_; // ONLY updated by the customer
+        alignas(64) std::atomic<uint64_t> dropcnt_; // Rarely updated by providers
+        std::atomic<uint64_t> blocked_pushcnt_;
     };
 }
 
-#endif
\ No newline at end of file
+#endif
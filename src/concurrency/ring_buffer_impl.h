@@ -5,62 +5,37 @@
 
 #include <assert.h>
 #include <sstream>
+#include <thread> // std::this_thread::yield
 
+#include "common/node_wrapper_base.h"
 #include "common/util.h"
 
 namespace covered
 {
+    template<class T>
+    const uint64_t RingBuffer<T>::BLOCK_WHEN_FULL_TIMEOUT_US = SEC2US(1);
+
+    template<class T>
+    const uint32_t RingBuffer<T>::MAX_ELEMENTCNT_SAMPLE_INTERVAL = 64;
+
     template<class T>
     const std::string RingBuffer<T>::kClassName = "RingBuffer<" + std::string(typeid(T).name()) + ">";
 
     template<class T>
-    RingBuffer<T>::RingBuffer(const T& default_element, const uint32_t& buffer_size, const bool& with_multi_providers) : with_multi_providers_(with_multi_providers)
+    RingBuffer<T>::RingBuffer(const T& default_element, const uint32_t& buffer_size, const bool& with_multi_providers, const bool& is_block_when_full, const NodeWrapperBase* owner_node_wrapper_ptr) : with_multi_providers_(with_multi_providers), is_block_when_full_(is_block_when_full), owner_node_wrapper_ptr_(owner_node_wrapper_ptr), head_(0), tail_(0), max_elementcnt_(0), dropcnt_(0), blocked_pushcnt_(0)
     {
         assert(buffer_size > 0);
 
-        if (with_multi_providers)
-        {
-            rwlock_for_multi_providers_ptr_ = new Rwlock("rwlock_for_multi_providers_ptr_");
-            assert(rwlock_for_multi_providers_ptr_ != NULL);
-        }
-        else
-        {
-            rwlock_for_multi_providers_ptr_ = NULL;
-        }
-
-        head_ = 0;
-        tail_ = 0;
-        buffer_size_ = buffer_size;
         default_element_ = default_element;
-        ring_buffer_.resize(buffer_size, default_element);
+        slots_ = NULL;
+        allocateSlots_(buffer_size);
     }
 
     template<class T>
     RingBuffer<T>::~RingBuffer()
     {
-        /*
-        // NOTE: poped pointers are released outside RingBuffer, yet remaining pointers in ring_buffer_ are released by RingBuffer
-        while (true)
-        {
-            T* ptr = pop();
-            if (ptr != NULL)
-            {
-                delete ptr;
-                ptr = NULL;
-            }
-            else
-            {
-                break;
-            }
-        }
-        */
-        
-        if (with_multi_providers_)
-        {
-            assert(rwlock_for_multi_providers_ptr_ != NULL);
-            delete rwlock_for_multi_providers_ptr_;
-            rwlock_for_multi_providers_ptr_ = NULL;
-        }
+        // NOTE: poped elements are released outside RingBuffer, and remaining elements should be released outside RingBuffer by getAllToRelease()
+        releaseSlots_();
     }
 
     template<class T>
@@ -68,13 +43,7 @@ namespace covered
     {
         // NOTE: NO need to acquire any lock due to ONLY being invoked once in deconstructor
 
-        while (tail_ != head_)
-        {
-            remaining_elements.push_back(ring_buffer_[tail_]);
-            ring_buffer_[tail_] = default_element_;
-
-            tail_ = (tail_ + 1) % buffer_size_;
-        }
+        while (popBatch(remaining_elements, capacity_) > 0) {}
 
         return;
     }
@@ -82,81 +51,105 @@ namespace covered
     template<class T>
     bool RingBuffer<T>::push(const T& element)
     {
-        /*
-        if (ptr == NULL)
+        bool is_successful = tryPush_(element);
+        if (!is_successful && is_block_when_full_) // Backpressure: wait for the customer to free space
         {
-            Util::dumpErrorMsg(kClassName, "ptr is NULL for push()!");
-            exit(1);
+            blocked_pushcnt_.fetch_add(1, std::memory_order_relaxed);
+
+            const uint64_t deadline_us = Util::getCurrentMonotonicTimeUs() + BLOCK_WHEN_FULL_TIMEOUT_US;
+            while (!is_successful)
+            {
+                std::this_thread::yield();
+                is_successful = tryPush_(element);
+                if (!is_successful && !isBlockingAllowed_(deadline_us))
+                {
+                    break; // Customer may NOT pop any more (e.g., node is finished)
+                }
+            }
         }
-        */
-        
-        // Acquire a write lock
-        const std::string context_name = "RingBuffer::push()";
-        if (with_multi_providers_)
+
+        if (!is_successful)
         {
-            assert(rwlock_for_multi_providers_ptr_ != NULL);
-            rwlock_for_multi_providers_ptr_->acquire_lock(context_name);
+            uint64_t prev_dropcnt = dropcnt_.fetch_add(1, std::memory_order_relaxed);
+            if (prev_dropcnt == 0) // NOTE: avoid flooding logs under overload
+            {
+                Util::dumpWarnMsg(kClassName, "ring buffer is full -> drop the element (NOT warn for subsequent drops, which are tracked by statistics)!");
+            }
         }
 
-        bool is_successful = false;
+        return is_successful;
+    }
 
-        if ((head_ + 1) % buffer_size_ == tail_) // ring buffer is full
+    template<class T>
+    uint32_t RingBuffer<T>::pushBatch(const std::vector<T>& elements)
+    {
+        uint32_t pushed_cnt = 0;
+        for (uint32_t i = 0; i < elements.size(); i++)
         {
-            Util::dumpWarnMsg(kClassName, "ring buffer is fulll!");
-            is_successful = false;
+            if (!push(elements[i]))
+            {
+                break; // Keep order of elements
+            }
+            pushed_cnt++;
         }
-        else // still with free space
+        return pushed_cnt;
+    }
+
+    template<class T>
+    bool RingBuffer<T>::pop(T& element)
+    {
+        // NOTE: NO need to acquire any lock, as there will be ONLY one customer even if with multiple providers
+
+        const uint64_t pos = tail_.load(std::memory_order_relaxed);
+        Slot& tmp_slot = slots_[pos & capacity_mask_];
+        const uint64_t seqnum = tmp_slot.seqnum.load(std::memory_order_acquire);
+        if (seqnum != pos + 1) // Ring buffer is empty (or the provider claiming pos has NOT published the element yet)
         {
-            //assert(ring_buffer_[head_] == NULL);
-            ring_buffer_[head_] = element;
-            //assert(ring_buffer_[head_] != NULL);
-            
-            head_ = (head_ + 1) % buffer_size_;
-            is_successful = true;
+            return false;
         }
 
-        if (with_multi_providers_)
+        if ((pos & (MAX_ELEMENTCNT_SAMPLE_INTERVAL - 1)) == 0)
         {
-            rwlock_for_multi_providers_ptr_->unlock(context_name);
+            updateMaxElementCnt_(pos);
         }
 
-        return is_successful;
+        element = tmp_slot.element;
+        tmp_slot.element = default_element_;
+        tmp_slot.seqnum.store(pos + capacity_, std::memory_order_release); // Free the slot for the provider in the next round
+        tail_.store(pos + 1, std::memory_order_release);
+
+        return true;
     }
 
     template<class T>
-    bool RingBuffer<T>::pop(T& element)
+    uint32_t RingBuffer<T>::popBatch(std::vector<T>& elements, const uint32_t& max_cnt)
     {
-        // NOTE: NO need to acquire a write lock, as there will be ONLY one reader even if with multiple providers
+        // NOTE: NO need to acquire any lock, as there will be ONLY one customer even if with multiple providers
 
-        //const std::string context_name = "RingBuffer::pop()";
-        //if (with_multi_providers)
-        //{
-        //    assert(rwlock_for_multi_providers_ptr_ != NULL);
-        //    rwlock_for_multi_providers_ptr_->acquire_lock(context_name);
-        //}
-
-        bool is_successful = false;
-
-        if (tail_ == head_) // ring buffer is empty
-        {
-            is_successful = false;
-        }
-        else // ring buffer is NOT empty
+        uint64_t pos = tail_.load(std::memory_order_relaxed);
+        uint32_t popped_cnt = 0;
+        while (popped_cnt < max_cnt)
         {
-            element = ring_buffer_[tail_];
-            //assert(result != NULL);
-            ring_buffer_[tail_] = default_element_;
+            Slot& tmp_slot = slots_[pos & capacity_mask_];
+            if (tmp_slot.seqnum.load(std::memory_order_acquire) != pos + 1) // No more published elements
+            {
+                break;
+            }
 
-            tail_ = (tail_ + 1) % buffer_size_;
-            is_successful = true;
+            elements.push_back(tmp_slot.element);
+            tmp_slot.element = default_element_;
+            tmp_slot.seqnum.store(pos + capacity_, std::memory_order_release);
+            pos++;
+            popped_cnt++;
         }
 
-        //if (with_multi_providers)
-        //{
-        //    rwlock_for_multi_providers_ptr_->unlock(context_name);
-        //}
+        if (popped_cnt > 0)
+        {
+            updateMaxElementCnt_(pos - popped_cnt); // Sample queue depth once for the whole batch
+            tail_.store(pos, std::memory_order_release); // Update tail once for the whole batch
+        }
 
-        return is_successful;
+        return popped_cnt;
     }
 
     template<class T>
@@ -165,20 +158,34 @@ namespace covered
         return with_multi_providers_;
     }
 
+    template<class T>
+    bool RingBuffer<T>::isBlockWhenFull() const
+    {
+        return is_block_when_full_;
+    }
+
+    template<class T>
+    const NodeWrapperBase* RingBuffer<T>::getOwnerNodeWrapperPtr() const
+    {
+        return owner_node_wrapper_ptr_;
+    }
+
     template<class T>
     uint32_t RingBuffer<T>::getElementCnt() const
     {
-        uint32_t size = 0;
-        if (head_ >= tail_)
+        // NOTE: load tail before head, such that head >= tail even if under concurrent push/pop
+        const uint64_t tmp_tail = tail_.load(std::memory_order_acquire);
+        const uint64_t tmp_head = head_.load(std::memory_order_acquire);
+        if (tmp_head <= tmp_tail)
         {
-            size = head_ - tail_;
+            return 0;
         }
-        else
+        uint64_t size = tmp_head - tmp_tail; // NOTE: include elements claimed yet NOT published by providers
+        if (size > capacity_)
         {
-            size = head_ + buffer_size_ - tail_;
+            size = capacity_;
         }
-        assert(size >= 0 && size < buffer_size_);
-        return size;
+        return static_cast<uint32_t>(size);
     }
 
     template<class T>
@@ -193,63 +200,180 @@ namespace covered
         return default_element_;
     }
 
+    template<class T>
+    uint64_t RingBuffer<T>::getPushcnt() const
+    {
+        return head_.load(std::memory_order_relaxed);
+    }
+
+    template<class T>
+    uint64_t RingBuffer<T>::getDropcnt() const
+    {
+        return dropcnt_.load(std::memory_order_relaxed);
+    }
+
+    template<class T>
+    uint64_t RingBuffer<T>::getBlockedPushcnt() const
+    {
+        return blocked_pushcnt_.load(std::memory_order_relaxed);
+    }
+
+    template<class T>
+    uint32_t RingBuffer<T>::getMaxElementCnt() const
+    {
+        return max_elementcnt_.load(std::memory_order_relaxed);
+    }
+
+    template<class T>
+    std::string RingBuffer<T>::getStatisticsStr() const
+    {
+        std::ostringstream oss;
+        oss << "capacity: " << capacity_ << "; pushcnt: " << getPushcnt() << "; dropcnt: " << getDropcnt() << "; blocked pushcnt: " << getBlockedPushcnt() << "; max queue depth: " << getMaxElementCnt() << "; current queue depth: " << getElementCnt() << "; overload policy: " << (is_block_when_full_?"block":"drop");
+        return oss.str();
+    }
+
     /*template<class T>
     uint64_t RingBuffer<T>::getSizeForCapacity() const
     {
         uint64_t size = 0;
-        for (uint32_t ring_buffer_idx = tail_; ring_buffer_idx != head_; ring_buffer_idx++)
+        for (uint64_t pos = tail_; pos != head_; pos++)
         {
-            if (ring_buffer_idx >= buffer_size_)
-            {
-                ring_buffer_idx %= buffer_size_;
-            }
-            size += ring_buffer_[ring_buffer_idx].getSizeForCapacity();
+            size += slots_[pos & capacity_mask_].element.getSizeForCapacity();
         }
         return size;
     }*/
 
-    /*template<class T>
-    std::vector<T> RingBuffer<T>::getElementsForDebug() const
+    template<class T>
+    const RingBuffer<T>& RingBuffer<T>::operator=(const RingBuffer<T>& other)
+    {
+        with_multi_providers_ = other.with_multi_providers_;
+        is_block_when_full_ = other.is_block_when_full_;
+        owner_node_wrapper_ptr_ = other.owner_node_wrapper_ptr_;
+        default_element_ = other.default_element_;
+
+        // Deep copy remaining elements to the beginning of new slots
+        releaseSlots_();
+        allocateSlots_(other.buffer_size_);
+        const uint64_t other_tail = other.tail_.load(std::memory_order_acquire);
+        const uint64_t other_head = other.head_.load(std::memory_order_acquire);
+        uint64_t pos = 0;
+        for (uint64_t other_pos = other_tail; other_pos < other_head; other_pos++)
+        {
+            slots_[pos].element = other.slots_[other_pos & other.capacity_mask_].element;
+            slots_[pos].seqnum.store(pos + 1, std::memory_order_relaxed);
+            pos++;
+        }
+        head_.store(pos, std::memory_order_release);
+        tail_.store(0, std::memory_order_release);
+
+        dropcnt_.store(other.dropcnt_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        blocked_pushcnt_.store(other.blocked_pushcnt_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        max_elementcnt_.store(other.max_elementcnt_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        return *this;
+    }
+
+    template<class T>
+    void RingBuffer<T>::allocateSlots_(const uint32_t& buffer_size)
+    {
+        assert(slots_ == NULL);
+
+        buffer_size_ = buffer_size;
+        capacity_ = 1;
+        while (capacity_ < buffer_size)
+        {
+            assert(capacity_ <= (UINT32_MAX >> 1));
+            capacity_ <<= 1;
+        }
+        capacity_mask_ = capacity_ - 1;
+
+        slots_ = new Slot[capacity_];
+        assert(slots_ != NULL);
+        for (uint32_t i = 0; i < capacity_; i++)
+        {
+            slots_[i].seqnum.store(i, std::memory_order_relaxed);
+            slots_[i].element = default_element_;
+        }
+        head_.store(0, std::memory_order_relaxed);
+        tail_.store(0, std::memory_order_relaxed);
+        return;
+    }
+
+    template<class T>
+    void RingBuffer<T>::releaseSlots_()
     {
-        std::vector<T> tmp_elements;
-        uint32_t i = tail_;
+        if (slots_ != NULL)
+        {
+            delete[] slots_;
+            slots_ = NULL;
+        }
+        return;
+    }
+
+    template<class T>
+    bool RingBuffer<T>::tryPush_(const T& element)
+    {
+        uint64_t pos = head_.load(std::memory_order_relaxed);
+        Slot* tmp_slot_ptr = NULL;
         while (true)
         {
-            if (i == head_)
+            tmp_slot_ptr = &slots_[pos & capacity_mask_];
+            const uint64_t seqnum = tmp_slot_ptr->seqnum.load(std::memory_order_acquire);
+            const int64_t diff = static_cast<int64_t>(seqnum - pos);
+            if (diff == 0) // The slot is free for pos
             {
-                break;
+                if (!with_multi_providers_) // Single provider owns head_
+                {
+                    head_.store(pos + 1, std::memory_order_relaxed);
+                    break;
+                }
+                else if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) // Claim pos among multiple providers
+                {
+                    break;
+                }
+                // NOTE: pos has been updated by compare_exchange_weak if fail
+            }
+            else if (diff < 0) // The slot still has the element of the previous round -> ring buffer is full
+            {
+                return false;
             }
-            else
+            else // Another provider has claimed pos
             {
-                tmp_elements.push_back(ring_buffer_[i]);
-                i = (i + 1) % buffer_size_;
+                pos = head_.load(std::memory_order_relaxed);
             }
         }
-        return tmp_elements;
-    }*/
+
+        tmp_slot_ptr->element = element;
+        tmp_slot_ptr->seqnum.store(pos + 1, std::memory_order_release); // Publish the element to the customer
+
+        return true;
+    }
 
     template<class T>
-    const RingBuffer<T>& RingBuffer<T>::operator=(const RingBuffer<T>& other)
+    bool RingBuffer<T>::isBlockingAllowed_(const uint64_t& deadline_us) const
     {
-        with_multi_providers_ = other.with_multi_providers_;
-        if (with_multi_providers_ && rwlock_for_multi_providers_ptr_ == NULL)
+        if (owner_node_wrapper_ptr_ != NULL)
         {
-            rwlock_for_multi_providers_ptr_ = new Rwlock("rwlock_for_multi_providers_ptr_");
-            assert(rwlock_for_multi_providers_ptr_ != NULL);
+            return owner_node_wrapper_ptr_->isNodeRunning(); // Customer keeps popping until the node stops
         }
-        else if (!with_multi_providers_ && rwlock_for_multi_providers_ptr_ != NULL)
+        return Util::getCurrentMonotonicTimeUs() < deadline_us;
+    }
+
+    template<class T>
+    void RingBuffer<T>::updateMaxElementCnt_(const uint64_t& tail_before_pop)
+    {
+        // NOTE: ONLY the customer updates max_elementcnt_, so NO need for CAS
+        const uint64_t tmp_head = head_.load(std::memory_order_relaxed);
+        uint64_t cur_elementcnt = (tmp_head > tail_before_pop) ? (tmp_head - tail_before_pop) : 0;
+        if (cur_elementcnt > capacity_)
         {
-            delete rwlock_for_multi_providers_ptr_;
-            rwlock_for_multi_providers_ptr_ = NULL;
+            cur_elementcnt = capacity_;
         }
-
-        head_ = other.head_;
-        tail_ = other.tail_;
-        buffer_size_ = other.buffer_size_;
-        default_element_ = other.default_element_;
-        ring_buffer_ = other.ring_buffer_; // Deep copy
-        return *this;
+        if (cur_elementcnt > max_elementcnt_.load(std::memory_order_relaxed))
+        {
+            max_elementcnt_.store(static_cast<uint32_t>(cur_elementcnt), std::memory_order_relaxed);
+        }
+        return;
     }
 }
 
-#endif
\ No newline at end of file
+#endif
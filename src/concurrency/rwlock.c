@@ -1,5 +1,7 @@
 #include "concurrency/rwlock.h"
 
+#include <assert.h>
+#include <list>
 #include <sstream>
 
 #include "common/util.h"
@@ -17,29 +19,12 @@ namespace covered
 
     Rwlock::~Rwlock() {}
 
-    void Rwlock::acquire_lock_shared(const std::string& context_name, std::unordered_set<std::string>* prev_writers_ptr)
+    void Rwlock::acquire_lock_shared(const char* context_name, std::unordered_set<std::string>* prev_writers_ptr)
     {
-        while (true) // Frequent polling
+        #ifdef DEBUG_RWLOCK
+        // NOTE: poll the lock under debug mode to record the current writer blocking us
+        while (!rwlock_.try_lock_shared())
         {
-            if (try_lock_shared_(context_name))
-            {
-                #ifdef DEBUG_RWLOCK
-                mutex_for_debug_.lock();
-                if (current_readers_.find(context_name) == current_readers_.end())
-                {
-                    current_readers_.insert(std::pair(context_name, 1));
-                }
-                else
-                {
-                    current_readers_[context_name] += 1;
-                }
-                mutex_for_debug_.unlock();
-                #endif
-
-                break;
-            }
-
-            #ifdef DEBUG_RWLOCK
             if (prev_writers_ptr != NULL) // Record current writer
             {
                 mutex_for_debug_.lock();
@@ -51,28 +36,29 @@ namespace covered
                     prev_writers_ptr->insert(tmp_current_writer);
                 }
             }
-            #endif
         }
-        return;
-    }
 
-    bool Rwlock::try_lock_shared_(const std::string& context_name)
-    {
-        bool result = rwlock_.try_lock_shared();
+        mutex_for_debug_.lock();
+        if (current_readers_.find(context_name) == current_readers_.end())
+        {
+            current_readers_.insert(std::pair<std::string, uint32_t>(context_name, 1));
+        }
+        else
+        {
+            current_readers_[context_name] += 1;
+        }
+        mutex_for_debug_.unlock();
+        #else
+        UNUSED(context_name);
+        UNUSED(prev_writers_ptr);
 
-        #ifdef DEBUG_RWLOCK
-        // if (result)
-        // {
-        //     std::ostringstream oss;
-        //     oss << "acquire a read lock in " << context_name;
-        //     Util::dumpDebugMsg(instance_name_, oss.str());
-        // }
+        rwlock_.lock_shared(); // Spin briefly and then park
         #endif
 
-        return result;
+        return;
     }
 
-    void Rwlock::unlock_shared(const std::string& context_name)
+    void Rwlock::unlock_shared(const char* context_name)
     {
         #ifdef DEBUG_RWLOCK
         mutex_for_debug_.lock();
@@ -87,32 +73,20 @@ namespace covered
             current_readers_.erase(tmp_iter);
         }
         mutex_for_debug_.unlock();
-
-        // std::ostringstream oss;
-        // oss << "release a read lock in " << context_name;
-        // Util::dumpDebugMsg(instance_name_, oss.str());
+        #else
+        UNUSED(context_name);
         #endif
 
         rwlock_.unlock_shared();
         return;
     }
 
-    void Rwlock::acquire_lock(const std::string& context_name, std::unordered_set<std::string>* prev_writers_ptr, std::unordered_set<std::string>* prev_readers_ptr)
+    void Rwlock::acquire_lock(const char* context_name, std::unordered_set<std::string>* prev_writers_ptr, std::unordered_set<std::string>* prev_readers_ptr)
     {
-        while (true) // Frequent polling
+        #ifdef DEBUG_RWLOCK
+        // NOTE: poll the lock under debug mode to record the current writer/readers blocking us
+        while (!rwlock_.try_lock())
         {
-            if (try_lock_(context_name))
-            {
-                #ifdef DEBUG_RWLOCK
-                mutex_for_debug_.lock();
-                current_writer_ = context_name;
-                mutex_for_debug_.unlock();
-                #endif
-
-                break;
-            }
-
-            #ifdef DEBUG_RWLOCK
             if (prev_writers_ptr != NULL) // Record current writer
             {
                 mutex_for_debug_.lock();
@@ -142,40 +116,33 @@ namespace covered
                     }
                 }
             }
-            #endif
         }
-        return;
-    }
 
-    bool Rwlock::try_lock_(const std::string& context_name)
-    {
-        bool result = rwlock_.try_lock();
+        mutex_for_debug_.lock();
+        current_writer_ = context_name;
+        mutex_for_debug_.unlock();
+        #else
+        UNUSED(context_name);
+        UNUSED(prev_writers_ptr);
+        UNUSED(prev_readers_ptr);
 
-        #ifdef DEBUG_RWLOCK
-        // if (result)
-        // {
-        //     std::ostringstream oss;
-        //     oss << "acquire a write lock in " << context_name;
-        //     Util::dumpDebugMsg(instance_name_, oss.str());
-        // }
+        rwlock_.lock(); // Spin briefly and then park
         #endif
 
-        return result;
+        return;
     }
 
-    void Rwlock::unlock(const std::string& context_name)
+    void Rwlock::unlock(const char* context_name)
     {
         #ifdef DEBUG_RWLOCK
         mutex_for_debug_.lock();
         current_writer_ = "";
         mutex_for_debug_.unlock();
-
-        // std::ostringstream oss;
-        // oss << "release a write lock in " << context_name;
-        // Util::dumpDebugMsg(instance_name_, oss.str());
+        #else
+        UNUSED(context_name);
         #endif
 
         rwlock_.unlock();
         return;
     }
-}
\ No newline at end of file
+}
@@ -1,5 +1,7 @@
 /*
  * Rwlock: provide an individual read-write lock for concurrency control.
+ *
+ * NOTE: Rwlock is built upon FutexRwlock (spin briefly and then park) instead of polling boost::shared_mutex::try_lock(); context names are ONLY used for debugging, and hence compiled out unless DEBUG_RWLOCK is defined.
  * 
  * By Siyuan Sheng (2023.06.15).
  */
@@ -15,9 +17,12 @@
 #include <string>
 #include <unordered_set>
 
-#include <boost/thread/shared_mutex.hpp>
+#ifdef DEBUG_RWLOCK
+#include <boost/thread/mutex.hpp>
+#endif
 
 #include "common/key.h"
+#include "concurrency/futex_rwlock.h"
 
 namespace covered
 {
@@ -28,19 +33,17 @@ namespace covered
         ~Rwlock();
 
         // The same interfaces as libboost
-        void acquire_lock_shared(const std::string& context_name, std::unordered_set<std::string>* prev_writers_ptr = NULL);
-        void unlock_shared(const std::string& context_name);
-        void acquire_lock(const std::string& context_name, std::unordered_set<std::string>* prev_writers_ptr = NULL, std::unordered_set<std::string>* prev_readers_ptr = NULL);
-        void unlock(const std::string& context_name);
+        // NOTE: context_name is a string literal (NOT std::string) to avoid constructing (and allocating) a string for each lock operation
+        void acquire_lock_shared(const char* context_name, std::unordered_set<std::string>* prev_writers_ptr = NULL);
+        void unlock_shared(const char* context_name);
+        void acquire_lock(const char* context_name, std::unordered_set<std::string>* prev_writers_ptr = NULL, std::unordered_set<std::string>* prev_readers_ptr = NULL);
+        void unlock(const char* context_name);
     private:
         static const std::string kClassName;
 
-        bool try_lock_shared_(const std::string& context_name);
-        bool try_lock_(const std::string& context_name);
-
         std::string instance_name_;
 
-        boost::shared_mutex rwlock_;
+        FutexRwlock rwlock_;
 
         #ifdef DEBUG_RWLOCK
         boost::mutex mutex_for_debug_;
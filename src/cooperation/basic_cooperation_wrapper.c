@@ -71,7 +71,7 @@ namespace covered
         //assert(source_edge_idx == directory_info.getTargetEdgeIdx());
 
         // Acquire a write lock
-        std::string context_name = "BasicCooperationWrapper::preserveDirectoryTableIfGlobalUncachedInternal_()";
+        const char* context_name = "BasicCooperationWrapper::preserveDirectoryTableIfGlobalUncachedInternal_()";
         cooperation_wrapper_perkey_rwlock_ptr_->acquire_lock(key, context_name);
 
         MYASSERT(dht_wrapper_ptr_->getBeaconEdgeIdx(key) == edge_idx_); // Current edge node MUST be beacon for the given key
@@ -102,7 +102,7 @@ namespace covered
         assert(source_edge_idx == directory_info.getTargetEdgeIdx());
 
         // Acquire a write lock
-        std::string context_name = "BasicCooperationWrapper::validateDirectoryTableForPreservedDirinfoInternal_()";
+        const char* context_name = "BasicCooperationWrapper::validateDirectoryTableForPreservedDirinfoInternal_()";
         cooperation_wrapper_perkey_rwlock_ptr_->acquire_lock(key, context_name);
 
         MYASSERT(dht_wrapper_ptr_->getBeaconEdgeIdx(key) == edge_idx_); // Current edge node MUST be beacon for the given key
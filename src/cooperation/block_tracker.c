@@ -26,17 +26,11 @@ namespace covered
 
     bool BlockTracker::isBeingWrittenForKey(const Key& key) const
     {
-        // Prepare IsBeingWrittenParam
-        MsiMetadata::IsBeingWrittenParam tmp_param = {false};
-
         bool is_exist = false;
-        perkey_msimetadata_.constCallIfExist(key, is_exist, MsiMetadata::IS_BEING_WRITTEN_FUNCNAME, &tmp_param);
-        
-        bool is_being_written = false;
-        if (is_exist) // key exists
-        {
-            is_being_written = tmp_param.is_being_written;
-        }
+        bool is_being_written = false; // NOT being written if key does NOT exist
+        perkey_msimetadata_.constCallIfExist(key, is_exist, [&is_being_written](const MsiMetadata& msimetadata) {
+            is_being_written = msimetadata.isBeingWritten();
+        });
 
         return is_being_written;
     }
@@ -45,23 +39,17 @@ namespace covered
     {
         assert(network_addr.isValidAddr());
 
-        // Prepare BlockEdgeIfBeingWrittenParam
-        MsiMetadata::BlockEdgeIfBeingWrittenParam tmp_param = {network_addr, false, false};
-
         bool is_exist = false;
-        perkey_msimetadata_.callIfExist(key, is_exist, MsiMetadata::BLOCK_EDGE_IF_BEING_WRITTEN_FUNCNAME, &tmp_param);
+        bool is_blocked_before = false;
+        is_being_written = false; // NOT being written if key does NOT exist
+        perkey_msimetadata_.callIfExist(key, is_exist, [&](MsiMetadata& msimetadata) {
+            is_blocked_before = msimetadata.blockEdgeIfBeingWritten(network_addr, is_being_written);
+            return false; // NOT erase
+        });
 
         // An edge node can be blocked at most once (i.e., no duplicate edge nodes in a blocklist)
-        assert(!tmp_param.is_blocked_before);
-
-        if (!is_exist) // key does not exist
-        {
-            is_being_written = false;
-        }
-        else // key exists
-        {
-            is_being_written = tmp_param.is_being_written;
-        }
+        assert(!is_blocked_before);
+        UNUSED(is_blocked_before);
 
         return;
     }
@@ -73,21 +61,12 @@ namespace covered
         // Prepare an MSI metadata with writeflag_ = true
         MsiMetadata tmp_msimetadata(true);
 
-        // Prepare CasWriteflagParam
-        MsiMetadata::CasWriteflagParam tmp_param = {false};
-
         bool is_exist = false;
-        perkey_msimetadata_.insertOrCall(key, tmp_msimetadata, is_exist, MsiMetadata::CAS_WRITEFLAG_FUNCNAME, &tmp_param);
-
-        bool is_successful = false;
-        if (!is_exist) // key NOT exist
-        {
-            is_successful = true;
-        }
-        else // key exists
-        {
-            is_successful = tmp_param.is_successful;
-        }
+        bool is_successful = true; // Successful if key NOT exist (i.e., insert tmp_msimetadata)
+        perkey_msimetadata_.insertOrCall(key, tmp_msimetadata, is_exist, [&is_successful](MsiMetadata& msimetadata) {
+            is_successful = msimetadata.casWriteflag();
+            return false; // NOT erase
+        });
 
         return is_successful;
     }
@@ -97,22 +76,15 @@ namespace covered
         // Prepare an MSI metadata with writeflag_ = true
         MsiMetadata tmp_msimetadata(true);
 
-        // Prepare CasWriteflagOrBlockEdgeParam
-        MsiMetadata::CasWriteflagOrBlockEdgeParam tmp_param = {network_addr, false, false};
-
         bool is_exist = false;
-        perkey_msimetadata_.insertOrCall(key, tmp_msimetadata, is_exist, MsiMetadata::CAS_WRITEFLAG_OR_BLOCK_EDGE_FUNCNAME, &tmp_param);
-        assert(!tmp_param.is_blocked_before);
-
-        bool is_successful = false;
-        if (!is_exist) // key NOT exist
-        {
-            is_successful = true;
-        }
-        else // key exists
-        {
-            is_successful = tmp_param.is_successful;
-        }
+        bool is_blocked_before = false;
+        bool is_successful = true; // Successful if key NOT exist (i.e., insert tmp_msimetadata)
+        perkey_msimetadata_.insertOrCall(key, tmp_msimetadata, is_exist, [&](MsiMetadata& msimetadata) {
+            is_successful = msimetadata.casWriteflagOrBlockEdge(network_addr, is_blocked_before);
+            return false; // NOT erase
+        });
+        assert(!is_blocked_before);
+        UNUSED(is_blocked_before);
 
         return is_successful;
     }
@@ -144,17 +116,18 @@ namespace covered
 
     std::unordered_set<NetworkAddr, NetworkAddrHasher> BlockTracker::unblockAllEdgesAndFinishWriteForKeyIfExist(const Key& key)
     {
-        // Prepare UnblockAllEdgesAndFinishWriteParam
         std::unordered_set<NetworkAddr, NetworkAddrHasher> blocked_edges;
-        MsiMetadata::UnblockAllEdgesAndFinishWriteParam tmp_param = {blocked_edges};
 
         bool is_exist = false;
-        perkey_msimetadata_.callIfExist(key, is_exist, MsiMetadata::UNBLOCK_ALL_EDGES_AND_FINISH_WRITE_FUNCNAME, &tmp_param); // NOTE: trigger erase of perkey_msimetadata_
+        perkey_msimetadata_.callIfExist(key, is_exist, [&blocked_edges](MsiMetadata& msimetadata) {
+            msimetadata.unblockAllEdgesAndFinishWrite(blocked_edges);
+            return true; // NOTE: trigger erase of perkey_msimetadata_
+        });
         
         // key MUST exist
         assert(is_exist);
 
-        return tmp_param.blocked_edges;
+        return blocked_edges;
     }
 
     // (4) Get size for capacity check
@@ -115,7 +115,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock
-        std::string context_name = "CooperationWrapperBase::isGlobalCached()";
+        const char* context_name = "CooperationWrapperBase::isGlobalCached()";
         cooperation_wrapper_perkey_rwlock_ptr_->acquire_lock_shared(key, context_name);
 
         MYASSERT(dht_wrapper_ptr_->getBeaconEdgeIdx(key) == edge_idx_); // Current edge node MUST be beacon for the given key
@@ -134,7 +134,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock
-        std::string context_name = "CooperationWrapperBase::isBeingWritten()";
+        const char* context_name = "CooperationWrapperBase::isBeingWritten()";
         cooperation_wrapper_perkey_rwlock_ptr_->acquire_lock_shared(key, context_name);
 
         MYASSERT(dht_wrapper_ptr_->getBeaconEdgeIdx(key) == edge_idx_); // Current edge node MUST be beacon for the given key
@@ -152,7 +152,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock
-        std::string context_name = "CooperationWrapperBase::getLocalDirectoryInfos()";
+        const char* context_name = "CooperationWrapperBase::getLocalDirectoryInfos()";
         cooperation_wrapper_perkey_rwlock_ptr_->acquire_lock_shared(key, context_name);
 
         MYASSERT(dht_wrapper_ptr_->getBeaconEdgeIdx(key) == edge_idx_); // Current edge node MUST be beacon for the given key
@@ -171,7 +171,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock
-        std::string context_name = "CooperationWrapperBase::lookupDirectoryTableByCacheServer()";
+        const char* context_name = "CooperationWrapperBase::lookupDirectoryTableByCacheServer()";
         cooperation_wrapper_perkey_rwlock_ptr_->acquire_lock_shared(key, context_name);
 
         MYASSERT(dht_wrapper_ptr_->getBeaconEdgeIdx(key) == edge_idx_); // Current edge node MUST be beacon for the given key
@@ -192,7 +192,7 @@ namespace covered
         checkPointers_();
 
         // NOTE: we have to acquire a write lock as we may need to update the blocklist in BlockTracker
-        std::string context_name = "CooperationWrapperBase::lookupDirectoryTableByBeaconServer()";
+        const char* context_name = "CooperationWrapperBase::lookupDirectoryTableByBeaconServer()";
         cooperation_wrapper_perkey_rwlock_ptr_->acquire_lock(key, context_name);
 
         MYASSERT(dht_wrapper_ptr_->getBeaconEdgeIdx(key) == edge_idx_); // Current edge node MUST be beacon for the given key
@@ -242,7 +242,7 @@ namespace covered
         assert(source_edge_idx == directory_info.getTargetEdgeIdx()); // Receive a directory udpate request from the source edge node to admit/evict itself
 
         // Acquire a write lock
-        std::string context_name = "CooperationWrapperBase::updateDirectoryTable()";
+        const char* context_name = "CooperationWrapperBase::updateDirectoryTable()";
         cooperation_wrapper_perkey_rwlock_ptr_->acquire_lock(key, context_name);
 
         MYASSERT(dht_wrapper_ptr_->getBeaconEdgeIdx(key) == edge_idx_); // Current edge node MUST be beacon for the given key
@@ -286,7 +286,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock
-        std::string context_name = "CooperationWrapperBase::acquireLocalWritelockByCacheServer()";
+        const char* context_name = "CooperationWrapperBase::acquireLocalWritelockByCacheServer()";
         cooperation_wrapper_perkey_rwlock_ptr_->acquire_lock(key, context_name);
 
         MYASSERT(dht_wrapper_ptr_->getBeaconEdgeIdx(key) == edge_idx_); // Current edge node MUST be beacon for the given key
@@ -325,7 +325,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock
-        std::string context_name = "CooperationWrapperBase::acquireLocalWritelockByBeaconServer()";
+        const char* context_name = "CooperationWrapperBase::acquireLocalWritelockByBeaconServer()";
         cooperation_wrapper_perkey_rwlock_ptr_->acquire_lock(key, context_name);
 
         MYASSERT(dht_wrapper_ptr_->getBeaconEdgeIdx(key) == edge_idx_); // Current edge node MUST be beacon for the given key
@@ -364,7 +364,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock
-        std::string context_name = "CooperationWrapperBase::releaseLocalWritelock()";
+        const char* context_name = "CooperationWrapperBase::releaseLocalWritelock()";
         cooperation_wrapper_perkey_rwlock_ptr_->acquire_lock(key, context_name);
 
         MYASSERT(dht_wrapper_ptr_->getBeaconEdgeIdx(key) == edge_idx_); // Current edge node MUST be beacon for the given key
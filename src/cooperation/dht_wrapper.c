@@ -1,5 +1,6 @@
 #include "cooperation/dht_wrapper.h"
 
+#include <algorithm>
 #include <assert.h>
 #include <sstream>
 
@@ -13,15 +14,12 @@ namespace covered
 
     DhtWrapper::DhtWrapper(const std::string& hash_name, const uint32_t& edgecnt, const uint32_t& edge_idx) : edgecnt_(edgecnt)
     {
-        assert(edgecnt_ > 0);
-
-        // Differentiate DhtWrapper in different edge nodes
-        std::ostringstream oss;
-        oss << kClassName << " edge" << edge_idx;
-        instance_name_ = oss.str();
+        initialize_(hash_name, edge_idx, Config::getDhtPlacementName(), Config::getDhtVnodecntPeredge(), Config::getDhtEdgeWeights());
+    }
 
-        hash_wrapper_ptr_ = HashWrapperBase::getHashWrapperByHashName(hash_name);
-        assert(hash_wrapper_ptr_ != NULL);
+    DhtWrapper::DhtWrapper(const std::string& hash_name, const uint32_t& edgecnt, const uint32_t& edge_idx, const std::string& dht_placement_name, const uint32_t& vnodecnt_peredge, const std::vector<uint32_t>& edge_weights) : edgecnt_(edgecnt)
+    {
+        initialize_(hash_name, edge_idx, dht_placement_name, vnodecnt_peredge, edge_weights);
     }
     
     DhtWrapper::~DhtWrapper()
@@ -36,18 +34,34 @@ namespace covered
         // Hash the key
         assert(hash_wrapper_ptr_ != NULL);
         uint32_t hash_value = hash_wrapper_ptr_->hash(key);
-        uint32_t hash_ring_value = hash_value % DHT_HASH_RING_LENGTH;
 
-        // Map edgecnt edge nodes into DHT hash ring
-        uint32_t peredge_hash_ring_length = DHT_HASH_RING_LENGTH / edgecnt_;
-
-        // Calculate beacon node edge idx
-        assert(peredge_hash_ring_length > 0);
-        uint32_t beacon_edge_idx = hash_ring_value / peredge_hash_ring_length;
-        if (beacon_edge_idx >= edgecnt_)
+        uint32_t beacon_edge_idx = 0;
+        switch (dht_placement_type_)
         {
-            beacon_edge_idx = edgecnt_ - 1; // Map the tail hash ring values to the last edge node
+            case kRangePlacement:
+            {
+                beacon_edge_idx = getRangeBeaconEdgeIdx_(hash_value);
+                break;
+            }
+            case kRingPlacement:
+            {
+                beacon_edge_idx = getRingBeaconEdgeIdx_(hash_value);
+                break;
+            }
+            case kJumpPlacement:
+            {
+                beacon_edge_idx = getJumpBeaconEdgeIdx_(hash_value);
+                break;
+            }
+            default:
+            {
+                std::ostringstream oss;
+                oss << "invalid DHT placement type " << static_cast<uint32_t>(dht_placement_type_) << "!";
+                Util::dumpErrorMsg(instance_name_, oss.str());
+                exit(1);
+            }
         }
+        assert(beacon_edge_idx < edgecnt_);
         return beacon_edge_idx;
     }
 
@@ -75,4 +89,160 @@ namespace covered
     {
         return Util::getEdgeBeaconServerRecvreqPort(beacon_edge_idx, edgecnt_);
     }
+
+    std::string DhtWrapper::getDhtPlacementName() const
+    {
+        return dht_placement_name_;
+    }
+
+    uint32_t DhtWrapper::getRingTokencnt() const
+    {
+        return ring_tokens_.size();
+    }
+
+    void DhtWrapper::initialize_(const std::string& hash_name, const uint32_t& edge_idx, const std::string& dht_placement_name, const uint32_t& vnodecnt_peredge, const std::vector<uint32_t>& edge_weights)
+    {
+        assert(edgecnt_ > 0);
+
+        // Differentiate DhtWrapper in different edge nodes
+        std::ostringstream oss;
+        oss << kClassName << " edge" << edge_idx;
+        instance_name_ = oss.str();
+
+        hash_wrapper_ptr_ = HashWrapperBase::getHashWrapperByHashName(hash_name);
+        assert(hash_wrapper_ptr_ != NULL);
+
+        if (edge_weights.size() > 0 && edge_weights.size() != edgecnt_)
+        {
+            std::ostringstream oss;
+            oss << "# of DHT edge weights " << edge_weights.size() << " != edgecnt " << edgecnt_ << "!";
+            Util::dumpErrorMsg(instance_name_, oss.str());
+            exit(1);
+        }
+        for (uint32_t tmp_edge_idx = 0; tmp_edge_idx < edge_weights.size(); tmp_edge_idx++)
+        {
+            // NOTE: Config rejects non-positive weights, yet DhtWrapper can be constructed w/o Config
+            if (edge_weights[tmp_edge_idx] == 0)
+            {
+                std::ostringstream oss;
+                oss << "DHT edge weight of edge" << tmp_edge_idx << " is 0, which should be positive!";
+                Util::dumpErrorMsg(instance_name_, oss.str());
+                exit(1);
+            }
+        }
+
+        dht_placement_name_ = dht_placement_name;
+        if (dht_placement_name == Util::DHT_RANGE_PLACEMENT_NAME)
+        {
+            dht_placement_type_ = kRangePlacement;
+        }
+        else if (dht_placement_name == Util::DHT_RING_PLACEMENT_NAME)
+        {
+            dht_placement_type_ = kRingPlacement;
+            buildRing_(vnodecnt_peredge, edge_weights);
+        }
+        else if (dht_placement_name == Util::DHT_JUMP_PLACEMENT_NAME)
+        {
+            dht_placement_type_ = kJumpPlacement;
+        }
+        else
+        {
+            std::ostringstream oss;
+            oss << "DHT placement name " << dht_placement_name << " is not supported!";
+            Util::dumpErrorMsg(instance_name_, oss.str());
+            exit(1);
+        }
+
+        if (dht_placement_type_ != kRingPlacement && edge_weights.size() > 0)
+        {
+            std::ostringstream oss;
+            oss << "DHT edge weights are ONLY supported by " << Util::DHT_RING_PLACEMENT_NAME << " placement (ignored by " << dht_placement_name << ")!";
+            Util::dumpWarnMsg(instance_name_, oss.str());
+        }
+        return;
+    }
+
+    void DhtWrapper::buildRing_(const uint32_t& vnodecnt_peredge, const std::vector<uint32_t>& edge_weights)
+    {
+        assert(vnodecnt_peredge > 0);
+        assert(hash_wrapper_ptr_ != NULL);
+
+        // Generate tokens of virtual nodes for each edge node
+        std::vector<std::pair<uint32_t, uint32_t>> token_edgeidx_pairs;
+        for (uint32_t tmp_edge_idx = 0; tmp_edge_idx < edgecnt_; tmp_edge_idx++)
+        {
+            uint32_t tmp_weight = (edge_weights.size() > 0) ? edge_weights[tmp_edge_idx] : 1;
+            assert(tmp_weight > 0); // Zero weights have been rejected in initialize_()
+            uint32_t tmp_vnodecnt = vnodecnt_peredge * tmp_weight;
+            for (uint32_t tmp_vnode_idx = 0; tmp_vnode_idx < tmp_vnodecnt; tmp_vnode_idx++)
+            {
+                // NOTE: tokens only depend on (edge idx, vnode idx) -> adding/removing an edge node does NOT move tokens of other edge nodes
+                std::ostringstream tmp_oss;
+                tmp_oss << "edge" << tmp_edge_idx << "-vnode" << tmp_vnode_idx;
+                uint32_t tmp_token = hash_wrapper_ptr_->hash(Key(tmp_oss.str()));
+                token_edgeidx_pairs.push_back(std::pair<uint32_t, uint32_t>(tmp_token, tmp_edge_idx));
+            }
+        }
+
+        // Sort by (token, edge idx) for deterministic tie breaking across edge nodes
+        std::sort(token_edgeidx_pairs.begin(), token_edgeidx_pairs.end());
+
+        ring_tokens_.clear();
+        ring_token_edgeidxes_.clear();
+        ring_tokens_.reserve(token_edgeidx_pairs.size());
+        ring_token_edgeidxes_.reserve(token_edgeidx_pairs.size());
+        for (uint32_t i = 0; i < token_edgeidx_pairs.size(); i++)
+        {
+            ring_tokens_.push_back(token_edgeidx_pairs[i].first);
+            ring_token_edgeidxes_.push_back(token_edgeidx_pairs[i].second);
+        }
+        assert(ring_tokens_.size() > 0);
+        return;
+    }
+
+    uint32_t DhtWrapper::getRangeBeaconEdgeIdx_(const uint32_t& hash_value) const
+    {
+        uint32_t hash_ring_value = hash_value % DHT_HASH_RING_LENGTH;
+
+        // Map edgecnt edge nodes into DHT hash ring
+        uint32_t peredge_hash_ring_length = DHT_HASH_RING_LENGTH / edgecnt_;
+
+        // Calculate beacon node edge idx
+        assert(peredge_hash_ring_length > 0);
+        uint32_t beacon_edge_idx = hash_ring_value / peredge_hash_ring_length;
+        if (beacon_edge_idx >= edgecnt_)
+        {
+            beacon_edge_idx = edgecnt_ - 1; // Map the tail hash ring values to the last edge node
+        }
+        return beacon_edge_idx;
+    }
+
+    uint32_t DhtWrapper::getRingBeaconEdgeIdx_(const uint32_t& hash_value) const
+    {
+        assert(ring_tokens_.size() > 0);
+
+        // Find the first virtual node whose token >= hash value (clockwise successor)
+        std::vector<uint32_t>::const_iterator iter = std::lower_bound(ring_tokens_.begin(), ring_tokens_.end(), hash_value);
+        if (iter == ring_tokens_.end())
+        {
+            iter = ring_tokens_.begin(); // Wrap around the ring
+        }
+        return ring_token_edgeidxes_[iter - ring_tokens_.begin()];
+    }
+
+    uint32_t DhtWrapper::getJumpBeaconEdgeIdx_(const uint32_t& hash_value) const
+    {
+        // Jump consistent hash (Lamping and Veach, 2014): O(ln edgecnt) time w/o memory, and ONLY keys of the last edge node are remapped when removing it
+        uint64_t tmp_key = static_cast<uint64_t>(hash_value);
+        int64_t tmp_bucket = -1;
+        int64_t tmp_next_bucket = 0;
+        while (tmp_next_bucket < static_cast<int64_t>(edgecnt_))
+        {
+            tmp_bucket = tmp_next_bucket;
+            tmp_key = tmp_key * 2862933555777941757ULL + 1;
+            tmp_next_bucket = static_cast<int64_t>(static_cast<double>(tmp_bucket + 1) * (static_cast<double>(1LL << 31) / static_cast<double>((tmp_key >> 33) + 1)));
+        }
+        assert(tmp_bucket >= 0);
+        return static_cast<uint32_t>(tmp_bucket);
+    }
 }
\ No newline at end of file
@@ -2,6 +2,8 @@
  * DhtWrapper: a simple version of distributed hash table.
  *
  * NOTE: we assume that each edge node (DHT node) has IP addresses of all others (i.e., a Chord DHT with sufficient predecessors and successors to cover all DHT nodes)
+ *
+ * NOTE: beacon placement is configurable: range (equal contiguous hash ranges; legacy), ring (consistent hashing w/ weighted virtual nodes in a sorted token array + binary search), or jump (jump consistent hash w/o any token array). Ring and jump only remap ~1/edgecnt of keys when adding/removing an edge node.
  * 
  * By Siyuan Sheng (2023.06.05).
  */
@@ -10,6 +12,7 @@
 #define DHT_WRAPPER_H
 
 #include <string>
+#include <vector>
 
 #include "common/key.h"
 #include "hash/hash_wrapper_base.h"
@@ -20,7 +23,8 @@ namespace covered
     class DhtWrapper
     {
     public:
-        DhtWrapper(const std::string& hash_name, const uint32_t& edgecnt, const uint32_t& edge_idx);
+        DhtWrapper(const std::string& hash_name, const uint32_t& edgecnt, const uint32_t& edge_idx); // Get DHT placement settings from Config
+        DhtWrapper(const std::string& hash_name, const uint32_t& edgecnt, const uint32_t& edge_idx, const std::string& dht_placement_name, const uint32_t& vnodecnt_peredge, const std::vector<uint32_t>& edge_weights); // NOT rely on Config (e.g., for dht_microbenchmark)
         ~DhtWrapper();
 
         uint32_t getBeaconEdgeIdx(const Key& key) const;
@@ -28,16 +32,39 @@ namespace covered
         // uint16_t getBeaconEdgeBeaconServerRecvreqPort(const Key& key) const;
         std::string getBeaconEdgeIpstr(const uint32_t& beacon_edge_idx) const;
         uint16_t getBeaconEdgeBeaconServerRecvreqPort(const uint32_t& beacon_edge_idx) const;
+
+        std::string getDhtPlacementName() const;
+        uint32_t getRingTokencnt() const; // # of virtual nodes in consistent hashing ring (0 for range/jump placement)
     private:
+        enum DhtPlacementType
+        {
+            kRangePlacement = 0,
+            kRingPlacement,
+            kJumpPlacement
+        };
+
         static const std::string kClassName;
         static const uint32_t DHT_HASH_RING_LENGTH;
 
+        void initialize_(const std::string& hash_name, const uint32_t& edge_idx, const std::string& dht_placement_name, const uint32_t& vnodecnt_peredge, const std::vector<uint32_t>& edge_weights);
+        void buildRing_(const uint32_t& vnodecnt_peredge, const std::vector<uint32_t>& edge_weights);
+
+        uint32_t getRangeBeaconEdgeIdx_(const uint32_t& hash_value) const;
+        uint32_t getRingBeaconEdgeIdx_(const uint32_t& hash_value) const;
+        uint32_t getJumpBeaconEdgeIdx_(const uint32_t& hash_value) const;
+
         const uint32_t edgecnt_; // Come from CLI
 
         // Const variable
         std::string instance_name_;
+        std::string dht_placement_name_; // Come from Config or caller
+        DhtPlacementType dht_placement_type_;
 
         HashWrapperBase* hash_wrapper_ptr_;
+
+        // Consistent hashing ring (ONLY for ring placement; read-only after construction and hence thread safe)
+        std::vector<uint32_t> ring_tokens_; // Sorted tokens of virtual nodes
+        std::vector<uint32_t> ring_token_edgeidxes_; // ring_token_edgeidxes_[i] is the edge idx owning ring_tokens_[i] (parallel array to keep tokens dense for binary search)
     };
 }
 
@@ -2,80 +2,135 @@
 
 #include <assert.h>
 #include <sstream>
+#include <utility> // std::move
 
 #include "common/util.h"
 
 namespace covered
 {
-    const std::string DirectoryEntry::GET_ALL_DIRINFO_FUNCNAME("getAllDirinfo");
-    const std::string DirectoryEntry::GET_ALL_VALID_DIRINFO_FUNCNAME("getAllValidDirinfo");
-    const std::string DirectoryEntry::ADD_DIRINFO_FUNCNAME("addDirinfo");
-    const std::string DirectoryEntry::REMOVE_DIRINFO_FUNCNAME("removeDirinfo");
-    const std::string DirectoryEntry::INVALIDATE_METADATA_FOR_ALL_DIRINFO_IF_EXIST_FUNCNAME("invalidateMetadataForAllDirinfoIfExist");
-    const std::string DirectoryEntry::VALIDATE_METADATA_FOR_DIRINFO_IF_EXIST_FUNCNAME("validateMetadataForDirinfoIfExist");
+    const uint32_t DirectoryEntry::INLINE_DIRINFO_CAPACITY = 2;
 
     const std::string DirectoryEntry::kClassName("DirectoryEntry");
 
     DirectoryEntry::DirectoryEntry()
     {
-        directory_entry_.clear();
+        assert(sizeof(inline_edge_idxes_) == INLINE_DIRINFO_CAPACITY * sizeof(uint32_t));
+        assert(INLINE_DIRINFO_CAPACITY <= 8); // NOTE: validity bitmap is uint8_t
+
+        inline_edge_idxes_[0] = 0;
+        inline_edge_idxes_[1] = 0;
+        inline_dirinfo_cnt_ = 0;
+        inline_validity_bitmap_ = 0;
+        overflow_dirinfos_ptr_ = NULL;
     }
 
-    DirectoryEntry::~DirectoryEntry() {}
+    DirectoryEntry::DirectoryEntry(const DirectoryEntry& other)
+    {
+        overflow_dirinfos_ptr_ = NULL;
+        *this = other;
+    }
+
+    DirectoryEntry::DirectoryEntry(DirectoryEntry&& other) noexcept
+    {
+        overflow_dirinfos_ptr_ = NULL;
+        *this = std::move(other);
+    }
+
+    DirectoryEntry::~DirectoryEntry()
+    {
+        releaseOverflowDirinfos_();
+    }
 
     // (1) Access per-dirinfo metadata
 
     void DirectoryEntry::getAllDirinfo(DirinfoSet& dirinfo_set) const
     {
-        std::list<DirectoryInfo> tmp_dirinfo_set;
-        tmp_dirinfo_set.clear();
+        dirinfo_set = DirinfoSet(std::list<DirectoryInfo>()); // Empty complete dirinfo set
 
         // Add all directory information into directory_info_set
-        for (dirinfo_entry_t::const_iterator iter = directory_entry_.begin(); iter != directory_entry_.end(); iter++)
+        bool is_insert = false;
+        for (uint32_t i = 0; i < inline_dirinfo_cnt_; i++)
         {
-            const DirectoryInfo& directory_info = iter->first;
-            tmp_dirinfo_set.push_back(directory_info);
+            dirinfo_set.tryToInsertIfComplete(DirectoryInfo(inline_edge_idxes_[i]), is_insert);
         }
+        if (overflow_dirinfos_ptr_ != NULL)
+        {
+            for (overflow_dirinfos_t::const_iterator iter = overflow_dirinfos_ptr_->begin(); iter != overflow_dirinfos_ptr_->end(); iter++)
+            {
+                dirinfo_set.tryToInsertIfComplete(iter->first, is_insert);
+            }
+        }
+        UNUSED(is_insert);
 
-        dirinfo_set = DirinfoSet(tmp_dirinfo_set);
         return;
     }
 
     void DirectoryEntry::getAllValidDirinfo(DirinfoSet& dirinfo_set) const
     {
-        std::list<DirectoryInfo> tmp_dirinfo_set;
-        tmp_dirinfo_set.clear();
+        dirinfo_set = DirinfoSet(std::list<DirectoryInfo>()); // Empty complete dirinfo set
 
         // Add all valid directory information into valid_directory_info_set
-        for (dirinfo_entry_t::const_iterator iter = directory_entry_.begin(); iter != directory_entry_.end(); iter++)
+        bool is_insert = false;
+        for (uint32_t i = 0; i < inline_dirinfo_cnt_; i++)
         {
-            const DirectoryInfo& directory_info = iter->first;
-            const DirectoryMetadata& directory_metadata = iter->second;
-            if (directory_metadata.isValidMetadata()) // validity = true
+            if ((inline_validity_bitmap_ >> i) & 1) // validity = true
             {
-                tmp_dirinfo_set.push_back(directory_info);
+                dirinfo_set.tryToInsertIfComplete(DirectoryInfo(inline_edge_idxes_[i]), is_insert);
             }
         }
+        if (overflow_dirinfos_ptr_ != NULL)
+        {
+            for (overflow_dirinfos_t::const_iterator iter = overflow_dirinfos_ptr_->begin(); iter != overflow_dirinfos_ptr_->end(); iter++)
+            {
+                if (iter->second.isValidMetadata()) // validity = true
+                {
+                    dirinfo_set.tryToInsertIfComplete(iter->first, is_insert);
+                }
+            }
+        }
+        UNUSED(is_insert);
 
-        dirinfo_set = DirinfoSet(tmp_dirinfo_set);
         return;
     }
 
     bool DirectoryEntry::addDirinfo(const DirectoryInfo& directory_info, const DirectoryMetadata& directory_metadata, MetadataUpdateRequirement& metadata_update_requirement)
     {
         bool is_directory_already_exist = false;
-        dirinfo_entry_t::iterator iter = directory_entry_.find(directory_info);
-        if (iter == directory_entry_.end()) // directory info does not exist
+        const uint32_t target_edge_idx = directory_info.getTargetEdgeIdx();
+        const uint32_t inline_idx = findInlineIdx_(target_edge_idx);
+        const uint32_t overflow_idx = findOverflowIdx_(target_edge_idx);
+        if (inline_idx == INLINE_DIRINFO_CAPACITY && (overflow_dirinfos_ptr_ == NULL || overflow_idx == overflow_dirinfos_ptr_->size())) // directory info does not exist
         {
-            const bool is_from_single_to_multiple = (directory_entry_.size() == 1);
+            const bool is_from_single_to_multiple = (getDirinfoCnt_() == 1);
             const bool is_from_multiple_to_single = false; // Must NOT multiple-to-single due to NOT directory eviction
             uint32_t notify_edge_idx = 0; // The edge node index of the first cache copy
             if (is_from_single_to_multiple)
             {
-                notify_edge_idx = directory_entry_.begin()->first.getTargetEdgeIdx();
+                notify_edge_idx = getFirstEdgeIdx_();
             }
 
-            directory_entry_.insert(std::pair<DirectoryInfo, DirectoryMetadata>(directory_info, directory_metadata));
+            if (inline_dirinfo_cnt_ < INLINE_DIRINFO_CAPACITY) // Pack into inline dirinfos
+            {
+                inline_edge_idxes_[inline_dirinfo_cnt_] = target_edge_idx;
+                if (directory_metadata.isValidMetadata())
+                {
+                    inline_validity_bitmap_ |= (1 << inline_dirinfo_cnt_);
+                }
+                else
+                {
+                    inline_validity_bitmap_ &= ~(1 << inline_dirinfo_cnt_);
+                }
+                inline_dirinfo_cnt_++;
+            }
+            else // Widely replicated key
+            {
+                if (overflow_dirinfos_ptr_ == NULL)
+                {
+                    overflow_dirinfos_ptr_ = new overflow_dirinfos_t();
+                    assert(overflow_dirinfos_ptr_ != NULL);
+                }
+                overflow_dirinfos_ptr_->push_back(std::pair<DirectoryInfo, DirectoryMetadata>(directory_info, directory_metadata));
+            }
 
             is_directory_already_exist = false;
 
@@ -90,7 +145,21 @@ namespace covered
         }
         else // directory info already exists
         {
-            iter->second = directory_metadata;
+            if (inline_idx < INLINE_DIRINFO_CAPACITY)
+            {
+                if (directory_metadata.isValidMetadata())
+                {
+                    inline_validity_bitmap_ |= (1 << inline_idx);
+                }
+                else
+                {
+                    inline_validity_bitmap_ &= ~(1 << inline_idx);
+                }
+            }
+            else
+            {
+                (*overflow_dirinfos_ptr_)[overflow_idx].second = directory_metadata;
+            }
 
             is_directory_already_exist = true;
 
@@ -102,8 +171,10 @@ namespace covered
     bool DirectoryEntry::removeDirinfo(const DirectoryInfo& directory_info, MetadataUpdateRequirement& metadata_update_requirement)
     {
         bool is_directory_already_exist = false;
-        dirinfo_entry_t::const_iterator iter = directory_entry_.find(directory_info);
-        if (iter == directory_entry_.end()) // directory info does not exist
+        const uint32_t target_edge_idx = directory_info.getTargetEdgeIdx();
+        const uint32_t inline_idx = findInlineIdx_(target_edge_idx);
+        const uint32_t overflow_idx = findOverflowIdx_(target_edge_idx);
+        if (inline_idx == INLINE_DIRINFO_CAPACITY && (overflow_dirinfos_ptr_ == NULL || overflow_idx == overflow_dirinfos_ptr_->size())) // directory info does not exist
         {
             is_directory_already_exist = false;
 
@@ -111,14 +182,50 @@ namespace covered
         }
         else // directory info already exists
         {
-            directory_entry_.erase(iter);
+            if (inline_idx < INLINE_DIRINFO_CAPACITY)
+            {
+                if (overflow_dirinfos_ptr_ != NULL) // Refill the inline slot by the last overflow dirinfo
+                {
+                    assert(overflow_dirinfos_ptr_->size() > 0);
+                    const std::pair<DirectoryInfo, DirectoryMetadata>& last_overflow_dirinfo = overflow_dirinfos_ptr_->back();
+                    inline_edge_idxes_[inline_idx] = last_overflow_dirinfo.first.getTargetEdgeIdx();
+                    if (last_overflow_dirinfo.second.isValidMetadata())
+                    {
+                        inline_validity_bitmap_ |= (1 << inline_idx);
+                    }
+                    else
+                    {
+                        inline_validity_bitmap_ &= ~(1 << inline_idx);
+                    }
+                    overflow_dirinfos_ptr_->pop_back();
+                }
+                else // Keep inline dirinfos compact
+                {
+                    for (uint32_t i = inline_idx; i + 1 < inline_dirinfo_cnt_; i++)
+                    {
+                        inline_edge_idxes_[i] = inline_edge_idxes_[i + 1];
+                    }
+                    const uint8_t lower_bitmask = (1 << inline_idx) - 1;
+                    inline_validity_bitmap_ = (inline_validity_bitmap_ & lower_bitmask) | ((inline_validity_bitmap_ >> 1) & ~lower_bitmask);
+                    inline_dirinfo_cnt_--;
+                    inline_validity_bitmap_ &= (1 << inline_dirinfo_cnt_) - 1;
+                }
+            }
+            else
+            {
+                overflow_dirinfos_ptr_->erase(overflow_dirinfos_ptr_->begin() + overflow_idx);
+            }
+            if (overflow_dirinfos_ptr_ != NULL && overflow_dirinfos_ptr_->size() == 0)
+            {
+                releaseOverflowDirinfos_();
+            }
 
             const bool is_single_to_multiple = false; // Must NOT single-to-multiple due to evicting instead of admiting dirinfo
-            const bool is_multiple_to_single = (directory_entry_.size() == 1);
+            const bool is_multiple_to_single = (getDirinfoCnt_() == 1);
             uint32_t notify_edge_idx = 0; // The edge node index of the last cache copy
             if (is_multiple_to_single)
             {
-                notify_edge_idx = directory_entry_.begin()->first.getTargetEdgeIdx();
+                notify_edge_idx = getFirstEdgeIdx_();
             }
 
             is_directory_already_exist = true;
@@ -137,115 +244,96 @@ namespace covered
 
     void DirectoryEntry::invalidateMetadataForAllDirinfoIfExist(DirinfoSet& all_dirinfo)
     {
-        std::list<DirectoryInfo> tmp_dirinfo_set;
-        for (dirinfo_entry_t::iterator iter = directory_entry_.begin(); iter != directory_entry_.end(); iter++)
+        inline_validity_bitmap_ = 0;
+        if (overflow_dirinfos_ptr_ != NULL)
         {
-            iter->second.invalidateMetadata();
-            tmp_dirinfo_set.push_back(iter->first);
+            for (overflow_dirinfos_t::iterator iter = overflow_dirinfos_ptr_->begin(); iter != overflow_dirinfos_ptr_->end(); iter++)
+            {
+                iter->second.invalidateMetadata();
+            }
         }
-        all_dirinfo = DirinfoSet(tmp_dirinfo_set);
+        getAllDirinfo(all_dirinfo);
         return;
     }
 
     bool DirectoryEntry::validateMetadataForDirinfoIfExist(const DirectoryInfo& directory_info)
     {
         bool is_dirinfo_exist = false;
-        dirinfo_entry_t::iterator iter = directory_entry_.find(directory_info);
-        if (iter != directory_entry_.end())
+        const uint32_t target_edge_idx = directory_info.getTargetEdgeIdx();
+        const uint32_t inline_idx = findInlineIdx_(target_edge_idx);
+        if (inline_idx < INLINE_DIRINFO_CAPACITY)
         {
-            iter->second.validateMetadata();
+            inline_validity_bitmap_ |= (1 << inline_idx);
             is_dirinfo_exist = true;
         }
+        else if (overflow_dirinfos_ptr_ != NULL)
+        {
+            const uint32_t overflow_idx = findOverflowIdx_(target_edge_idx);
+            if (overflow_idx < overflow_dirinfos_ptr_->size())
+            {
+                (*overflow_dirinfos_ptr_)[overflow_idx].second.validateMetadata();
+                is_dirinfo_exist = true;
+            }
+        }
         return is_dirinfo_exist;
     }
 
+    bool DirectoryEntry::isEmpty() const
+    {
+        return getDirinfoCnt_() == 0;
+    }
+
     // (2) For ConcurrentHashtable
 
     uint64_t DirectoryEntry::getSizeForCapacity() const
     {
-        uint64_t size = 0;
-        for (dirinfo_entry_t::const_iterator iter = directory_entry_.begin(); iter != directory_entry_.end(); iter++)
-        {
-            size += iter->first.getSizeForCapacity();
-            size += iter->second.getSizeForCapacity();
-        }
+        // NOTE: validity metadata of dirinfos is packed as bits
+        const uint32_t dirinfo_cnt = getDirinfoCnt_();
+        uint64_t size = dirinfo_cnt * DirectoryInfo().getSizeForCapacity();
+        size += (dirinfo_cnt + 7) / 8;
         return size;
     }
 
-    bool DirectoryEntry::call(const std::string& function_name, void* param_ptr)
+    const DirectoryEntry& DirectoryEntry::operator=(const DirectoryEntry& other)
     {
-        assert(param_ptr != NULL);
-
-        bool is_erase = false;
-
-        if (function_name == ADD_DIRINFO_FUNCNAME)
+        if (this == &other)
         {
-            AddDirinfoParam* tmp_param_ptr = static_cast<AddDirinfoParam*>(param_ptr);
-            tmp_param_ptr->is_directory_already_exist = addDirinfo(tmp_param_ptr->directory_info, tmp_param_ptr->directory_metadata, tmp_param_ptr->metadata_update_requirement_ref);
+            return *this;
         }
-        else if (function_name == REMOVE_DIRINFO_FUNCNAME)
-        {
-            RemoveDirinfoParam* tmp_param_ptr = static_cast<RemoveDirinfoParam*>(param_ptr);
-            tmp_param_ptr->is_directory_already_exist = removeDirinfo(tmp_param_ptr->directory_info, tmp_param_ptr->metadata_update_requirement_ref);
 
-            if (directory_entry_.size() == 0)
-            {
-                tmp_param_ptr->is_global_cached = false; // Help DirectoryTable to judge if key is global cached
-                is_erase = true; // the key-direntry pair can be erased due to empty direntry
-            }
-            else
-            {
-                tmp_param_ptr->is_global_cached = true;
-                is_erase = false;
-            }
-        }
-        else if (function_name == INVALIDATE_METADATA_FOR_ALL_DIRINFO_IF_EXIST_FUNCNAME)
-        {
-            InvalidateMetadataForAllDirinfoIfExistParam* tmp_param_ptr = static_cast<InvalidateMetadataForAllDirinfoIfExistParam*>(param_ptr);
-            invalidateMetadataForAllDirinfoIfExist(tmp_param_ptr->all_dirinfo);
-        }
-        else if (function_name == VALIDATE_METADATA_FOR_DIRINFO_IF_EXIST_FUNCNAME)
-        {
-            ValidateMetadataForDirinfoIfExistParam* tmp_param_ptr = static_cast<ValidateMetadataForDirinfoIfExistParam*>(param_ptr);
-            tmp_param_ptr->is_dirinfo_exist = validateMetadataForDirinfoIfExist(tmp_param_ptr->directory_info);
-        }
-        else
+        inline_edge_idxes_[0] = other.inline_edge_idxes_[0];
+        inline_edge_idxes_[1] = other.inline_edge_idxes_[1];
+        inline_dirinfo_cnt_ = other.inline_dirinfo_cnt_;
+        inline_validity_bitmap_ = other.inline_validity_bitmap_;
+
+        releaseOverflowDirinfos_();
+        if (other.overflow_dirinfos_ptr_ != NULL) // Deep copy
         {
-            std::ostringstream oss;
-            oss << "invalid function name " << function_name << " for call()!";
-            Util::dumpErrorMsg(kClassName, oss.str());
-            exit(1);
+            overflow_dirinfos_ptr_ = new overflow_dirinfos_t(*other.overflow_dirinfos_ptr_);
+            assert(overflow_dirinfos_ptr_ != NULL);
         }
-
-        return is_erase;
+        return *this;
     }
 
-    void DirectoryEntry::constCall(const std::string& function_name, void* param_ptr) const
+    const DirectoryEntry& DirectoryEntry::operator=(DirectoryEntry&& other) noexcept
     {
-        if (function_name == GET_ALL_VALID_DIRINFO_FUNCNAME)
+        if (this == &other)
         {
-            GetAllValidDirinfoParam* tmp_param_ptr = static_cast<GetAllValidDirinfoParam*>(param_ptr);
-            getAllValidDirinfo(tmp_param_ptr->dirinfo_set);
+            return *this;
         }
-        else if (function_name == GET_ALL_DIRINFO_FUNCNAME)
-        {
-            GetAllDirinfoParam* tmp_param_ptr = static_cast<GetAllDirinfoParam*>(param_ptr);
-            getAllDirinfo(tmp_param_ptr->dirinfo_set);
-        }
-        else
-        {
-            std::ostringstream oss;
-            oss << "invalid function name " << function_name << " for constCall()!";
-            Util::dumpErrorMsg(kClassName, oss.str());
-            exit(1);
-        }
-        
-        return;
-    }
 
-    const DirectoryEntry& DirectoryEntry::operator=(const DirectoryEntry& other)
-    {
-        directory_entry_ = other.directory_entry_;
+        inline_edge_idxes_[0] = other.inline_edge_idxes_[0];
+        inline_edge_idxes_[1] = other.inline_edge_idxes_[1];
+        inline_dirinfo_cnt_ = other.inline_dirinfo_cnt_;
+        inline_validity_bitmap_ = other.inline_validity_bitmap_;
+
+        releaseOverflowDirinfos_();
+        overflow_dirinfos_ptr_ = other.overflow_dirinfos_ptr_; // Steal ownership
+        other.overflow_dirinfos_ptr_ = NULL; // NOTE: MUST reset source to avoid double free
+
+        // Reset source as an empty directory entry
+        other.inline_dirinfo_cnt_ = 0;
+        other.inline_validity_bitmap_ = 0;
         return *this;
     }
 
@@ -257,19 +345,27 @@ namespace covered
 
         // Dump dirinfo-dirmetadata pairs
         // (1) pair cnt
-        const uint32_t pair_cnt = directory_entry_.size();
+        const uint32_t pair_cnt = getDirinfoCnt_();
         fs_ptr->write((const char*)&pair_cnt, sizeof(uint32_t));
         // (2) dirinfo-dirmetadata pairs
-        for (dirinfo_entry_t::const_iterator tmp_const_iter = directory_entry_.begin(); tmp_const_iter != directory_entry_.end(); tmp_const_iter++)
+        for (uint32_t i = 0; i < inline_dirinfo_cnt_; i++)
         {
             // Dump the dirinfo
-            const DirectoryInfo& directory_info = tmp_const_iter->first;
+            const DirectoryInfo directory_info(inline_edge_idxes_[i]);
             directory_info.serialize(fs_ptr);
 
             // Dump the directory metadata
-            const DirectoryMetadata& directory_metadata = tmp_const_iter->second;
+            const DirectoryMetadata directory_metadata(((inline_validity_bitmap_ >> i) & 1) == 1);
             directory_metadata.dumpDirectoryMetadata(fs_ptr);
         }
+        if (overflow_dirinfos_ptr_ != NULL)
+        {
+            for (overflow_dirinfos_t::const_iterator tmp_const_iter = overflow_dirinfos_ptr_->begin(); tmp_const_iter != overflow_dirinfos_ptr_->end(); tmp_const_iter++)
+            {
+                tmp_const_iter->first.serialize(fs_ptr);
+                tmp_const_iter->second.dumpDirectoryMetadata(fs_ptr);
+            }
+        }
 
         return;
     }
@@ -283,7 +379,7 @@ namespace covered
         uint32_t pair_cnt = 0;
         fs_ptr->read((char*)&pair_cnt, sizeof(uint32_t));
         // (2) dirinfo-dirmetadata pairs
-        directory_entry_.clear();
+        *this = DirectoryEntry();
         for (uint32_t i = 0; i < pair_cnt; i++)
         {
             // Load the dirinfo
@@ -295,9 +391,68 @@ namespace covered
             directory_metadata.loadDirectoryMetadata(fs_ptr);
 
             // Update the directory entry
-            directory_entry_.insert(std::pair<DirectoryInfo, DirectoryMetadata>(directory_info, directory_metadata));
+            MetadataUpdateRequirement unused_metadata_update_requirement;
+            addDirinfo(directory_info, directory_metadata, unused_metadata_update_requirement);
+            UNUSED(unused_metadata_update_requirement);
+        }
+
+        return;
+    }
+
+    uint32_t DirectoryEntry::getDirinfoCnt_() const
+    {
+        uint32_t dirinfo_cnt = inline_dirinfo_cnt_;
+        if (overflow_dirinfos_ptr_ != NULL)
+        {
+            dirinfo_cnt += overflow_dirinfos_ptr_->size();
+        }
+        return dirinfo_cnt;
+    }
+
+    uint32_t DirectoryEntry::findInlineIdx_(const uint32_t& target_edge_idx) const
+    {
+        for (uint32_t i = 0; i < inline_dirinfo_cnt_; i++)
+        {
+            if (inline_edge_idxes_[i] == target_edge_idx)
+            {
+                return i;
+            }
+        }
+        return INLINE_DIRINFO_CAPACITY;
+    }
+
+    uint32_t DirectoryEntry::findOverflowIdx_(const uint32_t& target_edge_idx) const
+    {
+        if (overflow_dirinfos_ptr_ == NULL)
+        {
+            return 0;
         }
 
+        uint32_t i = 0;
+        for (; i < overflow_dirinfos_ptr_->size(); i++)
+        {
+            if ((*overflow_dirinfos_ptr_)[i].first.getTargetEdgeIdx() == target_edge_idx)
+            {
+                break;
+            }
+        }
+        return i;
+    }
+
+    uint32_t DirectoryEntry::getFirstEdgeIdx_() const
+    {
+        assert(getDirinfoCnt_() == 1);
+        assert(inline_dirinfo_cnt_ == 1); // NOTE: NO overflow dirinfo if inline dirinfos are NOT full
+        return inline_edge_idxes_[0];
+    }
+
+    void DirectoryEntry::releaseOverflowDirinfos_()
+    {
+        if (overflow_dirinfos_ptr_ != NULL)
+        {
+            delete overflow_dirinfos_ptr_;
+            overflow_dirinfos_ptr_ = NULL;
+        }
         return;
     }
-}
\ No newline at end of file
+}
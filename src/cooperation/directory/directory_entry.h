@@ -1,5 +1,7 @@
 /*
  * DirectoryEntry: a directory entry stores multiple directory infos and metadatas for the given key (building blocks for DirectoryTable).
+ *
+ * NOTE: most keys are cached by one or two edge nodes, so we pack the first INLINE_DIRINFO_CAPACITY dirinfos (target edge indexes and validity bits) inline without heap allocation, and ONLY allocate overflow dirinfos for widely replicated keys.
  * 
  * By Siyuan Sheng (2023.06.28).
  */
@@ -8,8 +10,7 @@
 #define DIRECTORY_ENTRY_H
 
 #include <string>
-#include <unordered_set>
-#include <unordered_map>
+#include <vector>
 
 #include "cooperation/directory/directory_info.h"
 #include "cooperation/directory/directory_metadata.h"
@@ -21,51 +22,11 @@ namespace covered
     class DirectoryEntry
     {
     public:
-        struct GetAllDirinfoParam
-        {
-            DirinfoSet& dirinfo_set;
-        };
-
-        struct GetAllValidDirinfoParam
-        {
-            DirinfoSet& dirinfo_set;
-        };
-
-        struct AddDirinfoParam
-        {
-            const DirectoryInfo& directory_info;
-            const DirectoryMetadata& directory_metadata;
-            bool is_directory_already_exist;
-            MetadataUpdateRequirement& metadata_update_requirement_ref;
-        };
-        
-        struct RemoveDirinfoParam
-        {
-            const DirectoryInfo& directory_info;
-            bool is_directory_already_exist;
-            bool is_global_cached;
-            MetadataUpdateRequirement& metadata_update_requirement_ref;
-        };
-
-        struct InvalidateMetadataForAllDirinfoIfExistParam
-        {
-            DirinfoSet& all_dirinfo;
-        };
-        
-        struct ValidateMetadataForDirinfoIfExistParam
-        {
-            const DirectoryInfo& directory_info;
-            bool is_dirinfo_exist;
-        };
-
-        static const std::string GET_ALL_DIRINFO_FUNCNAME;
-        static const std::string GET_ALL_VALID_DIRINFO_FUNCNAME;
-        static const std::string ADD_DIRINFO_FUNCNAME;
-        static const std::string REMOVE_DIRINFO_FUNCNAME;
-        static const std::string INVALIDATE_METADATA_FOR_ALL_DIRINFO_IF_EXIST_FUNCNAME;
-        static const std::string VALIDATE_METADATA_FOR_DIRINFO_IF_EXIST_FUNCNAME;
+        static const uint32_t INLINE_DIRINFO_CAPACITY;
 
         DirectoryEntry();
+        DirectoryEntry(const DirectoryEntry& other);
+        DirectoryEntry(DirectoryEntry&& other) noexcept; // Steal overflow dirinfos w/o deep copy (e.g., during rehashing)
         ~DirectoryEntry();
 
         // (1) Access per-dirinfo metadata
@@ -76,25 +37,35 @@ namespace covered
         bool removeDirinfo(const DirectoryInfo& directory_info, MetadataUpdateRequirement& metadata_update_requirement); // return is_directory_already_exist
         void invalidateMetadataForAllDirinfoIfExist(DirinfoSet& all_dirinfo); // Invalidate all metadatas only if dirinfos exist (NOT add invalid metadata)
         bool validateMetadataForDirinfoIfExist(const DirectoryInfo& directory_info); // Validate metadata only if dirinfo exists (NOT add invalid metadata) (return if dirinfo exists)
+        bool isEmpty() const; // Whether NO dirinfo exists (i.e., the key-direntry pair can be erased)
 
         // (2) For ConcurrentHashtable
 
-        uint64_t getSizeForCapacity() const;
-        bool call(const std::string& function_name, void* param_ptr);
-        void constCall(const std::string& function_name, void* param_ptr) const;
+        uint64_t getSizeForCapacity() const; // NOTE: 4B per dirinfo + packed validity bits (previously 5B per dirinfo, i.e., 4B DirectoryInfo + 1B DirectoryMetadata), so more capacity is left for cached objects of widely replicated keys
 
         const DirectoryEntry& operator=(const DirectoryEntry& other);
+        const DirectoryEntry& operator=(DirectoryEntry&& other) noexcept;
 
         // (3) Dump/load directory entry for directory table of cooperation snapshot
         void dumpDirectoryEntry(std::fstream* fs_ptr) const;
         void loadDirectoryEntry(std::fstream* fs_ptr);
     private:
-        typedef std::unordered_map<DirectoryInfo, DirectoryMetadata, DirectoryInfoHasher> dirinfo_entry_t;
+        typedef std::vector<std::pair<DirectoryInfo, DirectoryMetadata>> overflow_dirinfos_t;
 
         static const std::string kClassName;
 
+        uint32_t getDirinfoCnt_() const;
+        uint32_t findInlineIdx_(const uint32_t& target_edge_idx) const; // Return INLINE_DIRINFO_CAPACITY if NOT found
+        uint32_t findOverflowIdx_(const uint32_t& target_edge_idx) const; // Return overflow size if NOT found (or 0 without overflow)
+        uint32_t getFirstEdgeIdx_() const; // ONLY used if with a single dirinfo
+        void releaseOverflowDirinfos_();
+
         // NOTE: conflictions between reader(s) and write(s) have been fixed by DirectoryTable::rwlock_
-        dirinfo_entry_t directory_entry_; // Metadata for cooperation
+        // NOTE: inline dirinfos are always compact (i.e., [0, inline_dirinfo_cnt_)), and overflow dirinfos exist ONLY if inline dirinfos are full
+        uint32_t inline_edge_idxes_[2]; // NOTE: MUST be consistent with INLINE_DIRINFO_CAPACITY
+        uint8_t inline_dirinfo_cnt_;
+        uint8_t inline_validity_bitmap_; // The ith bit is validity of the ith inline dirinfo
+        overflow_dirinfos_t* overflow_dirinfos_ptr_; // NULL if NOT widely replicated
     };
 }
 
@@ -22,47 +22,27 @@ namespace covered
 
         // (1) Perform delta compression on the set of dirinfos
 
-        std::list<DirectoryInfo> new_dirinfo_set;
-        std::list<DirectoryInfo> stale_dirinfo_set;
-        bool with_complete_dirinfo_set = true;
-        uint32_t total_payload_size_for_current_dirinfo_set = 0;
-        uint32_t total_payload_size_for_final_dirinfo_set = 0;
+        // Calculate delta dirinfos by set difference of bitmaps
+        EdgeBitset new_dirinfo_set = current_dirinfo_set.dirinfo_set_; // New dirinfos (with current yet without prev)
+        new_dirinfo_set.differenceWith(prev_dirinfo_set.dirinfo_set_);
+        EdgeBitset stale_dirinfo_set = prev_dirinfo_set.dirinfo_set_; // Stale dirinfos (with prev yet without current)
+        stale_dirinfo_set.differenceWith(current_dirinfo_set.dirinfo_set_);
 
-        // Calculate delta dirinfos
-        std::list<DirectoryInfo> current_dirinfo_list;
-        bool current_with_complete_dirinfo_set = current_dirinfo_set.getDirinfoSetIfComplete(current_dirinfo_list);
-        assert(current_with_complete_dirinfo_set == true);
-        std::list<DirectoryInfo> prev_dirinfo_list;
-        bool prev_with_complete_dirinfo_set = prev_dirinfo_set.getDirinfoSetIfComplete(prev_dirinfo_list);
-        assert(prev_with_complete_dirinfo_set == true);
-        for (std::list<DirectoryInfo>::const_iterator current_dirinfo_list_const_iter = current_dirinfo_list.begin(); current_dirinfo_list_const_iter != current_dirinfo_list.end(); current_dirinfo_list_const_iter++) // Get new dirinfos
+        // Set delta dirinfos for compression if necessary
+        const uint32_t total_payload_size_for_current_dirinfo_set = current_dirinfo_set.dirinfo_set_.getEdgeBitsetPayloadSize();
+        uint32_t total_payload_size_for_final_dirinfo_set = 0;
+        if (!new_dirinfo_set.empty())
         {
-            const DirectoryInfo& tmp_current_dirinfo = *current_dirinfo_list_const_iter;
-            total_payload_size_for_current_dirinfo_set += tmp_current_dirinfo.getDirectoryInfoPayloadSize();
-
-            std::list<DirectoryInfo>::const_iterator tmp_prev_dirinfo_list_const_iter = DirectoryInfo::findDirinfoFromList(tmp_current_dirinfo, prev_dirinfo_list);
-            if (tmp_prev_dirinfo_list_const_iter == prev_dirinfo_list.end()) // New dirinfo (with current yet without prev)
-            {
-                new_dirinfo_set.push_back(tmp_current_dirinfo);
-                total_payload_size_for_final_dirinfo_set += tmp_current_dirinfo.getDirectoryInfoPayloadSize();
-            }
+            total_payload_size_for_final_dirinfo_set += new_dirinfo_set.getEdgeBitsetPayloadSize();
         }
-        for (std::list<DirectoryInfo>::const_iterator prev_dirinfo_list_const_iter = prev_dirinfo_list.begin(); prev_dirinfo_list_const_iter != prev_dirinfo_list.end(); prev_dirinfo_list_const_iter++) // Get stale dirinfos
+        if (!stale_dirinfo_set.empty())
         {
-            const DirectoryInfo& tmp_prev_dirinfo = *prev_dirinfo_list_const_iter;
-            std::list<DirectoryInfo>::const_iterator tmp_current_dirinfo_list_const_iter = DirectoryInfo::findDirinfoFromList(tmp_prev_dirinfo, current_dirinfo_list);
-            if (tmp_current_dirinfo_list_const_iter == current_dirinfo_list.end()) // Stale dirinfo (with prev yet without current)
-            {
-                stale_dirinfo_set.push_back(tmp_prev_dirinfo);
-                total_payload_size_for_final_dirinfo_set += tmp_prev_dirinfo.getDirectoryInfoPayloadSize();
-            }
+            total_payload_size_for_final_dirinfo_set += stale_dirinfo_set.getEdgeBitsetPayloadSize();
         }
-
-        // Set delta dirinfos for compression if necessary
-        with_complete_dirinfo_set = (total_payload_size_for_current_dirinfo_set <= total_payload_size_for_final_dirinfo_set);
+        bool with_complete_dirinfo_set = (total_payload_size_for_current_dirinfo_set <= total_payload_size_for_final_dirinfo_set);
         if (!with_complete_dirinfo_set)
         {
-            compressed_dirinfo_set.setDeltaDirinfoSetForCompress(new_dirinfo_set, stale_dirinfo_set);
+            compressed_dirinfo_set.setDeltaDirinfoSetForCompress_(new_dirinfo_set, stale_dirinfo_set);
         }
 
         // (2) Get final dirinfo set
@@ -95,43 +75,20 @@ namespace covered
 
         DirinfoSet complete_dirinfo_set = existing_dirinfo_set;
 
-        // (1) Recover complete dirinfo unordered set
-
-        // Start from existing complete dirinfo unordered set
-        std::list<DirectoryInfo> complete_dirinfo_list;
-        bool tmp_with_complete_dirinfo_list = existing_dirinfo_set.getDirinfoSetIfComplete(complete_dirinfo_list);
-        assert(tmp_with_complete_dirinfo_list);
-
-        // Get delta dirinfo sets
-        std::list<DirectoryInfo> new_dirinfo_set;
-        std::list<DirectoryInfo> stale_dirinfo_set;
-        tmp_with_complete_dirinfo_list = compressed_dirinfo_set.getDeltaDirinfoSetIfCompressed(new_dirinfo_set, stale_dirinfo_set);
-        assert(!tmp_with_complete_dirinfo_list);
+        // (1) Recover complete dirinfo set by set union/difference of bitmaps (start from existing complete dirinfo set)
 
         // Add new dirinfos into complete dirinfo set
-        for (std::list<DirectoryInfo>::const_iterator new_dirinfo_set_const_iter = new_dirinfo_set.begin(); new_dirinfo_set_const_iter != new_dirinfo_set.end(); new_dirinfo_set_const_iter++)
+        if ((compressed_dirinfo_set.delta_bitmap_ & NEW_DIRINFO_SET_DELTA_MASK) == NEW_DIRINFO_SET_DELTA_MASK)
         {
-            const DirectoryInfo& tmp_dirinfo = *new_dirinfo_set_const_iter;
-            if (DirectoryInfo::findDirinfoFromList(tmp_dirinfo, complete_dirinfo_list) == complete_dirinfo_list.end())
-            {
-                complete_dirinfo_list.push_back(tmp_dirinfo);
-            }
+            complete_dirinfo_set.dirinfo_set_.unionWith(compressed_dirinfo_set.new_dirinfo_delta_set_);
         }
 
         // Remove stale dirinfos from complete dirinfo set
-        for (std::list<DirectoryInfo>::const_iterator stale_dirinfo_set_const_iter = stale_dirinfo_set.begin(); stale_dirinfo_set_const_iter != stale_dirinfo_set.end(); stale_dirinfo_set_const_iter++)
+        if ((compressed_dirinfo_set.delta_bitmap_ & STALE_DIRINFO_SET_DELTA_MASK) == STALE_DIRINFO_SET_DELTA_MASK)
         {
-            const DirectoryInfo& tmp_dirinfo = *stale_dirinfo_set_const_iter;
-            std::list<DirectoryInfo>::const_iterator tmp_complete_dirinfo_list_const_iter = DirectoryInfo::findDirinfoFromList(tmp_dirinfo, complete_dirinfo_list);
-            if (tmp_complete_dirinfo_list_const_iter != complete_dirinfo_list.end())
-            {
-                complete_dirinfo_list.erase(tmp_complete_dirinfo_list_const_iter);
-            }
+            complete_dirinfo_set.dirinfo_set_.differenceWith(compressed_dirinfo_set.stale_dirinfo_delta_set_);
         }
 
-        // Replace existing complete dirinfo set with recovered one
-        complete_dirinfo_set.setDirinfoSetForComplete(complete_dirinfo_list);
-
         assert(complete_dirinfo_set.isComplete());
         return complete_dirinfo_set;
     }
@@ -144,7 +101,7 @@ namespace covered
     DirinfoSet::DirinfoSet(const std::list<DirectoryInfo>& dirinfo_set) : new_dirinfo_delta_set_(), stale_dirinfo_delta_set_()
     {
         delta_bitmap_ = COMPLETE_BITMAP;
-        dirinfo_set_ = dirinfo_set;
+        convertDirinfoListToBitset_(dirinfo_set, dirinfo_set_);
     }
 
     DirinfoSet::~DirinfoSet()
@@ -195,13 +152,26 @@ namespace covered
         if (with_complete_dirinfo_set)
         {
             // Check if directory info exists
-            std::list<DirectoryInfo>::const_iterator dirinfo_set_const_iter = DirectoryInfo::findDirinfoFromList(directory_info, dirinfo_set_);
-            is_exist = (dirinfo_set_const_iter != dirinfo_set_.end());
+            is_exist = dirinfo_set_.isExist(directory_info.getTargetEdgeIdx());
         }
         
         return with_complete_dirinfo_set;
     }
 
+    bool DirinfoSet::isCoveredByIfComplete(const EdgeBitset& edge_bitset, bool& is_covered) const
+    {
+        assert(delta_bitmap_ != INVALID_BITMAP);
+
+        bool with_complete_dirinfo_set = isComplete();
+        if (with_complete_dirinfo_set)
+        {
+            // Check if all directory infos are in the given edge bitset
+            is_covered = dirinfo_set_.isSubsetOf(edge_bitset);
+        }
+
+        return with_complete_dirinfo_set;
+    }
+
     bool DirinfoSet::getDirinfoSetSizeIfComplete(uint32_t& dirinfo_set_size) const
     {
         assert(delta_bitmap_ != INVALID_BITMAP);
@@ -222,12 +192,7 @@ namespace covered
         if (with_complete_dirinfo_set)
         {
             // Try to insert directory info if not exists
-            std::list<DirectoryInfo>::const_iterator dirinfo_set_const_iter = DirectoryInfo::findDirinfoFromList(directory_info, dirinfo_set_);
-            if (dirinfo_set_const_iter == dirinfo_set_.end())
-            {
-                dirinfo_set_.push_back(directory_info);
-                is_insert = true;
-            }
+            is_insert = dirinfo_set_.insert(directory_info.getTargetEdgeIdx());
         }
         return with_complete_dirinfo_set;
     }
@@ -239,12 +204,7 @@ namespace covered
         if (with_complete_dirinfo_set)
         {
             // Try to erase directory info if exists
-            std::list<DirectoryInfo>::const_iterator dirinfo_set_const_iter = DirectoryInfo::findDirinfoFromList(directory_info, dirinfo_set_);
-            if (dirinfo_set_const_iter != dirinfo_set_.end())
-            {
-                dirinfo_set_.erase(dirinfo_set_const_iter);
-                is_erase = true;
-            }
+            is_erase = dirinfo_set_.erase(directory_info.getTargetEdgeIdx());
         }
         return with_complete_dirinfo_set;
     }
@@ -257,10 +217,7 @@ namespace covered
             assert(advance_idx < dirinfo_set_.size());
 
             // Get ith directory info if exists
-            std::list<DirectoryInfo>::const_iterator dirinfo_set_const_iter = dirinfo_set_.begin();
-            std::advance(dirinfo_set_const_iter, advance_idx);
-            assert(dirinfo_set_const_iter != dirinfo_set_.end());
-            directory_info = *dirinfo_set_const_iter;
+            directory_info = DirectoryInfo(dirinfo_set_.getEdgeIdxByRank(advance_idx));
         }
         return with_complete_dirinfo_set;
     }
@@ -274,7 +231,7 @@ namespace covered
         bool with_complete_dirinfo_set = isComplete();
         if (with_complete_dirinfo_set)
         {
-            dirinfo_set = dirinfo_set_;
+            convertDirinfoBitsetToList_(dirinfo_set_, dirinfo_set);
         }
 
         return with_complete_dirinfo_set;
@@ -287,7 +244,7 @@ namespace covered
         delta_bitmap_ = COMPLETE_BITMAP;
         new_dirinfo_delta_set_.clear();
         stale_dirinfo_delta_set_.clear();
-        dirinfo_set_ = dirinfo_set;
+        convertDirinfoListToBitset_(dirinfo_set, dirinfo_set_);
 
         return;
     }
@@ -308,13 +265,13 @@ namespace covered
             {
                 assert(new_dirinfo_delta_set_.size() > 0);
 
-                new_dirinfo_delta_set = new_dirinfo_delta_set_;
+                convertDirinfoBitsetToList_(new_dirinfo_delta_set_, new_dirinfo_delta_set);
             }
             if ((delta_bitmap_ & STALE_DIRINFO_SET_DELTA_MASK) == STALE_DIRINFO_SET_DELTA_MASK)
             {
                 assert(stale_dirinfo_delta_set_.size() > 0);
 
-                stale_dirinfo_delta_set = stale_dirinfo_delta_set_;
+                convertDirinfoBitsetToList_(stale_dirinfo_delta_set_, stale_dirinfo_delta_set);
             }
         }
 
@@ -323,22 +280,11 @@ namespace covered
 
     void DirinfoSet::setDeltaDirinfoSetForCompress(const std::list<DirectoryInfo>& new_dirinfo_delta_set, const std::list<DirectoryInfo>& stale_dirinfo_delta_set)
     {
-        assert(delta_bitmap_ != INVALID_BITMAP);
-
-        delta_bitmap_ |= DELTA_MASK;
-        dirinfo_set_.clear();
-
-        if (new_dirinfo_delta_set.size() > 0)
-        {
-            delta_bitmap_ |= NEW_DIRINFO_SET_DELTA_MASK;
-            new_dirinfo_delta_set_ = new_dirinfo_delta_set;
-        }
-
-        if (stale_dirinfo_delta_set.size() > 0)
-        {
-            delta_bitmap_ |= STALE_DIRINFO_SET_DELTA_MASK;
-            stale_dirinfo_delta_set_ = stale_dirinfo_delta_set;
-        }
+        EdgeBitset new_dirinfo_delta_bitset;
+        convertDirinfoListToBitset_(new_dirinfo_delta_set, new_dirinfo_delta_bitset);
+        EdgeBitset stale_dirinfo_delta_bitset;
+        convertDirinfoListToBitset_(stale_dirinfo_delta_set, stale_dirinfo_delta_bitset);
+        setDeltaDirinfoSetForCompress_(new_dirinfo_delta_bitset, stale_dirinfo_delta_bitset);
 
         return;
     }
@@ -554,42 +500,51 @@ namespace covered
         return *this;
     }
 
-    uint32_t DirinfoSet::getDirinfoSetPayloadSizeInternal_(const std::list<DirectoryInfo>& dirinfo_set) const
+    void DirinfoSet::setDeltaDirinfoSetForCompress_(const EdgeBitset& new_dirinfo_delta_set, const EdgeBitset& stale_dirinfo_delta_set)
     {
-        uint32_t dirinfo_set_payload_size = 0;
+        assert(delta_bitmap_ != INVALID_BITMAP);
 
-        dirinfo_set_payload_size += sizeof(uint32_t); // dirinfo set size
-        for (std::list<DirectoryInfo>::const_iterator dirinfo_const_iter = dirinfo_set.begin(); dirinfo_const_iter != dirinfo_set.end(); dirinfo_const_iter++)
+        delta_bitmap_ |= DELTA_MASK;
+        dirinfo_set_.clear();
+
+        if (!new_dirinfo_delta_set.empty())
         {
-            dirinfo_set_payload_size += dirinfo_const_iter->getDirectoryInfoPayloadSize(); // complete dirinfos
+            delta_bitmap_ |= NEW_DIRINFO_SET_DELTA_MASK;
+            new_dirinfo_delta_set_ = new_dirinfo_delta_set;
         }
 
-        return dirinfo_set_payload_size;
+        if (!stale_dirinfo_delta_set.empty())
+        {
+            delta_bitmap_ |= STALE_DIRINFO_SET_DELTA_MASK;
+            stale_dirinfo_delta_set_ = stale_dirinfo_delta_set;
+        }
+
+        return;
     }
 
-    uint32_t DirinfoSet::serializeDirinfoSetInternal_(DynamicArray& msg_payload, const uint32_t& position, const std::list<DirectoryInfo>& dirinfo_set) const
+    uint32_t DirinfoSet::getDirinfoSetPayloadSizeInternal_(const EdgeBitset& dirinfo_set) const
     {
-        uint32_t size = position;
-        uint32_t dirinfo_set_size = dirinfo_set.size();
-        msg_payload.deserialize(size, (const char*)&dirinfo_set_size, sizeof(uint32_t));
-        size += sizeof(uint32_t);
-        for (std::list<DirectoryInfo>::const_iterator dirinfo_const_iter = dirinfo_set.begin(); dirinfo_const_iter != dirinfo_set.end(); dirinfo_const_iter++)
-        {
-            uint32_t dirinfo_serialize_size = dirinfo_const_iter->serialize(msg_payload, size);
-            size += dirinfo_serialize_size;
-        }
-        return size - position;
+        return dirinfo_set.getEdgeBitsetPayloadSize(); // Compact bitmap of target edge indexes
     }
 
-    uint32_t DirinfoSet::serializeDirinfoSetInternal_(std::fstream* fs_ptr, const std::list<DirectoryInfo>& dirinfo_set) const
+    uint32_t DirinfoSet::serializeDirinfoSetInternal_(DynamicArray& msg_payload, const uint32_t& position, const EdgeBitset& dirinfo_set) const
+    {
+        return dirinfo_set.serialize(msg_payload, position);
+    }
+
+    uint32_t DirinfoSet::serializeDirinfoSetInternal_(std::fstream* fs_ptr, const EdgeBitset& dirinfo_set) const
     {
         assert(fs_ptr != NULL);
 
+        // NOTE: we still dump dirinfo list for snapshot files to be compatible with existing snapshots
+        std::list<DirectoryInfo> dirinfo_list;
+        convertDirinfoBitsetToList_(dirinfo_set, dirinfo_list);
+
         uint32_t size = 0;
-        uint32_t dirinfo_set_size = dirinfo_set.size();
+        uint32_t dirinfo_set_size = dirinfo_list.size();
         fs_ptr->write((const char*)&dirinfo_set_size, sizeof(uint32_t));
         size += sizeof(uint32_t);
-        for (std::list<DirectoryInfo>::const_iterator dirinfo_const_iter = dirinfo_set.begin(); dirinfo_const_iter != dirinfo_set.end(); dirinfo_const_iter++)
+        for (std::list<DirectoryInfo>::const_iterator dirinfo_const_iter = dirinfo_list.begin(); dirinfo_const_iter != dirinfo_list.end(); dirinfo_const_iter++)
         {
             uint32_t dirinfo_serialize_size = dirinfo_const_iter->serialize(fs_ptr);
             size += dirinfo_serialize_size;
@@ -598,23 +553,12 @@ namespace covered
         return size;
     }
 
-    uint32_t DirinfoSet::deserializeDirinfoSetInternal_(const DynamicArray& msg_payload, const uint32_t& position, std::list<DirectoryInfo>& dirinfo_set)
+    uint32_t DirinfoSet::deserializeDirinfoSetInternal_(const DynamicArray& msg_payload, const uint32_t& position, EdgeBitset& dirinfo_set)
     {
-        uint32_t size = position;
-        uint32_t dirinfo_set_size = 0;
-        msg_payload.serialize(size, (char*)&dirinfo_set_size, sizeof(uint32_t));
-        size += sizeof(uint32_t);
-        for (uint32_t i = 0; i < dirinfo_set_size; i++)
-        {
-            DirectoryInfo dirinfo;
-            uint32_t dirinfo_deserialize_size = dirinfo.deserialize(msg_payload, size);
-            size += dirinfo_deserialize_size;
-            dirinfo_set.push_back(dirinfo);
-        }
-        return size - position;
+        return dirinfo_set.deserialize(msg_payload, position);
     }
 
-    uint32_t DirinfoSet::deserializeDirinfoSetInternal_(std::fstream* fs_ptr, std::list<DirectoryInfo>& dirinfo_set)
+    uint32_t DirinfoSet::deserializeDirinfoSetInternal_(std::fstream* fs_ptr, EdgeBitset& dirinfo_set)
     {
         assert(fs_ptr != NULL);
 
@@ -627,20 +571,35 @@ namespace covered
             DirectoryInfo dirinfo;
             uint32_t dirinfo_deserialize_size = dirinfo.deserialize(fs_ptr);
             size += dirinfo_deserialize_size;
-            dirinfo_set.push_back(dirinfo);
+            dirinfo_set.insert(dirinfo.getTargetEdgeIdx());
         }
 
         return size;
     }
 
-    uint32_t DirinfoSet::getDirinfoSetSizeForCapacityInternal_(const std::list<DirectoryInfo>& dirinfo_set) const
+    uint32_t DirinfoSet::getDirinfoSetSizeForCapacityInternal_(const EdgeBitset& dirinfo_set) const
+    {
+        // NOTE: still count each dirinfo individually, such that the capacity of cooperation metadata is comparable with previous results
+        return dirinfo_set.size() * DirectoryInfo().getSizeForCapacity();
+    }
+
+    void DirinfoSet::convertDirinfoListToBitset_(const std::list<DirectoryInfo>& dirinfo_list, EdgeBitset& dirinfo_bitset)
     {
-        uint32_t dirinfo_set_total_size  = 0;
-        for (std::list<DirectoryInfo>::const_iterator dirinfo_const_iter = dirinfo_set.begin(); dirinfo_const_iter != dirinfo_set.end(); dirinfo_const_iter++)
+        dirinfo_bitset.clear();
+        for (std::list<DirectoryInfo>::const_iterator dirinfo_list_const_iter = dirinfo_list.begin(); dirinfo_list_const_iter != dirinfo_list.end(); dirinfo_list_const_iter++)
         {
-            dirinfo_set_total_size += dirinfo_const_iter->getSizeForCapacity(); // complete dirinfos
+            dirinfo_bitset.insert(dirinfo_list_const_iter->getTargetEdgeIdx());
         }
+        return;
+    }
 
-        return dirinfo_set_total_size;
+    void DirinfoSet::convertDirinfoBitsetToList_(const EdgeBitset& dirinfo_bitset, std::list<DirectoryInfo>& dirinfo_list)
+    {
+        dirinfo_list.clear();
+        for (EdgeBitset::const_iterator dirinfo_bitset_const_iter = dirinfo_bitset.begin(); dirinfo_bitset_const_iter != dirinfo_bitset.end(); dirinfo_bitset_const_iter++)
+        {
+            dirinfo_list.push_back(DirectoryInfo(*dirinfo_bitset_const_iter));
+        }
+        return;
     }
-}
\ No newline at end of file
+}
@@ -1,5 +1,7 @@
 /*
  * DirinfoSet: a set of DirectoryInfo (support compressed mode for dedup-/delta-compression-based victim synchronization).
+ *
+ * NOTE: as DirectoryInfo only has target edge index, we track complete/delta dirinfo sets by EdgeBitset, which are serialized as compact bitmaps in messages (yet still as dirinfo lists in snapshot files).
  * 
  * By Siyuan Sheng (2023.10.17).
  */
@@ -13,6 +15,7 @@
 #include <list>
 #include <string>
 
+#include "common/edge_bitset.h"
 #include "common/key.h"
 #include "cooperation/directory/directory_info.h"
 
@@ -35,6 +38,7 @@ namespace covered
 
         // For complete dirinfo set
         bool isExistIfComplete(const DirectoryInfo& directory_info, bool& is_exist) const; // Return if with complete dirinfo set
+        bool isCoveredByIfComplete(const EdgeBitset& edge_bitset, bool& is_covered) const; // Return if with complete dirinfo set (is_covered = whether all dirinfos are in edge_bitset)
         bool getDirinfoSetSizeIfComplete(uint32_t& dirinfo_set_size) const; // Return if with complete dirinfo set
         bool tryToInsertIfComplete(const DirectoryInfo& directory_info, bool& is_insert); // Return if with complete dirinfo set
         bool tryToEraseIfComplete(const DirectoryInfo& directory_info, bool& is_erase); // Return if with complete dirinfo set
@@ -64,21 +68,26 @@ namespace covered
         static const uint8_t NEW_DIRINFO_SET_DELTA_MASK; // Whether new dirinfo set exists after delta compression
         static const uint8_t STALE_DIRINFO_SET_DELTA_MASK; // Whether stale dirinfo set exists after delta compression
 
-        uint32_t getDirinfoSetPayloadSizeInternal_(const std::list<DirectoryInfo>& dirinfo_set) const;
-        uint32_t serializeDirinfoSetInternal_(DynamicArray& msg_payload, const uint32_t& position, const std::list<DirectoryInfo>& dirinfo_set) const;
-        uint32_t serializeDirinfoSetInternal_(std::fstream* fs_ptr, const std::list<DirectoryInfo>& dirinfo_set) const;
-        uint32_t deserializeDirinfoSetInternal_(const DynamicArray& msg_payload, const uint32_t& position, std::list<DirectoryInfo>& dirinfo_set);
-        uint32_t deserializeDirinfoSetInternal_(std::fstream* fs_ptr, std::list<DirectoryInfo>& dirinfo_set);
+        void setDeltaDirinfoSetForCompress_(const EdgeBitset& new_dirinfo_delta_set, const EdgeBitset& stale_dirinfo_delta_set);
 
-        uint32_t getDirinfoSetSizeForCapacityInternal_(const std::list<DirectoryInfo>& dirinfo_set) const;
+        uint32_t getDirinfoSetPayloadSizeInternal_(const EdgeBitset& dirinfo_set) const;
+        uint32_t serializeDirinfoSetInternal_(DynamicArray& msg_payload, const uint32_t& position, const EdgeBitset& dirinfo_set) const;
+        uint32_t serializeDirinfoSetInternal_(std::fstream* fs_ptr, const EdgeBitset& dirinfo_set) const;
+        uint32_t deserializeDirinfoSetInternal_(const DynamicArray& msg_payload, const uint32_t& position, EdgeBitset& dirinfo_set);
+        uint32_t deserializeDirinfoSetInternal_(std::fstream* fs_ptr, EdgeBitset& dirinfo_set);
+
+        uint32_t getDirinfoSetSizeForCapacityInternal_(const EdgeBitset& dirinfo_set) const;
+
+        static void convertDirinfoListToBitset_(const std::list<DirectoryInfo>& dirinfo_list, EdgeBitset& dirinfo_bitset);
+        static void convertDirinfoBitsetToList_(const EdgeBitset& dirinfo_bitset, std::list<DirectoryInfo>& dirinfo_list);
 
         uint8_t delta_bitmap_; // 1st lowest bit indicates if the dirinfo set is a compressed dirinfo set (2nd lowest bit for new dirinfo delta set; 3rd lowest bit for stale dirinfo delta set)
 
         // For complete dirinfo set
-        std::list<DirectoryInfo> dirinfo_set_;
+        EdgeBitset dirinfo_set_;
         // For compressed dirinfo set
-        std::list<DirectoryInfo> new_dirinfo_delta_set_;
-        std::list<DirectoryInfo> stale_dirinfo_delta_set_;
+        EdgeBitset new_dirinfo_delta_set_;
+        EdgeBitset stale_dirinfo_delta_set_;
     };
 }
 
@@ -32,11 +32,10 @@ namespace covered
     {
         DirinfoSet all_dirinfo = DirinfoSet(std::list<DirectoryInfo>());
 
-        // Prepare GetAllDirinfoParam
-        DirectoryEntry::GetAllDirinfoParam tmp_param = {all_dirinfo};
-
         bool is_exist = false;
-        directory_hashtable_.constCallIfExist(key, is_exist, DirectoryEntry::GET_ALL_DIRINFO_FUNCNAME, &tmp_param); // Get directory entry if key exists
+        directory_hashtable_.constCallIfExist(key, is_exist, [&all_dirinfo](const DirectoryEntry& directory_entry) {
+            directory_entry.getAllDirinfo(all_dirinfo);
+        }); // Get directory entry if key exists
 
         if (!is_exist) // key does not exist
         {
@@ -56,13 +55,13 @@ namespace covered
     {
         bool is_global_cached = false; // Whether the key is cached by a local/neighbor edge node (even if invalid temporarily)
 
-        // Prepare GetAllValidDirinfoParam
         DirinfoSet valid_directory_info_set;
-        DirectoryEntry::GetAllValidDirinfoParam tmp_param = {valid_directory_info_set};
 
         bool is_exist = false;
         uint32_t dirinfo_set_size = 0;
-        directory_hashtable_.constCallIfExist(key, is_exist, DirectoryEntry::GET_ALL_VALID_DIRINFO_FUNCNAME, &tmp_param); // Get directory entry if key exists
+        directory_hashtable_.constCallIfExist(key, is_exist, [&valid_directory_info_set](const DirectoryEntry& directory_entry) {
+            directory_entry.getAllValidDirinfo(valid_directory_info_set);
+        }); // Get directory entry if key exists
         if (!is_exist) // key does not exist
         {
             is_valid_directory_exist = false;
@@ -127,12 +126,13 @@ namespace covered
             UNUSED(unused_metadata_update_requirement);
             assert(tmp_is_directory_already_exist == false);
 
-            // Prepare AddDirinfoParam
-            DirectoryEntry::AddDirinfoParam tmp_param = {directory_info, directory_metadata, false, metadata_update_requirement};
-
             // Insert a new directory entry, or add directory info into existing directory entry
             bool is_exist = false;
-            directory_hashtable_.insertOrCall(key, directory_entry, is_exist, DirectoryEntry::ADD_DIRINFO_FUNCNAME, (void*)&tmp_param);
+            bool is_directory_already_exist = false;
+            directory_hashtable_.insertOrCall(key, directory_entry, is_exist, [&](DirectoryEntry& existing_directory_entry) {
+                is_directory_already_exist = existing_directory_entry.addDirinfo(directory_info, directory_metadata, metadata_update_requirement);
+                return false; // NOT erase
+            });
             if (!is_exist) // key does not exist
             {
                 // NOTE: maybe invalid directory info if key is being written
@@ -142,7 +142,7 @@ namespace covered
             }
             else // key already exists
             {
-                if (tmp_param.is_directory_already_exist) // directory_info should NOT exist for key
+                if (is_directory_already_exist) // directory_info should NOT exist for key
                 {                    
                     std::ostringstream oss;
                     oss << "target edge index " << directory_info.getTargetEdgeIdx() << " already exists for key " << key.getKeyDebugstr() << " in update() with is_admit = true!";
@@ -154,21 +154,24 @@ namespace covered
         } // End of (is_admit == true)
         else // Delete an existing directory info
         {
-            // Prepare RemoveDirinfoParam
-            DirectoryEntry::RemoveDirinfoParam tmp_param = {directory_info, false, false, metadata_update_requirement};
-
             bool is_exist = false;
-            directory_hashtable_.callIfExist(key, is_exist, DirectoryEntry::REMOVE_DIRINFO_FUNCNAME, &tmp_param);
+            bool is_directory_already_exist = false;
+            bool tmp_is_global_cached = false;
+            directory_hashtable_.callIfExist(key, is_exist, [&](DirectoryEntry& existing_directory_entry) {
+                is_directory_already_exist = existing_directory_entry.removeDirinfo(directory_info, metadata_update_requirement);
+                tmp_is_global_cached = !existing_directory_entry.isEmpty(); // Help DirectoryTable to judge if key is global cached
+                return !tmp_is_global_cached; // The key-direntry pair can be erased due to empty direntry
+            });
             if (is_exist) // key already exists
             {
-                if (!tmp_param.is_directory_already_exist) // directory_info should exist for key
+                if (!is_directory_already_exist) // directory_info should exist for key
                 {
                     std::ostringstream oss;
                     oss << "target edge index " << directory_info.getTargetEdgeIdx() << " does NOT exist for key " << key.getKeyDebugstr() << " in update() with is_admit = false!";
                     Util::dumpWarnMsg(instance_name_, oss.str());
                 }
 
-                is_global_cached = tmp_param.is_global_cached;
+                is_global_cached = tmp_is_global_cached;
             }
             else // key does NOT exist
             {
@@ -229,11 +232,11 @@ namespace covered
 
     void DirectoryTable::invalidateAllDirinfoForKeyIfExist(const Key& key, DirinfoSet& all_dirinfo)
     {
-        // Prepare InvalidateMetadataForAllDirinfoParam
-        DirectoryEntry::InvalidateMetadataForAllDirinfoIfExistParam tmp_param = {all_dirinfo};
-
         bool is_exist = false;
-        directory_hashtable_.callIfExist(key, is_exist, DirectoryEntry::INVALIDATE_METADATA_FOR_ALL_DIRINFO_IF_EXIST_FUNCNAME, &tmp_param);
+        directory_hashtable_.callIfExist(key, is_exist, [&all_dirinfo](DirectoryEntry& directory_entry) {
+            directory_entry.invalidateMetadataForAllDirinfoIfExist(all_dirinfo);
+            return false; // NOT erase
+        });
         
         assert(is_exist == true); // NOTE: invalidateAllDirinfoForKeyIfExist() is invoked ONLY if key exists
 
@@ -247,16 +250,12 @@ namespace covered
 
     void DirectoryTable::validateDirinfoForKeyIfExist(const Key& key, const DirectoryInfo& directory_info, bool& is_key_exist, bool& is_dirinfo_exist)
     {
-        // Prepare ValidateMetadataForDirinfoIfExistParam
-        DirectoryEntry::ValidateMetadataForDirinfoIfExistParam tmp_param = {directory_info};
-
         is_key_exist = false;
         is_dirinfo_exist = false;
-        directory_hashtable_.callIfExist(key, is_key_exist, DirectoryEntry::VALIDATE_METADATA_FOR_DIRINFO_IF_EXIST_FUNCNAME, &tmp_param);
-        if (is_key_exist)
-        {
-            is_dirinfo_exist = tmp_param.is_dirinfo_exist;
-        }
+        directory_hashtable_.callIfExist(key, is_key_exist, [&](DirectoryEntry& directory_entry) {
+            is_dirinfo_exist = directory_entry.validateMetadataForDirinfoIfExist(directory_info);
+            return false; // NOT erase
+        });
 
         return;
     }
@@ -16,6 +16,7 @@
 #include <unordered_set>
 
 #include "common/key.h"
+#include "common/open_addressing_map_impl.h"
 #include "concurrency/concurrent_hashtable_impl.h"
 #include "concurrency/perkey_rwlock.h"
 #include "cooperation/directory/directory_entry.h"
@@ -49,7 +50,7 @@ namespace covered
         void dumpDirectoryTable(std::fstream* fs_ptr) const;
         void loadDirectoryTable(std::fstream* fs_ptr);
     private:
-        typedef ConcurrentHashtable<DirectoryEntry> dirinfo_table_t;
+        typedef ConcurrentHashtable<DirectoryEntry, OpenAddressingMap<Key, DirectoryEntry, KeyHasher>> dirinfo_table_t; // NOTE: open addressing avoids a heap node per key for high key counts
 
         static const std::string kClassName;
 
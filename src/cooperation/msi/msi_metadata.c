@@ -7,13 +7,6 @@
 
 namespace covered
 {
-    const std::string MsiMetadata::IS_BEING_WRITTEN_FUNCNAME("isBeingWritten");
-    const std::string MsiMetadata::BLOCK_EDGE_IF_BEING_WRITTEN_FUNCNAME("blockEdgeIfBeingWritten");
-    const std::string MsiMetadata::CAS_WRITEFLAG_FUNCNAME("casWriteflag");
-    const std::string MsiMetadata::CAS_WRITEFLAG_OR_BLOCK_EDGE_FUNCNAME("casWriteflagOrBlockEdge");
-    //const std::string RESET_WRITEFLAG_FUNCNAME("resetWriteflag");
-    const std::string MsiMetadata::UNBLOCK_ALL_EDGES_AND_FINISH_WRITE_FUNCNAME("unblockAllEdgesAndFinishWrite");
-
     const std::string MsiMetadata::kClassName("MsiMetadata");
 
     MsiMetadata::MsiMetadata()
@@ -135,70 +128,6 @@ namespace covered
         return size;
     }
 
-    bool MsiMetadata::call(const std::string function_name, void* param_ptr)
-    {
-        assert(param_ptr != NULL);
-
-        bool is_erase = false;
-
-        if (function_name == CAS_WRITEFLAG_FUNCNAME)
-        {
-            CasWriteflagParam* tmp_param_ptr = static_cast<CasWriteflagParam*>(param_ptr);
-            tmp_param_ptr->is_successful = casWriteflag();
-        }
-        else if (function_name == CAS_WRITEFLAG_OR_BLOCK_EDGE_FUNCNAME)
-        {
-            CasWriteflagOrBlockEdgeParam* tmp_param_ptr = static_cast<CasWriteflagOrBlockEdgeParam*>(param_ptr);
-            tmp_param_ptr->is_successful = casWriteflagOrBlockEdge(tmp_param_ptr->network_addr, tmp_param_ptr->is_blocked_before);
-        }
-        /*else if (function_name == RESET_WRITEFLAG_FUNCNAME)
-        {
-            ResetWriteflagParam* tmp_param_ptr = static_cast<ResetWriteflagParam*>(param_ptr);
-            tmp_param_ptr->original_writeflag = resetWriteflag();
-        }*/
-        else if (function_name == BLOCK_EDGE_IF_BEING_WRITTEN_FUNCNAME)
-        {
-            BlockEdgeIfBeingWrittenParam* tmp_param_ptr = static_cast<BlockEdgeIfBeingWrittenParam*>(param_ptr);
-            tmp_param_ptr->is_blocked_before = blockEdgeIfBeingWritten(tmp_param_ptr->network_addr, tmp_param_ptr->is_being_written);
-        }
-        else if (function_name == UNBLOCK_ALL_EDGES_AND_FINISH_WRITE_FUNCNAME)
-        {
-            UnblockAllEdgesAndFinishWriteParam* tmp_param_ptr = static_cast<UnblockAllEdgesAndFinishWriteParam*>(param_ptr);
-            unblockAllEdgesAndFinishWrite(tmp_param_ptr->blocked_edges);
-
-            is_erase = true;
-        }
-        else
-        {
-            std::ostringstream oss;
-            oss << "invalid function name " << function_name << " for call()!";
-            Util::dumpErrorMsg(kClassName, oss.str());
-            exit(1);
-        }
-
-        return is_erase;
-    }
-
-    void MsiMetadata::constCall(const std::string function_name, void* param_ptr) const
-    {
-        assert(param_ptr != NULL);
-
-        if (function_name == IS_BEING_WRITTEN_FUNCNAME)
-        {
-            IsBeingWrittenParam* tmp_param_ptr = static_cast<IsBeingWrittenParam*>(param_ptr);
-            tmp_param_ptr->is_being_written = isBeingWritten();
-        }
-        else
-        {
-            std::ostringstream oss;
-            oss << "invalid function name " << function_name << " for call()!";
-            Util::dumpErrorMsg(kClassName, oss.str());
-            exit(1);
-        }
-
-        return;
-    }
-
     const MsiMetadata& MsiMetadata::operator=(const MsiMetadata& other)
     {
         writeflag_ = other.writeflag_;
@@ -19,47 +19,6 @@ namespace covered
     class MsiMetadata
     {
     public:
-        struct IsBeingWrittenParam
-        {
-            bool is_being_written;
-        };
-
-        struct BlockEdgeIfBeingWrittenParam
-        {
-            const NetworkAddr& network_addr;
-            bool is_being_written;
-            bool is_blocked_before;
-        };
-
-        struct CasWriteflagParam
-        {
-            bool is_successful;
-        };
-
-        struct CasWriteflagOrBlockEdgeParam
-        {
-            const NetworkAddr& network_addr;
-            bool is_blocked_before;
-            bool is_successful;
-        };
-
-        /*struct ResetWriteflagParam
-        {
-            bool original_writeflag;
-        };*/
-
-        struct UnblockAllEdgesAndFinishWriteParam
-        {
-            std::unordered_set<NetworkAddr, NetworkAddrHasher>& blocked_edges;
-        };
-
-        static const std::string IS_BEING_WRITTEN_FUNCNAME;
-        static const std::string BLOCK_EDGE_IF_BEING_WRITTEN_FUNCNAME;
-        static const std::string CAS_WRITEFLAG_FUNCNAME;
-        static const std::string CAS_WRITEFLAG_OR_BLOCK_EDGE_FUNCNAME;
-        //static const std::string RESET_WRITEFLAG_FUNCNAME;
-        static const std::string UNBLOCK_ALL_EDGES_AND_FINISH_WRITE_FUNCNAME;
-
         MsiMetadata();
         MsiMetadata(const bool& is_being_written);
         ~MsiMetadata();
@@ -83,8 +42,6 @@ namespace covered
         // (4) For ConcurrentHashtable
 
         uint64_t getSizeForCapacity() const;
-        bool call(const std::string function_name, void* param_ptr);
-        void constCall(const std::string function_name, void* param_ptr) const;
 
         const MsiMetadata& operator=(const MsiMetadata& other);
     private:
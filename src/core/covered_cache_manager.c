@@ -445,7 +445,7 @@ namespace covered
         // Track whether victim fetch requests to all involved edge nodes have been acknowledged
         uint32_t acked_edgecnt = 0;
         std::unordered_map<uint32_t, bool> acked_flags;
-        for (std::unordered_set<uint32_t>::const_iterator iter_for_ackflag = best_placement_victim_fetch_edgeset.begin(); iter_for_ackflag != best_placement_victim_fetch_edgeset.end(); iter_for_ackflag++)
+        for (Edgeset::const_iterator iter_for_ackflag = best_placement_victim_fetch_edgeset.begin(); iter_for_ackflag != best_placement_victim_fetch_edgeset.end(); iter_for_ackflag++)
         {
             acked_flags.insert(std::pair<uint32_t, bool>(*iter_for_ackflag, false));
         }
@@ -106,7 +106,7 @@ namespace covered
         checkPointers_();
         
         // Acquire a read lock to update victim dirinfo atomically
-        std::string context_name = "DirectoryCacher::getCachedDirectory()";
+        const char* context_name = "DirectoryCacher::getCachedDirectory()";
         rwlock_for_directory_cacher_->acquire_lock_shared(context_name);
 
         bool has_cached_directory = false;
@@ -129,7 +129,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock to update victim dirinfo atomically
-        std::string context_name = "DirectoryCacher::checkPopularityChange()";
+        const char* context_name = "DirectoryCacher::checkPopularityChange()";
         rwlock_for_directory_cacher_->acquire_lock_shared(context_name);
 
         bool has_cached_directory = false;
@@ -158,7 +158,7 @@ namespace covered
         checkPointers_();
         
         // Acquire a write lock to update victim dirinfo atomically
-        std::string context_name = "DirectoryCacher::removeCachedDirectoryIfAny()";
+        const char* context_name = "DirectoryCacher::removeCachedDirectoryIfAny()";
         rwlock_for_directory_cacher_->acquire_lock(context_name);
 
         // Remove cached directory if any
@@ -248,7 +248,7 @@ namespace covered
         checkPointers_();
         
         // Acquire a write lock to update victim dirinfo atomically
-        std::string context_name = "DirectoryCacher::updateForNewCachedDirectory()";
+        const char* context_name = "DirectoryCacher::updateForNewCachedDirectory()";
         rwlock_for_directory_cacher_->acquire_lock(context_name);
 
         perkey_dirinfo_map_t::iterator map_iter = perkey_dirinfo_map_.find(key);
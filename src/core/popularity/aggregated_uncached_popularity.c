@@ -89,7 +89,7 @@ namespace covered
 
     bool AggregatedUncachedPopularity::clearForPlacement(const Edgeset& placement_edgeset)
     {
-        for (std::unordered_set<uint32_t>::const_iterator placement_edgeset_const_iter = placement_edgeset.begin(); placement_edgeset_const_iter != placement_edgeset.end(); placement_edgeset_const_iter++)
+        for (Edgeset::const_iterator placement_edgeset_const_iter = placement_edgeset.begin(); placement_edgeset_const_iter != placement_edgeset.end(); placement_edgeset_const_iter++)
         {
             const uint32_t tmp_edge_idx = *placement_edgeset_const_iter;
             assert(tmp_edge_idx < bitmap_.size());
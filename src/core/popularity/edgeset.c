@@ -1,5 +1,6 @@
 #include "core/popularity/edgeset.h"
 
+#include <assert.h>
 #include <sstream>
 
 namespace covered
@@ -13,110 +14,97 @@ namespace covered
 
     Edgeset::Edgeset(const std::unordered_set<uint32_t>& edgeset)
     {
-        edgeset_ = edgeset;
+        edgeset_.clear();
+        for (std::unordered_set<uint32_t>::const_iterator edgeset_const_iter = edgeset.begin(); edgeset_const_iter != edgeset.end(); edgeset_const_iter++)
+        {
+            edgeset_.insert(*edgeset_const_iter);
+        }
     }
 
     Edgeset::~Edgeset() {}
 
-    /*const std::unordered_set<uint32_t>& Edgeset::getEdgesetRef() const
+    const EdgeBitset& Edgeset::getEdgeBitsetRef() const
     {
         return edgeset_;
-    }*/
+    }
 
     uint32_t Edgeset::size() const
     {
         return edgeset_.size();
     }
 
-    std::unordered_set<uint32_t>::iterator Edgeset::find(const uint32_t& edge_idx)
+    Edgeset::const_iterator Edgeset::find(const uint32_t& edge_idx) const
     {
         return edgeset_.find(edge_idx);
     }
 
-    std::unordered_set<uint32_t>::iterator Edgeset::begin()
+    Edgeset::const_iterator Edgeset::begin() const
     {
         return edgeset_.begin();
     }
 
-    std::unordered_set<uint32_t>::iterator Edgeset::end()
+    Edgeset::const_iterator Edgeset::end() const
     {
         return edgeset_.end();
     }
 
-    std::unordered_set<uint32_t>::const_iterator Edgeset::find(const uint32_t& edge_idx) const
+    void Edgeset::clear()
     {
-        return edgeset_.find(edge_idx);
+        edgeset_.clear();
+        return;
     }
 
-    std::unordered_set<uint32_t>::const_iterator Edgeset::begin() const
+    std::pair<Edgeset::iterator, bool> Edgeset::insert(const uint32_t& edge_idx)
     {
-        return edgeset_.begin();
+        bool is_insert = edgeset_.insert(edge_idx);
+        std::pair<iterator, bool> result(edgeset_.find(edge_idx), is_insert);
+        return result;
     }
 
-    std::unordered_set<uint32_t>::const_iterator Edgeset::end() const
+    void Edgeset::erase(const uint32_t& edge_idx)
     {
-        return edgeset_.end();
+        edgeset_.erase(edge_idx);
+        return;
     }
 
-    void Edgeset::clear()
+    void Edgeset::erase(const_iterator iter)
     {
-        edgeset_.clear();
+        assert(iter != edgeset_.end());
+        edgeset_.erase(*iter);
         return;
     }
 
-    std::pair<std::unordered_set<uint32_t>::iterator, bool> Edgeset::insert(const uint32_t& edge_idx)
+    void Edgeset::unionWith(const Edgeset& other)
     {
-        std::pair<std::unordered_set<uint32_t>::iterator, bool> result = edgeset_.insert(edge_idx);
-        return result;
+        edgeset_.unionWith(other.edgeset_);
+        return;
     }
 
-    void Edgeset::erase(const uint32_t& edge_idx)
+    void Edgeset::intersectWith(const Edgeset& other)
     {
-        edgeset_.erase(edge_idx);
+        edgeset_.intersectWith(other.edgeset_);
         return;
     }
 
-    void Edgeset::erase(std::unordered_set<uint32_t>::const_iterator iter)
+    void Edgeset::differenceWith(const Edgeset& other)
     {
-        edgeset_.erase(iter);
+        edgeset_.differenceWith(other.edgeset_);
         return;
     }
 
     uint32_t Edgeset::getEdgesetPayloadSize() const
     {
-        uint32_t edgeset_payload_size = sizeof(uint32_t) + edgeset_.size() * sizeof(uint32_t);
-        return edgeset_payload_size;
+        return edgeset_.getEdgeBitsetPayloadSize(); // Compact bitmap
     }
 
     uint32_t Edgeset::serialize(DynamicArray& msg_payload, const uint32_t& position) const
     {
-        uint32_t size = position;
-        uint32_t edgeset_size = edgeset_.size();
-        msg_payload.deserialize(size, (const char*)&edgeset_size, sizeof(uint32_t));
-        size += sizeof(uint32_t);
-        for (std::unordered_set<uint32_t>::const_iterator edgeset_const_iter = edgeset_.begin(); edgeset_const_iter != edgeset_.end(); edgeset_const_iter++)
-        {
-            uint32_t edge_idx = *edgeset_const_iter;
-            msg_payload.deserialize(size, (const char*)&edge_idx, sizeof(uint32_t));
-            size += sizeof(uint32_t);
-        }
-        return size - position;
+        return edgeset_.serialize(msg_payload, position);
     }
 
     uint32_t Edgeset::deserialize(const DynamicArray& msg_payload, const uint32_t& position)
     {
-        uint32_t size = position;
-        uint32_t edgeset_size = 0;
-        msg_payload.serialize(size, (char*)&edgeset_size, sizeof(uint32_t));
-        size += sizeof(uint32_t);
-        for (uint32_t i = 0; i < edgeset_size; i++)
-        {
-            uint32_t edge_idx = 0;
-            msg_payload.serialize(size, (char*)&edge_idx, sizeof(uint32_t));
-            size += sizeof(uint32_t);
-            edgeset_.insert(edge_idx);
-        }
-        return size - position;
+        return edgeset_.deserialize(msg_payload, position);
     }
 
     std::string Edgeset::toString() const
@@ -124,7 +112,7 @@ namespace covered
         std::ostringstream oss;
         oss << "edgeset size: " << edgeset_.size();
         uint32_t i = 0;
-        for (std::unordered_set<uint32_t>::const_iterator edgeset_const_iter = edgeset_.begin(); edgeset_const_iter != edgeset_.end(); edgeset_const_iter++)
+        for (const_iterator edgeset_const_iter = edgeset_.begin(); edgeset_const_iter != edgeset_.end(); edgeset_const_iter++)
         {
             uint32_t edge_idx = *edgeset_const_iter;
             oss << "; edge[" << i << "]: " << edge_idx;
@@ -138,4 +126,4 @@ namespace covered
         edgeset_ = other.edgeset_;
         return *this;
     }
-}
\ No newline at end of file
+}
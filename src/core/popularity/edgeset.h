@@ -1,6 +1,8 @@
 /*
  * Edgeset: a set of edge nodes for placement.
  *
+ * NOTE: Edgeset is built upon EdgeBitset to avoid heap allocation and hashing for copies and membership tests of small edgesets; iterators enumerate edge indexes in ascending order and are NOT invalidated by insert/erase of other edge indexes.
+ *
  * By Siyuan Sheng (2023.09.24).
  */
 
@@ -12,6 +14,7 @@
 #include <unordered_set>
 
 #include "common/dynamic_array.h"
+#include "common/edge_bitset.h"
 #include "common/key.h"
 
 namespace covered
@@ -19,24 +22,29 @@ namespace covered
     class Edgeset
     {
     public:
+        typedef EdgeBitset::const_iterator const_iterator;
+        typedef EdgeBitset::const_iterator iterator; // NOTE: edge indexes in edgeset are immutable (the same as std::unordered_set)
+
         Edgeset();
         Edgeset(const std::unordered_set<uint32_t>& edgeset);
         ~Edgeset();
 
-        //const std::unordered_set<uint32_t>& getEdgesetRef() const;
+        const EdgeBitset& getEdgeBitsetRef() const;
 
         uint32_t size() const;
-        std::unordered_set<uint32_t>::iterator find(const uint32_t& edge_idx);
-        std::unordered_set<uint32_t>::iterator begin();
-        std::unordered_set<uint32_t>::iterator end();
-        std::unordered_set<uint32_t>::const_iterator find(const uint32_t& edge_idx) const;
-        std::unordered_set<uint32_t>::const_iterator begin() const;
-        std::unordered_set<uint32_t>::const_iterator end() const;
+        const_iterator find(const uint32_t& edge_idx) const;
+        const_iterator begin() const;
+        const_iterator end() const;
 
         void clear();
-        std::pair<std::unordered_set<uint32_t>::iterator, bool> insert(const uint32_t& edge_idx);
+        std::pair<iterator, bool> insert(const uint32_t& edge_idx);
         void erase(const uint32_t& edge_idx);
-        void erase(std::unordered_set<uint32_t>::const_iterator iter);
+        void erase(const_iterator iter);
+
+        // Set operations in place
+        void unionWith(const Edgeset& other);
+        void intersectWith(const Edgeset& other);
+        void differenceWith(const Edgeset& other);
 
         uint32_t getEdgesetPayloadSize() const;
         uint32_t serialize(DynamicArray& msg_payload, const uint32_t& position) const;
@@ -48,7 +56,7 @@ namespace covered
     private:
         static const std::string kClassName;
 
-        std::unordered_set<uint32_t> edgeset_;
+        EdgeBitset edgeset_;
     };
 }
 
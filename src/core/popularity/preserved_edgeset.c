@@ -24,7 +24,7 @@ namespace covered
 
     void PreservedEdgeset::preserveEdgesetForPlacement(const Edgeset& placement_edgeset)
     {
-        for (std::unordered_set<uint32_t>::const_iterator placement_edgeset_const_iter = placement_edgeset.begin(); placement_edgeset_const_iter != placement_edgeset.end(); placement_edgeset_const_iter++)
+        for (Edgeset::const_iterator placement_edgeset_const_iter = placement_edgeset.begin(); placement_edgeset_const_iter != placement_edgeset.end(); placement_edgeset_const_iter++)
         {
             const uint32_t tmp_edge_idx = *placement_edgeset_const_iter;
             assert(tmp_edge_idx < preserved_bitmap_.size());
@@ -37,7 +37,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a READ lock to get aggregated uncached popularity atomically
-        const std::string context_name = "PopularityAggregator::getAggregatedUncachedPopularity()";
+        const char* context_name = "PopularityAggregator::getAggregatedUncachedPopularity()";
         rwlock_for_popularity_aggregator_->acquire_lock_shared(context_name);
 
         bool is_found = getAggregatedUncachedPopularity_(key, aggregated_uncached_popularity);
@@ -51,7 +51,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock to get top-k list length atomically (TODO: maybe NO need to acquire a read lock for topk_edgecnt_ here)
-        std::string context_name = "PopularityAggregator::getTopkEdgecnt()";
+        const char* context_name = "PopularityAggregator::getTopkEdgecnt()";
         rwlock_for_popularity_aggregator_->acquire_lock_shared(context_name);
 
         uint32_t topk_edgecnt = topk_edgecnt_;
@@ -65,7 +65,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a read lock to check if key is being admitted (i.e., with preserved edge nodes) atomically (TODO: maybe NO need to acquire a read lock for is_being_admitted here)
-        std::string context_name = "PopularityAggregator::isKeyBeingAdmitted()";
+        const char* context_name = "PopularityAggregator::isKeyBeingAdmitted()";
         rwlock_for_popularity_aggregator_->acquire_lock_shared(context_name);
 
         bool is_being_admitted = (perkey_preserved_edgeset_.find(key) != perkey_preserved_edgeset_.end());
@@ -79,7 +79,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock to update aggregated uncached popularity and max admission benefit atomically
-        const std::string context_name = "PopularityAggregator::updateAggregatedUncachedPopularity()";
+        const char* context_name = "PopularityAggregator::updateAggregatedUncachedPopularity()";
         rwlock_for_popularity_aggregator_->acquire_lock(context_name);
 
         #ifdef ENABLE_FAST_PATH_PLACEMENT
@@ -212,7 +212,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock to preserve edge ndoes for non-blocking placement deployment atomically
-        const std::string context_name = "PopularityAggregator::updatePreservedEdgesetForPlacement()";
+        const char* context_name = "PopularityAggregator::updatePreservedEdgesetForPlacement()";
         rwlock_for_popularity_aggregator_->acquire_lock(context_name);
 
         // Preserve edge nodes of placement edgeset to ignore subsequent local uncached popularities from them
@@ -261,7 +261,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock to clear preserved edge ndoes from aggregated uncached popularity atomically
-        const std::string context_name = "PopularityAggregator::clearPreservedEdgesetAfterAdmission()";
+        const char* context_name = "PopularityAggregator::clearPreservedEdgesetAfterAdmission()";
         rwlock_for_popularity_aggregator_->acquire_lock(context_name);
 
         // Clear preserved edge node for the source edge node after admission notification
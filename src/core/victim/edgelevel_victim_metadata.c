@@ -181,7 +181,7 @@ namespace covered
             }
             else // Lazy vicim fetching
             {
-                std::unordered_set<uint32_t>::iterator victim_fetch_edgeset_iter = victim_fetch_edgeset.find(cur_edge_idx);
+                Edgeset::iterator victim_fetch_edgeset_iter = victim_fetch_edgeset.find(cur_edge_idx);
                 assert(victim_fetch_edgeset_iter == victim_fetch_edgeset.end());
                 victim_fetch_edgeset_iter = victim_fetch_edgeset.insert(cur_edge_idx).first;
                 assert(victim_fetch_edgeset_iter != victim_fetch_edgeset.end());
@@ -56,7 +56,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock to update local cache margin bytes atomically
-        std::string context_name = "VictimTracker::updateLocalCacheMarginBytes()";
+        const char* context_name = "VictimTracker::updateLocalCacheMarginBytes()";
         rwlock_for_victim_tracker_->acquire_lock(context_name);
 
         // Update local cache margin bytes in edge-level victim metadata
@@ -91,7 +91,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock to update local synced victims atomically
-        std::string context_name = "VictimTracker::updateLocalSyncedVictims()";
+        const char* context_name = "VictimTracker::updateLocalSyncedVictims()";
         rwlock_for_victim_tracker_->acquire_lock(context_name);
 
         // Replace VictimCacheinfors for local synced victims of current edge node
@@ -115,7 +115,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock to update victim dirinfo atomically
-        std::string context_name = "VictimTracker::updateLocalBeaconedVictimDirinfo()";
+        const char* context_name = "VictimTracker::updateLocalBeaconedVictimDirinfo()";
         rwlock_for_victim_tracker_->acquire_lock(context_name);
 
         // Update directory info if the local beaconed key is a local/neighbor synced victim
@@ -152,7 +152,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock to get local victim syncset atomically (NOTE: we need write lock here as we need to update VictimsyncMonitor)
-        std::string context_name = "VictimTracker::getLocalVictimSyncsetForSynchronization()";
+        const char* context_name = "VictimTracker::getLocalVictimSyncsetForSynchronization()";
         rwlock_for_victim_tracker_->acquire_lock(context_name);
 
         const uint64_t start_victimsync_monitor_size = peredge_victimsync_monitor_[dst_edge_idx_for_compression].getSizeForCapacity();
@@ -192,7 +192,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock to update local synced victims atomically
-        std::string context_name = "VictimTracker::updateForNeighborVictimSyncset()";
+        const char* context_name = "VictimTracker::updateForNeighborVictimSyncset()";
         rwlock_for_victim_tracker_->acquire_lock(context_name);
 
         const uint64_t start_victimsync_monitor_size = peredge_victimsync_monitor_[source_edge_idx].getSizeForCapacity();
@@ -367,7 +367,7 @@ namespace covered
         DeltaReward eviction_cost = 0.0;
         
         // Acquire a read lock to calculate eviction cost atomically
-        std::string context_name = "VictimTracker::calcEvictionCost()";
+        const char* context_name = "VictimTracker::calcEvictionCost()";
         rwlock_for_victim_tracker_->acquire_lock_shared(context_name);
 
         // Find victims from placement edgeset if admit a hot object with the given size (set victim_fetch_edgeset for lazy victim fetching)
@@ -430,7 +430,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock to remove victims atomically
-        std::string context_name = "VictimTracker::removeVictimsForGivenEdge()";
+        const char* context_name = "VictimTracker::removeVictimsForGivenEdge()";
         rwlock_for_victim_tracker_->acquire_lock(context_name);
 
         // NOTE: each edge node in placement edgeset MUST have EdgeLevelVictimMetadata
@@ -477,7 +477,7 @@ namespace covered
         DeltaReward local_eviction_cost = 0.0;
 
         // Acquire a read lock to calculate eviction cost atomically
-        std::string context_name = "VictimTracker::calcEvictionCostForFastPathPlacement()";
+        const char* context_name = "VictimTracker::calcEvictionCostForFastPathPlacement()";
         rwlock_for_victim_tracker_->acquire_lock_shared(context_name);
 
         // Prepare victim edgeset (ONLY consider a single placement of current edge node for fast path)
@@ -516,7 +516,7 @@ namespace covered
         checkPointers_();
 
         // (OBSOLETE due to lock contention with background pre-compression and recovery) Acquire a read lock to get cache size usage atomically
-        // std::string context_name = "VictimTracker::getSizeForCapacity()";
+        // const char* context_name = "VictimTracker::getSizeForCapacity()";
         // rwlock_for_victim_tracker_->acquire_lock_shared(context_name);
         // uint64_t total_size = size_bytes_;
         // rwlock_for_victim_tracker_->unlock_shared(context_name);
@@ -860,7 +860,7 @@ namespace covered
         const bool with_extra_victims = (extra_peredge_victim_cacheinfos.size() > 0);
 
         // Enumerate each involved edge node to find victims
-        for (std::unordered_set<uint32_t>::const_iterator placement_edgeset_const_iter = placement_edgeset.begin(); placement_edgeset_const_iter != placement_edgeset.end(); placement_edgeset_const_iter++)
+        for (Edgeset::const_iterator placement_edgeset_const_iter = placement_edgeset.begin(); placement_edgeset_const_iter != placement_edgeset.end(); placement_edgeset_const_iter++)
         {
             uint32_t tmp_edge_idx = *placement_edgeset_const_iter;
 
@@ -937,18 +937,10 @@ namespace covered
 
             const DirinfoSet& tmp_dirinfo_set = tmp_dirinfo_sets[i];
 
-            std::list<DirectoryInfo> tmp_dirinfo_list;
-            bool with_complete_dirinfo_set = tmp_dirinfo_set.getDirinfoSetIfComplete(tmp_dirinfo_list);
+            // Victim edgeset is the last copies only if it covers all dirinfos
+            bool with_complete_dirinfo_set = tmp_dirinfo_set.isCoveredByIfComplete(victim_edgeset.getEdgeBitsetRef(), is_last_copies);
             assert(with_complete_dirinfo_set == true); // NOTE: victim dirinfo set from victim dirinfo of victim tracker and extra fetched dirinfo set from extra_perkey_victim_dirinfoset MUST be complete
-            for (std::list<DirectoryInfo>::const_iterator dirinfo_list_const_iter = tmp_dirinfo_list.begin(); dirinfo_list_const_iter != tmp_dirinfo_list.end(); dirinfo_list_const_iter++)
-            {
-                uint32_t tmp_edge_idx = dirinfo_list_const_iter->getTargetEdgeIdx();
-                if (victim_edgeset.find(tmp_edge_idx) == victim_edgeset.end())
-                {
-                    is_last_copies = false;
-                    break;
-                }
-            }
+            UNUSED(with_complete_dirinfo_set);
 
             if (!is_last_copies)
             {
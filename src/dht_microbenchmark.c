@@ -0,0 +1,232 @@
+/*
+ * Microbenchmark of DHT beacon placement (range vs. consistent hashing ring w/ virtual nodes vs. jump consistent hash).
+ *
+ * NOTE: for each placement, we report (i) the fraction of keys (and of Zipf request mass) whose beacon edge node changes when adding an edge node (edgecnt -> edgecnt + 1) or removing the last one (edgecnt -> edgecnt - 1), compared with the ideal 1/(edgecnt+1) and 1/edgecnt; (ii) per-edge beacon load balance (max/avg and coefficient of variation) under Zipf popularity; and (iii) average lookup latency (ns) of DhtWrapper::getBeaconEdgeIdx().
+ *
+ * NOTE: alpha = 0 means uniform popularity; Facebook CDN workloads are modeled by Zipf skewness (the same as zipf_facebook workload), as CacheBench workload generator relies on Config and CacheLib.
+ */
+
+#include <algorithm> // std::max
+#include <chrono>
+#include <cmath>
+#include <cstring> // memcpy
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "common/key.h"
+#include "common/util.h"
+#include "cooperation/dht_wrapper.h"
+
+namespace
+{
+    const std::string kClassName("dht_microbenchmark");
+
+    std::vector<std::string> splitByComma(const std::string& str)
+    {
+        std::vector<std::string> tokens;
+        std::istringstream iss(str);
+        std::string tmp_token;
+        while (std::getline(iss, tmp_token, ','))
+        {
+            if (!tmp_token.empty())
+            {
+                tokens.push_back(tmp_token);
+            }
+        }
+        return tokens;
+    }
+
+    // Normalized Zipf probabilities of keys sorted by rank (p(rank) ~ 1/(rank+1)^alpha)
+    std::vector<double> getZipfProbs(const uint32_t& keycnt, const double& zipf_alpha)
+    {
+        std::vector<double> probs(keycnt, 0.0);
+        double sum = 0.0;
+        for (uint32_t i = 0; i < keycnt; i++)
+        {
+            probs[i] = 1.0 / std::pow(static_cast<double>(i + 1), zipf_alpha);
+            sum += probs[i];
+        }
+        for (uint32_t i = 0; i < keycnt; i++)
+        {
+            probs[i] /= sum;
+        }
+        return probs;
+    }
+
+    std::vector<uint32_t> getBeaconEdgeIdxes(const std::vector<covered::Key>& keys, const std::string& hash_name, const uint32_t& edgecnt, const std::string& dht_placement_name, const uint32_t& vnodecnt_peredge)
+    {
+        covered::DhtWrapper dht_wrapper(hash_name, edgecnt, 0, dht_placement_name, vnodecnt_peredge, std::vector<uint32_t>());
+        std::vector<uint32_t> beacon_edge_idxes(keys.size(), 0);
+        for (uint32_t i = 0; i < keys.size(); i++)
+        {
+            beacon_edge_idxes[i] = dht_wrapper.getBeaconEdgeIdx(keys[i]);
+        }
+        return beacon_edge_idxes;
+    }
+
+    // Return the fraction of request mass (keys if probs are empty) whose beacon edge node changes
+    double getRemapRatio(const std::vector<uint32_t>& prev_beacon_edge_idxes, const std::vector<uint32_t>& cur_beacon_edge_idxes, const std::vector<double>& probs)
+    {
+        double remap_ratio = 0.0;
+        for (uint32_t i = 0; i < prev_beacon_edge_idxes.size(); i++)
+        {
+            if (prev_beacon_edge_idxes[i] != cur_beacon_edge_idxes[i])
+            {
+                remap_ratio += probs.empty() ? 1.0 : probs[i];
+            }
+        }
+        if (probs.empty())
+        {
+            remap_ratio /= static_cast<double>(prev_beacon_edge_idxes.size());
+        }
+        return remap_ratio;
+    }
+
+    void getLoadBalance(const std::vector<uint32_t>& beacon_edge_idxes, const std::vector<double>& probs, const uint32_t& edgecnt, double& max_avg_ratio, double& cv)
+    {
+        std::vector<double> peredge_loads(edgecnt, 0.0);
+        for (uint32_t i = 0; i < beacon_edge_idxes.size(); i++)
+        {
+            peredge_loads[beacon_edge_idxes[i]] += probs[i];
+        }
+
+        const double avg_load = 1.0 / static_cast<double>(edgecnt);
+        double max_load = 0.0;
+        double variance = 0.0;
+        for (uint32_t i = 0; i < edgecnt; i++)
+        {
+            max_load = std::max(max_load, peredge_loads[i]);
+            variance += (peredge_loads[i] - avg_load) * (peredge_loads[i] - avg_load);
+        }
+        variance /= static_cast<double>(edgecnt);
+
+        max_avg_ratio = max_load / avg_load;
+        cv = std::sqrt(variance) / avg_load;
+        return;
+    }
+
+    double getLookupNsPerOp(const std::vector<covered::Key>& keys, const std::vector<uint32_t>& access_sequence, const std::string& hash_name, const uint32_t& edgecnt, const std::string& dht_placement_name, const uint32_t& vnodecnt_peredge, uint64_t& checksum)
+    {
+        covered::DhtWrapper dht_wrapper(hash_name, edgecnt, 0, dht_placement_name, vnodecnt_peredge, std::vector<uint32_t>());
+        checksum = 0;
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < access_sequence.size(); i++)
+        {
+            checksum += dht_wrapper.getBeaconEdgeIdx(keys[access_sequence[i]]);
+        }
+        const double elapsed_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start_time).count();
+        return elapsed_ns / static_cast<double>(access_sequence.size());
+    }
+}
+
+int main(int argc, char **argv) {
+    // (1) Parse CLI parameters
+
+    boost::program_options::options_description argument_desc("Allowed arguments for " + kClassName);
+    argument_desc.add_options()
+        ("help,h", "dump help information")
+        ("keycnt", boost::program_options::value<uint32_t>()->default_value(1000000), "the number of distinct keys")
+        ("keysize", boost::program_options::value<uint32_t>()->default_value(16), "the key size in units of bytes")
+        ("edgecnt", boost::program_options::value<uint32_t>()->default_value(12), "the number of edge nodes (DHT nodes) before adding/removing an edge node")
+        ("opcnt", boost::program_options::value<uint64_t>()->default_value(1000000), "the number of lookups for latency measurement")
+        ("hash_name", boost::program_options::value<std::string>()->default_value(covered::Util::MMH3_HASH_NAME), "the hash function for DHT")
+        ("vnodecnts", boost::program_options::value<std::string>()->default_value("1,16,128,1024"), "comma-separated # of virtual nodes per edge node for ring placement")
+        ("zipf_alphas", boost::program_options::value<std::string>()->default_value("0,0.9,1.1"), "comma-separated Zipf skewness for beacon load (0: uniform)")
+    ;
+    boost::program_options::variables_map argument_info;
+    boost::program_options::store(boost::program_options::parse_command_line(argc, argv, argument_desc), argument_info);
+    boost::program_options::notify(argument_info);
+    if (argument_info.count("help"))
+    {
+        std::cout << argument_desc << std::endl;
+        return 0;
+    }
+
+    const uint32_t keycnt = argument_info["keycnt"].as<uint32_t>();
+    const uint32_t keysize = argument_info["keysize"].as<uint32_t>();
+    const uint32_t edgecnt = argument_info["edgecnt"].as<uint32_t>();
+    const uint64_t opcnt = argument_info["opcnt"].as<uint64_t>();
+    const std::string hash_name = argument_info["hash_name"].as<std::string>();
+    const std::vector<std::string> vnodecnt_strs = splitByComma(argument_info["vnodecnts"].as<std::string>());
+    const std::vector<std::string> zipf_alpha_strs = splitByComma(argument_info["zipf_alphas"].as<std::string>());
+    if (keycnt == 0 || keysize < sizeof(uint32_t) || edgecnt < 2 || opcnt == 0)
+    {
+        std::cerr << "[ERROR] " << kClassName << ": keycnt and opcnt MUST be positive, edgecnt MUST be at least 2, and keysize MUST be at least " << sizeof(uint32_t) << std::endl;
+        return 1;
+    }
+
+    // (2) Prepare keys (sorted by popularity rank), Zipf probabilities, and a deterministic access sequence
+
+    std::vector<covered::Key> keys;
+    keys.reserve(keycnt);
+    for (uint32_t i = 0; i < keycnt; i++)
+    {
+        std::string tmp_keystr(keysize, 'k');
+        memcpy(&tmp_keystr[0], &i, sizeof(uint32_t));
+        keys.push_back(covered::Key(tmp_keystr));
+    }
+
+    std::vector<double> zipf_alphas;
+    std::vector<std::vector<double>> zipf_probs_list;
+    for (uint32_t i = 0; i < zipf_alpha_strs.size(); i++)
+    {
+        zipf_alphas.push_back(std::stod(zipf_alpha_strs[i]));
+        zipf_probs_list.push_back(getZipfProbs(keycnt, zipf_alphas[i]));
+    }
+
+    std::mt19937_64 randgen(0);
+    std::uniform_int_distribution<uint32_t> key_dist(0, keycnt - 1);
+    std::vector<uint32_t> access_sequence(opcnt);
+    for (uint64_t i = 0; i < opcnt; i++)
+    {
+        access_sequence[i] = key_dist(randgen);
+    }
+
+    // Placements to compare: (placement name, # of virtual nodes per edge node)
+    std::vector<std::pair<std::string, uint32_t>> placements;
+    placements.push_back(std::pair<std::string, uint32_t>(covered::Util::DHT_RANGE_PLACEMENT_NAME, 0));
+    for (uint32_t i = 0; i < vnodecnt_strs.size(); i++)
+    {
+        placements.push_back(std::pair<std::string, uint32_t>(covered::Util::DHT_RING_PLACEMENT_NAME, static_cast<uint32_t>(std::stoul(vnodecnt_strs[i]))));
+    }
+    placements.push_back(std::pair<std::string, uint32_t>(covered::Util::DHT_JUMP_PLACEMENT_NAME, 0));
+
+    std::cout << "keycnt: " << keycnt << "; keysize: " << keysize << "; edgecnt: " << edgecnt << "; opcnt: " << opcnt << "; hash_name: " << hash_name << std::endl;
+    std::cout << "ideal remap ratio: add " << std::fixed << std::setprecision(4) << 1.0 / static_cast<double>(edgecnt + 1) << "; remove " << 1.0 / static_cast<double>(edgecnt) << std::endl;
+    std::cout << std::left << std::setw(12) << "placement" << std::setw(10) << "vnodecnt" << std::setw(10) << "alpha" << std::setw(12) << "add_remap" << std::setw(12) << "rm_remap" << std::setw(10) << "max/avg" << std::setw(10) << "cv" << std::setw(10) << "ns/op" << "checksum" << std::endl;
+
+    // (3) Remap ratio, beacon load balance, and lookup latency of each placement
+
+    for (uint32_t i = 0; i < placements.size(); i++)
+    {
+        const std::string& tmp_placement_name = placements[i].first;
+        const uint32_t tmp_vnodecnt = placements[i].second;
+
+        const std::vector<uint32_t> prev_beacon_edge_idxes = getBeaconEdgeIdxes(keys, hash_name, edgecnt, tmp_placement_name, tmp_vnodecnt);
+        const std::vector<uint32_t> add_beacon_edge_idxes = getBeaconEdgeIdxes(keys, hash_name, edgecnt + 1, tmp_placement_name, tmp_vnodecnt);
+        const std::vector<uint32_t> remove_beacon_edge_idxes = getBeaconEdgeIdxes(keys, hash_name, edgecnt - 1, tmp_placement_name, tmp_vnodecnt);
+
+        uint64_t tmp_checksum = 0;
+        const double tmp_ns_per_op = getLookupNsPerOp(keys, access_sequence, hash_name, edgecnt, tmp_placement_name, tmp_vnodecnt, tmp_checksum);
+
+        for (uint32_t j = 0; j < zipf_alphas.size(); j++)
+        {
+            const std::vector<double>& tmp_probs = zipf_probs_list[j];
+            const double tmp_add_remap_ratio = getRemapRatio(prev_beacon_edge_idxes, add_beacon_edge_idxes, tmp_probs);
+            const double tmp_remove_remap_ratio = getRemapRatio(prev_beacon_edge_idxes, remove_beacon_edge_idxes, tmp_probs);
+            double tmp_max_avg_ratio = 0.0;
+            double tmp_cv = 0.0;
+            getLoadBalance(prev_beacon_edge_idxes, tmp_probs, edgecnt, tmp_max_avg_ratio, tmp_cv);
+
+            std::cout << std::left << std::setw(12) << tmp_placement_name << std::setw(10) << tmp_vnodecnt << std::setw(10) << std::setprecision(2) << zipf_alphas[j] << std::setprecision(4) << std::setw(12) << tmp_add_remap_ratio << std::setw(12) << tmp_remove_remap_ratio << std::setw(10) << tmp_max_avg_ratio << std::setw(10) << tmp_cv << std::setw(10) << std::setprecision(2) << tmp_ns_per_op << tmp_checksum << std::endl;
+        }
+    }
+
+    return 0;
+}
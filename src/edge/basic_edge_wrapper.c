@@ -13,8 +13,8 @@ namespace covered
 {
     const std::string BasicEdgeWrapper::kClassName("BasicEdgeWrapper");
 
-    BasicEdgeWrapper::BasicEdgeWrapper(const std::string& cache_name, const uint64_t& capacity_bytes, const uint32_t& edge_idx, const uint32_t& edgecnt, const std::string& hash_name, const uint32_t& keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& percacheserver_workercnt, const uint32_t& peredge_synced_victimcnt, const uint32_t& peredge_monitored_victimsetcnt, const uint64_t& popularity_aggregation_capacity_bytes, const double& popularity_collection_change_ratio, const CLILatencyInfo& cli_latency_info, const uint32_t& topk_edgecnt, const std::string& realnet_option, const std::string& realnet_expname, const std::vector<uint32_t> _p2p_latency_array) 
-        : EdgeWrapperBase(cache_name, capacity_bytes, edge_idx, edgecnt, hash_name, keycnt, local_uncached_capacity_bytes, local_uncached_lru_bytes, percacheserver_workercnt, peredge_synced_victimcnt, peredge_monitored_victimsetcnt, popularity_aggregation_capacity_bytes, popularity_collection_change_ratio, cli_latency_info, topk_edgecnt, realnet_option, realnet_expname, _p2p_latency_array)
+    BasicEdgeWrapper::BasicEdgeWrapper(const std::string& cache_name, const uint64_t& capacity_bytes, const uint32_t& edge_idx, const uint32_t& edgecnt, const std::string& hash_name, const uint32_t& keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& percacheserver_workercnt, const uint32_t& local_cache_shardcnt, const CachelibNvmInfo& cachelib_nvm_info, const uint32_t& cache_server_worker_inflightcnt, const uint32_t& perbeaconserver_workercnt, const uint32_t& peredge_synced_victimcnt, const uint32_t& peredge_monitored_victimsetcnt, const uint64_t& popularity_aggregation_capacity_bytes, const double& popularity_collection_change_ratio, const CLILatencyInfo& cli_latency_info, const uint32_t& topk_edgecnt, const std::string& realnet_option, const std::string& realnet_expname, const std::vector<uint32_t> _p2p_latency_array) 
+        : EdgeWrapperBase(cache_name, capacity_bytes, edge_idx, edgecnt, hash_name, keycnt, local_uncached_capacity_bytes, local_uncached_lru_bytes, percacheserver_workercnt, local_cache_shardcnt, cachelib_nvm_info, cache_server_worker_inflightcnt, perbeaconserver_workercnt, peredge_synced_victimcnt, peredge_monitored_victimsetcnt, popularity_aggregation_capacity_bytes, popularity_collection_change_ratio, cli_latency_info, topk_edgecnt, realnet_option, realnet_expname, _p2p_latency_array)
     {
         assert(cache_name != Util::COVERED_CACHE_NAME);
 
@@ -90,7 +90,7 @@ namespace covered
         {
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
             invalidation_request_ptr = new BestGuessInvalidationRequest(key, BestGuessSyncinfo(local_victim_vtime), edge_idx, recvrsp_source_addr, extra_common_msghdr);
@@ -116,7 +116,7 @@ namespace covered
 
             // Vtime synchronization
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(bestguess_invalidation_response_ptr->getSourceIndex(), syncinfo.getVtime());
-            getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
         else
         {
@@ -145,7 +145,7 @@ namespace covered
         {
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
             finish_block_request_ptr = new BestGuessFinishBlockRequest(key, BestGuessSyncinfo(local_victim_vtime), edge_idx, recvrsp_source_addr, extra_common_msghdr);
@@ -171,7 +171,7 @@ namespace covered
 
             // Vtime synchronization
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(bestguess_finish_block_response_ptr->getSourceIndex(), syncinfo.getVtime());
-            getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
         else
         {
@@ -17,7 +17,7 @@ namespace covered
 {
     const std::string BasicBeaconServer::kClassName("BasicBeaconServer");
 
-    BasicBeaconServer::BasicBeaconServer(EdgeComponentParam* edge_beacon_server_param_ptr) : BeaconServerBase(edge_beacon_server_param_ptr)
+    BasicBeaconServer::BasicBeaconServer(EdgeComponentParam* edge_beacon_server_param_ptr, BeaconServerWorkerParam* beacon_server_worker_param_ptr) : BeaconServerBase(edge_beacon_server_param_ptr, beacon_server_worker_param_ptr)
     {
         assert(edge_beacon_server_param_ptr != NULL);
         EdgeWrapperBase* tmp_edge_wrapper_ptr = edge_beacon_server_param_ptr->getEdgeWrapperPtr();
@@ -28,6 +28,10 @@ namespace covered
         // Differentiate BasicBeaconServer in different edge nodes
         std::ostringstream oss;
         oss << kClassName << " edge" << edge_idx;
+        if (beacon_server_worker_param_ptr != NULL)
+        {
+            oss << " worker" << beacon_server_worker_param_ptr->getLocalBeaconServerWorkerIdx();
+        }
         instance_name_ = oss.str();
     }
 
@@ -60,7 +64,7 @@ namespace covered
 
             // Vtime synchronization
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(source_edge_idx, syncinfo.getVtime());
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
         else
         {
@@ -118,7 +122,7 @@ namespace covered
         {
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
             // Get key and extra_common_msghdr from control request if any
@@ -181,7 +185,7 @@ namespace covered
 
             // Vtime synchronization
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(bestguess_directory_update_request_ptr->getSourceIndex(), bestguess_directory_update_request_ptr->getSyncinfo().getVtime());
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
 
             if (is_admit) // Foreground/background directory admission (i.e., validation for BestGuess) by local/remote placement notification
             {
@@ -247,7 +251,7 @@ namespace covered
 
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
             if (message_type == MessageType::kBestGuessDirectoryUpdateRequest) // Foreground directory admission/eviction by local placement notification or value update
@@ -301,7 +305,7 @@ namespace covered
 
             // Vtime synchronization
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(source_edge_idx, syncinfo.getVtime());
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
         else
         {
@@ -348,7 +352,7 @@ namespace covered
 
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
             acquire_writelock_response_ptr = new BestGuessAcquireWritelockResponse(tmp_key, lock_result, BestGuessSyncinfo(local_victim_vtime), edge_idx, edge_beacon_server_recvreq_source_addr_, total_bandwidth_usage, event_list, extra_common_msghdr);
@@ -390,7 +394,7 @@ namespace covered
 
             // Vtime synchronization
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(sender_edge_idx, syncinfo.getVtime());
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
         else
         {
@@ -440,7 +444,7 @@ namespace covered
 
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
             uint32_t edge_idx = tmp_edge_wrapper_ptr->getNodeIdx();
@@ -534,7 +538,7 @@ namespace covered
 
         // Vtime synchronization
         UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(source_edge_idx, syncinfo.getVtime());
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
 
         // Try to preserve invalid dirinfo in directory table for trigger flag
         PreserveDirectoryTableIfGlobalUncachedFuncParam tmp_param_for_preserve(key, DirectoryInfo(placement_edge_idx));
@@ -543,7 +547,7 @@ namespace covered
 
         // Get local victim vtime for vtime synchronization
         GetLocalVictimVtimeFuncParam tmp_param_for_localvtime;
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_localvtime);
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_localvtime);
         const uint64_t& local_victim_vtime = tmp_param_for_localvtime.getLocalVictimVtimeRef();
 
         if (is_triggered) // The first placement trigger of global uncached object
@@ -567,7 +571,12 @@ namespace covered
                 // Notify placement processor to admit local edge cache (NOTE: NO need to admit directory) and trigger local cache eviciton in the background
                 const bool is_valid = !is_being_written;
                 bool is_successful = tmp_edge_wrapper_ptr->getLocalCacheAdmissionBufferPtr()->push(LocalCacheAdmissionItem(key, value, unused_is_neighbor_cached, is_valid, extra_common_msghdr));
-                assert(is_successful);
+                if (!is_successful) // NOTE: blocking push fails ONLY if edge node is NOT running now (placement processor stops popping)
+                {
+                    assert(!tmp_edge_wrapper_ptr->isNodeRunning());
+                    is_finish = true;
+                    return is_finish;
+                }
             }
             else // Remote placement notification
             {
@@ -16,7 +16,7 @@ namespace covered
     class BasicBeaconServer : public BeaconServerBase
     {
     public:
-        BasicBeaconServer(EdgeComponentParam* edge_beacon_server_param_ptr);
+        BasicBeaconServer(EdgeComponentParam* edge_beacon_server_param_ptr, BeaconServerWorkerParam* beacon_server_worker_param_ptr);
         virtual ~BasicBeaconServer();
     private:
         static const std::string kClassName;
@@ -1,9 +1,12 @@
 #include "edge/beacon_server/beacon_server_base.h"
 
 #include <assert.h>
+#include <pthread.h>
+#include <unistd.h> // usleep
 
 #include "common/bandwidth_usage.h"
 #include "common/config.h"
+#include "common/thread_launcher.h"
 #include "common/util.h"
 #include "edge/basic_edge_custom_func_param.h"
 #include "edge/covered_edge_custom_func_param.h"
@@ -20,7 +23,7 @@ namespace covered
     {
         assert(edge_beacon_server_param_ptr != NULL);
 
-        BeaconServerBase* beacon_server_ptr = BeaconServerBase::getBeaconServerByCacheName((EdgeComponentParam*)edge_beacon_server_param_ptr);
+        BeaconServerBase* beacon_server_ptr = BeaconServerBase::getBeaconServerByCacheName((EdgeComponentParam*)edge_beacon_server_param_ptr, NULL);
         assert(beacon_server_ptr != NULL);
         beacon_server_ptr->start();
 
@@ -32,7 +35,24 @@ namespace covered
         return NULL;
     }
 
-    BeaconServerBase* BeaconServerBase::getBeaconServerByCacheName(EdgeComponentParam* edge_beacon_server_param_ptr)
+    void* BeaconServerBase::launchBeaconServerWorker(void* beacon_server_worker_param_ptr)
+    {
+        assert(beacon_server_worker_param_ptr != NULL);
+
+        BeaconServerWorkerParam* tmp_beacon_server_worker_param_ptr = (BeaconServerWorkerParam*)beacon_server_worker_param_ptr;
+        BeaconServerBase* beacon_server_worker_ptr = BeaconServerBase::getBeaconServerByCacheName(tmp_beacon_server_worker_param_ptr->getEdgeBeaconServerParamPtr(), tmp_beacon_server_worker_param_ptr);
+        assert(beacon_server_worker_ptr != NULL);
+        beacon_server_worker_ptr->startWorker_();
+
+        assert(beacon_server_worker_ptr != NULL);
+        delete beacon_server_worker_ptr;
+        beacon_server_worker_ptr = NULL;
+
+        pthread_exit(NULL);
+        return NULL;
+    }
+
+    BeaconServerBase* BeaconServerBase::getBeaconServerByCacheName(EdgeComponentParam* edge_beacon_server_param_ptr, BeaconServerWorkerParam* beacon_server_worker_param_ptr)
     {
         BeaconServerBase* beacon_server_ptr = NULL;
 
@@ -40,30 +60,34 @@ namespace covered
         std::string cache_name = edge_beacon_server_param_ptr->getEdgeWrapperPtr()->getCacheName();
         if (cache_name == Util::COVERED_CACHE_NAME)
         {
-            beacon_server_ptr = new CoveredBeaconServer(edge_beacon_server_param_ptr);
+            beacon_server_ptr = new CoveredBeaconServer(edge_beacon_server_param_ptr, beacon_server_worker_param_ptr);
         }
         else
         {
-            beacon_server_ptr = new BasicBeaconServer(edge_beacon_server_param_ptr);
+            beacon_server_ptr = new BasicBeaconServer(edge_beacon_server_param_ptr, beacon_server_worker_param_ptr);
         }
 
         assert(beacon_server_ptr != NULL);
         return beacon_server_ptr;
     }
 
-    BeaconServerBase::BeaconServerBase(EdgeComponentParam* edge_beacon_server_param_ptr) : edge_beacon_server_param_ptr_(edge_beacon_server_param_ptr)
+    BeaconServerBase::BeaconServerBase(EdgeComponentParam* edge_beacon_server_param_ptr, BeaconServerWorkerParam* beacon_server_worker_param_ptr) : beacon_server_worker_param_ptr_(beacon_server_worker_param_ptr), edge_beacon_server_param_ptr_(edge_beacon_server_param_ptr)
     {
         assert(edge_beacon_server_param_ptr != NULL);
         const uint32_t edge_idx = edge_beacon_server_param_ptr->getEdgeWrapperPtr()->getNodeIdx();
         const uint32_t edgecnt = edge_beacon_server_param_ptr->getEdgeWrapperPtr()->getNodeCnt();
+        const uint32_t perbeaconserver_workercnt = edge_beacon_server_param_ptr->getEdgeWrapperPtr()->getPerbeaconserverWorkercnt();
+        assert(perbeaconserver_workercnt > 0);
 
         // Differentiate cache servers of different edge nodes
         std::ostringstream oss;
         oss << kClassName << " edge" << edge_idx;
+        if (beacon_server_worker_param_ptr != NULL)
+        {
+            oss << " worker" << beacon_server_worker_param_ptr->getLocalBeaconServerWorkerIdx();
+        }
         base_instance_name_ = oss.str();
 
-        // For receiving control requests
-
         // Get source address of beacon server recvreq
         const bool is_private_edge_ipstr = false; // NOTE: cross-edge communication uses public IP address
         const bool is_launch_edge = true; // The edge beacon server belongs to the logical edge node launched in the current physical machine
@@ -71,47 +95,124 @@ namespace covered
         uint16_t edge_beacon_server_recvreq_port = Util::getEdgeBeaconServerRecvreqPort(edge_idx, edgecnt);
         edge_beacon_server_recvreq_source_addr_ = NetworkAddr(edge_ipstr, edge_beacon_server_recvreq_port);
 
-        // Prepare a socket server on recvreq port for beacon server
-        NetworkAddr recvreq_host_addr(Util::ANY_IPSTR, edge_beacon_server_recvreq_port);
-        edge_beacon_server_recvreq_socket_server_ptr_ = new UdpMsgSocketServer(recvreq_host_addr);
-        assert(edge_beacon_server_recvreq_socket_server_ptr_ != NULL);
+        edge_beacon_server_recvreq_socket_server_ptr_ = NULL;
+        edge_beacon_server_recvrsp_socket_server_ptr_ = NULL;
+        hash_wrapper_ptr_ = NULL;
+
+        if (beacon_server_worker_param_ptr == NULL) // Beacon server itself
+        {
+            // For receiving control requests
+
+            // Prepare a socket server on recvreq port for beacon server
+            NetworkAddr recvreq_host_addr(Util::ANY_IPSTR, edge_beacon_server_recvreq_port);
+            edge_beacon_server_recvreq_socket_server_ptr_ = new UdpMsgSocketServer(recvreq_host_addr);
+            assert(edge_beacon_server_recvreq_socket_server_ptr_ != NULL);
 
-        // For receiving control responses (e.g., InvalidationResponse and FinishBlockResponse)
+            if (perbeaconserver_workercnt > 1)
+            {
+                // Allocate hash wrapper for partition
+                hash_wrapper_ptr_ = HashWrapperBase::getHashWrapperByHashName(Util::MMH3_HASH_NAME);
+                assert(hash_wrapper_ptr_ != NULL);
 
-        // Get source address of beacon server recvrsp
-        uint16_t edge_beacon_server_recvrsp_port = Util::getEdgeBeaconServerRecvrspPort(edge_idx, edgecnt);
-        edge_beacon_server_recvrsp_source_addr_ = NetworkAddr(edge_ipstr, edge_beacon_server_recvrsp_port);
+                // Verify that recvrsp ports of all beacon server workers (expanded from the per-edge recvrsp port by perbeaconserver_workercnt) do NOT overlap with the next port range before launching any worker
+                const uint16_t final_beacon_server_worker_recvrsp_port = Util::getEdgeBeaconServerWorkerRecvrspPort(edge_idx, edgecnt, perbeaconserver_workercnt - 1, perbeaconserver_workercnt);
+                Config::portVerification(Config::getEdgeBeaconServerRecvrspStartport(), final_beacon_server_worker_recvrsp_port);
 
-        // Prepare a socket server on recvrsp port for beacon server
-        NetworkAddr recvrsp_host_addr(Util::ANY_IPSTR, edge_beacon_server_recvrsp_port);
-        edge_beacon_server_recvrsp_socket_server_ptr_ = new UdpMsgSocketServer(recvrsp_host_addr);
-        assert(edge_beacon_server_recvrsp_socket_server_ptr_ != NULL);
+                // Prepare parameters for beacon server worker threads
+                // NOTE: reuse the ring buffer size of cache server workers, as each beacon server worker serves control requests issued by cache server workers
+                for (uint32_t local_beacon_server_worker_idx = 0; local_beacon_server_worker_idx < perbeaconserver_workercnt; local_beacon_server_worker_idx++)
+                {
+                    BeaconServerWorkerParam* tmp_beacon_server_worker_param_ptr = new BeaconServerWorkerParam(edge_beacon_server_param_ptr, local_beacon_server_worker_idx, Config::getEdgeCacheServerDataRequestBufferSize());
+                    assert(tmp_beacon_server_worker_param_ptr != NULL);
+                    beacon_server_worker_param_ptrs_.push_back(tmp_beacon_server_worker_param_ptr);
+                }
+            }
+        }
+
+        if (beacon_server_worker_param_ptr != NULL || perbeaconserver_workercnt == 1) // Beacon server worker or single-threaded beacon server
+        {
+            // For receiving control responses (e.g., InvalidationResponse and FinishBlockResponse)
+
+            // Get source address of beacon server recvrsp
+            const uint32_t local_beacon_server_worker_idx = (beacon_server_worker_param_ptr != NULL) ? beacon_server_worker_param_ptr->getLocalBeaconServerWorkerIdx() : 0;
+            uint16_t edge_beacon_server_recvrsp_port = Util::getEdgeBeaconServerWorkerRecvrspPort(edge_idx, edgecnt, local_beacon_server_worker_idx, perbeaconserver_workercnt);
+            edge_beacon_server_recvrsp_source_addr_ = NetworkAddr(edge_ipstr, edge_beacon_server_recvrsp_port);
+
+            // Prepare a socket server on recvrsp port for beacon server
+            NetworkAddr recvrsp_host_addr(Util::ANY_IPSTR, edge_beacon_server_recvrsp_port);
+            edge_beacon_server_recvrsp_socket_server_ptr_ = new UdpMsgSocketServer(recvrsp_host_addr);
+            assert(edge_beacon_server_recvrsp_socket_server_ptr_ != NULL);
+        }
     }
 
     BeaconServerBase::~BeaconServerBase()
     {
         // NOTE: no need to release edge_beacon_server_param_ptr_, which will be released outside BeaconServerBase (e.g., simulator)
+        // NOTE: no need to release beacon_server_worker_param_ptr_, which will be released by beacon server itself
 
-        // Release the socket server on recvreq port
-        assert(edge_beacon_server_recvreq_socket_server_ptr_ != NULL);
-        delete edge_beacon_server_recvreq_socket_server_ptr_;
-        edge_beacon_server_recvreq_socket_server_ptr_ = NULL;
+        // Release the socket server on recvreq port if any
+        if (edge_beacon_server_recvreq_socket_server_ptr_ != NULL)
+        {
+            delete edge_beacon_server_recvreq_socket_server_ptr_;
+            edge_beacon_server_recvreq_socket_server_ptr_ = NULL;
+        }
 
-        // Release the socket server on recvrsp port
-        assert(edge_beacon_server_recvrsp_socket_server_ptr_ != NULL);
-        delete edge_beacon_server_recvrsp_socket_server_ptr_;
-        edge_beacon_server_recvrsp_socket_server_ptr_ = NULL;
+        // Release the socket server on recvrsp port if any
+        if (edge_beacon_server_recvrsp_socket_server_ptr_ != NULL)
+        {
+            delete edge_beacon_server_recvrsp_socket_server_ptr_;
+            edge_beacon_server_recvrsp_socket_server_ptr_ = NULL;
+        }
+
+        // Release beacon server worker params if any (NOTE: beacon server workers have been joined in start())
+        for (uint32_t local_beacon_server_worker_idx = 0; local_beacon_server_worker_idx < beacon_server_worker_param_ptrs_.size(); local_beacon_server_worker_idx++)
+        {
+            assert(beacon_server_worker_param_ptrs_[local_beacon_server_worker_idx] != NULL);
+            delete beacon_server_worker_param_ptrs_[local_beacon_server_worker_idx];
+            beacon_server_worker_param_ptrs_[local_beacon_server_worker_idx] = NULL;
+        }
+        beacon_server_worker_param_ptrs_.clear();
+
+        // Release hash wrapper for partition if any
+        if (hash_wrapper_ptr_ != NULL)
+        {
+            delete hash_wrapper_ptr_;
+            hash_wrapper_ptr_ = NULL;
+        }
     }
 
     void BeaconServerBase::start()
     {
         checkPointers_();
+        assert(beacon_server_worker_param_ptr_ == NULL); // ONLY beacon server itself receives control requests
+        assert(edge_beacon_server_recvreq_socket_server_ptr_ != NULL);
+
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = edge_beacon_server_param_ptr_->getEdgeWrapperPtr();
+        const uint32_t edge_idx = tmp_edge_wrapper_ptr->getNodeIdx();
+        const uint32_t perbeaconserver_workercnt = beacon_server_worker_param_ptrs_.size(); // 0 for single-threaded beacon server
+
+        // Launch beacon server workers if any
+        std::vector<pthread_t> beacon_server_worker_threads(perbeaconserver_workercnt);
+        for (uint32_t local_beacon_server_worker_idx = 0; local_beacon_server_worker_idx < perbeaconserver_workercnt; local_beacon_server_worker_idx++)
+        {
+            std::string tmp_thread_name = "edge-beacon-server-worker-" + std::to_string(edge_idx) + "-" + std::to_string(local_beacon_server_worker_idx);
+            ThreadLauncher::pthreadCreateHighPriority(ThreadLauncher::EDGE_THREAD_ROLE, tmp_thread_name, &beacon_server_worker_threads[local_beacon_server_worker_idx], BeaconServerBase::launchBeaconServerWorker, (void*)(beacon_server_worker_param_ptrs_[local_beacon_server_worker_idx]));
+        }
+
+        // Wait beacon server workers to finish initialization (i.e., bind recvrsp ports)
+        for (uint32_t local_beacon_server_worker_idx = 0; local_beacon_server_worker_idx < perbeaconserver_workercnt; local_beacon_server_worker_idx++)
+        {
+            while (!beacon_server_worker_param_ptrs_[local_beacon_server_worker_idx]->isFinishInitialization())
+            {
+                usleep(SubthreadParamBase::INITIALIZATION_WAIT_INTERVAL_US);
+            }
+        }
 
         // Notify edge wrapper that edge beacon server has finished initialization
         edge_beacon_server_param_ptr_->markFinishInitialization();
 
         bool is_finish = false; // Mark if edge node is finished
-        while (edge_beacon_server_param_ptr_->getEdgeWrapperPtr()->isNodeRunning()) // edge_running_ is set as true by default
+        while (tmp_edge_wrapper_ptr->isNodeRunning()) // edge_running_ is set as true by default
         {
             // Receive the message payload of control requests
             DynamicArray control_request_msg_payload;
@@ -125,35 +226,16 @@ namespace covered
                 MessageBase* control_request_ptr = MessageBase::getRequestFromMsgPayload(control_request_msg_payload);
                 assert(control_request_ptr != NULL);
 
-                NetworkAddr edge_cache_server_worker_recvrsp_dst_addr = control_request_ptr->getSourceAddr();
-
-                if (control_request_ptr->isControlRequest()) // Control requests (e.g., invalidation and cache admission/eviction requests)
+                if (perbeaconserver_workercnt > 0)
                 {
-                    is_finish = processControlRequest_(control_request_ptr, edge_cache_server_worker_recvrsp_dst_addr);
-                }
-                else if (control_request_ptr->getMessageType() == MessageType::kCoveredBgfetchRedirectedGetResponse) // Non-blocking placement deployment
-                {
-                    // NOTE: NOT embed background events/bandwidth-usage into CoveredBgfetchRedirectedGetResponse even if it is received by beacon server, as we need to embed such information into foreground messages to be tracked by clients
-                    ProcessRspToRedirectGetForPlacementFuncParam tmp_param(control_request_ptr);
-                    customFunc(ProcessRspToRedirectGetForPlacementFuncParam::FUNCNAME, &tmp_param);
-                }
-                else if (control_request_ptr->getMessageType() == MessageType::kCoveredBgfetchGlobalGetResponse) // Non-blocking placement deployment
-                {
-                    // NOTE: NOT embed background events/bandwidth-usage into CoveredBgfetchRedirectedGetResponse even if it is received by beacon server, as we need to embed such information into foreground messages to be tracked by clients
-                    ProcessRspToAccessCloudForPlacementFuncParam tmp_param(control_request_ptr);
-                    customFunc(ProcessRspToAccessCloudForPlacementFuncParam::FUNCNAME, &tmp_param);
-                }
-                else
-                {
-                    std::ostringstream oss;
-                    oss << "invalid message type " << MessageBase::messageTypeToString(control_request_ptr->getMessageType()) << " for start()!";
-                    Util::dumpErrorMsg(base_instance_name_, oss.str());
-                    exit(1);
+                    // Pass received request to the beacon server worker owning its key by ring buffer
+                    // NOTE: received request will be released by the corresponding beacon server worker
+                    partitionRequest_(control_request_ptr);
+                    continue;
                 }
 
-                // Release messages
-                assert(control_request_ptr != NULL);
-                delete control_request_ptr;
+                // NOTE: received request will be released in processRequest_()
+                is_finish = processRequest_(control_request_ptr);
                 control_request_ptr = NULL;
 
                 if (is_finish) // Check is_finish
@@ -163,9 +245,127 @@ namespace covered
             } // End of (is_timeout == false)
         } // End of while loop
 
+        // Notify and wait for beacon server workers if any
+        for (uint32_t local_beacon_server_worker_idx = 0; local_beacon_server_worker_idx < perbeaconserver_workercnt; local_beacon_server_worker_idx++)
+        {
+            beacon_server_worker_param_ptrs_[local_beacon_server_worker_idx]->notifyFinish();
+        }
+        for (uint32_t local_beacon_server_worker_idx = 0; local_beacon_server_worker_idx < perbeaconserver_workercnt; local_beacon_server_worker_idx++)
+        {
+            int pthread_returncode = pthread_join(beacon_server_worker_threads[local_beacon_server_worker_idx], NULL); // void* retval = NULL
+            if (pthread_returncode != 0)
+            {
+                std::ostringstream oss;
+                oss << "edge " << edge_idx << " failed to join beacon server worker " << local_beacon_server_worker_idx << " (error code: " << pthread_returncode << ")" << std::endl;
+                Util::dumpErrorMsg(base_instance_name_, oss.str());
+                exit(1);
+            }
+        }
+
+        return;
+    }
+
+    void BeaconServerBase::startWorker_()
+    {
+        checkPointers_();
+        assert(beacon_server_worker_param_ptr_ != NULL);
+        assert(edge_beacon_server_recvrsp_socket_server_ptr_ != NULL);
+
+        // Notify beacon server that the current beacon server worker has finished initialization
+        beacon_server_worker_param_ptr_->markFinishInitialization();
+
+        bool is_finish = false; // Mark if edge node is finished
+        while (edge_beacon_server_param_ptr_->getEdgeWrapperPtr()->isNodeRunning())
+        {
+            CacheServerItem tmp_beacon_server_item;
+            bool is_successful = beacon_server_worker_param_ptr_->pop(tmp_beacon_server_item); // Blocking until a control request arrives or edge node is finished
+            if (!is_successful)
+            {
+                continue; // Go to check if edge is still running
+            }
+
+            MessageBase* control_request_ptr = tmp_beacon_server_item.getRequestPtr();
+            assert(control_request_ptr != NULL);
+
+            // NOTE: received request will be released in processRequest_()
+            is_finish = processRequest_(control_request_ptr);
+            control_request_ptr = NULL;
+
+            if (is_finish) // Check is_finish
+            {
+                continue; // Go to check if edge is still running
+            }
+        }
+
+        return;
+    }
+
+    void BeaconServerBase::partitionRequest_(MessageBase* control_request_ptr)
+    {
+        assert(control_request_ptr != NULL);
+        assert(hash_wrapper_ptr_ != NULL);
+
+        const uint32_t perbeaconserver_workercnt = beacon_server_worker_param_ptrs_.size();
+        assert(perbeaconserver_workercnt > 1);
+
+        // Calculate the corresponding beacon server worker index by hashing (NOTE: DHT maps contiguous ranges of hash ring into edge nodes, so keys beaconed by the current edge node are still spread over all beacon server workers)
+        Key tmp_key = MessageBase::getKeyFromMessage(control_request_ptr);
+        uint32_t local_beacon_server_worker_idx = hash_wrapper_ptr_->hash(tmp_key) % perbeaconserver_workercnt;
+        assert(local_beacon_server_worker_idx < perbeaconserver_workercnt);
+
+        // Pass item into ring buffer of the corresponding beacon server worker
+        CacheServerItem tmp_beacon_server_item(control_request_ptr);
+        bool is_successful = beacon_server_worker_param_ptrs_[local_beacon_server_worker_idx]->push(tmp_beacon_server_item);
+        if (!is_successful) // Ring buffer is full under overload (see Config::ring_buffer_overload_policy_)
+        {
+            // NOTE: drop the request, which has been counted by the beacon server worker param and will be resent by the sender after timeout
+            delete control_request_ptr;
+            control_request_ptr = NULL;
+        }
+
         return;
     }
 
+    bool BeaconServerBase::processRequest_(MessageBase* control_request_ptr)
+    {
+        assert(control_request_ptr != NULL);
+
+        bool is_finish = false; // Mark if edge node is finished
+
+        NetworkAddr edge_cache_server_worker_recvrsp_dst_addr = control_request_ptr->getSourceAddr();
+
+        if (control_request_ptr->isControlRequest()) // Control requests (e.g., invalidation and cache admission/eviction requests)
+        {
+            is_finish = processControlRequest_(control_request_ptr, edge_cache_server_worker_recvrsp_dst_addr);
+        }
+        else if (control_request_ptr->getMessageType() == MessageType::kCoveredBgfetchRedirectedGetResponse) // Non-blocking placement deployment
+        {
+            // NOTE: NOT embed background events/bandwidth-usage into CoveredBgfetchRedirectedGetResponse even if it is received by beacon server, as we need to embed such information into foreground messages to be tracked by clients
+            ProcessRspToRedirectGetForPlacementFuncParam tmp_param(control_request_ptr);
+            customFunc(ProcessRspToRedirectGetForPlacementFuncParam::FUNCNAME, &tmp_param);
+        }
+        else if (control_request_ptr->getMessageType() == MessageType::kCoveredBgfetchGlobalGetResponse) // Non-blocking placement deployment
+        {
+            // NOTE: NOT embed background events/bandwidth-usage into CoveredBgfetchRedirectedGetResponse even if it is received by beacon server, as we need to embed such information into foreground messages to be tracked by clients
+            ProcessRspToAccessCloudForPlacementFuncParam tmp_param(control_request_ptr);
+            customFunc(ProcessRspToAccessCloudForPlacementFuncParam::FUNCNAME, &tmp_param);
+        }
+        else
+        {
+            std::ostringstream oss;
+            oss << "invalid message type " << MessageBase::messageTypeToString(control_request_ptr->getMessageType()) << " for processRequest_()!";
+            Util::dumpErrorMsg(base_instance_name_, oss.str());
+            exit(1);
+        }
+
+        // Release messages
+        assert(control_request_ptr != NULL);
+        delete control_request_ptr;
+        control_request_ptr = NULL;
+
+        return is_finish;
+    }
+
     bool BeaconServerBase::processControlRequest_(MessageBase* control_request_ptr, const NetworkAddr& edge_cache_server_worker_recvrsp_dst_addr)
     {
         assert(control_request_ptr != NULL && control_request_ptr->isControlRequest());
@@ -479,7 +679,6 @@ namespace covered
     {
         assert(edge_beacon_server_param_ptr_ != NULL);
         assert(edge_beacon_server_param_ptr_->getEdgeWrapperPtr());
-        assert(edge_beacon_server_recvreq_socket_server_ptr_ != NULL);
-        assert(edge_beacon_server_recvrsp_socket_server_ptr_ != NULL);
+        assert(edge_beacon_server_recvreq_socket_server_ptr_ != NULL || edge_beacon_server_recvrsp_socket_server_ptr_ != NULL); // NOTE: beacon server workers do NOT receive control requests, and beacon server itself does NOT receive control responses if perbeaconserver_workercnt > 1
     }
 }
\ No newline at end of file
@@ -12,6 +12,11 @@
  * (3) Receive/issue finish write requests/responses
  * (4) Issue/receive finish block requests/responses
  * (5) Receive/issue directory update requests/reponses
+ *
+ * C. Key-partitioned beacon server workers (if perbeaconserver_workercnt > 1)
+ * (1) Beacon server ONLY receives control requests and passes each of them into the ring buffer of the beacon server worker owning the hash partition of its key (the same as CacheServerBase::partitionRequest_())
+ * (2) Each beacon server worker is an individual BeaconServerBase instance with its own recvrsp port for InvalidationResponse and FinishBlockResponse
+ * (3) Requests of the same key are always processed by the same worker in FIFO order, so per-key ordering is the same as single-threaded beacon server
  * 
  * By Siyuan Sheng (2023.06.21).
  */
@@ -22,11 +27,14 @@
 //#define DEBUG_BEACON_SERVER
 
 #include <string>
+#include <vector>
 
 #include "core/popularity/fast_path_hint.h"
+#include "edge/beacon_server/beacon_server_worker_param.h"
 #include "edge/edge_component_param.h"
 #include "edge/edge_wrapper_base.h"
 #include "edge/edge_custom_func_param_base.h"
+#include "hash/hash_wrapper_base.h"
 #include "message/message_base.h"
 #include "network/udp_msg_socket_server.h"
 
@@ -36,15 +44,25 @@ namespace covered
     {
     public:
         static void* launchBeaconServer(void* edge_beacon_server_param_ptr);
-        static BeaconServerBase* getBeaconServerByCacheName(EdgeComponentParam* edge_beacon_server_param_ptr);
+        static void* launchBeaconServerWorker(void* beacon_server_worker_param_ptr);
+        static BeaconServerBase* getBeaconServerByCacheName(EdgeComponentParam* edge_beacon_server_param_ptr, BeaconServerWorkerParam* beacon_server_worker_param_ptr);
 
-        BeaconServerBase(EdgeComponentParam* edge_beacon_server_param_ptr);
+        // NOTE: beacon_server_worker_param_ptr is NULL for beacon server itself, which receives control requests
+        BeaconServerBase(EdgeComponentParam* edge_beacon_server_param_ptr, BeaconServerWorkerParam* beacon_server_worker_param_ptr);
         virtual ~BeaconServerBase();
 
         void start();
     private:
         static const std::string kClassName;
 
+        // Key-partitioned beacon server workers
+
+        void startWorker_(); // Process control requests of the hash partition owned by the current beacon server worker
+        void partitionRequest_(MessageBase* control_request_ptr); // Pass control request into the ring buffer of the corresponding beacon server worker
+
+        // Return if edge node is finished (NOTE: control_request_ptr will be released)
+        bool processRequest_(MessageBase* control_request_ptr);
+
         // Return if edge node is finished
         bool processControlRequest_(MessageBase* control_request_ptr, const NetworkAddr& edge_cache_server_worker_recvrsp_dst_addr);
 
@@ -85,6 +103,11 @@ namespace covered
 
         // Const variable
         std::string base_instance_name_;
+
+        // For key-partitioned beacon server workers
+        BeaconServerWorkerParam* beacon_server_worker_param_ptr_; // The current beacon server worker (NULL for beacon server itself)
+        std::vector<BeaconServerWorkerParam*> beacon_server_worker_param_ptrs_; // Launched beacon server workers (ONLY used by beacon server itself if perbeaconserver_workercnt > 1)
+        HashWrapperBase* hash_wrapper_ptr_; // For partition (ONLY used by beacon server itself if perbeaconserver_workercnt > 1)
     protected:
         // (4) Embed background events and bandwidth usage
 
@@ -101,11 +124,11 @@ namespace covered
 
         // For receiving control requests
         NetworkAddr edge_beacon_server_recvreq_source_addr_; // The same as cache server worker to send control requests (const individual variable)
-        UdpMsgSocketServer* edge_beacon_server_recvreq_socket_server_ptr_; // Used by beacon server to receive control requests from cache server workers (non-const individual variable)
+        UdpMsgSocketServer* edge_beacon_server_recvreq_socket_server_ptr_; // Used by beacon server to receive control requests from cache server workers (non-const individual variable; NULL for beacon server workers)
 
         // For receiving control responses (e.g., InvalidationResponse and FinishBlockResponse)
         NetworkAddr edge_beacon_server_recvrsp_source_addr_; // Used by invalidation server or cache server worker to send back control responses (const individual variable)
-        UdpMsgSocketServer* edge_beacon_server_recvrsp_socket_server_ptr_; // Used by beacon server to receive control requests from invalidation server or cache server worker (non-const individual variable)
+        UdpMsgSocketServer* edge_beacon_server_recvrsp_socket_server_ptr_; // Used by beacon server to receive control requests from invalidation server or cache server worker (non-const individual variable; NULL for beacon server itself if perbeaconserver_workercnt > 1)
     };
 }
 
@@ -0,0 +1,125 @@
+#include "edge/beacon_server/beacon_server_worker_param.h"
+
+#include <assert.h>
+#include <sstream>
+#include <thread> // std::this_thread::yield
+#include <vector>
+
+#include "common/config.h"
+#include "common/util.h"
+
+namespace covered
+{
+    const std::string BeaconServerWorkerParam::kClassName("BeaconServerWorkerParam");
+
+    BeaconServerWorkerParam::BeaconServerWorkerParam(EdgeComponentParam* edge_beacon_server_param_ptr, const uint32_t& local_beacon_server_worker_idx, const uint32_t& control_request_buffer_size) : SubthreadParamBase()
+    {
+        assert(edge_beacon_server_param_ptr != NULL);
+
+        edge_beacon_server_param_ptr_ = edge_beacon_server_param_ptr;
+        local_beacon_server_worker_idx_ = local_beacon_server_worker_idx;
+
+        // Allocate interruption-based ring buffer for control requests (ONLY one provider, i.e., edge beacon server)
+        control_request_blocking_buffer_ptr_ = new BlockingRingBuffer<CacheServerItem>(CacheServerItem(), control_request_buffer_size, BeaconServerWorkerParam::isNodeFinish_);
+        assert(control_request_blocking_buffer_ptr_ != NULL);
+        is_block_when_full_ = Config::isRingBufferBlockWhenFull(); // Overload policy of ingress control requests
+
+        dropcnt_ = 0;
+        blocked_pushcnt_ = 0;
+    }
+
+    BeaconServerWorkerParam::~BeaconServerWorkerParam()
+    {
+        // NOTE: no need to release edge_beacon_server_param_ptr_, which will be released outside BeaconServerWorkerParam (e.g., by EdgeWrapper)
+
+        assert(control_request_blocking_buffer_ptr_ != NULL);
+
+        // Dump overload statistics
+        std::ostringstream oss;
+        oss << "control request ring buffer of beacon server worker " << local_beacon_server_worker_idx_ << ": capacity: " << control_request_blocking_buffer_ptr_->getBufferSize() << "; dropcnt: " << dropcnt_ << "; blocked pushcnt: " << blocked_pushcnt_ << "; overload policy: " << (is_block_when_full_?"block":"drop");
+        Util::dumpInfoMsg(kClassName, oss.str());
+
+        // Release messages in remaining items
+        std::vector<CacheServerItem> remaining_elements;
+        control_request_blocking_buffer_ptr_->getAllToRelease(remaining_elements);
+        for (uint32_t i = 0; i < remaining_elements.size(); i++)
+        {
+            MessageBase* tmp_remaining_message_ptr = remaining_elements[i].getRequestPtr();
+            assert(tmp_remaining_message_ptr != NULL);
+            delete tmp_remaining_message_ptr;
+            tmp_remaining_message_ptr = NULL;
+        }
+
+        delete control_request_blocking_buffer_ptr_;
+        control_request_blocking_buffer_ptr_ = NULL;
+    }
+
+    EdgeComponentParam* BeaconServerWorkerParam::getEdgeBeaconServerParamPtr() const
+    {
+        assert(edge_beacon_server_param_ptr_ != NULL);
+        return edge_beacon_server_param_ptr_;
+    }
+
+    uint32_t BeaconServerWorkerParam::getLocalBeaconServerWorkerIdx() const
+    {
+        return local_beacon_server_worker_idx_;
+    }
+
+    bool BeaconServerWorkerParam::push(const CacheServerItem& beacon_server_item)
+    {
+        assert(control_request_blocking_buffer_ptr_ != NULL);
+
+        // NOTE: check free space before pushing to avoid flooding logs of BlockingRingBuffer under overload, which is safe as edge beacon server is the only provider
+        const uint32_t max_elementcnt = control_request_blocking_buffer_ptr_->getBufferSize() - 1; // NOTE: one slot is reserved to distinguish full from empty
+        bool is_full = control_request_blocking_buffer_ptr_->getElementCnt() >= max_elementcnt;
+        if (is_full && is_block_when_full_) // Backpressure: wait for the beacon server worker to free space
+        {
+            blocked_pushcnt_++;
+
+            while (is_full && !isNodeFinish_((void*)(edge_beacon_server_param_ptr_->getEdgeWrapperPtr())))
+            {
+                std::this_thread::yield();
+                is_full = control_request_blocking_buffer_ptr_->getElementCnt() >= max_elementcnt;
+            }
+        }
+
+        if (is_full)
+        {
+            if (dropcnt_ == 0) // NOTE: avoid flooding logs under overload
+            {
+                std::ostringstream oss;
+                oss << "ring buffer of beacon server worker " << local_beacon_server_worker_idx_ << " is full -> drop the control request (NOT warn for subsequent drops, which are tracked by statistics)!";
+                Util::dumpWarnMsg(kClassName, oss.str());
+            }
+            dropcnt_++;
+            return false;
+        }
+
+        bool is_successful = control_request_blocking_buffer_ptr_->push(beacon_server_item);
+        assert(is_successful); // NOTE: the beacon server worker ONLY pops items
+        return is_successful;
+    }
+
+    bool BeaconServerWorkerParam::pop(CacheServerItem& beacon_server_item)
+    {
+        assert(control_request_blocking_buffer_ptr_ != NULL);
+
+        // NOTE: BlockingRingBuffer uses edge wrapper's isNodeRunning as finish condition
+        return control_request_blocking_buffer_ptr_->pop(beacon_server_item, (void*)(edge_beacon_server_param_ptr_->getEdgeWrapperPtr()));
+    }
+
+    void BeaconServerWorkerParam::notifyFinish() const
+    {
+        assert(control_request_blocking_buffer_ptr_ != NULL);
+        control_request_blocking_buffer_ptr_->notifyFinish((void*)(edge_beacon_server_param_ptr_->getEdgeWrapperPtr()));
+        return;
+    }
+
+    bool BeaconServerWorkerParam::isNodeFinish_(void* edge_wrapper_ptr)
+    {
+        assert(edge_wrapper_ptr != NULL);
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = static_cast<EdgeWrapperBase*>(edge_wrapper_ptr);
+        const bool is_edge_finish = !tmp_edge_wrapper_ptr->isNodeRunning();
+        return is_edge_finish;
+    }
+}
@@ -0,0 +1,55 @@
+/*
+ * BeaconServerWorkerParam: parameters to launch a beacon server worker in an edge node (thread safe).
+ *
+ * NOTE: each beacon server worker owns a hash partition of beaconed keys; beacon server receives control requests and passes each of them into the ring buffer of the worker owning its key, so requests of the same key are still processed in order.
+ *
+ * NOTE: if the ring buffer is full, push() follows Config::ring_buffer_overload_policy_ the same as ring buffers of cache server workers (drop: return false to release the request, which will be resent by the sender after timeout; block: wait for free space until edge node is finished).
+ */
+
+#ifndef BEACON_SERVER_WORKER_PARAM_H
+#define BEACON_SERVER_WORKER_PARAM_H
+
+#include <string>
+
+namespace covered
+{
+    class BeaconServerWorkerParam;
+}
+
+#include "common/subthread_param_base.h"
+#include "concurrency/blocking_ring_buffer_impl.h"
+#include "edge/cache_server/cache_server_item.h"
+#include "edge/edge_component_param.h"
+
+namespace covered
+{
+    class BeaconServerWorkerParam : public SubthreadParamBase
+    {
+    public:
+        BeaconServerWorkerParam(EdgeComponentParam* edge_beacon_server_param_ptr, const uint32_t& local_beacon_server_worker_idx, const uint32_t& control_request_buffer_size);
+        ~BeaconServerWorkerParam();
+
+        EdgeComponentParam* getEdgeBeaconServerParamPtr() const;
+        uint32_t getLocalBeaconServerWorkerIdx() const;
+
+        bool push(const CacheServerItem& beacon_server_item); // Return false if the item is dropped under overload (ONLY invoked by edge beacon server)
+        bool pop(CacheServerItem& beacon_server_item); // Return false if edge node is finished
+        void notifyFinish() const;
+    private:
+        static const std::string kClassName;
+
+        // Static function for finish condition of interruption-based ring buffer
+        static bool isNodeFinish_(void* edge_wrapper_ptr);
+
+        EdgeComponentParam* edge_beacon_server_param_ptr_; // thread safe
+        uint32_t local_beacon_server_worker_idx_; // const shared variable
+        BlockingRingBuffer<CacheServerItem>* control_request_blocking_buffer_ptr_; // thread safe (NOT polling to avoid occupying one CPU core per beacon server worker)
+        bool is_block_when_full_; // const shared variable (overload policy of ingress control requests)
+
+        // Non-const variables ONLY accessed by the single provider (i.e., edge beacon server)
+        uint64_t dropcnt_;
+        uint64_t blocked_pushcnt_;
+    };
+}
+
+#endif
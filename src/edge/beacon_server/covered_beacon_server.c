@@ -15,7 +15,7 @@ namespace covered
 {
     const std::string CoveredBeaconServer::kClassName("CoveredBeaconServer");
 
-    CoveredBeaconServer::CoveredBeaconServer(EdgeComponentParam* edge_beacon_server_param_ptr) : BeaconServerBase(edge_beacon_server_param_ptr)
+    CoveredBeaconServer::CoveredBeaconServer(EdgeComponentParam* edge_beacon_server_param_ptr, BeaconServerWorkerParam* beacon_server_worker_param_ptr) : BeaconServerBase(edge_beacon_server_param_ptr, beacon_server_worker_param_ptr)
     {
         assert(edge_beacon_server_param_ptr != NULL);
         EdgeWrapperBase* tmp_edge_wrapper_ptr = edge_beacon_server_param_ptr->getEdgeWrapperPtr();
@@ -26,6 +26,10 @@ namespace covered
         // Differentiate CoveredBeaconServer in different edge nodes
         std::ostringstream oss;
         oss << kClassName << " edge" << edge_idx;
+        if (beacon_server_worker_param_ptr != NULL)
+        {
+            oss << " worker" << beacon_server_worker_param_ptr->getLocalBeaconServerWorkerIdx();
+        }
         instance_name_ = oss.str();
     }
 
@@ -263,7 +267,7 @@ namespace covered
             }
 
             // NOTE: source edge index must NOT in the extra placement edgeset, as placement edge idx of sender if any has already been removed in CoveredCacheServer::notifyBeaconForPlacementAfterHybridFetchInternal_()
-            for (std::unordered_set<uint32_t>::const_iterator extra_placement_edgeset_const_iter = extra_placement_edgeset.begin(); extra_placement_edgeset_const_iter != extra_placement_edgeset.end(); extra_placement_edgeset_const_iter++)
+            for (Edgeset::const_iterator extra_placement_edgeset_const_iter = extra_placement_edgeset.begin(); extra_placement_edgeset_const_iter != extra_placement_edgeset.end(); extra_placement_edgeset_const_iter++)
             {
                 if (source_edge_idx == *extra_placement_edgeset_const_iter)
                 {
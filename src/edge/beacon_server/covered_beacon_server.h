@@ -16,7 +16,7 @@ namespace covered
     class CoveredBeaconServer : public BeaconServerBase
     {
     public:
-        CoveredBeaconServer(EdgeComponentParam* edge_beacon_server_param_ptr);
+        CoveredBeaconServer(EdgeComponentParam* edge_beacon_server_param_ptr, BeaconServerWorkerParam* beacon_server_worker_param_ptr);
         virtual ~CoveredBeaconServer();
     private:
         static const std::string kClassName;
@@ -58,7 +58,7 @@ namespace covered
         {
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
             if (is_background) // Background admission issued by basic placement processor
@@ -122,7 +122,7 @@ namespace covered
         if (need_vtime_sync) // Vtime synchronization for BestGuess
         {
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(control_response_ptr->getSourceIndex(), bestguess_syncinfo.getVtime());
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
 
         UNUSED(is_neighbor_cached);
@@ -185,7 +185,7 @@ namespace covered
         {
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
             if (is_background) // Background eviction issued by basic placement processor
@@ -244,7 +244,7 @@ namespace covered
         if (need_vtime_sync) // Vtime synchronization for BestGuess
         {
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(control_response_ptr->getSourceIndex(), bestguess_syncinfo.getVtime());
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
 
         UNUSED(recvrsp_source_addr);
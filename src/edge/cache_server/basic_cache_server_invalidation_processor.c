@@ -51,7 +51,7 @@ namespace covered
             // Vtime synchronization
             const BestGuessSyncinfo syncinfo = best_guess_invalidation_request_ptr->getSyncinfo();
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(source_edge_idx, syncinfo.getVtime());
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
         else
         {
@@ -100,7 +100,7 @@ namespace covered
 
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
             // Prepare invalidation response
@@ -45,7 +45,7 @@ namespace covered
         const uint32_t source_edge_idx = bestguess_placement_notify_request_ptr->getSourceIndex();
         const BestGuessSyncinfo syncinfo = bestguess_placement_notify_request_ptr->getSyncinfo();
         UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(source_edge_idx, syncinfo.getVtime());
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
 
         const Key key = bestguess_placement_notify_request_ptr->getKey();
         const Value value = bestguess_placement_notify_request_ptr->getValue();
@@ -60,11 +60,12 @@ namespace covered
     {
         checkPointers_();
         EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_placement_processor_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
-        assert(tmp_edge_wrapper_ptr->getCacheName() == Util::BESTGUESS_CACHE_NAME);
+        assert(tmp_edge_wrapper_ptr->getCacheName() == Util::BESTGUESS_CACHE_NAME || tmp_edge_wrapper_ptr->getCacheServerWorkerInflightcnt() > 1);
 
         // NOTE: NO need to issue directory update requests and also no need for vtime synchronization here
         // -> (i) local placement notification from local/remote beacon server (beacon is placement) does NOT need directory update request&response and hence NO vtime synchronization (see BasicCacheServerWorker::triggerBestGuessPlacementInternal_() and BasicBeaconServer::processPlacementTriggerRequestForBestGuess_())
         // -> (ii) cache server worker (sender is placement) has finished remote directory admission with vtime synchronization after triggering placement by preserving an invalid dirinfo (see BasicCacheServerWorker::triggerBestGuessPlacementInternal_())
+        // -> (iii) EXCEPT independent admission and eviction handed over by cache server workers with in-flight requests for other baselines, which admit directory information here if needAdmitDirectory() (see CacheServerWorkerBase::admitObject_() and CacheServerWorkerBase::tryToEvictForCapacity_())
 
         bool is_finish = processLocalCacheAdmissionInternal_(local_cache_admission_item); // NOTE: will update background counter
         return is_finish;
@@ -72,7 +72,7 @@ namespace covered
         return need_lookup_beacon_directory;
     }
 
-    MessageBase* BasicCacheServerWorker::getReqToLookupBeaconDirectory_(const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const
+    MessageBase* BasicCacheServerWorker::getReqToLookupBeaconDirectory_(const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const
     {
         checkPointers_();
         EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
@@ -87,16 +87,16 @@ namespace covered
         MessageBase* directory_lookup_request_ptr = NULL;
         if (cache_name != Util::BESTGUESS_CACHE_NAME) // other baselines
         {
-            directory_lookup_request_ptr = new DirectoryLookupRequest(key, edge_idx, edge_cache_server_worker_recvrsp_source_addr_, extra_common_msghdr);
+            directory_lookup_request_ptr = new DirectoryLookupRequest(key, edge_idx, recvrsp_source_addr, extra_common_msghdr);
         }
         else // BestGuess
         {
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
-            directory_lookup_request_ptr = new BestGuessDirectoryLookupRequest(key, BestGuessSyncinfo(local_victim_vtime), edge_idx, edge_cache_server_worker_recvrsp_source_addr_, extra_common_msghdr);
+            directory_lookup_request_ptr = new BestGuessDirectoryLookupRequest(key, BestGuessSyncinfo(local_victim_vtime), edge_idx, recvrsp_source_addr, extra_common_msghdr);
         }
         assert(directory_lookup_request_ptr != NULL);
 
@@ -131,7 +131,7 @@ namespace covered
 
             // Vtime synchronization
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(source_edge_idx, syncinfo.getVtime());
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
 
         UNUSED(best_placement_edgeset);
@@ -142,7 +142,7 @@ namespace covered
         return;
     }
 
-    MessageBase* BasicCacheServerWorker::getReqToRedirectGet_(const uint32_t& dst_edge_idx_for_compression, const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const
+    MessageBase* BasicCacheServerWorker::getReqToRedirectGet_(const uint32_t& dst_edge_idx_for_compression, const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const
     {
         checkPointers_();
         EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
@@ -155,16 +155,16 @@ namespace covered
         MessageBase* redirected_get_request_ptr = NULL;
         if (cache_name != Util::BESTGUESS_CACHE_NAME) // other baselines
         {
-            redirected_get_request_ptr = new RedirectedGetRequest(key, edge_idx, edge_cache_server_worker_recvrsp_source_addr_, extra_common_msghdr);
+            redirected_get_request_ptr = new RedirectedGetRequest(key, edge_idx, recvrsp_source_addr, extra_common_msghdr);
         }
         else // BestGuess
         {
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
-            redirected_get_request_ptr = new BestGuessRedirectedGetRequest(key, BestGuessSyncinfo(local_victim_vtime), edge_idx, edge_cache_server_worker_recvrsp_source_addr_, extra_common_msghdr);
+            redirected_get_request_ptr = new BestGuessRedirectedGetRequest(key, BestGuessSyncinfo(local_victim_vtime), edge_idx, recvrsp_source_addr, extra_common_msghdr);
         }
         assert(redirected_get_request_ptr != NULL);
 
@@ -192,7 +192,7 @@ namespace covered
 
             // Vtime synchronization
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(bestguess_redirected_get_response_ptr->getSourceIndex(), syncinfo.getVtime());
-            cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr()->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr()->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
         else
         {
@@ -319,7 +319,7 @@ namespace covered
         return is_finish;
     }
 
-    MessageBase* BasicCacheServerWorker::getReqToAcquireBeaconWritelock_(const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const
+    MessageBase* BasicCacheServerWorker::getReqToAcquireBeaconWritelock_(const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const
     {
         checkPointers_();
         EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
@@ -333,16 +333,16 @@ namespace covered
         const std::string cache_name = tmp_edge_wrapper_ptr->getCacheName();
         if (cache_name != Util::BESTGUESS_CACHE_NAME) // other baselines
         {
-            acquire_writelock_request_ptr = new AcquireWritelockRequest(key, edge_idx, edge_cache_server_worker_recvrsp_source_addr_, extra_common_msghdr);
+            acquire_writelock_request_ptr = new AcquireWritelockRequest(key, edge_idx, recvrsp_source_addr, extra_common_msghdr);
         }
         else // BestGuess
         {
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
-            acquire_writelock_request_ptr = new BestGuessAcquireWritelockRequest(key, BestGuessSyncinfo(local_victim_vtime), edge_idx, edge_cache_server_worker_recvrsp_source_addr_, extra_common_msghdr);
+            acquire_writelock_request_ptr = new BestGuessAcquireWritelockRequest(key, BestGuessSyncinfo(local_victim_vtime), edge_idx, recvrsp_source_addr, extra_common_msghdr);
         }
         assert(acquire_writelock_request_ptr != NULL);
 
@@ -368,7 +368,7 @@ namespace covered
 
             // Vtime synchronization
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(bestguess_acquire_writelock_response_ptr->getSourceIndex(), syncinfo.getVtime());
-            cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr()->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr()->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
         else
         {
@@ -397,7 +397,7 @@ namespace covered
 
             // Vtime synchronization
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(bestguess_finish_block_request_ptr->getSourceIndex(), syncinfo.getVtime());
-            cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr()->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr()->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
         else
         {
@@ -436,7 +436,7 @@ namespace covered
 
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
             finish_block_response_ptr = new BestGuessFinishBlockResponse(tmp_key, BestGuessSyncinfo(local_victim_vtime), edge_idx, edge_cache_server_worker_recvreq_source_addr_, tmp_bandwidth_usage, EventList(), extra_common_msghdr); // NOTE: still use extra_common_msghdr of currently-blocked request rather than that of previous write request
@@ -501,7 +501,7 @@ namespace covered
         return is_finish;
     }
 
-    MessageBase* BasicCacheServerWorker::getReqToReleaseBeaconWritelock_(const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const
+    MessageBase* BasicCacheServerWorker::getReqToReleaseBeaconWritelock_(const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const
     {
         checkPointers_();
         EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
@@ -515,16 +515,16 @@ namespace covered
         MessageBase* release_writelock_request_ptr = NULL;
         if (cache_name != Util::BESTGUESS_CACHE_NAME) // other baselines
         {
-            release_writelock_request_ptr = new ReleaseWritelockRequest(key, edge_idx, edge_cache_server_worker_recvrsp_source_addr_, extra_common_msghdr);
+            release_writelock_request_ptr = new ReleaseWritelockRequest(key, edge_idx, recvrsp_source_addr, extra_common_msghdr);
         }
         else // BestGuess
         {
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
-            release_writelock_request_ptr = new BestGuessReleaseWritelockRequest(key, BestGuessSyncinfo(local_victim_vtime), edge_idx, edge_cache_server_worker_recvrsp_source_addr_, extra_common_msghdr);
+            release_writelock_request_ptr = new BestGuessReleaseWritelockRequest(key, BestGuessSyncinfo(local_victim_vtime), edge_idx, recvrsp_source_addr, extra_common_msghdr);
         }
         assert(release_writelock_request_ptr != NULL);
 
@@ -549,7 +549,7 @@ namespace covered
 
             // Vtime synchronization
             UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(bestguess_release_writelock_response_ptr->getSourceIndex(), syncinfo.getVtime());
-            cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr()->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+            cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr()->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
         }
         else
         {
@@ -646,7 +646,7 @@ namespace covered
 
         // Get placement edge idx with the approximate global LRU victim
         GetPlacementEdgeIdxParam tmp_param_for_placementidx;
-        tmp_edge_cache_ptr->constCustomFunc(GetPlacementEdgeIdxParam::FUNCNAME, &tmp_param_for_placementidx);
+        tmp_edge_cache_ptr->constCustomFunc(&tmp_param_for_placementidx);
         const uint32_t& placement_edge_idx = tmp_param_for_placementidx.getPlacementEdgeIdxConstRef();
         assert(placement_edge_idx < tmp_edge_wrapper_ptr->getNodeCnt());
 
@@ -673,7 +673,12 @@ namespace covered
             const bool is_neighbor_cached = false; // (i) MUST be false due to is_triggered = true (i.e., the first placement trigger for the global uncached object); (ii) is_neighbor_cached will NOT be used by BestGuess local edge cachce
             const bool is_valid = !is_being_written;
             bool is_successful = tmp_edge_wrapper_ptr->getLocalCacheAdmissionBufferPtr()->push(LocalCacheAdmissionItem(key, value, is_neighbor_cached, is_valid, extra_common_msghdr));
-            assert(is_successful);
+            if (!is_successful) // NOTE: blocking push fails ONLY if edge node is NOT running now (placement processor stops popping)
+            {
+                assert(!tmp_edge_wrapper_ptr->isNodeRunning());
+                is_finish = true;
+                return is_finish;
+            }
         }
 
         return is_finish;
@@ -700,7 +705,7 @@ namespace covered
         {
             // Get local victim vtime for vtime synchronization
             GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-            tmp_edge_cache_ptr->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+            tmp_edge_cache_ptr->constCustomFunc(&tmp_param_for_vtimesync);
             const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
             // Prepare destination address of beacon server
@@ -772,7 +777,7 @@ namespace covered
 
                     // Vtime synchronization
                     UpdateNeighborVictimVtimeParam tmp_param_for_neighborvtime(best_guess_placement_trigger_response_ptr->getSourceIndex(), best_guess_placement_trigger_response_ptr->getSyncinfo().getVtime());
-                    tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(UpdateNeighborVictimVtimeParam::FUNCNAME, &tmp_param_for_neighborvtime);
+                    tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(&tmp_param_for_neighborvtime);
 
                     // Release the control response message
                     delete control_response_ptr;
@@ -28,10 +28,10 @@ namespace covered
         virtual bool lookupLocalDirectory_(const Key& key, bool& is_being_written, bool& is_valid_directory_exist, DirectoryInfo& directory_info, Edgeset& best_placement_edgeset, bool& need_hybrid_fetching, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const override; // Return if edge node is finished
 
         virtual bool needLookupBeaconDirectory_(const Key& key, bool& is_being_written, bool& is_valid_directory_exist, DirectoryInfo& directory_info) const override;
-        virtual MessageBase* getReqToLookupBeaconDirectory_(const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const override;
+        virtual MessageBase* getReqToLookupBeaconDirectory_(const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const override;
         virtual void processRspToLookupBeaconDirectory_(MessageBase* control_response_ptr, bool& is_being_written, bool& is_valid_directory_exist, DirectoryInfo& directory_info, Edgeset& best_placement_edgeset, bool& need_hybrid_fetching, FastPathHint& fast_path_hint, const uint32_t& content_discovery_cross_edge_latency_us) const override;
         
-        virtual MessageBase* getReqToRedirectGet_(const uint32_t& dst_edge_idx_for_compression, const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const override;
+        virtual MessageBase* getReqToRedirectGet_(const uint32_t& dst_edge_idx_for_compression, const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const override;
         virtual void processRspToRedirectGet_(MessageBase* redirected_response_ptr, Value& value, Hitflag& hitflag, const uint32_t& request_redirection_cross_edge_latency_us) const override;
 
         // (1.3) Access cloud
@@ -49,7 +49,7 @@ namespace covered
         // (2.1) Acquire write lock and block for MSI protocol
 
         virtual bool acquireLocalWritelock_(const Key& key, LockResult& lock_result, DirinfoSet& all_dirinfo, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) override; // Return if edge node is finished
-        virtual MessageBase* getReqToAcquireBeaconWritelock_(const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const override;
+        virtual MessageBase* getReqToAcquireBeaconWritelock_(const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const override;
         virtual void processRspToAcquireBeaconWritelock_(MessageBase* control_response_ptr, LockResult& lock_result) const override;
 
         virtual void processReqToFinishBlock_(MessageBase* control_request_ptr) const override;
@@ -63,7 +63,7 @@ namespace covered
         // (2.4) Release write lock for MSI protocol
 
         virtual bool releaseLocalWritelock_(const Key& key, const Value& value, std::unordered_set<NetworkAddr, NetworkAddrHasher>& blocked_edges, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) override; // Return if edge node is finished
-        virtual MessageBase* getReqToReleaseBeaconWritelock_(const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const override;
+        virtual MessageBase* getReqToReleaseBeaconWritelock_(const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const override;
         virtual bool processRspToReleaseBeaconWritelock_(MessageBase* control_response_ptr, const Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const override;
 
         // (2.5) After writing value into cloud and local edge cache if any
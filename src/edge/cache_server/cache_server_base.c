@@ -25,6 +25,7 @@ namespace covered
     const bool CacheServerBase::IS_HIGH_PRIORITY_FOR_CACHE_PLACEMENT = true;
     const bool CacheServerBase::IS_HIGH_PRIORITY_FOR_METADATA_UPDATE = false;
     const bool CacheServerBase::IS_HIGH_PRIORITY_FOR_VICTIM_FETCH = false;
+    const uint32_t CacheServerBase::RECVREQ_BATCH_MAX_MSGCNT = 16; // The same as UdpPktSocket::UDP_BATCH_MAX_PKTCNT, as most requests are single-fragment messages
 
     void* CacheServerBase::launchCacheServer(void* edge_component_ptr)
     {
@@ -420,18 +421,19 @@ namespace covered
         checkPointers_();
 
         EdgeWrapperBase* tmp_edge_wrapper_ptr = edge_component_ptr_->getEdgeWrapperPtr();
+        std::vector<DynamicArray> data_request_msg_payloads(RECVREQ_BATCH_MAX_MSGCNT); // Reused across batches
         while (tmp_edge_wrapper_ptr->isNodeRunning()) // edge_running_ is set as true by default
         {
-            // Receive the message payload of data (local/redirected) requests
-            DynamicArray data_request_msg_payload;
-            bool is_timeout = edge_cache_server_recvreq_socket_server_ptr_->recv(data_request_msg_payload);
-            if (is_timeout == true) // Timeout-and-retry
+            // Receive the message payloads of data (local/redirected) requests by batched recvmmsg
+            uint32_t data_request_msgcnt = edge_cache_server_recvreq_socket_server_ptr_->recvBatch(data_request_msg_payloads, RECVREQ_BATCH_MAX_MSGCNT);
+            if (data_request_msgcnt == 0) // Timeout-and-retry
             {
                 continue; // Retry to receive a message if edge is still running
-            } // End of (is_timeout == true)
-            else
-            {                
-                MessageBase* data_request_ptr = MessageBase::getRequestFromMsgPayload(data_request_msg_payload);
+            } // End of (data_request_msgcnt == 0)
+
+            for (uint32_t i = 0; i < data_request_msgcnt; i++)
+            {
+                MessageBase* data_request_ptr = MessageBase::getRequestFromMsgPayload(data_request_msg_payloads[i]);
                 assert(data_request_ptr != NULL);
 
                 const MessageType message_type = data_request_ptr->getMessageType();
@@ -448,7 +450,7 @@ namespace covered
                     Util::dumpErrorMsg(base_instance_name_, oss.str());
                     exit(1);
                 }
-            } // End of (is_timeout == false)
+            } // End of for each received request
         } // End of while loop
 
         // Notify all processors to finish if necessary (i.e., with interruption-based ring buffer)
@@ -468,6 +470,8 @@ namespace covered
         EdgeWrapperBase* tmp_edge_wrapper_ptr = edge_component_ptr_->getEdgeWrapperPtr();
         const uint32_t percacheserver_workercnt = tmp_edge_wrapper_ptr->getPercacheserverWorkercnt();
 
+        bool is_successful = false;
+
         if (data_requeset_ptr->isLocalDataRequest()) // Local data requests
         {
             // Calculate the corresponding cache server worker index by hashing
@@ -478,43 +482,37 @@ namespace covered
 
             // Pass cache server item into ring buffer of the corresponding cache server worker
             CacheServerItem tmp_cache_server_item(data_requeset_ptr);
-            bool is_successful = cache_server_worker_params_[local_cache_server_worker_idx].getDataRequestBufferPtr()->push(tmp_cache_server_item);
-            assert(is_successful == true); // Ring buffer must NOT be full
+            is_successful = cache_server_worker_params_[local_cache_server_worker_idx].getDataRequestBufferPtr()->push(tmp_cache_server_item);
         }
         else if (data_requeset_ptr->isRedirectedDataRequest()) // Redirected data requests
         {
             // Pass cache server item into ring buffer of the cache server redirection processor
             CacheServerItem tmp_cache_server_item(data_requeset_ptr);
-            bool is_successful = cache_server_redirection_processor_param_ptr_->push(tmp_cache_server_item);
-            assert(is_successful == true); // Ring buffer must NOT be full
+            is_successful = cache_server_redirection_processor_param_ptr_->push(tmp_cache_server_item);
         }
         else if (data_requeset_ptr->getMessageType() == MessageType::kCoveredVictimFetchRequest) // Lazy victim fetching
         {
             // Pass cache server item into ring buffer of the cache server victim fetch processor
             CacheServerItem tmp_cache_server_item(data_requeset_ptr);
-            bool is_successful = cache_server_victim_fetch_processor_param_ptr_->push(tmp_cache_server_item);
-            assert(is_successful == true); // Ring buffer must NOT be full
+            is_successful = cache_server_victim_fetch_processor_param_ptr_->push(tmp_cache_server_item);
         }
         else if (data_requeset_ptr->getMessageType() == MessageType::kCoveredBgplacePlacementNotifyRequest || data_requeset_ptr->getMessageType() == MessageType::kBestGuessBgplacePlacementNotifyRequest) // Placement notification
         {
             // Pass cache server item into ring buffer of the cache server placement processor
             CacheServerItem tmp_cache_server_item(data_requeset_ptr);
-            bool is_successful = cache_server_placement_processor_param_ptr_->push(tmp_cache_server_item);
-            assert(is_successful == true); // Ring buffer must NOT be full
+            is_successful = cache_server_placement_processor_param_ptr_->push(tmp_cache_server_item);
         }
         else if (data_requeset_ptr->getMessageType() == MessageType::kCoveredMetadataUpdateRequest) // Beacon-based cached metadata update
         {
             // Pass cache server item into ring buffer of the cache server metadata update processor
             CacheServerItem tmp_cache_server_item(data_requeset_ptr);
-            bool is_successful = cache_server_metadata_update_processor_param_ptr_->push(tmp_cache_server_item);
-            assert(is_successful == true); // Ring buffer must NOT be full
+            is_successful = cache_server_metadata_update_processor_param_ptr_->push(tmp_cache_server_item);
         }
         else if (data_requeset_ptr->getMessageType() == MessageType::kInvalidationRequest || data_requeset_ptr->getMessageType() == MessageType::kCoveredInvalidationRequest || data_requeset_ptr->getMessageType() == MessageType::kBestGuessInvalidationRequest) // Cache invalidation for MSI protocol
         {
             // Pass cache server item into ring buffer of the cache server invalidation processor
             CacheServerItem tmp_cache_server_item(data_requeset_ptr);
-            bool is_successful = cache_server_invalidation_processor_param_ptr_->push(tmp_cache_server_item);
-            assert(is_successful == true); // Ring buffer must NOT be full
+            is_successful = cache_server_invalidation_processor_param_ptr_->push(tmp_cache_server_item);
         }
         else
         {
@@ -524,6 +522,13 @@ namespace covered
             exit(1);
         }
 
+        if (!is_successful) // Ring buffer is full under overload (see Config::ring_buffer_overload_policy_)
+        {
+            // NOTE: drop the request, which has been counted by the ring buffer and will be resent by the sender after timeout
+            delete data_requeset_ptr;
+            data_requeset_ptr = NULL;
+        }
+
         return;
     }
 
@@ -667,7 +672,7 @@ namespace covered
         checkPointers_();
 
         // Acquire a write lock for atomicity of eviction among different edge cache server workers
-        std::string context_name = "CacheServerBase::evictForCapacity_()";
+        const char* context_name = "CacheServerBase::evictForCapacity_()";
         rwlock_for_eviction_ptr_->acquire_lock(context_name);
 
         bool is_finish = false;
@@ -75,6 +75,7 @@ namespace covered
         static const bool IS_HIGH_PRIORITY_FOR_CACHE_PLACEMENT;
         static const bool IS_HIGH_PRIORITY_FOR_METADATA_UPDATE;
         static const bool IS_HIGH_PRIORITY_FOR_VICTIM_FETCH;
+        static const uint32_t RECVREQ_BATCH_MAX_MSGCNT; // Max # of requests received by each batched receiving
 
         static const std::string kClassName;
 
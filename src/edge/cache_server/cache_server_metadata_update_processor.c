@@ -125,7 +125,7 @@ namespace covered
         // Update is_neighbor_cached flag in local cached metadata
         const bool is_neighbor_cached = covered_metadata_update_request_ptr->isNeighborCached();
         UpdateIsNeighborCachedFlagFuncParam tmp_param(tmp_key, is_neighbor_cached);
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(UpdateIsNeighborCachedFlagFuncParam::FUNCNAME, &tmp_param);
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->customFunc(&tmp_param);
 
         struct timespec metadata_update_end_timestamp = Util::getCurrentTimespec();
         uint32_t metadata_update_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(metadata_update_end_timestamp, metadata_update_start_timestamp));
@@ -200,17 +200,46 @@ namespace covered
 
         struct timespec admission_start_timestamp = Util::getCurrentTimespec();
 
-        // Admit into local edge cache for the received local cache admission decision
         const Key tmp_key = local_cache_admission_item.getKey();
-        const Value tmp_value = local_cache_admission_item.getValue();
-        const bool is_neighbor_cached = local_cache_admission_item.isNeighborCached();
-        const bool is_valid = local_cache_admission_item.isValid();
-        const uint64_t unused_miss_latency_us = 0; // ONLY used for LA-Cache, while here is BestGuess or COVERED
-        tmp_cache_server_ptr->admitLocalEdgeCache_(tmp_key, tmp_value, is_neighbor_cached, is_valid, unused_miss_latency_us); // May update local synced victims
+        const ExtraCommonMsghdr extra_common_msghdr = local_cache_admission_item.getExtraCommonMsghdr();
+        if (!local_cache_admission_item.isEvictionOnly()) // NOTE: eviction-only items come from cache server workers with in-flight requests after updating local cached objects
+        {
+            const Value tmp_value = local_cache_admission_item.getValue();
+            bool is_neighbor_cached = local_cache_admission_item.isNeighborCached();
+            bool is_valid = local_cache_admission_item.isValid();
+
+            // Admit local/remote beacon directory for independent admission handed over by cache server workers with in-flight requests
+            // NOTE: we cannot optimistically admit valid object into local edge cache first before directory admission, as clients may get incorrect value if key is being written
+            if (local_cache_admission_item.needAdmitDirectory())
+            {
+                bool is_being_written = false;
+                const DirectoryInfo directory_info(tmp_edge_wrapper_ptr->getNodeIdx());
+                if (tmp_edge_wrapper_ptr->currentIsBeacon(tmp_key))
+                {
+                    tmp_edge_wrapper_ptr->admitLocalDirectory_(tmp_key, directory_info, is_being_written, is_neighbor_cached, extra_common_msghdr);
+                }
+                else
+                {
+                    is_finish = tmp_cache_server_ptr->admitBeaconDirectory_(tmp_key, directory_info, is_being_written, is_neighbor_cached, edge_cache_server_placement_processor_recvrsp_source_addr_, edge_cache_server_placement_processor_recvrsp_socket_server_ptr_, total_bandwidth_usage, event_list, extra_common_msghdr, is_background);
+                    if (is_finish)
+                    {
+                        return is_finish;
+                    }
+                }
+
+                if (is_being_written) // Double-check is_being_written to update is_valid if necessary
+                {
+                    is_valid = false;
+                }
+            }
+
+            // Admit into local edge cache for the received local cache admission decision
+            const uint64_t miss_latency_us = local_cache_admission_item.getMissLatencyUs(); // ONLY used for LA-Cache (always 0 for BestGuess and COVERED)
+            tmp_cache_server_ptr->admitLocalEdgeCache_(tmp_key, tmp_value, is_neighbor_cached, is_valid, miss_latency_us); // May update local synced victims
+        }
 
         // Perform background cache eviction in a blocking manner for consistent directory information (note that cache eviction happens after non-blocking placement notification)
         // NOTE: we update aggregated uncached popularity yet DISABLE recursive cache placement for metadata preservation during cache eviction
-        const ExtraCommonMsghdr extra_common_msghdr = local_cache_admission_item.getExtraCommonMsghdr();
         is_finish = tmp_cache_server_ptr->evictForCapacity_(tmp_key, edge_cache_server_placement_processor_recvrsp_source_addr_, edge_cache_server_placement_processor_recvrsp_socket_server_ptr_, total_bandwidth_usage, event_list, extra_common_msghdr, is_background); // May update local synced victims
 
         struct timespec admission_end_timestamp = Util::getCurrentTimespec();
@@ -1,5 +1,6 @@
 #include "edge/cache_server/cache_server_processor_param.h"
 
+#include "common/config.h"
 #include "common/util.h"
 
 namespace covered
@@ -25,7 +26,8 @@ namespace covered
         {
             // Allocate polling-based ring buffer for data/control requests
             const bool with_multi_providers = false; // ONLY one provider (i.e., edge cache server) for data/control requests
-            cache_server_item_buffer_ptr_ = new RingBuffer<CacheServerItem>(CacheServerItem(), data_request_buffer_size, with_multi_providers);
+            const bool is_block_when_full = Config::isRingBufferBlockWhenFull(); // Overload policy of ingress data/control requests
+            cache_server_item_buffer_ptr_ = new RingBuffer<CacheServerItem>(CacheServerItem(), data_request_buffer_size, with_multi_providers, is_block_when_full);
             assert(cache_server_item_buffer_ptr_ != NULL);
         }
         else
@@ -44,6 +46,9 @@ namespace covered
         {
             assert(cache_server_item_blocking_buffer_ptr_ == NULL);
 
+            // Dump queue-depth statistics
+            Util::dumpInfoMsg(kClassName, "polling-based ring buffer: " + cache_server_item_buffer_ptr_->getStatisticsStr());
+
             // Release messages in remaining cache server items
             std::vector<CacheServerItem> remaining_elements;
             cache_server_item_buffer_ptr_->getAllToRelease(remaining_elements);
@@ -105,7 +110,7 @@ namespace covered
                 const bool other_with_multi_providers = other.cache_server_item_buffer_ptr_->withMultiProviders();
                 assert(!other_with_multi_providers); // ONLY one provider (i.e., edge cache server) for data/control requests
 
-                cache_server_item_buffer_ptr_ = new RingBuffer<CacheServerItem>(other.cache_server_item_buffer_ptr_->getDefaultElement(), other.cache_server_item_buffer_ptr_->getBufferSize(), other_with_multi_providers);
+                cache_server_item_buffer_ptr_ = new RingBuffer<CacheServerItem>(other.cache_server_item_buffer_ptr_->getDefaultElement(), other.cache_server_item_buffer_ptr_->getBufferSize(), other_with_multi_providers, other.cache_server_item_buffer_ptr_->isBlockWhenFull());
                 assert(cache_server_item_buffer_ptr_ != NULL);
 
                 *cache_server_item_buffer_ptr_ = *(other.cache_server_item_buffer_ptr_);
@@ -1,6 +1,9 @@
 #include "edge/cache_server/cache_server_worker_base.h"
 
+#include <algorithm> // std::min
 #include <assert.h>
+#include <errno.h> // errno
+#include <poll.h> // ppoll
 
 #include "cache/covered_cache_custom_func_param.h"
 #include "common/bandwidth_usage.h"
@@ -15,183 +18,1663 @@
 #include "message/data_message.h"
 #include "network/network_addr.h"
 #include "network/propagation_simulator.h"
+#include "network/udp_pkt_socket.h"
 
 namespace covered
 {
     const std::string CacheServerWorkerBase::kClassName("CacheServerWorkerBase");
 
+    const uint32_t CacheServerWorkerBase::ASYNC_IDLE_WAIT_US = 100; // 100us
+
     void* CacheServerWorkerBase::launchCacheServerWorker(void* cache_server_worker_param_ptr)
     {
         assert(cache_server_worker_param_ptr != NULL);
 
-        CacheServerWorkerBase* cache_server_worker_ptr = getCacheServerWorkerByCacheName_((CacheServerWorkerParam*)cache_server_worker_param_ptr);
-        assert(cache_server_worker_ptr != NULL);
-        cache_server_worker_ptr->start();
+        CacheServerWorkerBase* cache_server_worker_ptr = getCacheServerWorkerByCacheName_((CacheServerWorkerParam*)cache_server_worker_param_ptr);
+        assert(cache_server_worker_ptr != NULL);
+        cache_server_worker_ptr->start();
+
+        assert(cache_server_worker_ptr != NULL);
+        delete cache_server_worker_ptr;
+        cache_server_worker_ptr = NULL;
+
+        pthread_exit(NULL);
+        return NULL;
+    }
+
+    CacheServerWorkerBase* CacheServerWorkerBase::getCacheServerWorkerByCacheName_(CacheServerWorkerParam* cache_server_worker_param_ptr)
+    {
+        CacheServerWorkerBase* cache_server_worker_ptr = NULL;
+
+        assert(cache_server_worker_param_ptr != NULL);
+        std::string cache_name = cache_server_worker_param_ptr->getCacheServerPtr()->getEdgeWrapperPtr()->getCacheName();
+        if (cache_name == Util::COVERED_CACHE_NAME)
+        {
+            cache_server_worker_ptr = new CoveredCacheServerWorker(cache_server_worker_param_ptr);
+        }
+        else
+        {
+            cache_server_worker_ptr = new BasicCacheServerWorker(cache_server_worker_param_ptr);
+        }
+
+        assert(cache_server_worker_ptr != NULL);
+        return cache_server_worker_ptr;
+    }
+
+    CacheServerWorkerBase::CacheServerWorkerBase(CacheServerWorkerParam* cache_server_worker_param_ptr) : inflight_cnt_(0), cache_server_worker_param_ptr_(cache_server_worker_param_ptr)
+    {
+        assert(cache_server_worker_param_ptr != NULL);
+        const uint32_t edge_idx = cache_server_worker_param_ptr->getCacheServerPtr()->getEdgeWrapperPtr()->getNodeIdx();
+        const uint32_t edgecnt = cache_server_worker_param_ptr->getCacheServerPtr()->getEdgeWrapperPtr()->getNodeCnt();
+        const uint32_t local_cache_server_worker_idx = cache_server_worker_param_ptr->getLocalCacheServerWorkerIdx();
+        const uint32_t percacheserver_workercnt = cache_server_worker_param_ptr->getCacheServerPtr()->getEdgeWrapperPtr()->getPercacheserverWorkercnt();
+        const uint32_t cache_server_worker_inflightcnt = cache_server_worker_param_ptr->getCacheServerPtr()->getEdgeWrapperPtr()->getCacheServerWorkerInflightcnt();
+
+        // Differentiate cache servers of different edge nodes
+        std::ostringstream oss;
+        oss << kClassName << " edge" << edge_idx << "-worker" << cache_server_worker_param_ptr->getLocalCacheServerWorkerIdx();
+        base_instance_name_ = oss.str();
+
+        // Prepare destination address to the corresponding cloud
+        const bool is_private_cloud_ipstr = false; // NOTE: edge communicates with cloud via public IP address
+        const bool is_launch_cloud = false; // Just connect cloud by the logical edge node instead of launching the cloud
+        std::string cloud_ipstr = Config::getCloudIpstr(is_private_cloud_ipstr, is_launch_cloud);
+        uint16_t cloud_recvreq_port = Util::getCloudRecvreqPort(0); // TODO: only support 1 cloud node now!
+        corresponding_cloud_recvreq_dst_addr_ = NetworkAddr(cloud_ipstr, cloud_recvreq_port);
+
+        // For receiving control responses and redirected data responses
+
+        // Get source address of cache server worker to receive control responses and redirected data responses
+        const bool is_private_edge_ipstr = false; // NOTE: cross-edge and edge-cloud communication for control messages, request redirection, and global data messages use public IP address
+        const bool is_launch_edge = true; // The edge cache server worker belongs to the logical edge node launched in the current physical machine
+        std::string edge_ipstr = Config::getEdgeIpstr(edge_idx, edgecnt, is_private_edge_ipstr, is_launch_edge);
+        uint16_t edge_cache_server_worker_recvrsp_port = Util::getEdgeCacheServerWorkerRecvrspPort(edge_idx, edgecnt, local_cache_server_worker_idx, percacheserver_workercnt);
+        edge_cache_server_worker_recvrsp_source_addr_ = NetworkAddr(edge_ipstr, edge_cache_server_worker_recvrsp_port);
+
+        // Prepare a socket server to receive control responses and redirected data responses
+        NetworkAddr recvrsp_host_addr(Util::ANY_IPSTR, edge_cache_server_worker_recvrsp_port);
+        edge_cache_server_worker_recvrsp_socket_server_ptr_ = new UdpMsgSocketServer(recvrsp_host_addr);
+        assert(edge_cache_server_worker_recvrsp_socket_server_ptr_ != NULL);
+
+        // For receiving responses of multiplexed in-flight requests
+
+        edge_cache_server_worker_async_recvrsp_socket_server_ptr_ = NULL;
+        if (cache_server_worker_inflightcnt > 1)
+        {
+            // Get source address of cache server worker to receive responses of in-flight requests
+            uint16_t edge_cache_server_worker_async_recvrsp_port = Util::getEdgeCacheServerWorkerAsyncRecvrspPort(edge_idx, edgecnt, local_cache_server_worker_idx, percacheserver_workercnt);
+            edge_cache_server_worker_async_recvrsp_source_addr_ = NetworkAddr(edge_ipstr, edge_cache_server_worker_async_recvrsp_port);
+
+            // Prepare a socket server to receive responses of in-flight requests
+            NetworkAddr async_recvrsp_host_addr(Util::ANY_IPSTR, edge_cache_server_worker_async_recvrsp_port);
+            edge_cache_server_worker_async_recvrsp_socket_server_ptr_ = new UdpMsgSocketServer(async_recvrsp_host_addr);
+            assert(edge_cache_server_worker_async_recvrsp_socket_server_ptr_ != NULL);
+        }
+
+        // For receiving finish block requests
+
+        // Get source address of cache server worker to receive finish block requests
+        uint16_t edge_cache_server_worker_recvreq_port = Util::getEdgeCacheServerWorkerRecvreqPort(edge_idx, edgecnt, local_cache_server_worker_idx, percacheserver_workercnt);
+        edge_cache_server_worker_recvreq_source_addr_ = NetworkAddr(edge_ipstr, edge_cache_server_worker_recvreq_port);
+
+        // Prepare a socket server to receive finish block requests
+        NetworkAddr recvreq_host_addr(Util::ANY_IPSTR, edge_cache_server_worker_recvreq_port);
+        edge_cache_server_worker_recvreq_socket_server_ptr_ = new UdpMsgSocketServer(recvreq_host_addr);
+        assert(edge_cache_server_worker_recvreq_socket_server_ptr_ != NULL);
+    }
+
+    CacheServerWorkerBase::~CacheServerWorkerBase()
+    {
+        // NOTE: no need to release cache_server_worker_param_ptr_, which will be released outside CacheServerWorkerBase (by CacheServer)
+
+        // Release the socket server to receive control responses, redirected data responses, and global responses
+        assert(edge_cache_server_worker_recvrsp_socket_server_ptr_ != NULL);
+        delete edge_cache_server_worker_recvrsp_socket_server_ptr_;
+        edge_cache_server_worker_recvrsp_socket_server_ptr_ = NULL;
+
+        // Release the socket server to receive responses of in-flight requests if any
+        if (edge_cache_server_worker_async_recvrsp_socket_server_ptr_ != NULL)
+        {
+            delete edge_cache_server_worker_async_recvrsp_socket_server_ptr_;
+            edge_cache_server_worker_async_recvrsp_socket_server_ptr_ = NULL;
+        }
+
+        // Release the socket server to receive finish block requests
+        assert(edge_cache_server_worker_recvreq_socket_server_ptr_ != NULL);
+        delete edge_cache_server_worker_recvreq_socket_server_ptr_;
+        edge_cache_server_worker_recvreq_socket_server_ptr_ = NULL;
+    }
+
+    void CacheServerWorkerBase::start()
+    {
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        // Notify edge cache server that the current edge cache server worker has finished initialization
+        cache_server_worker_param_ptr_->markFinishInitialization();
+
+        if (tmp_edge_wrapper_ptr->getCacheServerWorkerInflightcnt() > 1)
+        {
+            startAsync_(); // Multiplex in-flight local requests
+            return;
+        }
+
+        bool is_finish = false; // Mark if edge node is finished
+        while (tmp_edge_wrapper_ptr->isNodeRunning()) // edge_running_ is set as true by default
+        {
+            // Try to get the data request from ring buffer partitioned by cache server
+            CacheServerItem tmp_cache_server_item;
+            bool is_successful = cache_server_worker_param_ptr_->getDataRequestBufferPtr()->pop(tmp_cache_server_item);
+            if (!is_successful)
+            {
+                continue; // Retry to receive an item if edge is still running
+            } // End of (is_successful == true)
+            else
+            {
+                MessageBase* data_request_ptr = tmp_cache_server_item.getRequestPtr();
+                assert(data_request_ptr != NULL);
+
+                if (data_request_ptr->isLocalDataRequest()) // Local data requests (note that redirected data requests will be processed by cache server redirection processor)
+                {
+                    NetworkAddr recvrsp_dst_addr = data_request_ptr->getSourceAddr(); // client worker or cache server worker
+                    is_finish = processLocalDataRequest_(data_request_ptr, recvrsp_dst_addr);
+                }
+                else
+                {
+                    std::ostringstream oss;
+                    oss << "invalid message type " << MessageBase::messageTypeToString(data_request_ptr->getMessageType()) << " for start()!";
+                    Util::dumpErrorMsg(base_instance_name_, oss.str());
+                    exit(1);
+                }
+
+                // Release data request by the corresponding cache server worker thread
+                assert(data_request_ptr != NULL);
+                delete data_request_ptr;
+                data_request_ptr = NULL;
+
+                if (is_finish) // Check is_finish
+                {
+                    continue; // Go to check if edge is still running
+                }
+            } // End of (is_successful == false)
+        } // End of while loop
+
+        return;
+    }
+
+    bool CacheServerWorkerBase::processLocalDataRequest_(MessageBase* data_request_ptr, const NetworkAddr& recvrsp_dst_addr)
+    {
+        assert(data_request_ptr != NULL && data_request_ptr->isLocalDataRequest());
+        assert(recvrsp_dst_addr.isValidAddr());
+
+        bool is_finish = false; // Mark if edge node is finished
+
+        const MessageType message_type = data_request_ptr->getMessageType();
+        if (message_type == MessageType::kLocalGetRequest)
+        {
+            is_finish = processLocalGetRequest_(data_request_ptr, recvrsp_dst_addr);
+        }
+        else if (message_type == MessageType::kLocalPutRequest || data_request_ptr->getMessageType() == MessageType::kLocalDelRequest) // Local put/del request
+        {
+            is_finish = processLocalWriteRequest_(data_request_ptr, recvrsp_dst_addr);
+        }
+        else
+        {
+            std::ostringstream oss;
+            oss << "invalid message type " << MessageBase::messageTypeToString(message_type) << " for processLocalDataRequest_()!";
+            Util::dumpErrorMsg(base_instance_name_, oss.str());
+            exit(1);
+        }
+        
+        return is_finish;
+    }
+
+    // (0) Multiplexed in-flight requests
+
+    std::string CacheServerWorkerBase::inflightStageToString_(const InflightStage& stage)
+    {
+        std::string stage_str = "";
+        switch (stage)
+        {
+            case InflightStage::kInflightWaitForDirectoryLookup:
+            {
+                stage_str = "DirectoryLookupResponse";
+                break;
+            }
+            case InflightStage::kInflightWaitForRedirectedGet:
+            {
+                stage_str = "RedirectedGetResponse";
+                break;
+            }
+            case InflightStage::kInflightWaitForGlobalGet:
+            {
+                stage_str = "GlobalGetResponse";
+                break;
+            }
+            case InflightStage::kInflightWaitForAcquireWritelock:
+            {
+                stage_str = "AcquireWritelockResponse";
+                break;
+            }
+            case InflightStage::kInflightWaitForGlobalWrite:
+            {
+                stage_str = "GlobalPutResponse/GlobalDelResponse";
+                break;
+            }
+            case InflightStage::kInflightWaitForInvalidation:
+            {
+                stage_str = "InvalidationResponse";
+                break;
+            }
+            case InflightStage::kInflightWaitForReleaseWritelock:
+            {
+                stage_str = "ReleaseWritelockResponse";
+                break;
+            }
+            case InflightStage::kInflightWaitForNotifyFinishBlock:
+            {
+                stage_str = "FinishBlockResponse";
+                break;
+            }
+            case InflightStage::kInflightWaitForFinishBlock:
+            {
+                stage_str = "FinishBlockRequest";
+                break;
+            }
+            case InflightStage::kInflightWaitForLocalRetry:
+            {
+                stage_str = "LocalRetry";
+                break;
+            }
+            case InflightStage::kInflightWaitForIssue:
+            {
+                stage_str = "Issue";
+                break;
+            }
+            default:
+            {
+                stage_str = std::to_string(static_cast<uint32_t>(stage));
+                break;
+            }
+        }
+        return stage_str;
+    }
+
+    void CacheServerWorkerBase::startAsync_()
+    {
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+        const uint32_t cache_server_worker_inflightcnt = tmp_edge_wrapper_ptr->getCacheServerWorkerInflightcnt();
+        assert(cache_server_worker_inflightcnt > 1);
+        assert(edge_cache_server_worker_async_recvrsp_socket_server_ptr_ != NULL);
+
+        prev_timeout_check_timestamp_ = Util::getCurrentTimespec();
+
+        bool is_finish = false; // Mark if edge node is finished
+        while (tmp_edge_wrapper_ptr->isNodeRunning()) // edge_running_ is set as true by default
+        {
+            bool is_idle = true; // Mark if no local request, response, or FinishBlockRequest is processed in the current round
+
+            // (1) Admit local requests from ring buffer partitioned by cache server if with free in-flight slots
+            while (inflight_cnt_ < cache_server_worker_inflightcnt)
+            {
+                CacheServerItem tmp_cache_server_item;
+                bool is_successful = cache_server_worker_param_ptr_->getDataRequestBufferPtr()->pop(tmp_cache_server_item);
+                if (!is_successful)
+                {
+                    break; // No more local requests now
+                }
+
+                is_idle = false;
+
+                MessageBase* data_request_ptr = tmp_cache_server_item.getRequestPtr();
+                assert(data_request_ptr != NULL);
+                if (!data_request_ptr->isLocalDataRequest()) // NOTE: redirected data requests will be processed by cache server redirection processor
+                {
+                    std::ostringstream oss;
+                    oss << "invalid message type " << MessageBase::messageTypeToString(data_request_ptr->getMessageType()) << " for startAsync_()!";
+                    Util::dumpErrorMsg(base_instance_name_, oss.str());
+                    exit(1);
+                }
+
+                // NOTE: data_request_ptr will be released after the in-flight request is completed
+                is_finish = admitInflightRequest_(data_request_ptr);
+                if (is_finish)
+                {
+                    break; // Edge is NOT running
+                }
+            }
+
+            // (2) Receive responses of in-flight requests
+            while (!is_finish)
+            {
+                DynamicArray response_msg_payload;
+                const bool is_nonblocking = true;
+                bool is_timeout = edge_cache_server_worker_async_recvrsp_socket_server_ptr_->recv(response_msg_payload, is_nonblocking);
+                if (is_timeout)
+                {
+                    break; // No more responses now
+                }
+                is_idle = false;
+
+                MessageBase* response_ptr = MessageBase::getResponseFromMsgPayload(response_msg_payload);
+                assert(response_ptr != NULL);
+
+                is_finish = processInflightResponse_(response_ptr);
+
+                // Release the response message
+                delete response_ptr;
+                response_ptr = NULL;
+            }
+
+            // (3) Receive finish block requests for in-flight requests blocked by writes
+            while (!is_finish)
+            {
+                DynamicArray control_request_msg_payload;
+                const bool is_nonblocking = true;
+                bool is_timeout = edge_cache_server_worker_recvreq_socket_server_ptr_->recv(control_request_msg_payload, is_nonblocking);
+                if (is_timeout)
+                {
+                    break; // No more requests now
+                }
+                is_idle = false;
+
+                MessageBase* control_request_ptr = MessageBase::getRequestFromMsgPayload(control_request_msg_payload);
+                assert(control_request_ptr != NULL);
+
+                is_finish = processInflightFinishBlockRequest_(control_request_ptr);
+
+                // Release the control request message
+                delete control_request_ptr;
+                control_request_ptr = NULL;
+            }
+
+            // (4) Retry in-flight requests waiting for local beacon (polling)
+            if (!is_finish && !local_retry_list_.empty())
+            {
+                std::list<InflightRequest*> tmp_local_retry_list;
+                tmp_local_retry_list.swap(local_retry_list_); // NOTE: retried requests may be pushed into local_retry_list_ again
+                for (std::list<InflightRequest*>::iterator iter = tmp_local_retry_list.begin(); iter != tmp_local_retry_list.end(); iter++)
+                {
+                    is_finish = retryInflightRequest_(*iter);
+                    if (is_finish)
+                    {
+                        break; // Edge is NOT running (NOTE: all in-flight requests will be released by releaseAllInflightRequests_())
+                    }
+                }
+            }
+
+            if (is_finish)
+            {
+                break; // Edge is NOT running
+            }
+
+            // (5) Resend requests of in-flight requests if timeout
+            resendTimeoutInflightRequests_();
+
+            // (6) Wait for subsequent events instead of busy polling the non-blocking sockets if idle
+            if (is_idle)
+            {
+                waitForInflightEvents_();
+            }
+        } // End of while loop
+
+        releaseAllInflightRequests_();
+
+        return;
+    }
+
+    bool CacheServerWorkerBase::admitInflightRequest_(MessageBase* local_request_ptr)
+    {
+        assert(local_request_ptr != NULL && local_request_ptr->isLocalDataRequest());
+
+        InflightRequest* inflight_request_ptr = new InflightRequest();
+        assert(inflight_request_ptr != NULL);
+        inflight_request_ptr->local_request_ptr = local_request_ptr;
+        inflight_request_ptr->recvrsp_dst_addr = local_request_ptr->getSourceAddr(); // client worker or cache server worker
+        assert(inflight_request_ptr->recvrsp_dst_addr.isValidAddr());
+        inflight_request_ptr->key = MessageBase::getKeyFromMessage(local_request_ptr);
+        inflight_request_ptr->message_type = local_request_ptr->getMessageType();
+        inflight_request_ptr->extra_common_msghdr = local_request_ptr->getExtraCommonMsghdr();
+        inflight_request_ptr->stage = InflightStage::kInflightWaitForIssue;
+        inflight_cnt_++;
+
+        // Serialize local requests of the same key in FIFO order (the same as the blocking mode)
+        std::list<InflightRequest*>& tmp_inflight_list = key_inflight_map_[inflight_request_ptr->key];
+        tmp_inflight_list.push_back(inflight_request_ptr);
+        if (tmp_inflight_list.size() > 1)
+        {
+            return false; // Deferred until previous in-flight requests of the same key are completed
+        }
+
+        return startInflightRequest_(inflight_request_ptr);
+    }
+
+    bool CacheServerWorkerBase::startInflightRequest_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+        assert(inflight_request_ptr->stage == InflightStage::kInflightWaitForIssue);
+
+        bool is_finish = false; // Mark if edge node is finished
+
+        const MessageType message_type = inflight_request_ptr->message_type;
+        if (message_type == MessageType::kLocalGetRequest)
+        {
+            is_finish = startInflightGet_(inflight_request_ptr);
+        }
+        else if (message_type == MessageType::kLocalPutRequest || message_type == MessageType::kLocalDelRequest) // Local put/del request
+        {
+            is_finish = startInflightWrite_(inflight_request_ptr);
+        }
+        else
+        {
+            std::ostringstream oss;
+            oss << "invalid message type " << MessageBase::messageTypeToString(message_type) << " for startInflightRequest_()!";
+            Util::dumpErrorMsg(base_instance_name_, oss.str());
+            exit(1);
+        }
+
+        return is_finish;
+    }
+
+    bool CacheServerWorkerBase::completeInflightRequest_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+
+        std::unordered_map<Key, std::list<InflightRequest*>, KeyHasher>::iterator key_inflight_map_iter = key_inflight_map_.find(inflight_request_ptr->key);
+        assert(key_inflight_map_iter != key_inflight_map_.end());
+        assert(key_inflight_map_iter->second.front() == inflight_request_ptr);
+        key_inflight_map_iter->second.pop_front();
+        early_finish_block_keyset_.erase(inflight_request_ptr->key); // NOTE: FinishBlockRequest arriving early for the completed request is useless for the next request of the same key
+
+        // Release the local request and its context
+        assert(inflight_request_ptr->local_request_ptr != NULL);
+        delete inflight_request_ptr->local_request_ptr;
+        inflight_request_ptr->local_request_ptr = NULL;
+        delete inflight_request_ptr;
+        inflight_request_ptr = NULL;
+        assert(inflight_cnt_ > 0);
+        inflight_cnt_--;
+
+        bool is_finish = false; // Mark if edge node is finished
+
+        if (key_inflight_map_iter->second.empty())
+        {
+            key_inflight_map_.erase(key_inflight_map_iter);
+        }
+        else // Start the next deferred request of the same key
+        {
+            InflightRequest* next_inflight_request_ptr = key_inflight_map_iter->second.front();
+            is_finish = startInflightRequest_(next_inflight_request_ptr); // NOTE: key_inflight_map_iter may be invalid after starting the next request
+        }
+
+        return is_finish;
+    }
+
+    void CacheServerWorkerBase::issueInflightRemoteRequest_(InflightRequest* inflight_request_ptr, const InflightStage& stage)
+    {
+        assert(inflight_request_ptr != NULL);
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        inflight_request_ptr->stage = stage;
+        inflight_request_ptr->cur_msg_seqnum = tmp_edge_wrapper_ptr->getAndIncrNodeMsgSeqnum(); // NOTE: use edge-assigned seqnum instead of client-assigned seqnum
+        inflight_request_ptr->issue_req_start_timestamp = Util::getCurrentTimespec(); // Count timeout
+
+        bool is_successful = seqnum_inflight_map_.insert(std::pair<uint64_t, InflightRequest*>(inflight_request_ptr->cur_msg_seqnum, inflight_request_ptr)).second;
+        assert(is_successful);
+        UNUSED(is_successful);
+
+        sendInflightRemoteRequest_(inflight_request_ptr);
+        return;
+    }
+
+    void CacheServerWorkerBase::sendInflightRemoteRequest_(InflightRequest* inflight_request_ptr) const
+    {
+        assert(inflight_request_ptr != NULL);
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        const Key& tmp_key = inflight_request_ptr->key;
+        const ExtraCommonMsghdr tmp_extra_common_msghdr(inflight_request_ptr->extra_common_msghdr.isSkipPropagationLatency(), inflight_request_ptr->extra_common_msghdr.isMonitored(), inflight_request_ptr->cur_msg_seqnum);
+        const NetworkAddr& tmp_recvrsp_source_addr = edge_cache_server_worker_async_recvrsp_source_addr_; // NOTE: responses of in-flight requests are received by the async recvrsp socket
+
+        inflight_request_ptr->rtt_start_timestamp = Util::getCurrentTimespec(); // NOT count timeout
+
+        MessageBase* request_ptr = NULL;
+        bool is_successful = false;
+        switch (inflight_request_ptr->stage)
+        {
+            case InflightStage::kInflightWaitForDirectoryLookup:
+            {
+                request_ptr = getReqToLookupBeaconDirectory_(tmp_key, tmp_recvrsp_source_addr, tmp_extra_common_msghdr);
+                assert(request_ptr != NULL);
+
+                // Push the control request into edge-to-edge propagation simulator to send to beacon node
+                NetworkAddr beacon_edge_beacon_server_recvreq_dst_addr = tmp_edge_wrapper_ptr->getBeaconDstaddr_(tmp_edge_wrapper_ptr->getCooperationWrapperPtr()->getBeaconEdgeIdx(tmp_key));
+                is_successful = tmp_edge_wrapper_ptr->getEdgeToedgePropagationSimulatorParamPtr()->push(request_ptr, beacon_edge_beacon_server_recvreq_dst_addr);
+                break;
+            }
+            case InflightStage::kInflightWaitForRedirectedGet:
+            {
+                request_ptr = getReqToRedirectGet_(inflight_request_ptr->directory_info.getTargetEdgeIdx(), tmp_key, tmp_recvrsp_source_addr, tmp_extra_common_msghdr);
+                assert(request_ptr != NULL);
+
+                // Push the redirected data request into edge-to-edge propagation simulator to target node
+                NetworkAddr target_edge_cache_server_recvreq_dst_addr = tmp_edge_wrapper_ptr->getTargetDstaddr(inflight_request_ptr->directory_info);
+                is_successful = tmp_edge_wrapper_ptr->getEdgeToedgePropagationSimulatorParamPtr()->push(request_ptr, target_edge_cache_server_recvreq_dst_addr);
+                break;
+            }
+            case InflightStage::kInflightWaitForGlobalGet:
+            {
+                request_ptr = new GlobalGetRequest(tmp_key, tmp_edge_wrapper_ptr->getNodeIdx(), tmp_recvrsp_source_addr, tmp_extra_common_msghdr);
+                assert(request_ptr != NULL);
+
+                // Push the global request into edge-to-cloud propagation simulator to cloud
+                is_successful = tmp_edge_wrapper_ptr->getEdgeTocloudPropagationSimulatorParamPtr()->push(request_ptr, corresponding_cloud_recvreq_dst_addr_);
+                break;
+            }
+            case InflightStage::kInflightWaitForAcquireWritelock:
+            {
+                request_ptr = getReqToAcquireBeaconWritelock_(tmp_key, tmp_recvrsp_source_addr, tmp_extra_common_msghdr);
+                assert(request_ptr != NULL);
+
+                // Push the control request into edge-to-edge propagation simulator to the beacon node
+                NetworkAddr beacon_edge_beacon_server_recvreq_dst_addr = tmp_edge_wrapper_ptr->getBeaconDstaddr_(tmp_edge_wrapper_ptr->getCooperationWrapperPtr()->getBeaconEdgeIdx(tmp_key));
+                is_successful = tmp_edge_wrapper_ptr->getEdgeToedgePropagationSimulatorParamPtr()->push(request_ptr, beacon_edge_beacon_server_recvreq_dst_addr);
+                break;
+            }
+            case InflightStage::kInflightWaitForGlobalWrite:
+            {
+                request_ptr = getGlobalWriteRequest_(tmp_key, inflight_request_ptr->value, inflight_request_ptr->message_type, tmp_recvrsp_source_addr, tmp_extra_common_msghdr);
+                assert(request_ptr != NULL);
+
+                // Push the global request into edge-to-cloud propagation simulator to cloud
+                is_successful = tmp_edge_wrapper_ptr->getEdgeTocloudPropagationSimulatorParamPtr()->push(request_ptr, corresponding_cloud_recvreq_dst_addr_);
+                break;
+            }
+            case InflightStage::kInflightWaitForReleaseWritelock:
+            {
+                request_ptr = getReqToReleaseBeaconWritelock_(tmp_key, tmp_recvrsp_source_addr, tmp_extra_common_msghdr);
+                assert(request_ptr != NULL);
+
+                // Push the control request into edge-to-edge propagation simulator to the beacon node
+                NetworkAddr beacon_edge_beacon_server_recvreq_dst_addr = tmp_edge_wrapper_ptr->getBeaconDstaddr_(tmp_edge_wrapper_ptr->getCooperationWrapperPtr()->getBeaconEdgeIdx(tmp_key));
+                is_successful = tmp_edge_wrapper_ptr->getEdgeToedgePropagationSimulatorParamPtr()->push(request_ptr, beacon_edge_beacon_server_recvreq_dst_addr);
+                break;
+            }
+            case InflightStage::kInflightWaitForInvalidation:
+            case InflightStage::kInflightWaitForNotifyFinishBlock:
+            {
+                // Send (fanout_edgecnt - acked_edgecnt) control requests to the involved edge nodes that have not acknowledged
+                assert(inflight_request_ptr->fanout_acked_edgecnt < inflight_request_ptr->fanout_acked_flags.size());
+                for (std::unordered_map<NetworkAddr, std::pair<bool, uint32_t>, NetworkAddrHasher>::const_iterator iter_for_request = inflight_request_ptr->fanout_acked_flags.begin(); iter_for_request != inflight_request_ptr->fanout_acked_flags.end(); iter_for_request++)
+                {
+                    if (iter_for_request->second.first) // Skip the edge node that has acknowledged the request
+                    {
+                        continue;
+                    }
+
+                    const uint32_t& tmp_dst_edge_idx = iter_for_request->second.second;
+                    if (inflight_request_ptr->stage == InflightStage::kInflightWaitForInvalidation)
+                    {
+                        request_ptr = tmp_edge_wrapper_ptr->getInvalidationRequest_(tmp_key, tmp_recvrsp_source_addr, tmp_dst_edge_idx, tmp_extra_common_msghdr);
+                    }
+                    else
+                    {
+                        request_ptr = tmp_edge_wrapper_ptr->getFinishBlockRequest_(tmp_key, tmp_recvrsp_source_addr, tmp_dst_edge_idx, tmp_extra_common_msghdr);
+                    }
+                    assert(request_ptr != NULL);
+
+                    // Push the control request into edge-to-edge propagation simulator to cache server of the cache copy or cache server worker of the blocked edge
+                    bool tmp_is_successful = tmp_edge_wrapper_ptr->getEdgeToedgePropagationSimulatorParamPtr()->push(request_ptr, iter_for_request->first);
+                    assert(tmp_is_successful);
+                    UNUSED(tmp_is_successful);
+
+                    // NOTE: request_ptr will be released by edge-to-edge propagation simulator
+                    request_ptr = NULL;
+                }
+                is_successful = true;
+                break;
+            }
+            default:
+            {
+                std::ostringstream oss;
+                oss << "invalid in-flight stage " << inflightStageToString_(inflight_request_ptr->stage) << " for sendInflightRemoteRequest_()!";
+                Util::dumpErrorMsg(base_instance_name_, oss.str());
+                exit(1);
+            }
+        }
+        assert(is_successful);
+        UNUSED(is_successful);
+
+        // NOTE: request_ptr will be released by propagation simulator
+        request_ptr = NULL;
+
+        return;
+    }
+
+    void CacheServerWorkerBase::blockInflightRequestForWrites_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+
+        // Closest edge node must NOT be the beacon node if with interruption
+        checkPointers_();
+        assert(!cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr()->currentIsBeacon(inflight_request_ptr->key));
+
+        inflight_request_ptr->block_for_writes_start_timestamp = Util::getCurrentTimespec();
+
+        // NOTE: FinishBlockRequest may arrive before the response blocking the request, as they are received by different sockets
+        std::unordered_set<Key, KeyHasher>::iterator early_finish_block_keyset_iter = early_finish_block_keyset_.find(inflight_request_ptr->key);
+        if (early_finish_block_keyset_iter != early_finish_block_keyset_.end())
+        {
+            early_finish_block_keyset_.erase(early_finish_block_keyset_iter);
+
+            // Add intermediate event if with event tracking
+            inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_BLOCK_FOR_WRITES_EVENT_NAME, 0);
+
+            // Retry in the next round of event loop, as writes have been finished
+            inflight_request_ptr->stage = InflightStage::kInflightWaitForLocalRetry;
+            local_retry_list_.push_back(inflight_request_ptr);
+            return;
+        }
+
+        inflight_request_ptr->stage = InflightStage::kInflightWaitForFinishBlock;
+
+        // NOTE: at most one in-flight request of each key is started due to per-key serialization
+        bool is_successful = blocked_inflight_map_.insert(std::pair<Key, InflightRequest*>(inflight_request_ptr->key, inflight_request_ptr)).second;
+        assert(is_successful);
+        UNUSED(is_successful);
+
+        return;
+    }
+
+    bool CacheServerWorkerBase::processInflightResponse_(MessageBase* response_ptr)
+    {
+        assert(response_ptr != NULL);
+
+        // Check if the received message is a stale response
+        const uint64_t tmp_msg_seqnum = response_ptr->getExtraCommonMsghdr().getMsgSeqnum();
+        std::unordered_map<uint64_t, InflightRequest*>::iterator seqnum_inflight_map_iter = seqnum_inflight_map_.find(tmp_msg_seqnum);
+        if (seqnum_inflight_map_iter == seqnum_inflight_map_.end())
+        {
+            std::ostringstream oss_for_stable_response;
+            oss_for_stable_response << "stale response " << MessageBase::messageTypeToString(response_ptr->getMessageType()) << " with seqnum " << tmp_msg_seqnum << " for no in-flight request";
+            Util::dumpWarnMsg(base_instance_name_, oss_for_stable_response.str());
+            return false;
+        }
+        InflightRequest* inflight_request_ptr = seqnum_inflight_map_iter->second;
+        assert(inflight_request_ptr != NULL);
+
+        // NOTE: fan-out requests share the same seqnum and keep waiting until all involved edge nodes have acknowledged
+        if (inflight_request_ptr->stage == InflightStage::kInflightWaitForInvalidation || inflight_request_ptr->stage == InflightStage::kInflightWaitForNotifyFinishBlock)
+        {
+            bool is_all_acked = processInflightFanoutResponse_(inflight_request_ptr, response_ptr);
+            if (!is_all_acked)
+            {
+                return false;
+            }
+        }
+        seqnum_inflight_map_.erase(seqnum_inflight_map_iter);
+
+        bool is_finish = false; // Mark if edge node is finished
+        struct timespec issue_req_end_timestamp = Util::getCurrentTimespec();
+        uint32_t issue_req_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(issue_req_end_timestamp, inflight_request_ptr->issue_req_start_timestamp));
+
+        switch (inflight_request_ptr->stage)
+        {
+            case InflightStage::kInflightWaitForDirectoryLookup:
+            {
+                // Get directory info, update total bandwidth usage, and add events of intermediate response if with event tracking
+                processDirectoryLookupResponse_(response_ptr, inflight_request_ptr->rtt_start_timestamp, inflight_request_ptr->is_being_written, inflight_request_ptr->is_valid_directory_exist, inflight_request_ptr->directory_info, inflight_request_ptr->best_placement_edgeset, inflight_request_ptr->need_hybrid_fetching, inflight_request_ptr->fast_path_hint, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list, inflight_request_ptr->extra_common_msghdr);
+                inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_ISSUE_DIRECTORY_LOOKUP_REQ_EVENT_NAME, issue_req_latency_us); // Add intermediate event if with event tracking
+
+                if (inflight_request_ptr->is_being_written) // If key is being written, we need to wait for writes
+                {
+                    // Wait for writes by interruption instead of polling to avoid duplicate DirectoryLookupRequest
+                    blockInflightRequestForWrites_(inflight_request_ptr);
+                }
+                else
+                {
+                    is_finish = afterDirectoryLookupForInflightGet_(inflight_request_ptr);
+                }
+                break;
+            }
+            case InflightStage::kInflightWaitForRedirectedGet:
+            {
+                // Get value and cooperative cache status, update total bandwidth usage, and add events of intermediate response if with event tracking
+                processRedirectedGetResponse_(response_ptr, inflight_request_ptr->rtt_start_timestamp, inflight_request_ptr->key, inflight_request_ptr->value, inflight_request_ptr->is_cooperative_cached, inflight_request_ptr->is_cooperative_valid, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list, inflight_request_ptr->extra_common_msghdr);
+                inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_ISSUE_REDIRECT_GET_REQ_EVENT_NAME, issue_req_latency_us); // Add intermediate event if with event tracking
+
+                // Add intermediate event if with event tracking
+                struct timespec redirect_get_end_timestamp = Util::getCurrentTimespec();
+                uint32_t redirect_get_latency_us = Util::getDeltaTimeUs(redirect_get_end_timestamp, inflight_request_ptr->redirect_get_start_timestamp);
+                inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_REDIRECT_GET_EVENT_NAME, redirect_get_latency_us);
+
+                if (inflight_request_ptr->is_cooperative_cached && !inflight_request_ptr->is_cooperative_valid) // Target edge node caches an invalid object
+                {
+                    inflight_request_ptr->lookup_directory_start_timestamp = Util::getCurrentTimespec(); // Reset start timestamp for the next round
+                    is_finish = lookupDirectoryForInflightGet_(inflight_request_ptr); // Go back to look up local/remote directory info again
+                }
+                else // Target edge node does not cache the object or caches a valid object
+                {
+                    is_finish = afterCooperativeFetchForInflightGet_(inflight_request_ptr);
+                }
+                break;
+            }
+            case InflightStage::kInflightWaitForGlobalGet:
+            {
+                // Get value, update total bandwidth usage, and add events of intermediate response if with event tracking
+                processGlobalGetResponse_(response_ptr, inflight_request_ptr->rtt_start_timestamp, inflight_request_ptr->value, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list, inflight_request_ptr->extra_common_msghdr);
+                inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_ISSUE_GLOBAL_GET_REQ_EVENT_NAME, issue_req_latency_us); // Add intermediate event if with event tracking
+
+                is_finish = afterCloudFetchForInflightGet_(inflight_request_ptr);
+                break;
+            }
+            case InflightStage::kInflightWaitForAcquireWritelock:
+            {
+                // Get lock result, update total bandwidth usage, and add events of intermediate response if with event tracking
+                processAcquireWritelockResponse_(response_ptr, inflight_request_ptr->lock_result, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list);
+                inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_ISSUE_ACQUIRE_WRITELOCK_REQ_EVENT_NAME, issue_req_latency_us); // Add intermediate event if with event tracking
+
+                if (inflight_request_ptr->lock_result == LockResult::kFailure) // If key has been locked by any other edge node
+                {
+                    // Wait for writes by interruption instead of polling to avoid duplicate AcquireWritelockRequest
+                    blockInflightRequestForWrites_(inflight_request_ptr);
+                }
+                else // NOTE: If lock_result == kSuccess, beacon server of beacon node has already invalidated all cache copies
+                {
+                    is_finish = afterWritelockForInflightWrite_(inflight_request_ptr);
+                }
+                break;
+            }
+            case InflightStage::kInflightWaitForGlobalWrite:
+            {
+                // Update total bandwidth usage and add events of intermediate response if with event tracking
+                processGlobalWriteResponse_(response_ptr, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list);
+                inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_ISSUE_GLOBAL_WRITE_REQ_EVENT_NAME, issue_req_latency_us); // Add intermediate event if with event tracking
+
+                is_finish = afterCloudWriteForInflightWrite_(inflight_request_ptr);
+                break;
+            }
+            case InflightStage::kInflightWaitForInvalidation:
+            {
+                // NOTE: InvalidationResponses have been processed by processInflightFanoutResponse_()
+                struct timespec invalidate_cache_copies_end_timestamp = Util::getCurrentTimespec();
+                uint32_t invalidate_cache_copies_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(invalidate_cache_copies_end_timestamp, inflight_request_ptr->fanout_start_timestamp));
+                inflight_request_ptr->event_list.addEvent(Event::EDGE_INVALIDATE_CACHE_COPIES_EVENT_NAME, invalidate_cache_copies_latency_us); // Add intermediate event if with event tracking
+
+                is_finish = afterWritelockForInflightWrite_(inflight_request_ptr);
+                break;
+            }
+            case InflightStage::kInflightWaitForReleaseWritelock:
+            {
+                // Process release writelock response, update total bandwidth usage, and add events of intermediate response if with event tracking
+                const ExtraCommonMsghdr tmp_extra_common_msghdr(inflight_request_ptr->extra_common_msghdr.isSkipPropagationLatency(), inflight_request_ptr->extra_common_msghdr.isMonitored(), inflight_request_ptr->cur_msg_seqnum);
+                is_finish = processReleaseWritelockResponse_(response_ptr, inflight_request_ptr->value, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list, tmp_extra_common_msghdr);
+                if (is_finish)
+                {
+                    break; // Edge is NOT running
+                }
+                inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_ISSUE_RELEASE_WRITELOCK_REQ_EVENT_NAME, issue_req_latency_us); // Add intermediate event if with event tracking
+
+                is_finish = afterReleaseWritelockForInflightWrite_(inflight_request_ptr);
+                break;
+            }
+            case InflightStage::kInflightWaitForNotifyFinishBlock:
+            {
+                // NOTE: FinishBlockResponses have been processed by processInflightFanoutResponse_()
+                struct timespec finish_block_end_timestamp = Util::getCurrentTimespec();
+                uint32_t finish_block_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(finish_block_end_timestamp, inflight_request_ptr->fanout_start_timestamp));
+                inflight_request_ptr->event_list.addEvent(Event::EDGE_FINISH_BLOCK_EVENT_NAME, finish_block_latency_us); // Add intermediate event if with event tracking
+
+                is_finish = afterReleaseWritelockForInflightWrite_(inflight_request_ptr);
+                break;
+            }
+            default:
+            {
+                std::ostringstream oss;
+                oss << "invalid in-flight stage " << inflightStageToString_(inflight_request_ptr->stage) << " for response " << MessageBase::messageTypeToString(response_ptr->getMessageType()) << " in processInflightResponse_()!";
+                Util::dumpErrorMsg(base_instance_name_, oss.str());
+                exit(1);
+            }
+        }
+
+        return is_finish;
+    }
+
+    bool CacheServerWorkerBase::processInflightFanoutResponse_(InflightRequest* inflight_request_ptr, MessageBase* response_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+        assert(response_ptr != NULL);
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        // Mark the edge node has acknowledged the InvalidationRequest/FinishBlockRequest
+        // NOTE: source address of InvalidationResponse/FinishBlockResponse is the same as the destination address of the corresponding request
+        std::unordered_map<NetworkAddr, std::pair<bool, uint32_t>, NetworkAddrHasher>::iterator fanout_acked_flags_iter = inflight_request_ptr->fanout_acked_flags.find(response_ptr->getSourceAddr());
+        if (fanout_acked_flags_iter == inflight_request_ptr->fanout_acked_flags.end() || fanout_acked_flags_iter->second.first)
+        {
+            // NOTE: duplicate responses may arrive for resent requests with the same seqnum
+            std::ostringstream oss;
+            oss << "receive unexpected or duplicate " << MessageBase::messageTypeToString(response_ptr->getMessageType()) << " from edge node " << response_ptr->getSourceIndex() << " for key " << inflight_request_ptr->key.getKeyDebugstr();
+            Util::dumpWarnMsg(base_instance_name_, oss.str());
+            return false;
+        }
+
+        // Process invalidation/finish block response
+        if (inflight_request_ptr->stage == InflightStage::kInflightWaitForInvalidation)
+        {
+            tmp_edge_wrapper_ptr->processInvalidationResponse_(response_ptr);
+        }
+        else
+        {
+            assert(inflight_request_ptr->stage == InflightStage::kInflightWaitForNotifyFinishBlock);
+            tmp_edge_wrapper_ptr->processFinishBlockResponse_(response_ptr);
+        }
+
+        // Update total bandwidth usage for received invalidation/finish block response
+        BandwidthUsage fanout_response_bandwidth_usage = response_ptr->getBandwidthUsageRef();
+        uint32_t cross_edge_fanout_rsp_bandwidth_bytes = response_ptr->getMsgBandwidthSize();
+        fanout_response_bandwidth_usage.update(BandwidthUsage(0, cross_edge_fanout_rsp_bandwidth_bytes, 0, 0, 1, 0, response_ptr->getMessageType(), response_ptr->getVictimSyncsetBytes()));
+        inflight_request_ptr->total_bandwidth_usage.update(fanout_response_bandwidth_usage);
+
+        // Add the event of intermediate response if with event tracking
+        inflight_request_ptr->event_list.addEvents(response_ptr->getEventListRef());
+
+        // Update ack information
+        fanout_acked_flags_iter->second.first = true;
+        inflight_request_ptr->fanout_acked_edgecnt += 1;
+
+        return inflight_request_ptr->fanout_acked_edgecnt == inflight_request_ptr->fanout_acked_flags.size();
+    }
+
+    bool CacheServerWorkerBase::processInflightFinishBlockRequest_(MessageBase* control_request_ptr)
+    {
+        assert(control_request_ptr != NULL);
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        // Process finish block request
+        processReqToFinishBlock_(control_request_ptr);
+
+        // Update tmp bandwidth usage for received finish block request
+        // NOTE: NO need to update total_bandwidth_usage, as the bandwidth usage is counted by the write request triggering FinishBlockRequest instead of the local request being blocked
+        BandwidthUsage tmp_bandwidth_usage;
+        uint32_t cross_edge_finish_block_req_bandwidth_bytes = control_request_ptr->getMsgBandwidthSize();
+        tmp_bandwidth_usage.update(BandwidthUsage(0, cross_edge_finish_block_req_bandwidth_bytes, 0, 0, 1, 0, control_request_ptr->getMessageType(), control_request_ptr->getVictimSyncsetBytes()));
+
+        // Find the in-flight request blocked by the key
+        const Key tmp_key = MessageBase::getKeyFromMessage(control_request_ptr);
+        InflightRequest* inflight_request_ptr = NULL;
+        std::unordered_map<Key, InflightRequest*, KeyHasher>::iterator blocked_inflight_map_iter = blocked_inflight_map_.find(tmp_key);
+        if (blocked_inflight_map_iter != blocked_inflight_map_.end())
+        {
+            inflight_request_ptr = blocked_inflight_map_iter->second;
+            assert(inflight_request_ptr != NULL);
+            assert(inflight_request_ptr->stage == InflightStage::kInflightWaitForFinishBlock);
+            blocked_inflight_map_.erase(blocked_inflight_map_iter);
+
+            // NOTE: extra_common_msghdr comes from local request A (currently blocked), while finish_block_request_skip_propagation_latency comes from local write request B, where B is processed before A to block A.
+            const bool finish_block_request_skip_propagation_latency = control_request_ptr->getExtraCommonMsghdr().isSkipPropagationLatency();
+            if (inflight_request_ptr->extra_common_msghdr.isSkipPropagationLatency() != finish_block_request_skip_propagation_latency)
+            {
+                // Still hold extra_common_msghdr to simulate propagation latency for local request A (currently blocked), yet pose a warning
+                std::ostringstream oss;
+                oss << "extra_common_msghdr is " << inflight_request_ptr->extra_common_msghdr.toString() << " for currently-blocked request, while finish_block_request_skip_propagation_latency is " << Util::toString(finish_block_request_skip_propagation_latency) << " for previous write request!";
+                Util::dumpWarnMsg(base_instance_name_, oss.str());
+            }
+        }
+        else
+        {
+            std::unordered_map<Key, std::list<InflightRequest*>, KeyHasher>::const_iterator key_inflight_map_const_iter = key_inflight_map_.find(tmp_key);
+            if (key_inflight_map_const_iter != key_inflight_map_.end() && (key_inflight_map_const_iter->second.front()->stage == InflightStage::kInflightWaitForDirectoryLookup || key_inflight_map_const_iter->second.front()->stage == InflightStage::kInflightWaitForAcquireWritelock))
+            {
+                // NOTE: FinishBlockRequest arrives before the response which will block the started in-flight request of the key -> buffer it to unblock the request immediately
+                early_finish_block_keyset_.insert(tmp_key);
+            }
+            else
+            {
+                // NOTE: still reply the beacon to avoid duplicate FinishBlockRequest (e.g., the blocked request has been finished due to a lost FinishBlockResponse)
+                std::ostringstream oss;
+                oss << "no in-flight request is blocked for received key " << tmp_key.getKeyDebugstr();
+                Util::dumpWarnMsg(base_instance_name_, oss.str());
+            }
+        }
+
+        // Prepare FinishBlockResponse
+        // NOTE: we just finish block, so no need to add an event for FinishBlockResponse
+        MessageBase* finish_block_response_ptr = getRspToFinishBlock_(control_request_ptr, tmp_bandwidth_usage);
+        assert(finish_block_response_ptr != NULL);
+
+        // Push FinishBlockResponse into edge-to-edge propagation simulator to cache server worker or beacon server
+        const NetworkAddr recvrsp_dstaddr = control_request_ptr->getSourceAddr();
+        bool is_successful = tmp_edge_wrapper_ptr->getEdgeToedgePropagationSimulatorParamPtr()->push(finish_block_response_ptr, recvrsp_dstaddr);
+        assert(is_successful);
+        UNUSED(is_successful);
+
+        // NOTE: finish_block_response_ptr will be released by edge-to-edge propagation simulator
+        finish_block_response_ptr = NULL;
+
+        bool is_finish = false; // Mark if edge node is finished
+        if (inflight_request_ptr != NULL)
+        {
+            // Add intermediate event if with event tracking
+            struct timespec block_for_writes_end_timestamp = Util::getCurrentTimespec();
+            uint32_t block_for_writes_latency_us = Util::getDeltaTimeUs(block_for_writes_end_timestamp, inflight_request_ptr->block_for_writes_start_timestamp);
+            inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_BLOCK_FOR_WRITES_EVENT_NAME, block_for_writes_latency_us);
+
+            is_finish = retryInflightRequest_(inflight_request_ptr); // Continue to lookup remote directory info or acquire the write lock
+        }
+
+        return is_finish;
+    }
+
+    bool CacheServerWorkerBase::retryInflightRequest_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+
+        bool is_finish = false; // Mark if edge node is finished
+        if (inflight_request_ptr->message_type == MessageType::kLocalGetRequest)
+        {
+            is_finish = lookupDirectoryForInflightGet_(inflight_request_ptr);
+        }
+        else
+        {
+            is_finish = acquireWritelockForInflightWrite_(inflight_request_ptr);
+        }
+
+        return is_finish;
+    }
+
+    void CacheServerWorkerBase::resendTimeoutInflightRequests_()
+    {
+        // Check timeout at most once per socket timeout period
+        const struct timespec cur_timestamp = Util::getCurrentTimespec();
+        const double timeout_us = static_cast<double>(UdpPktSocket::SOCKET_TIMEOUT_SECONDS) * 1000.0 * 1000.0 + static_cast<double>(UdpPktSocket::SOCKET_TIMEOUT_USECONDS);
+        if (Util::getDeltaTimeUs(cur_timestamp, prev_timeout_check_timestamp_) < timeout_us)
+        {
+            return;
+        }
+        prev_timeout_check_timestamp_ = cur_timestamp;
+
+        // Resend requests with the same seqnum (stale responses of previous sends will be ignored)
+        for (std::unordered_map<uint64_t, InflightRequest*>::iterator iter = seqnum_inflight_map_.begin(); iter != seqnum_inflight_map_.end(); iter++)
+        {
+            InflightRequest* inflight_request_ptr = iter->second;
+            assert(inflight_request_ptr != NULL);
+            if (Util::getDeltaTimeUs(cur_timestamp, inflight_request_ptr->rtt_start_timestamp) >= timeout_us)
+            {
+                std::ostringstream oss;
+                oss << "edge timeout to wait for " << inflightStageToString_(inflight_request_ptr->stage) << " for key " << inflight_request_ptr->key.getKeyDebugstr() << " with seqnum " << inflight_request_ptr->cur_msg_seqnum;
+                Util::dumpWarnMsg(base_instance_name_, oss.str());
+
+                sendInflightRemoteRequest_(inflight_request_ptr); // Resend the request message
+            }
+        }
+
+        // Unblock requests if timeout to retry in the next round of event loop (FinishBlockRequest may be lost, while the retried request will be blocked again if the key is still being written)
+        std::unordered_map<Key, InflightRequest*, KeyHasher>::iterator blocked_inflight_map_iter = blocked_inflight_map_.begin();
+        while (blocked_inflight_map_iter != blocked_inflight_map_.end())
+        {
+            InflightRequest* inflight_request_ptr = blocked_inflight_map_iter->second;
+            assert(inflight_request_ptr != NULL);
+            if (Util::getDeltaTimeUs(cur_timestamp, inflight_request_ptr->block_for_writes_start_timestamp) >= timeout_us)
+            {
+                std::ostringstream oss;
+                oss << "edge timeout to wait for FinishBlockRequest for key " << blocked_inflight_map_iter->first.getKeyDebugstr() << " -> retry";
+                Util::dumpWarnMsg(base_instance_name_, oss.str());
+
+                // Add intermediate event if with event tracking
+                uint32_t block_for_writes_latency_us = Util::getDeltaTimeUs(cur_timestamp, inflight_request_ptr->block_for_writes_start_timestamp);
+                inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_BLOCK_FOR_WRITES_EVENT_NAME, block_for_writes_latency_us);
+
+                inflight_request_ptr->stage = InflightStage::kInflightWaitForLocalRetry;
+                local_retry_list_.push_back(inflight_request_ptr);
+                blocked_inflight_map_iter = blocked_inflight_map_.erase(blocked_inflight_map_iter);
+            }
+            else
+            {
+                blocked_inflight_map_iter++;
+            }
+        }
+
+        return;
+    }
+
+    void CacheServerWorkerBase::waitForInflightEvents_() const
+    {
+        checkPointers_();
+        const uint32_t cache_server_worker_inflightcnt = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr()->getCacheServerWorkerInflightcnt();
+
+        // Wait until the next timeout check at most
+        const struct timespec cur_timestamp = Util::getCurrentTimespec();
+        const double timeout_us = static_cast<double>(UdpPktSocket::SOCKET_TIMEOUT_SECONDS) * 1000.0 * 1000.0 + static_cast<double>(UdpPktSocket::SOCKET_TIMEOUT_USECONDS);
+        double wait_us = timeout_us - Util::getDeltaTimeUs(cur_timestamp, prev_timeout_check_timestamp_);
+        if (inflight_cnt_ < cache_server_worker_inflightcnt || !local_retry_list_.empty())
+        {
+            // NOTE: local requests pushed into ring buffer and local directory info being polled cannot wake up poll()
+            wait_us = std::min(wait_us, static_cast<double>(ASYNC_IDLE_WAIT_US));
+        }
+        if (wait_us <= 0.0)
+        {
+            return; // Resend timeout requests in the next round of event loop immediately
+        }
+
+        struct pollfd tmp_pollfds[2];
+        tmp_pollfds[0].fd = edge_cache_server_worker_async_recvrsp_socket_server_ptr_->getSockfd();
+        tmp_pollfds[0].events = POLLIN;
+        tmp_pollfds[0].revents = 0;
+        tmp_pollfds[1].fd = edge_cache_server_worker_recvreq_socket_server_ptr_->getSockfd();
+        tmp_pollfds[1].events = POLLIN;
+        tmp_pollfds[1].revents = 0;
+
+        struct timespec tmp_wait_timespec;
+        const uint64_t tmp_wait_us = static_cast<uint64_t>(wait_us);
+        tmp_wait_timespec.tv_sec = static_cast<time_t>(tmp_wait_us / 1000000);
+        tmp_wait_timespec.tv_nsec = static_cast<long>((tmp_wait_us % 1000000) * 1000);
+
+        int return_code = ppoll(tmp_pollfds, 2, &tmp_wait_timespec, NULL);
+        if (return_code < 0 && errno != EINTR)
+        {
+            std::ostringstream oss;
+            oss << "failed to wait for in-flight events (errno: " << errno << ")";
+            Util::dumpWarnMsg(base_instance_name_, oss.str());
+        }
+
+        return;
+    }
+
+    void CacheServerWorkerBase::releaseAllInflightRequests_()
+    {
+        // NOTE: key_inflight_map_ tracks all admitted in-flight requests, while other containers just refer to some of them
+        for (std::unordered_map<Key, std::list<InflightRequest*>, KeyHasher>::iterator map_iter = key_inflight_map_.begin(); map_iter != key_inflight_map_.end(); map_iter++)
+        {
+            for (std::list<InflightRequest*>::iterator list_iter = map_iter->second.begin(); list_iter != map_iter->second.end(); list_iter++)
+            {
+                InflightRequest* inflight_request_ptr = *list_iter;
+                assert(inflight_request_ptr != NULL);
+                assert(inflight_request_ptr->local_request_ptr != NULL);
+                delete inflight_request_ptr->local_request_ptr;
+                inflight_request_ptr->local_request_ptr = NULL;
+                delete inflight_request_ptr;
+                inflight_request_ptr = NULL;
+            }
+        }
+        key_inflight_map_.clear();
+        seqnum_inflight_map_.clear();
+        blocked_inflight_map_.clear();
+        early_finish_block_keyset_.clear();
+        local_retry_list_.clear();
+        inflight_cnt_ = 0;
+
+        return;
+    }
+
+    // (0.1) In-flight local get requests (the same workflow as processLocalGetRequest_() and fetchDataFromNeighbor_())
+
+    bool CacheServerWorkerBase::startInflightGet_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+        assert(inflight_request_ptr->message_type == MessageType::kLocalGetRequest);
+        inflight_request_ptr->process_local_getreq_start_timestamp = Util::getCurrentTimespec();
+
+        MessageBase* local_request_ptr = inflight_request_ptr->local_request_ptr;
+        assert(local_request_ptr != NULL);
+
+        #ifdef DEBUG_CACHE_SERVER_WORKER
+        Util::dumpVariablesForDebug(base_instance_name_, 5, "start an in-flight local get request;", "type:", MessageBase::messageTypeToString(local_request_ptr->getMessageType()).c_str(), "keystr:", inflight_request_ptr->key.getKeystr().c_str());
+        #endif
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        // Update total bandwidth usage for received local get request
+        uint32_t client_edge_local_req_bandwidth_bytes = local_request_ptr->getMsgBandwidthSize();
+        inflight_request_ptr->total_bandwidth_usage.update(BandwidthUsage(client_edge_local_req_bandwidth_bytes, 0, 0, 1, 0, 0, local_request_ptr->getMessageType(), local_request_ptr->getVictimSyncsetBytes()));
+
+        // Access local edge cache (current edge node is the closest edge node)
+        struct timespec get_local_cache_start_timestamp = Util::getCurrentTimespec();
+        const bool is_redirected = false;
+        Value local_value; // NOTE: NOT overwrite the value fetched by the previous local get request for coalesced request
+        inflight_request_ptr->is_local_cached_and_valid = tmp_edge_wrapper_ptr->getLocalEdgeCache_(inflight_request_ptr->key, is_redirected, local_value, inflight_request_ptr->is_tracked_before_fetch_value);
+        struct timespec get_local_cache_end_timestamp = Util::getCurrentTimespec();
+        uint32_t get_local_cache_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(get_local_cache_end_timestamp, get_local_cache_start_timestamp));
+        inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_GET_LOCAL_CACHE_EVENT_NAME, get_local_cache_latency_us); // Add intermediate event if with event tracking
+
+        if (inflight_request_ptr->is_coalesced)
+        {
+            if (!inflight_request_ptr->is_local_cached_and_valid) // Still local miss -> reuse the fetched value
+            {
+                return finishCoalescedInflightGet_(inflight_request_ptr);
+            }
+
+            // Local hit (e.g., the previous local get request has admitted the object) -> process as a normal local hit
+            inflight_request_ptr->is_coalesced = false;
+            inflight_request_ptr->is_cooperative_cached = false;
+            inflight_request_ptr->is_cooperative_cached_and_valid = false;
+            inflight_request_ptr->get_cooperative_cache_latency_us = 0;
+            inflight_request_ptr->get_cloud_latency_us = 0;
+            inflight_request_ptr->fetch_bandwidth_bytes = 0;
+        }
+        inflight_request_ptr->value = local_value;
+
+        // Access cooperative edge cache for local cache miss or invalid object
+        // NOTE: disable cooperative caching for single-node caches
+        if (!Util::isSingleNodeCache(tmp_edge_wrapper_ptr->getCacheName()) && !inflight_request_ptr->is_local_cached_and_valid) // not local cached or invalid
+        {
+            inflight_request_ptr->get_cooperative_cache_start_timestamp = Util::getCurrentTimespec();
+            inflight_request_ptr->lookup_directory_start_timestamp = inflight_request_ptr->get_cooperative_cache_start_timestamp;
+            inflight_request_ptr->need_hybrid_fetching = false;
+            return lookupDirectoryForInflightGet_(inflight_request_ptr);
+        }
+
+        return fetchDataFromCloudForInflightGet_(inflight_request_ptr);
+    }
+
+    bool CacheServerWorkerBase::lookupDirectoryForInflightGet_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        bool is_finish = false; // Mark if edge node is finished
+
+        inflight_request_ptr->is_cooperative_cached = false;
+        inflight_request_ptr->is_cooperative_valid = false;
+
+        if (!tmp_edge_wrapper_ptr->isNodeRunning()) // edge node is NOT running
+        {
+            is_finish = true;
+            return is_finish;
+        }
+
+        inflight_request_ptr->is_being_written = false;
+        inflight_request_ptr->is_valid_directory_exist = false;
+        if (tmp_edge_wrapper_ptr->currentIsBeacon(inflight_request_ptr->key)) // Get target edge index from local directory information
+        {
+            is_finish = lookupLocalDirectory_(inflight_request_ptr->key, inflight_request_ptr->is_being_written, inflight_request_ptr->is_valid_directory_exist, inflight_request_ptr->directory_info, inflight_request_ptr->best_placement_edgeset, inflight_request_ptr->need_hybrid_fetching, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list, inflight_request_ptr->extra_common_msghdr);
+            if (is_finish)
+            {
+                return is_finish; // Edge is NOT running
+            }
+            if (inflight_request_ptr->is_being_written) // If key is being written, we need to wait for writes
+            {
+                // Poll local directory info again in the next round of event loop instead of blocking other in-flight requests
+                inflight_request_ptr->stage = InflightStage::kInflightWaitForLocalRetry;
+                local_retry_list_.push_back(inflight_request_ptr);
+                return is_finish;
+            }
+        }
+        else // Get target edge index from remote directory information at the beacon node
+        {
+            bool need_lookup_beacon_directory = needLookupBeaconDirectory_(inflight_request_ptr->key, inflight_request_ptr->is_being_written, inflight_request_ptr->is_valid_directory_exist, inflight_request_ptr->directory_info);
+            if (need_lookup_beacon_directory)
+            {
+                issueInflightRemoteRequest_(inflight_request_ptr, InflightStage::kInflightWaitForDirectoryLookup); // Resumed by DirectoryLookupResponse
+                return is_finish;
+            }
+
+            if (inflight_request_ptr->is_being_written) // If key is being written, we need to wait for writes
+            {
+                blockInflightRequestForWrites_(inflight_request_ptr); // Resumed by FinishBlockRequest
+                return is_finish;
+            }
+        }
+
+        return afterDirectoryLookupForInflightGet_(inflight_request_ptr);
+    }
+
+    bool CacheServerWorkerBase::afterDirectoryLookupForInflightGet_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        // key must NOT being written here
+        assert(!inflight_request_ptr->is_being_written);
+
+        // Add intermediate event if with event tracking
+        // NOTE: too large latency to lookup local directory may indicate polling for writes, while too large latency to lookup remote directory may indicate blocking for writes
+        const bool current_is_beacon = tmp_edge_wrapper_ptr->currentIsBeacon(inflight_request_ptr->key);
+        struct timespec lookup_directory_end_timestamp = Util::getCurrentTimespec();
+        uint32_t lookup_directory_latency_us = Util::getDeltaTimeUs(lookup_directory_end_timestamp, inflight_request_ptr->lookup_directory_start_timestamp);
+        inflight_request_ptr->event_list.addEvent(current_is_beacon?Event::EDGE_CACHE_SERVER_WORKER_LOOKUP_LOCAL_DIRECTORY_EVENT_NAME:Event::EDGE_CACHE_SERVER_WORKER_LOOKUP_REMOTE_DIRECTORY_EVENT_NAME, lookup_directory_latency_us);
+
+        if (inflight_request_ptr->is_valid_directory_exist) // The object is cached by some target edge node
+        {
+            // NOTE: the target node should not be the current edge node (see fetchDataFromNeighbor_())
+            if (tmp_edge_wrapper_ptr->currentIsTarget(inflight_request_ptr->directory_info))
+            {
+                std::ostringstream oss;
+                oss << "current edge node " << inflight_request_ptr->directory_info.getTargetEdgeIdx() << " should not be the target edge node for cooperative edge caching under a local cache miss of key " << inflight_request_ptr->key.getKeyDebugstr() << "!";
+                Util::dumpWarnMsg(base_instance_name_, oss.str());
+                return afterCooperativeFetchForInflightGet_(inflight_request_ptr);
+            }
+
+            // Get data from the target edge node if any
+            inflight_request_ptr->redirect_get_start_timestamp = Util::getCurrentTimespec();
+            issueInflightRemoteRequest_(inflight_request_ptr, InflightStage::kInflightWaitForRedirectedGet); // Resumed by RedirectedGetResponse
+            return false;
+        }
+
+        // The object is not cached by any target edge node
+        return afterCooperativeFetchForInflightGet_(inflight_request_ptr);
+    }
+
+    bool CacheServerWorkerBase::afterCooperativeFetchForInflightGet_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+
+        assert(!(inflight_request_ptr->is_cooperative_cached && !inflight_request_ptr->is_cooperative_valid)); // Cooperative cached yet invalid MUST be retried
+        if (inflight_request_ptr->is_cooperative_cached && inflight_request_ptr->is_cooperative_valid) // cooperative cached and valid
+        {
+            inflight_request_ptr->is_cooperative_cached_and_valid = true;
+        }
+
+        struct timespec get_cooperative_cache_end_timestamp = Util::getCurrentTimespec();
+        inflight_request_ptr->get_cooperative_cache_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(get_cooperative_cache_end_timestamp, inflight_request_ptr->get_cooperative_cache_start_timestamp));
+        inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_GET_COOPERATIVE_CACHE_EVENT_NAME, inflight_request_ptr->get_cooperative_cache_latency_us); // Add intermediate event if with event tracking
+
+        return fetchDataFromCloudForInflightGet_(inflight_request_ptr);
+    }
+
+    bool CacheServerWorkerBase::fetchDataFromCloudForInflightGet_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+
+        // Get data from cloud for global cache miss
+        inflight_request_ptr->get_cloud_start_timestamp = Util::getCurrentTimespec();
+        if (!inflight_request_ptr->is_local_cached_and_valid && !inflight_request_ptr->is_cooperative_cached_and_valid) // (not cached or invalid) in both local and cooperative cache
+        {
+            issueInflightRemoteRequest_(inflight_request_ptr, InflightStage::kInflightWaitForGlobalGet); // Resumed by GlobalGetResponse
+            return false;
+        }
+
+        return afterCloudFetchForInflightGet_(inflight_request_ptr);
+    }
+
+    bool CacheServerWorkerBase::afterCloudFetchForInflightGet_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+
+        struct timespec get_cloud_end_timestamp = Util::getCurrentTimespec();
+        inflight_request_ptr->get_cloud_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(get_cloud_end_timestamp, inflight_request_ptr->get_cloud_start_timestamp));
+        inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_GET_CLOUD_EVENT_NAME, inflight_request_ptr->get_cloud_latency_us); // Add intermediate event if with event tracking
+
+        // Bandwidth usage to fetch value (before cache management), which is saved by each coalesced request
+        const BandwidthUsage& tmp_total_bandwidth_usage = inflight_request_ptr->total_bandwidth_usage;
+        inflight_request_ptr->fetch_bandwidth_bytes = tmp_total_bandwidth_usage.getCrossEdgeControlTotalBandwidthBytes() + tmp_total_bandwidth_usage.getCrossEdgeDataBandwidthBytes() + tmp_total_bandwidth_usage.getEdgeCloudBandwidthBytes();
+
+        // Update local edge cache, trigger cache management, and reply the client
+        bool is_finish = finishLocalGetRequest_(inflight_request_ptr->key, inflight_request_ptr->value, inflight_request_ptr->is_local_cached_and_valid, inflight_request_ptr->is_tracked_before_fetch_value, inflight_request_ptr->is_cooperative_cached, inflight_request_ptr->is_cooperative_cached_and_valid, inflight_request_ptr->best_placement_edgeset, inflight_request_ptr->need_hybrid_fetching, inflight_request_ptr->fast_path_hint, inflight_request_ptr->get_cooperative_cache_latency_us, inflight_request_ptr->get_cloud_latency_us, inflight_request_ptr->process_local_getreq_start_timestamp, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list, inflight_request_ptr->extra_common_msghdr, inflight_request_ptr->recvrsp_dst_addr);
+        if (is_finish)
+        {
+            return is_finish; // Edge is NOT running
+        }
+
+        // Single-flight: deferred local get requests of the same key reuse the value fetched from neighbor/cloud
+        if (!inflight_request_ptr->is_local_cached_and_valid)
+        {
+            coalesceDeferredInflightGets_(inflight_request_ptr);
+        }
+
+        return completeInflightRequest_(inflight_request_ptr);
+    }
+
+    void CacheServerWorkerBase::coalesceDeferredInflightGets_(const InflightRequest* fetched_inflight_request_ptr)
+    {
+        assert(fetched_inflight_request_ptr != NULL);
+        assert(!fetched_inflight_request_ptr->is_local_cached_and_valid);
+
+        std::unordered_map<Key, std::list<InflightRequest*>, KeyHasher>::iterator key_inflight_map_iter = key_inflight_map_.find(fetched_inflight_request_ptr->key);
+        assert(key_inflight_map_iter != key_inflight_map_.end());
+        std::list<InflightRequest*>& tmp_inflight_list = key_inflight_map_iter->second;
+        assert(tmp_inflight_list.front() == fetched_inflight_request_ptr);
+
+        // NOTE: stop at the first deferred put/del request, as the following local get requests MUST see the written value
+        std::list<InflightRequest*>::iterator list_iter = tmp_inflight_list.begin();
+        for (list_iter++; list_iter != tmp_inflight_list.end(); list_iter++)
+        {
+            InflightRequest* tmp_inflight_request_ptr = *list_iter;
+            assert(tmp_inflight_request_ptr != NULL);
+            if (tmp_inflight_request_ptr->message_type != MessageType::kLocalGetRequest)
+            {
+                break;
+            }
+            assert(tmp_inflight_request_ptr->stage == InflightStage::kInflightWaitForIssue);
+
+            tmp_inflight_request_ptr->is_coalesced = true;
+            tmp_inflight_request_ptr->value = fetched_inflight_request_ptr->value;
+            tmp_inflight_request_ptr->is_cooperative_cached = fetched_inflight_request_ptr->is_cooperative_cached;
+            tmp_inflight_request_ptr->is_cooperative_cached_and_valid = fetched_inflight_request_ptr->is_cooperative_cached_and_valid;
+            tmp_inflight_request_ptr->get_cooperative_cache_latency_us = fetched_inflight_request_ptr->get_cooperative_cache_latency_us;
+            tmp_inflight_request_ptr->get_cloud_latency_us = fetched_inflight_request_ptr->get_cloud_latency_us;
+            tmp_inflight_request_ptr->fetch_bandwidth_bytes = fetched_inflight_request_ptr->fetch_bandwidth_bytes;
+        }
+
+        return;
+    }
+
+    bool CacheServerWorkerBase::finishCoalescedInflightGet_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+        assert(inflight_request_ptr->is_coalesced);
+        assert(!inflight_request_ptr->is_local_cached_and_valid);
+
+        // Count the coalesced request and the saved cross-edge/edge-cloud bandwidth usage
+        inflight_request_ptr->total_bandwidth_usage.updateCoalescedReqcntAndSavedBandwidth(inflight_request_ptr->fetch_bandwidth_bytes, 1);
+
+        // NOTE: NOT reuse best placement edgeset, hybrid fetching, and fast-path hint of the previous local get request, which has already triggered placement if any
+        const Edgeset tmp_best_placement_edgeset;
+        const bool tmp_need_hybrid_fetching = false;
+        const FastPathHint tmp_fast_path_hint;
+
+        // Update local edge cache, trigger cache management (with the miss latency of the previous local get request), and reply the client
+        bool is_finish = finishLocalGetRequest_(inflight_request_ptr->key, inflight_request_ptr->value, inflight_request_ptr->is_local_cached_and_valid, inflight_request_ptr->is_tracked_before_fetch_value, inflight_request_ptr->is_cooperative_cached, inflight_request_ptr->is_cooperative_cached_and_valid, tmp_best_placement_edgeset, tmp_need_hybrid_fetching, tmp_fast_path_hint, inflight_request_ptr->get_cooperative_cache_latency_us, inflight_request_ptr->get_cloud_latency_us, inflight_request_ptr->process_local_getreq_start_timestamp, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list, inflight_request_ptr->extra_common_msghdr, inflight_request_ptr->recvrsp_dst_addr);
+        if (is_finish)
+        {
+            return is_finish; // Edge is NOT running
+        }
+
+        return completeInflightRequest_(inflight_request_ptr);
+    }
+
+    // (0.2) In-flight local put/del requests (the same workflow as processLocalWriteRequest_() and acquireWritelock_())
+
+    bool CacheServerWorkerBase::startInflightWrite_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+
+        MessageBase* local_request_ptr = inflight_request_ptr->local_request_ptr;
+        assert(local_request_ptr != NULL);
+        if (inflight_request_ptr->message_type == MessageType::kLocalPutRequest)
+        {
+            const LocalPutRequest* const local_put_request_ptr = static_cast<const LocalPutRequest*>(local_request_ptr);
+            inflight_request_ptr->value = local_put_request_ptr->getValue();
+            assert(inflight_request_ptr->value.isDeleted() == false);
+        }
+        else
+        {
+            assert(inflight_request_ptr->message_type == MessageType::kLocalDelRequest);
+        }
+
+        #ifdef DEBUG_CACHE_SERVER_WORKER
+        Util::dumpVariablesForDebug(base_instance_name_, 5, "start an in-flight local write request;", "type:", MessageBase::messageTypeToString(local_request_ptr->getMessageType()).c_str(), "keystr:", inflight_request_ptr->key.getKeystr().c_str());
+        #endif
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        // Update total bandwidth usage for received local put/del request
+        uint32_t client_edge_local_req_bandwidth_bytes = local_request_ptr->getMsgBandwidthSize();
+        inflight_request_ptr->total_bandwidth_usage.update(BandwidthUsage(client_edge_local_req_bandwidth_bytes, 0, 0, 1, 0, 0, local_request_ptr->getMessageType(), local_request_ptr->getVictimSyncsetBytes()));
 
-        assert(cache_server_worker_ptr != NULL);
-        delete cache_server_worker_ptr;
-        cache_server_worker_ptr = NULL;
+        // Acquire write lock from beacon node no matter the locally cached object is valid or not, where the beacon will invalidate all other cache copies for cache coherence
+        inflight_request_ptr->acquire_writelock_start_timestamp = Util::getCurrentTimespec();
+        if (!Util::isSingleNodeCache(tmp_edge_wrapper_ptr->getCacheName()))
+        {
+            inflight_request_ptr->lock_result = LockResult::kFailure;
+            inflight_request_ptr->acquire_local_or_remote_writelock_start_timestamp = inflight_request_ptr->acquire_writelock_start_timestamp;
+            return acquireWritelockForInflightWrite_(inflight_request_ptr);
+        }
 
-        pthread_exit(NULL);
-        return NULL;
+        inflight_request_ptr->lock_result = LockResult::kNoneed;
+        return afterWritelockForInflightWrite_(inflight_request_ptr);
     }
 
-    CacheServerWorkerBase* CacheServerWorkerBase::getCacheServerWorkerByCacheName_(CacheServerWorkerParam* cache_server_worker_param_ptr)
+    bool CacheServerWorkerBase::acquireWritelockForInflightWrite_(InflightRequest* inflight_request_ptr)
     {
-        CacheServerWorkerBase* cache_server_worker_ptr = NULL;
+        assert(inflight_request_ptr != NULL);
 
-        assert(cache_server_worker_param_ptr != NULL);
-        std::string cache_name = cache_server_worker_param_ptr->getCacheServerPtr()->getEdgeWrapperPtr()->getCacheName();
-        if (cache_name == Util::COVERED_CACHE_NAME)
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        bool is_finish = false; // Mark if edge node is finished
+
+        if (!tmp_edge_wrapper_ptr->isNodeRunning()) // edge node is NOT running
         {
-            cache_server_worker_ptr = new CoveredCacheServerWorker(cache_server_worker_param_ptr);
+            is_finish = true;
+            return is_finish;
         }
-        else
+
+        if (tmp_edge_wrapper_ptr->currentIsBeacon(inflight_request_ptr->key)) // Acquire write permission from local directory information
         {
-            cache_server_worker_ptr = new BasicCacheServerWorker(cache_server_worker_param_ptr);
+            DirinfoSet all_dirinfo = DirinfoSet(std::list<DirectoryInfo>());
+            is_finish = acquireLocalWritelock_(inflight_request_ptr->key, inflight_request_ptr->lock_result, all_dirinfo, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list, inflight_request_ptr->extra_common_msghdr);
+            if (is_finish)
+            {
+                return is_finish; // Edge is NOT running
+            }
+
+            if (inflight_request_ptr->lock_result == LockResult::kFailure) // If key has been locked by any other edge node
+            {
+                // Try to acquire the write lock again in the next round of event loop instead of blocking other in-flight requests
+                inflight_request_ptr->stage = InflightStage::kInflightWaitForLocalRetry;
+                local_retry_list_.push_back(inflight_request_ptr);
+                return is_finish;
+            }
+            else if (inflight_request_ptr->lock_result == LockResult::kSuccess) // If acquire write permission successfully
+            {
+                // Invalidate all cache copies
+                return invalidateCacheCopiesForInflightWrite_(inflight_request_ptr, all_dirinfo);
+            }
+            // NOTE: will directly go ahead if lock result is kNoneed
+        }
+        else // Acquire write permission from the beacon node
+        {
+            issueInflightRemoteRequest_(inflight_request_ptr, InflightStage::kInflightWaitForAcquireWritelock); // Resumed by AcquireWritelockResponse
+            return is_finish;
         }
 
-        assert(cache_server_worker_ptr != NULL);
-        return cache_server_worker_ptr;
+        return afterWritelockForInflightWrite_(inflight_request_ptr);
     }
 
-    CacheServerWorkerBase::CacheServerWorkerBase(CacheServerWorkerParam* cache_server_worker_param_ptr) : cache_server_worker_param_ptr_(cache_server_worker_param_ptr)
+    bool CacheServerWorkerBase::afterWritelockForInflightWrite_(InflightRequest* inflight_request_ptr)
     {
-        assert(cache_server_worker_param_ptr != NULL);
-        const uint32_t edge_idx = cache_server_worker_param_ptr->getCacheServerPtr()->getEdgeWrapperPtr()->getNodeIdx();
-        const uint32_t edgecnt = cache_server_worker_param_ptr->getCacheServerPtr()->getEdgeWrapperPtr()->getNodeCnt();
-        const uint32_t local_cache_server_worker_idx = cache_server_worker_param_ptr->getLocalCacheServerWorkerIdx();
-        const uint32_t percacheserver_workercnt = cache_server_worker_param_ptr->getCacheServerPtr()->getEdgeWrapperPtr()->getPercacheserverWorkercnt();
+        assert(inflight_request_ptr != NULL);
+        assert(inflight_request_ptr->lock_result == LockResult::kSuccess || inflight_request_ptr->lock_result == LockResult::kNoneed);
 
-        // Differentiate cache servers of different edge nodes
-        std::ostringstream oss;
-        oss << kClassName << " edge" << edge_idx << "-worker" << cache_server_worker_param_ptr->getLocalCacheServerWorkerIdx();
-        base_instance_name_ = oss.str();
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
 
-        // Prepare destination address to the corresponding cloud
-        const bool is_private_cloud_ipstr = false; // NOTE: edge communicates with cloud via public IP address
-        const bool is_launch_cloud = false; // Just connect cloud by the logical edge node instead of launching the cloud
-        std::string cloud_ipstr = Config::getCloudIpstr(is_private_cloud_ipstr, is_launch_cloud);
-        uint16_t cloud_recvreq_port = Util::getCloudRecvreqPort(0); // TODO: only support 1 cloud node now!
-        corresponding_cloud_recvreq_dst_addr_ = NetworkAddr(cloud_ipstr, cloud_recvreq_port);
+        // Add intermediate events if with event tracking
+        struct timespec acquire_writelock_end_timestamp = Util::getCurrentTimespec();
+        if (!Util::isSingleNodeCache(tmp_edge_wrapper_ptr->getCacheName()))
+        {
+            const bool current_is_beacon = tmp_edge_wrapper_ptr->currentIsBeacon(inflight_request_ptr->key);
+            uint32_t acquire_local_or_remote_writelock_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(acquire_writelock_end_timestamp, inflight_request_ptr->acquire_local_or_remote_writelock_start_timestamp));
+            inflight_request_ptr->event_list.addEvent(current_is_beacon?Event::EDGE_CACHE_SERVER_WORKER_ACQUIRE_LOCAL_WRITELOCK_EVENT_NAME:Event::EDGE_CACHE_SERVER_WORKER_ACQUIRE_REMOTE_WRITELOCK_EVENT_NAME, acquire_local_or_remote_writelock_latency_us);
+        }
+        uint32_t acquire_writelock_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(acquire_writelock_end_timestamp, inflight_request_ptr->acquire_writelock_start_timestamp));
+        inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_ACQUIRE_WRITELOCK_EVENT_NAME, acquire_writelock_latency_us);
 
-        // For receiving control responses and redirected data responses
+        // Send request to cloud for write-through policy
+        inflight_request_ptr->write_cloud_start_timestamp = Util::getCurrentTimespec();
+        issueInflightRemoteRequest_(inflight_request_ptr, InflightStage::kInflightWaitForGlobalWrite); // Resumed by GlobalPutResponse/GlobalDelResponse
 
-        // Get source address of cache server worker to receive control responses and redirected data responses
-        const bool is_private_edge_ipstr = false; // NOTE: cross-edge and edge-cloud communication for control messages, request redirection, and global data messages use public IP address
-        const bool is_launch_edge = true; // The edge cache server worker belongs to the logical edge node launched in the current physical machine
-        std::string edge_ipstr = Config::getEdgeIpstr(edge_idx, edgecnt, is_private_edge_ipstr, is_launch_edge);
-        uint16_t edge_cache_server_worker_recvrsp_port = Util::getEdgeCacheServerWorkerRecvrspPort(edge_idx, edgecnt, local_cache_server_worker_idx, percacheserver_workercnt);
-        edge_cache_server_worker_recvrsp_source_addr_ = NetworkAddr(edge_ipstr, edge_cache_server_worker_recvrsp_port);
+        return false;
+    }
 
-        // Prepare a socket server to receive control responses and redirected data responses
-        NetworkAddr recvrsp_host_addr(Util::ANY_IPSTR, edge_cache_server_worker_recvrsp_port);
-        edge_cache_server_worker_recvrsp_socket_server_ptr_ = new UdpMsgSocketServer(recvrsp_host_addr);
-        assert(edge_cache_server_worker_recvrsp_socket_server_ptr_ != NULL);
+    bool CacheServerWorkerBase::afterCloudWriteForInflightWrite_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
 
-        // For receiving finish block requests
+        struct timespec write_cloud_end_timestamp = Util::getCurrentTimespec();
+        uint32_t write_cloud_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(write_cloud_end_timestamp, inflight_request_ptr->write_cloud_start_timestamp));
+        inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_WRITE_CLOUD_EVENT_NAME, write_cloud_latency_us); // Add intermediate event if with event tracking
 
-        // Get source address of cache server worker to receive finish block requests
-        uint16_t edge_cache_server_worker_recvreq_port = Util::getEdgeCacheServerWorkerRecvreqPort(edge_idx, edgecnt, local_cache_server_worker_idx, percacheserver_workercnt);
-        edge_cache_server_worker_recvreq_source_addr_ = NetworkAddr(edge_ipstr, edge_cache_server_worker_recvreq_port);
+        inflight_request_ptr->write_cloud_latency_us = write_cloud_latency_us;
 
-        // Prepare a socket server to receive finish block requests
-        NetworkAddr recvreq_host_addr(Util::ANY_IPSTR, edge_cache_server_worker_recvreq_port);
-        edge_cache_server_worker_recvreq_socket_server_ptr_ = new UdpMsgSocketServer(recvreq_host_addr);
-        assert(edge_cache_server_worker_recvreq_socket_server_ptr_ != NULL);
-    }
+        // Update local edge cache
+        bool is_finish = writeLocalEdgeCache_(inflight_request_ptr->key, inflight_request_ptr->value, inflight_request_ptr->message_type, inflight_request_ptr->lock_result, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list, inflight_request_ptr->extra_common_msghdr);
+        if (is_finish)
+        {
+            return is_finish; // Edge is NOT running
+        }
 
-    CacheServerWorkerBase::~CacheServerWorkerBase()
-    {
-        // NOTE: no need to release cache_server_worker_param_ptr_, which will be released outside CacheServerWorkerBase (by CacheServer)
+        // Notify beacon node to finish writes if acquiring write lock successfully
+        if (inflight_request_ptr->lock_result == LockResult::kSuccess)
+        {
+            return releaseWritelockForInflightWrite_(inflight_request_ptr);
+        }
 
-        // Release the socket server to receive control responses, redirected data responses, and global responses
-        assert(edge_cache_server_worker_recvrsp_socket_server_ptr_ != NULL);
-        delete edge_cache_server_worker_recvrsp_socket_server_ptr_;
-        edge_cache_server_worker_recvrsp_socket_server_ptr_ = NULL;
+        // Trigger cache management and reply the client
+        is_finish = replyLocalWriteRequest_(inflight_request_ptr->key, inflight_request_ptr->value, inflight_request_ptr->message_type, inflight_request_ptr->lock_result, inflight_request_ptr->write_cloud_latency_us, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list, inflight_request_ptr->extra_common_msghdr, inflight_request_ptr->recvrsp_dst_addr);
+        if (is_finish)
+        {
+            return is_finish; // Edge is NOT running
+        }
 
-        // Release the socket server to receive finish block requests
-        assert(edge_cache_server_worker_recvreq_socket_server_ptr_ != NULL);
-        delete edge_cache_server_worker_recvreq_socket_server_ptr_;
-        edge_cache_server_worker_recvreq_socket_server_ptr_ = NULL;
+        return completeInflightRequest_(inflight_request_ptr);
     }
 
-    void CacheServerWorkerBase::start()
+    bool CacheServerWorkerBase::invalidateCacheCopiesForInflightWrite_(InflightRequest* inflight_request_ptr, const DirinfoSet& all_dirinfo)
     {
+        assert(inflight_request_ptr != NULL);
+        assert(inflight_request_ptr->lock_result == LockResult::kSuccess);
+
         checkPointers_();
         EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
 
-        // Notify edge cache server that the current edge cache server worker has finished initialization
-        cache_server_worker_param_ptr_->markFinishInitialization();
+        inflight_request_ptr->fanout_start_timestamp = Util::getCurrentTimespec();
 
-        bool is_finish = false; // Mark if edge node is finished
-        while (tmp_edge_wrapper_ptr->isNodeRunning()) // edge_running_ is set as true by default
+        // Get dirinfo list from dirinfo set
+        std::list<DirectoryInfo> tmp_all_dirinfo_list;
+        bool with_complete_dirinfo_set = all_dirinfo.getDirinfoSetIfComplete(tmp_all_dirinfo_list);
+        assert(with_complete_dirinfo_set); // NOTE: dirinfo set from local directory table MUST be complete
+        UNUSED(with_complete_dirinfo_set);
+
+        // Check if exist any dirinfo to invalidate (the same as EdgeWrapperBase::parallelInvalidateCacheCopies())
+        if (tmp_all_dirinfo_list.size() == 0)
         {
-            // Try to get the data request from ring buffer partitioned by cache server
-            CacheServerItem tmp_cache_server_item;
-            bool is_successful = cache_server_worker_param_ptr_->getDataRequestBufferPtr()->pop(tmp_cache_server_item);
-            if (!is_successful)
-            {
-                continue; // Retry to receive an item if edge is still running
-            } // End of (is_successful == true)
-            else
-            {
-                MessageBase* data_request_ptr = tmp_cache_server_item.getRequestPtr();
-                assert(data_request_ptr != NULL);
+            return afterWritelockForInflightWrite_(inflight_request_ptr);
+        }
 
-                if (data_request_ptr->isLocalDataRequest()) // Local data requests (note that redirected data requests will be processed by cache server redirection processor)
-                {
-                    NetworkAddr recvrsp_dst_addr = data_request_ptr->getSourceAddr(); // client worker or cache server worker
-                    is_finish = processLocalDataRequest_(data_request_ptr, recvrsp_dst_addr);
-                }
-                else
+        // Invalidate local cache copy directly, while track whether invalidation requests to neighbors have been acknowledged
+        inflight_request_ptr->fanout_acked_flags.clear();
+        inflight_request_ptr->fanout_acked_edgecnt = 0;
+        for (std::list<DirectoryInfo>::const_iterator iter = tmp_all_dirinfo_list.begin(); iter != tmp_all_dirinfo_list.end(); iter++)
+        {
+            const uint32_t tmp_dst_edge_idx = iter->getTargetEdgeIdx();
+            if (tmp_dst_edge_idx == tmp_edge_wrapper_ptr->getNodeIdx()) // Invalidate local cache
+            {
+                if (tmp_edge_wrapper_ptr->getEdgeCachePtr()->isLocalCached(inflight_request_ptr->key))
                 {
-                    std::ostringstream oss;
-                    oss << "invalid message type " << MessageBase::messageTypeToString(data_request_ptr->getMessageType()) << " for start()!";
-                    Util::dumpErrorMsg(base_instance_name_, oss.str());
-                    exit(1);
+                    tmp_edge_wrapper_ptr->getEdgeCachePtr()->invalidateKeyForLocalCachedObject(inflight_request_ptr->key);
                 }
+            }
+            else // Issue request to invalidate remote cache
+            {
+                NetworkAddr tmp_edge_cache_server_recvreq_dst_addr = tmp_edge_wrapper_ptr->getTargetDstaddr(*iter);
+                inflight_request_ptr->fanout_acked_flags.insert(std::pair<NetworkAddr, std::pair<bool, uint32_t>>(tmp_edge_cache_server_recvreq_dst_addr, std::pair<bool, uint32_t>(false, tmp_dst_edge_idx)));
+            }
+        }
 
-                // Release data request by the corresponding cache server worker thread
-                assert(data_request_ptr != NULL);
-                delete data_request_ptr;
-                data_request_ptr = NULL;
+        if (inflight_request_ptr->fanout_acked_flags.empty()) // Only local cache copy
+        {
+            // Add intermediate event if with event tracking
+            struct timespec invalidate_cache_copies_end_timestamp = Util::getCurrentTimespec();
+            uint32_t invalidate_cache_copies_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(invalidate_cache_copies_end_timestamp, inflight_request_ptr->fanout_start_timestamp));
+            inflight_request_ptr->event_list.addEvent(Event::EDGE_INVALIDATE_CACHE_COPIES_EVENT_NAME, invalidate_cache_copies_latency_us);
 
-                if (is_finish) // Check is_finish
-                {
-                    continue; // Go to check if edge is still running
-                }
-            } // End of (is_successful == false)
-        } // End of while loop
+            return afterWritelockForInflightWrite_(inflight_request_ptr);
+        }
 
-        return;
+        issueInflightRemoteRequest_(inflight_request_ptr, InflightStage::kInflightWaitForInvalidation); // Resumed by InvalidationResponses of all neighbors
+        return false;
     }
 
-    bool CacheServerWorkerBase::processLocalDataRequest_(MessageBase* data_request_ptr, const NetworkAddr& recvrsp_dst_addr)
+    bool CacheServerWorkerBase::releaseWritelockForInflightWrite_(InflightRequest* inflight_request_ptr)
     {
-        assert(data_request_ptr != NULL && data_request_ptr->isLocalDataRequest());
-        assert(recvrsp_dst_addr.isValidAddr());
+        assert(inflight_request_ptr != NULL);
+        assert(inflight_request_ptr->lock_result == LockResult::kSuccess);
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
 
         bool is_finish = false; // Mark if edge node is finished
 
-        const MessageType message_type = data_request_ptr->getMessageType();
-        if (message_type == MessageType::kLocalGetRequest)
+        if (!tmp_edge_wrapper_ptr->isNodeRunning()) // edge node is NOT running
         {
-            is_finish = processLocalGetRequest_(data_request_ptr, recvrsp_dst_addr);
+            is_finish = true;
+            return is_finish;
         }
-        else if (message_type == MessageType::kLocalPutRequest || data_request_ptr->getMessageType() == MessageType::kLocalDelRequest) // Local put/del request
+
+        inflight_request_ptr->release_writelock_start_timestamp = Util::getCurrentTimespec();
+        inflight_request_ptr->release_local_or_remote_writelock_start_timestamp = inflight_request_ptr->release_writelock_start_timestamp;
+
+        if (tmp_edge_wrapper_ptr->currentIsBeacon(inflight_request_ptr->key)) // Release write lock in local directory information
         {
-            is_finish = processLocalWriteRequest_(data_request_ptr, recvrsp_dst_addr);
+            // Release write lock and get blocked edges
+            std::unordered_set<NetworkAddr, NetworkAddrHasher> blocked_edges;
+            is_finish = releaseLocalWritelock_(inflight_request_ptr->key, inflight_request_ptr->value, blocked_edges, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list, inflight_request_ptr->extra_common_msghdr);
+            if (is_finish)
+            {
+                return is_finish; // Edge is NOT running
+            }
+
+            // Notify blocked edge nodes to finish blocking if any
+            if (!blocked_edges.empty())
+            {
+                inflight_request_ptr->fanout_start_timestamp = Util::getCurrentTimespec();
+                inflight_request_ptr->fanout_acked_flags.clear();
+                inflight_request_ptr->fanout_acked_edgecnt = 0;
+                for (std::unordered_set<NetworkAddr, NetworkAddrHasher>::const_iterator iter = blocked_edges.begin(); iter != blocked_edges.end(); iter++)
+                {
+                    const bool is_private_edge_ipstr = false; // NOTE: IP address for finishing blocking under MSI comes from directory lookup/update and acquire/release writelock requests, which MUST be public due to cross-edge communication
+                    const uint32_t tmp_dst_edge_idx = Util::getEdgeIdxFromCacheServerWorkerRecvreqAddr(*iter, is_private_edge_ipstr, tmp_edge_wrapper_ptr->getNodeCnt());
+
+                    // NOTE: dst edge idx to finish blocking MUST NOT be the current local beacon edge node, as requests on a being-written object MUST poll instead of block if sender is beacon
+                    assert(tmp_dst_edge_idx != tmp_edge_wrapper_ptr->getNodeIdx());
+
+                    inflight_request_ptr->fanout_acked_flags.insert(std::pair<NetworkAddr, std::pair<bool, uint32_t>>(*iter, std::pair<bool, uint32_t>(false, tmp_dst_edge_idx)));
+                }
+
+                issueInflightRemoteRequest_(inflight_request_ptr, InflightStage::kInflightWaitForNotifyFinishBlock); // Resumed by FinishBlockResponses of all blocked edges
+                return is_finish;
+            }
         }
-        else
+        else // Release write lock at the beacon node
         {
-            std::ostringstream oss;
-            oss << "invalid message type " << MessageBase::messageTypeToString(message_type) << " for processLocalDataRequest_()!";
-            Util::dumpErrorMsg(base_instance_name_, oss.str());
-            exit(1);
+            // NOTE: beacon server of beacon node will notify all blocked edges -> NO need to notify them again in cache server
+            issueInflightRemoteRequest_(inflight_request_ptr, InflightStage::kInflightWaitForReleaseWritelock); // Resumed by ReleaseWritelockResponse
+            return is_finish;
         }
-        
-        return is_finish;
+
+        return afterReleaseWritelockForInflightWrite_(inflight_request_ptr);
+    }
+
+    bool CacheServerWorkerBase::afterReleaseWritelockForInflightWrite_(InflightRequest* inflight_request_ptr)
+    {
+        assert(inflight_request_ptr != NULL);
+        assert(inflight_request_ptr->lock_result == LockResult::kSuccess);
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        // Add intermediate events if with event tracking
+        struct timespec release_writelock_end_timestamp = Util::getCurrentTimespec();
+        const bool current_is_beacon = tmp_edge_wrapper_ptr->currentIsBeacon(inflight_request_ptr->key);
+        uint32_t release_local_or_remote_writelock_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(release_writelock_end_timestamp, inflight_request_ptr->release_local_or_remote_writelock_start_timestamp));
+        inflight_request_ptr->event_list.addEvent(current_is_beacon?Event::EDGE_CACHE_SERVER_WORKER_RELEASE_LOCAL_WRITELOCK_EVENT_NAME:Event::EDGE_CACHE_SERVER_WORKER_RELEASE_REMOTE_WRITELOCK_EVENT_NAME, release_local_or_remote_writelock_latency_us);
+        uint32_t release_writelock_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(release_writelock_end_timestamp, inflight_request_ptr->release_writelock_start_timestamp));
+        inflight_request_ptr->event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_RELEASE_WRITELOCK_EVENT_NAME, release_writelock_latency_us);
+
+        // Trigger cache management and reply the client
+        bool is_finish = replyLocalWriteRequest_(inflight_request_ptr->key, inflight_request_ptr->value, inflight_request_ptr->message_type, inflight_request_ptr->lock_result, inflight_request_ptr->write_cloud_latency_us, inflight_request_ptr->total_bandwidth_usage, inflight_request_ptr->event_list, inflight_request_ptr->extra_common_msghdr, inflight_request_ptr->recvrsp_dst_addr);
+        if (is_finish)
+        {
+            return is_finish; // Edge is NOT running
+        }
+
+        return completeInflightRequest_(inflight_request_ptr);
     }
 
     // (1) Process read requests
@@ -217,7 +1700,6 @@ namespace covered
         EdgeWrapperBase* tmp_edge_wrapper_ptr = tmp_cache_server_ptr->getEdgeWrapperPtr();
 
         bool is_finish = false; // Mark if edge node is finished
-        Hitflag hitflag = Hitflag::kGlobalMiss;
         BandwidthUsage total_bandwidth_usage;
         EventList event_list;
 
@@ -229,11 +1711,7 @@ namespace covered
         struct timespec get_local_cache_start_timestamp = Util::getCurrentTimespec();
         const bool is_redirected = false;
         bool is_tracked_before_fetch_value = false;
-        bool is_local_cached_and_valid = tmp_edge_wrapper_ptr->getLocalEdgeCache_(tmp_key, is_redirected, tmp_value, is_tracked_before_fetch_value);
-        if (is_local_cached_and_valid) // local cached and valid
-        {
-            hitflag = Hitflag::kLocalHit;
-        }
+        bool is_local_cached_and_valid = tmp_edge_wrapper_ptr->getLocalEdgeCache_(tmp_key, is_redirected, tmp_value, is_tracked_before_fetch_value); // NOTE: hitflag is decided by finishLocalGetRequest_()
         struct timespec get_local_cache_end_timestamp = Util::getCurrentTimespec();
         uint32_t get_local_cache_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(get_local_cache_end_timestamp, get_local_cache_start_timestamp));
         event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_GET_LOCAL_CACHE_EVENT_NAME, get_local_cache_latency_us); // Add intermediate event if with event tracking
@@ -265,7 +1743,6 @@ namespace covered
             assert(!(is_cooperative_cached && !is_cooperative_valid)); // Cooperative cached yet invalid MUST be blocked by redirectGetToTarget_()
             if (is_cooperative_cached && is_cooperative_valid) // cooperative cached and valid
             {
-                hitflag = Hitflag::kCooperativeHit;
                 is_cooperative_cached_and_valid = true;
             }
 
@@ -292,13 +1769,36 @@ namespace covered
         uint32_t get_cloud_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(get_cloud_end_timestamp, get_cloud_start_timestamp));
         event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_GET_CLOUD_EVENT_NAME, get_cloud_latency_us); // Add intermediate event if with event tracking
 
+        // Update local edge cache, trigger cache management, and reply the client
+        is_finish = finishLocalGetRequest_(tmp_key, tmp_value, is_local_cached_and_valid, is_tracked_before_fetch_value, is_cooperative_cached, is_cooperative_cached_and_valid, best_placement_edgeset, need_hybrid_fetching, fast_path_hint, get_cooperative_cache_latency_us, get_cloud_latency_us, process_local_getreq_start_timestamp, total_bandwidth_usage, event_list, extra_common_msghdr, recvrsp_dst_addr);
+
+        return is_finish;
+    }
+
+    bool CacheServerWorkerBase::finishLocalGetRequest_(const Key& key, const Value& value, const bool& is_local_cached_and_valid, const bool& is_tracked_before_fetch_value, const bool& is_cooperative_cached, const bool& is_cooperative_cached_and_valid, const Edgeset& best_placement_edgeset, const bool& need_hybrid_fetching, const FastPathHint& fast_path_hint, const uint32_t& get_cooperative_cache_latency_us, const uint32_t& get_cloud_latency_us, const struct timespec& process_local_getreq_start_timestamp, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr, const NetworkAddr& recvrsp_dst_addr) const
+    {
+        checkPointers_();
+        CacheServerBase* tmp_cache_server_ptr = cache_server_worker_param_ptr_->getCacheServerPtr();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = tmp_cache_server_ptr->getEdgeWrapperPtr();
+
+        bool is_finish = false; // Mark if edge node is finished
+        Hitflag hitflag = Hitflag::kGlobalMiss;
+        if (is_local_cached_and_valid)
+        {
+            hitflag = Hitflag::kLocalHit;
+        }
+        else if (is_cooperative_cached_and_valid)
+        {
+            hitflag = Hitflag::kCooperativeHit;
+        }
+
         // Update invalid object of local edge cache if necessary
         struct timespec update_invalid_local_cache_start_timestamp = Util::getCurrentTimespec();
-        const bool is_global_cached = (tmp_edge_wrapper_ptr->getEdgeCachePtr()->isLocalCached(tmp_key) || is_cooperative_cached);
-        bool is_local_cached_and_invalid = tryToUpdateInvalidLocalEdgeCache_(tmp_key, tmp_value, is_global_cached); // NOTE: this may update local uncached metadata and may trigger fast-path placement calculation for COVERED
-        if (!tmp_value.isDeleted() && is_local_cached_and_invalid) // Update may trigger eviction
+        const bool is_global_cached = (tmp_edge_wrapper_ptr->getEdgeCachePtr()->isLocalCached(key) || is_cooperative_cached);
+        bool is_local_cached_and_invalid = tryToUpdateInvalidLocalEdgeCache_(key, value, is_global_cached); // NOTE: this may update local uncached metadata and may trigger fast-path placement calculation for COVERED
+        if (!value.isDeleted() && is_local_cached_and_invalid) // Update may trigger eviction
         {
-            is_finish = tmp_cache_server_ptr->evictForCapacity_(tmp_key, edge_cache_server_worker_recvrsp_source_addr_, edge_cache_server_worker_recvrsp_socket_server_ptr_, total_bandwidth_usage, event_list, extra_common_msghdr); // Add events of intermediate response if with event tracking
+            is_finish = tryToEvictForCapacity_(key, total_bandwidth_usage, event_list, extra_common_msghdr); // Add events of intermediate response if with event tracking
         }
         if (is_finish)
         {
@@ -326,7 +1826,7 @@ namespace covered
                 miss_latency_us += tmp_edge_wrapper_ptr->getEdgeTocloudPropagationSimulatorParamPtr()->genPropagationLatency();
             }
         }
-        is_finish = afterFetchingValue_(tmp_key, tmp_value, is_tracked_before_fetch_value, is_cooperative_cached, best_placement_edgeset, need_hybrid_fetching, fast_path_hint, total_bandwidth_usage, event_list, extra_common_msghdr, miss_latency_us); // NOTE: MUST after tryToUpdateInvalidLocalEdgeCache_() for potential fast-path placement calculation for COVERED
+        is_finish = afterFetchingValue_(key, value, is_tracked_before_fetch_value, is_cooperative_cached, best_placement_edgeset, need_hybrid_fetching, fast_path_hint, total_bandwidth_usage, event_list, extra_common_msghdr, miss_latency_us); // NOTE: MUST after tryToUpdateInvalidLocalEdgeCache_() for potential fast-path placement calculation for COVERED
         if (is_finish)
         {
             return is_finish;
@@ -341,7 +1841,7 @@ namespace covered
         uint64_t capacity_bytes = tmp_edge_wrapper_ptr->getCapacityBytes();
         uint32_t edge_idx = tmp_edge_wrapper_ptr->getNodeIdx();
         NetworkAddr edge_cache_server_recvreq_source_addr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeCacheServerRecvreqPrivateSourceAddr(); // NOTE: the closest edge communicates client via private IP address
-        MessageBase* local_get_response_ptr = new LocalGetResponse(tmp_key, tmp_value, hitflag, used_bytes, capacity_bytes, edge_idx, edge_cache_server_recvreq_source_addr, total_bandwidth_usage, event_list, extra_common_msghdr); // NOTE: extra_common_msghdr has msg seqnum assigned by client worker
+        MessageBase* local_get_response_ptr = new LocalGetResponse(key, value, hitflag, used_bytes, capacity_bytes, edge_idx, edge_cache_server_recvreq_source_addr, total_bandwidth_usage, event_list, extra_common_msghdr); // NOTE: extra_common_msghdr has msg seqnum assigned by client worker
         assert(local_get_response_ptr != NULL);
 
         // Push local response message into edge-to-client propagation simulator to a client
@@ -349,7 +1849,7 @@ namespace covered
         assert(is_successful);
 
         #ifdef DEBUG_CACHE_SERVER_WORKER
-        Util::dumpVariablesForDebug(base_instance_name_, 5, "issue a local response;", "type:", MessageBase::messageTypeToString(local_get_response_ptr->getMessageType()).c_str(), "keystr:", tmp_key.getKeystr().c_str());
+        Util::dumpVariablesForDebug(base_instance_name_, 5, "issue a local response;", "type:", MessageBase::messageTypeToString(local_get_response_ptr->getMessageType()).c_str(), "keystr:", key.getKeystr().c_str());
         #endif
 
         // NOTE: local_get_response_ptr will be released by edge-to-client propagation simulator
@@ -540,7 +2040,7 @@ namespace covered
 
             if (!is_stale_response)
             {
-                MessageBase* directory_lookup_request_ptr = getReqToLookupBeaconDirectory_(key, tmp_extra_common_msghdr);
+                MessageBase* directory_lookup_request_ptr = getReqToLookupBeaconDirectory_(key, edge_cache_server_worker_recvrsp_source_addr_, tmp_extra_common_msghdr);
                 assert(directory_lookup_request_ptr != NULL);
 
                 #ifdef DEBUG_CACHE_SERVER_WORKER
@@ -594,44 +2094,57 @@ namespace covered
                     continue; // Jump to while loop
                 }
 
-                // Update cross-edge latency for latency-aware weight tuning if NOT timeout
-                const struct timespec tmp_content_discovery_end_timestamp = Util::getCurrentTimespec();
-                const double tmp_content_discovery_cross_edge_rtt_us = Util::getDeltaTimeUs(tmp_content_discovery_end_timestamp, tmp_content_discovery_start_timestamp);
-                uint32_t tmp_content_discovery_cross_edge_latency_us = static_cast<uint32_t>(tmp_content_discovery_cross_edge_rtt_us);
-                if (extra_common_msghdr.isSkipPropagationLatency()) // Compensate propagation latency for warmup speedup
-                {
-                    // NOTE: cross-edge propagation latency from CLI is already a round-trip latency, which should NOT be counted twice for RTT
-                    // tmp_content_discovery_cross_edge_latency_us += tmp_edge_wrapper_ptr->getPropagationLatencyCrossedgeAvgUs();
-                    
-                    // NOTE: follow the dynamic latency distribution with a unique random seed to simulate RTT during warmup phase
-                    tmp_content_discovery_cross_edge_latency_us += tmp_edge_wrapper_ptr->getEdgeToedgePropagationSimulatorParamPtr()->genPropagationLatency();
-                }
-
-                processRspToLookupBeaconDirectory_(control_response_ptr, is_being_written, is_valid_directory_exist, directory_info, best_placement_edgeset, need_hybrid_fetching, fast_path_hint, tmp_content_discovery_cross_edge_latency_us);
-
-                // Update total bandwidth usage for received directory lookup response
-                BandwidthUsage directory_lookup_response_bandwidth_usage = control_response_ptr->getBandwidthUsageRef();
-                uint32_t cross_edge_directory_lookup_rsp_bandwidth_bytes = control_response_ptr->getMsgBandwidthSize();
-                directory_lookup_response_bandwidth_usage.update(BandwidthUsage(0, cross_edge_directory_lookup_rsp_bandwidth_bytes, 0, 0, 1, 0, control_response_ptr->getMessageType(), control_response_ptr->getVictimSyncsetBytes()));
-                total_bandwidth_usage.update(directory_lookup_response_bandwidth_usage);
-
-                // Add events of intermediate response if with event tracking
-                event_list.addEvents(control_response_ptr->getEventListRef());
+                // Get directory info, update total bandwidth usage, and add events of intermediate response if with event tracking
+                processDirectoryLookupResponse_(control_response_ptr, tmp_content_discovery_start_timestamp, is_being_written, is_valid_directory_exist, directory_info, best_placement_edgeset, need_hybrid_fetching, fast_path_hint, total_bandwidth_usage, event_list, extra_common_msghdr);
 
                 // Release the control response message
                 delete control_response_ptr;
                 control_response_ptr = NULL;
 
-                break;
-            } // End of (is_timeout == false)
-        } // End of while(true)
+                break;
+            } // End of (is_timeout == false)
+        } // End of while(true)
+
+        // Add intermediate event if with event tracking
+        struct timespec issue_directory_lookup_req_end_timestamp = Util::getCurrentTimespec();
+        uint32_t issue_directory_lookup_req_latency_us = Util::getDeltaTimeUs(issue_directory_lookup_req_end_timestamp, issue_directory_lookup_req_start_timestamp);
+        event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_ISSUE_DIRECTORY_LOOKUP_REQ_EVENT_NAME, issue_directory_lookup_req_latency_us);
+
+        return is_finish;
+    }
+
+    void CacheServerWorkerBase::processDirectoryLookupResponse_(MessageBase* control_response_ptr, const struct timespec& content_discovery_start_timestamp, bool& is_being_written, bool& is_valid_directory_exist, DirectoryInfo& directory_info, Edgeset& best_placement_edgeset, bool& need_hybrid_fetching, FastPathHint& fast_path_hint, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const
+    {
+        assert(control_response_ptr != NULL);
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        // Update cross-edge latency for latency-aware weight tuning if NOT timeout
+        const struct timespec tmp_content_discovery_end_timestamp = Util::getCurrentTimespec();
+        const double tmp_content_discovery_cross_edge_rtt_us = Util::getDeltaTimeUs(tmp_content_discovery_end_timestamp, content_discovery_start_timestamp);
+        uint32_t tmp_content_discovery_cross_edge_latency_us = static_cast<uint32_t>(tmp_content_discovery_cross_edge_rtt_us);
+        if (extra_common_msghdr.isSkipPropagationLatency()) // Compensate propagation latency for warmup speedup
+        {
+            // NOTE: cross-edge propagation latency from CLI is already a round-trip latency, which should NOT be counted twice for RTT
+            // tmp_content_discovery_cross_edge_latency_us += tmp_edge_wrapper_ptr->getPropagationLatencyCrossedgeAvgUs();
+            
+            // NOTE: follow the dynamic latency distribution with a unique random seed to simulate RTT during warmup phase
+            tmp_content_discovery_cross_edge_latency_us += tmp_edge_wrapper_ptr->getEdgeToedgePropagationSimulatorParamPtr()->genPropagationLatency();
+        }
+
+        processRspToLookupBeaconDirectory_(control_response_ptr, is_being_written, is_valid_directory_exist, directory_info, best_placement_edgeset, need_hybrid_fetching, fast_path_hint, tmp_content_discovery_cross_edge_latency_us);
 
-        // Add intermediate event if with event tracking
-        struct timespec issue_directory_lookup_req_end_timestamp = Util::getCurrentTimespec();
-        uint32_t issue_directory_lookup_req_latency_us = Util::getDeltaTimeUs(issue_directory_lookup_req_end_timestamp, issue_directory_lookup_req_start_timestamp);
-        event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_ISSUE_DIRECTORY_LOOKUP_REQ_EVENT_NAME, issue_directory_lookup_req_latency_us);
+        // Update total bandwidth usage for received directory lookup response
+        BandwidthUsage directory_lookup_response_bandwidth_usage = control_response_ptr->getBandwidthUsageRef();
+        uint32_t cross_edge_directory_lookup_rsp_bandwidth_bytes = control_response_ptr->getMsgBandwidthSize();
+        directory_lookup_response_bandwidth_usage.update(BandwidthUsage(0, cross_edge_directory_lookup_rsp_bandwidth_bytes, 0, 0, 1, 0, control_response_ptr->getMessageType(), control_response_ptr->getVictimSyncsetBytes()));
+        total_bandwidth_usage.update(directory_lookup_response_bandwidth_usage);
 
-        return is_finish;
+        // Add events of intermediate response if with event tracking
+        event_list.addEvents(control_response_ptr->getEventListRef());
+
+        return;
     }
 
     bool CacheServerWorkerBase::redirectGetToTarget_(const DirectoryInfo& directory_info, const Key& key, Value& value, bool& is_cooperative_cached, bool& is_valid, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const
@@ -663,7 +2176,7 @@ namespace covered
             if (!is_stale_response)
             {
                 // Prepare redirected get request to get data from target edge node if any
-                MessageBase* redirected_get_request_ptr = getReqToRedirectGet_(directory_info.getTargetEdgeIdx(), key, tmp_extra_common_msghdr);
+                MessageBase* redirected_get_request_ptr = getReqToRedirectGet_(directory_info.getTargetEdgeIdx(), key, edge_cache_server_worker_recvrsp_source_addr_, tmp_extra_common_msghdr);
                 assert(redirected_get_request_ptr != NULL);
 
                 // Push the redirected data request into edge-to-edge propagation simulator to target node
@@ -713,60 +2226,8 @@ namespace covered
                     continue; // Jump to while loop
                 }
 
-                // Update cross-edge latency for latency-aware weight tuning if NOT timeout
-                const struct timespec tmp_request_direction_end_timestamp = Util::getCurrentTimespec();
-                const double tmp_request_redirection_cross_edge_rtt_us = Util::getDeltaTimeUs(tmp_request_direction_end_timestamp, tmp_request_redirection_start_timestamp);
-                uint32_t tmp_request_redirection_cross_edge_latency_us = static_cast<uint32_t>(tmp_request_redirection_cross_edge_rtt_us);
-                if (extra_common_msghdr.isSkipPropagationLatency()) // Compensate propagation latency for warmup speedup
-                {
-                    // NOTE: cross-edge propagation latency from CLI is already a round-trip latency, which should NOT be counted twice for RTT
-                    // tmp_request_redirection_cross_edge_latency_us += tmp_edge_wrapper_ptr->getPropagationLatencyCrossedgeAvgUs();
-
-                    // NOTE: follow the dynamic latency distribution with a unique random seed to simulate RTT during warmup phase
-                    tmp_request_redirection_cross_edge_latency_us += tmp_edge_wrapper_ptr->getEdgeToedgePropagationSimulatorParamPtr()->genPropagationLatency();
-                }
-
-                // Get value and hitflag from redirected response message
-                Hitflag hitflag = Hitflag::kGlobalMiss;
-                processRspToRedirectGet_(redirected_response_ptr, value, hitflag, tmp_request_redirection_cross_edge_latency_us);
-
-                // Judge if key is cooperative cached and valid in the neighbor edge node
-                if (hitflag == Hitflag::kCooperativeHit)
-                {
-                    is_cooperative_cached = true;
-                    is_valid = true;
-                }
-                else if (hitflag == Hitflag::kCooperativeInvalid)
-                {
-                    is_cooperative_cached = true;
-                    is_valid = false;
-                }
-                else if (hitflag == Hitflag::kGlobalMiss)
-                {
-                    // NOTE: this is a minor yet normal case, as the target edge node has evicted the object yet the directory info in the beacon edge node has not been updated yet before answering the directory lookup request
-                    std::ostringstream oss;
-                    oss << "redirectGetToTarget_(): target edge node does not cache the key " << key.getKeyDebugstr() << ", which may be already evicted after directory lookup yet before request redirection";
-                    Util::dumpInfoMsg(base_instance_name_, oss.str());
-
-                    is_cooperative_cached = false;
-                    is_valid = false;
-                }
-                else
-                {
-                    std::ostringstream oss;
-                    oss << "invalid hitflag " << MessageBase::hitflagToString(hitflag) << " for redirectGetToTarget_()!";
-                    Util::dumpErrorMsg(base_instance_name_, oss.str());
-                    exit(1);
-                }
-
-                // Update total bandwidth usage for received redirected get response
-                BandwidthUsage redirected_get_response_bandwidth_usage = redirected_response_ptr->getBandwidthUsageRef();
-                uint32_t cross_edge_redirected_get_rsp_bandwidth_bytes = redirected_response_ptr->getMsgBandwidthSize();
-                redirected_get_response_bandwidth_usage.update(BandwidthUsage(0, cross_edge_redirected_get_rsp_bandwidth_bytes, 0, 0, 1, 0, redirected_response_ptr->getMessageType(), redirected_response_ptr->getVictimSyncsetBytes()));
-                total_bandwidth_usage.update(redirected_get_response_bandwidth_usage);
-
-                // Add events of intermediate response if with event tracking
-                event_list.addEvents(redirected_response_ptr->getEventListRef());
+                // Get value and cooperative cache status, update total bandwidth usage, and add events of intermediate response if with event tracking
+                processRedirectedGetResponse_(redirected_response_ptr, tmp_request_redirection_start_timestamp, key, value, is_cooperative_cached, is_valid, total_bandwidth_usage, event_list, extra_common_msghdr);
 
                 // Release the redirected response message
                 delete redirected_response_ptr;
@@ -783,6 +2244,71 @@ namespace covered
         return is_finish;
     }
 
+    void CacheServerWorkerBase::processRedirectedGetResponse_(MessageBase* redirected_response_ptr, const struct timespec& request_redirection_start_timestamp, const Key& key, Value& value, bool& is_cooperative_cached, bool& is_valid, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const
+    {
+        assert(redirected_response_ptr != NULL);
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        // Update cross-edge latency for latency-aware weight tuning if NOT timeout
+        const struct timespec tmp_request_direction_end_timestamp = Util::getCurrentTimespec();
+        const double tmp_request_redirection_cross_edge_rtt_us = Util::getDeltaTimeUs(tmp_request_direction_end_timestamp, request_redirection_start_timestamp);
+        uint32_t tmp_request_redirection_cross_edge_latency_us = static_cast<uint32_t>(tmp_request_redirection_cross_edge_rtt_us);
+        if (extra_common_msghdr.isSkipPropagationLatency()) // Compensate propagation latency for warmup speedup
+        {
+            // NOTE: cross-edge propagation latency from CLI is already a round-trip latency, which should NOT be counted twice for RTT
+            // tmp_request_redirection_cross_edge_latency_us += tmp_edge_wrapper_ptr->getPropagationLatencyCrossedgeAvgUs();
+
+            // NOTE: follow the dynamic latency distribution with a unique random seed to simulate RTT during warmup phase
+            tmp_request_redirection_cross_edge_latency_us += tmp_edge_wrapper_ptr->getEdgeToedgePropagationSimulatorParamPtr()->genPropagationLatency();
+        }
+
+        // Get value and hitflag from redirected response message
+        Hitflag hitflag = Hitflag::kGlobalMiss;
+        processRspToRedirectGet_(redirected_response_ptr, value, hitflag, tmp_request_redirection_cross_edge_latency_us);
+
+        // Judge if key is cooperative cached and valid in the neighbor edge node
+        if (hitflag == Hitflag::kCooperativeHit)
+        {
+            is_cooperative_cached = true;
+            is_valid = true;
+        }
+        else if (hitflag == Hitflag::kCooperativeInvalid)
+        {
+            is_cooperative_cached = true;
+            is_valid = false;
+        }
+        else if (hitflag == Hitflag::kGlobalMiss)
+        {
+            // NOTE: this is a minor yet normal case, as the target edge node has evicted the object yet the directory info in the beacon edge node has not been updated yet before answering the directory lookup request
+            std::ostringstream oss;
+            oss << "redirectGetToTarget_(): target edge node does not cache the key " << key.getKeyDebugstr() << ", which may be already evicted after directory lookup yet before request redirection";
+            Util::dumpInfoMsg(base_instance_name_, oss.str());
+
+            is_cooperative_cached = false;
+            is_valid = false;
+        }
+        else
+        {
+            std::ostringstream oss;
+            oss << "invalid hitflag " << MessageBase::hitflagToString(hitflag) << " for redirectGetToTarget_()!";
+            Util::dumpErrorMsg(base_instance_name_, oss.str());
+            exit(1);
+        }
+
+        // Update total bandwidth usage for received redirected get response
+        BandwidthUsage redirected_get_response_bandwidth_usage = redirected_response_ptr->getBandwidthUsageRef();
+        uint32_t cross_edge_redirected_get_rsp_bandwidth_bytes = redirected_response_ptr->getMsgBandwidthSize();
+        redirected_get_response_bandwidth_usage.update(BandwidthUsage(0, cross_edge_redirected_get_rsp_bandwidth_bytes, 0, 0, 1, 0, redirected_response_ptr->getMessageType(), redirected_response_ptr->getVictimSyncsetBytes()));
+        total_bandwidth_usage.update(redirected_get_response_bandwidth_usage);
+
+        // Add events of intermediate response if with event tracking
+        event_list.addEvents(redirected_response_ptr->getEventListRef());
+
+        return;
+    }
+
     // (1.3) Access cloud
 
     bool CacheServerWorkerBase::fetchDataFromCloud_(const Key& key, Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const
@@ -867,34 +2393,8 @@ namespace covered
                     continue; // Jump to while loop
                 }
 
-                // Update edge-cloud latency for latency-aware weight tuning if NOT timeout
-                const struct timespec tmp_cloud_access_end_timestamp = Util::getCurrentTimespec();
-                const double tmp_cloud_access_edge_cloud_rtt_us = Util::getDeltaTimeUs(tmp_cloud_access_end_timestamp, tmp_cloud_access_start_timestamp);
-                uint32_t tmp_cloud_access_edge_cloud_latency_us = static_cast<uint32_t>(tmp_cloud_access_edge_cloud_rtt_us);
-                if (extra_common_msghdr.isSkipPropagationLatency()) // Compensate propagation latency for warmup speedup
-                {
-                    // NOTE: edge-cloud propagation latency from CLI is already a round-trip latency, which should NOT be counted twice for RTT
-                    // tmp_cloud_access_edge_cloud_latency_us += tmp_edge_wrapper_ptr->getPropagationLatencyEdgecloudAvgUs();
-
-                    // NOTE: follow the dynamic latency distribution with a unique random seed to simulate RTT during warmup phase
-                    tmp_cloud_access_edge_cloud_latency_us += tmp_edge_wrapper_ptr->getEdgeTocloudPropagationSimulatorParamPtr()->genPropagationLatency();
-                }
-
-                // Get value from global response message
-                processRspToAccessCloud_(global_response_ptr, value, tmp_cloud_access_edge_cloud_latency_us);
-
-                // Update total bandwidth usage for received global get response
-                BandwidthUsage global_response_bandwidth_usage = global_response_ptr->getBandwidthUsageRef();
-                uint32_t edge_cloud_global_rsp_bandwidth_bytes = global_response_ptr->getMsgBandwidthSize();
-                global_response_bandwidth_usage.update(BandwidthUsage(0, 0, edge_cloud_global_rsp_bandwidth_bytes, 0, 0, 1, global_response_ptr->getMessageType(), global_response_ptr->getVictimSyncsetBytes()));
-                total_bandwidth_usage.update(global_response_bandwidth_usage);
-
-                // Add events of intermediate response if with event tracking
-                event_list.addEvents(global_response_ptr->getEventListRef());
-
-                #ifdef DEBUG_CACHE_SERVER_WORKER
-                Util::dumpVariablesForDebug(base_instance_name_, 5, "receive a global response", "type:", MessageBase::messageTypeToString(global_response_ptr->getMessageType()).c_str(), "keystr:", global_get_response_ptr->getKey().getKeystr().c_str());
-                #endif
+                // Get value, update total bandwidth usage, and add events of intermediate response if with event tracking
+                processGlobalGetResponse_(global_response_ptr, tmp_cloud_access_start_timestamp, value, total_bandwidth_usage, event_list, extra_common_msghdr);
 
                 // Release global response message
                 delete global_response_ptr;
@@ -911,6 +2411,45 @@ namespace covered
         return is_finish;
     }
 
+    void CacheServerWorkerBase::processGlobalGetResponse_(MessageBase* global_response_ptr, const struct timespec& cloud_access_start_timestamp, Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const
+    {
+        assert(global_response_ptr != NULL);
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        // Update edge-cloud latency for latency-aware weight tuning if NOT timeout
+        const struct timespec tmp_cloud_access_end_timestamp = Util::getCurrentTimespec();
+        const double tmp_cloud_access_edge_cloud_rtt_us = Util::getDeltaTimeUs(tmp_cloud_access_end_timestamp, cloud_access_start_timestamp);
+        uint32_t tmp_cloud_access_edge_cloud_latency_us = static_cast<uint32_t>(tmp_cloud_access_edge_cloud_rtt_us);
+        if (extra_common_msghdr.isSkipPropagationLatency()) // Compensate propagation latency for warmup speedup
+        {
+            // NOTE: edge-cloud propagation latency from CLI is already a round-trip latency, which should NOT be counted twice for RTT
+            // tmp_cloud_access_edge_cloud_latency_us += tmp_edge_wrapper_ptr->getPropagationLatencyEdgecloudAvgUs();
+
+            // NOTE: follow the dynamic latency distribution with a unique random seed to simulate RTT during warmup phase
+            tmp_cloud_access_edge_cloud_latency_us += tmp_edge_wrapper_ptr->getEdgeTocloudPropagationSimulatorParamPtr()->genPropagationLatency();
+        }
+
+        // Get value from global response message
+        processRspToAccessCloud_(global_response_ptr, value, tmp_cloud_access_edge_cloud_latency_us);
+
+        // Update total bandwidth usage for received global get response
+        BandwidthUsage global_response_bandwidth_usage = global_response_ptr->getBandwidthUsageRef();
+        uint32_t edge_cloud_global_rsp_bandwidth_bytes = global_response_ptr->getMsgBandwidthSize();
+        global_response_bandwidth_usage.update(BandwidthUsage(0, 0, edge_cloud_global_rsp_bandwidth_bytes, 0, 0, 1, global_response_ptr->getMessageType(), global_response_ptr->getVictimSyncsetBytes()));
+        total_bandwidth_usage.update(global_response_bandwidth_usage);
+
+        // Add events of intermediate response if with event tracking
+        event_list.addEvents(global_response_ptr->getEventListRef());
+
+        #ifdef DEBUG_CACHE_SERVER_WORKER
+        Util::dumpVariablesForDebug(base_instance_name_, 4, "receive a global response", "type:", MessageBase::messageTypeToString(global_response_ptr->getMessageType()).c_str(), "keystr:", MessageBase::getKeyFromMessage(global_response_ptr).getKeystr().c_str());
+        #endif
+
+        return;
+    }
+
     // (1.4) Update invalid cached objects in local edge cache
 
     // (2) Process write requests
@@ -949,11 +2488,9 @@ namespace covered
         #endif
         
         checkPointers_();
-        CacheServerBase* tmp_cache_server_ptr = cache_server_worker_param_ptr_->getCacheServerPtr();
-        EdgeWrapperBase* tmp_edge_wrapper_ptr = tmp_cache_server_ptr->getEdgeWrapperPtr();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
 
         bool is_finish = false; // Mark if edge node is finished
-        const Hitflag hitflag = Hitflag::kGlobalMiss; // Must be global miss due to write-through policy
         BandwidthUsage total_bandwidth_usage;
         EventList event_list;
         
@@ -992,30 +2529,20 @@ namespace covered
         uint32_t write_cloud_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(write_cloud_end_timestamp, write_cloud_start_timestamp));
         event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_WRITE_CLOUD_EVENT_NAME, write_cloud_latency_us); // Add intermediate event if with event tracking
 
-        // Try to update/remove local edge cache
-        struct timespec write_local_cache_start_timestamp = Util::getCurrentTimespec();
-        bool is_local_cached = false;
-        NetworkAddr edge_cache_server_recvreq_source_addr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeCacheServerRecvreqPrivateSourceAddr(); // NOTE: the closest edge communicates client via private IP address
-        // NOTE: message type has been checked, which must be one of the following two types
-        const bool is_global_cached = (lock_result == LockResult::kSuccess); // NOTE: put/delreq needs to try to acquire writelock first -> kSuccess means global cached, otherwise kNoNeed means NOT global cached
-        if (local_request_ptr->getMessageType() == MessageType::kLocalPutRequest)
-        {
-            is_local_cached = updateLocalEdgeCache_(tmp_key, tmp_value, is_global_cached);
+        // Update local edge cache, release write lock, trigger cache management, and reply the client
+        is_finish = finishLocalWriteRequest_(tmp_key, tmp_value, local_request_ptr->getMessageType(), lock_result, write_cloud_latency_us, total_bandwidth_usage, event_list, extra_common_msghdr, recvrsp_dst_addr);
 
-            // NOTE: we will check capacity and trigger eviction for value updates (add events of intermediate response if with event tracking)
-            is_finish = tmp_cache_server_ptr->evictForCapacity_(tmp_key, edge_cache_server_worker_recvrsp_source_addr_, edge_cache_server_worker_recvrsp_socket_server_ptr_, total_bandwidth_usage, event_list, extra_common_msghdr);
-        }
-        else if (local_request_ptr->getMessageType() == MessageType::kLocalDelRequest)
-        {
-            is_local_cached = removeLocalEdgeCache_(tmp_key, is_global_cached);
+        return is_finish;
+    }
 
-            // NOTE: no need to check capacity, as remove() only replaces the original value (value size + is_deleted) with a deleted value (zero value size + is_deleted of true), where deleted value uses minimum bytes and remove() cannot increase used bytes to trigger any eviction
-        }
-        UNUSED(is_local_cached);
-        struct timespec write_local_cache_end_timestamp = Util::getCurrentTimespec();
-        uint32_t write_local_cache_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(write_local_cache_end_timestamp, write_local_cache_start_timestamp));
-        event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_WRITE_LOCAL_CACHE_EVENT_NAME, write_local_cache_latency_us); // Add intermediate event if with event tracking
+    bool CacheServerWorkerBase::finishLocalWriteRequest_(const Key& key, const Value& value, const MessageType& message_type, const LockResult& lock_result, const uint32_t& write_cloud_latency_us, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr, const NetworkAddr& recvrsp_dst_addr)
+    {
+        assert(message_type == MessageType::kLocalPutRequest || message_type == MessageType::kLocalDelRequest);
 
+        bool is_finish = false; // Mark if edge node is finished
+
+        // Try to update/remove local edge cache
+        is_finish = writeLocalEdgeCache_(key, value, message_type, lock_result, total_bandwidth_usage, event_list, extra_common_msghdr);
         if (is_finish) // Edge node is NOT running
         {
             return is_finish;
@@ -1026,7 +2553,7 @@ namespace covered
         {
             struct timespec release_writelock_start_timestamp = Util::getCurrentTimespec();
 
-            is_finish = releaseWritelock_(tmp_key, tmp_value, total_bandwidth_usage, event_list, extra_common_msghdr);
+            is_finish = releaseWritelock_(key, value, total_bandwidth_usage, event_list, extra_common_msghdr);
 
             // Add intermediate event if with event tracking
             struct timespec release_writelock_end_timestamp = Util::getCurrentTimespec();
@@ -1038,13 +2565,61 @@ namespace covered
             return is_finish;
         }
 
+        // Trigger cache management and reply the client
+        is_finish = replyLocalWriteRequest_(key, value, message_type, lock_result, write_cloud_latency_us, total_bandwidth_usage, event_list, extra_common_msghdr, recvrsp_dst_addr);
+
+        return is_finish;
+    }
+
+    bool CacheServerWorkerBase::writeLocalEdgeCache_(const Key& key, const Value& value, const MessageType& message_type, const LockResult& lock_result, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const
+    {
+        assert(message_type == MessageType::kLocalPutRequest || message_type == MessageType::kLocalDelRequest);
+
+        bool is_finish = false; // Mark if edge node is finished
+
+        // Try to update/remove local edge cache
+        struct timespec write_local_cache_start_timestamp = Util::getCurrentTimespec();
+        bool is_local_cached = false;
+        // NOTE: message type has been checked, which must be one of the following two types
+        const bool is_global_cached = (lock_result == LockResult::kSuccess); // NOTE: put/delreq needs to try to acquire writelock first -> kSuccess means global cached, otherwise kNoNeed means NOT global cached
+        if (message_type == MessageType::kLocalPutRequest)
+        {
+            is_local_cached = updateLocalEdgeCache_(key, value, is_global_cached);
+
+            // NOTE: we will check capacity and trigger eviction for value updates (add events of intermediate response if with event tracking)
+            is_finish = tryToEvictForCapacity_(key, total_bandwidth_usage, event_list, extra_common_msghdr);
+        }
+        else if (message_type == MessageType::kLocalDelRequest)
+        {
+            is_local_cached = removeLocalEdgeCache_(key, is_global_cached);
+
+            // NOTE: no need to check capacity, as remove() only replaces the original value (value size + is_deleted) with a deleted value (zero value size + is_deleted of true), where deleted value uses minimum bytes and remove() cannot increase used bytes to trigger any eviction
+        }
+        UNUSED(is_local_cached);
+        struct timespec write_local_cache_end_timestamp = Util::getCurrentTimespec();
+        uint32_t write_local_cache_latency_us = static_cast<uint32_t>(Util::getDeltaTimeUs(write_local_cache_end_timestamp, write_local_cache_start_timestamp));
+        event_list.addEvent(Event::EDGE_CACHE_SERVER_WORKER_WRITE_LOCAL_CACHE_EVENT_NAME, write_local_cache_latency_us); // Add intermediate event if with event tracking
+
+        return is_finish;
+    }
+
+    bool CacheServerWorkerBase::replyLocalWriteRequest_(const Key& key, const Value& value, const MessageType& message_type, const LockResult& lock_result, const uint32_t& write_cloud_latency_us, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr, const NetworkAddr& recvrsp_dst_addr) const
+    {
+        assert(message_type == MessageType::kLocalPutRequest || message_type == MessageType::kLocalDelRequest);
+
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        bool is_finish = false; // Mark if edge node is finished
+        const Hitflag hitflag = Hitflag::kGlobalMiss; // Must be global miss due to write-through policy
+
         // After writing value into cloud and local edge cache if any
         uint64_t miss_latency_us = write_cloud_latency_us;
         if (extra_common_msghdr.isSkipPropagationLatency()) // Compensate propagation latency for warmup speedup
         {
             miss_latency_us += tmp_edge_wrapper_ptr->getEdgeTocloudPropagationSimulatorParamPtr()->genPropagationLatency();
         }
-        is_finish = afterWritingValue_(tmp_key, tmp_value, lock_result, total_bandwidth_usage, event_list, extra_common_msghdr, miss_latency_us);
+        is_finish = afterWritingValue_(key, value, lock_result, total_bandwidth_usage, event_list, extra_common_msghdr, miss_latency_us);
         if (is_finish) // Edge node is NOT running
         {
             return is_finish;
@@ -1052,18 +2627,19 @@ namespace covered
 
         // Prepare local response
         MessageBase* local_response_ptr = NULL;
+        NetworkAddr edge_cache_server_recvreq_source_addr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeCacheServerRecvreqPrivateSourceAddr(); // NOTE: the closest edge communicates client via private IP address
         uint64_t used_bytes = tmp_edge_wrapper_ptr->getSizeForCapacity();
         uint64_t capacity_bytes = tmp_edge_wrapper_ptr->getCapacityBytes();
         uint32_t edge_idx = tmp_edge_wrapper_ptr->getNodeIdx();
-        if (local_request_ptr->getMessageType() == MessageType::kLocalPutRequest)
+        if (message_type == MessageType::kLocalPutRequest)
         {
             // Prepare LocalPutResponse for client
-            local_response_ptr = new LocalPutResponse(tmp_key, hitflag, used_bytes, capacity_bytes, edge_idx, edge_cache_server_recvreq_source_addr, total_bandwidth_usage, event_list, extra_common_msghdr); // NOTE: extra_common_msghdr has msg seqnum assigned by client worker
+            local_response_ptr = new LocalPutResponse(key, hitflag, used_bytes, capacity_bytes, edge_idx, edge_cache_server_recvreq_source_addr, total_bandwidth_usage, event_list, extra_common_msghdr); // NOTE: extra_common_msghdr has msg seqnum assigned by client worker
         }
-        else if (local_request_ptr->getMessageType() == MessageType::kLocalDelRequest)
+        else if (message_type == MessageType::kLocalDelRequest)
         {
             // Prepare LocalDelResponse for client
-            local_response_ptr = new LocalDelResponse(tmp_key, hitflag, used_bytes, capacity_bytes, edge_idx, edge_cache_server_recvreq_source_addr, total_bandwidth_usage, event_list, extra_common_msghdr); // NOTE: extra_common_msghdr has msg seqnum assigned by client worker
+            local_response_ptr = new LocalDelResponse(key, hitflag, used_bytes, capacity_bytes, edge_idx, edge_cache_server_recvreq_source_addr, total_bandwidth_usage, event_list, extra_common_msghdr); // NOTE: extra_common_msghdr has msg seqnum assigned by client worker
         }
 
         if (!is_finish) // // Edge node is STILL running
@@ -1186,7 +2762,7 @@ namespace covered
             if (!is_stale_response)
             {
                 // Prepare acquire writelock request to acquire permission for a write
-                MessageBase* acquire_writelock_request_ptr = getReqToAcquireBeaconWritelock_(key, tmp_extra_common_msghdr);
+                MessageBase* acquire_writelock_request_ptr = getReqToAcquireBeaconWritelock_(key, edge_cache_server_worker_recvrsp_source_addr_, tmp_extra_common_msghdr);
                 assert(acquire_writelock_request_ptr != NULL);
 
                 // Push the control request into edge-to-edge propagation simulator to the beacon node
@@ -1236,17 +2812,8 @@ namespace covered
                     continue; // Jump to while loop
                 }
 
-                // Get lock result from control response
-                processRspToAcquireBeaconWritelock_(control_response_ptr, lock_result);
-
-                // Update total bandwidth usage for received acquire writelock response
-                BandwidthUsage acquire_writelock_response_bandwidth_usage = control_response_ptr->getBandwidthUsageRef();
-                uint32_t cross_edge_acquire_writelock_rsp_bandwidth_bytes = control_response_ptr->getMsgBandwidthSize();
-                acquire_writelock_response_bandwidth_usage.update(BandwidthUsage(0, cross_edge_acquire_writelock_rsp_bandwidth_bytes, 0, 0, 1, 0, control_response_ptr->getMessageType(), control_response_ptr->getVictimSyncsetBytes()));
-                total_bandwidth_usage.update(acquire_writelock_response_bandwidth_usage);
-
-                // Add events of intermediate response if with event tracking
-                event_list.addEvents(control_response_ptr->getEventListRef());
+                // Get lock result, update total bandwidth usage, and add events of intermediate response if with event tracking
+                processAcquireWritelockResponse_(control_response_ptr, lock_result, total_bandwidth_usage, event_list);
 
                 // Release the control response message
                 delete control_response_ptr;
@@ -1263,6 +2830,25 @@ namespace covered
         return is_finish;
     }
 
+    void CacheServerWorkerBase::processAcquireWritelockResponse_(MessageBase* control_response_ptr, LockResult& lock_result, BandwidthUsage& total_bandwidth_usage, EventList& event_list) const
+    {
+        assert(control_response_ptr != NULL);
+
+        // Get lock result from control response
+        processRspToAcquireBeaconWritelock_(control_response_ptr, lock_result);
+
+        // Update total bandwidth usage for received acquire writelock response
+        BandwidthUsage acquire_writelock_response_bandwidth_usage = control_response_ptr->getBandwidthUsageRef();
+        uint32_t cross_edge_acquire_writelock_rsp_bandwidth_bytes = control_response_ptr->getMsgBandwidthSize();
+        acquire_writelock_response_bandwidth_usage.update(BandwidthUsage(0, cross_edge_acquire_writelock_rsp_bandwidth_bytes, 0, 0, 1, 0, control_response_ptr->getMessageType(), control_response_ptr->getVictimSyncsetBytes()));
+        total_bandwidth_usage.update(acquire_writelock_response_bandwidth_usage);
+
+        // Add events of intermediate response if with event tracking
+        event_list.addEvents(control_response_ptr->getEventListRef());
+
+        return;
+    }
+
     bool CacheServerWorkerBase::blockForWritesByInterruption_(const Key& key, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const
     {
         checkPointers_();
@@ -1397,23 +2983,7 @@ namespace covered
             if (!is_stale_response)
             {
                 // Prepare global write request message
-                MessageBase* global_request_ptr = NULL;
-                uint32_t edge_idx = tmp_edge_wrapper_ptr->getNodeIdx();
-                if (message_type == MessageType::kLocalPutRequest)
-                {
-                    global_request_ptr = new GlobalPutRequest(key, value, edge_idx, edge_cache_server_worker_recvrsp_source_addr_, tmp_extra_common_msghdr);
-                }
-                else if (message_type == MessageType::kLocalDelRequest)
-                {
-                    global_request_ptr = new GlobalDelRequest(key, edge_idx, edge_cache_server_worker_recvrsp_source_addr_, tmp_extra_common_msghdr);
-                }
-                else
-                {
-                    std::ostringstream oss;
-                    oss << "invalid message type " << MessageBase::messageTypeToString(message_type) << " for writeDataToCloud_()!";
-                    Util::dumpErrorMsg(base_instance_name_, oss.str());
-                    exit(1);
-                }
+                MessageBase* global_request_ptr = getGlobalWriteRequest_(key, value, message_type, edge_cache_server_worker_recvrsp_source_addr_, tmp_extra_common_msghdr);
                 assert(global_request_ptr != NULL);
 
                 // Push the global request into edge-to-cloud propagation simulator to cloud
@@ -1463,16 +3033,8 @@ namespace covered
                     continue; // Jump to while loop
                 }
 
-                assert(global_response_ptr->getMessageType() == MessageType::kGlobalPutResponse || global_response_ptr->getMessageType() == MessageType::kGlobalDelResponse);
-
-                // Update total bandwidth usage for received global put/del response
-                BandwidthUsage global_response_bandwidth_usage = global_response_ptr->getBandwidthUsageRef();
-                uint32_t edge_cloud_global_rsp_bandwidth_bytes = global_response_ptr->getMsgBandwidthSize();
-                global_response_bandwidth_usage.update(BandwidthUsage(0, 0, edge_cloud_global_rsp_bandwidth_bytes, 0, 0, 1, global_response_ptr->getMessageType(), global_response_ptr->getVictimSyncsetBytes()));
-                total_bandwidth_usage.update(global_response_bandwidth_usage);
-
-                // Add events of intermediate response if with event tracking
-                event_list.addEvents(global_response_ptr->getEventListRef());
+                // Update total bandwidth usage and add events of intermediate response if with event tracking
+                processGlobalWriteResponse_(global_response_ptr, total_bandwidth_usage, event_list);
 
                 // Release global response message
                 delete global_response_ptr;
@@ -1489,6 +3051,50 @@ namespace covered
         return is_finish;
     }
 
+    MessageBase* CacheServerWorkerBase::getGlobalWriteRequest_(const Key& key, const Value& value, const MessageType& message_type, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const
+    {
+        checkPointers_();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
+
+        MessageBase* global_request_ptr = NULL;
+        uint32_t edge_idx = tmp_edge_wrapper_ptr->getNodeIdx();
+        if (message_type == MessageType::kLocalPutRequest)
+        {
+            global_request_ptr = new GlobalPutRequest(key, value, edge_idx, recvrsp_source_addr, extra_common_msghdr);
+        }
+        else if (message_type == MessageType::kLocalDelRequest)
+        {
+            global_request_ptr = new GlobalDelRequest(key, edge_idx, recvrsp_source_addr, extra_common_msghdr);
+        }
+        else
+        {
+            std::ostringstream oss;
+            oss << "invalid message type " << MessageBase::messageTypeToString(message_type) << " for getGlobalWriteRequest_()!";
+            Util::dumpErrorMsg(base_instance_name_, oss.str());
+            exit(1);
+        }
+        assert(global_request_ptr != NULL);
+
+        return global_request_ptr;
+    }
+
+    void CacheServerWorkerBase::processGlobalWriteResponse_(MessageBase* global_response_ptr, BandwidthUsage& total_bandwidth_usage, EventList& event_list) const
+    {
+        assert(global_response_ptr != NULL);
+        assert(global_response_ptr->getMessageType() == MessageType::kGlobalPutResponse || global_response_ptr->getMessageType() == MessageType::kGlobalDelResponse);
+
+        // Update total bandwidth usage for received global put/del response
+        BandwidthUsage global_response_bandwidth_usage = global_response_ptr->getBandwidthUsageRef();
+        uint32_t edge_cloud_global_rsp_bandwidth_bytes = global_response_ptr->getMsgBandwidthSize();
+        global_response_bandwidth_usage.update(BandwidthUsage(0, 0, edge_cloud_global_rsp_bandwidth_bytes, 0, 0, 1, global_response_ptr->getMessageType(), global_response_ptr->getVictimSyncsetBytes()));
+        total_bandwidth_usage.update(global_response_bandwidth_usage);
+
+        // Add events of intermediate response if with event tracking
+        event_list.addEvents(global_response_ptr->getEventListRef());
+
+        return;
+    }
+
     // (2.3) Update cached objects in local edge cache
 
     // (2.4) Release write lock for MSI protocol
@@ -1566,7 +3172,7 @@ namespace covered
             if (!is_stale_response)
             {
                 // Prepare release writelock request to finish write
-                MessageBase* release_writelock_request_ptr = getReqToReleaseBeaconWritelock_(key, tmp_extra_common_msghdr);
+                MessageBase* release_writelock_request_ptr = getReqToReleaseBeaconWritelock_(key, edge_cache_server_worker_recvrsp_source_addr_, tmp_extra_common_msghdr);
                 assert(release_writelock_request_ptr != NULL);
 
                 // Push the control request into edge-to-edge propagation simulator to the beacon node
@@ -1616,22 +3222,13 @@ namespace covered
                     continue; // Jump to while loop
                 }
 
-                // Process release writelock response
-                bool is_finish = processRspToReleaseBeaconWritelock_(control_response_ptr, value, total_bandwidth_usage, event_list, tmp_extra_common_msghdr);
+                // Process release writelock response, update total bandwidth usage, and add events of intermediate response if with event tracking
+                bool is_finish = processReleaseWritelockResponse_(control_response_ptr, value, total_bandwidth_usage, event_list, tmp_extra_common_msghdr);
                 if (is_finish)
                 {
                     return is_finish; // Edge is NOT running
                 }
 
-                // Update total bandwidth usage for received release writelock response
-                BandwidthUsage release_writelock_response_bandwidth_usage = control_response_ptr->getBandwidthUsageRef();
-                uint32_t cross_edge_release_writelock_rsp_bandwidth_bytes = control_response_ptr->getMsgBandwidthSize();
-                release_writelock_response_bandwidth_usage.update(BandwidthUsage(0, cross_edge_release_writelock_rsp_bandwidth_bytes, 0, 0, 1, 0, control_response_ptr->getMessageType(), control_response_ptr->getVictimSyncsetBytes()));
-                total_bandwidth_usage.update(release_writelock_response_bandwidth_usage);
-
-                // Add events of intermediate response if with event tracking
-                event_list.addEvents(control_response_ptr->getEventListRef());
-
                 // Release the control response message
                 delete control_response_ptr;
                 control_response_ptr = NULL;
@@ -1647,6 +3244,29 @@ namespace covered
         return is_finish;
     }
 
+    bool CacheServerWorkerBase::processReleaseWritelockResponse_(MessageBase* control_response_ptr, const Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const
+    {
+        assert(control_response_ptr != NULL);
+
+        // Process release writelock response
+        bool is_finish = processRspToReleaseBeaconWritelock_(control_response_ptr, value, total_bandwidth_usage, event_list, extra_common_msghdr);
+        if (is_finish)
+        {
+            return is_finish; // Edge is NOT running
+        }
+
+        // Update total bandwidth usage for received release writelock response
+        BandwidthUsage release_writelock_response_bandwidth_usage = control_response_ptr->getBandwidthUsageRef();
+        uint32_t cross_edge_release_writelock_rsp_bandwidth_bytes = control_response_ptr->getMsgBandwidthSize();
+        release_writelock_response_bandwidth_usage.update(BandwidthUsage(0, cross_edge_release_writelock_rsp_bandwidth_bytes, 0, 0, 1, 0, control_response_ptr->getMessageType(), control_response_ptr->getVictimSyncsetBytes()));
+        total_bandwidth_usage.update(release_writelock_response_bandwidth_usage);
+
+        // Add events of intermediate response if with event tracking
+        event_list.addEvents(control_response_ptr->getEventListRef());
+
+        return is_finish;
+    }
+
     // (3) Process redirected requests (see src/cache_server/cache_server_redirection_processor.*)
 
     // (4) Cache management
@@ -1686,6 +3306,22 @@ namespace covered
 
         bool is_finish = false;
 
+        if (edge_cache_server_worker_async_recvrsp_socket_server_ptr_ != NULL) // With multiplexed in-flight requests
+        {
+            // Hand over directory admission, local cache admission, and eviction to cache server placement processor, which admits the object as invalid if key is being written
+            // NOTE: NOT block other in-flight requests by directory update and victim fetching on the blocking recvrsp socket
+            const bool need_admit_directory = !Util::isSingleNodeCache(tmp_edge_wrapper_ptr->getCacheName());
+            const bool unused_is_neighbor_cached = false; // NOTE: NEVER used by baselines
+            const bool is_valid = true;
+            bool is_successful = tmp_edge_wrapper_ptr->getLocalCacheAdmissionBufferPtr()->push(LocalCacheAdmissionItem(key, value, unused_is_neighbor_cached, is_valid, extra_common_msghdr, need_admit_directory, miss_latency_us));
+            if (!is_successful) // NOTE: blocking push fails ONLY if edge node is NOT running now (placement processor stops popping)
+            {
+                assert(!tmp_edge_wrapper_ptr->isNodeRunning());
+                is_finish = true;
+            }
+            return is_finish;
+        }
+
         struct timespec update_directory_to_admit_start_timestamp = Util::getCurrentTimespec();
 
         // Independently admit the new key-value pair into local edge cache
@@ -1722,6 +3358,42 @@ namespace covered
         return is_finish;
     }
 
+    bool CacheServerWorkerBase::tryToEvictForCapacity_(const Key& key, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const
+    {
+        checkPointers_();
+        CacheServerBase* tmp_cache_server_ptr = cache_server_worker_param_ptr_->getCacheServerPtr();
+        EdgeWrapperBase* tmp_edge_wrapper_ptr = tmp_cache_server_ptr->getEdgeWrapperPtr();
+
+        bool is_finish = false;
+
+        if (edge_cache_server_worker_async_recvrsp_socket_server_ptr_ != NULL) // With multiplexed in-flight requests
+        {
+            // NOTE: check capacity first to avoid unnecessary local cache admission items (evictForCapacity_() will check it again under the eviction lock)
+            if (tmp_edge_wrapper_ptr->getSizeForCapacity() <= tmp_edge_wrapper_ptr->getCapacityBytes())
+            {
+                return is_finish;
+            }
+
+            // Hand over eviction to cache server placement processor to NOT block other in-flight requests by victim fetching and directory updates
+            const bool unused_is_neighbor_cached = false;
+            const bool unused_is_valid = false;
+            const bool need_admit_directory = false;
+            const uint64_t unused_miss_latency_us = 0;
+            const bool is_eviction_only = true;
+            bool is_successful = tmp_edge_wrapper_ptr->getLocalCacheAdmissionBufferPtr()->push(LocalCacheAdmissionItem(key, Value(), unused_is_neighbor_cached, unused_is_valid, extra_common_msghdr, need_admit_directory, unused_miss_latency_us, is_eviction_only));
+            if (!is_successful) // NOTE: blocking push fails ONLY if edge node is NOT running now (placement processor stops popping)
+            {
+                assert(!tmp_edge_wrapper_ptr->isNodeRunning());
+                is_finish = true;
+            }
+            return is_finish;
+        }
+
+        is_finish = tmp_cache_server_ptr->evictForCapacity_(key, edge_cache_server_worker_recvrsp_source_addr_, edge_cache_server_worker_recvrsp_socket_server_ptr_, total_bandwidth_usage, event_list, extra_common_msghdr); // Add events of intermediate response if with event tracking
+
+        return is_finish;
+    }
+
     // (4.2) Update content directory information
 
     bool CacheServerWorkerBase::admitDirectory_(const Key& key, bool& is_being_written, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const
@@ -45,6 +45,13 @@
  * (7) Issue/receive directory update requests/responses
  * (8) Issue local response
  * 
+ * E. Multiplexed in-flight requests (if cache_server_worker_inflightcnt > 1):
+ * (1) Each cache server worker keeps at most cache_server_worker_inflightcnt local requests in flight, which issue directory lookup, redirected get, global get/put/del, acquire/release writelock, invalidation (local beacon), and finish block (local beacon) requests from a dedicated async recvrsp port and are resumed by msg seqnum of the corresponding responses (or FinishBlockRequest of the key), where invalidation and finish block requests of a local request share one seqnum and wait for the ACKs of all involved edge nodes.
+ * (2) Local requests of the same key are serialized in FIFO order within the cache server worker (the same as the blocking mode), while requests of different keys overlap their network round trips.
+ * (3) Independent admission (with directory admission) and eviction after cache updates are handed over to cache server placement processor by local cache admission items, which are processed in the background and hence NOT counted in the latency of local requests; COVERED-specific placement hooks (e.g., hybrid data fetching and fast-path placement) still block on the original recvrsp port, which never receives responses of in-flight requests.
+ * (4) Single-flight miss coalescing: when a local get request fetches value from neighbor/cloud, the following deferred local get requests of the same key (until the next put/del) reuse the fetched value if still local miss, instead of repeating content discovery, redirection, and cloud access (local requests of a key are always partitioned to the same cache server worker, so the per-worker key table covers the entire edge node).
+ * (5) cache_server_worker_inflightcnt = 1 keeps the original blocking mode.
+ * 
  * By Siyuan Sheng (2023.06.21).
  */
 
@@ -53,7 +60,10 @@
 
 //#define DEBUG_CACHE_SERVER_WORKER
 
+#include <list>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "core/popularity/edgeset.h"
 #include "core/popularity/fast_path_hint.h"
@@ -75,17 +85,136 @@ namespace covered
         void start();
     private:
         static const std::string kClassName;
+        static const uint32_t ASYNC_IDLE_WAIT_US; // Max idle wait of the event loop if local requests may arrive at ring buffer (ring buffer cannot wake up poll())
 
         // Const variable
         std::string base_instance_name_;
 
         static CacheServerWorkerBase* getCacheServerWorkerByCacheName_(CacheServerWorkerParam* cache_server_worker_param_ptr);
+
+        // (0) Multiplexed in-flight requests (ONLY if cache_server_worker_inflightcnt > 1)
+
+        enum InflightStage
+        {
+            kInflightWaitForDirectoryLookup = 0, // DirectoryLookupResponse from beacon
+            kInflightWaitForRedirectedGet, // RedirectedGetResponse from target edge
+            kInflightWaitForGlobalGet, // GlobalGetResponse from cloud
+            kInflightWaitForAcquireWritelock, // AcquireWritelockResponse from beacon
+            kInflightWaitForGlobalWrite, // GlobalPutResponse/GlobalDelResponse from cloud
+            kInflightWaitForInvalidation, // InvalidationResponses from all cache copies (local beacon)
+            kInflightWaitForReleaseWritelock, // ReleaseWritelockResponse from beacon
+            kInflightWaitForNotifyFinishBlock, // FinishBlockResponses from all blocked edges (local beacon)
+            kInflightWaitForFinishBlock, // FinishBlockRequest of the key from beacon
+            kInflightWaitForLocalRetry, // Local beacon is being written or locked by others (polling)
+            kInflightWaitForIssue // Deferred by a previous in-flight request of the same key
+        };
+
+        // Context of a local request across its network round trips (the same local variables as processLocalGetRequest_() and processLocalWriteRequest_())
+        struct InflightRequest
+        {
+            MessageBase* local_request_ptr;
+            NetworkAddr recvrsp_dst_addr;
+            Key key;
+            Value value;
+            MessageType message_type;
+            ExtraCommonMsghdr extra_common_msghdr;
+            BandwidthUsage total_bandwidth_usage;
+            EventList event_list;
+
+            InflightStage stage;
+            uint64_t cur_msg_seqnum; // Edge-assigned seqnum of the issued request (the same one for retries)
+            struct timespec issue_req_start_timestamp; // Count timeout
+            struct timespec rtt_start_timestamp; // NOT count timeout (for latency-aware weight tuning)
+            struct timespec block_for_writes_start_timestamp;
+
+            // For local get requests
+            struct timespec process_local_getreq_start_timestamp;
+            bool is_tracked_before_fetch_value;
+            bool is_local_cached_and_valid;
+            bool is_cooperative_cached;
+            bool is_cooperative_valid;
+            bool is_cooperative_cached_and_valid;
+            Edgeset best_placement_edgeset;
+            bool need_hybrid_fetching;
+            FastPathHint fast_path_hint;
+            bool is_being_written;
+            bool is_valid_directory_exist;
+            DirectoryInfo directory_info;
+            struct timespec get_cooperative_cache_start_timestamp;
+            struct timespec lookup_directory_start_timestamp;
+            struct timespec redirect_get_start_timestamp;
+            struct timespec get_cloud_start_timestamp;
+            uint32_t get_cooperative_cache_latency_us;
+            uint32_t get_cloud_latency_us;
+            uint64_t fetch_bandwidth_bytes; // Cross-edge and edge-cloud bandwidth bytes to fetch value from neighbor/cloud
+            bool is_coalesced; // Reuse value fetched by the previous local get request of the same key if still local miss
+
+            // For local put/del requests
+            LockResult lock_result;
+            struct timespec acquire_writelock_start_timestamp;
+            struct timespec acquire_local_or_remote_writelock_start_timestamp;
+            struct timespec write_cloud_start_timestamp;
+            uint32_t write_cloud_latency_us;
+            struct timespec release_writelock_start_timestamp;
+            struct timespec release_local_or_remote_writelock_start_timestamp;
+
+            // For fan-out requests to multiple edge nodes (invalidation and finish block)
+            std::unordered_map<NetworkAddr, std::pair<bool, uint32_t>, NetworkAddrHasher> fanout_acked_flags; // NOTE: bool refers to whether ACK is received, while uint32_t refers to dst edge index
+            uint32_t fanout_acked_edgecnt;
+            struct timespec fanout_start_timestamp;
+        };
+
+        static std::string inflightStageToString_(const InflightStage& stage);
+
+        void startAsync_(); // Event loop of multiplexed in-flight requests
+        bool admitInflightRequest_(MessageBase* local_request_ptr); // Return if edge node is finished
+        bool startInflightRequest_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        bool completeInflightRequest_(InflightRequest* inflight_request_ptr); // Release the context and start the next deferred request of the same key if any; return if edge node is finished
+        void issueInflightRemoteRequest_(InflightRequest* inflight_request_ptr, const InflightStage& stage); // Assign a new edge-assigned seqnum and send the request of the given stage
+        void sendInflightRemoteRequest_(InflightRequest* inflight_request_ptr) const; // (Re)send the request of the current stage with cur_msg_seqnum
+        void blockInflightRequestForWrites_(InflightRequest* inflight_request_ptr); // Wait for FinishBlockRequest of the key by interruption
+        bool processInflightResponse_(MessageBase* response_ptr); // Return if edge node is finished
+        bool processInflightFinishBlockRequest_(MessageBase* control_request_ptr); // Return if edge node is finished
+        bool retryInflightRequest_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        void resendTimeoutInflightRequests_(); // NOTE: also unblock timeout blocked requests to retry (FinishBlockRequest may be lost)
+        void waitForInflightEvents_() const; // Wait until responses or FinishBlockRequests arrive, the next timeout check, or ASYNC_IDLE_WAIT_US if ring buffer or local retries need polling
+        void releaseAllInflightRequests_();
+
+        // In-flight local get requests
+        bool startInflightGet_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        bool lookupDirectoryForInflightGet_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        bool afterDirectoryLookupForInflightGet_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        bool afterCooperativeFetchForInflightGet_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        bool fetchDataFromCloudForInflightGet_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        bool afterCloudFetchForInflightGet_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        void coalesceDeferredInflightGets_(const InflightRequest* fetched_inflight_request_ptr); // Mark deferred local get requests of the same key to reuse the fetched value
+        bool finishCoalescedInflightGet_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+
+        // In-flight local put/del requests
+        bool startInflightWrite_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        bool acquireWritelockForInflightWrite_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        bool afterWritelockForInflightWrite_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        bool afterCloudWriteForInflightWrite_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        bool invalidateCacheCopiesForInflightWrite_(InflightRequest* inflight_request_ptr, const DirinfoSet& all_dirinfo); // Return if edge node is finished
+        bool releaseWritelockForInflightWrite_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        bool afterReleaseWritelockForInflightWrite_(InflightRequest* inflight_request_ptr); // Return if edge node is finished
+        bool processInflightFanoutResponse_(InflightRequest* inflight_request_ptr, MessageBase* response_ptr); // Return if all involved edge nodes have acknowledged
+
+        // Non-const individual variables (ONLY accessed by the current cache server worker thread)
+        uint32_t inflight_cnt_; // # of admitted yet uncompleted local requests (including deferred ones of the same key)
+        std::unordered_map<uint64_t, InflightRequest*> seqnum_inflight_map_; // Waiting for responses of the given edge-assigned seqnum
+        std::unordered_map<Key, std::list<InflightRequest*>, KeyHasher> key_inflight_map_; // Started one (front) and deferred ones of the same key in FIFO order
+        std::unordered_map<Key, InflightRequest*, KeyHasher> blocked_inflight_map_; // Waiting for FinishBlockRequest of the key
+        std::unordered_set<Key, KeyHasher> early_finish_block_keyset_; // FinishBlockRequest arrives before the DirectoryLookupResponse/AcquireWritelockResponse blocking the started in-flight request of the key
+        std::list<InflightRequest*> local_retry_list_; // Polling local beacon
+        struct timespec prev_timeout_check_timestamp_;
     protected:
         bool processLocalDataRequest_(MessageBase* data_request_ptr, const NetworkAddr& recvrsp_dst_addr); // Return if edge node is finished
 
         // (1) Process read requests
 
         bool processLocalGetRequest_(MessageBase* local_request_ptr, const NetworkAddr& recvrsp_dst_addr) const; // Return if edge node is finished
+        bool finishLocalGetRequest_(const Key& key, const Value& value, const bool& is_local_cached_and_valid, const bool& is_tracked_before_fetch_value, const bool& is_cooperative_cached, const bool& is_cooperative_cached_and_valid, const Edgeset& best_placement_edgeset, const bool& need_hybrid_fetching, const FastPathHint& fast_path_hint, const uint32_t& get_cooperative_cache_latency_us, const uint32_t& get_cloud_latency_us, const struct timespec& process_local_getreq_start_timestamp, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr, const NetworkAddr& recvrsp_dst_addr) const; // Update invalid local edge cache, trigger cache management, and issue local response after getting value (return if edge node is finished)
 
         // (1.1) Access local edge cache
 
@@ -97,17 +226,20 @@ namespace covered
         virtual bool lookupLocalDirectory_(const Key& key, bool& is_being_written, bool& is_valid_directory_exist, DirectoryInfo& directory_info, Edgeset& best_placement_edgeset, bool& need_hybrid_fetching, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const = 0; // Return if edge node is finished
         virtual bool needLookupBeaconDirectory_(const Key& key, bool& is_being_written, bool& is_valid_directory_exist, DirectoryInfo& directory_info) const = 0; // Return if need to lookup remote directory info
         bool lookupBeaconDirectory_(const Key& key, bool& is_being_written, bool& is_valid_directory_exist, DirectoryInfo& directory_info, Edgeset& best_placement_edgeset, bool& need_hybrid_fetching, FastPathHint& fast_path_hint, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const; // Check remote directory info
-        virtual MessageBase* getReqToLookupBeaconDirectory_(const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const = 0;
+        virtual MessageBase* getReqToLookupBeaconDirectory_(const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const = 0;
+        void processDirectoryLookupResponse_(MessageBase* control_response_ptr, const struct timespec& content_discovery_start_timestamp, bool& is_being_written, bool& is_valid_directory_exist, DirectoryInfo& directory_info, Edgeset& best_placement_edgeset, bool& need_hybrid_fetching, FastPathHint& fast_path_hint, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const;
         virtual void processRspToLookupBeaconDirectory_(MessageBase* control_response_ptr, bool& is_being_written, bool& is_valid_directory_exist, DirectoryInfo& directory_info, Edgeset& best_placement_edgeset, bool& need_hybrid_fetching, FastPathHint& fast_path_hint, const uint32_t& content_discovery_cross_edge_latency_us) const = 0;
 
         bool redirectGetToTarget_(const DirectoryInfo& directory_info, const Key& key, Value& value, bool& is_cooperative_cached, bool& is_valid, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const; // Request redirection
-        virtual MessageBase* getReqToRedirectGet_(const uint32_t& dst_edge_idx_for_compression, const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const = 0;
+        virtual MessageBase* getReqToRedirectGet_(const uint32_t& dst_edge_idx_for_compression, const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const = 0;
+        void processRedirectedGetResponse_(MessageBase* redirected_response_ptr, const struct timespec& request_redirection_start_timestamp, const Key& key, Value& value, bool& is_cooperative_cached, bool& is_valid, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const;
         virtual void processRspToRedirectGet_(MessageBase* redirected_response_ptr, Value& value, Hitflag& hitflag, const uint32_t& request_redirection_cross_edge_latency_us) const = 0;
 
         // (1.3) Access cloud
 
         // Return if edge node is finished
         bool fetchDataFromCloud_(const Key& key, Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const;
+        void processGlobalGetResponse_(MessageBase* global_response_ptr, const struct timespec& cloud_access_start_timestamp, Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const;
         virtual void processRspToAccessCloud_(MessageBase* global_response_ptr, Value& value, const uint32_t& cloud_access_edge_cloud_latency) const = 0;
 
         // (1.4) Update invalid cached objects in local edge cache
@@ -121,13 +253,17 @@ namespace covered
         // (2) Process write requests
 
         bool processLocalWriteRequest_(MessageBase* local_request_ptr, const NetworkAddr& recvrsp_dst_addr); // For put/del
+        bool finishLocalWriteRequest_(const Key& key, const Value& value, const MessageType& message_type, const LockResult& lock_result, const uint32_t& write_cloud_latency_us, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr, const NetworkAddr& recvrsp_dst_addr); // Update local edge cache, release write lock, trigger cache management, and issue local response after writing cloud (return if edge node is finished)
+        bool writeLocalEdgeCache_(const Key& key, const Value& value, const MessageType& message_type, const LockResult& lock_result, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const; // Update/remove local edge cache and trigger eviction if necessary (return if edge node is finished)
+        bool replyLocalWriteRequest_(const Key& key, const Value& value, const MessageType& message_type, const LockResult& lock_result, const uint32_t& write_cloud_latency_us, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr, const NetworkAddr& recvrsp_dst_addr) const; // Trigger cache management and issue local response after releasing write lock (return if edge node is finished)
 
         // (2.1) Acquire write lock and block for MSI protocol
 
         bool acquireWritelock_(const Key& key, LockResult& lock_result, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr); // Return if edge node is finished
         virtual bool acquireLocalWritelock_(const Key& key, LockResult& lock_result, DirinfoSet& all_dirinfo, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) = 0; // Return if edge node is finished
         bool acquireBeaconWritelock_(const Key& key, LockResult& lock_result, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr); // Return if edge node is finished
-        virtual MessageBase* getReqToAcquireBeaconWritelock_(const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const = 0;
+        virtual MessageBase* getReqToAcquireBeaconWritelock_(const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const = 0;
+        void processAcquireWritelockResponse_(MessageBase* control_response_ptr, LockResult& lock_result, BandwidthUsage& total_bandwidth_usage, EventList& event_list) const;
         virtual void processRspToAcquireBeaconWritelock_(MessageBase* control_response_ptr, LockResult& lock_result) const = 0;
 
         // Return if edge node is finished
@@ -140,6 +276,8 @@ namespace covered
 
         // Return if edge node is finished
         bool writeDataToCloud_(const Key& key, const Value& value, const MessageType& message_type, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr);
+        MessageBase* getGlobalWriteRequest_(const Key& key, const Value& value, const MessageType& message_type, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const;
+        void processGlobalWriteResponse_(MessageBase* global_response_ptr, BandwidthUsage& total_bandwidth_usage, EventList& event_list) const;
 
         // (2.3) Update cached objects in local edge cache
 
@@ -152,7 +290,8 @@ namespace covered
         bool releaseWritelock_(const Key& key, const Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr); // NOTE: value is used for COVERED's non-blocking placement notification after hybrid data fetching
         virtual bool releaseLocalWritelock_(const Key& key, const Value& value, std::unordered_set<NetworkAddr, NetworkAddrHasher>& blocked_edges, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) = 0; // Return if edge node is finished (NOTE: value is used for COVERED's non-blocking placement notification after hybrid data fetching)
         bool releaseBeaconWritelock_(const Key& key, const Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr); // Notify beacon node to finish writes
-        virtual MessageBase* getReqToReleaseBeaconWritelock_(const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const = 0;
+        virtual MessageBase* getReqToReleaseBeaconWritelock_(const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const = 0;
+        bool processReleaseWritelockResponse_(MessageBase* control_response_ptr, const Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const; // Return if edge node is finished
         virtual bool processRspToReleaseBeaconWritelock_(MessageBase* control_response_ptr, const Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const = 0;
 
         // (2.5) After writing value into cloud and local edge cache if any
@@ -167,7 +306,8 @@ namespace covered
 
         // Return if edge node is finished (we will check capacity and trigger eviction for cache admission)
         bool tryToTriggerIndependentAdmission_(const Key& key, const Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr, const uint64_t& miss_latency_us = 0) const; // NOTE: COVERED will NOT trigger any independent cache admission/eviction decision
-        bool admitObject_(const Key& key, const Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr, const uint64_t& miss_latency_us = 0) const; // Including directory updates, admit local edge cache, and trigger eviction if necessary
+        bool admitObject_(const Key& key, const Value& value, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr, const uint64_t& miss_latency_us = 0) const; // Including directory updates, admit local edge cache, and trigger eviction if necessary (handed over to cache server placement processor if with in-flight requests)
+        bool tryToEvictForCapacity_(const Key& key, BandwidthUsage& total_bandwidth_usage, EventList& event_list, const ExtraCommonMsghdr& extra_common_msghdr) const; // Trigger eviction if necessary (handed over to cache server placement processor if with in-flight requests); return if edge node is finished
 
         // (4.2) Admit content directory information
 
@@ -200,6 +340,10 @@ namespace covered
         NetworkAddr edge_cache_server_worker_recvrsp_source_addr_; // Used by beacon server to send back control responses, cache server redirection processor to send back redirected data responses, and cloud to send back global data responses (const individual variable)
         UdpMsgSocketServer* edge_cache_server_worker_recvrsp_socket_server_ptr_; // Used by cache server worker to receive control responses from beacon server, redirected responses from cache server redirection processor, and global responses from cloud (non-const individual variable)
 
+        // For receiving responses of multiplexed in-flight requests (ONLY if cache_server_worker_inflightcnt > 1)
+        NetworkAddr edge_cache_server_worker_async_recvrsp_source_addr_; // Used by beacon server, cache server redirection processor, and cloud to send back responses of in-flight requests (const individual variable)
+        UdpMsgSocketServer* edge_cache_server_worker_async_recvrsp_socket_server_ptr_; // Used by the event loop of cache server worker to receive responses of in-flight requests by non-blocking recv (NULL if cache_server_worker_inflightcnt = 1) (non-const individual variable)
+
         // For receiving finish block requests
         NetworkAddr edge_cache_server_worker_recvreq_source_addr_; // The same as that used by cache server worker or beacon server to send finish block requests (const individual variable)
         UdpMsgSocketServer* edge_cache_server_worker_recvreq_socket_server_ptr_; // Used by cache server worker to receive finish block requests from cache server worker or beacon server (non-const individual variable)
@@ -1,5 +1,8 @@
 #include "edge/cache_server/cache_server_worker_param.h"
 
+#include <sstream>
+
+#include "common/config.h"
 #include "common/util.h"
 
 namespace covered
@@ -20,7 +23,8 @@ namespace covered
         
         // Allocate ring buffer for local requests
         const bool with_multi_providers = false; // ONLY one provider (i.e., edge cache server) for local/redirected data requests
-        data_request_buffer_ptr_ = new RingBuffer<CacheServerItem>(CacheServerItem(), data_request_buffer_size, with_multi_providers);
+        const bool is_block_when_full = Config::isRingBufferBlockWhenFull(); // Overload policy of ingress data requests
+        data_request_buffer_ptr_ = new RingBuffer<CacheServerItem>(CacheServerItem(), data_request_buffer_size, with_multi_providers, is_block_when_full);
         assert(data_request_buffer_ptr_ != NULL);
     }
 
@@ -35,6 +39,11 @@ namespace covered
 
         if (data_request_buffer_ptr_ != NULL)
         {
+            // Dump queue-depth statistics
+            std::ostringstream oss;
+            oss << "data request ring buffer of local cache server worker " << local_cache_server_worker_idx_ << ": " << data_request_buffer_ptr_->getStatisticsStr();
+            Util::dumpInfoMsg(kClassName, oss.str());
+
             // Release messages in remaining cache server items
             std::vector<CacheServerItem> remaining_elements;
             data_request_buffer_ptr_->getAllToRelease(remaining_elements);
@@ -73,7 +82,7 @@ namespace covered
             const bool other_with_multi_providers = other.data_request_buffer_ptr_->withMultiProviders();
             assert(!other_with_multi_providers); // ONLY one provider (i.e., edge cache server) for local/redirected data requests
 
-            data_request_buffer_ptr_ = new RingBuffer<CacheServerItem>(other.data_request_buffer_ptr_->getDefaultElement(), other.data_request_buffer_ptr_->getBufferSize(), other_with_multi_providers);
+            data_request_buffer_ptr_ = new RingBuffer<CacheServerItem>(other.data_request_buffer_ptr_->getDefaultElement(), other.data_request_buffer_ptr_->getBufferSize(), other_with_multi_providers, other.data_request_buffer_ptr_->isBlockWhenFull());
             assert(data_request_buffer_ptr_ != NULL);
 
             *data_request_buffer_ptr_ = *(other.data_request_buffer_ptr_);
@@ -171,7 +171,7 @@ namespace covered
 
         // Prepare local uncached popularity of key for popularity aggregation
         GetCollectedPopularityParam tmp_param_for_popcollect(key);
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param_for_popcollect); // collected_popularity.is_tracked_ indicates if the local uncached key is tracked in local uncached metadata
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_popcollect); // collected_popularity.is_tracked_ indicates if the local uncached key is tracked in local uncached metadata
 
         // Issue metadata update request if necessary, update victim dirinfo, assert NO local uncached popularity, and perform selective popularity aggregation after local directory eviction
         Edgeset best_placement_edgeset; // Used for non-blocking placement notification if need hybrid data fetching for COVERED
@@ -213,7 +213,7 @@ namespace covered
 
         // Prepare local uncached popularity of key for piggybacking-based popularity collection
         GetCollectedPopularityParam tmp_param(key);
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param); // collected_popularity.is_tracked_ indicates if the local uncached key is tracked in local uncached metadata (due to selective metadata preservation)
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param); // collected_popularity.is_tracked_ indicates if the local uncached key is tracked in local uncached metadata (due to selective metadata preservation)
 
         // Prepare victim syncset for piggybacking-based victim synchronization
         VictimSyncset victim_syncset = tmp_covered_cache_manager_ptr->accessVictimTrackerForLocalVictimSyncset(dst_beacon_edge_idx_for_compression, tmp_edge_wrapper_ptr->getCacheMarginBytes());
@@ -352,7 +352,7 @@ namespace covered
         bool is_finish = false;
 
         // Check if current edge node needs placement
-        std::unordered_set<uint32_t>::const_iterator tmp_best_placement_edgeset_const_iter = tmp_best_placement_edgest.find(current_edge_idx);
+        Edgeset::const_iterator tmp_best_placement_edgeset_const_iter = tmp_best_placement_edgest.find(current_edge_idx);
         bool current_need_placement = false;
         bool current_is_only_placement = false;
         if (tmp_best_placement_edgeset_const_iter != tmp_best_placement_edgest.end())
@@ -524,7 +524,11 @@ namespace covered
             // Notify placement processor to admit local edge cache (NOTE: NO need to admit directory) and trigger local cache eviciton, to avoid blocking cache server worker which may serve subsequent placement calculation if sender is beacon
             const bool is_valid = !is_being_written;
             bool is_successful = tmp_edge_wrapper_ptr->getLocalCacheAdmissionBufferPtr()->push(LocalCacheAdmissionItem(key, value, is_neighbor_cached, is_valid, tmp_extra_common_msghdr));
-            assert(is_successful);
+            if (!is_successful) // NOTE: blocking push fails ONLY if edge node is NOT running now (placement processor stops popping)
+            {
+                assert(!tmp_edge_wrapper_ptr->isNodeRunning());
+                is_finish = true;
+            }
         }
 
         return is_finish;
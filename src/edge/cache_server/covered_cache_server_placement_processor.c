@@ -67,6 +67,7 @@ namespace covered
         // -> (i) local placement notification from cache server worker (local beacon node) or beacon server (remote beacon node) does NOT need directory update request&response and hence NO victim synchronization (see CoveredEdgeWrapper::nonblockNotifyForPlacementInternal_())
         // -> (ii) cache server worker (sender node) has finished remote directory admission with victim synchronization when notifying results of hybrid data fetching to beacon node (see CoveredCacheServer::notifyBeaconForPlacementAfterHybridFetchInternal_())
         // -> (iii) cache server worker (sender node, yet not beacon node) has admitted directory information with victim synchronization after fast-path placement calculation (see CoveredCacheServerWorker::tryToTriggerCachePlacementForGetrspInternal_())
+        // NOTE: cache server workers with in-flight requests also hand over eviction-only items after updating local cached objects (see CacheServerWorkerBase::tryToEvictForCapacity_())
 
         bool is_finish = processLocalCacheAdmissionInternal_(local_cache_admission_item); // NOTE: will update background counter
         return is_finish;
@@ -54,7 +54,7 @@ namespace covered
         // Prepare local uncached popularity of key for popularity aggregation
         // NOTE: NOT need piggyacking-based popularity collection and victim synchronization for local directory lookup
         GetCollectedPopularityParam tmp_param_for_popcollect(key);
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param_for_popcollect); // collected_popularity.is_tracked indicates if the local uncached key is tracked in local uncached metadata
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_popcollect); // collected_popularity.is_tracked indicates if the local uncached key is tracked in local uncached metadata
 
         // NOTE: we always perform victim synchronization before popularity aggregation, as we need the latest synced victim information for placement calculation (note that victim tracker has been updated by getLocalEdgeCache_() before this function)
 
@@ -76,7 +76,7 @@ namespace covered
 
         // Check if key is tracked by local uncached metadata and get local uncached popularity if any
         GetCollectedPopularityParam tmp_param(key);
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param);
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param);
 
         const CollectedPopularity tmp_collected_popularity = tmp_param.getCollectedPopularityConstRef();
         bool is_key_tracked = tmp_collected_popularity.isTracked(); // Indicate if the local uncached key is tracked in local uncached metadata
@@ -110,7 +110,7 @@ namespace covered
         return need_lookup_beacon_directory;
     }
 
-    MessageBase* CoveredCacheServerWorker::getReqToLookupBeaconDirectory_(const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const
+    MessageBase* CoveredCacheServerWorker::getReqToLookupBeaconDirectory_(const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const
     {
         checkPointers_();
         EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
@@ -129,10 +129,10 @@ namespace covered
 
         // Prepare local uncached popularity of key for piggybacking-based popularity collection
         GetCollectedPopularityParam tmp_param(key);
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param); // collected_popularity.is_tracked_ indicates if the local uncached key is tracked in local uncached metadata
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param); // collected_popularity.is_tracked_ indicates if the local uncached key is tracked in local uncached metadata
 
         // Prepare CoveredDirectoryLookupRequest to check directory information in beacon node with popularity collection and victim synchronization
-        MessageBase* covered_directory_lookup_request_ptr = new CoveredDirectoryLookupRequest(key, tmp_param.getCollectedPopularityConstRef(), victim_syncset, edge_idx, edge_cache_server_worker_recvrsp_source_addr_, extra_common_msghdr);
+        MessageBase* covered_directory_lookup_request_ptr = new CoveredDirectoryLookupRequest(key, tmp_param.getCollectedPopularityConstRef(), victim_syncset, edge_idx, recvrsp_source_addr, extra_common_msghdr);
         assert(covered_directory_lookup_request_ptr != NULL);
 
         return covered_directory_lookup_request_ptr;
@@ -227,7 +227,7 @@ namespace covered
         {
             // Check if key is tracked by local uncached metadata and get local uncached popularity if any
             GetCollectedPopularityParam tmp_param(tmp_key);
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param);
 
             const CollectedPopularity& tmp_collected_popularity = tmp_param.getCollectedPopularityConstRef();
             bool is_key_tracked = tmp_collected_popularity.isTracked(); // Indicate if the local uncached key is tracked in local uncached metadata
@@ -249,7 +249,7 @@ namespace covered
         return;
     }
 
-    MessageBase* CoveredCacheServerWorker::getReqToRedirectGet_(const uint32_t& dst_edge_idx_for_compression, const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const
+    MessageBase* CoveredCacheServerWorker::getReqToRedirectGet_(const uint32_t& dst_edge_idx_for_compression, const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const
     {
         checkPointers_();
         EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
@@ -260,7 +260,7 @@ namespace covered
 
         // Prepare redirected get request to fetch data from other edge nodes
         uint32_t edge_idx = tmp_edge_wrapper_ptr->getNodeIdx();
-        MessageBase* covered_redirected_get_request_ptr = new CoveredRedirectedGetRequest(key, victim_syncset, edge_idx, edge_cache_server_worker_recvrsp_source_addr_, extra_common_msghdr);
+        MessageBase* covered_redirected_get_request_ptr = new CoveredRedirectedGetRequest(key, victim_syncset, edge_idx, recvrsp_source_addr, extra_common_msghdr);
         assert(covered_redirected_get_request_ptr != NULL);
 
         return covered_redirected_get_request_ptr;
@@ -397,7 +397,7 @@ namespace covered
         if (!tmp_edge_wrapper_ptr->getEdgeCachePtr()->isLocalCached(key) && !is_tracked_before_fetch_value) // Local uncached object and NOT tracked before fetching value
         {
             GetCollectedPopularityParam tmp_param(key);
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param);
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param);
             const CollectedPopularity tmp_collected_popularity_after_fetch_value = tmp_param.getCollectedPopularityRef();
             const bool is_tracked_after_fetch_value = tmp_collected_popularity_after_fetch_value.isTracked();
             if (is_tracked_after_fetch_value) // Newly-tracked after fetching value from neighbor/cloud (local uncached metadata is updated when accessing local edge cache to try to update invalid value)
@@ -445,7 +445,7 @@ namespace covered
         // NOTE: we NEED popularity aggregation for accumulated changes on local uncached popularity due to directory metadata cache
         // NOTE: NOT need piggyacking-based popularity collection and victim synchronization for local acquire write lock
         GetCollectedPopularityParam tmp_param_for_popcollect(key);
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param_for_popcollect); // collected_popularity.is_tracked_ is false if the given key is local cached or the key is local uncached yet NOT tracked in local uncached metadata
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_popcollect); // collected_popularity.is_tracked_ is false if the given key is local cached or the key is local uncached yet NOT tracked in local uncached metadata
 
         // NOTE: NO need to update local synced victims, which will be done by updateLocalEdgeCache_() and removeLocalEdgeCache_() after this function
 
@@ -457,7 +457,7 @@ namespace covered
         return is_finish;
     }
 
-    MessageBase* CoveredCacheServerWorker::getReqToAcquireBeaconWritelock_(const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const
+    MessageBase* CoveredCacheServerWorker::getReqToAcquireBeaconWritelock_(const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const
     {
         checkPointers_();
         EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
@@ -474,9 +474,9 @@ namespace covered
         // Prepare local uncached popularity of key for piggybacking-based popularity collection
         // NOTE: we NEED popularity aggregation for accumulated changes on local uncached popularity due to directory metadata cache
         GetCollectedPopularityParam tmp_param(key);
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param); // collected_popularity.is_tracked_ is false if the given key is local cached or the key is local uncached yet NOT tracked in local uncached metadata
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param); // collected_popularity.is_tracked_ is false if the given key is local cached or the key is local uncached yet NOT tracked in local uncached metadata
 
-        MessageBase* covered_acquire_writelock_request_ptr = new CoveredAcquireWritelockRequest(key, tmp_param.getCollectedPopularityConstRef(), victim_syncset, edge_idx, edge_cache_server_worker_recvrsp_source_addr_, extra_common_msghdr);
+        MessageBase* covered_acquire_writelock_request_ptr = new CoveredAcquireWritelockRequest(key, tmp_param.getCollectedPopularityConstRef(), victim_syncset, edge_idx, recvrsp_source_addr, extra_common_msghdr);
         assert(covered_acquire_writelock_request_ptr != NULL);
 
         // Remove existing cached directory if any as key will be local cached
@@ -602,7 +602,7 @@ namespace covered
         // NOTE: although acquireLocalWritelock_() has aggregated accumulated changes of local uncached popularity due to directory metadata cache, we still NEED popularity aggregation as local uncached metadata may be updated before releasing the write lock if the global cached key is local uncached
         // NOTE: NOT need piggyacking-based popularity collection and victim synchronization for local release write lock
         GetCollectedPopularityParam tmp_param_for_popcollect(key);
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param_for_popcollect); // collected_popularity.is_tracked_ is false if the given key is local cached or the key is local uncached yet NOT tracked in local uncached metadata
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_popcollect); // collected_popularity.is_tracked_ is false if the given key is local cached or the key is local uncached yet NOT tracked in local uncached metadata
 
         // NOTE: we always perform victim synchronization before popularity aggregation, as we need the latest synced victim information for placement calculation (note that we have updated victim tracker in updateLocalEdgeCache_() or removeLocalEdgeCache_() before this function)
 
@@ -627,7 +627,7 @@ namespace covered
         return is_finish;
     }
 
-    MessageBase* CoveredCacheServerWorker::getReqToReleaseBeaconWritelock_(const Key& key, const ExtraCommonMsghdr& extra_common_msghdr) const
+    MessageBase* CoveredCacheServerWorker::getReqToReleaseBeaconWritelock_(const Key& key, const NetworkAddr& recvrsp_source_addr, const ExtraCommonMsghdr& extra_common_msghdr) const
     {
         checkPointers_();
         EdgeWrapperBase* tmp_edge_wrapper_ptr = cache_server_worker_param_ptr_->getCacheServerPtr()->getEdgeWrapperPtr();
@@ -644,9 +644,9 @@ namespace covered
         // Prepare local uncached popularity of key for piggybacking-based popularity collection
         // NOTE: although getReqToAcquireBeaconWritelock_() has aggregated accumulated changes of local uncached popularity due to directory metadata cache, we still NEED popularity aggregation as local uncached metadata may be updated before releasing the write lock if the global cached key is local uncached
         GetCollectedPopularityParam tmp_param(key);
-        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param); // collected_popularity.is_tracked_ is false if the given key is local cached or the key is local uncached yet NOT tracked in local uncached metadata
+        tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param); // collected_popularity.is_tracked_ is false if the given key is local cached or the key is local uncached yet NOT tracked in local uncached metadata
 
-        MessageBase* covered_release_writelock_request_ptr = new CoveredReleaseWritelockRequest(key, tmp_param.getCollectedPopularityConstRef(), victim_syncset, edge_idx, edge_cache_server_worker_recvrsp_source_addr_, extra_common_msghdr);
+        MessageBase* covered_release_writelock_request_ptr = new CoveredReleaseWritelockRequest(key, tmp_param.getCollectedPopularityConstRef(), victim_syncset, edge_idx, recvrsp_source_addr, extra_common_msghdr);
         assert(covered_release_writelock_request_ptr != NULL);
 
         // Remove existing cached directory if any as key will be local cached
@@ -741,7 +741,7 @@ namespace covered
 
             // Prepare local uncached popularity of key for popularity aggregation
             GetCollectedPopularityParam tmp_param_for_popcollect(key);
-            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param_for_popcollect); // collected_popularity.is_tracked_ is false if the given key is local cached or the key is local uncached yet NOT tracked in local uncached metadata
+            tmp_edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_popcollect); // collected_popularity.is_tracked_ is false if the given key is local cached or the key is local uncached yet NOT tracked in local uncached metadata
 
             // Issue local/remote placement trigger request explicitly
             const uint32_t dst_beacon_edge_idx = tmp_edge_wrapper_ptr->getCooperationWrapperPtr()->getBeaconEdgeIdx(key);
@@ -1042,7 +1042,12 @@ namespace covered
                     // Notify placement processor to admit local edge cache (NOTE: NO need to admit directory) and trigger local cache eviciton, to avoid blocking cache server worker which may serve subsequent fast-path single-placement calculation
                     const bool tmp_is_valid = !tmp_is_being_written;
                     bool tmp_is_successful = tmp_edge_wrapper_ptr->getLocalCacheAdmissionBufferPtr()->push(LocalCacheAdmissionItem(key, value, is_neighbor_cached, tmp_is_valid, extra_common_msghdr));
-                    assert(tmp_is_successful);
+                    if (!tmp_is_successful) // NOTE: blocking push fails ONLY if edge node is NOT running now (placement processor stops popping)
+                    {
+                        assert(!tmp_edge_wrapper_ptr->isNodeRunning());
+                        is_finish = true;
+                        return is_finish;
+                    }
                 }
             }
         }
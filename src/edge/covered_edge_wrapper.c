@@ -14,7 +14,7 @@ namespace covered
     const std::string CoveredEdgeWrapper::kClassName("CoveredEdgeWrapper");
 
     // NOTE: client-edge/cross-edge/edge-cloud propagation latency from CLI is a single trip latency, which should be counted twice within an RTT for weight tuner
-    CoveredEdgeWrapper::CoveredEdgeWrapper(const std::string& cache_name, const uint64_t& capacity_bytes, const uint32_t& edge_idx, const uint32_t& edgecnt, const std::string& hash_name, const uint32_t& keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& percacheserver_workercnt, const uint32_t& peredge_synced_victimcnt, const uint32_t& peredge_monitored_victimsetcnt, const uint64_t& popularity_aggregation_capacity_bytes, const double& popularity_collection_change_ratio, const CLILatencyInfo& cli_latency_info, const uint32_t& topk_edgecnt, const std::string& realnet_option, const std::string& realnet_expname, const std::vector<uint32_t> _p2p_latency_array) : EdgeWrapperBase(cache_name, capacity_bytes, edge_idx, edgecnt, hash_name, keycnt, local_uncached_capacity_bytes, local_uncached_lru_bytes, percacheserver_workercnt, peredge_synced_victimcnt, peredge_monitored_victimsetcnt, popularity_aggregation_capacity_bytes, popularity_collection_change_ratio, cli_latency_info, topk_edgecnt, realnet_option, realnet_expname, _p2p_latency_array), topk_edgecnt_for_placement_(topk_edgecnt), weight_tuner_(edge_idx, edgecnt, cli_latency_info.getPropagationLatencyClientedgeAvgUs(), cli_latency_info.getPropagationLatencyCrossedgeAvgUs(), cli_latency_info.getPropagationLatencyEdgecloudAvgUs(), _p2p_latency_array), covered_cache_manager_ptr_(NULL)
+    CoveredEdgeWrapper::CoveredEdgeWrapper(const std::string& cache_name, const uint64_t& capacity_bytes, const uint32_t& edge_idx, const uint32_t& edgecnt, const std::string& hash_name, const uint32_t& keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& percacheserver_workercnt, const uint32_t& local_cache_shardcnt, const CachelibNvmInfo& cachelib_nvm_info, const uint32_t& cache_server_worker_inflightcnt, const uint32_t& perbeaconserver_workercnt, const uint32_t& peredge_synced_victimcnt, const uint32_t& peredge_monitored_victimsetcnt, const uint64_t& popularity_aggregation_capacity_bytes, const double& popularity_collection_change_ratio, const CLILatencyInfo& cli_latency_info, const uint32_t& topk_edgecnt, const std::string& realnet_option, const std::string& realnet_expname, const std::vector<uint32_t> _p2p_latency_array) : EdgeWrapperBase(cache_name, capacity_bytes, edge_idx, edgecnt, hash_name, keycnt, local_uncached_capacity_bytes, local_uncached_lru_bytes, percacheserver_workercnt, local_cache_shardcnt, cachelib_nvm_info, cache_server_worker_inflightcnt, perbeaconserver_workercnt, peredge_synced_victimcnt, peredge_monitored_victimsetcnt, popularity_aggregation_capacity_bytes, popularity_collection_change_ratio, cli_latency_info, topk_edgecnt, realnet_option, realnet_expname, _p2p_latency_array), topk_edgecnt_for_placement_(topk_edgecnt), weight_tuner_(edge_idx, edgecnt, cli_latency_info.getPropagationLatencyClientedgeAvgUs(), cli_latency_info.getPropagationLatencyCrossedgeAvgUs(), cli_latency_info.getPropagationLatencyEdgecloudAvgUs(), _p2p_latency_array), covered_cache_manager_ptr_(NULL)
     {
         assert(cache_name == Util::COVERED_CACHE_NAME);
 
@@ -192,7 +192,7 @@ namespace covered
         // TODO: is_tracked_before_fetch_value can be set by edge_cache_ptr_->get() for less processing overhead
         is_tracked_before_fetch_value = false;
         GetCollectedPopularityParam tmp_param(key);
-        edge_cache_ptr_->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param);
+        edge_cache_ptr_->constCustomFunc(&tmp_param);
         is_tracked_before_fetch_value = tmp_param.getCollectedPopularityConstRef().isTracked();
 
         return is_local_cached_and_valid;
@@ -331,7 +331,7 @@ namespace covered
         {
             // Get victim cacheinfos of local synced victims for the current edge node
             GetLocalSyncedVictimCacheinfosParam tmp_param;
-            edge_cache_ptr_->constCustomFunc(GetLocalSyncedVictimCacheinfosParam::FUNCNAME, &tmp_param); // NOTE: victim cacheinfos from local edge cache MUST be complete
+            edge_cache_ptr_->constCustomFunc(&tmp_param); // NOTE: victim cacheinfos from local edge cache MUST be complete
 
             // Update local synced victims for the current edge node
             covered_cache_manager_ptr_->updateVictimTrackerForLocalSyncedVictims(local_cache_margin_bytes, tmp_param.getVictimCacheinfosConstRef(), cooperation_wrapper_ptr_);
@@ -466,8 +466,8 @@ namespace covered
 
         // Send placement notification for each non-local edge node in best_placement_edgeset in a non-blocking manner
         const uint32_t current_edge_idx = getNodeIdx();
-        std::unordered_set<uint32_t>::const_iterator edgeset_const_iter_for_local_notification = best_placement_edgeset.end();
-        for (std::unordered_set<uint32_t>::const_iterator edgeset_const_iter_for_remote_notification = best_placement_edgeset.begin(); edgeset_const_iter_for_remote_notification != best_placement_edgeset.end(); edgeset_const_iter_for_remote_notification++)
+        Edgeset::const_iterator edgeset_const_iter_for_local_notification = best_placement_edgeset.end();
+        for (Edgeset::const_iterator edgeset_const_iter_for_remote_notification = best_placement_edgeset.begin(); edgeset_const_iter_for_remote_notification != best_placement_edgeset.end(); edgeset_const_iter_for_remote_notification++)
         {
             const uint32_t& tmp_edge_idx = *edgeset_const_iter_for_remote_notification;
             if (tmp_edge_idx == current_edge_idx) // Skip local edge node
@@ -512,7 +512,11 @@ namespace covered
 
             // Notify placement processor to admit local edge cache (NOTE: NO need to admit directory) and trigger local cache eviciton, to avoid blocking cache server worker / beacon server for subsequent placement calculation
             bool is_successful = getLocalCacheAdmissionBufferPtr()->push(LocalCacheAdmissionItem(key, value, tmp_is_neighbor_cached, is_valid, extra_common_msghdr));
-            assert(is_successful);
+            if (!is_successful) // NOTE: blocking push fails ONLY if edge node is NOT running now (placement processor stops popping)
+            {
+                assert(!isNodeRunning());
+                return;
+            }
 
             /* (OBSOLETE for non-blocking placement deployment)
             // Perform cache admission for local edge cache (equivalent to local placement notification)
@@ -562,7 +566,7 @@ namespace covered
             {
                 // Directly enable/disable is_neighbor_cached flag locally
                 UpdateIsNeighborCachedFlagFuncParam tmp_param(key, is_neighbor_cached);
-                edge_cache_ptr_->customFunc(UpdateIsNeighborCachedFlagFuncParam::FUNCNAME, &tmp_param);
+                edge_cache_ptr_->customFunc(&tmp_param);
             }
             else // The first/last cache copy is a neighbor edge node
             {
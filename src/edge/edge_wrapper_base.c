@@ -67,11 +67,11 @@ namespace covered
         const std::string cache_name = edge_cli_ptr->getCacheName();
         if (cache_name == Util::COVERED_CACHE_NAME)
         {
-            edge_wrapper_ptr = new CoveredEdgeWrapper(cache_name, edge_cli_ptr->getCapacityBytes(), edge_idx, edge_cli_ptr->getEdgecnt(), edge_cli_ptr->getHashName(), edge_cli_ptr->getKeycnt(), edge_cli_ptr->getCoveredLocalUncachedMaxMemUsageBytes(), edge_cli_ptr->getCoveredLocalUncachedLruMaxBytes(), edge_cli_ptr->getPercacheserverWorkercnt(), edge_cli_ptr->getCoveredPeredgeSyncedVictimcnt(), edge_cli_ptr->getCoveredPeredgeMonitoredVictimsetcnt(), edge_cli_ptr->getCoveredPopularityAggregationMaxMemUsageBytes(), edge_cli_ptr->getCoveredPopularityCollectionChangeRatio(), edge_cli_ptr->getCLILatencyInfo(), edge_cli_ptr->getCoveredTopkEdgecnt(), edge_cli_ptr->getRealnetOption(), edge_cli_ptr->getRealnetExpname());
+            edge_wrapper_ptr = new CoveredEdgeWrapper(cache_name, edge_cli_ptr->getCapacityBytes(), edge_idx, edge_cli_ptr->getEdgecnt(), edge_cli_ptr->getHashName(), edge_cli_ptr->getKeycnt(), edge_cli_ptr->getCoveredLocalUncachedMaxMemUsageBytes(), edge_cli_ptr->getCoveredLocalUncachedLruMaxBytes(), edge_cli_ptr->getPercacheserverWorkercnt(), edge_cli_ptr->getLocalCacheShardcnt(), edge_cli_ptr->getCachelibNvmInfo(), edge_cli_ptr->getCacheServerWorkerInflightcnt(), edge_cli_ptr->getPerbeaconserverWorkercnt(), edge_cli_ptr->getCoveredPeredgeSyncedVictimcnt(), edge_cli_ptr->getCoveredPeredgeMonitoredVictimsetcnt(), edge_cli_ptr->getCoveredPopularityAggregationMaxMemUsageBytes(), edge_cli_ptr->getCoveredPopularityCollectionChangeRatio(), edge_cli_ptr->getCLILatencyInfo(), edge_cli_ptr->getCoveredTopkEdgecnt(), edge_cli_ptr->getRealnetOption(), edge_cli_ptr->getRealnetExpname());
         }
         else
         {
-            edge_wrapper_ptr = new BasicEdgeWrapper(cache_name, edge_cli_ptr->getCapacityBytes(), edge_idx, edge_cli_ptr->getEdgecnt(), edge_cli_ptr->getHashName(), edge_cli_ptr->getKeycnt(), edge_cli_ptr->getCoveredLocalUncachedMaxMemUsageBytes(), edge_cli_ptr->getCoveredLocalUncachedLruMaxBytes(), edge_cli_ptr->getPercacheserverWorkercnt(), edge_cli_ptr->getCoveredPeredgeSyncedVictimcnt(), edge_cli_ptr->getCoveredPeredgeMonitoredVictimsetcnt(), edge_cli_ptr->getCoveredPopularityAggregationMaxMemUsageBytes(), edge_cli_ptr->getCoveredPopularityCollectionChangeRatio(), edge_cli_ptr->getCLILatencyInfo(), edge_cli_ptr->getCoveredTopkEdgecnt(), edge_cli_ptr->getRealnetOption(), edge_cli_ptr->getRealnetExpname());
+            edge_wrapper_ptr = new BasicEdgeWrapper(cache_name, edge_cli_ptr->getCapacityBytes(), edge_idx, edge_cli_ptr->getEdgecnt(), edge_cli_ptr->getHashName(), edge_cli_ptr->getKeycnt(), edge_cli_ptr->getCoveredLocalUncachedMaxMemUsageBytes(), edge_cli_ptr->getCoveredLocalUncachedLruMaxBytes(), edge_cli_ptr->getPercacheserverWorkercnt(), edge_cli_ptr->getLocalCacheShardcnt(), edge_cli_ptr->getCachelibNvmInfo(), edge_cli_ptr->getCacheServerWorkerInflightcnt(), edge_cli_ptr->getPerbeaconserverWorkercnt(), edge_cli_ptr->getCoveredPeredgeSyncedVictimcnt(), edge_cli_ptr->getCoveredPeredgeMonitoredVictimsetcnt(), edge_cli_ptr->getCoveredPopularityAggregationMaxMemUsageBytes(), edge_cli_ptr->getCoveredPopularityCollectionChangeRatio(), edge_cli_ptr->getCLILatencyInfo(), edge_cli_ptr->getCoveredTopkEdgecnt(), edge_cli_ptr->getRealnetOption(), edge_cli_ptr->getRealnetExpname());
         }
         assert(edge_wrapper_ptr != NULL);
         edge_wrapper_ptr->start();
@@ -83,7 +83,7 @@ namespace covered
         return NULL;
     }
 
-    EdgeWrapperBase::EdgeWrapperBase(const std::string& cache_name, const uint64_t& capacity_bytes, const uint32_t& edge_idx, const uint32_t& edgecnt, const std::string& hash_name, const uint32_t& keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& percacheserver_workercnt, const uint32_t& peredge_synced_victimcnt, const uint32_t& peredge_monitored_victimsetcnt, const uint64_t& popularity_aggregation_capacity_bytes, const double& popularity_collection_change_ratio, const CLILatencyInfo& cli_latency_info, const uint32_t& topk_edgecnt, const std::string& realnet_option, const std::string& realnet_expname, const std::vector<uint32_t> _p2p_latency_array) : NodeWrapperBase(NodeWrapperBase::EDGE_NODE_ROLE, edge_idx, edgecnt, true), cache_name_(cache_name), capacity_bytes_(capacity_bytes), percacheserver_workercnt_(percacheserver_workercnt), propagation_latency_crossedge_avg_us_(cli_latency_info.getPropagationLatencyCrossedgeAvgUs()), propagation_latency_edgecloud_avg_us_(cli_latency_info.getPropagationLatencyEdgecloudAvgUs()), realnet_option_(realnet_option), realnet_expname_(realnet_expname), edge_background_counter_for_beacon_server_(), is_dumped_for_realnet_(false)
+    EdgeWrapperBase::EdgeWrapperBase(const std::string& cache_name, const uint64_t& capacity_bytes, const uint32_t& edge_idx, const uint32_t& edgecnt, const std::string& hash_name, const uint32_t& keycnt, const uint64_t& local_uncached_capacity_bytes, const uint64_t& local_uncached_lru_bytes, const uint32_t& percacheserver_workercnt, const uint32_t& local_cache_shardcnt, const CachelibNvmInfo& cachelib_nvm_info, const uint32_t& cache_server_worker_inflightcnt, const uint32_t& perbeaconserver_workercnt, const uint32_t& peredge_synced_victimcnt, const uint32_t& peredge_monitored_victimsetcnt, const uint64_t& popularity_aggregation_capacity_bytes, const double& popularity_collection_change_ratio, const CLILatencyInfo& cli_latency_info, const uint32_t& topk_edgecnt, const std::string& realnet_option, const std::string& realnet_expname, const std::vector<uint32_t> _p2p_latency_array) : NodeWrapperBase(NodeWrapperBase::EDGE_NODE_ROLE, edge_idx, edgecnt, true), cache_name_(cache_name), capacity_bytes_(capacity_bytes), percacheserver_workercnt_(percacheserver_workercnt), cache_server_worker_inflightcnt_(cache_server_worker_inflightcnt), perbeaconserver_workercnt_(perbeaconserver_workercnt), propagation_latency_crossedge_avg_us_(cli_latency_info.getPropagationLatencyCrossedgeAvgUs()), propagation_latency_edgecloud_avg_us_(cli_latency_info.getPropagationLatencyEdgecloudAvgUs()), realnet_option_(realnet_option), realnet_expname_(realnet_expname), edge_background_counter_for_beacon_server_(), is_dumped_for_realnet_(false)
     {
         // Differentiate different edge nodes
         std::ostringstream oss;
@@ -91,7 +91,7 @@ namespace covered
         base_instance_name_ = oss.str();
         
         // Allocate local edge cache to store hot objects
-        edge_cache_ptr_ = new CacheWrapper(this, cache_name, edge_idx, capacity_bytes, keycnt, local_uncached_capacity_bytes, local_uncached_lru_bytes, peredge_synced_victimcnt);
+        edge_cache_ptr_ = new CacheWrapper(this, cache_name, edge_idx, capacity_bytes, keycnt, local_uncached_capacity_bytes, local_uncached_lru_bytes, peredge_synced_victimcnt, local_cache_shardcnt, cachelib_nvm_info);
         assert(edge_cache_ptr_ != NULL);
 
         // Allocate cooperation wrapper for cooperative edge caching
@@ -143,7 +143,8 @@ namespace covered
 
         // Allocate ring buffer for local edge cache admissions
         const bool local_cache_admission_with_multi_providers = true; // Multiple providers (edge cache server workers after hybrid data fetching; edge cache server workers and edge beacon server for local placement notifications)
-        local_cache_admission_buffer_ptr_ = new RingBuffer<LocalCacheAdmissionItem>(LocalCacheAdmissionItem(), Config::getEdgeCacheServerDataRequestBufferSize(), local_cache_admission_with_multi_providers);
+        const bool local_cache_admission_is_block_when_full = true; // NOTE: always apply backpressure instead of dropping, as directory info has already been admitted before local cache admission -> block until the edge node stops running (i.e., placement processor stops popping)
+        local_cache_admission_buffer_ptr_ = new RingBuffer<LocalCacheAdmissionItem>(LocalCacheAdmissionItem(), Config::getEdgeCacheServerDataRequestBufferSize(), local_cache_admission_with_multi_providers, local_cache_admission_is_block_when_full, this);
         assert(local_cache_admission_buffer_ptr_ != NULL);
 
         // ONLY used by COVERED
@@ -251,6 +252,7 @@ namespace covered
 
         // Release local cache admission ring buffer
         assert(local_cache_admission_buffer_ptr_ != NULL);
+        Util::dumpInfoMsg(base_instance_name_, "local cache admission ring buffer: " + local_cache_admission_buffer_ptr_->getStatisticsStr());
         delete local_cache_admission_buffer_ptr_;
         local_cache_admission_buffer_ptr_ = NULL;
     }
@@ -272,6 +274,16 @@ namespace covered
         return percacheserver_workercnt_;
     }
 
+    uint32_t EdgeWrapperBase::getCacheServerWorkerInflightcnt() const
+    {
+        return cache_server_worker_inflightcnt_;
+    }
+
+    uint32_t EdgeWrapperBase::getPerbeaconserverWorkercnt() const
+    {
+        return perbeaconserver_workercnt_;
+    }
+
     uint32_t EdgeWrapperBase::getPropagationLatencyCrossedgeAvgUs() const
     {
         return propagation_latency_crossedge_avg_us_;
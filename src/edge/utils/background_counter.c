@@ -24,7 +24,7 @@ namespace covered
     void BackgroundCounter::updateBandwidthUsgae(const BandwidthUsage& other)
     {
         // Acquire a write lock
-        const std::string context_name = "BackgroundCounter::updateBandwidthUsgae()";
+        const char* context_name = "BackgroundCounter::updateBandwidthUsgae()";
         rwlock_for_bankground_counter_ptr_->acquire_lock(context_name);
 
         bandwidth_usage_.update(other);
@@ -39,7 +39,7 @@ namespace covered
         assertBackgroundEvent_(event);
 
         // Acquire a write lock
-        const std::string context_name = "BackgroundCounter::addEvent()";
+        const char* context_name = "BackgroundCounter::addEvent()";
         rwlock_for_bankground_counter_ptr_->acquire_lock(context_name);
 
         event_list_.addEvent(event);
@@ -55,7 +55,7 @@ namespace covered
         assertBackgroundEvent_(tmp_event);
 
         // Acquire a write lock
-        const std::string context_name = "BackgroundCounter::addEvent()";
+        const char* context_name = "BackgroundCounter::addEvent()";
         rwlock_for_bankground_counter_ptr_->acquire_lock(context_name);
 
         event_list_.addEvent(tmp_event);
@@ -73,7 +73,7 @@ namespace covered
         }
 
         // Acquire a write lock
-        const std::string context_name = "BackgroundCounter::addEvents()";
+        const char* context_name = "BackgroundCounter::addEvents()";
         rwlock_for_bankground_counter_ptr_->acquire_lock(context_name);
 
         event_list_.addEvents(events);
@@ -92,7 +92,7 @@ namespace covered
         }
 
         // Acquire a write lock
-        const std::string context_name = "BackgroundCounter::addEvents()";
+        const char* context_name = "BackgroundCounter::addEvents()";
         rwlock_for_bankground_counter_ptr_->acquire_lock(context_name);
 
         event_list_.addEvents(event_list);
@@ -105,7 +105,7 @@ namespace covered
     bool BackgroundCounter::loadAndReset(BandwidthUsage& bandwidth_usage, EventList& event_list)
     {
         // Acquire a write lock
-        const std::string context_name = "BackgroundCounter::loadAndReset()";
+        const char* context_name = "BackgroundCounter::loadAndReset()";
         rwlock_for_bankground_counter_ptr_->acquire_lock(context_name);
 
         bool is_empty_before_reset = is_empty_;
@@ -8,15 +8,21 @@ namespace covered
     {
         is_neighbor_cached_ = false;
         is_valid_ = false;
+        need_admit_directory_ = false;
+        miss_latency_us_ = 0;
+        is_eviction_only_ = false;
     }
 
-    LocalCacheAdmissionItem::LocalCacheAdmissionItem(const Key& key, const Value& value, const bool& is_neighbor_cached, const bool& is_valid, const ExtraCommonMsghdr& extra_common_msghdr)
+    LocalCacheAdmissionItem::LocalCacheAdmissionItem(const Key& key, const Value& value, const bool& is_neighbor_cached, const bool& is_valid, const ExtraCommonMsghdr& extra_common_msghdr, const bool& need_admit_directory, const uint64_t& miss_latency_us, const bool& is_eviction_only)
     {
         key_ = key;
         value_ = value;
         is_neighbor_cached_ = is_neighbor_cached;
         is_valid_ = is_valid;
         extra_common_msghdr_ = extra_common_msghdr;
+        need_admit_directory_ = need_admit_directory;
+        miss_latency_us_ = miss_latency_us;
+        is_eviction_only_ = is_eviction_only;
     }
 
     LocalCacheAdmissionItem::~LocalCacheAdmissionItem() {}
@@ -46,6 +52,21 @@ namespace covered
         return extra_common_msghdr_;
     }
 
+    bool LocalCacheAdmissionItem::needAdmitDirectory() const
+    {
+        return need_admit_directory_;
+    }
+
+    uint64_t LocalCacheAdmissionItem::getMissLatencyUs() const
+    {
+        return miss_latency_us_;
+    }
+
+    bool LocalCacheAdmissionItem::isEvictionOnly() const
+    {
+        return is_eviction_only_;
+    }
+
     const LocalCacheAdmissionItem& LocalCacheAdmissionItem::operator=(const LocalCacheAdmissionItem& other)
     {
         key_ = other.key_;
@@ -53,6 +74,9 @@ namespace covered
         is_neighbor_cached_ = other.is_neighbor_cached_;
         is_valid_ = other.is_valid_;
         extra_common_msghdr_ = other.extra_common_msghdr_;
+        need_admit_directory_ = other.need_admit_directory_;
+        miss_latency_us_ = other.miss_latency_us_;
+        is_eviction_only_ = other.is_eviction_only_;
 
         return *this;
     }
@@ -1,5 +1,7 @@
 /*
  * LocalCacheAdmissionItem: a basic item for local cache admission (provided by cache server worker and beacon server, while consumed by cache server placement processor).
+ *
+ * NOTE: cache server workers with multiplexed in-flight requests also hand over independent admission (with directory admission) and eviction-only items, so that the worker never blocks on directory updates or victim fetching.
  * 
  * By Siyuan Sheng (2023.10.10).
  */
@@ -19,7 +21,7 @@ namespace covered
     {
     public:
         LocalCacheAdmissionItem();
-        LocalCacheAdmissionItem(const Key& key, const Value& value, const bool& is_neighbor_cached, const bool& is_valid, const ExtraCommonMsghdr& extra_common_msghdr);
+        LocalCacheAdmissionItem(const Key& key, const Value& value, const bool& is_neighbor_cached, const bool& is_valid, const ExtraCommonMsghdr& extra_common_msghdr, const bool& need_admit_directory = false, const uint64_t& miss_latency_us = 0, const bool& is_eviction_only = false);
         ~LocalCacheAdmissionItem();
 
         Key getKey() const;
@@ -27,6 +29,9 @@ namespace covered
         bool isNeighborCached() const;
         bool isValid() const;
         ExtraCommonMsghdr getExtraCommonMsghdr() const;
+        bool needAdmitDirectory() const;
+        uint64_t getMissLatencyUs() const;
+        bool isEvictionOnly() const;
 
         const LocalCacheAdmissionItem& operator=(const LocalCacheAdmissionItem& other);    
     private:
@@ -37,6 +42,9 @@ namespace covered
         bool is_neighbor_cached_;
         bool is_valid_;
         ExtraCommonMsghdr extra_common_msghdr_;
+        bool need_admit_directory_; // Admit directory information before local edge cache (independent admission of in-flight requests)
+        uint64_t miss_latency_us_; // ONLY used for LA-Cache
+        bool is_eviction_only_; // Only evict for capacity after cache updates (no admission)
     };
 }
 
@@ -157,7 +157,7 @@ namespace covered
     WeightInfo WeightTuner::getWeightInfo() const
     {
         // Acquire a read lock
-        const std::string context_name = "WeightTuner::getWeightInfo()";
+        const char* context_name = "WeightTuner::getWeightInfo()";
         rwlock_for_weight_tuner_.acquire_lock_shared(context_name);
 
         WeightInfo weight_info = weight_info_;
@@ -169,7 +169,7 @@ namespace covered
     // std::vector<WeightInfo> WeightTuner::getWeightInfoArray() const
     // {
     //     // Acquire a read lock
-    //     const std::string context_name = "WeightTuner::getWeightInfoArray()";
+    //     const char* context_name = "WeightTuner::getWeightInfoArray()";
     //     rwlock_for_weight_tuner_.acquire_lock_shared(context_name);
 
     //     std::vector<WeightInfo> weight_info_array(weight_info_array_);
@@ -181,7 +181,7 @@ namespace covered
     // WeightInfo WeightTuner::getWeightInfoP2P(const uint32_t& edge_idx) const
     // {
 
-    //     const std::string context_name = "WeightTuner::getWeightInfoP2P()";
+    //     const char* context_name = "WeightTuner::getWeightInfoP2P()";
     //     rwlock_for_weight_tuner_.acquire_lock_shared(context_name);
 
 
@@ -197,7 +197,7 @@ namespace covered
     {
         #ifdef ENABLE_PROBABILITY_TUNING
         // Acquire a write lock
-        const std::string context_name = "WeightTuner::incrLocalBeaconAccessCnt()";
+        const char* context_name = "WeightTuner::incrLocalBeaconAccessCnt()";
         rwlock_for_weight_tuner_.acquire_lock(context_name);
 
         local_beacon_access_cnt_ += 1.0;
@@ -220,7 +220,7 @@ namespace covered
     {
         #ifdef ENABLE_PROBABILITY_TUNING
         // Acquire a write lock
-        const std::string context_name = "WeightTuner::incrRemoteBeaconAccessCnt()";
+        const char* context_name = "WeightTuner::incrRemoteBeaconAccessCnt()";
         rwlock_for_weight_tuner_.acquire_lock(context_name);
 
         remote_beacon_access_cnt_ += 1.0;
@@ -243,7 +243,7 @@ namespace covered
     {
         #ifdef ENABLE_PROBABILITY_TUNING
         // Acquire a write lock
-        const std::string context_name = "WeightTuner::incrRemoteBeaconAccessCntArray()";
+        const char* context_name = "WeightTuner::incrRemoteBeaconAccessCntArray()";
         rwlock_for_weight_tuner_.acquire_lock(context_name);
 
         remote_beacon_access_cnt_array_[j] += 1.0;
@@ -268,7 +268,7 @@ namespace covered
     {
         #ifdef ENABLE_WEIGHT_TUNING
         // Acquire a write lock
-        const std::string context_name = "WeightTuner::updateEwmaCrossedgeLatency()";
+        const char* context_name = "WeightTuner::updateEwmaCrossedgeLatency()";
         rwlock_for_weight_tuner_.acquire_lock(context_name);
 
         assert(cur_propagation_latency_crossedge_us > 0);
@@ -299,7 +299,7 @@ namespace covered
     {
         #ifdef ENABLE_WEIGHT_TUNING
         // Acquire a write lock
-        const std::string context_name = "WeightTuner::updateEwmaCrossedgeLatency_of_j()";
+        const char* context_name = "WeightTuner::updateEwmaCrossedgeLatency_of_j()";
         rwlock_for_weight_tuner_.acquire_lock(context_name);
 
         assert(cur_latency > 0);
@@ -338,7 +338,7 @@ namespace covered
     {
         #ifdef ENABLE_WEIGHT_TUNING
         // Acquire a write lock
-        const std::string context_name = "WeightTuner::updateEwmaEdgecloudLatency()";
+        const char* context_name = "WeightTuner::updateEwmaEdgecloudLatency()";
         rwlock_for_weight_tuner_.acquire_lock(context_name);
 
         assert(cur_propagation_latency_edgecloud_us > 0);
@@ -358,7 +358,7 @@ namespace covered
     // void WeightTuner::tuneWeightInfo()
     // {
     //     // Acquire a write lock
-    //     const std::string context_name = "WeightTuner::tuneWeightInfo()";
+    //     const char* context_name = "WeightTuner::tuneWeightInfo()";
     //     rwlock_for_weight_tuner_.acquire_lock(context_name);
 
     //     // Manually tune weight info
@@ -69,6 +69,7 @@ namespace covered
     const std::string Event::CLOUD_GET_ROCKSDB_EVENT_NAME("cloud::get_rocksdb");
     const std::string Event::CLOUD_PUT_ROCKSDB_EVENT_NAME("cloud::put_rocksdb");
     const std::string Event::CLOUD_DEL_ROCKSDB_EVENT_NAME("cloud::del_rocksdb");
+    const std::string Event::CLOUD_DATA_SERVER_WORKER_QUEUEING_EVENT_NAME("cloud::data_server_worker::queueing");
 
     // For edge cache server victim fetch processor
     const std::string Event::EDGE_CACHE_SERVER_VICTIM_FETCH_PROCESSOR_FETCHING_EVENT_NAME("edge::cache_server_victim_fetch_processor::fetching");
@@ -76,6 +77,7 @@ namespace covered
     // For background events
     const std::string Event::BG_EDGE_CACHE_SERVER_WORKER_TARGET_GET_LOCAL_CACHE_EVENT_NAME("bg::edge::cache_server_worker::target_get_local_cache");
     const std::string Event::BG_CLOUD_GET_ROCKSDB_EVENT_NAME("bg::cloud::get_rocksdb");
+    const std::string Event::BG_CLOUD_DATA_SERVER_WORKER_QUEUEING_EVENT_NAME("bg::cloud::data_server_worker::queueing");
     const std::string Event::BG_EDGE_CACHE_SERVER_PLACEMENT_PROCESSOR_PLACEMENT_NOTIFY_EVENT_NAME("bg::edge::cache_server_placement_processor::placement_notify");
     const std::string Event::BG_EDGE_CACHE_SERVER_PLACEMENT_PROCESSOR_LOCAL_CACHE_ADMISSION_EVENT_NAME("bg::edge::cache_server_placement_processor::local_cache_admission");
     const std::string Event::BG_EDGE_CACHE_SERVER_UPDATE_DIRECTORY_TO_ADMIT_EVENT_NAME("bg::edge:cache_server::update_diretory_to_admit");
@@ -113,7 +115,7 @@ namespace covered
 
     bool Event::isBackgroundEvent() const
     {
-        if (event_name_ == BG_EDGE_CACHE_SERVER_WORKER_TARGET_GET_LOCAL_CACHE_EVENT_NAME || event_name_ == BG_CLOUD_GET_ROCKSDB_EVENT_NAME || event_name_ == BG_EDGE_CACHE_SERVER_PLACEMENT_PROCESSOR_PLACEMENT_NOTIFY_EVENT_NAME || event_name_ == BG_EDGE_CACHE_SERVER_PLACEMENT_PROCESSOR_LOCAL_CACHE_ADMISSION_EVENT_NAME || event_name_ == BG_EDGE_CACHE_SERVER_UPDATE_DIRECTORY_TO_ADMIT_EVENT_NAME || event_name_ == BG_EDGE_CACHE_SERVER_UPDATE_DIRECTORY_TO_EVICT_EVENT_NAME || event_name_ == BG_EDGE_BEACON_SERVER_UPDATE_LOCAL_DIRECTORY_EVENT_NAME || event_name_ == BG_EDGE_CACHE_SERVER_METADATA_UPDATE_PROCESSOR_UPDATE_EVENT_NAME)
+        if (event_name_ == BG_EDGE_CACHE_SERVER_WORKER_TARGET_GET_LOCAL_CACHE_EVENT_NAME || event_name_ == BG_CLOUD_GET_ROCKSDB_EVENT_NAME || event_name_ == BG_CLOUD_DATA_SERVER_WORKER_QUEUEING_EVENT_NAME || event_name_ == BG_EDGE_CACHE_SERVER_PLACEMENT_PROCESSOR_PLACEMENT_NOTIFY_EVENT_NAME || event_name_ == BG_EDGE_CACHE_SERVER_PLACEMENT_PROCESSOR_LOCAL_CACHE_ADMISSION_EVENT_NAME || event_name_ == BG_EDGE_CACHE_SERVER_UPDATE_DIRECTORY_TO_ADMIT_EVENT_NAME || event_name_ == BG_EDGE_CACHE_SERVER_UPDATE_DIRECTORY_TO_EVICT_EVENT_NAME || event_name_ == BG_EDGE_BEACON_SERVER_UPDATE_LOCAL_DIRECTORY_EVENT_NAME || event_name_ == BG_EDGE_CACHE_SERVER_METADATA_UPDATE_PROCESSOR_UPDATE_EVENT_NAME)
         {
             return true;
         }
@@ -78,6 +78,7 @@ namespace covered
         static const std::string CLOUD_GET_ROCKSDB_EVENT_NAME;
         static const std::string CLOUD_PUT_ROCKSDB_EVENT_NAME;
         static const std::string CLOUD_DEL_ROCKSDB_EVENT_NAME;
+        static const std::string CLOUD_DATA_SERVER_WORKER_QUEUEING_EVENT_NAME; // Time from receiving a global request by cloud data server to being processed by a data server worker (NOT including RocksDB access)
 
         // For edge cache server victim fetch processor
         static const std::string EDGE_CACHE_SERVER_VICTIM_FETCH_PROCESSOR_FETCHING_EVENT_NAME;
@@ -85,6 +86,7 @@ namespace covered
         // For background events
         static const std::string BG_EDGE_CACHE_SERVER_WORKER_TARGET_GET_LOCAL_CACHE_EVENT_NAME; // For reads in edge cache server worker (non-blocking data fetching)
         static const std::string BG_CLOUD_GET_ROCKSDB_EVENT_NAME; // For cloud (non-blocking data fetching)
+        static const std::string BG_CLOUD_DATA_SERVER_WORKER_QUEUEING_EVENT_NAME; // For cloud (non-blocking data fetching)
         static const std::string BG_EDGE_CACHE_SERVER_PLACEMENT_PROCESSOR_PLACEMENT_NOTIFY_EVENT_NAME; // For placement notify requests in edge cache server placement processor (non-blocking placement notification)
         static const std::string BG_EDGE_CACHE_SERVER_PLACEMENT_PROCESSOR_LOCAL_CACHE_ADMISSION_EVENT_NAME; // For local cache admissions in edge cache server placement processor (for local placement notification or hybrid data fetching)
         static const std::string BG_EDGE_CACHE_SERVER_UPDATE_DIRECTORY_TO_ADMIT_EVENT_NAME; // For edge cache server worker or placement processor (non-blocking placement notification)
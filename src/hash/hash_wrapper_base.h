@@ -22,11 +22,11 @@ namespace covered
         virtual ~HashWrapperBase();
 
         // Hash functions for different types of input
-        uint32_t hash(const Key& key) const;
+        uint32_t hash(const Key& key) const; // NOTE: derived from the precomputed key hash w/o hashing key string again
     private:
         static const std::string kClassName;
 
-        virtual uint32_t hashInternal_(const char *input, uint32_t length) const = 0;
+        virtual uint32_t hashInternal_(const uint64_t& key_hash) const = 0;
     };
 }
 
@@ -1,9 +1,5 @@
 #include "hash/mmh3_hash_wrapper.h"
 
-#include <assert.h>
-
-#include "MurmurHash3.h"
-
 namespace covered
 {
     const std::string Mmh3HashWrapper::kClassName("Mmh3HashWrapper");
@@ -14,12 +10,17 @@ namespace covered
 
     Mmh3HashWrapper::~Mmh3HashWrapper() {}
 
-    uint32_t Mmh3HashWrapper::hashInternal_(const char *input, uint32_t length) const
+    uint32_t Mmh3HashWrapper::hashInternal_(const uint64_t& key_hash) const
     {
-        assert(input != NULL);
+        // MurmurHash3 fmix64 over the key hash perturbed by seed (golden ratio increment as SplitMix64)
+        uint64_t tmp_hash = key_hash + static_cast<uint64_t>(seed_) * 0x9E3779B97F4A7C15ULL;
+        tmp_hash ^= tmp_hash >> 33;
+        tmp_hash *= 0xFF51AFD7ED558CCDULL;
+        tmp_hash ^= tmp_hash >> 33;
+        tmp_hash *= 0xC4CEB9FE1A85EC53ULL;
+        tmp_hash ^= tmp_hash >> 33;
 
-        uint32_t hash_value = 0;
-        MurmurHash3_x86_32((const void*)input, static_cast<int>(length), seed_, &hash_value);
+        uint32_t hash_value = static_cast<uint32_t>(tmp_hash ^ (tmp_hash >> 32));
         return hash_value;
     }
-}
\ No newline at end of file
+}
@@ -1,5 +1,7 @@
 /*
  * Mmh3HashWrapper: mmh3-based consistent hashing.
+ *
+ * NOTE: we derive the 32-bit seeded hash value from the precomputed MurmurHash3 x64 key hash by the MurmurHash3 64-bit finalizer (fmix64), such that different seeds (e.g., for CBF and MAGNET) still get independent hash values w/o re-hashing the key string.
  * 
  * By Siyuan Sheng (2023.06.05).
  */
@@ -21,7 +23,7 @@ namespace covered
     private:
         static const std::string kClassName;
 
-        virtual uint32_t hashInternal_(const char *input, uint32_t length) const override;
+        virtual uint32_t hashInternal_(const uint64_t& key_hash) const override;
 
         const uint32_t seed_;
     };
@@ -0,0 +1,543 @@
+/*
+ * Microbenchmark of key-heavy paths (hash table probes, per-key rwlock indexing, ConcurrentHashtable, and DirectoryTable::lookup()).
+ *
+ * NOTE: legacy variants emulate the previous Key behavior (copy key string by getKeystr() and re-hash it for each KeyHasher/HashWrapperBase call), while current variants use the precomputed key hash; we report average latency (ns) per operation.
+ *
+ * NOTE: for directory entry dispatch, legacy variants emulate the previous string-named DirectoryEntry::call()/constCall() with void* params, while current variants pass callables into ConcurrentHashtable.
+ *
+ * NOTE: for directory layout, besides bytes for capacity (i.e., getSizeForCapacity()), we also measure real memory by live heap bytes (counted by malloc_usable_size() in global operator new/delete) around population of each layout.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib> // malloc, free
+#include <cstring> // memcpy
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <malloc.h> // malloc_usable_size
+#include <new>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "MurmurHash3.h"
+
+#include "common/key.h"
+#include "common/util.h"
+#include "concurrency/concurrent_hashtable_impl.h"
+#include "concurrency/perkey_rwlock.h"
+#include "cooperation/directory/directory_entry.h"
+#include "cooperation/directory/directory_info.h"
+#include "cooperation/directory/directory_metadata.h"
+#include "cooperation/directory/metadata_update_requirement.h"
+#include "cooperation/directory_table.h"
+#include "hash/hash_wrapper_base.h"
+
+namespace
+{
+    const std::string kClassName("key_microbenchmark");
+
+    // Live heap bytes allocated by global operator new (NOT including malloc chunk headers)
+    std::atomic<int64_t> live_heap_bytes(0);
+
+    int64_t getLiveHeapBytes()
+    {
+        return live_heap_bytes.load(std::memory_order_relaxed);
+    }
+
+    // Previous KeyHasher: copy key string and hash it by std::hash for each probe
+    class LegacyKeyHasher
+    {
+    public:
+        size_t operator()(const covered::Key& key) const
+        {
+            return std::hash<std::string>{}(key.getKeystr());
+        }
+    };
+
+    // Previous HashWrapperBase::hash(): copy key string and hash it by MMH3 for each call
+    uint32_t legacyHash(const covered::Key& key)
+    {
+        uint32_t hash_value = 0;
+        MurmurHash3_x86_32((const void*)key.getKeystr().data(), static_cast<int>(key.getKeyLength()), 0, &hash_value);
+        return hash_value;
+    }
+
+    // Previous string-named dispatch of DirectoryEntry::call()/constCall() (funcnames and params are the same as before)
+    const std::string kLegacyAddDirinfoFuncname("addDirinfo");
+    const std::string kLegacyRemoveDirinfoFuncname("removeDirinfo");
+    const std::string kLegacyInvalidateMetadataForAllDirinfoFuncname("invalidateMetadataForAllDirinfo");
+    const std::string kLegacyValidateMetadataForDirinfoFuncname("validateMetadataForDirinfo");
+    const std::string kLegacyGetAllValidDirinfoFuncname("getAllValidDirinfo");
+    const std::string kLegacyGetAllDirinfoFuncname("getAllDirinfo");
+
+    struct LegacyAddDirinfoParam
+    {
+        const covered::DirectoryInfo* directory_info_ptr;
+        const covered::DirectoryMetadata* directory_metadata_ptr;
+        covered::MetadataUpdateRequirement* metadata_update_requirement_ptr;
+        bool is_directory_already_exist;
+    };
+
+    struct LegacyGetAllValidDirinfoParam
+    {
+        covered::DirinfoSet* dirinfo_set_ptr;
+    };
+
+    __attribute__((noinline)) bool legacyCall(covered::DirectoryEntry& directory_entry, const std::string& function_name, void* param_ptr)
+    {
+        if (function_name == kLegacyAddDirinfoFuncname)
+        {
+            LegacyAddDirinfoParam* tmp_param_ptr = static_cast<LegacyAddDirinfoParam*>(param_ptr);
+            tmp_param_ptr->is_directory_already_exist = directory_entry.addDirinfo(*tmp_param_ptr->directory_info_ptr, *tmp_param_ptr->directory_metadata_ptr, *tmp_param_ptr->metadata_update_requirement_ptr);
+        }
+        else if (function_name == kLegacyRemoveDirinfoFuncname || function_name == kLegacyInvalidateMetadataForAllDirinfoFuncname || function_name == kLegacyValidateMetadataForDirinfoFuncname)
+        {
+            // NOTE: NOT used in the microbenchmark yet still compared as before
+        }
+        return false; // NOT erase
+    }
+
+    __attribute__((noinline)) void legacyConstCall(const covered::DirectoryEntry& directory_entry, const std::string& function_name, void* param_ptr)
+    {
+        if (function_name == kLegacyGetAllValidDirinfoFuncname)
+        {
+            LegacyGetAllValidDirinfoParam* tmp_param_ptr = static_cast<LegacyGetAllValidDirinfoParam*>(param_ptr);
+            directory_entry.getAllValidDirinfo(*tmp_param_ptr->dirinfo_set_ptr);
+        }
+        else if (function_name == kLegacyGetAllDirinfoFuncname)
+        {
+            // NOTE: NOT used in the microbenchmark yet still compared as before
+        }
+        return;
+    }
+
+    // Previous DirectoryEntry layout: a per-key std::unordered_map from dirinfo to directory metadata (ONLY methods used in the microbenchmark)
+    class LegacyDirectoryEntry
+    {
+    public:
+        bool addDirinfo(const covered::DirectoryInfo& directory_info, const covered::DirectoryMetadata& directory_metadata)
+        {
+            std::pair<dirinfo_entry_t::iterator, bool> tmp_result = directory_entry_.insert(std::pair<covered::DirectoryInfo, covered::DirectoryMetadata>(directory_info, directory_metadata));
+            if (!tmp_result.second)
+            {
+                tmp_result.first->second = directory_metadata;
+            }
+            return !tmp_result.second;
+        }
+
+        void getAllValidDirinfo(covered::DirinfoSet& dirinfo_set) const
+        {
+            std::list<covered::DirectoryInfo> tmp_dirinfo_set;
+            for (dirinfo_entry_t::const_iterator iter = directory_entry_.begin(); iter != directory_entry_.end(); iter++)
+            {
+                if (iter->second.isValidMetadata())
+                {
+                    tmp_dirinfo_set.push_back(iter->first);
+                }
+            }
+            dirinfo_set = covered::DirinfoSet(tmp_dirinfo_set);
+            return;
+        }
+
+        uint64_t getSizeForCapacity() const
+        {
+            uint64_t size = 0;
+            for (dirinfo_entry_t::const_iterator iter = directory_entry_.begin(); iter != directory_entry_.end(); iter++)
+            {
+                size += iter->first.getSizeForCapacity();
+                size += iter->second.getSizeForCapacity();
+            }
+            return size;
+        }
+    private:
+        typedef std::unordered_map<covered::DirectoryInfo, covered::DirectoryMetadata, covered::DirectoryInfoHasher> dirinfo_entry_t;
+
+        dirinfo_entry_t directory_entry_;
+    };
+
+    double getElapsedNsPerOp(const std::chrono::steady_clock::time_point& start_time, const uint64_t& opcnt)
+    {
+        const double elapsed_ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start_time).count();
+        return elapsed_ns / static_cast<double>(opcnt);
+    }
+
+    void dumpResult(const std::string& path_name, const std::string& variant_name, const double& ns_per_op, const uint64_t& checksum)
+    {
+        std::cout << std::left << std::setw(32) << path_name << std::setw(12) << variant_name << std::setw(16) << std::fixed << std::setprecision(2) << ns_per_op << checksum << std::endl;
+        return;
+    }
+}
+
+// Count live heap bytes for real memory of directory layouts (NOTE: operator new[]/delete[] call the following ones by default)
+
+void* operator new(size_t size)
+{
+    void* ptr = malloc(size == 0 ? 1 : size);
+    if (ptr == NULL)
+    {
+        throw std::bad_alloc();
+    }
+    live_heap_bytes.fetch_add(static_cast<int64_t>(malloc_usable_size(ptr)), std::memory_order_relaxed);
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    if (ptr != NULL)
+    {
+        live_heap_bytes.fetch_sub(static_cast<int64_t>(malloc_usable_size(ptr)), std::memory_order_relaxed);
+        free(ptr);
+    }
+    return;
+}
+
+void operator delete(void* ptr, size_t size) noexcept
+{
+    UNUSED(size);
+    operator delete(ptr);
+    return;
+}
+
+int main(int argc, char **argv) {
+    // (1) Parse CLI parameters
+
+    boost::program_options::options_description argument_desc("Allowed arguments for " + kClassName);
+    argument_desc.add_options()
+        ("help,h", "dump help information")
+        ("keycnt", boost::program_options::value<uint32_t>()->default_value(100000), "the number of distinct keys")
+        ("keysize", boost::program_options::value<uint32_t>()->default_value(16), "the key size in units of bytes (keys longer than the inline capacity of Key are stored in heap)")
+        ("opcnt", boost::program_options::value<uint64_t>()->default_value(1000000), "the number of operations for each path")
+        ("dirinfocnt", boost::program_options::value<uint32_t>()->default_value(2), "the number of dirinfos (i.e., cache copies) per key for directory layout")
+        ("fine_grained_locking_size", boost::program_options::value<uint32_t>()->default_value(1000), "the number of per-key rwlocks (the same as config.json by default)")
+    ;
+    boost::program_options::variables_map argument_info;
+    boost::program_options::store(boost::program_options::parse_command_line(argc, argv, argument_desc), argument_info);
+    boost::program_options::notify(argument_info);
+    if (argument_info.count("help"))
+    {
+        std::cout << argument_desc << std::endl;
+        return 0;
+    }
+
+    const uint32_t keycnt = argument_info["keycnt"].as<uint32_t>();
+    const uint32_t keysize = argument_info["keysize"].as<uint32_t>();
+    const uint64_t opcnt = argument_info["opcnt"].as<uint64_t>();
+    const uint32_t dirinfocnt = argument_info["dirinfocnt"].as<uint32_t>();
+    const uint32_t fine_grained_locking_size = argument_info["fine_grained_locking_size"].as<uint32_t>();
+    if (keycnt == 0 || keysize < sizeof(uint32_t) || fine_grained_locking_size == 0 || dirinfocnt == 0 || dirinfocnt > 256)
+    {
+        std::cerr << "[ERROR] " << kClassName << ": keycnt and fine_grained_locking_size MUST be positive, keysize MUST be at least " << sizeof(uint32_t) << ", and dirinfocnt MUST be within [1, 256]" << std::endl;
+        return 1;
+    }
+
+    // (2) Prepare keys and a deterministic access sequence
+
+    std::vector<covered::Key> keys;
+    keys.reserve(keycnt);
+    for (uint32_t i = 0; i < keycnt; i++)
+    {
+        std::string tmp_keystr(keysize, 'k');
+        memcpy(&tmp_keystr[0], &i, sizeof(uint32_t));
+        keys.push_back(covered::Key(tmp_keystr));
+    }
+    std::mt19937_64 randgen(0);
+    std::uniform_int_distribution<uint32_t> key_dist(0, keycnt - 1);
+    std::vector<uint32_t> access_sequence(opcnt);
+    for (uint64_t i = 0; i < opcnt; i++)
+    {
+        access_sequence[i] = key_dist(randgen);
+    }
+
+    std::cout << "keycnt: " << keycnt << "; keysize: " << keysize << "; opcnt: " << opcnt << "; sizeof(Key): " << sizeof(covered::Key) << std::endl;
+    std::cout << std::left << std::setw(32) << "path" << std::setw(12) << "variant" << std::setw(16) << "ns/op" << "checksum" << std::endl;
+
+    // (3) std::unordered_map probes (e.g., validity map, cache metadata, and lookup tables of local edge caches)
+
+    {
+        std::unordered_map<covered::Key, uint32_t, LegacyKeyHasher> legacy_map;
+        std::unordered_map<covered::Key, uint32_t, covered::KeyHasher> current_map;
+        for (uint32_t i = 0; i < keycnt; i++)
+        {
+            legacy_map.insert(std::pair<covered::Key, uint32_t>(keys[i], i));
+            current_map.insert(std::pair<covered::Key, uint32_t>(keys[i], i));
+        }
+
+        uint64_t checksum = 0;
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < opcnt; i++)
+        {
+            checksum += legacy_map.find(keys[access_sequence[i]])->second;
+        }
+        dumpResult("unordered_map::find", "legacy", getElapsedNsPerOp(start_time, opcnt), checksum);
+
+        checksum = 0;
+        start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < opcnt; i++)
+        {
+            checksum += current_map.find(keys[access_sequence[i]])->second;
+        }
+        dumpResult("unordered_map::find", "current", getElapsedNsPerOp(start_time, opcnt), checksum);
+    }
+
+    // (4) Per-key rwlock index (also the same as DHT lookup and cache server partitioning)
+
+    {
+        covered::PerkeyRwlock perkey_rwlock(0, fine_grained_locking_size, true);
+
+        uint64_t checksum = 0;
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < opcnt; i++)
+        {
+            checksum += legacyHash(keys[access_sequence[i]]) % fine_grained_locking_size;
+        }
+        dumpResult("PerkeyRwlock::getRwlockIndex", "legacy", getElapsedNsPerOp(start_time, opcnt), checksum);
+
+        checksum = 0;
+        start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < opcnt; i++)
+        {
+            checksum += perkey_rwlock.getRwlockIndex(keys[access_sequence[i]]);
+        }
+        dumpResult("PerkeyRwlock::getRwlockIndex", "current", getElapsedNsPerOp(start_time, opcnt), checksum);
+    }
+
+    // (5) ConcurrentHashtable and DirectoryTable (current ONLY, as they are built upon KeyHasher and PerkeyRwlock above), and directory entry dispatch (legacy vs. current)
+
+    {
+        covered::PerkeyRwlock perkey_rwlock(0, fine_grained_locking_size, true);
+        covered::DirectoryTable directory_table(0, 0, &perkey_rwlock);
+
+        // DirectoryTable::update() -> ConcurrentHashtable::insertOrCall()
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < keycnt; i++)
+        {
+            covered::MetadataUpdateRequirement tmp_metadata_update_requirement;
+            perkey_rwlock.acquire_lock(keys[i], "key_microbenchmark::update");
+            directory_table.update(keys[i], true, covered::DirectoryInfo(i % 8), covered::DirectoryMetadata(true), tmp_metadata_update_requirement);
+            perkey_rwlock.unlock(keys[i], "key_microbenchmark::update");
+        }
+        dumpResult("DirectoryTable::update", "current", getElapsedNsPerOp(start_time, keycnt), keycnt);
+
+        // DirectoryTable::lookup() -> ConcurrentHashtable::constCallIfExist()
+        uint64_t checksum = 0;
+        start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < opcnt; i++)
+        {
+            const covered::Key& tmp_key = keys[access_sequence[i]];
+            bool is_valid_directory_exist = false;
+            covered::DirectoryInfo tmp_directory_info;
+            perkey_rwlock.acquire_lock_shared(tmp_key, "key_microbenchmark::lookup");
+            checksum += directory_table.lookup(tmp_key, 8, is_valid_directory_exist, tmp_directory_info) ? 1 : 0;
+            perkey_rwlock.unlock_shared(tmp_key, "key_microbenchmark::lookup");
+        }
+        dumpResult("DirectoryTable::lookup", "current", getElapsedNsPerOp(start_time, opcnt), checksum);
+    }
+
+    {
+        // Directory entry dispatch within ConcurrentHashtable (i.e., the hot part of DirectoryTable::update()/lookup())
+        covered::PerkeyRwlock perkey_rwlock(0, fine_grained_locking_size, true);
+        covered::ConcurrentHashtable<covered::DirectoryEntry> legacy_hashtable("legacy_hashtable", covered::DirectoryEntry(), &perkey_rwlock);
+        covered::ConcurrentHashtable<covered::DirectoryEntry> current_hashtable("current_hashtable", covered::DirectoryEntry(), &perkey_rwlock);
+        const covered::DirectoryMetadata tmp_directory_metadata(true);
+        for (uint32_t i = 0; i < keycnt; i++) // Prepopulate keys (untimed) to invoke dispatch for existing keys below
+        {
+            covered::DirectoryEntry tmp_directory_entry;
+            covered::MetadataUpdateRequirement tmp_metadata_update_requirement;
+            tmp_directory_entry.addDirinfo(covered::DirectoryInfo(i % 8), tmp_directory_metadata, tmp_metadata_update_requirement);
+            bool is_exist = false;
+            perkey_rwlock.acquire_lock(keys[i], "key_microbenchmark::prepopulate");
+            legacy_hashtable.insertOrCall(keys[i], tmp_directory_entry, is_exist, [](covered::DirectoryEntry&) { return false; });
+            current_hashtable.insertOrCall(keys[i], tmp_directory_entry, is_exist, [](covered::DirectoryEntry&) { return false; });
+            perkey_rwlock.unlock(keys[i], "key_microbenchmark::prepopulate");
+        }
+
+        // Add a second dirinfo into existing directory entry
+        uint64_t checksum = 0;
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < keycnt; i++)
+        {
+            const covered::DirectoryInfo tmp_directory_info((i + 1) % 8);
+            covered::MetadataUpdateRequirement tmp_metadata_update_requirement;
+            LegacyAddDirinfoParam tmp_param = {&tmp_directory_info, &tmp_directory_metadata, &tmp_metadata_update_requirement, false};
+            bool is_exist = false;
+            perkey_rwlock.acquire_lock(keys[i], "key_microbenchmark::update");
+            legacy_hashtable.insertOrCall(keys[i], covered::DirectoryEntry(), is_exist, [&tmp_param](covered::DirectoryEntry& existing_directory_entry) {
+                return legacyCall(existing_directory_entry, kLegacyAddDirinfoFuncname, &tmp_param);
+            });
+            perkey_rwlock.unlock(keys[i], "key_microbenchmark::update");
+            checksum += tmp_param.is_directory_already_exist ? 0 : 1;
+        }
+        dumpResult("Direntry dispatch (update)", "legacy", getElapsedNsPerOp(start_time, keycnt), checksum);
+
+        checksum = 0;
+        start_time = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < keycnt; i++)
+        {
+            const covered::DirectoryInfo tmp_directory_info((i + 1) % 8);
+            covered::MetadataUpdateRequirement tmp_metadata_update_requirement;
+            bool is_directory_already_exist = false;
+            bool is_exist = false;
+            perkey_rwlock.acquire_lock(keys[i], "key_microbenchmark::update");
+            current_hashtable.insertOrCall(keys[i], covered::DirectoryEntry(), is_exist, [&](covered::DirectoryEntry& existing_directory_entry) {
+                is_directory_already_exist = existing_directory_entry.addDirinfo(tmp_directory_info, tmp_directory_metadata, tmp_metadata_update_requirement);
+                return false; // NOT erase
+            });
+            perkey_rwlock.unlock(keys[i], "key_microbenchmark::update");
+            checksum += is_directory_already_exist ? 0 : 1;
+        }
+        dumpResult("Direntry dispatch (update)", "current", getElapsedNsPerOp(start_time, keycnt), checksum);
+
+        // Get all valid dirinfos of existing directory entry
+        checksum = 0;
+        start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < opcnt; i++)
+        {
+            covered::DirinfoSet tmp_dirinfo_set;
+            LegacyGetAllValidDirinfoParam tmp_param = {&tmp_dirinfo_set};
+            const covered::Key& tmp_key = keys[access_sequence[i]];
+            bool is_exist = false;
+            perkey_rwlock.acquire_lock_shared(tmp_key, "key_microbenchmark::lookup");
+            legacy_hashtable.constCallIfExist(tmp_key, is_exist, [&tmp_param](const covered::DirectoryEntry& directory_entry) {
+                legacyConstCall(directory_entry, kLegacyGetAllValidDirinfoFuncname, &tmp_param);
+            });
+            perkey_rwlock.unlock_shared(tmp_key, "key_microbenchmark::lookup");
+            uint32_t tmp_dirinfo_set_size = 0;
+            tmp_dirinfo_set.getDirinfoSetSizeIfComplete(tmp_dirinfo_set_size);
+            checksum += tmp_dirinfo_set_size;
+        }
+        dumpResult("Direntry dispatch (lookup)", "legacy", getElapsedNsPerOp(start_time, opcnt), checksum);
+
+        checksum = 0;
+        start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < opcnt; i++)
+        {
+            covered::DirinfoSet tmp_dirinfo_set;
+            const covered::Key& tmp_key = keys[access_sequence[i]];
+            bool is_exist = false;
+            perkey_rwlock.acquire_lock_shared(tmp_key, "key_microbenchmark::lookup");
+            current_hashtable.constCallIfExist(tmp_key, is_exist, [&tmp_dirinfo_set](const covered::DirectoryEntry& directory_entry) {
+                directory_entry.getAllValidDirinfo(tmp_dirinfo_set);
+            });
+            perkey_rwlock.unlock_shared(tmp_key, "key_microbenchmark::lookup");
+            uint32_t tmp_dirinfo_set_size = 0;
+            tmp_dirinfo_set.getDirinfoSetSizeIfComplete(tmp_dirinfo_set_size);
+            checksum += tmp_dirinfo_set_size;
+        }
+        dumpResult("Direntry dispatch (lookup)", "current", getElapsedNsPerOp(start_time, opcnt), checksum);
+    }
+
+    // (6) Directory table layout (previous per-key std::unordered_map within std::unordered_map buckets vs. current inline-packed entries within open-addressing buckets)
+
+    {
+        covered::PerkeyRwlock perkey_rwlock(0, fine_grained_locking_size, true);
+        const covered::DirectoryMetadata tmp_directory_metadata(true);
+
+        // Populate keys of the legacy layout (untimed) and measure its live heap bytes
+        const int64_t legacy_start_heap_bytes = getLiveHeapBytes();
+        covered::ConcurrentHashtable<LegacyDirectoryEntry> legacy_hashtable("legacy_hashtable", LegacyDirectoryEntry(), &perkey_rwlock);
+        for (uint32_t i = 0; i < keycnt; i++)
+        {
+            for (uint32_t j = 0; j < dirinfocnt; j++)
+            {
+                const covered::DirectoryInfo tmp_directory_info((i + j) % 256);
+                LegacyDirectoryEntry tmp_directory_entry;
+                tmp_directory_entry.addDirinfo(tmp_directory_info, tmp_directory_metadata);
+                bool is_exist = false;
+                perkey_rwlock.acquire_lock(keys[i], "key_microbenchmark::populate");
+                legacy_hashtable.insertOrCall(keys[i], tmp_directory_entry, is_exist, [&](LegacyDirectoryEntry& existing_directory_entry) {
+                    existing_directory_entry.addDirinfo(tmp_directory_info, tmp_directory_metadata);
+                    return false; // NOT erase
+                });
+                perkey_rwlock.unlock(keys[i], "key_microbenchmark::populate");
+            }
+        }
+        const int64_t legacy_heap_bytes = getLiveHeapBytes() - legacy_start_heap_bytes;
+
+        // Populate keys of the current layout (untimed) and measure its live heap bytes
+        const int64_t current_start_heap_bytes = getLiveHeapBytes();
+        covered::DirectoryTable directory_table(0, 0, &perkey_rwlock);
+        for (uint32_t i = 0; i < keycnt; i++)
+        {
+            for (uint32_t j = 0; j < dirinfocnt; j++)
+            {
+                const covered::DirectoryInfo tmp_directory_info((i + j) % 256);
+                covered::MetadataUpdateRequirement tmp_metadata_update_requirement;
+                perkey_rwlock.acquire_lock(keys[i], "key_microbenchmark::populate");
+                directory_table.update(keys[i], true, tmp_directory_info, tmp_directory_metadata, tmp_metadata_update_requirement);
+                perkey_rwlock.unlock(keys[i], "key_microbenchmark::populate");
+            }
+        }
+        const int64_t current_heap_bytes = getLiveHeapBytes() - current_start_heap_bytes;
+
+        // Lookup latency: get all valid dirinfos of existing keys
+        uint64_t checksum = 0;
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < opcnt; i++)
+        {
+            covered::DirinfoSet tmp_dirinfo_set;
+            const covered::Key& tmp_key = keys[access_sequence[i]];
+            bool is_exist = false;
+            perkey_rwlock.acquire_lock_shared(tmp_key, "key_microbenchmark::lookup");
+            legacy_hashtable.constCallIfExist(tmp_key, is_exist, [&tmp_dirinfo_set](const LegacyDirectoryEntry& directory_entry) {
+                directory_entry.getAllValidDirinfo(tmp_dirinfo_set);
+            });
+            perkey_rwlock.unlock_shared(tmp_key, "key_microbenchmark::lookup");
+            uint32_t tmp_dirinfo_set_size = 0;
+            tmp_dirinfo_set.getDirinfoSetSizeIfComplete(tmp_dirinfo_set_size);
+            checksum += tmp_dirinfo_set_size;
+        }
+        dumpResult("Directory layout (lookup)", "legacy", getElapsedNsPerOp(start_time, opcnt), checksum);
+
+        checksum = 0;
+        start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < opcnt; i++)
+        {
+            const covered::Key& tmp_key = keys[access_sequence[i]];
+            perkey_rwlock.acquire_lock_shared(tmp_key, "key_microbenchmark::lookup");
+            covered::DirinfoSet tmp_dirinfo_set = directory_table.getAll(tmp_key);
+            perkey_rwlock.unlock_shared(tmp_key, "key_microbenchmark::lookup");
+            uint32_t tmp_dirinfo_set_size = 0;
+            tmp_dirinfo_set.getDirinfoSetSizeIfComplete(tmp_dirinfo_set_size);
+            checksum += tmp_dirinfo_set_size;
+        }
+        dumpResult("Directory layout (lookup)", "current", getElapsedNsPerOp(start_time, opcnt), checksum);
+
+        // Capacity accounting of directory table (i.e., DirectoryTable::getSizeForCapacity()) and real memory (i.e., live heap bytes)
+        // NOTE: capacity accounting does NOT count per-key hash nodes and buckets, which dominate real memory of the legacy layout
+        const uint64_t legacy_size = legacy_hashtable.getTotalKeySizeForCapcity() + legacy_hashtable.getTotalValueSizeForCapcity();
+        const uint64_t current_size = directory_table.getSizeForCapacity();
+        std::cout << "Directory layout (size): dirinfocnt per key: " << dirinfocnt << "; sizeof(DirectoryEntry): " << sizeof(covered::DirectoryEntry) << std::endl;
+        std::cout << "Directory layout (size): legacy: " << legacy_size << " bytes for capacity (" << std::fixed << std::setprecision(2) << static_cast<double>(legacy_size) / keycnt << " bytes/key); " << legacy_heap_bytes << " heap bytes (" << static_cast<double>(legacy_heap_bytes) / keycnt << " bytes/key)" << std::endl;
+        std::cout << "Directory layout (size): current: " << current_size << " bytes for capacity (" << std::fixed << std::setprecision(2) << static_cast<double>(current_size) / keycnt << " bytes/key); " << current_heap_bytes << " heap bytes (" << static_cast<double>(current_heap_bytes) / keycnt << " bytes/key)" << std::endl;
+    }
+
+    // (7) Key copies (e.g., messages, victim lists, and workload items)
+
+    {
+        uint64_t checksum = 0;
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < opcnt; i++)
+        {
+            std::string tmp_keystr = keys[access_sequence[i]].getKeystr(); // Previous Key copy (deep copy of std::string)
+            checksum += tmp_keystr.length();
+        }
+        dumpResult("Key copy", "legacy", getElapsedNsPerOp(start_time, opcnt), checksum);
+
+        checksum = 0;
+        start_time = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < opcnt; i++)
+        {
+            covered::Key tmp_key = keys[access_sequence[i]]; // Inline bytes and precomputed hash
+            checksum += tmp_key.getKeyLength();
+        }
+        dumpResult("Key copy", "current", getElapsedNsPerOp(start_time, opcnt), checksum);
+    }
+
+    return 0;
+}
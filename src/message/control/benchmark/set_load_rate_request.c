@@ -0,0 +1,22 @@
+#include "message/control/benchmark/set_load_rate_request.h"
+
+namespace covered
+{
+    const std::string SetLoadRateRequest::kClassName("SetLoadRateRequest");
+
+    SetLoadRateRequest::SetLoadRateRequest(const uint32_t& perclient_target_rate, const uint32_t& source_index, const NetworkAddr& source_addr, const uint64_t& msg_seqnum) : UintMessage(perclient_target_rate, MessageType::kSetLoadRateRequest, source_index, source_addr, BandwidthUsage(), EventList(), ExtraCommonMsghdr(true, false, msg_seqnum)) // NOTE: ONLY msg seqnum in extra common msghdr will be used
+    {
+    }
+
+    SetLoadRateRequest::SetLoadRateRequest(const DynamicArray& msg_payload) : UintMessage(msg_payload)
+    {
+    }
+
+    SetLoadRateRequest::~SetLoadRateRequest() {}
+
+    uint32_t SetLoadRateRequest::getPerclientTargetRate() const
+    {
+        checkIsValid_();
+        return getUnsignedInteger_();
+    }
+}
\ No newline at end of file
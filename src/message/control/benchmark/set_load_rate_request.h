@@ -0,0 +1,28 @@
+/*
+ * SetLoadRateRequest: a request issued by evaluator to notify the client to update the per-client target rate of open-loop client load modes (e.g., for throughput-latency sweep).
+ */
+
+#ifndef SET_LOAD_RATE_REQUEST_H
+#define SET_LOAD_RATE_REQUEST_H
+
+#include <string>
+
+#include "common/dynamic_array.h"
+#include "message/uint_message.h"
+
+namespace covered
+{
+    class SetLoadRateRequest : public UintMessage
+    {
+    public:
+        SetLoadRateRequest(const uint32_t& perclient_target_rate, const uint32_t& source_index, const NetworkAddr& source_addr, const uint64_t& msg_seqnum);
+        SetLoadRateRequest(const DynamicArray& msg_payload);
+        virtual ~SetLoadRateRequest();
+
+        uint32_t getPerclientTargetRate() const;
+    private:
+        static const std::string kClassName;
+    };
+}
+
+#endif
\ No newline at end of file
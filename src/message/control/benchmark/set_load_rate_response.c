@@ -0,0 +1,17 @@
+#include "message/control/benchmark/set_load_rate_response.h"
+
+namespace covered
+{
+    const std::string SetLoadRateResponse::kClassName("SetLoadRateResponse");
+
+    // NOTE: use BandwidthUsage() as we do NOT need to count benchmark control messages for data plane bandwidth usage
+    SetLoadRateResponse::SetLoadRateResponse(const uint32_t& source_index, const NetworkAddr& source_addr, const EventList& event_list, const uint64_t& msg_seqnum) : SimpleMessage(MessageType::kSetLoadRateResponse, source_index, source_addr, BandwidthUsage(), event_list, ExtraCommonMsghdr(true, false, msg_seqnum)) // NOTE: ONLY msg seqnum in extra common msghdr will be used
+    {
+    }
+
+    SetLoadRateResponse::SetLoadRateResponse(const DynamicArray& msg_payload) : SimpleMessage(msg_payload)
+    {
+    }
+
+    SetLoadRateResponse::~SetLoadRateResponse() {}
+}
\ No newline at end of file
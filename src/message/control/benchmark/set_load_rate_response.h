@@ -0,0 +1,26 @@
+/*
+ * SetLoadRateResponse: a response issued by client to acknowledge SetLoadRateRequest from evaluator.
+ */
+
+#ifndef SET_LOAD_RATE_RESPONSE_H
+#define SET_LOAD_RATE_RESPONSE_H
+
+#include <string>
+
+#include "common/dynamic_array.h"
+#include "message/simple_message.h"
+
+namespace covered
+{
+    class SetLoadRateResponse : public SimpleMessage
+    {
+    public:
+        SetLoadRateResponse(const uint32_t& source_index, const NetworkAddr& source_addr, const EventList& event_list, const uint64_t& msg_seqnum);
+        SetLoadRateResponse(const DynamicArray& msg_payload);
+        virtual ~SetLoadRateResponse();
+    private:
+        static const std::string kClassName;
+    };
+}
+
+#endif
\ No newline at end of file
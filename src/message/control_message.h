@@ -22,6 +22,8 @@
 #include "message/control/benchmark/simple_finishrun_response.h"
 #include "message/control/benchmark/update_rules_request.h"
 #include "message/control/benchmark/update_rules_response.h"
+#include "message/control/benchmark/set_load_rate_request.h"
+#include "message/control/benchmark/set_load_rate_response.h"
 
 #include "message/control/cooperation/acquire_writelock_request.h"
 #include "message/control/cooperation/acquire_writelock_response.h"
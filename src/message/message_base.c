@@ -133,6 +133,16 @@ namespace covered
                 message_type_str = "kUpdateRulesResponse";
                 break;
             }
+            case MessageType::kSetLoadRateRequest:
+            {
+                message_type_str = "kSetLoadRateRequest";
+                break;
+            }
+            case MessageType::kSetLoadRateResponse:
+            {
+                message_type_str = "kSetLoadRateResponse";
+                break;
+            }
             case MessageType::kAcquireWritelockRequest:
             {
                 message_type_str = "kAcquireWritelockRequest";
@@ -664,6 +674,11 @@ namespace covered
                 message_ptr = new UpdateRulesRequest(msg_payload);
                 break;
             }
+            case MessageType::kSetLoadRateRequest:
+            {
+                message_ptr = new SetLoadRateRequest(msg_payload);
+                break;
+            }
             case MessageType::kAcquireWritelockRequest:
             {
                 message_ptr = new AcquireWritelockRequest(msg_payload);
@@ -939,6 +954,11 @@ namespace covered
                 message_ptr = new UpdateRulesResponse(msg_payload);
                 break;
             }
+            case MessageType::kSetLoadRateResponse:
+            {
+                message_ptr = new SetLoadRateResponse(msg_payload);
+                break;
+            }
             case MessageType::kAcquireWritelockResponse:
             {
                 message_ptr = new AcquireWritelockResponse(msg_payload);
@@ -1620,7 +1640,7 @@ namespace covered
     {
         checkIsValid_();
 
-        uint32_t msg_bandwidth_size = getCommonMsghdrSize_() + getMsgBandwidthSizeInternal_();
+        uint32_t msg_bandwidth_size = getCommonMsghdrBandwidthSize_() + getMsgBandwidthSizeInternal_();
         
         return msg_bandwidth_size;
     }
@@ -1642,6 +1662,19 @@ namespace covered
         return common_msghdr_size;
     }
 
+    uint32_t MessageBase::getCommonMsghdrBandwidthSize_() const
+    {
+        uint32_t common_msghdr_bandwidth_size = getCommonMsghdrSize_();
+        if (is_response_)
+        {
+            // NOTE: exclude coalesced counters piggybacked in bandwidth usage, which are NOT real protocol overhead
+            assert(common_msghdr_bandwidth_size >= BandwidthUsage::getBandwidthUsagePayloadSize());
+            common_msghdr_bandwidth_size = common_msghdr_bandwidth_size - BandwidthUsage::getBandwidthUsagePayloadSize() + BandwidthUsage::getBandwidthUsageBandwidthSize();
+        }
+
+        return common_msghdr_bandwidth_size;
+    }
+
     uint32_t MessageBase::getMsgBandwidthSizeInternal_() const
     {
         // NOTE: the same as getMsgPayloadSizeInternal_() by default as NO value content in most messages -> for the messages with value content (restricted by Value::MAX_VALUE_CONTENT_SIZE), the corresponding classes will override this function to calculate msg bandwidth size based on ideal value content size
@@ -1857,7 +1890,7 @@ namespace covered
     bool MessageBase::isBenchmarkControlRequest() const
     {
         checkIsValid_();
-        if (message_type_ == MessageType::kInitializationRequest || message_type_ == MessageType::kStartrunRequest || message_type_ == MessageType::kSwitchSlotRequest || message_type_ == MessageType::kFinishWarmupRequest || message_type_ == MessageType::kFinishrunRequest || message_type_ == MessageType::kDumpSnapshotRequest || message_type_ == MessageType::kUpdateRulesRequest)
+        if (message_type_ == MessageType::kInitializationRequest || message_type_ == MessageType::kStartrunRequest || message_type_ == MessageType::kSwitchSlotRequest || message_type_ == MessageType::kFinishWarmupRequest || message_type_ == MessageType::kFinishrunRequest || message_type_ == MessageType::kDumpSnapshotRequest || message_type_ == MessageType::kUpdateRulesRequest || message_type_ == MessageType::kSetLoadRateRequest)
         {
             return true;
         }
@@ -1921,7 +1954,7 @@ namespace covered
     bool MessageBase::isBenchmarkControlResponse() const
     {
         checkIsValid_();
-        if (message_type_ == MessageType::kInitializationResponse || message_type_ == MessageType::kStartrunResponse || message_type_ == MessageType::kSwitchSlotResponse || message_type_ == MessageType::kFinishWarmupResponse || message_type_ == MessageType::kFinishrunResponse || message_type_ == MessageType::kDumpSnapshotResponse || message_type_ == MessageType::kSimpleFinishrunResponse || message_type_ == MessageType::kUpdateRulesResponse)
+        if (message_type_ == MessageType::kInitializationResponse || message_type_ == MessageType::kStartrunResponse || message_type_ == MessageType::kSwitchSlotResponse || message_type_ == MessageType::kFinishWarmupResponse || message_type_ == MessageType::kFinishrunResponse || message_type_ == MessageType::kDumpSnapshotResponse || message_type_ == MessageType::kSimpleFinishrunResponse || message_type_ == MessageType::kUpdateRulesResponse || message_type_ == MessageType::kSetLoadRateResponse)
         {
             return true;
         }
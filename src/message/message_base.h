@@ -103,6 +103,7 @@ namespace covered
         static uint32_t deserializeMessageTypeFromMsgPayload(const DynamicArray& msg_payload, MessageType& message_type);
 
         uint32_t getCommonMsghdrSize_() const;
+        uint32_t getCommonMsghdrBandwidthSize_() const;
         virtual uint32_t getMsgPayloadSizeInternal_() const = 0;
         virtual uint32_t getMsgBandwidthSizeInternal_() const;
 
@@ -44,6 +44,8 @@ namespace covered
         kSimpleFinishrunResponse,
         kUpdateRulesRequest,
         kUpdateRulesResponse,
+        kSetLoadRateRequest,
+        kSetLoadRateResponse,
         // Cooperation control messages
         kAcquireWritelockRequest,
         kAcquireWritelockResponse,
@@ -10,22 +10,24 @@ namespace covered
 
     const std::string MsgFragStatsEntry::kClassName("MsgFragStatsEntry");
 
-    MsgFragStatsEntry::MsgFragStatsEntry()
+    MsgFragStatsEntry::MsgFragStatsEntry() : msg_payload_()
     {
-        fragidx_fragpayload_map_.clear();
+        is_frag_received_.clear();
+        recvfragcnt_ = 0;
         fragcnt_ = 0;
+        msg_payload_size_ = 0;
         msg_seqnum_ = 0;
     }
 
     MsgFragStatsEntry::~MsgFragStatsEntry() {}
 
-    bool MsgFragStatsEntry::isLastFrag(const UdpFragHdr& fraghdr)
+    bool MsgFragStatsEntry::isLastFrag(const UdpFragHdr& fraghdr) const
     {
         uint32_t fragidx = fraghdr.getFragmentIdx();
         uint32_t seqnum = fraghdr.getMsgSeqnum();
-        if (fragidx_fragpayload_map_.size() == fragcnt_ - 1 \
-            && fragidx_fragpayload_map_.find(fragidx) == fragidx_fragpayload_map_.end() \
-            && msg_seqnum_ == seqnum) // fragidx is the last untracked fragment with matched seqnum
+        if (recvfragcnt_ == fragcnt_ - 1 \
+            && fragidx < fragcnt_ && !is_frag_received_[fragidx] \
+            && msg_seqnum_ == seqnum && isMatchedFrag(fraghdr)) // fragidx is the last untracked fragment with matched seqnum
         {
             return true;
         }
@@ -38,14 +40,12 @@ namespace covered
     void MsgFragStatsEntry::insertFrag(const UdpFragHdr& fraghdr, const DynamicArray& pkt_payload)
     {
         uint32_t fragidx = fraghdr.getFragmentIdx();
-        uint32_t fragcnt = fraghdr.getFragmentCnt();
         uint32_t seqnum = fraghdr.getMsgSeqnum();
 
         bool need_insert = false;
-        if (fragidx_fragpayload_map_.size() == 0) // First fragment
+        if (recvfragcnt_ == 0) // First fragment
         {
-            fragcnt_ = fragcnt;
-            msg_seqnum_ = seqnum;
+            resetMsg_(fraghdr);
 
             need_insert = true;
         }
@@ -57,36 +57,61 @@ namespace covered
             }
             else if (seqnum > msg_seqnum_) // Clear outdated fragments if the current fragment belongs to a retried message
             {
-                fragidx_fragpayload_map_.clear();
-                fragcnt_ = fragcnt;
-                msg_seqnum_ = seqnum;
+                resetMsg_(fraghdr);
 
                 need_insert = true;
             }
             else // Fragments of the same message
             {
-                assert(fragcnt == fragcnt_);
+                // NOTE: MsgFragStats::insertEntry() has dropped mismatched fragments, so fragidx MUST be within the preallocated message buffer
+                assert(isMatchedFrag(fraghdr));
+                assert(fragidx < fragcnt_);
 
                 // Not tracked before
-                need_insert = fragidx_fragpayload_map_.find(fragidx) == fragidx_fragpayload_map_.end();  
+                need_insert = !is_frag_received_[fragidx];
             }
         }
 
-        assert(fragidx_fragpayload_map_.find(fragidx) == fragidx_fragpayload_map_.end());
         if (need_insert)
         {
-            fragidx_fragpayload_map_.insert(std::pair<uint32_t, DynamicArray>(fragidx, DynamicArray()));
-            DynamicArray& frag_payload = fragidx_fragpayload_map_[fragidx];
-            frag_payload.clear(Util::UDP_MAX_FRAG_PAYLOAD);
-            pkt_payload.arraycpy(Util::UDP_FRAGHDR_SIZE, frag_payload, 0, pkt_payload.getSize() - Util::UDP_FRAGHDR_SIZE);
+            // Copy fragment payload into the preallocated message buffer directly
+            assert(fragidx < fragcnt_);
+            uint32_t fragment_offset = Util::getFragmentOffset(fragidx);
+            uint32_t fragment_payload_size = pkt_payload.getSize() - Util::UDP_FRAGHDR_SIZE;
+            assert(fragment_offset + fragment_payload_size <= msg_payload_size_);
+            pkt_payload.arraycpy(Util::UDP_FRAGHDR_SIZE, msg_payload_, fragment_offset, fragment_payload_size);
+
+            is_frag_received_[fragidx] = true;
+            recvfragcnt_ += 1;
         }
 
         return;
     }
 
-    std::map<uint32_t, DynamicArray>& MsgFragStatsEntry::getFragidxFragpayloadMapRef()
+    bool MsgFragStatsEntry::isMatchedFrag(const UdpFragHdr& fraghdr) const
     {
-        return fragidx_fragpayload_map_;
+        if (recvfragcnt_ > 0 && fraghdr.getMsgSeqnum() == msg_seqnum_)
+        {
+            return fraghdr.getFragmentCnt() == fragcnt_ && fraghdr.getMsgPayloadSize() == msg_payload_size_;
+        }
+        return true; // A new message will reset the entry
+    }
+
+    DynamicArray& MsgFragStatsEntry::getMsgPayloadRef()
+    {
+        return msg_payload_;
+    }
+
+    void MsgFragStatsEntry::resetMsg_(const UdpFragHdr& fraghdr)
+    {
+        fragcnt_ = fraghdr.getFragmentCnt();
+        msg_payload_size_ = fraghdr.getMsgPayloadSize();
+        msg_seqnum_ = fraghdr.getMsgSeqnum();
+
+        msg_payload_.clear(msg_payload_size_);
+        is_frag_received_.assign(fragcnt_, false);
+        recvfragcnt_ = 0;
+        return;
     }
 
     // MsgFragStats
@@ -108,6 +133,14 @@ namespace covered
         bool is_last_frag = false;
 
         UdpFragHdr fraghdr(pkt_payload);
+        if (!isValidFrag_(fraghdr, pkt_payload)) // Drop malformed fragment, which would otherwise be written out of the message buffer
+        {
+            std::ostringstream oss;
+            oss << "drop a malformed fragment (fragidx " << fraghdr.getFragmentIdx() << ", fragcnt " << fraghdr.getFragmentCnt() << ", msg payload size " << fraghdr.getMsgPayloadSize() << ", pkt payload size " << pkt_payload.getSize() << ") from " << source_addr.toString();
+            Util::dumpWarnMsg(kClassName, oss.str());
+            return false;
+        }
+
         if (fraghdr.getFragmentCnt() == 1) // Must be the last fragment for fragcnt of 1
         {
             is_last_frag = true;
@@ -122,7 +155,13 @@ namespace covered
             else // Receive some fragments of the message before
             {
                 MsgFragStatsEntry& entry = srcaddr_entry_map_[source_addr];
-                if (entry.isLastFrag(fraghdr)) // The last fragment of the message
+                if (!entry.isMatchedFrag(fraghdr)) // Drop mismatched fragment of the tracked message
+                {
+                    std::ostringstream oss;
+                    oss << "drop a fragment with seqnum " << fraghdr.getMsgSeqnum() << " mismatched with the tracked message (fragcnt " << fraghdr.getFragmentCnt() << ", msg payload size " << fraghdr.getMsgPayloadSize() << ") from " << source_addr.toString();
+                    Util::dumpWarnMsg(kClassName, oss.str());
+                }
+                else if (entry.isLastFrag(fraghdr)) // The last fragment of the message
                 {
                     is_last_frag = true;
                 }
@@ -135,6 +174,22 @@ namespace covered
         return is_last_frag;
     }
 
+    bool MsgFragStats::isValidFrag_(const UdpFragHdr& fraghdr, const DynamicArray& pkt_payload)
+    {
+        const uint32_t fragidx = fraghdr.getFragmentIdx();
+        const uint32_t fragcnt = fraghdr.getFragmentCnt();
+        const uint32_t msg_payload_size = fraghdr.getMsgPayloadSize();
+        if (fragcnt == 0 || fragidx >= fragcnt || fragcnt != Util::getFragmentCnt(msg_payload_size))
+        {
+            return false;
+        }
+        if (pkt_payload.getSize() < Util::UDP_FRAGHDR_SIZE || pkt_payload.getSize() - Util::UDP_FRAGHDR_SIZE != Util::getFragmentPayloadSize(fragidx, msg_payload_size))
+        {
+            return false;
+        }
+        return true;
+    }
+
     MsgFragStatsEntry* MsgFragStats::getEntry(const NetworkAddr& source_addr)
     {
         assert(source_addr.isValidAddr() == true);
@@ -1,5 +1,7 @@
 /*
  * MsgFragStats: track fragment statistics of each message to cope with packet reordering especially for large messages.
+ *
+ * NOTE: fragment payloads are copied into a message buffer preallocated by the first received fragment at their message offsets, so the complete message is handed over w/o re-assembling per-fragment buffers.
  * 
  * By Siyuan Sheng (2023.04.25).
  */
@@ -9,6 +11,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include "common/dynamic_array.h"
 #include "network/network_addr.h"
@@ -22,14 +25,20 @@ namespace covered
         MsgFragStatsEntry();
         ~MsgFragStatsEntry();
 
-        bool isLastFrag(const UdpFragHdr& fraghdr);
+        bool isLastFrag(const UdpFragHdr& fraghdr) const;
         void insertFrag(const UdpFragHdr& fraghdr, const DynamicArray& pkt_payload);
-        std::map<uint32_t, DynamicArray>& getFragidxFragpayloadMapRef();
+        bool isMatchedFrag(const UdpFragHdr& fraghdr) const; // Return false if the fragment has the tracked seqnum yet mismatched fragcnt or message payload size
+        DynamicArray& getMsgPayloadRef(); // NOTE: including all tracked fragment payloads at their message offsets
     private:
         static const std::string kClassName;
 
-        std::map<uint32_t, DynamicArray> fragidx_fragpayload_map_;
+        void resetMsg_(const UdpFragHdr& fraghdr);
+
+        DynamicArray msg_payload_; // Preallocated w/ message payload size
+        std::vector<bool> is_frag_received_;
+        uint32_t recvfragcnt_;
         uint32_t fragcnt_;
+        uint32_t msg_payload_size_;
         uint32_t msg_seqnum_;
     };
 
@@ -39,12 +48,14 @@ namespace covered
         MsgFragStats();
         ~MsgFragStats();
 
-        bool insertEntry(const NetworkAddr& source_addr, const DynamicArray& pkt_payload); // Return if the current fragment is the last one (must be true for fragcnt of 1)
+        bool insertEntry(const NetworkAddr& source_addr, const DynamicArray& pkt_payload); // Return if the current fragment is the last one (must be true for fragcnt of 1); malformed or mismatched fragments are dropped with a warning
         MsgFragStatsEntry* getEntry(const NetworkAddr& source_addr);
         void removeEntry(const NetworkAddr& source_addr);
     private:
         static const std::string kClassName;
 
+        static bool isValidFrag_(const UdpFragHdr& fraghdr, const DynamicArray& pkt_payload); // Check fragidx, fragcnt, and fragment payload size against message payload size in fragment header
+
         // NOTE: we should use source address in UDP payload instead of propagation simulator's address in UDP header (e.g., different client workers or cache server workers will share the same propagation simulator's address)
         std::map<NetworkAddr, MsgFragStatsEntry> srcaddr_entry_map_;
     };
@@ -9,17 +9,17 @@ namespace covered
     PropagationItem::PropagationItem() : network_addr_()
     {
         message_ptr_ = NULL;
-        sleep_us_ = 0;
+        due_time_us_ = 0;
     }
 
-    PropagationItem::PropagationItem(MessageBase* message_ptr, const NetworkAddr& network_addr, const uint32_t& sleep_us)
+    PropagationItem::PropagationItem(MessageBase* message_ptr, const NetworkAddr& network_addr, const uint64_t& due_time_us)
     {
         assert(message_ptr != NULL);
         assert(network_addr.isValidAddr());
 
         message_ptr_ = message_ptr;
         network_addr_ = network_addr;
-        sleep_us_ = sleep_us;
+        due_time_us_ = due_time_us;
     }
 
     PropagationItem::~PropagationItem()
@@ -38,16 +38,16 @@ namespace covered
         return network_addr_;
     }
 
-    uint32_t PropagationItem::getSleepUs() const
+    uint64_t PropagationItem::getDueTimeUs() const
     {
-        return sleep_us_;
+        return due_time_us_;
     }
 
     const PropagationItem& PropagationItem::operator=(const PropagationItem& other)
     {
         message_ptr_ = other.message_ptr_; // shallow copy
         network_addr_ = other.network_addr_;
-        sleep_us_ = other.sleep_us_;
+        due_time_us_ = other.due_time_us_;
         return *this;
     }
 }
\ No newline at end of file
@@ -1,5 +1,7 @@
 /*
  * PropagationItem: a message to be issued by PropagationSimulator towards a network address after a propagation latency.
+ *
+ * NOTE: each item carries its own absolute due time (CLOCK_MONOTONIC), so PropagationSimulator can release items independently instead of sleeping serially for each item.
  * 
  * By Siyuan Sheng (2023.07.03).
  */
@@ -18,12 +20,12 @@ namespace covered
     {
     public:
         PropagationItem();
-        PropagationItem(MessageBase* message_ptr, const NetworkAddr& network_addr, const uint32_t& sleep_us);
+        PropagationItem(MessageBase* message_ptr, const NetworkAddr& network_addr, const uint64_t& due_time_us);
         ~PropagationItem();
 
         MessageBase* getMessagePtr() const;
         NetworkAddr getNetworkAddr() const;
-        uint32_t getSleepUs() const;
+        uint64_t getDueTimeUs() const;
 
         const PropagationItem& operator=(const PropagationItem& other);
     private:
@@ -31,7 +33,7 @@ namespace covered
 
         MessageBase* message_ptr_;
         NetworkAddr network_addr_;
-        uint32_t sleep_us_;
+        uint64_t due_time_us_; // Absolute time (from Util::getCurrentMonotonicTimeUs()) to issue the message
     };
 }
 
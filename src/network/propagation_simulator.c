@@ -1,7 +1,6 @@
 #include "network/propagation_simulator.h"
 
 #include <sstream>
-#include <unistd.h> // usleep
 
 #include "common/util.h"
 
@@ -9,6 +8,20 @@ namespace covered
 {
     std::string PropagationSimulator::kClassName("PropagationSimulator");
 
+    const uint32_t PropagationSimulator::kMaxWaitUs = 1000; // 1 ms
+    const uint32_t PropagationSimulator::kPopBatchSize = 64;
+
+    bool PropagationSimulator::PendingItemLater::operator()(const PendingItem& lhs, const PendingItem& rhs) const
+    {
+        const uint64_t lhs_due_time_us = lhs.second.getDueTimeUs();
+        const uint64_t rhs_due_time_us = rhs.second.getDueTimeUs();
+        if (lhs_due_time_us != rhs_due_time_us)
+        {
+            return lhs_due_time_us > rhs_due_time_us;
+        }
+        return lhs.first > rhs.first;
+    }
+
     void* PropagationSimulator::launchPropagationSimulator(void* propagation_simulator_param_ptr)
     {
         assert(propagation_simulator_param_ptr != NULL);
@@ -20,7 +33,7 @@ namespace covered
         return NULL;
     }
 
-    PropagationSimulator::PropagationSimulator(PropagationSimulatorParam* propagation_simulator_param_ptr) : propagation_simulator_param_ptr_(propagation_simulator_param_ptr)
+    PropagationSimulator::PropagationSimulator(PropagationSimulatorParam* propagation_simulator_param_ptr) : pending_items_(), pending_item_seqnum_(0), dst_last_due_time_map_(), popped_items_(), due_message_ptrs_(), due_dst_addrs_(), propagation_simulator_param_ptr_(propagation_simulator_param_ptr)
     {
         assert(propagation_simulator_param_ptr != NULL);
 
@@ -38,6 +51,9 @@ namespace covered
     {
         // NOTE: no need to release propagation_simulator_param_ptr_, which will be released outside PropagationSimulator (e.g., in Client/Edge/CloudWrapper)
 
+        // Release not-issued messages in pending items
+        releasePendingItems_();
+
         // Release socket client
         assert(propagation_simulator_socket_client_ptr_ != NULL);
         delete propagation_simulator_socket_client_ptr_;
@@ -57,44 +73,44 @@ namespace covered
         // Loop until node finishes
         while (propagation_simulator_param_ptr_->getNodeWrapperPtr()->isNodeRunning())
         {
-            PropagationItem tmp_propagation_item;
-            bool is_successful = propagation_simulator_param_ptr_->pop(tmp_propagation_item);
+            // NOTE: get push count before popping, so any item pushed after popping will wake up the following wait
+            const uint32_t prev_pushcnt = propagation_simulator_param_ptr_->getPushCnt();
 
-            if (!is_successful)
-            {        
-                continue; // Continue to check if node is finished
+            // Move all pushed items into the min-heap of pending items in batches
+            while (true)
+            {
+                popped_items_.clear();
+                uint32_t popped_cnt = propagation_simulator_param_ptr_->popBatch(popped_items_, kPopBatchSize);
+                for (uint32_t i = 0; i < popped_cnt; i++)
+                {
+                    // NOTE: NOT overtake previous items to the same destination (ties are issued in arrival order)
+                    uint64_t& tmp_last_due_time_us = dst_last_due_time_map_[popped_items_[i].getNetworkAddr()];
+                    if (popped_items_[i].getDueTimeUs() < tmp_last_due_time_us)
+                    {
+                        popped_items_[i] = PropagationItem(popped_items_[i].getMessagePtr(), popped_items_[i].getNetworkAddr(), tmp_last_due_time_us);
+                    }
+                    tmp_last_due_time_us = popped_items_[i].getDueTimeUs();
+
+                    pending_items_.push(PendingItem(pending_item_seqnum_, popped_items_[i]));
+                    pending_item_seqnum_++;
+                }
+                if (popped_cnt < kPopBatchSize)
+                {
+                    break;
+                }
             }
-            else
+
+            // Issue all due items in one burst
+            const uint64_t cur_time_us = Util::getCurrentMonotonicTimeUs();
+            issueDueItems_(cur_time_us);
+
+            // Wait until the next due time or any new item (bounded to check if node is finished)
+            uint64_t deadline_us = cur_time_us + kMaxWaitUs;
+            if (!pending_items_.empty() && pending_items_.top().second.getDueTimeUs() < deadline_us)
             {
-                // Prepare message payload
-                MessageBase* message_ptr = tmp_propagation_item.getMessagePtr();
-                assert(message_ptr != NULL);
-
-                // Sleep to simulate propagation latency
-                uint32_t sleep_us = tmp_propagation_item.getSleepUs();
-                #ifdef DEBUG_PROPAGATION_SIMULATOR
-                std::ostringstream oss;
-                oss << "before sleep " << sleep_us << " us to simulate a propagation latency of " << propagation_simulator_param_ptr_->getPropagationLatencyUs() << " us; keystr: " << MessageBase::getKeyFromMessage(message_ptr).getKeystr() << "; dstadrr: " << tmp_propagation_item.getNetworkAddr().toString() << "; srcaddr: " << message_ptr->getSourceAddr().toString();
-                Util::dumpDebugMsg(instance_name_, oss.str());
-                #endif
-                propagate_(sleep_us);
-                #ifdef DEBUG_PROPAGATION_SIMULATOR
-                oss.clear();
-                oss.str("");
-                oss << "after sleep " << sleep_us << " us to simulate a propagation latency of " << propagation_simulator_param_ptr_->getPropagationLatencyUs() << " us; keystr: " << MessageBase::getKeyFromMessage(message_ptr).getKeystr() << "; dstadrr: " << tmp_propagation_item.getNetworkAddr().toString() << "; srcaddr: " << message_ptr->getSourceAddr().toString();
-                Util::dumpDebugMsg(instance_name_, oss.str());
-                #endif
-
-                // Issue the message to the given address
-                NetworkAddr dst_addr = tmp_propagation_item.getNetworkAddr();
-                assert(dst_addr.isValidAddr());
-                propagation_simulator_socket_client_ptr_->send(message_ptr, dst_addr);
-
-                // Release the message
-                assert(message_ptr != NULL);
-                delete message_ptr;
-                message_ptr = NULL;
+                deadline_us = pending_items_.top().second.getDueTimeUs();
             }
+            propagation_simulator_param_ptr_->waitForPush(prev_pushcnt, deadline_us); // NOTE: deadline_us MUST be later than cur_time_us after issuing due items
         }
 
         return;
@@ -106,12 +122,60 @@ namespace covered
         return;
     }
         
-    void PropagationSimulator::propagate_(const uint32_t& sleep_us)
+    void PropagationSimulator::issueDueItems_(const uint64_t& cur_time_us)
     {
-        // NOTE: NOT simulator propagation latency for sleep_us of 0 (e.g., skip propagation latency under warmup phase if enable warmup speedup)
-        if (sleep_us > 0)
+        due_message_ptrs_.clear();
+        due_dst_addrs_.clear();
+        while (!pending_items_.empty() && pending_items_.top().second.getDueTimeUs() <= cur_time_us)
         {
-            usleep(sleep_us);
+            const PropagationItem tmp_propagation_item = pending_items_.top().second;
+            pending_items_.pop();
+
+            // Prepare message payload
+            MessageBase* message_ptr = tmp_propagation_item.getMessagePtr();
+            assert(message_ptr != NULL);
+
+            #ifdef DEBUG_PROPAGATION_SIMULATOR
+            std::ostringstream oss;
+            oss << "issue a message " << (cur_time_us - tmp_propagation_item.getDueTimeUs()) << " us after its due time; keystr: " << MessageBase::getKeyFromMessage(message_ptr).getKeystr() << "; dstadrr: " << tmp_propagation_item.getNetworkAddr().toString() << "; srcaddr: " << message_ptr->getSourceAddr().toString();
+            Util::dumpDebugMsg(instance_name_, oss.str());
+            #endif
+
+            // Collect the message to the given address
+            NetworkAddr dst_addr = tmp_propagation_item.getNetworkAddr();
+            assert(dst_addr.isValidAddr());
+            due_message_ptrs_.push_back(message_ptr);
+            due_dst_addrs_.push_back(dst_addr);
+        }
+
+        if (due_message_ptrs_.size() > 0)
+        {
+            // Issue all due messages by batched syscalls
+            propagation_simulator_socket_client_ptr_->sendBatch(due_message_ptrs_, due_dst_addrs_);
+
+            // Release the messages
+            for (uint32_t i = 0; i < due_message_ptrs_.size(); i++)
+            {
+                assert(due_message_ptrs_[i] != NULL);
+                delete due_message_ptrs_[i];
+                due_message_ptrs_[i] = NULL;
+            }
+            due_message_ptrs_.clear();
+        }
+        return;
+    }
+
+    void PropagationSimulator::releasePendingItems_()
+    {
+        // NOTE: node is NOT running now, so pending messages will never be issued
+        while (!pending_items_.empty())
+        {
+            MessageBase* tmp_msgptr = pending_items_.top().second.getMessagePtr();
+            assert(tmp_msgptr != NULL);
+            delete tmp_msgptr;
+            tmp_msgptr = NULL;
+
+            pending_items_.pop();
         }
         return;
     }
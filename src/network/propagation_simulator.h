@@ -2,6 +2,10 @@
  * PropagationSimulator: simulate a given propagation latency before sending each message in client/edge/cloud node.
  *
  * NOTE: if a node has various propagation latencies to different destinations, it has launched multiple propagation simulators each for a specific propagation latency.
+ *
+ * NOTE: pending messages are tracked in a min-heap keyed on absolute due time, so each message is released at its own due time (all due messages are issued in one burst by batched sendmmsg) without head-of-line blocking behind serial sleeps; the simulator parks on a futex (woken up by push or the next due time) when nothing is due instead of spinning.
+ *
+ * NOTE: due time of each message is clamped to be no earlier than that of the previous message to the same destination, so messages to the same destination keep FIFO order (the same as serial sleeps) even if with random propagation latencies.
  * 
  * By Siyuan Sheng (2023.07.04).
  */
@@ -11,7 +15,11 @@
 
 //#define DEBUG_PROPAGATION_SIMULATOR
 
+#include <queue>
 #include <string>
+#include <unordered_map>
+#include <utility> // std::pair
+#include <vector>
 
 #include "network/propagation_simulator_param.h"
 #include "network/udp_msg_socket_client.h"
@@ -29,8 +37,19 @@ namespace covered
         void start();
     private:
         static std::string kClassName;
+        static const uint32_t kMaxWaitUs; // Upper bound of each wait to check if node is finished
+        static const uint32_t kPopBatchSize; // Max # of items popped from ring buffer at a time
+
+        // Pending item with its arrival order (keep FIFO order for items with the same due time)
+        typedef std::pair<uint64_t, PropagationItem> PendingItem;
+        class PendingItemLater
+        {
+        public:
+            bool operator()(const PendingItem& lhs, const PendingItem& rhs) const;
+        };
 
-        void propagate_(const uint32_t& sleep_us);
+        void issueDueItems_(const uint64_t& cur_time_us);
+        void releasePendingItems_();
 
         void checkPointers_() const;
 
@@ -39,6 +58,12 @@ namespace covered
 
         // Non-const individual variable
         UdpMsgSocketClient* propagation_simulator_socket_client_ptr_;
+        std::priority_queue<PendingItem, std::vector<PendingItem>, PendingItemLater> pending_items_; // Min-heap of (arrival order, item) keyed on due time
+        uint64_t pending_item_seqnum_; // Arrival order of the next pending item
+        std::unordered_map<NetworkAddr, uint64_t, NetworkAddrHasher> dst_last_due_time_map_; // Due time of the latest pending item for each destination to keep per-destination FIFO order
+        std::vector<PropagationItem> popped_items_; // Items popped from ring buffer in one batch (reused across batches)
+        std::vector<MessageBase*> due_message_ptrs_; // Due messages issued in one burst by sendmmsg (reused across bursts)
+        std::vector<NetworkAddr> due_dst_addrs_;
 
         // Non-const variable shared by working threads of each node and propagation simulator
         PropagationSimulatorParam* propagation_simulator_param_ptr_; // thread safe
@@ -1,6 +1,9 @@
 #include "network/propagation_simulator_param.h"
 
 #include <assert.h>
+#include <linux/futex.h> // FUTEX_WAIT_BITSET_PRIVATE, FUTEX_WAKE_PRIVATE, FUTEX_BITSET_MATCH_ANY
+#include <sys/syscall.h> // SYS_futex
+#include <unistd.h> // syscall
 
 #include "common/util.h"
 
@@ -81,7 +84,7 @@ namespace covered
 
     }
 
-    PropagationSimulatorParam::PropagationSimulatorParam() : SubthreadParamBase(), node_wrapper_ptr_(NULL), propagation_latency_distname_(""), propagation_latency_lbound_us_(0), propagation_latency_avg_us_(0), propagation_latency_rbound_us_(0), propagation_latency_random_seed_(0), rwlock_for_propagation_item_buffer_("rwlock_for_propagation_item_buffer_"), is_first_item_(true), prev_timespec_(), propagation_latency_randgen_(0)
+    PropagationSimulatorParam::PropagationSimulatorParam() : SubthreadParamBase(), node_wrapper_ptr_(NULL), propagation_latency_distname_(""), propagation_latency_lbound_us_(0), propagation_latency_avg_us_(0), propagation_latency_rbound_us_(0), propagation_latency_random_seed_(0), rwlock_for_propagation_item_buffer_("rwlock_for_propagation_item_buffer_"), pushcnt_(0), is_simulator_waiting_(false), propagation_latency_randgen_(0)
     {
         realnet_option_ = "";
         instance_name_ = "";
@@ -91,7 +94,7 @@ namespace covered
         propagation_latency_dist_ptr_ = NULL;
     }
 
-    PropagationSimulatorParam::PropagationSimulatorParam(NodeWrapperBase* node_wrapper_ptr, const std::string& propagation_latency_distname, const uint32_t& propagation_latency_lbound_us, const uint32_t& propagation_latency_avg_us, const uint32_t& propagation_latency_rbound_us, const uint32_t& propagation_latency_random_seed, const uint32_t& propagation_item_buffer_size, const std::string& realnet_option, const std::vector<uint32_t> _p2p_latency_array) : SubthreadParamBase(), node_wrapper_ptr_(node_wrapper_ptr), propagation_latency_distname_(propagation_latency_distname), propagation_latency_lbound_us_(propagation_latency_lbound_us), propagation_latency_avg_us_(propagation_latency_avg_us), propagation_latency_rbound_us_(propagation_latency_rbound_us), propagation_latency_random_seed_(propagation_latency_random_seed), rwlock_for_propagation_item_buffer_("rwlock_for_propagation_item_buffer_"), is_first_item_(true), prev_timespec_(), propagation_latency_randgen_(propagation_latency_random_seed), p2p_latency_array(_p2p_latency_array)
+    PropagationSimulatorParam::PropagationSimulatorParam(NodeWrapperBase* node_wrapper_ptr, const std::string& propagation_latency_distname, const uint32_t& propagation_latency_lbound_us, const uint32_t& propagation_latency_avg_us, const uint32_t& propagation_latency_rbound_us, const uint32_t& propagation_latency_random_seed, const uint32_t& propagation_item_buffer_size, const std::string& realnet_option, const std::vector<uint32_t> _p2p_latency_array) : SubthreadParamBase(), node_wrapper_ptr_(node_wrapper_ptr), propagation_latency_distname_(propagation_latency_distname), propagation_latency_lbound_us_(propagation_latency_lbound_us), propagation_latency_avg_us_(propagation_latency_avg_us), propagation_latency_rbound_us_(propagation_latency_rbound_us), propagation_latency_random_seed_(propagation_latency_random_seed), rwlock_for_propagation_item_buffer_("rwlock_for_propagation_item_buffer_"), pushcnt_(0), is_simulator_waiting_(false), propagation_latency_randgen_(propagation_latency_random_seed), p2p_latency_array(_p2p_latency_array)
     {
         assert(node_wrapper_ptr != NULL);
 
@@ -113,8 +116,9 @@ namespace covered
         oss << kClassName << " " << node_wrapper_ptr->getNodeRoleIdxStr();
         instance_name_ = oss.str();
 
-        const bool with_multi_providers = false; // Although with multiple providers (all subthreads of a client/edge/cloud node), rwlock_for_propagation_item_buffer_ has already guaranteed the atomicity of propagation_item_buffer_ptr_
-        propagation_item_buffer_ptr_ = new RingBuffer<PropagationItem>(PropagationItem(), propagation_item_buffer_size, with_multi_providers);
+        const bool with_multi_providers = true; // Multiple providers (all subthreads of a client/edge/cloud node) push into the lock-free ring buffer
+        const bool is_block_when_full = true; // NOTE: always apply backpressure instead of dropping, as message senders have transferred the ownership of messages to propagation simulator -> block until the node stops running (i.e., propagation simulator stops popping)
+        propagation_item_buffer_ptr_ = new RingBuffer<PropagationItem>(PropagationItem(), propagation_item_buffer_size, with_multi_providers, is_block_when_full, node_wrapper_ptr);
         assert(propagation_item_buffer_ptr_ != NULL);
 
         propagation_latency_dist_ptr_ = new std::uniform_int_distribution<uint32_t>(propagation_latency_lbound_us, propagation_latency_rbound_us);
@@ -202,6 +206,9 @@ namespace covered
     {
         assert(propagation_item_buffer_ptr_ != NULL);
 
+        // Dump queue-depth statistics
+        Util::dumpInfoMsg(instance_name_, "propagation item ring buffer: " + propagation_item_buffer_ptr_->getStatisticsStr());
+
         // Release not-issued messages in propagation_item_buffer_ptr_ (NOTE: now edge is NOT running and propagation simulator will NOT pop messages from param, so ONLY one consumer and hence NO need to acquire a write lock for edge wrapper to release messages)
         while (true)
         {
@@ -242,67 +249,58 @@ namespace covered
         assert(message_ptr != NULL);
         assert(dst_addr.isValidAddr());
 
-        // Acquire a write lock
-        std::string context_name = "PropagationSimulatorParam::push()";
-        rwlock_for_propagation_item_buffer_.acquire_lock(context_name);
-
         // Calculate emission latency for the current message
         // NOTE: as the incoming and outcoming links use different random seeds to generate WAN delays, using RTT/2 still follows asymmetric network settings and the range is still [left bound, right bound] of the given type of latency
-        const uint32_t propagation_latency = genPropagationLatency_();
+        const uint32_t propagation_latency = genPropagationLatency(); // NOTE: acquire a write lock ONLY for the random generator, while pushing into the lock-free ring buffer does NOT need any lock
         const uint32_t cur_emission_latency_us = propagation_latency / 2;
 
         const bool skip_propagation_latency = message_ptr->getExtraCommonMsghdr().isSkipPropagationLatency();
-        uint32_t sleep_us = 0;
+        uint32_t delay_us = 0;
         if (skip_propagation_latency) // Warmup phase
         {
             // skip_propagation_latency = true means the message is enabled with warmup speedup under warmup phase
-            sleep_us = 0;
+            delay_us = 0;
         }
         else if (realnet_option_ == Util::REALNET_LOAD_OPTION_NAME) // Real-net stresstest phase
         {
-            sleep_us = 0; // NOTE: NO need to sleep manually -> we use the real-cloud transmission latency
+            delay_us = 0; // NOTE: NO need to delay manually -> we use the real-cloud transmission latency
         }
         else // Stresstest phase
         {
-            // Calculate sleep interval
-            struct timespec cur_timespec = Util::getCurrentTimespec();
-            if (is_first_item_)
-            {
-                sleep_us = cur_emission_latency_us;
-
-                prev_timespec_ = cur_timespec;
-                is_first_item_ = false;
-            }
-            else
-            {
-                sleep_us = Util::getDeltaTimeUs(cur_timespec, prev_timespec_);
-                if (sleep_us > cur_emission_latency_us)
-                {
-                    sleep_us = cur_emission_latency_us;
-                }
-
-                prev_timespec_ = cur_timespec;
-            }
+            delay_us = cur_emission_latency_us;
         }
-        assert(sleep_us <= cur_emission_latency_us);
+        const uint64_t due_time_us = Util::getCurrentMonotonicTimeUs() + delay_us; // NOTE: PropagationSimulator issues the message at its own due time, which is ONLY delayed by previous messages to the same destination to keep FIFO order
 
         // Push propagation item into ring buffer
-        PropagationItem propagation_item(message_ptr, dst_addr, sleep_us);
+        PropagationItem propagation_item(message_ptr, dst_addr, due_time_us);
         bool is_successful = propagation_item_buffer_ptr_->push(propagation_item);
+        if (!is_successful)
+        {
+            // NOTE: blocking push fails ONLY if the node is NOT running now, so the message will never be issued (the same as pending messages released by PropagationSimulator at stop) -> release it here as senders have transferred the ownership
+            assert(!node_wrapper_ptr_->isNodeRunning());
+            delete message_ptr;
+            message_ptr = NULL;
+            return true;
+        }
 
         #ifdef DEBUG_PROPAGATION_SIMULATOR_PARAM
         //std::vector<PropagationItem> tmp_propagation_items = propagation_item_buffer_ptr_->getElementsForDebug();
         std::ostringstream oss;
-        oss << "push to sleep " << sleep_us << " us to simulate an emission latency of " << cur_emission_latency_us << " us; keystr: " << MessageBase::getKeyFromMessage(message_ptr).getKeystr() << "; dstadrr: " << dst_addr.toString() << "; srcaddr: " << message_ptr->getSourceAddr().toString() << "; ";
+        oss << "push to delay " << delay_us << " us to simulate an emission latency of " << cur_emission_latency_us << " us; keystr: " << MessageBase::getKeyFromMessage(message_ptr).getKeystr() << "; dstadrr: " << dst_addr.toString() << "; srcaddr: " << message_ptr->getSourceAddr().toString() << "; ";
         //for (uint32_t i = 0; i < tmp_propagation_items.size(); i++)
         //{
-        //    oss << "tmp_propagation_items[" << i << "] sleep_us: " << tmp_propagation_items[i].getSleepUs() << "; ";
+        //    oss << "tmp_propagation_items[" << i << "] due_time_us: " << tmp_propagation_items[i].getDueTimeUs() << "; ";
         //}
         Util::dumpDebugMsg(instance_name_, oss.str());
         #endif
 
-        // Release a write lock
-        rwlock_for_propagation_item_buffer_.unlock(context_name);
+        // Wake up PropagationSimulator if it is waiting for new items
+        // NOTE: use seq_cst for the store-load handshake with waitForPush() (similar as FutexRwlock)
+        pushcnt_.fetch_add(1, std::memory_order_seq_cst);
+        if (is_simulator_waiting_.load(std::memory_order_seq_cst))
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&pushcnt_), FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        }
 
         return is_successful;
     }
@@ -311,22 +309,43 @@ namespace covered
     {
         // NOTE: NO need to acquire a write lock, as there will be ONLY one reader (i.e., the propagation simulator)
 
-        // Acquire a write lock
-        //std::string context_name = "PropagationSimulatorParam::pop()";
-        //rwlock_for_propagation_item_buffer_.acquire_lock(context_name);
-
         bool is_successful = propagation_item_buffer_ptr_->pop(element);
 
-        // Release a write lock
-        //rwlock_for_propagation_item_buffer_.unlock(context_name);
-
         return is_successful;
     }
 
+    uint32_t PropagationSimulatorParam::popBatch(std::vector<PropagationItem>& elements, const uint32_t& max_cnt)
+    {
+        // NOTE: NO need to acquire a write lock, as there will be ONLY one reader (i.e., the propagation simulator)
+
+        return propagation_item_buffer_ptr_->popBatch(elements, max_cnt);
+    }
+
+    uint32_t PropagationSimulatorParam::getPushCnt() const
+    {
+        return pushcnt_.load(std::memory_order_seq_cst);
+    }
+
+    void PropagationSimulatorParam::waitForPush(const uint32_t& prev_pushcnt, const uint64_t& deadline_us)
+    {
+        // NOTE: the pusher updates pushcnt_ before checking is_simulator_waiting_, while we update is_simulator_waiting_ before futex checks pushcnt_ atomically in kernel -> no lost wakeup under seq_cst
+        is_simulator_waiting_.store(true, std::memory_order_seq_cst);
+        if (pushcnt_.load(std::memory_order_seq_cst) == prev_pushcnt)
+        {
+            // NOTE: FUTEX_WAIT_BITSET uses an absolute timeout of CLOCK_MONOTONIC, which avoids drift of relative sleeps
+            struct timespec deadline_timespec;
+            deadline_timespec.tv_sec = static_cast<time_t>(deadline_us / 1000000);
+            deadline_timespec.tv_nsec = static_cast<long>((deadline_us % 1000000) * 1000);
+            syscall(SYS_futex, reinterpret_cast<uint32_t*>(&pushcnt_), FUTEX_WAIT_BITSET_PRIVATE, prev_pushcnt, &deadline_timespec, NULL, FUTEX_BITSET_MATCH_ANY); // Return on wakeup, timeout, EAGAIN (pushcnt_ changed), or EINTR -> caller re-checks anyway
+        }
+        is_simulator_waiting_.store(false, std::memory_order_seq_cst);
+        return;
+    }
+
     uint32_t PropagationSimulatorParam::genPropagationLatency()
     {
         // Acquire a write lock
-        std::string context_name = "PropagationSimulatorParam::genPropagationLatency()";
+        const char* context_name = "PropagationSimulatorParam::genPropagationLatency()";
         rwlock_for_propagation_item_buffer_.acquire_lock(context_name);
 
         uint32_t propagation_latency = genPropagationLatency_();
@@ -362,16 +381,16 @@ namespace covered
         if (other.propagation_item_buffer_ptr_ != NULL)
         {
             const bool with_multi_providers = other.propagation_item_buffer_ptr_->withMultiProviders();
-            assert(!with_multi_providers); // Although with multiple providers (all subthreads of a client/edge/cloud node), rwlock_for_propagation_item_buffer_ has already guaranteed the atomicity of propagation_item_buffer_ptr_
+            assert(with_multi_providers); // Multiple providers (all subthreads of a client/edge/cloud node)
 
-            propagation_item_buffer_ptr_ = new RingBuffer<PropagationItem>(PropagationItem(), other.propagation_item_buffer_ptr_->getBufferSize(), with_multi_providers);
+            propagation_item_buffer_ptr_ = new RingBuffer<PropagationItem>(PropagationItem(), other.propagation_item_buffer_ptr_->getBufferSize(), with_multi_providers, other.propagation_item_buffer_ptr_->isBlockWhenFull(), other.propagation_item_buffer_ptr_->getOwnerNodeWrapperPtr());
             assert(propagation_item_buffer_ptr_ != NULL);
             
             *propagation_item_buffer_ptr_ = *other.propagation_item_buffer_ptr_; // deep copy
         }
 
-        is_first_item_ = other.is_first_item_;
-        prev_timespec_ = other.prev_timespec_;
+        pushcnt_.store(other.pushcnt_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        is_simulator_waiting_.store(false, std::memory_order_relaxed);
 
         propagation_latency_randgen_ = other.propagation_latency_randgen_;
 
@@ -1,7 +1,7 @@
 /*
  * PropagationSimulatorParam: param shared by working threads of each node and the corresponding PropagationSimulator, which tracks messages to be issued after propagation latency (thread safe).
  *
- * NOTE: all PropagationItems in a PropagationSimulatorParam must have the same propagation latency, otherwise PropagationSimulator cannot simulate propagation latency for each item correctly.
+ * NOTE: each PropagationItem is stamped with an absolute due time when pushed, so PropagationItems in a PropagationSimulatorParam can have different propagation latencies (e.g., random distributions) without head-of-line blocking in PropagationSimulator.
  * 
  * By Siyuan Sheng (2023.07.03).
  */
@@ -11,9 +11,11 @@
 
 //#define DEBUG_PROPAGATION_SIMULATOR_PARAM
 
+#include <atomic>
 #include <random> // std::mt19937_64 and std::uniform_int_distribution
 #include <string>
 #include <time.h>
+#include <vector>
 
 #include "concurrency/ring_buffer_impl.h"
 #include "concurrency/rwlock.h"
@@ -57,8 +59,11 @@ namespace covered
 
         const NodeWrapperBase* getNodeWrapperPtr() const;
         
-        bool push(MessageBase* message_ptr, const NetworkAddr& dst_addr);
+        bool push(MessageBase* message_ptr, const NetworkAddr& dst_addr); // NOTE: take over the ownership of message_ptr (released here if the node stops before the message is pushed)
         bool pop(PropagationItem& element); // Only invoked by PropagationSimulator
+        uint32_t popBatch(std::vector<PropagationItem>& elements, const uint32_t& max_cnt); // Only invoked by PropagationSimulator (append at most max_cnt items into elements)
+        uint32_t getPushCnt() const; // Only invoked by PropagationSimulator
+        void waitForPush(const uint32_t& prev_pushcnt, const uint64_t& deadline_us); // Only invoked by PropagationSimulator (return if any item is pushed after getting prev_pushcnt, or until deadline_us from Util::getCurrentMonotonicTimeUs())
 
         // std::vector<std::vector<uint32_t>> propagation_latency_martix_;
 
@@ -84,15 +89,15 @@ namespace covered
         std::string instance_name_;
 
         std::vector<uint32_t> p2p_latency_array;
-        // Ensure the atomicity of all non-const variables due to multiple providers (all subthreads of a client/edge/cloud node)
-        // NOTE: only use write lock of rwlock (similar to a mutex; yet not use mutex so as to utilize the debug info of rwlock), as ring buffer only allows one reader and one writer (both will modify indexes in ring buffer)
+        // Ensure the atomicity of random latency generation due to multiple providers (all subthreads of a client/edge/cloud node)
+        // NOTE: only use write lock of rwlock (similar to a mutex; yet not use mutex so as to utilize the debug info of rwlock); NOT protect propagation_item_buffer_ptr_, which is lock free for multiple providers
         Rwlock rwlock_for_propagation_item_buffer_;
         
         // Non-const variables shared by working threads of each ndoe and propagation simulator
-        // NOTE: there will be multiple writers (processing threads of each componenet) yet a single reader (the corresponding propagation simulator) -> NOT need to acquire lock for pop()
+        // NOTE: there will be multiple writers (processing threads of each componenet) yet a single reader (the corresponding propagation simulator) -> MPSC lock-free ring buffer
         RingBuffer<PropagationItem>* propagation_item_buffer_ptr_;
-        bool is_first_item_;
-        struct timespec prev_timespec_;
+        std::atomic<uint32_t> pushcnt_; // # of pushed items (wrap-around) as the futex word to wake up PropagationSimulator
+        std::atomic<bool> is_simulator_waiting_; // Avoid futex syscall in push() if PropagationSimulator is NOT waiting
         bool is_rnd_link;
         std::vector<uint32_t> link_seeds;
         std::vector<LinkDistParams> link_dist_params_;  // 索引对应链路ID
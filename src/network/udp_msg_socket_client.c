@@ -13,7 +13,7 @@ namespace covered
 
 	const std::string UdpMsgSocketClient::kClassName("UdpMsgSocketClient");
 
-	UdpMsgSocketClient::UdpMsgSocketClient()
+	UdpMsgSocketClient::UdpMsgSocketClient() : message_payload_(), batch_pkt_payloads_(UdpPktSocket::UDP_BATCH_MAX_PKTCNT), batch_remote_addrs_(UdpPktSocket::UDP_BATCH_MAX_PKTCNT), batch_pktcnt_(0)
     {
 		// Create UdpPktSocket for UDP client
 		pkt_socket_ptr_ = new UdpPktSocket(IS_SOCKET_CLIENT_TIMEOUT);
@@ -35,44 +35,81 @@ namespace covered
 
     void UdpMsgSocketClient::send(MessageBase* message_ptr, const NetworkAddr& remote_addr)
 	{
-		assert(message_ptr != NULL);
-
-		// Must with valid remote address
-		assert(remote_addr.isValidAddr());
-		assert(remote_addr.getIpstr() != Util::ANY_IPSTR);
-
-		// Will be used by UdpMsgSocketServer to track message fragments for each source address
-		NetworkAddr source_addr = message_ptr->getSourceAddr();
+		std::vector<MessageBase*> message_ptrs(1, message_ptr);
+		std::vector<NetworkAddr> remote_addrs(1, remote_addr);
+		sendBatch(message_ptrs, remote_addrs);
+		return;
+	}
 
-		// Prepare message payload
-		uint32_t message_payload_size = message_ptr->getMsgPayloadSize();
-		DynamicArray message_payload(message_payload_size);
-		uint32_t serialize_size = message_ptr->serialize(message_payload);
-		assert(serialize_size == message_payload_size);
+	void UdpMsgSocketClient::sendBatch(const std::vector<MessageBase*>& message_ptrs, const std::vector<NetworkAddr>& remote_addrs)
+	{
+		assert(message_ptrs.size() == remote_addrs.size());
+		assert(batch_pktcnt_ == 0);
 
-		// Split message payload into multiple fragment payloads
-		uint32_t fragment_cnt = Util::getFragmentCnt(message_payload_size);
-		for (uint32_t fragment_idx = 0; fragment_idx < fragment_cnt; fragment_idx++)
+		for (uint32_t i = 0; i < message_ptrs.size(); i++)
 		{
-			// Prepare packet payload for current UDP packet
-			DynamicArray tmp_pkt_payload(Util::UDP_MAX_PKT_PAYLOAD);
-
-			// Serialize fragment header into current UDP packet
-			UdpFragHdr fraghdr(fragment_idx, fragment_cnt, message_payload_size, msg_seqnum_, source_addr);
-			uint32_t fraghdr_size = fraghdr.serialize(tmp_pkt_payload);
-
-			// Calculate fragment offset and size in message based on fragment index			
-			uint32_t fragment_offset = Util::getFragmentOffset(fragment_idx);
-			uint32_t fragment_payload_size = Util::getFragmentPayloadSize(fragment_idx, message_payload_size);
+			MessageBase* message_ptr = message_ptrs[i];
+			const NetworkAddr& remote_addr = remote_addrs[i];
+			assert(message_ptr != NULL);
+
+			// Must with valid remote address
+			assert(remote_addr.isValidAddr());
+			assert(remote_addr.getIpstr() != Util::ANY_IPSTR);
+
+			// Will be used by UdpMsgSocketServer to track message fragments for each source address
+			NetworkAddr source_addr = message_ptr->getSourceAddr();
+
+			// Prepare message payload
+			uint32_t message_payload_size = message_ptr->getMsgPayloadSize();
+			message_payload_.clear(message_payload_size);
+			uint32_t serialize_size = message_ptr->serialize(message_payload_);
+			assert(serialize_size == message_payload_size);
+			UNUSED(serialize_size);
+
+			// Split message payload into multiple fragment payloads
+			uint32_t fragment_cnt = Util::getFragmentCnt(message_payload_size);
+			for (uint32_t fragment_idx = 0; fragment_idx < fragment_cnt; fragment_idx++)
+			{
+				// Prepare packet payload for current UDP packet (reuse the capacity of previous batches)
+				DynamicArray& tmp_pkt_payload = batch_pkt_payloads_[batch_pktcnt_];
+				tmp_pkt_payload.clear(Util::UDP_MAX_PKT_PAYLOAD);
+
+				// Serialize fragment header into current UDP packet
+				UdpFragHdr fraghdr(fragment_idx, fragment_cnt, message_payload_size, msg_seqnum_, source_addr);
+				uint32_t fraghdr_size = fraghdr.serialize(tmp_pkt_payload);
+
+				// Calculate fragment offset and size in message based on fragment index
+				uint32_t fragment_offset = Util::getFragmentOffset(fragment_idx);
+				uint32_t fragment_payload_size = Util::getFragmentPayloadSize(fragment_idx, message_payload_size);
+
+				// Copy UDP fragment payload into current UDP packet
+				message_payload_.arraycpy(fragment_offset, tmp_pkt_payload, fraghdr_size, fragment_payload_size);
+
+				batch_remote_addrs_[batch_pktcnt_] = remote_addr;
+				batch_pktcnt_++;
+
+				// Send UDP packets by UdpPktSocket if the batch is full
+				if (batch_pktcnt_ == batch_pkt_payloads_.size())
+				{
+					flushBatch_();
+				}
+			}
+
+			msg_seqnum_ += 1;
+		}
 
-			// Copy UDP fragment payload into current UDP packet
-			message_payload.arraycpy(fragment_offset, tmp_pkt_payload, fraghdr_size, fragment_payload_size);
+		// Send remaining UDP packets
+		flushBatch_();
+		return;
+	}
 
-			// Send current UDP packet by UdpPktSocket
-			pkt_socket_ptr_->udpSendto(tmp_pkt_payload, remote_addr);
+	void UdpMsgSocketClient::flushBatch_()
+	{
+		if (batch_pktcnt_ > 0)
+		{
+			pkt_socket_ptr_->udpSendBatch(batch_pkt_payloads_, batch_remote_addrs_, batch_pktcnt_);
+			batch_pktcnt_ = 0;
 		}
-
-		msg_seqnum_ += 1;
 		return;
 	}
 }
\ No newline at end of file
@@ -4,6 +4,8 @@
  * NOTE: message payload may be splited into multiple UDP fragments (i.e., multiple fragment payloads), where each fragment payload + fragment header form the corresponding UDP packet payload.
  * 
  * NOTE: UdpMsgSocketClient is only used by PropagationSimulator to send messages to a given remote address.
+ *
+ * NOTE: fragments of all messages are serialized into packet buffers reused across calls and issued by batched sendmmsg (see UdpPktSocket::udpSendBatch).
  * 
  * By Siyuan Sheng (2023.07.02).
  */
@@ -12,7 +14,9 @@
 #define UDP_MSG_SOCKET_CLIENT_H
 
 #include <string>
+#include <vector>
 
+#include "common/dynamic_array.h"
 #include "message/message_base.h"
 #include "network/network_addr.h"
 #include "network/udp_pkt_socket.h"
@@ -29,11 +33,20 @@ namespace covered
         ~UdpMsgSocketClient();
 
         void send(MessageBase* message_ptr, const NetworkAddr& remote_addr);
+        void sendBatch(const std::vector<MessageBase*>& message_ptrs, const std::vector<NetworkAddr>& remote_addrs); // Send N messages by batched syscalls
     private:
         static const std::string kClassName;
 
+        void flushBatch_();
+
         UdpPktSocket* pkt_socket_ptr_; // send payload of each single UDP packet
         uint32_t msg_seqnum_;
+
+        // Reused buffers for batched sending
+        DynamicArray message_payload_;
+        std::vector<DynamicArray> batch_pkt_payloads_; // UdpPktSocket::UDP_BATCH_MAX_PKTCNT packet buffers
+        std::vector<NetworkAddr> batch_remote_addrs_;
+        uint32_t batch_pktcnt_;
     };
 }
 
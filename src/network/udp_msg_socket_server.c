@@ -14,7 +14,7 @@ namespace covered
 
 	const std::string UdpMsgSocketServer::kClassName("UdpMsgSocketServer");
 
-    UdpMsgSocketServer::UdpMsgSocketServer(const NetworkAddr& host_addr) : msg_frag_stats_()
+    UdpMsgSocketServer::UdpMsgSocketServer(const NetworkAddr& host_addr) : msg_frag_stats_(), recvbatch_pkt_payloads_(), recvbatch_propagation_simulator_addrs_(), recvbatch_pktcnt_(0), recvbatch_pktidx_(0)
     {
 		assert(host_addr.isValidAddr());
 
@@ -44,93 +44,156 @@ namespace covered
 		pkt_socket_ptr_ = NULL;
 	}
 
-	bool UdpMsgSocketServer::recv(DynamicArray& msg_payload)
+	bool UdpMsgSocketServer::recv(DynamicArray& msg_payload, const bool& is_nonblocking)
 	{
 		bool is_timeout = false;
 
 		while (true) // Until receive a complete message
 		{
-			// Prepare to receive a UDP packet
-			NetworkAddr tmp_propagation_simulator_addr;
-			DynamicArray tmp_pkt_payload(Util::UDP_MAX_PKT_PAYLOAD);
-
-			is_timeout = pkt_socket_ptr_->udpRecvfrom(tmp_pkt_payload, tmp_propagation_simulator_addr);
-			UNUSED(tmp_propagation_simulator_addr);
-			if (is_timeout == true) // timeout (not receive any UDP packet)
+			bool is_crashed = false;
+			bool is_complete = false;
+			if (recvbatch_pktidx_ < recvbatch_pktcnt_) // Process packets left by previous recvBatch() first
 			{
-				break;
+				is_complete = processPkt_(recvbatch_pkt_payloads_[recvbatch_pktidx_], msg_payload, is_crashed);
+				recvbatch_pktidx_++;
+			}
+			else
+			{
+				// Prepare to receive a UDP packet
+				NetworkAddr tmp_propagation_simulator_addr;
+				DynamicArray tmp_pkt_payload(Util::UDP_MAX_PKT_PAYLOAD);
+
+				is_timeout = pkt_socket_ptr_->udpRecvfrom(tmp_pkt_payload, tmp_propagation_simulator_addr, is_nonblocking); // NOTE: fragments received so far are kept in msg_frag_stats_ if no more packet now
+				UNUSED(tmp_propagation_simulator_addr);
+				if (is_timeout == true) // timeout (not receive any UDP packet)
+				{
+					break;
+				}
+
+				is_complete = processPkt_(tmp_pkt_payload, msg_payload, is_crashed);
 			}
-			else if (tmp_pkt_payload.getSize() < UdpFragHdr::staticGetudpFragHdrPayloadSize()) // Crashed UDP packet
+
+			if (is_crashed)
 			{
-				std::ostringstream oss;
-				oss << "receive a crashed UDP packet with only " << tmp_pkt_payload.getSize() << " bytes < UdpFragHdr's payload size " << UdpFragHdr::staticGetudpFragHdrPayloadSize() << " bytes!" << std::endl << boost::stacktrace::stacktrace();
-				Util::dumpWarnMsg(kClassName, oss.str());
 				is_timeout = true;
 				break;
 			}
-			else // not timeout (receive a UDP packet)
+			else if (is_complete)
+			{
+				break; // Break while(true)
+			}
+		} // End of while(true)
+
+		return is_timeout;
+	}
+
+	uint32_t UdpMsgSocketServer::recvBatch(std::vector<DynamicArray>& msg_payloads, const uint32_t& max_msgcnt, const bool& is_nonblocking)
+	{
+		assert(max_msgcnt > 0);
+		if (msg_payloads.size() < max_msgcnt)
+		{
+			msg_payloads.resize(max_msgcnt);
+		}
+
+		uint32_t msgcnt = 0;
+		while (msgcnt < max_msgcnt)
+		{
+			if (recvbatch_pktidx_ >= recvbatch_pktcnt_) // All received packets have been processed
 			{
-				// Deserialize fragment header from currently received packet payload
-				UdpFragHdr fraghdr(tmp_pkt_payload);
-				if (fraghdr.getSourceAddr().getPort() <= Util::UDP_MIN_PORT)
+				// NOTE: block (until timeout) ONLY if no message is received yet; otherwise, return received messages ASAP
+				const bool tmp_is_nonblocking = is_nonblocking || msgcnt > 0;
+				recvbatch_pktcnt_ = pkt_socket_ptr_->udpRecvBatch(recvbatch_pkt_payloads_, recvbatch_propagation_simulator_addrs_, tmp_is_nonblocking); // NOTE: fragments received so far are kept in msg_frag_stats_ if no more packet now
+				recvbatch_pktidx_ = 0;
+				if (recvbatch_pktcnt_ == 0) // timeout (not receive any UDP packet)
 				{
-					std::ostringstream oss;
-					oss << "receive an UDP packet with invalid port !" << std::endl << boost::stacktrace::stacktrace();
-					Util::dumpWarnMsg(kClassName, oss.str());
-					is_timeout = true;
 					break;
 				}
-				NetworkAddr source_addr = fraghdr.getSourceAddr();
+			}
 
-				// Use MsgFragStats to track fragment statistics of each message
-				bool is_last_frag = msg_frag_stats_.insertEntry(source_addr, tmp_pkt_payload);
-				if (is_last_frag == true) // All fragment(s) of the message have been received
-				{
-					// Prepare message payload for current message
-					uint32_t msg_payload_size = fraghdr.getMsgPayloadSize();
-					msg_payload.clear(msg_payload_size);
-
-					// Copy previously received fragment payloads if any
-					uint32_t fragcnt = fraghdr.getFragmentCnt();
-					if (fragcnt > 1) // more than 1 fragments -> MsgFragStatsEntry exists
-					{
-						// Get previously received fragment payloads
-						MsgFragStatsEntry* msg_frag_stats_entry = msg_frag_stats_.getEntry(source_addr);
-						assert(msg_frag_stats_entry != NULL);
-						std::map<uint32_t, DynamicArray>& fragidx_fragpayload_map = msg_frag_stats_entry->getFragidxFragpayloadMapRef();
-
-						// Copy previously received fragment payloads into message payload
-						for (std::map<uint32_t, DynamicArray>::iterator iter = fragidx_fragpayload_map.begin(); iter != fragidx_fragpayload_map.end(); iter++)
-						{
-							// Calculate fragment offset and size in message based on fragment index
-							uint32_t fragidx = iter->first;
-							uint32_t fragment_offset = Util::getFragmentOffset(fragidx);
-							uint32_t fragment_payload_size = Util::getFragmentPayloadSize(fragidx, msg_payload_size);
-
-							// Copy previously received fragment payload into current message payload
-							iter->second.arraycpy(0, msg_payload, fragment_offset, fragment_payload_size);
-						}
-
-						// Remove previously received fragment payloads
-						msg_frag_stats_.removeEntry(source_addr);
-					} // End of (fragcnt > 1)
-
-					// Copy currently received packet payload into current message payload
-					uint32_t fragidx = fraghdr.getFragmentIdx();
-					uint32_t fragment_offset = Util::getFragmentOffset(fragidx);
-					uint32_t fragment_payload_size = Util::getFragmentPayloadSize(fragidx, msg_payload_size);
-					assert(fragment_payload_size == (tmp_pkt_payload.getSize() - fraghdr.getudpFragHdrPayloadSize()));
-					tmp_pkt_payload.arraycpy(Util::UDP_FRAGHDR_SIZE, msg_payload, fragment_offset, fragment_payload_size);
-
-					// Update network address for processing outside UdpSocketWrapper
-					//network_addr = source_addr;
-					//assert(network_addr.isValidAddr() == true);
-
-					break; // Break while(true)
-				} // End of (is_last_frag == true)
-			} // End of (is_timeout == false)
-		} // End of while(true)
+			bool is_crashed = false;
+			bool is_complete = processPkt_(recvbatch_pkt_payloads_[recvbatch_pktidx_], msg_payloads[msgcnt], is_crashed);
+			recvbatch_pktidx_++;
+			if (is_crashed)
+			{
+				break;
+			}
+			else if (is_complete)
+			{
+				msgcnt++;
+			}
+		}
 
-		return is_timeout;
+		return msgcnt;
+	}
+
+	int UdpMsgSocketServer::getSockfd() const
+	{
+		assert(pkt_socket_ptr_ != NULL);
+		return pkt_socket_ptr_->getSockfd();
+	}
+
+	bool UdpMsgSocketServer::processPkt_(const DynamicArray& pkt_payload, DynamicArray& msg_payload, bool& is_crashed)
+	{
+		is_crashed = false;
+
+		if (pkt_payload.getSize() < UdpFragHdr::staticGetudpFragHdrPayloadSize()) // Crashed UDP packet
+		{
+			std::ostringstream oss;
+			oss << "receive a crashed UDP packet with only " << pkt_payload.getSize() << " bytes < UdpFragHdr's payload size " << UdpFragHdr::staticGetudpFragHdrPayloadSize() << " bytes!" << std::endl << boost::stacktrace::stacktrace();
+			Util::dumpWarnMsg(kClassName, oss.str());
+			is_crashed = true;
+			return false;
+		}
+
+		// Deserialize fragment header from currently received packet payload
+		UdpFragHdr fraghdr(pkt_payload);
+		if (fraghdr.getSourceAddr().getPort() <= Util::UDP_MIN_PORT)
+		{
+			std::ostringstream oss;
+			oss << "receive an UDP packet with invalid port !" << std::endl << boost::stacktrace::stacktrace();
+			Util::dumpWarnMsg(kClassName, oss.str());
+			is_crashed = true;
+			return false;
+		}
+		NetworkAddr source_addr = fraghdr.getSourceAddr();
+
+		// Use MsgFragStats to track fragment statistics of each message
+		bool is_last_frag = msg_frag_stats_.insertEntry(source_addr, pkt_payload);
+		if (is_last_frag == false)
+		{
+			return false;
+		}
+
+		// All fragment(s) of the message have been received
+		uint32_t msg_payload_size = fraghdr.getMsgPayloadSize();
+		uint32_t fragcnt = fraghdr.getFragmentCnt();
+		if (fragcnt > 1) // more than 1 fragments -> MsgFragStatsEntry exists
+		{
+			// Get the preallocated message buffer w/ previously received fragment payloads
+			MsgFragStatsEntry* msg_frag_stats_entry = msg_frag_stats_.getEntry(source_addr);
+			assert(msg_frag_stats_entry != NULL);
+			DynamicArray& tmp_msg_payload = msg_frag_stats_entry->getMsgPayloadRef();
+
+			// Take over the message buffer w/o copying previously received fragment payloads
+			msg_payload.getBytesRef().swap(tmp_msg_payload.getBytesRef());
+
+			// Remove previously received fragment payloads
+			msg_frag_stats_.removeEntry(source_addr);
+		} // End of (fragcnt > 1)
+		else
+		{
+			// Prepare message payload for current message
+			msg_payload.clear(msg_payload_size);
+		}
+
+		// Copy currently received packet payload into current message payload
+		uint32_t fragidx = fraghdr.getFragmentIdx();
+		uint32_t fragment_offset = Util::getFragmentOffset(fragidx);
+		uint32_t fragment_payload_size = Util::getFragmentPayloadSize(fragidx, msg_payload_size);
+		assert(fragment_payload_size == (pkt_payload.getSize() - fraghdr.getudpFragHdrPayloadSize()));
+		pkt_payload.arraycpy(Util::UDP_FRAGHDR_SIZE, msg_payload, fragment_offset, fragment_payload_size);
+		assert(msg_payload.getSize() == msg_payload_size);
+
+		return true;
 	}
 }
\ No newline at end of file
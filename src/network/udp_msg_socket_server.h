@@ -4,6 +4,8 @@
  * NOTE: message payload may be splited into multiple UDP fragments (i.e., multiple fragment payloads), where each fragment payload + fragment header form the corresponding UDP packet payload.
  * 
  * NOTE: UdpMsgSocketServer is only used by working threads of each node (Client/Edge/CloudWrapper) to receive messages with a returned remote address.
+ *
+ * NOTE: recvBatch() receives up to UdpPktSocket::UDP_BATCH_MAX_PKTCNT packets per recvmmsg syscall and returns all messages completed so far; packets left in the batch are kept for the next recv()/recvBatch().
  * 
  * By Siyuan Sheng (2023.07.02).
  */
@@ -12,6 +14,7 @@
 #define UDP_MSG_SOCKET_SERVER_H
 
 #include <string>
+#include <vector>
 
 #include "common/dynamic_array.h"
 #include "network/msg_frag_stats.h"
@@ -31,12 +34,23 @@ namespace covered
 
         // Note: pass reference of pkt_payload to avoid unnecessary memory copy
         // NOTE: return DynamicArray instead of MessageBase, as we don't know whether to receive a request or a response
-        bool recv(DynamicArray& msg_payload);
+        bool recv(DynamicArray& msg_payload, const bool& is_nonblocking = false); // Return timeout flag (is_nonblocking: return immediately if no complete message is available now, e.g., for event-driven cache server workers)
+        uint32_t recvBatch(std::vector<DynamicArray>& msg_payloads, const uint32_t& max_msgcnt, const bool& is_nonblocking = false); // Return # of received messages (<= max_msgcnt), where 0 means timeout (block ONLY for the first message unless is_nonblocking)
+
+        int getSockfd() const; // For poll() by event loops (NOTE: poll() does NOT know packets left by recvBatch(), while recv() returns timeout ONLY if all left packets are processed)
     private:
         static const std::string kClassName;
 
+        bool processPkt_(const DynamicArray& pkt_payload, DynamicArray& msg_payload, bool& is_crashed); // Return if the message is complete
+
         UdpPktSocket* pkt_socket_ptr_; // recv payload of each single UDP packet
         MsgFragStats msg_frag_stats_; // reconstruct each message based on received fragments
+
+        // Packets received by recvmmsg yet NOT processed
+        std::vector<DynamicArray> recvbatch_pkt_payloads_;
+        std::vector<NetworkAddr> recvbatch_propagation_simulator_addrs_;
+        uint32_t recvbatch_pktcnt_;
+        uint32_t recvbatch_pktidx_;
     };
 }
 
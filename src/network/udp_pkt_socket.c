@@ -1,5 +1,6 @@
 #include "network/udp_pkt_socket.h"
 
+#include <algorithm> // std::min
 #include <assert.h>
 #include <cstring> // memset
 #include <sstream>
@@ -12,16 +13,17 @@ namespace covered
     const uint32_t UdpPktSocket::SOCKET_TIMEOUT_USECONDS = 0; // 0us
     const uint32_t UdpPktSocket::UDP_DEFAULT_RCVBUFSIZE = 212992; // 208KB used in linux by default
     const uint32_t UdpPktSocket::UDP_LARGE_RCVBUFSIZE = 8388608; // 8MB used for large data
+    const uint32_t UdpPktSocket::UDP_BATCH_MAX_PKTCNT = 16; // 16 * 64KB = 1MB preallocated buffer for batched receiving
 
     const std::string UdpPktSocket::kClassName("UdpPktSocket");
 
-	UdpPktSocket::UdpPktSocket(const bool& need_timeout) : need_timeout_(need_timeout)
+	UdpPktSocket::UdpPktSocket(const bool& need_timeout) : need_timeout_(need_timeout), sendbatch_msghdrs_(UDP_BATCH_MAX_PKTCNT), sendbatch_iovecs_(UDP_BATCH_MAX_PKTCNT), sendbatch_sockaddrs_(UDP_BATCH_MAX_PKTCNT)
 	{
 		// Create UDP socket
 		createUdpsock_();
 	}
 
-    UdpPktSocket::UdpPktSocket(const bool& need_timeout, const NetworkAddr& host_addr) : need_timeout_(need_timeout)
+    UdpPktSocket::UdpPktSocket(const bool& need_timeout, const NetworkAddr& host_addr) : need_timeout_(need_timeout), sendbatch_msghdrs_(UDP_BATCH_MAX_PKTCNT), sendbatch_iovecs_(UDP_BATCH_MAX_PKTCNT), sendbatch_sockaddrs_(UDP_BATCH_MAX_PKTCNT)
     {
         assert(host_addr.isValidAddr() == true);
         
@@ -80,7 +82,7 @@ namespace covered
 		return;
 	}
 
-	bool UdpPktSocket::udpRecvfrom(DynamicArray& pkt_payload, NetworkAddr& remote_addr)
+	bool UdpPktSocket::udpRecvfrom(DynamicArray& pkt_payload, NetworkAddr& remote_addr, const bool& is_nonblocking)
 	{
         bool is_timeout = false;
 
@@ -95,9 +97,13 @@ namespace covered
 
 		// Try to receive the UDP packet
 		int flags = 0;
+		if (is_nonblocking)
+		{
+			flags |= MSG_DONTWAIT; // NOT wait for SO_RCVTIMEO
+		}
 		int recvsize = recvfrom(sockfd_, tmp_pkt_payload, Util::UDP_MAX_PKT_PAYLOAD, flags, (struct sockaddr *)&remote_sockaddr, &sockaddr_len);
 		if (recvsize < 0) { // Failed to receive a UDP packet
-			if (need_timeout_ && (errno == EWOULDBLOCK || errno == EINTR || errno == EAGAIN)) {
+			if ((need_timeout_ || is_nonblocking) && (errno == EWOULDBLOCK || errno == EINTR || errno == EAGAIN)) {
 				is_timeout = true;
 			}
 			else {
@@ -123,6 +129,157 @@ namespace covered
 		return is_timeout;
 	}
 
+	void UdpPktSocket::udpSendBatch(const std::vector<DynamicArray>& pkt_payloads, const std::vector<NetworkAddr>& remote_addrs, const uint32_t& pktcnt)
+	{
+		assert(pktcnt <= pkt_payloads.size());
+		assert(pktcnt <= remote_addrs.size());
+
+		uint32_t sent_pktcnt = 0;
+		while (sent_pktcnt < pktcnt)
+		{
+			// Prepare message headers for the current batch
+			const uint32_t tmp_batch_pktcnt = std::min(pktcnt - sent_pktcnt, UDP_BATCH_MAX_PKTCNT);
+			for (uint32_t i = 0; i < tmp_batch_pktcnt; i++)
+			{
+				const DynamicArray& tmp_pkt_payload = pkt_payloads[sent_pktcnt + i];
+				getRemoteSockaddr_(remote_addrs[sent_pktcnt + i], sendbatch_sockaddrs_[i]);
+
+				sendbatch_iovecs_[i].iov_base = (void*)(tmp_pkt_payload.getBytesConstRef().data());
+				sendbatch_iovecs_[i].iov_len = tmp_pkt_payload.getSize();
+
+				memset((void *)&sendbatch_msghdrs_[i], 0, sizeof(struct mmsghdr));
+				sendbatch_msghdrs_[i].msg_hdr.msg_name = (void*)&sendbatch_sockaddrs_[i];
+				sendbatch_msghdrs_[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+				sendbatch_msghdrs_[i].msg_hdr.msg_iov = &sendbatch_iovecs_[i];
+				sendbatch_msghdrs_[i].msg_hdr.msg_iovlen = 1;
+			}
+
+			// Send UDP packets of the current batch (sendmmsg may send fewer packets than given)
+			int flags = 0;
+			uint32_t tmp_batch_sent_pktcnt = 0;
+			while (tmp_batch_sent_pktcnt < tmp_batch_pktcnt)
+			{
+				int return_code = sendmmsg(sockfd_, &sendbatch_msghdrs_[tmp_batch_sent_pktcnt], tmp_batch_pktcnt - tmp_batch_sent_pktcnt, flags);
+				if (return_code < 0)
+				{
+					if (errno == EINTR)
+					{
+						continue;
+					}
+
+					std::ostringstream oss;
+					oss << "failed to send a batch of " << (tmp_batch_pktcnt - tmp_batch_sent_pktcnt) << " UDP packets (errno: " << errno << ")";
+					Util::dumpErrorMsg(kClassName, oss.str());
+					exit(1);
+				}
+				tmp_batch_sent_pktcnt += static_cast<uint32_t>(return_code);
+			}
+
+			sent_pktcnt += tmp_batch_pktcnt;
+		}
+
+		return;
+	}
+
+	uint32_t UdpPktSocket::udpRecvBatch(std::vector<DynamicArray>& pkt_payloads, std::vector<NetworkAddr>& remote_addrs, const bool& is_nonblocking)
+	{
+		// Preallocate buffers for batched receiving if not yet
+		if (recvbatch_buffer_.size() == 0)
+		{
+			recvbatch_buffer_.resize(UDP_BATCH_MAX_PKTCNT * Util::UDP_MAX_PKT_PAYLOAD);
+			recvbatch_msghdrs_.resize(UDP_BATCH_MAX_PKTCNT);
+			recvbatch_iovecs_.resize(UDP_BATCH_MAX_PKTCNT);
+			recvbatch_sockaddrs_.resize(UDP_BATCH_MAX_PKTCNT);
+		}
+		if (pkt_payloads.size() < UDP_BATCH_MAX_PKTCNT)
+		{
+			pkt_payloads.resize(UDP_BATCH_MAX_PKTCNT);
+		}
+		if (remote_addrs.size() < UDP_BATCH_MAX_PKTCNT)
+		{
+			remote_addrs.resize(UDP_BATCH_MAX_PKTCNT);
+		}
+
+		// Prepare message headers (NOTE: recvmmsg overwrites msg_namelen and msg_len)
+		for (uint32_t i = 0; i < UDP_BATCH_MAX_PKTCNT; i++)
+		{
+			recvbatch_iovecs_[i].iov_base = (void*)(recvbatch_buffer_.data() + i * Util::UDP_MAX_PKT_PAYLOAD);
+			recvbatch_iovecs_[i].iov_len = Util::UDP_MAX_PKT_PAYLOAD;
+
+			memset((void *)&recvbatch_msghdrs_[i], 0, sizeof(struct mmsghdr));
+			recvbatch_msghdrs_[i].msg_hdr.msg_name = (void*)&recvbatch_sockaddrs_[i];
+			recvbatch_msghdrs_[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+			recvbatch_msghdrs_[i].msg_hdr.msg_iov = &recvbatch_iovecs_[i];
+			recvbatch_msghdrs_[i].msg_hdr.msg_iovlen = 1;
+		}
+
+		// Try to receive a batch of UDP packets
+		int flags = MSG_WAITFORONE; // Block (until SO_RCVTIMEO) ONLY for the first packet
+		if (is_nonblocking)
+		{
+			flags |= MSG_DONTWAIT; // NOT wait for SO_RCVTIMEO
+		}
+		int recvcnt = recvmmsg(sockfd_, recvbatch_msghdrs_.data(), UDP_BATCH_MAX_PKTCNT, flags, NULL);
+		if (recvcnt < 0) // Failed to receive any UDP packet
+		{
+			if ((need_timeout_ || is_nonblocking) && (errno == EWOULDBLOCK || errno == EINTR || errno == EAGAIN)) {
+				return 0; // Timeout
+			}
+			else {
+				std::ostringstream oss;
+				oss << "failed to receive a batch of UDP packets (errno: " << errno << ")!";
+				Util::dumpErrorMsg(kClassName, oss.str());
+				exit(1);
+			}
+		}
+
+		// Copy into pkt_payloads and set remote addresses
+		for (uint32_t i = 0; i < static_cast<uint32_t>(recvcnt); i++)
+		{
+			pkt_payloads[i].clear(Util::UDP_MAX_PKT_PAYLOAD); // NOTE: reuse the capacity of previous batches
+			pkt_payloads[i].deserialize(0, (const char*)recvbatch_iovecs_[i].iov_base, recvbatch_msghdrs_[i].msg_len);
+			getRemoteAddr_(recvbatch_sockaddrs_[i], remote_addrs[i]);
+		}
+
+		return static_cast<uint32_t>(recvcnt);
+	}
+
+	int UdpPktSocket::getSockfd() const
+	{
+		return sockfd_;
+	}
+
+	void UdpPktSocket::getRemoteSockaddr_(const NetworkAddr& remote_addr, struct sockaddr_in& remote_sockaddr) const
+	{
+		assert(remote_addr.isValidAddr() == true);
+
+		// Not support broadcast for UDP client
+		std::string remote_ipstr = remote_addr.getIpstr();
+		if (remote_ipstr == Util::ANY_IPSTR)
+		{
+			std::ostringstream oss;
+			oss << "invalid remote ipstr of " << remote_ipstr << " for sending a batch of UDP packets!";
+			Util::dumpErrorMsg(kClassName, oss.str());
+			exit(1);
+		}
+
+		memset((void *)&remote_sockaddr, 0, sizeof(remote_sockaddr));
+		remote_sockaddr.sin_family = AF_INET;
+		inet_pton(AF_INET, remote_ipstr.c_str(), &(remote_sockaddr.sin_addr));
+		remote_sockaddr.sin_port = htons(remote_addr.getPort());
+		return;
+	}
+
+	void UdpPktSocket::getRemoteAddr_(const struct sockaddr_in& remote_sockaddr, NetworkAddr& remote_addr) const
+	{
+		char remote_ipcstr[INET_ADDRSTRLEN];
+		inet_ntop(AF_INET, &(remote_sockaddr.sin_addr), remote_ipcstr, INET_ADDRSTRLEN);
+		remote_addr.setIpstr(std::string(remote_ipcstr));
+		remote_addr.setPort(ntohs(remote_sockaddr.sin_port));
+		remote_addr.setValidAddr();
+		return;
+	}
+
     void UdpPktSocket::createUdpsock_() {
 		// Create UDP socket
         sockfd_ = socket(AF_INET, SOCK_DGRAM, 0);
@@ -2,6 +2,8 @@
  * UdpPktSocket: encapsulate basic operations (sendto/recvfrom payload of a single UDP packet) via timeout-based socket.
  *
  * Note: UdpPktSocket is orthogonal with UDP fragmentation (see UdpSocketWrapper).
+ *
+ * NOTE: batched I/O (udpSendBatch/udpRecvBatch) issues up to UDP_BATCH_MAX_PKTCNT packets per sendmmsg/recvmmsg syscall; buffers of batched receiving are preallocated on demand, so sockets w/o batched I/O do NOT pay the memory cost.
  * 
  * By Siyuan Sheng (2023.04.22).
  */
@@ -12,7 +14,8 @@
 #include <string>
 #include <vector>
 #include <errno.h> // errno
-#include <sys/socket.h> // socket API
+#include <sys/socket.h> // socket API sendmmsg recvmmsg
+#include <sys/uio.h> // struct iovec
 #include <netinet/in.h> // struct sockaddr_in
 #include <arpa/inet.h> // htons ntohs inet_ntop inet_pton
 
@@ -29,6 +32,7 @@ namespace covered
         static const uint32_t SOCKET_TIMEOUT_USECONDS;
         static const uint32_t UDP_DEFAULT_RCVBUFSIZE;
         static const uint32_t UDP_LARGE_RCVBUFSIZE;
+        static const uint32_t UDP_BATCH_MAX_PKTCNT; // Max # of packets per sendmmsg/recvmmsg
 
         UdpPktSocket(const bool& need_timeout); // for UDP client
         UdpPktSocket(const bool& need_timeout, const NetworkAddr& host_addr); // for UDP server
@@ -36,10 +40,20 @@ namespace covered
 
         // Note: pass reference of pkt_payload to avoid unnecessary memory copy
         void udpSendto(const DynamicArray& pkt_payload, const NetworkAddr& remote_addr);
-        bool udpRecvfrom(DynamicArray& pkt_payload, NetworkAddr& remote_addr); // Return timeout flag
+        bool udpRecvfrom(DynamicArray& pkt_payload, NetworkAddr& remote_addr, const bool& is_nonblocking = false); // Return timeout flag (is_nonblocking: return immediately if no packet, which is treated as timeout)
+
+        // Batched I/O
+        void udpSendBatch(const std::vector<DynamicArray>& pkt_payloads, const std::vector<NetworkAddr>& remote_addrs, const uint32_t& pktcnt); // Send the first pktcnt packets (vectors may be longer to be reused by caller)
+        uint32_t udpRecvBatch(std::vector<DynamicArray>& pkt_payloads, std::vector<NetworkAddr>& remote_addrs, const bool& is_nonblocking = false); // Return # of received packets (<= UDP_BATCH_MAX_PKTCNT), where 0 means timeout (block for the first packet unless is_nonblocking, yet NOT wait for subsequent packets)
+
+        int getSockfd() const; // For poll() by event loops
     private:
         static const std::string kClassName;
 
+        // Conversion between NetworkAddr and sockaddr
+        void getRemoteSockaddr_(const NetworkAddr& remote_addr, struct sockaddr_in& remote_sockaddr) const;
+        void getRemoteAddr_(const struct sockaddr_in& remote_sockaddr, NetworkAddr& remote_addr) const;
+
         // UDP socket programming
         void createUdpsock_();
 
@@ -50,6 +64,17 @@ namespace covered
 
         const bool need_timeout_;
         int sockfd_;
+
+        // Preallocated headers for batched sending
+        std::vector<struct mmsghdr> sendbatch_msghdrs_;
+        std::vector<struct iovec> sendbatch_iovecs_;
+        std::vector<struct sockaddr_in> sendbatch_sockaddrs_;
+
+        // Preallocated buffers for batched receiving (allocated by the first udpRecvBatch())
+        std::vector<char> recvbatch_buffer_; // UDP_BATCH_MAX_PKTCNT * Util::UDP_MAX_PKT_PAYLOAD bytes
+        std::vector<struct mmsghdr> recvbatch_msghdrs_;
+        std::vector<struct iovec> recvbatch_iovecs_;
+        std::vector<struct sockaddr_in> recvbatch_sockaddrs_;
     };
 }
 
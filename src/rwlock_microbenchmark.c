@@ -0,0 +1,185 @@
+/*
+ * Microbenchmark of read-write lock variants under different numbers of contending threads (1-64 by default).
+ *
+ * NOTE: variants include boost_polling (the previous try_lock() polling of Rwlock/PerkeyRwlock), boost_blocking, std_shared_mutex, and futex (FutexRwlock used by Rwlock/PerkeyRwlock now). We report both throughput and CPU time, as polling wastes CPU cycles of waiting threads.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <shared_mutex>
+#include <sstream>
+#include <sys/resource.h> // getrusage
+#include <thread>
+#include <vector>
+
+#include <boost/program_options.hpp>
+#include <boost/thread/shared_mutex.hpp>
+
+#include "concurrency/futex_rwlock.h"
+
+namespace
+{
+    const std::string kClassName("rwlock_microbenchmark");
+
+    const std::string BOOST_POLLING_VARIANT_NAME("boost_polling");
+    const std::string BOOST_BLOCKING_VARIANT_NAME("boost_blocking");
+    const std::string STD_SHARED_MUTEX_VARIANT_NAME("std_shared_mutex");
+    const std::string FUTEX_VARIANT_NAME("futex");
+
+    // Previous implementation of Rwlock/PerkeyRwlock (frequent polling on try_lock())
+    class BoostPollingRwlock
+    {
+    public:
+        void lock_shared() { while (!rwlock_.try_lock_shared()) {} }
+        void unlock_shared() { rwlock_.unlock_shared(); }
+        void lock() { while (!rwlock_.try_lock()) {} }
+        void unlock() { rwlock_.unlock(); }
+    private:
+        boost::shared_mutex rwlock_;
+    };
+
+    // Shared state protected by the lock (reads scan and writes update a few cache lines to emulate short critical sections)
+    const uint32_t CRITICAL_SECTION_WORDCNT = 32;
+    struct SharedState
+    {
+        uint64_t words[CRITICAL_SECTION_WORDCNT];
+    };
+
+    template<typename T>
+    void runWorker(T* rwlock_ptr, SharedState* state_ptr, const uint64_t perthread_opcnt, const uint32_t read_ratio_percent, const uint32_t thread_idx, std::atomic<bool>* start_flag_ptr, uint64_t* checksum_ptr)
+    {
+        // Deterministic per-thread xorshift generator to decide reads vs. writes
+        uint64_t rng_state = 0x9E3779B97F4A7C15ULL * (thread_idx + 1);
+        uint64_t checksum = 0;
+
+        while (!start_flag_ptr->load(std::memory_order_acquire)) {}
+
+        for (uint64_t i = 0; i < perthread_opcnt; i++)
+        {
+            rng_state ^= rng_state << 13;
+            rng_state ^= rng_state >> 7;
+            rng_state ^= rng_state << 17;
+            if ((rng_state % 100) < read_ratio_percent)
+            {
+                rwlock_ptr->lock_shared();
+                for (uint32_t j = 0; j < CRITICAL_SECTION_WORDCNT; j++)
+                {
+                    checksum += state_ptr->words[j];
+                }
+                rwlock_ptr->unlock_shared();
+            }
+            else
+            {
+                rwlock_ptr->lock();
+                for (uint32_t j = 0; j < CRITICAL_SECTION_WORDCNT; j++)
+                {
+                    state_ptr->words[j] += 1;
+                }
+                rwlock_ptr->unlock();
+            }
+        }
+
+        *checksum_ptr = checksum;
+        return;
+    }
+
+    double getProcessCpuSec()
+    {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1000000.0;
+    }
+
+    template<typename T>
+    void runVariant(const std::string& variant_name, const uint32_t threadcnt, const uint64_t perthread_opcnt, const uint32_t read_ratio_percent)
+    {
+        T rwlock;
+        SharedState state = {};
+        std::atomic<bool> start_flag(false);
+        std::vector<uint64_t> checksums(threadcnt, 0);
+
+        std::vector<std::thread> threads;
+        threads.reserve(threadcnt);
+        for (uint32_t thread_idx = 0; thread_idx < threadcnt; thread_idx++)
+        {
+            threads.emplace_back(runWorker<T>, &rwlock, &state, perthread_opcnt, read_ratio_percent, thread_idx, &start_flag, &checksums[thread_idx]);
+        }
+
+        const double start_cpu_sec = getProcessCpuSec();
+        const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        start_flag.store(true, std::memory_order_release);
+        for (uint32_t thread_idx = 0; thread_idx < threadcnt; thread_idx++)
+        {
+            threads[thread_idx].join();
+        }
+        const double elapsed_sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+        const double cpu_sec = getProcessCpuSec() - start_cpu_sec;
+
+        const double total_opcnt = static_cast<double>(perthread_opcnt) * threadcnt;
+        std::ostringstream oss;
+        oss << std::left << std::setw(20) << variant_name << std::setw(10) << threadcnt << std::setw(16) << std::fixed << std::setprecision(3) << (total_opcnt / elapsed_sec / 1000000.0) << std::setw(16) << elapsed_sec << std::setw(16) << cpu_sec << std::setw(16) << (cpu_sec * 1000000000.0 / total_opcnt);
+        std::cout << oss.str() << std::endl;
+        return;
+    }
+}
+
+int main(int argc, char **argv) {
+    // (1) Parse CLI parameters
+
+    boost::program_options::options_description argument_desc("Allowed arguments for " + kClassName);
+    argument_desc.add_options()
+        ("help,h", "dump help information")
+        ("min_threadcnt", boost::program_options::value<uint32_t>()->default_value(1), "the minimum number of contending threads")
+        ("max_threadcnt", boost::program_options::value<uint32_t>()->default_value(64), "the maximum number of contending threads (doubled from min_threadcnt)")
+        ("perthread_opcnt", boost::program_options::value<uint64_t>()->default_value(200000), "the number of lock operations issued by each thread")
+        ("read_ratio_percent", boost::program_options::value<uint32_t>()->default_value(90), "the percentage of read (shared) lock operations")
+        ("variant", boost::program_options::value<std::string>()->default_value("all"), "the rwlock variant (all, boost_polling, boost_blocking, std_shared_mutex, or futex)")
+    ;
+    boost::program_options::variables_map argument_info;
+    boost::program_options::store(boost::program_options::parse_command_line(argc, argv, argument_desc), argument_info);
+    boost::program_options::notify(argument_info);
+    if (argument_info.count("help"))
+    {
+        std::cout << argument_desc << std::endl;
+        return 0;
+    }
+
+    const uint32_t min_threadcnt = argument_info["min_threadcnt"].as<uint32_t>();
+    const uint32_t max_threadcnt = argument_info["max_threadcnt"].as<uint32_t>();
+    const uint64_t perthread_opcnt = argument_info["perthread_opcnt"].as<uint64_t>();
+    const uint32_t read_ratio_percent = argument_info["read_ratio_percent"].as<uint32_t>();
+    const std::string variant = argument_info["variant"].as<std::string>();
+    if (min_threadcnt == 0 || min_threadcnt > max_threadcnt || read_ratio_percent > 100)
+    {
+        std::cerr << "[ERROR] " << kClassName << ": invalid min_threadcnt " << min_threadcnt << ", max_threadcnt " << max_threadcnt << ", or read_ratio_percent " << read_ratio_percent << std::endl;
+        return 1;
+    }
+
+    // (2) Run each variant under different numbers of threads
+
+    std::cout << "Hardware concurrency: " << std::thread::hardware_concurrency() << "; per-thread opcnt: " << perthread_opcnt << "; read ratio: " << read_ratio_percent << "%" << std::endl;
+    std::cout << std::left << std::setw(20) << "variant" << std::setw(10) << "threads" << std::setw(16) << "Mops/s" << std::setw(16) << "wall (s)" << std::setw(16) << "cpu (s)" << std::setw(16) << "cpu ns/op" << std::endl;
+    for (uint32_t threadcnt = min_threadcnt; threadcnt <= max_threadcnt; threadcnt *= 2)
+    {
+        if (variant == "all" || variant == BOOST_POLLING_VARIANT_NAME)
+        {
+            runVariant<BoostPollingRwlock>(BOOST_POLLING_VARIANT_NAME, threadcnt, perthread_opcnt, read_ratio_percent);
+        }
+        if (variant == "all" || variant == BOOST_BLOCKING_VARIANT_NAME)
+        {
+            runVariant<boost::shared_mutex>(BOOST_BLOCKING_VARIANT_NAME, threadcnt, perthread_opcnt, read_ratio_percent);
+        }
+        if (variant == "all" || variant == STD_SHARED_MUTEX_VARIANT_NAME)
+        {
+            runVariant<std::shared_mutex>(STD_SHARED_MUTEX_VARIANT_NAME, threadcnt, perthread_opcnt, read_ratio_percent);
+        }
+        if (variant == "all" || variant == FUTEX_VARIANT_NAME)
+        {
+            runVariant<covered::FutexRwlock>(FUTEX_VARIANT_NAME, threadcnt, perthread_opcnt, read_ratio_percent);
+        }
+    }
+
+    return 0;
+}
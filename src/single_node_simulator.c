@@ -7,20 +7,29 @@
  * 
  * NOTE: as the simulator does not consider the absolute performance, NO need message transmissions and also NO need the WAN propagation latency injection (but still measure dynamically changed latencies for COVERED and involved baselines such as LA-Cache -> equal to NO other latencies such as processing latencies in cache nodes, which is acceptable as the propagation latencies are the bottleneck in WAN distributed caching, and single node simulator ONLY focuses on hit ratios instead of absolute performance).
  * 
+ * NOTE: epoch-batched simulation (simulator_epoch_roundcnt > 0) splits each epoch into two phases: (i) lookup phase, where ONLY local cache lookups of GET requests run on simulator_lookup_threadcnt threads (each edge node is owned by a single thread and processes its lookups in the canonical client-worker order); (ii) commit phase, where the main thread serially processes the remaining part of each request (victim/vtime synchronization, content discovery, request redirection, validation, cache management, and latency/bandwidth calculation) one by one in the canonical order -> lookups see edge-local cache states of the epoch beginning plus earlier lookups of the same edge, so results are deterministic for a given seed regardless of simulator_lookup_threadcnt (yet NOT identical to sequential simulation due to delayed cross-edge visibility within an epoch).
+ *
+ * NOTE: this is NOT parallel simulation: writes and all cross-edge interactions (directory, redirection, victim synchronization, and placement) are serial in commit phase, and commit phase is NOT partitioned by edge node -> speedup is bounded by the fraction of lookup phase time (dumped as epoch phase time in stresstest statistics) and has NOT been measured against lookup threadcnt, so do NOT use simulator_lookup_threadcnt as a lever for simulating larger edgecnt (FUTURE: partition commit phase by owner edge node and batch cross-edge messages per epoch).
+ *
  * (FUTURE) TODO: NOT simulate directory cache here, as we focus on hit ratios instead of absolute performance in single-node simulator.
  * 
  * By Siyuan Sheng (2024.08.12).
  */
 
+#include <algorithm> // std::min
+#include <condition_variable> // std::condition_variable
 #include <map> // std::multimap
+#include <mutex> // std::mutex, std::unique_lock
 #include <random> // std::mt19937_64, std::uniform_int_distribution
 #include <sstream> // std::ostringstream
+#include <thread> // std::thread
 #include <unordered_map> // std::unordered_map
 #include <vector> // std::vector
 
 #include "benchmark/evaluator_wrapper.h"
 #include "cache/basic_cache_custom_func_param.h"
 #include "cache/covered_cache_custom_func_param.h"
+#include "cache/lru/lrucache.h"
 #include "cli/single_node_cli.h"
 #include "common/bandwidth_usage.h"
 #include "common/config.h"
@@ -34,6 +43,7 @@
 #include "message/message_base.h"
 #include "message/control_message.h"
 #include "message/data_message.h"
+#include "statistics/shards_mrc_profiler.h"
 #include "workload/workload_wrapper_base.h"
 
 namespace covered
@@ -107,6 +117,64 @@ namespace covered
         std::unordered_map<uint32_t, EvictNodeinfo> edgeidx_evictinfo_map; // For all edge nodes (ONLY for COVERED)
     };
 
+    // Result of local cache lookup in the closest edge node (ONLY for epoch-batched simulation)
+    struct ClosestCacheLookup
+    {
+        bool is_local_cached_and_valid;
+        bool affect_victim_tracker;
+        Value fetched_value;
+    };
+
+    // Request generated by a client worker in the current epoch (ONLY for epoch-batched simulation)
+    struct EpochRequest
+    {
+        EpochRequest(const WorkloadItem& given_workload_item, const uint32_t& given_clientidx);
+
+        WorkloadItem workload_item;
+        uint32_t clientidx;
+        bool is_looked_up; // ONLY GET requests are looked up in lookup phase
+        struct ClosestCacheLookup lookup;
+    };
+
+    // Persistent threads for lookup phase of each epoch, where each edge node is owned by the thread of (edgeidx % threadcnt) (ONLY for epoch-batched simulation)
+    // NOTE: the main thread works as thread 0, so NO extra thread is launched if threadcnt = 1
+    struct EpochLookupWorkerPool
+    {
+        EpochLookupWorkerPool();
+
+        void start(const uint32_t& given_threadcnt, const uint32_t& given_edgecnt);
+        void runLookupPhase(std::vector<EpochRequest>& epoch_requests); // Return after all lookups of the epoch are finished
+        void stop();
+
+        void lookupForThread_(const uint32_t& threadidx);
+        void helperThreadLoop_(const uint32_t& threadidx);
+
+        uint32_t threadcnt;
+        uint32_t edgecnt;
+        std::vector<EpochRequest>* epoch_requests_ptr; // Requests of the current epoch (set by the main thread before each lookup phase)
+        std::vector<std::vector<uint32_t>> peredge_reqidxes; // Indexes of GET requests in the canonical order for each edge node
+        std::vector<std::thread*> helper_thread_ptrs; // For threadidx in [1, threadcnt - 1]
+
+        std::mutex epoch_mutex;
+        std::condition_variable epoch_start_cv;
+        std::condition_variable epoch_finish_cv;
+        uint64_t epoch_generation; // Increased by the main thread to start a lookup phase
+        uint32_t pending_helper_threadcnt; // Helper threads NOT finishing the current lookup phase yet
+        bool is_stop;
+    };
+
+    // Scaled-down cache of a given full-scale capacity for policies other than LRU (ONLY for MRC profiling)
+    struct MrcMinicache
+    {
+        uint64_t capacity_bytes; // Full-scale capacity (scaled-down capacity is capacity_bytes * sample_ratio)
+        double sample_ratio;
+        EdgeWrapperBase* edge_wrapper_ptr; // NOTE: ONLY use the local edge cache, yet NOT cooperation
+        uint64_t sampled_reqcnt;
+        uint64_t sampled_bytes;
+        uint64_t hitcnt;
+        uint64_t hit_bytes;
+    };
+
     // (2) Global variables
 
     // Global information for single-node simulation
@@ -134,6 +202,8 @@ namespace covered
 
 
     std::vector<std::vector<uint32_t>> debug_p2p_latency_matrix;
+
+    const uint64_t MRC_MIN_MINICACHE_CAPACITY_BYTES = MB2B(1); // Lower bound of scaled-down capacity for each mini-cache (too small caches cannot hold large objects)
 }
 
 namespace covered
@@ -149,13 +219,17 @@ namespace covered
     EdgeWrapperBase* getBeaconEdgeWrapperPtr(const Key& cur_key);
     bool isLocalBeacon(const Key& cur_key, const uint32_t& clientidx);
 
-    std::string getStatisticsString(const uint32_t& reqcnt, const uint32_t& local_hitcnt, const uint32_t& remote_hitcnt, const uint64_t& latency_sum, const BandwidthUsage& bandwidth_usage);
+    std::string getStatisticsString(const uint64_t& reqcnt, const uint64_t& local_hitcnt, const uint64_t& remote_hitcnt, const uint64_t& latency_sum, const BandwidthUsage& bandwidth_usage);
+    double getSimulationThroughput(const uint64_t& reqcnt, const double& delta_us); // Simulated requests per second of wall-clock time (NOT calculated performance)
 
     // (2) Common helper functions
 
-    void processRequest(const WorkloadItem& cur_workload_item, const uint32_t& clientidx, const std::string& cache_name, const uint32_t& edgecnt, const uint32_t& covered_topk_edgecnt, uint32_t& reqcnt, uint32_t& local_hitcnt, uint32_t& remote_hitcnt, uint64_t& latency_sum_us, BandwidthUsage& bandwidth_usage);
+    void processRequest(const WorkloadItem& cur_workload_item, const uint32_t& clientidx, const std::string& cache_name, const uint32_t& edgecnt, const uint32_t& covered_topk_edgecnt, uint64_t& reqcnt, uint64_t& local_hitcnt, uint64_t& remote_hitcnt, uint64_t& latency_sum_us, BandwidthUsage& bandwidth_usage, const ClosestCacheLookup* prelookup_ptr = NULL); // NOTE: prelookup_ptr is NOT NULL if local cache lookup of the GET request has been done in lookup phase of epoch-batched simulation
+    void processEpoch(std::vector<EpochRequest>& epoch_requests, EpochLookupWorkerPool& lookup_worker_pool, const std::string& cache_name, const uint32_t& edgecnt, const uint32_t& covered_topk_edgecnt, uint64_t& reqcnt, uint64_t& local_hitcnt, uint64_t& remote_hitcnt, uint64_t& latency_sum_us, BandwidthUsage& bandwidth_usage, double& lookup_phase_us, double& commit_phase_us); // Lookup phase in parallel, and then commit phase in the canonical order (NOTE: phase time is accumulated into lookup_phase_us and commit_phase_us)
 
     bool accessClosestCache(const Key& cur_key, const uint32_t& clientidx, const std::string& cache_name, Value& fetched_value); // Return is_local_cached_and_valid
+    void lookupClosestCache(const Key& cur_key, const uint32_t& clientidx, ClosestCacheLookup& lookup); // ONLY access the local cache of the closest edge node (thread safe across different edge nodes)
+    void syncClosestEdgeAfterLookup(const uint32_t& clientidx, const std::string& cache_name, const bool& affect_victim_tracker); // Victim/vtime synchronization across edge nodes after local cache lookup
     void writeClosestCache(const Key& cur_key, const Value& fetched_value, const uint32_t& clientidx, const std::string& cache_name, const WorkloadItemType& cur_workload_item_type, bool& is_evict, uint32_t& victim_cnt);
     void contentDiscovery(const Key& cur_key, const uint32_t& clientidx, const std::string& cache_name, const uint32_t& edgecnt, bool& is_remote_hit, uint32_t& target_edge_idx, BandwidthUsage& curpkt_bandwidth_usage);
     void requestRedirection(const Key& cur_key, const uint32_t& clientidx, const uint32_t& target_edge_idx, const std::string& cache_name, Value& fetched_value, BandwidthUsage& curpkt_bandwidth_usage);
@@ -168,6 +242,13 @@ namespace covered
     void evictForCapacity(const uint32_t& placement_edgeidx, const std::string& cache_name, bool& is_evict, uint32_t& victim_cnt);
     uint32_t getDirectoryUpdateLatency(const Key& cur_key, const uint32_t& clientidx, const std::string& cache_name);
 
+    // (2.5) Helper functions for MRC profiling
+
+    void mrcProcessRequest(const WorkloadItem& cur_workload_item, const bool& is_counted, ShardsMrcProfiler& lru_profiler, std::vector<MrcMinicache>& minicaches);
+    void mrcAccessMinicache(const WorkloadItem& cur_workload_item, const bool& is_counted, MrcMinicache& minicache);
+    void mrcEvictForCapacity(EdgeWrapperBase* edge_wrapper_ptr);
+    std::string getMrcStatisticsString(const std::string& cache_name, const std::vector<uint64_t>& capacities_bytes, const ShardsMrcProfiler& lru_profiler, const std::vector<MrcMinicache>& minicaches);
+
     // (3) COVERED's helper functions
 
     bool coveredTryPopularityAggregationForClosestEdge(const Key& cur_key, const uint32_t& clientidx); // Return is_tracked_after_fetch_value
@@ -213,6 +294,10 @@ int main(int argc, char **argv) {
     const std::string hash_name = single_node_cli.getHashName();
     const uint32_t keycnt = single_node_cli.getKeycnt();
     const uint32_t percacheserver_workercnt = single_node_cli.getPercacheserverWorkercnt(); // NOT affect single-node simulation, as multiple edge cache server workers still share the same local cache structure
+    const uint32_t local_cache_shardcnt = single_node_cli.getLocalCacheShardcnt();
+    const covered::CachelibNvmInfo cachelib_nvm_info = single_node_cli.getCachelibNvmInfo();
+    const uint32_t cache_server_worker_inflightcnt = single_node_cli.getCacheServerWorkerInflightcnt(); // NOT affect single-node simulation, which does NOT launch cache server workers
+    const uint32_t perbeaconserver_workercnt = single_node_cli.getPerbeaconserverWorkercnt(); // NOT affect single-node simulation, which does NOT launch beacon server workers
     const covered::CLILatencyInfo cli_latency_info = single_node_cli.getCLILatencyInfo();
     // print cli_latency_info for debugging
     
@@ -297,8 +382,152 @@ int main(int argc, char **argv) {
     // Stresstest configurations
     const uint32_t stresstest_duration_sec = single_node_cli.getStresstestDurationSec();
 
+    // Epoch-batched simulation configurations
+    const uint32_t simulator_lookup_threadcnt = single_node_cli.getSimulatorLookupThreadcnt();
+    const uint32_t simulator_epoch_roundcnt = single_node_cli.getSimulatorEpochRoundcnt();
+    const bool is_epoch_simulation = (simulator_epoch_roundcnt > 0);
+    const uint32_t perloop_roundcnt = is_epoch_simulation ? simulator_epoch_roundcnt : 1; // Each loop iteration of warmup/stresstest processes an epoch (or a single round for sequential simulation)
+
+    // Wall-clock-independent simulation configurations
+    const uint64_t simulator_stresstest_reqcnt = single_node_cli.getSimulatorStresstestReqcnt();
+    const uint64_t simulator_interval_reqcnt = single_node_cli.getSimulatorIntervalReqcnt();
+    const bool is_reqcnt_driven = (simulator_stresstest_reqcnt > 0); // Stop stresstest and dump interval statistics by reqcnt instead of wall-clock time (NOT affected by the speed and load of the physical machine)
+
+    // MRC profiling configurations
+    const uint32_t simulator_mrc_pointcnt = single_node_cli.getSimulatorMrcPointcnt();
+    const double simulator_mrc_sample_ratio = single_node_cli.getSimulatorMrcSampleRatio();
+    const bool is_mrc_profiling = (simulator_mrc_pointcnt > 0); // Replay the workload once for hit ratio curves of a single cache over multiple capacities
+
     // (2) Initialize global variables for single-node simulation
     
+    // Initialize for workload generators (refer to src/benchmark/client_wrapper.c::launchClient())
+    // std::cout << "Initialize workload generators for single-node simulation..." << std::endl;
+    // NOTE: if workloadcnt = clientcnt (i.e., perworkload_workercnt = perclient_workercnt), each client has an individual workload generator corresponding to the closest edge node -> here we just use a reasonable workloadcnt to fix the memory issue of large-scale exps (but each client worker ALWAYS has an individual workload worker corresponding to the closest edge node)
+    // NOTE: this is acceptable as we only focus on hit ratios and calculated performance instead of absolute performance in single-node simulator, while we have verified that workloadcnt does NOT affect the simulator results (affect absolute performance yet NOT concerned by single-node simulator)
+    covered::workload_wrapper_ptrs.resize(simulator_workloadcnt, NULL);
+    for (uint32_t workloadidx = 0; workloadidx < simulator_workloadcnt; workloadidx++)
+    {
+        // NOTE: NOT use ClientWrapper::launchEdge, which will invoke NodeWrapperBase::start() to launch multiple threads for absolute performance!
+        // NOTE: use covered::Util::DATASET_KVPAIR_GENERATION_SEED to generate dataset, use workloadidx to pre-generate workload items to approximate workload distribution (if any), and use global_workload_workeridx + randombase to generate requests for the given workload worker
+        covered::workload_wrapper_ptrs[workloadidx] = covered::WorkloadWrapperBase::getWorkloadGeneratorByWorkloadName(simulator_workloadcnt, workloadidx, keycnt, perclient_opcnt, perworkload_workercnt, workload_name, covered::WorkloadWrapperBase::WORKLOAD_USAGE_ROLE_CLIENT, zipf_alpha, workload_pattern_name, dynamic_change_period, dynamic_change_keycnt, simulator_randomness);
+        assert(covered::workload_wrapper_ptrs[workloadidx] != NULL);
+    }
+
+    // Initialize for client nodes (refer to src/benchmark/client_wrapper.c::launchClient())
+    covered::closest_edge_idxes.resize(clientcnt, 0);
+    for (uint32_t clientidx = 0; clientidx < clientcnt; clientidx++)
+    {
+        // Calculate closest edge node index for each client node (refer to src/benchmark/client_worker_wrapper.c::ClientWorkerWrapper())
+        covered::closest_edge_idxes[clientidx] = covered::Util::getClosestEdgeIdx(clientidx, clientcnt, edgecnt);
+        assert(covered::closest_edge_idxes[clientidx] >= 0);
+        assert(covered::closest_edge_idxes[clientidx] < edgecnt);
+    }
+
+    // One-pass MRC profiling of a single cache if any (NOT simulate cooperative edge nodes)
+    if (is_mrc_profiling)
+    {
+        if (cache_name == covered::Util::COVERED_CACHE_NAME || cache_name == covered::Util::BESTGUESS_CACHE_NAME)
+        {
+            std::ostringstream oss;
+            oss << "MRC profiling does NOT support cooperative cache " << cache_name << " whose admission depends on other edge nodes";
+            covered::Util::dumpErrorMsg(main_class_name, oss.str());
+            exit(1);
+        }
+        if (cache_name == covered::Util::CACHELIB_HYBRID_CACHE_NAME)
+        {
+            // NOTE: scaled-down mini-caches (>= MRC_MIN_MINICACHE_CAPACITY_BYTES) are far smaller than the minimum region-aligned NVM tier of Navy, so the DRAM/NVM split cannot be scaled with the capacity
+            std::ostringstream oss;
+            oss << "MRC profiling does NOT support hybrid cache " << cache_name << ", whose NVM tier cannot be scaled down for mini-caches (profile " << covered::Util::CACHELIB_CACHE_NAME << " for the DRAM-only counterpart instead)";
+            covered::Util::dumpErrorMsg(main_class_name, oss.str());
+            exit(1);
+        }
+        if (!is_reqcnt_driven)
+        {
+            covered::Util::dumpErrorMsg(main_class_name, "MRC profiling requires simulator_stresstest_reqcnt > 0");
+            exit(1);
+        }
+
+        // Cache capacities evenly spaced in (0, capacity_bytes]
+        std::vector<uint64_t> mrc_capacities_bytes(simulator_mrc_pointcnt, 0);
+        for (uint32_t capacity_idx = 0; capacity_idx < simulator_mrc_pointcnt; capacity_idx++)
+        {
+            mrc_capacities_bytes[capacity_idx] = capacity_bytes / simulator_mrc_pointcnt * (capacity_idx + 1);
+        }
+        mrc_capacities_bytes[simulator_mrc_pointcnt - 1] = capacity_bytes;
+
+        // LRU by reuse distances
+        covered::ShardsMrcProfiler mrc_lru_profiler(simulator_mrc_sample_ratio, mrc_capacities_bytes);
+
+        // All policies (including LRU, as reuse distances model writes as write-allocate yet the simulator ONLY updates cached objects) by scaled-down mini-caches (one per capacity)
+        std::vector<covered::MrcMinicache> mrc_minicaches;
+        mrc_minicaches.resize(simulator_mrc_pointcnt);
+        for (uint32_t capacity_idx = 0; capacity_idx < simulator_mrc_pointcnt; capacity_idx++)
+        {
+            covered::MrcMinicache& tmp_minicache = mrc_minicaches[capacity_idx];
+            tmp_minicache.capacity_bytes = mrc_capacities_bytes[capacity_idx];
+            // NOTE: increase sample ratio for small capacities to keep the scaled-down capacity >= MRC_MIN_MINICACHE_CAPACITY_BYTES (spatial sampling is nested, so results are still comparable)
+            tmp_minicache.sample_ratio = std::min(1.0, std::max(simulator_mrc_sample_ratio, static_cast<double>(covered::MRC_MIN_MINICACHE_CAPACITY_BYTES) / static_cast<double>(tmp_minicache.capacity_bytes)));
+            const uint64_t tmp_minicache_capacity_bytes = static_cast<uint64_t>(static_cast<double>(tmp_minicache.capacity_bytes) * tmp_minicache.sample_ratio);
+            tmp_minicache.edge_wrapper_ptr = new covered::BasicEdgeWrapper(cache_name, tmp_minicache_capacity_bytes, capacity_idx, simulator_mrc_pointcnt, hash_name, keycnt, covered_local_uncached_capacity_bytes, covered_local_uncached_lru_bytes, percacheserver_workercnt, local_cache_shardcnt, cachelib_nvm_info, cache_server_worker_inflightcnt, perbeaconserver_workercnt, covered_peredge_synced_victimcnt, covered_peredge_monitored_victimsetcnt, covered_popularity_aggregation_capacity_bytes, covered_popularity_collection_change_ratio, cli_latency_info, covered_topk_edgecnt, realnet_option, realnet_expname);
+            assert(tmp_minicache.edge_wrapper_ptr != NULL);
+            tmp_minicache.sampled_reqcnt = 0;
+            tmp_minicache.sampled_bytes = 0;
+            tmp_minicache.hitcnt = 0;
+            tmp_minicache.hit_bytes = 0;
+        }
+
+        // Replay warmup requests (NOT counted) and then stresstest requests (counted) once for all capacities
+        struct timespec mrc_start_timestamp = covered::Util::getCurrentTimespec();
+        const uint64_t mrc_warmup_reqcnt = static_cast<uint64_t>(warmup_reqcnt_scale) * static_cast<uint64_t>(keycnt); // The same total warmup reqcnt as normal simulation
+        const uint64_t mrc_total_reqcnt = mrc_warmup_reqcnt + simulator_stresstest_reqcnt;
+        uint64_t mrc_issued_reqcnt = 0;
+        while (mrc_issued_reqcnt < mrc_total_reqcnt)
+        {
+            for (uint32_t clientidx = 0; clientidx < clientcnt && mrc_issued_reqcnt < mrc_total_reqcnt; clientidx++)
+            {
+                for (uint32_t local_client_worker_idx = 0; local_client_worker_idx < perclient_workercnt && mrc_issued_reqcnt < mrc_total_reqcnt; local_client_worker_idx++)
+                {
+                    covered::WorkloadItem cur_workload_item = covered::genWorkloadItemForClientWorker(local_client_worker_idx, clientidx, perclient_workercnt, client_workercnt, perworkload_workercnt, simulator_workloadcnt);
+
+                    const bool is_counted = (mrc_issued_reqcnt >= mrc_warmup_reqcnt);
+                    covered::mrcProcessRequest(cur_workload_item, is_counted, mrc_lru_profiler, mrc_minicaches);
+
+                    mrc_issued_reqcnt += 1;
+                    if (mrc_issued_reqcnt % simulator_interval_reqcnt == 0)
+                    {
+                        std::ostringstream oss;
+                        oss << "[MRC Profiling] processed " << mrc_issued_reqcnt << " / " << mrc_total_reqcnt << " requests";
+                        covered::Util::dumpNormalMsg(main_class_name, oss.str());
+                    }
+                }
+            }
+        }
+        const double mrc_whole_us = covered::Util::getDeltaTimeUs(covered::Util::getCurrentTimespec(), mrc_start_timestamp);
+
+        // Dump hit ratio curves
+        std::ostringstream oss;
+        oss << "[Final MRC Statistics]" << std::endl;
+        oss << "Simulation throughput (reqs/s): " << covered::getSimulationThroughput(mrc_total_reqcnt, mrc_whole_us) << std::endl;
+        oss << covered::getMrcStatisticsString(cache_name, mrc_capacities_bytes, mrc_lru_profiler, mrc_minicaches) << std::endl << std::endl;
+        std::cout << oss.str() << std::flush;
+
+        for (uint32_t capacity_idx = 0; capacity_idx < mrc_minicaches.size(); capacity_idx++)
+        {
+            assert(mrc_minicaches[capacity_idx].edge_wrapper_ptr != NULL);
+            delete mrc_minicaches[capacity_idx].edge_wrapper_ptr;
+            mrc_minicaches[capacity_idx].edge_wrapper_ptr = NULL;
+        }
+        for (uint32_t workloadidx = 0; workloadidx < simulator_workloadcnt; workloadidx++)
+        {
+            assert(covered::workload_wrapper_ptrs[workloadidx] != NULL);
+            delete covered::workload_wrapper_ptrs[workloadidx];
+            covered::workload_wrapper_ptrs[workloadidx] = NULL;
+        }
+
+        covered::Util::dumpNormalMsg(main_class_name, covered::EvaluatorWrapper::EVALUATOR_FINISH_BENCHMARK_SYMBOL);
+        return 0;
+    }
+
     // Initialize for edge nodes (refer to src/edge/edge_wrapper_base.c::launchEdge())
     covered::edge_wrapper_ptrs.resize(edgecnt, NULL);
     for (uint32_t edgeidx = 0; edgeidx < edgecnt; edgeidx++)
@@ -315,9 +544,9 @@ int main(int argc, char **argv) {
                 }else{
                     tmp_p2p_latency_array = std::vector<uint32_t>(edgecnt, UINT32_MAX);
                 }
-                covered::edge_wrapper_ptrs[edgeidx] = new covered::CoveredEdgeWrapper(cache_name, capacity_bytes, edgeidx, edgecnt, hash_name, keycnt, covered_local_uncached_capacity_bytes, covered_local_uncached_lru_bytes, percacheserver_workercnt, covered_peredge_synced_victimcnt, covered_peredge_monitored_victimsetcnt, covered_popularity_aggregation_capacity_bytes, covered_popularity_collection_change_ratio, cli_latency_info, covered_topk_edgecnt, realnet_option, realnet_expname, tmp_p2p_latency_array);
+                covered::edge_wrapper_ptrs[edgeidx] = new covered::CoveredEdgeWrapper(cache_name, capacity_bytes, edgeidx, edgecnt, hash_name, keycnt, covered_local_uncached_capacity_bytes, covered_local_uncached_lru_bytes, percacheserver_workercnt, local_cache_shardcnt, cachelib_nvm_info, cache_server_worker_inflightcnt, perbeaconserver_workercnt, covered_peredge_synced_victimcnt, covered_peredge_monitored_victimsetcnt, covered_popularity_aggregation_capacity_bytes, covered_popularity_collection_change_ratio, cli_latency_info, covered_topk_edgecnt, realnet_option, realnet_expname, tmp_p2p_latency_array);
             }else{
-                covered::edge_wrapper_ptrs[edgeidx] = new covered::CoveredEdgeWrapper(cache_name, capacity_bytes, edgeidx, edgecnt, hash_name, keycnt, covered_local_uncached_capacity_bytes, covered_local_uncached_lru_bytes, percacheserver_workercnt, covered_peredge_synced_victimcnt, covered_peredge_monitored_victimsetcnt, covered_popularity_aggregation_capacity_bytes, covered_popularity_collection_change_ratio, cli_latency_info, covered_topk_edgecnt, realnet_option, realnet_expname);
+                covered::edge_wrapper_ptrs[edgeidx] = new covered::CoveredEdgeWrapper(cache_name, capacity_bytes, edgeidx, edgecnt, hash_name, keycnt, covered_local_uncached_capacity_bytes, covered_local_uncached_lru_bytes, percacheserver_workercnt, local_cache_shardcnt, cachelib_nvm_info, cache_server_worker_inflightcnt, perbeaconserver_workercnt, covered_peredge_synced_victimcnt, covered_peredge_monitored_victimsetcnt, covered_popularity_aggregation_capacity_bytes, covered_popularity_collection_change_ratio, cli_latency_info, covered_topk_edgecnt, realnet_option, realnet_expname);
             }
         }
         else
@@ -329,9 +558,9 @@ int main(int argc, char **argv) {
                 }else{
                     tmp_p2p_latency_array = std::vector<uint32_t>(edgecnt, UINT32_MAX);
                 }
-                covered::edge_wrapper_ptrs[edgeidx] = new covered::BasicEdgeWrapper(cache_name, capacity_bytes, edgeidx, edgecnt, hash_name, keycnt, covered_local_uncached_capacity_bytes, covered_local_uncached_lru_bytes, percacheserver_workercnt, covered_peredge_synced_victimcnt, covered_peredge_monitored_victimsetcnt, covered_popularity_aggregation_capacity_bytes, covered_popularity_collection_change_ratio, cli_latency_info, covered_topk_edgecnt, realnet_option, realnet_expname, tmp_p2p_latency_array);
+                covered::edge_wrapper_ptrs[edgeidx] = new covered::BasicEdgeWrapper(cache_name, capacity_bytes, edgeidx, edgecnt, hash_name, keycnt, covered_local_uncached_capacity_bytes, covered_local_uncached_lru_bytes, percacheserver_workercnt, local_cache_shardcnt, cachelib_nvm_info, cache_server_worker_inflightcnt, perbeaconserver_workercnt, covered_peredge_synced_victimcnt, covered_peredge_monitored_victimsetcnt, covered_popularity_aggregation_capacity_bytes, covered_popularity_collection_change_ratio, cli_latency_info, covered_topk_edgecnt, realnet_option, realnet_expname, tmp_p2p_latency_array);
             }else {
-                covered::edge_wrapper_ptrs[edgeidx] = new covered::BasicEdgeWrapper(cache_name, capacity_bytes, edgeidx, edgecnt, hash_name, keycnt, covered_local_uncached_capacity_bytes, covered_local_uncached_lru_bytes, percacheserver_workercnt, covered_peredge_synced_victimcnt, covered_peredge_monitored_victimsetcnt, covered_popularity_aggregation_capacity_bytes, covered_popularity_collection_change_ratio, cli_latency_info, covered_topk_edgecnt, realnet_option, realnet_expname);
+                covered::edge_wrapper_ptrs[edgeidx] = new covered::BasicEdgeWrapper(cache_name, capacity_bytes, edgeidx, edgecnt, hash_name, keycnt, covered_local_uncached_capacity_bytes, covered_local_uncached_lru_bytes, percacheserver_workercnt, local_cache_shardcnt, cachelib_nvm_info, cache_server_worker_inflightcnt, perbeaconserver_workercnt, covered_peredge_synced_victimcnt, covered_peredge_monitored_victimsetcnt, covered_popularity_aggregation_capacity_bytes, covered_popularity_collection_change_ratio, cli_latency_info, covered_topk_edgecnt, realnet_option, realnet_expname);
             }
         }
         
@@ -347,70 +576,87 @@ int main(int argc, char **argv) {
             covered_edge_wrapper_ptr->getWeightTunerRef().setP2PEnable((covered::is_various_latency_distribution_v1 || covered::is_various_latency_distribution_v2));
         }
     }
-    // Initialize for workload generators (refer to src/benchmark/client_wrapper.c::launchClient())
-    // std::cout << "Initialize workload generators for single-node simulation..." << std::endl;
-    // NOTE: if workloadcnt = clientcnt (i.e., perworkload_workercnt = perclient_workercnt), each client has an individual workload generator corresponding to the closest edge node -> here we just use a reasonable workloadcnt to fix the memory issue of large-scale exps (but each client worker ALWAYS has an individual workload worker corresponding to the closest edge node)
-    // NOTE: this is acceptable as we only focus on hit ratios and calculated performance instead of absolute performance in single-node simulator, while we have verified that workloadcnt does NOT affect the simulator results (affect absolute performance yet NOT concerned by single-node simulator)
-    covered::workload_wrapper_ptrs.resize(simulator_workloadcnt, NULL);
-    for (uint32_t workloadidx = 0; workloadidx < simulator_workloadcnt; workloadidx++)
+    // Initialize for epoch-batched simulation if any
+    std::vector<covered::EpochRequest> epoch_requests;
+    covered::EpochLookupWorkerPool epoch_lookup_worker_pool;
+    if (is_epoch_simulation)
     {
-        // NOTE: NOT use ClientWrapper::launchEdge, which will invoke NodeWrapperBase::start() to launch multiple threads for absolute performance!
-        // NOTE: use covered::Util::DATASET_KVPAIR_GENERATION_SEED to generate dataset, use workloadidx to pre-generate workload items to approximate workload distribution (if any), and use global_workload_workeridx + randombase to generate requests for the given workload worker
-        covered::workload_wrapper_ptrs[workloadidx] = covered::WorkloadWrapperBase::getWorkloadGeneratorByWorkloadName(simulator_workloadcnt, workloadidx, keycnt, perclient_opcnt, perworkload_workercnt, workload_name, covered::WorkloadWrapperBase::WORKLOAD_USAGE_ROLE_CLIENT, zipf_alpha, workload_pattern_name, dynamic_change_period, dynamic_change_keycnt, simulator_randomness);
-        assert(covered::workload_wrapper_ptrs[workloadidx] != NULL);
-    }
-
-    // Initialize for client nodes (refer to src/benchmark/client_wrapper.c::launchClient())
-    covered::closest_edge_idxes.resize(clientcnt, 0);
-    for (uint32_t clientidx = 0; clientidx < clientcnt; clientidx++)
-    {
-        // Calculate closest edge node index for each client node (refer to src/benchmark/client_worker_wrapper.c::ClientWorkerWrapper())
-        covered::closest_edge_idxes[clientidx] = covered::Util::getClosestEdgeIdx(clientidx, clientcnt, edgecnt);
-        assert(covered::closest_edge_idxes[clientidx] >= 0);
-        assert(covered::closest_edge_idxes[clientidx] < edgecnt);
+        epoch_requests.reserve(perloop_roundcnt * client_workercnt);
+        epoch_lookup_worker_pool.start(simulator_lookup_threadcnt, edgecnt);
     }
 
     // (3) Warmup phase
 
     // Calculate per-client-worker warmup reqcnt (refer to src/benchmark/evaluator_wrapper.c::checkWarmupStatus_() and src/benchmark/client_worker_wrapper.c::ClientWorkerWrapper())
-    const uint32_t total_warmup_reqcnt = warmup_reqcnt_scale * keycnt;
+    const uint64_t total_warmup_reqcnt = static_cast<uint64_t>(warmup_reqcnt_scale) * static_cast<uint64_t>(keycnt);
     const uint32_t total_client_workercnt = clientcnt * perclient_workercnt;
-    const uint32_t warmup_reqcnt_limit = (total_warmup_reqcnt - 1) / total_client_workercnt + 1; // Get per-client-worker warmup reqcnt limitation
+    const uint32_t warmup_reqcnt_limit = static_cast<uint32_t>((total_warmup_reqcnt - 1) / total_client_workercnt + 1); // Get per-client-worker warmup reqcnt limitation
     assert(warmup_reqcnt_limit > 0);
-    assert(warmup_reqcnt_limit * total_client_workercnt >= total_warmup_reqcnt); // Total # of issued warmup reqs MUST >= total # of required warmup reqs
+    assert(static_cast<uint64_t>(warmup_reqcnt_limit) * total_client_workercnt >= total_warmup_reqcnt); // Total # of issued warmup reqs MUST >= total # of required warmup reqs
 
     // Used to dump warmup statistics per interval
     uint32_t warmup_interval_idx = 0;
     const uint32_t warmup_interval_us = SEC2US(1);
     struct timespec warmup_cur_timestamp = covered::Util::getCurrentTimespec();
     struct timespec warmup_prev_timestamp = warmup_cur_timestamp;
-    uint32_t warmup_interval_reqcnt = 0;
-    uint32_t warmup_interval_local_hitcnt = 0;
-    uint32_t warmup_interval_remote_hitcnt = 0;
+    uint64_t warmup_interval_reqcnt = 0;
+    uint64_t warmup_interval_local_hitcnt = 0;
+    uint64_t warmup_interval_remote_hitcnt = 0;
     uint64_t warmup_interval_latency_sum = 0; // Calculated latency (calculated performance, yet NOT absolute performance)
     covered::BandwidthUsage warmup_interval_bandwidth_usage;
-    uint32_t warmup_total_reqcnt = 0;
+    double warmup_lookup_phase_us = 0.0; // ONLY used for epoch-batched simulation (NOT dumped)
+    double warmup_commit_phase_us = 0.0; // ONLY used for epoch-batched simulation (NOT dumped)
+    uint64_t warmup_total_reqcnt = 0;
 
     // Generate requests via workload generators one by one to simulate cache access
-    for (uint32_t warmup_reqidx = 0; warmup_reqidx < warmup_reqcnt_limit; warmup_reqidx++)
+    for (uint32_t warmup_reqidx = 0; warmup_reqidx < warmup_reqcnt_limit; warmup_reqidx += perloop_roundcnt)
     {
-        // Each client worker needs to generate warmup_reqcnt_limit requests for warmup
-        for (uint32_t clientidx = 0; clientidx < clientcnt; clientidx++)
+        const uint32_t warmup_cur_roundcnt = std::min(perloop_roundcnt, warmup_reqcnt_limit - warmup_reqidx);
+        for (uint32_t warmup_roundidx = 0; warmup_roundidx < warmup_cur_roundcnt; warmup_roundidx++)
         {
-            for (uint32_t local_client_worker_idx = 0; local_client_worker_idx < perclient_workercnt; local_client_worker_idx++)
+            // Each client worker needs to generate warmup_reqcnt_limit requests for warmup
+            for (uint32_t clientidx = 0; clientidx < clientcnt; clientidx++)
             {
-                // Generate workload item by the workload worker to simulate the client worker
-                covered::WorkloadItem cur_workload_item = covered::genWorkloadItemForClientWorker(local_client_worker_idx, clientidx, perclient_workercnt, client_workercnt, perworkload_workercnt, simulator_workloadcnt);
-                
-                covered::processRequest(cur_workload_item, clientidx, cache_name, edgecnt, covered_topk_edgecnt, warmup_interval_reqcnt, warmup_interval_local_hitcnt, warmup_interval_remote_hitcnt, warmup_interval_latency_sum, warmup_interval_bandwidth_usage);
+                for (uint32_t local_client_worker_idx = 0; local_client_worker_idx < perclient_workercnt; local_client_worker_idx++)
+                {
+                    // Generate workload item by the workload worker to simulate the client worker
+                    covered::WorkloadItem cur_workload_item = covered::genWorkloadItemForClientWorker(local_client_worker_idx, clientidx, perclient_workercnt, client_workercnt, perworkload_workercnt, simulator_workloadcnt);
+
+                    if (is_epoch_simulation)
+                    {
+                        epoch_requests.push_back(covered::EpochRequest(cur_workload_item, clientidx));
+                    }
+                    else
+                    {
+                        covered::processRequest(cur_workload_item, clientidx, cache_name, edgecnt, covered_topk_edgecnt, warmup_interval_reqcnt, warmup_interval_local_hitcnt, warmup_interval_remote_hitcnt, warmup_interval_latency_sum, warmup_interval_bandwidth_usage);
+                    }
+                }
             }
         }
+        if (is_epoch_simulation)
+        {
+            covered::processEpoch(epoch_requests, epoch_lookup_worker_pool, cache_name, edgecnt, covered_topk_edgecnt, warmup_interval_reqcnt, warmup_interval_local_hitcnt, warmup_interval_remote_hitcnt, warmup_interval_latency_sum, warmup_interval_bandwidth_usage, warmup_lookup_phase_us, warmup_commit_phase_us);
+        }
 
-        // Calculate delta time to determine whether to dump warmup statistics during current interval
-        warmup_cur_timestamp = covered::Util::getCurrentTimespec();
-        double warmup_delta_us = covered::Util::getDeltaTimeUs(warmup_cur_timestamp, warmup_prev_timestamp);
-        if (warmup_delta_us >= static_cast<double>(warmup_interval_us))
+        // Determine whether to dump warmup statistics during current interval (by reqcnt for wall-clock-independent simulation, or by delta time otherwise)
+        bool is_dump_warmup_interval = false;
+        if (is_reqcnt_driven)
+        {
+            is_dump_warmup_interval = (warmup_interval_reqcnt >= simulator_interval_reqcnt);
+        }
+        else
         {
+            warmup_cur_timestamp = covered::Util::getCurrentTimespec();
+            is_dump_warmup_interval = (covered::Util::getDeltaTimeUs(warmup_cur_timestamp, warmup_prev_timestamp) >= static_cast<double>(warmup_interval_us));
+        }
+        if (is_dump_warmup_interval)
+        {
+            if (is_reqcnt_driven)
+            {
+                warmup_cur_timestamp = covered::Util::getCurrentTimespec(); // NOTE: ONLY for simulation throughput, which does NOT affect simulator results
+            }
+            const double warmup_delta_us = covered::Util::getDeltaTimeUs(warmup_cur_timestamp, warmup_prev_timestamp);
+
             // Update warmup total statistics
             warmup_total_reqcnt += warmup_interval_reqcnt;
 
@@ -421,6 +667,7 @@ int main(int argc, char **argv) {
             std::ostringstream oss;
             oss << "[Warmup Statistics at Interval " << warmup_interval_idx << "]" << std::endl;
             oss << "Total reqcnt: " << warmup_total_reqcnt << std::endl;
+            oss << "Simulation throughput (reqs/s): " << covered::getSimulationThroughput(warmup_interval_reqcnt, warmup_delta_us) << std::endl;
             oss << warmup_interval_statistics_string << std::endl << std::endl;
             std::cout << oss.str() << std::flush;
 
@@ -444,34 +691,76 @@ int main(int argc, char **argv) {
     struct timespec stresstest_start_timestamp = covered::Util::getCurrentTimespec();
     struct timespec stresstest_cur_timestamp = stresstest_start_timestamp;
     struct timespec stresstest_prev_timestamp = stresstest_start_timestamp;
-    uint32_t stresstest_total_reqcnt = 0;
-    uint32_t stresstest_total_local_hitcnt = 0;
-    uint32_t stresstest_total_remote_hitcnt = 0;
+    uint64_t stresstest_total_reqcnt = 0;
+    uint64_t stresstest_total_local_hitcnt = 0;
+    uint64_t stresstest_total_remote_hitcnt = 0;
     uint64_t stresstest_total_latency_sum = 0; // Calculated latency (calculated performance, yet NOT absolute performance)
     covered::BandwidthUsage stresstest_total_bandwidth_usage;
+    uint64_t stresstest_issued_reqcnt = 0; // ONLY used for wall-clock-independent simulation
+    uint64_t stresstest_prev_reqcnt = 0; // Total reqcnt at the previous dump
+    double stresstest_lookup_phase_us = 0.0; // ONLY used for epoch-batched simulation
+    double stresstest_commit_phase_us = 0.0; // ONLY used for epoch-batched simulation
 
-    // Generate requests via workload generators one by one to simulate cache access until stresstest duration finishes
+    // Generate requests via workload generators one by one to simulate cache access until stresstest duration (or stresstest reqcnt) finishes
     while (true)
     {
-        // Each client worker continues to generate requests for stresstest
-        for (uint32_t clientidx = 0; clientidx < clientcnt; clientidx++)
+        bool is_issue_finish = false; // ONLY set for wall-clock-independent simulation
+        for (uint32_t stresstest_roundidx = 0; stresstest_roundidx < perloop_roundcnt && !is_issue_finish; stresstest_roundidx++)
         {
-            for (uint32_t local_client_worker_idx = 0; local_client_worker_idx < perclient_workercnt; local_client_worker_idx++)
+            // Each client worker continues to generate requests for stresstest
+            for (uint32_t clientidx = 0; clientidx < clientcnt && !is_issue_finish; clientidx++)
             {
-                // Generate workload item by the workload worker to simulate the client worker
-                covered::WorkloadItem cur_workload_item = covered::genWorkloadItemForClientWorker(local_client_worker_idx, clientidx, perclient_workercnt, client_workercnt, perworkload_workercnt, simulator_workloadcnt);
-                
-                covered::processRequest(cur_workload_item, clientidx, cache_name, edgecnt, covered_topk_edgecnt, stresstest_total_reqcnt, stresstest_total_local_hitcnt, stresstest_total_remote_hitcnt, stresstest_total_latency_sum, stresstest_total_bandwidth_usage);
+                for (uint32_t local_client_worker_idx = 0; local_client_worker_idx < perclient_workercnt && !is_issue_finish; local_client_worker_idx++)
+                {
+                    // Generate workload item by the workload worker to simulate the client worker
+                    covered::WorkloadItem cur_workload_item = covered::genWorkloadItemForClientWorker(local_client_worker_idx, clientidx, perclient_workercnt, client_workercnt, perworkload_workercnt, simulator_workloadcnt);
+
+                    if (is_epoch_simulation)
+                    {
+                        epoch_requests.push_back(covered::EpochRequest(cur_workload_item, clientidx));
+                    }
+                    else
+                    {
+                        covered::processRequest(cur_workload_item, clientidx, cache_name, edgecnt, covered_topk_edgecnt, stresstest_total_reqcnt, stresstest_total_local_hitcnt, stresstest_total_remote_hitcnt, stresstest_total_latency_sum, stresstest_total_bandwidth_usage);
+                    }
+
+                    stresstest_issued_reqcnt += 1;
+                    if (is_reqcnt_driven && stresstest_issued_reqcnt >= simulator_stresstest_reqcnt)
+                    {
+                        is_issue_finish = true;
+                    }
+                }
             }
         }
+        if (is_epoch_simulation)
+        {
+            covered::processEpoch(epoch_requests, epoch_lookup_worker_pool, cache_name, edgecnt, covered_topk_edgecnt, stresstest_total_reqcnt, stresstest_total_local_hitcnt, stresstest_total_remote_hitcnt, stresstest_total_latency_sum, stresstest_total_bandwidth_usage, stresstest_lookup_phase_us, stresstest_commit_phase_us);
+        }
 
-        // Calculate delta time to determine whether to dump stresstest statistics until the current interval
-        stresstest_cur_timestamp = covered::Util::getCurrentTimespec();
-        double stresstest_delta_us = covered::Util::getDeltaTimeUs(stresstest_cur_timestamp, stresstest_prev_timestamp);
-        double stresstest_whole_us = covered::Util::getDeltaTimeUs(stresstest_cur_timestamp, stresstest_start_timestamp);
-        if (stresstest_delta_us >= static_cast<double>(stresstest_interval_us) || stresstest_whole_us >= static_cast<double>(SEC2US(stresstest_duration_sec)))
+        // Determine whether to dump stresstest statistics until the current interval (by reqcnt for wall-clock-independent simulation, or by delta time otherwise)
+        bool is_finish = false;
+        bool is_dump_stresstest_interval = false;
+        if (is_reqcnt_driven)
+        {
+            is_finish = is_issue_finish;
+            is_dump_stresstest_interval = is_finish || (stresstest_total_reqcnt - stresstest_prev_reqcnt >= simulator_interval_reqcnt);
+        }
+        else
+        {
+            stresstest_cur_timestamp = covered::Util::getCurrentTimespec();
+            double stresstest_delta_us = covered::Util::getDeltaTimeUs(stresstest_cur_timestamp, stresstest_prev_timestamp);
+            double stresstest_whole_us = covered::Util::getDeltaTimeUs(stresstest_cur_timestamp, stresstest_start_timestamp);
+            is_finish = stresstest_whole_us >= static_cast<double>(SEC2US(stresstest_duration_sec));
+            is_dump_stresstest_interval = is_finish || stresstest_delta_us >= static_cast<double>(stresstest_interval_us);
+        }
+        if (is_dump_stresstest_interval)
         {
-            const bool is_finish = stresstest_whole_us >= static_cast<double>(SEC2US(stresstest_duration_sec));
+            if (is_reqcnt_driven)
+            {
+                stresstest_cur_timestamp = covered::Util::getCurrentTimespec(); // NOTE: ONLY for simulation throughput, which does NOT affect simulator results
+            }
+            const double stresstest_delta_us = covered::Util::getDeltaTimeUs(stresstest_cur_timestamp, stresstest_prev_timestamp);
+            const double stresstest_whole_us = covered::Util::getDeltaTimeUs(stresstest_cur_timestamp, stresstest_start_timestamp);
 
             // Get stresstest total statistics string
             std::string stresstest_total_statistics_string = covered::getStatisticsString(stresstest_total_reqcnt, stresstest_total_local_hitcnt, stresstest_total_remote_hitcnt, stresstest_total_latency_sum, stresstest_total_bandwidth_usage);
@@ -486,11 +775,18 @@ int main(int argc, char **argv) {
             {
                 oss << "[Final Stresstest Statistics]" << std::endl;
             }
+            oss << "Simulation throughput (reqs/s): " << covered::getSimulationThroughput(stresstest_total_reqcnt - stresstest_prev_reqcnt, stresstest_delta_us) << " (interval) / " << covered::getSimulationThroughput(stresstest_total_reqcnt, stresstest_whole_us) << " (overall)" << std::endl;
+            if (is_epoch_simulation)
+            {
+                // NOTE: ONLY lookup phase runs on simulator_lookup_threadcnt threads, while commit phase is serial on the main thread
+                oss << "Epoch phase time (s) w/ " << simulator_lookup_threadcnt << " lookup threads: " << stresstest_lookup_phase_us / 1000000.0 << " (lookup) / " << stresstest_commit_phase_us / 1000000.0 << " (commit)" << std::endl;
+            }
             oss << stresstest_total_statistics_string << std::endl << std::endl;
             std::cout << oss.str() << std::flush;
 
             // Reset stresstest statistics
             stresstest_prev_timestamp = stresstest_cur_timestamp;
+            stresstest_prev_reqcnt = stresstest_total_reqcnt;
 
             stresstest_interval_idx += 1;
             if (is_finish)
@@ -504,6 +800,11 @@ int main(int argc, char **argv) {
 
     // (5) Free global variables
 
+    if (is_epoch_simulation)
+    {
+        epoch_lookup_worker_pool.stop();
+    }
+
     for (uint32_t edgeidx = 0; edgeidx < edgecnt; edgeidx++)
     {
         assert(covered::edge_wrapper_ptrs[edgeidx] != NULL);
@@ -835,6 +1136,149 @@ namespace covered
 
         return;
     }
+
+    // EpochRequest
+
+    EpochRequest::EpochRequest(const WorkloadItem& given_workload_item, const uint32_t& given_clientidx) : workload_item(given_workload_item), clientidx(given_clientidx), is_looked_up(false)
+    {
+        lookup.is_local_cached_and_valid = false;
+        lookup.affect_victim_tracker = false;
+    }
+
+    // EpochLookupWorkerPool
+
+    EpochLookupWorkerPool::EpochLookupWorkerPool() : threadcnt(0), edgecnt(0), epoch_requests_ptr(NULL), epoch_generation(0), pending_helper_threadcnt(0), is_stop(false)
+    {
+    }
+
+    void EpochLookupWorkerPool::start(const uint32_t& given_threadcnt, const uint32_t& given_edgecnt)
+    {
+        assert(given_threadcnt > 0);
+        assert(helper_thread_ptrs.size() == 0);
+
+        // NOTE: NO need more threads than edge nodes, as each edge node is owned by a single thread
+        threadcnt = std::min(given_threadcnt, given_edgecnt);
+        edgecnt = given_edgecnt;
+        peredge_reqidxes.resize(edgecnt);
+
+        for (uint32_t threadidx = 1; threadidx < threadcnt; threadidx++)
+        {
+            std::thread* tmp_thread_ptr = new std::thread(&EpochLookupWorkerPool::helperThreadLoop_, this, threadidx);
+            assert(tmp_thread_ptr != NULL);
+            helper_thread_ptrs.push_back(tmp_thread_ptr);
+        }
+
+        return;
+    }
+
+    void EpochLookupWorkerPool::runLookupPhase(std::vector<EpochRequest>& epoch_requests)
+    {
+        // Assign GET requests to the owner threads of their closest edge nodes in the canonical order
+        for (uint32_t edgeidx = 0; edgeidx < edgecnt; edgeidx++)
+        {
+            peredge_reqidxes[edgeidx].clear();
+        }
+        for (uint32_t reqidx = 0; reqidx < epoch_requests.size(); reqidx++)
+        {
+            if (epoch_requests[reqidx].workload_item.getItemType() == WorkloadItemType::kWorkloadItemGet)
+            {
+                peredge_reqidxes[getClosestEdgeidx(epoch_requests[reqidx].clientidx)].push_back(reqidx);
+            }
+        }
+        epoch_requests_ptr = &epoch_requests;
+
+        // Wake up helper threads
+        if (threadcnt > 1)
+        {
+            std::unique_lock<std::mutex> epoch_lock(epoch_mutex);
+            pending_helper_threadcnt = threadcnt - 1;
+            epoch_generation += 1;
+            epoch_start_cv.notify_all();
+        }
+
+        // Main thread works as thread 0
+        lookupForThread_(0);
+
+        // Wait for helper threads
+        if (threadcnt > 1)
+        {
+            std::unique_lock<std::mutex> epoch_lock(epoch_mutex);
+            epoch_finish_cv.wait(epoch_lock, [this]() { return pending_helper_threadcnt == 0; });
+        }
+
+        epoch_requests_ptr = NULL;
+        return;
+    }
+
+    void EpochLookupWorkerPool::stop()
+    {
+        {
+            std::unique_lock<std::mutex> epoch_lock(epoch_mutex);
+            is_stop = true;
+            epoch_start_cv.notify_all();
+        }
+
+        for (uint32_t i = 0; i < helper_thread_ptrs.size(); i++)
+        {
+            assert(helper_thread_ptrs[i] != NULL);
+            helper_thread_ptrs[i]->join();
+            delete helper_thread_ptrs[i];
+            helper_thread_ptrs[i] = NULL;
+        }
+        helper_thread_ptrs.clear();
+
+        return;
+    }
+
+    void EpochLookupWorkerPool::lookupForThread_(const uint32_t& threadidx)
+    {
+        assert(epoch_requests_ptr != NULL);
+
+        // NOTE: each edge node is ONLY accessed by its owner thread in lookup phase, and the lookups of the same edge node follow the canonical order -> deterministic regardless of threadcnt
+        for (uint32_t edgeidx = threadidx; edgeidx < edgecnt; edgeidx += threadcnt)
+        {
+            const std::vector<uint32_t>& tmp_reqidxes = peredge_reqidxes[edgeidx];
+            for (uint32_t i = 0; i < tmp_reqidxes.size(); i++)
+            {
+                EpochRequest& tmp_epoch_request = (*epoch_requests_ptr)[tmp_reqidxes[i]];
+                lookupClosestCache(tmp_epoch_request.workload_item.getKey(), tmp_epoch_request.clientidx, tmp_epoch_request.lookup);
+                tmp_epoch_request.is_looked_up = true;
+            }
+        }
+
+        return;
+    }
+
+    void EpochLookupWorkerPool::helperThreadLoop_(const uint32_t& threadidx)
+    {
+        uint64_t finished_generation = 0;
+        while (true)
+        {
+            {
+                std::unique_lock<std::mutex> epoch_lock(epoch_mutex);
+                epoch_start_cv.wait(epoch_lock, [this, &finished_generation]() { return is_stop || epoch_generation != finished_generation; });
+                if (is_stop)
+                {
+                    break;
+                }
+                finished_generation = epoch_generation;
+            }
+
+            lookupForThread_(threadidx);
+
+            {
+                std::unique_lock<std::mutex> epoch_lock(epoch_mutex);
+                assert(pending_helper_threadcnt > 0);
+                pending_helper_threadcnt -= 1;
+                if (pending_helper_threadcnt == 0)
+                {
+                    epoch_finish_cv.notify_one();
+                }
+            }
+        }
+
+        return;
+    }
 }
 
 namespace covered
@@ -915,7 +1359,7 @@ namespace covered
         return closest_edge_idx == beacon_edge_idx;
     }
 
-    std::string getStatisticsString(const uint32_t& reqcnt, const uint32_t& local_hitcnt, const uint32_t& remote_hitcnt, const uint64_t& latency_sum, const BandwidthUsage& bandwidth_usage)
+    std::string getStatisticsString(const uint64_t& reqcnt, const uint64_t& local_hitcnt, const uint64_t& remote_hitcnt, const uint64_t& latency_sum, const BandwidthUsage& bandwidth_usage)
     {
         // Calculate hit ratio and latency statistics
         double local_hitratio = static_cast<double>(local_hitcnt) / static_cast<double>(reqcnt);
@@ -961,9 +1405,18 @@ namespace covered
         return oss.str();
     }
 
+    double getSimulationThroughput(const uint64_t& reqcnt, const double& delta_us)
+    {
+        if (delta_us <= 0.0)
+        {
+            return 0.0;
+        }
+        return static_cast<double>(reqcnt) / delta_us * static_cast<double>(SEC2US(1));
+    }
+
     // (2) Common helper functions
 
-    void processRequest(const WorkloadItem& cur_workload_item, const uint32_t& clientidx, const std::string& cache_name, const uint32_t& edgecnt, const uint32_t& covered_topk_edgecnt, uint32_t& reqcnt, uint32_t& local_hitcnt, uint32_t& remote_hitcnt, uint64_t& latency_sum_us, BandwidthUsage& bandwidth_usage)
+    void processRequest(const WorkloadItem& cur_workload_item, const uint32_t& clientidx, const std::string& cache_name, const uint32_t& edgecnt, const uint32_t& covered_topk_edgecnt, uint64_t& reqcnt, uint64_t& local_hitcnt, uint64_t& remote_hitcnt, uint64_t& latency_sum_us, BandwidthUsage& bandwidth_usage, const ClosestCacheLookup* prelookup_ptr)
     {
         WorkloadItemType cur_workload_item_type = cur_workload_item.getItemType();
         Key cur_key = cur_workload_item.getKey();
@@ -1002,7 +1455,18 @@ namespace covered
         if (cur_workload_item_type == WorkloadItemType::kWorkloadItemGet)
         {
             // Access local cache in the closest edge node for local hit/miss (update cache statistics in the closest edge node) (refer to src/edge/cache_server/basic_edge_wrapper.c::getLocalEdgeCache_())
-            bool is_local_cached_and_valid = accessClosestCache(cur_key, clientidx, cache_name, fetched_value);
+            bool is_local_cached_and_valid = false;
+            if (prelookup_ptr == NULL)
+            {
+                is_local_cached_and_valid = accessClosestCache(cur_key, clientidx, cache_name, fetched_value);
+            }
+            else
+            {
+                // NOTE: local cache has been accessed in lookup phase of epoch-batched simulation -> ONLY perform the deferred victim/vtime synchronization in commit phase
+                is_local_cached_and_valid = prelookup_ptr->is_local_cached_and_valid;
+                fetched_value = prelookup_ptr->fetched_value;
+                syncClosestEdgeAfterLookup(clientidx, cache_name, prelookup_ptr->affect_victim_tracker);
+            }
             local_access_latency_us = curclient_closest_edge_wrapper_ptr->getEdgeToclientPropagationSimulatorParamPtr()->genPropagationLatency(); // RTT: including both client-to-edge req and edge-to-client rsp
 
             // Check if any other edge node caches the object
@@ -1213,14 +1677,52 @@ namespace covered
         return;
     }
 
+    void processEpoch(std::vector<EpochRequest>& epoch_requests, EpochLookupWorkerPool& lookup_worker_pool, const std::string& cache_name, const uint32_t& edgecnt, const uint32_t& covered_topk_edgecnt, uint64_t& reqcnt, uint64_t& local_hitcnt, uint64_t& remote_hitcnt, uint64_t& latency_sum_us, BandwidthUsage& bandwidth_usage, double& lookup_phase_us, double& commit_phase_us)
+    {
+        // Lookup phase: access local caches of different edge nodes in parallel
+        struct timespec lookup_start_timestamp = Util::getCurrentTimespec();
+        lookup_worker_pool.runLookupPhase(epoch_requests);
+        struct timespec commit_start_timestamp = Util::getCurrentTimespec();
+        lookup_phase_us += Util::getDeltaTimeUs(commit_start_timestamp, lookup_start_timestamp);
+
+        // Commit phase: process cross-edge interactions of each request one by one in the canonical order
+        for (uint32_t reqidx = 0; reqidx < epoch_requests.size(); reqidx++)
+        {
+            const EpochRequest& tmp_epoch_request = epoch_requests[reqidx];
+            const ClosestCacheLookup* tmp_prelookup_ptr = tmp_epoch_request.is_looked_up ? &tmp_epoch_request.lookup : NULL;
+            processRequest(tmp_epoch_request.workload_item, tmp_epoch_request.clientidx, cache_name, edgecnt, covered_topk_edgecnt, reqcnt, local_hitcnt, remote_hitcnt, latency_sum_us, bandwidth_usage, tmp_prelookup_ptr);
+        }
+        commit_phase_us += Util::getDeltaTimeUs(Util::getCurrentTimespec(), commit_start_timestamp);
+
+        epoch_requests.clear();
+        return;
+    }
+
     bool accessClosestCache(const Key& cur_key, const uint32_t& clientidx, const std::string& cache_name, Value& fetched_value)
     {
-        const uint32_t closest_edgeidx = getClosestEdgeidx(clientidx);
+        ClosestCacheLookup lookup;
+        lookupClosestCache(cur_key, clientidx, lookup);
+        fetched_value = lookup.fetched_value;
+
+        syncClosestEdgeAfterLookup(clientidx, cache_name, lookup.affect_victim_tracker);
+
+        return lookup.is_local_cached_and_valid;
+    }
+
+    void lookupClosestCache(const Key& cur_key, const uint32_t& clientidx, ClosestCacheLookup& lookup)
+    {
         CacheWrapper* curclient_closest_edge_cache_wrapper_ptr = getClosestEdgeCacheWrapperPtr(clientidx);
 
         bool closest_edge_is_redirected = false;
-        bool affect_victim_tracker = false;
-        bool is_local_cached_and_valid = curclient_closest_edge_cache_wrapper_ptr->get(cur_key, closest_edge_is_redirected, fetched_value, affect_victim_tracker);
+        lookup.affect_victim_tracker = false;
+        lookup.is_local_cached_and_valid = curclient_closest_edge_cache_wrapper_ptr->get(cur_key, closest_edge_is_redirected, lookup.fetched_value, lookup.affect_victim_tracker);
+
+        return;
+    }
+
+    void syncClosestEdgeAfterLookup(const uint32_t& clientidx, const std::string& cache_name, const bool& affect_victim_tracker)
+    {
+        const uint32_t closest_edgeidx = getClosestEdgeidx(clientidx);
 
         if (cache_name == Util::COVERED_CACHE_NAME && affect_victim_tracker)
         {
@@ -1233,7 +1735,7 @@ namespace covered
             bestguessVtimeSynchronizationForEdge(closest_edgeidx);
         }
 
-        return is_local_cached_and_valid;
+        return;
     }
 
     void writeClosestCache(const Key& cur_key, const Value& fetched_value, const uint32_t& clientidx, const std::string& cache_name, const WorkloadItemType& cur_workload_item_type, bool& is_evict, uint32_t& victim_cnt)
@@ -1839,6 +2341,142 @@ namespace covered
         return directory_update_latency_us;
     }
 
+    // (2.5) Helper functions for MRC profiling
+
+    void mrcProcessRequest(const WorkloadItem& cur_workload_item, const bool& is_counted, ShardsMrcProfiler& lru_profiler, std::vector<MrcMinicache>& minicaches)
+    {
+        const WorkloadItemType cur_workload_item_type = cur_workload_item.getItemType();
+        const Key cur_key = cur_workload_item.getKey();
+        const uint32_t cur_objsize = cur_key.getKeyLength() + cur_workload_item.getValue().getValuesize();
+        const uint32_t cur_charged_objsize = static_cast<uint32_t>(LruCache::getObjsizeForCapacity(cur_key, cur_workload_item.getValue())); // Including per-object metadata charged by LRU local cache
+
+        // LRU by reuse distances (NOTE: ONLY GET requests are counted for hit ratios, as writes MUST be cache misses; writes are modeled as write-allocate)
+        if (cur_workload_item_type == WorkloadItemType::kWorkloadItemDel)
+        {
+            lru_profiler.remove(cur_key);
+        }
+        else
+        {
+            lru_profiler.access(cur_key, cur_objsize, cur_charged_objsize, is_counted && cur_workload_item_type == WorkloadItemType::kWorkloadItemGet);
+        }
+
+        // Other policies by mini-caches
+        for (uint32_t i = 0; i < minicaches.size(); i++)
+        {
+            if (ShardsMrcProfiler::isSampled(cur_key, minicaches[i].sample_ratio))
+            {
+                mrcAccessMinicache(cur_workload_item, is_counted, minicaches[i]);
+            }
+        }
+
+        return;
+    }
+
+    void mrcAccessMinicache(const WorkloadItem& cur_workload_item, const bool& is_counted, MrcMinicache& minicache)
+    {
+        const WorkloadItemType cur_workload_item_type = cur_workload_item.getItemType();
+        const Key cur_key = cur_workload_item.getKey();
+        const Value cur_value = cur_workload_item.getValue();
+        CacheWrapper* cache_wrapper_ptr = minicache.edge_wrapper_ptr->getEdgeCachePtr();
+        assert(cache_wrapper_ptr != NULL);
+
+        bool affect_victim_tracker = false;
+        const bool is_global_cached = false; // NO other cache in MRC profiling
+        if (cur_workload_item_type == WorkloadItemType::kWorkloadItemGet)
+        {
+            Value fetched_value;
+            const bool is_redirected = false;
+            const bool is_local_cached_and_valid = cache_wrapper_ptr->get(cur_key, is_redirected, fetched_value, affect_victim_tracker);
+            if (is_counted)
+            {
+                const uint32_t cur_objsize = cur_key.getKeyLength() + cur_value.getValuesize();
+                minicache.sampled_reqcnt += 1;
+                minicache.sampled_bytes += cur_objsize;
+                if (is_local_cached_and_valid)
+                {
+                    minicache.hitcnt += 1;
+                    minicache.hit_bytes += cur_objsize;
+                }
+            }
+
+            // Admit the dataset value of the missed object by the independent admission policy (refer to triggerCacheManagement() for baselines)
+            if (!is_local_cached_and_valid && !cache_wrapper_ptr->isLocalCached(cur_key) && cache_wrapper_ptr->needIndependentAdmit(cur_key, cur_value))
+            {
+                const bool is_neighbor_cached = false;
+                const bool is_valid = true;
+                cache_wrapper_ptr->admit(cur_key, cur_value, is_neighbor_cached, is_valid, minicache.edge_wrapper_ptr->getNodeIdx(), affect_victim_tracker);
+                mrcEvictForCapacity(minicache.edge_wrapper_ptr);
+            }
+        }
+        else if (cur_workload_item_type == WorkloadItemType::kWorkloadItemPut)
+        {
+            // NOTE: update() ONLY updates cached objects, yet NOT admit new ones
+            cache_wrapper_ptr->update(cur_key, cur_value, is_global_cached, affect_victim_tracker);
+            mrcEvictForCapacity(minicache.edge_wrapper_ptr);
+        }
+        else
+        {
+            cache_wrapper_ptr->remove(cur_key, is_global_cached, affect_victim_tracker);
+        }
+
+        return;
+    }
+
+    void mrcEvictForCapacity(EdgeWrapperBase* edge_wrapper_ptr)
+    {
+        // Refer to evictForCapacity() yet w/o global cached information
+        assert(edge_wrapper_ptr != NULL);
+        CacheWrapper* edge_cache_wrapper_ptr = edge_wrapper_ptr->getEdgeCachePtr();
+        assert(edge_cache_wrapper_ptr != NULL);
+
+        while (true) // Evict until used bytes <= capacity bytes
+        {
+            uint64_t used_bytes = edge_wrapper_ptr->getSizeForCapacity();
+            uint64_t capacity_bytes = edge_wrapper_ptr->getCapacityBytes();
+            if (used_bytes <= capacity_bytes)
+            {
+                break;
+            }
+
+            std::unordered_map<Key, Value, KeyHasher> tmp_victims;
+            edge_cache_wrapper_ptr->evict(tmp_victims, used_bytes - capacity_bytes);
+        }
+
+        return;
+    }
+
+    std::string getMrcStatisticsString(const std::string& cache_name, const std::vector<uint64_t>& capacities_bytes, const ShardsMrcProfiler& lru_profiler, const std::vector<MrcMinicache>& minicaches)
+    {
+        // Dump markdown string to help collect statistics
+        std::ostringstream oss;
+        oss << "NOTE: one-pass LRU columns (reuse distances) model writes as write-allocate, while " << cache_name << " columns (mini-caches) ONLY update cached objects for writes as the simulator" << std::endl;
+        oss << "LRU sampled reqcnt: " << lru_profiler.getSampledReqcnt() << std::endl;
+        oss << "| Capacity (MiB) | One-pass LRU Hit Ratio (%) | One-pass LRU Byte Hit Ratio (%) |";
+        if (minicaches.size() > 0)
+        {
+            oss << " " << cache_name << " Hit Ratio (%) | " << cache_name << " Byte Hit Ratio (%) | " << cache_name << " Sample Ratio | " << cache_name << " Sampled Reqcnt |";
+        }
+        oss << std::endl;
+        for (uint32_t i = 0; i < capacities_bytes.size(); i++)
+        {
+            oss << "| " << B2MB(static_cast<double>(capacities_bytes[i])) << " | " << lru_profiler.getHitRatio(i) * 100 << " | " << lru_profiler.getByteHitRatio(i) * 100 << " |";
+            if (minicaches.size() > 0)
+            {
+                assert(minicaches.size() == capacities_bytes.size());
+                const MrcMinicache& tmp_minicache = minicaches[i];
+                const double tmp_hitratio = (tmp_minicache.sampled_reqcnt == 0) ? 0.0 : static_cast<double>(tmp_minicache.hitcnt) / static_cast<double>(tmp_minicache.sampled_reqcnt);
+                const double tmp_byte_hitratio = (tmp_minicache.sampled_bytes == 0) ? 0.0 : static_cast<double>(tmp_minicache.hit_bytes) / static_cast<double>(tmp_minicache.sampled_bytes);
+                oss << " " << tmp_hitratio * 100 << " | " << tmp_byte_hitratio * 100 << " | " << tmp_minicache.sample_ratio << " | " << tmp_minicache.sampled_reqcnt << " |";
+            }
+            if (i + 1 < capacities_bytes.size())
+            {
+                oss << std::endl;
+            }
+        }
+
+        return oss.str();
+    }
+
     // (3) COVERED's helper functions
 
     bool coveredTryPopularityAggregationForClosestEdge(const Key& cur_key, const uint32_t& clientidx)
@@ -1848,7 +2486,7 @@ namespace covered
 
         // Check if the object is tracked by local uncached metadata in the closest cache node for COVERED (NOTE: already update value-related statistics even if it is the first request on the object) (refer to src/edge/cache_server/covered_edge_wrapper.c::getLocalEdgeCache_())
         GetCollectedPopularityParam tmp_param(cur_key);
-        curclient_closest_edge_cache_wrapper_ptr->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param);
+        curclient_closest_edge_cache_wrapper_ptr->constCustomFunc(&tmp_param);
         const CollectedPopularity tmp_collected_popularity_after_fetch_value = tmp_param.getCollectedPopularityRef();
         const bool is_tracked_after_fetch_value = tmp_collected_popularity_after_fetch_value.isTracked();
         // print popularity for debug
@@ -1888,7 +2526,7 @@ namespace covered
         else
         {
             GetLocalSyncedVictimCacheinfosParam tmp_param;
-            given_edge_cache_wrapper_ptr->constCustomFunc(GetLocalSyncedVictimCacheinfosParam::FUNCNAME, &tmp_param); // NOTE: victim cacheinfos from local edge cache MUST be complete
+            given_edge_cache_wrapper_ptr->constCustomFunc(&tmp_param); // NOTE: victim cacheinfos from local edge cache MUST be complete
             
             peredge_evictinfo.updateEvictinfo(given_edgeidx, local_cache_margin_bytes, tmp_param.getVictimCacheinfosConstRef());
         }
@@ -2547,7 +3185,7 @@ namespace covered
         assert(notify_edge_cache_wrapper_ptr != NULL);
 
         UpdateIsNeighborCachedFlagFuncParam tmp_param(cur_key, is_neighbor_cached);
-        notify_edge_cache_wrapper_ptr->customFunc(UpdateIsNeighborCachedFlagFuncParam::FUNCNAME, &tmp_param);
+        notify_edge_cache_wrapper_ptr->customFunc(&tmp_param);
 
         return;
     }
@@ -2562,7 +3200,7 @@ namespace covered
 
         // Get local victim vtime for vtime synchronization
         GetLocalVictimVtimeFuncParam tmp_param_for_vtimesync;
-        edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(GetLocalVictimVtimeFuncParam::FUNCNAME, &tmp_param_for_vtimesync);
+        edge_wrapper_ptr->getEdgeCachePtr()->constCustomFunc(&tmp_param_for_vtimesync);
         const uint64_t& local_victim_vtime = tmp_param_for_vtimesync.getLocalVictimVtimeRef();
 
         // Update vtime for the given edge node
@@ -2654,7 +3292,7 @@ namespace covered
 
             // Check if the object is tracked by local uncached metadata in the closest cache node for COVERED, which caches directory information for tracked objects
             GetCollectedPopularityParam tmp_param(cur_key);
-            curclient_closest_edge_cache_wrapper_ptr->constCustomFunc(GetCollectedPopularityParam::FUNCNAME, &tmp_param);
+            curclient_closest_edge_cache_wrapper_ptr->constCustomFunc(&tmp_param);
             const CollectedPopularity tmp_collected_popularity_before_content_discovery = tmp_param.getCollectedPopularityRef();
             const bool is_tracked_before_content_discovery = tmp_collected_popularity_before_content_discovery.isTracked();
 
@@ -422,6 +422,10 @@ namespace covered
         oss << "total cross-edge data message count: " << cross_edge_data_msgcnt << std::endl;
         const uint64_t edge_cloud_msgcnt = total_bandwidth_usage_.getEdgeCloudMsgcnt();
         oss << "total edge-cloud (must data) message count: " << edge_cloud_msgcnt << std::endl;
+        const uint64_t coalesced_reqcnt = total_bandwidth_usage_.getCoalescedReqcnt();
+        oss << "total coalesced (single-flight) local get request count: " << coalesced_reqcnt << std::endl;
+        const double coalesced_saved_bwusage = B2MB(static_cast<double>(total_bandwidth_usage_.getCoalescedSavedBandwidthBytes()));
+        oss << "total coalesced (single-flight) saved cross-edge and edge-cloud bandwidth usage: " << coalesced_saved_bwusage << " MiB" << std::endl;
         if (total_reqcnt_ > 0)
         {
             oss << "per-request client-edge (must data) bandwidth usage: " << client_edge_bwusage / static_cast<double>(total_reqcnt_) << " MiB/req" << std::endl;
@@ -446,7 +450,7 @@ namespace covered
     uint32_t AggregatedStatisticsBase::getAggregatedStatisticsIOSize()
     {
         // Aggregated statistics for object hit ratio + byte hit ratio + latency + read-write ratio + cache utilization + workload key-value size + bandwidth usgae
-        return sizeof(uint32_t) * 3 + sizeof(double) * 3 + sizeof(uint32_t) * 7 + sizeof(uint32_t) * 2 + sizeof(uint64_t) * 2 + 8 * sizeof(double) + BandwidthUsage::getBandwidthUsagePayloadSize();
+        return sizeof(uint32_t) * 3 + sizeof(double) * 3 + sizeof(uint32_t) * 7 + LatencyHistogram::getLatencyHistogramIOSize() + sizeof(uint32_t) * 2 + sizeof(uint64_t) * 2 + 8 * sizeof(double) + BandwidthUsage::getBandwidthUsagePayloadSize();
     }
 
     uint32_t AggregatedStatisticsBase::serialize(DynamicArray& dynamic_array, const uint32_t& position) const
@@ -484,6 +488,8 @@ namespace covered
         size += sizeof(uint32_t);
         dynamic_array.deserialize(size, (const char*)&max_latency_, sizeof(uint32_t));
         size += sizeof(uint32_t);
+        uint32_t latency_histogram_serialize_size = latency_histogram_.serialize(dynamic_array, size);
+        size += latency_histogram_serialize_size;
 
         // Serialize aggregated statistics for read-write ratio
         dynamic_array.deserialize(size, (const char*)&total_readcnt_, sizeof(uint32_t));
@@ -557,6 +563,8 @@ namespace covered
         size += sizeof(uint32_t);
         dynamic_array.serialize(size, (char *)&max_latency_, sizeof(uint32_t));
         size += sizeof(uint32_t);
+        uint32_t latency_histogram_deserialize_size = latency_histogram_.deserialize(dynamic_array, size);
+        size += latency_histogram_deserialize_size;
 
         // Deserialize aggregated statistics for read-write ratio
         dynamic_array.serialize(size, (char *)&total_readcnt_, sizeof(uint32_t));
@@ -615,6 +623,7 @@ namespace covered
         tail95_latency_ = other.tail95_latency_;
         tail99_latency_ = other.tail99_latency_;
         max_latency_ = other.max_latency_;
+        latency_histogram_ = other.latency_histogram_;
 
         // Aggregated statistics related with read-write ratio
         total_readcnt_ = other.total_readcnt_;
@@ -639,4 +648,16 @@ namespace covered
 
         return *this;
     }
+
+    void AggregatedStatisticsBase::updateLatencyStatistics_()
+    {
+        avg_latency_ = latency_histogram_.getAvgLatency();
+        min_latency_ = latency_histogram_.getMinLatency();
+        medium_latency_ = latency_histogram_.getPercentileLatency(0.5);
+        tail90_latency_ = latency_histogram_.getPercentileLatency(0.9);
+        tail95_latency_ = latency_histogram_.getPercentileLatency(0.95);
+        tail99_latency_ = latency_histogram_.getPercentileLatency(0.99);
+        max_latency_ = latency_histogram_.getMaxLatency();
+        return;
+    }
 }
\ No newline at end of file
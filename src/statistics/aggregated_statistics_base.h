@@ -2,6 +2,8 @@
  * AggregatedStatisticsBase: store client/total aggregated statistics.
  *
  * NOTE: AggregatedStatisticsBase does NOT support online updates.
+ *
+ * NOTE: AggregatedStatisticsBase carries the merged log-linear latency histogram, such that latency percentiles can be aggregated accurately across client workers and clients.
  * 
  * By Siyuan Sheng (2023.07.22).
  */
@@ -13,6 +15,7 @@
 
 #include "common/bandwidth_usage.h"
 #include "common/dynamic_array.h"
+#include "statistics/latency_histogram.h"
 
 namespace covered
 {
@@ -92,6 +95,8 @@ namespace covered
     private:
         static const std::string kClassName;
     protected:
+        void updateLatencyStatistics_(); // Update avg/min/medium/tail/max latency based on latency_histogram_
+
         // Aggregated statistics related with object hit ratio
         uint32_t total_local_hitcnt_;
         uint32_t total_cooperative_hitcnt_;
@@ -110,6 +115,7 @@ namespace covered
         uint32_t tail95_latency_;
         uint32_t tail99_latency_;
         uint32_t max_latency_;
+        LatencyHistogram latency_histogram_; // Merged latency histogram
 
         // Aggregated statistics related with read-write ratio
         uint32_t total_readcnt_;
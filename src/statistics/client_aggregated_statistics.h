@@ -1,7 +1,7 @@
 /*
  * ClientAggregatedStatistics: store client aggregated statistics (aggregate ClientRawStatistics of client workers in a client).
  *
- * NOTE: ClientAggregatedStatistics aggregate latency statistics accurately based on the latency histogram of the client.
+ * NOTE: ClientAggregatedStatistics aggregate latency statistics accurately based on the merged per-client-worker latency histograms of the client.
  *
  * NOTE: ClientAggregatedStatistics does NOT support online updates.
  * 
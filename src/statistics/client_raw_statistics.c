@@ -11,7 +11,6 @@ namespace covered
     ClientRawStatistics::ClientRawStatistics(uint32_t perclient_workercnt)
     {
         perclient_workercnt_ = perclient_workercnt;
-        latency_histogram_size_ = Config::getLatencyHistogramSize();
 
         perclientworker_local_hitcnts_ = new std::atomic<uint32_t>[perclient_workercnt];
         assert(perclientworker_local_hitcnts_ != NULL);
@@ -29,9 +28,7 @@ namespace covered
         perclientworker_cooperative_hitbytes_.resize(perclient_workercnt, double(0.0));
         perclientworker_reqbytes_.resize(perclient_workercnt, double(0.0));
 
-        latency_histogram_ = new std::atomic<uint32_t>[latency_histogram_size_];
-        assert(latency_histogram_ != NULL);
-        Util::initializeAtomicArray<uint32_t>(latency_histogram_, latency_histogram_size_, 0);
+        perclientworker_latency_histograms_.resize(perclient_workercnt, LatencyHistogram());
 
         perclientworker_readcnts_ = new std::atomic<uint32_t>[perclient_workercnt];
         assert(perclientworker_readcnts_ != NULL);
@@ -70,10 +67,6 @@ namespace covered
         delete[] perclientworker_reqcnts_;
         perclientworker_reqcnts_ = NULL;
 
-        assert(latency_histogram_ != NULL);
-        delete[] latency_histogram_;
-        latency_histogram_ = NULL;
-
         assert(perclientworker_readcnts_ != NULL);
         delete[] perclientworker_readcnts_;
         perclientworker_readcnts_ = NULL;
@@ -105,7 +98,10 @@ namespace covered
         perclientworker_reqbytes_.clear();
         perclientworker_reqbytes_.resize(perclient_workercnt_, double(0.0));
 
-        Util::initializeAtomicArray<uint32_t>(latency_histogram_, latency_histogram_size_, 0);
+        for (uint32_t i = 0; i < perclient_workercnt_; i++)
+        {
+            perclientworker_latency_histograms_[i].clean();
+        }
 
         Util::initializeAtomicArray<uint32_t>(perclientworker_readcnts_, perclient_workercnt_, 0);
         Util::initializeAtomicArray<uint32_t>(perclientworker_writecnts_, perclient_workercnt_, 0);
@@ -200,31 +196,24 @@ namespace covered
 
     uint32_t ClientRawStatistics::getMaxlatency_() const
     {
-        assert(latency_histogram_ != NULL);
-
-        for (uint32_t latency_us = latency_histogram_size_ - 1; latency_us >= 0; latency_us--)
+        uint32_t max_latency_us = 0;
+        for (uint32_t i = 0; i < perclient_workercnt_; i++)
         {
-            if (latency_histogram_[latency_us] > 0)
+            const LatencyHistogram& tmp_latency_histogram = perclientworker_latency_histograms_[i];
+            if (tmp_latency_histogram.getTotalCnt() > 0 && tmp_latency_histogram.getMaxLatency() > max_latency_us)
             {
-                return latency_us;
+                max_latency_us = tmp_latency_histogram.getMaxLatency();
             }
         }
 
-        return 0;
+        return max_latency_us;
     }
 
-    void ClientRawStatistics::updateLatency_(const uint32_t& latency_us)
+    void ClientRawStatistics::updateLatency_(const uint32_t& local_client_worker_idx, const uint32_t& latency_us)
     {
-        assert(latency_histogram_ != NULL);
+        assert(local_client_worker_idx < perclient_workercnt_);
 
-        if (latency_us < latency_histogram_size_)
-        {
-            latency_histogram_[latency_us]++;
-        }
-        else
-        {
-            latency_histogram_[latency_histogram_size_ - 1]++;
-        }
+        perclientworker_latency_histograms_[local_client_worker_idx].update(latency_us);
         return;
     }
 
@@ -300,9 +289,6 @@ namespace covered
         assert(perclientworker_cooperative_hitcnts_ != NULL);
         assert(perclientworker_reqcnts_ != NULL);
 
-        // Per-client-worker latency statistics
-        assert(latency_histogram_ != NULL);
-
         // Per-client-worker read-write ratio statistics
         assert(perclientworker_readcnts_ != NULL);
         assert(perclientworker_writecnts_ != NULL);
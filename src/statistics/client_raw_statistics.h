@@ -13,6 +13,7 @@
 
 #include "common/bandwidth_usage.h"
 #include "message/hitflag.h"
+#include "statistics/latency_histogram.h"
 
 namespace covered
 {
@@ -45,7 +46,7 @@ namespace covered
 
         // Update latency statistics of a client worker
         uint32_t getMaxlatency_() const;
-        void updateLatency_(const uint32_t& latency_us);
+        void updateLatency_(const uint32_t& local_client_worker_idx, const uint32_t& latency_us);
 
         // Update read-write ratio statistics of a client worker
         void updateReadcnt_(const uint32_t& local_client_worker_idx);
@@ -66,7 +67,6 @@ namespace covered
 
         // Const variables
         uint32_t perclient_workercnt_; // Come from CLI
-        uint32_t latency_histogram_size_; // Come from Config::latency_histogram_size_
 
         // Per-client-worker object hit ratio statistics
         std::atomic<uint32_t>* perclientworker_local_hitcnts_; // Hit local edge cache of closest edge node
@@ -79,7 +79,7 @@ namespace covered
         std::vector<double> perclientworker_reqbytes_; // Number of requested bytes
 
         // Per-client-worker latency statistics
-        std::atomic<uint32_t>* latency_histogram_; // thread safe
+        std::vector<LatencyHistogram> perclientworker_latency_histograms_; // Each client worker updates its own cache-line-aligned histogram w/o atomic RMW (merged by client wrapper after slot switch)
 
         // Per-client-worker read-write ratio statistics
         std::atomic<uint32_t>* perclientworker_readcnts_;
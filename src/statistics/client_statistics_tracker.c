@@ -262,7 +262,7 @@ namespace covered
         // Update cur-slot client raw statistics
         ClientRawStatistics* tmp_curslot_client_raw_statistics_ptr = getCurslotClientRawStatisticsPtr_(cur_slot_idx_.load(Util::LOAD_CONCURRENCY_ORDER));
         assert(tmp_curslot_client_raw_statistics_ptr != NULL);
-        tmp_curslot_client_raw_statistics_ptr->updateLatency_(latency_us);
+        tmp_curslot_client_raw_statistics_ptr->updateLatency_(local_client_worker_idx, latency_us);
 
 
         perclientworker_curslot_update_flags_[local_client_worker_idx].store(false, Util::STORE_CONCURRENCY_ORDER);
@@ -271,7 +271,7 @@ namespace covered
         // Update stable client raw statistics for stresstest phase
         if (is_stresstest_phase)
         {
-            stable_client_raw_statistics_ptr_->updateLatency_(latency_us);
+            stable_client_raw_statistics_ptr_->updateLatency_(local_client_worker_idx, latency_us);
         }
         
         return;
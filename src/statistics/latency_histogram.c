@@ -0,0 +1,247 @@
+#include "statistics/latency_histogram.h"
+
+#include <algorithm> // std::fill and std::min
+#include <assert.h>
+#include <cmath> // std::ceil
+#include <sstream>
+
+#include "common/config.h"
+#include "common/util.h"
+
+namespace covered
+{
+    const std::string LatencyHistogram::kClassName("LatencyHistogram");
+
+    uint32_t LatencyHistogram::getLatencyHistogramIOSize()
+    {
+        // significant bits + total cnt + total latency + min latency + max latency + bucket cnts
+        return sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint64_t) + sizeof(uint32_t) + sizeof(uint32_t) + getBucketcnt_(Config::getLatencyHistogramSignificantBits()) * sizeof(uint32_t);
+    }
+
+    LatencyHistogram::LatencyHistogram() : LatencyHistogram(Config::getLatencyHistogramSignificantBits())
+    {
+    }
+
+    LatencyHistogram::LatencyHistogram(const uint32_t& significant_bits)
+    {
+        assert(significant_bits >= 1 && significant_bits <= 16);
+
+        significant_bits_ = significant_bits;
+        sub_bucketcnt_ = 1 << significant_bits;
+        half_sub_bucketcnt_ = 1 << (significant_bits - 1);
+
+        total_cnt_ = 0;
+        total_latency_ = 0;
+        min_latency_ = 0;
+        max_latency_ = 0;
+        bucket_cnts_.resize(getBucketcnt_(significant_bits), 0);
+    }
+
+    LatencyHistogram::~LatencyHistogram() {}
+
+    void LatencyHistogram::update(const uint32_t& latency_us)
+    {
+        bucket_cnts_[getBucketIdx_(latency_us)]++;
+
+        if (total_cnt_ == 0 || latency_us < min_latency_)
+        {
+            min_latency_ = latency_us;
+        }
+        if (total_cnt_ == 0 || latency_us > max_latency_)
+        {
+            max_latency_ = latency_us;
+        }
+        total_cnt_++;
+        total_latency_ += latency_us;
+        return;
+    }
+
+    void LatencyHistogram::merge(const LatencyHistogram& other)
+    {
+        assert(significant_bits_ == other.significant_bits_);
+        assert(bucket_cnts_.size() == other.bucket_cnts_.size());
+
+        if (other.total_cnt_ == 0)
+        {
+            return;
+        }
+
+        for (uint32_t i = 0; i < bucket_cnts_.size(); i++)
+        {
+            bucket_cnts_[i] += other.bucket_cnts_[i];
+        }
+
+        if (total_cnt_ == 0 || other.min_latency_ < min_latency_)
+        {
+            min_latency_ = other.min_latency_;
+        }
+        if (total_cnt_ == 0 || other.max_latency_ > max_latency_)
+        {
+            max_latency_ = other.max_latency_;
+        }
+        total_cnt_ += other.total_cnt_;
+        total_latency_ += other.total_latency_;
+        return;
+    }
+
+    void LatencyHistogram::clean()
+    {
+        total_cnt_ = 0;
+        total_latency_ = 0;
+        min_latency_ = 0;
+        max_latency_ = 0;
+        std::fill(bucket_cnts_.begin(), bucket_cnts_.end(), 0);
+        return;
+    }
+
+    uint64_t LatencyHistogram::getTotalCnt() const
+    {
+        return total_cnt_;
+    }
+
+    uint32_t LatencyHistogram::getAvgLatency() const
+    {
+        if (total_cnt_ == 0)
+        {
+            return 0;
+        }
+        return static_cast<uint32_t>(total_latency_ / total_cnt_);
+    }
+
+    uint32_t LatencyHistogram::getMinLatency() const
+    {
+        return min_latency_;
+    }
+
+    uint32_t LatencyHistogram::getMaxLatency() const
+    {
+        return max_latency_;
+    }
+
+    uint32_t LatencyHistogram::getPercentileLatency(const double& ratio) const
+    {
+        assert(ratio >= 0.0 && ratio <= 1.0);
+
+        if (total_cnt_ == 0)
+        {
+            return 0;
+        }
+
+        uint64_t target_cnt = static_cast<uint64_t>(std::ceil(ratio * static_cast<double>(total_cnt_)));
+        if (target_cnt == 0)
+        {
+            target_cnt = 1;
+        }
+
+        uint64_t cur_cnt = 0;
+        for (uint32_t bucket_idx = 0; bucket_idx < bucket_cnts_.size(); bucket_idx++) // O(# of buckets) instead of O(max latency)
+        {
+            cur_cnt += bucket_cnts_[bucket_idx];
+            if (cur_cnt >= target_cnt)
+            {
+                return std::min(getHighestEquivalentLatency_(bucket_idx), max_latency_);
+            }
+        }
+
+        return max_latency_;
+    }
+
+    uint32_t LatencyHistogram::serialize(DynamicArray& dynamic_array, const uint32_t& position) const
+    {
+        uint32_t size = position;
+        dynamic_array.deserialize(size, (const char*)&significant_bits_, sizeof(uint32_t));
+        size += sizeof(uint32_t);
+        dynamic_array.deserialize(size, (const char*)&total_cnt_, sizeof(uint64_t));
+        size += sizeof(uint64_t);
+        dynamic_array.deserialize(size, (const char*)&total_latency_, sizeof(uint64_t));
+        size += sizeof(uint64_t);
+        dynamic_array.deserialize(size, (const char*)&min_latency_, sizeof(uint32_t));
+        size += sizeof(uint32_t);
+        dynamic_array.deserialize(size, (const char*)&max_latency_, sizeof(uint32_t));
+        size += sizeof(uint32_t);
+        const uint32_t bucket_cnts_bytes = bucket_cnts_.size() * sizeof(uint32_t);
+        dynamic_array.deserialize(size, (const char*)bucket_cnts_.data(), bucket_cnts_bytes);
+        size += bucket_cnts_bytes;
+        return size - position;
+    }
+
+    uint32_t LatencyHistogram::deserialize(const DynamicArray& dynamic_array, const uint32_t& position)
+    {
+        uint32_t size = position;
+        uint32_t tmp_significant_bits = 0;
+        dynamic_array.serialize(size, (char *)&tmp_significant_bits, sizeof(uint32_t));
+        size += sizeof(uint32_t);
+        if (tmp_significant_bits != significant_bits_)
+        {
+            std::ostringstream oss;
+            oss << "significant bits " << tmp_significant_bits << " of the serialized latency histogram is inconsistent with local significant bits " << significant_bits_ << " -> please use the same latency_histogram_significant_bits in config.json!";
+            Util::dumpErrorMsg(kClassName, oss.str());
+            exit(1);
+        }
+        dynamic_array.serialize(size, (char *)&total_cnt_, sizeof(uint64_t));
+        size += sizeof(uint64_t);
+        dynamic_array.serialize(size, (char *)&total_latency_, sizeof(uint64_t));
+        size += sizeof(uint64_t);
+        dynamic_array.serialize(size, (char *)&min_latency_, sizeof(uint32_t));
+        size += sizeof(uint32_t);
+        dynamic_array.serialize(size, (char *)&max_latency_, sizeof(uint32_t));
+        size += sizeof(uint32_t);
+        const uint32_t bucket_cnts_bytes = bucket_cnts_.size() * sizeof(uint32_t);
+        dynamic_array.serialize(size, (char *)bucket_cnts_.data(), bucket_cnts_bytes);
+        size += bucket_cnts_bytes;
+        return size - position;
+    }
+
+    const LatencyHistogram& LatencyHistogram::operator=(const LatencyHistogram& other)
+    {
+        if (this != &other)
+        {
+            significant_bits_ = other.significant_bits_;
+            sub_bucketcnt_ = other.sub_bucketcnt_;
+            half_sub_bucketcnt_ = other.half_sub_bucketcnt_;
+
+            total_cnt_ = other.total_cnt_;
+            total_latency_ = other.total_latency_;
+            min_latency_ = other.min_latency_;
+            max_latency_ = other.max_latency_;
+            bucket_cnts_ = other.bucket_cnts_;
+        }
+        return *this;
+    }
+
+    uint32_t LatencyHistogram::getBucketcnt_(const uint32_t& significant_bits)
+    {
+        // Exact buckets for [0, 2^b) + linear sub-buckets for each power-of-2 range [2^k, 2^(k+1)) with k in [b, 31]
+        return (1 << significant_bits) + (32 - significant_bits) * (1 << (significant_bits - 1));
+    }
+
+    uint32_t LatencyHistogram::getBucketIdx_(const uint32_t& latency_us) const
+    {
+        if (latency_us < sub_bucketcnt_)
+        {
+            return latency_us; // Exact bucket
+        }
+
+        const uint32_t msb = 31 - __builtin_clz(latency_us); // >= significant_bits_
+        const uint32_t shift = msb - significant_bits_ + 1; // >= 1
+        const uint32_t sub_bucket_idx = (latency_us >> shift) - half_sub_bucketcnt_; // Top significant_bits_ bits w/o the leading 1
+        const uint32_t bucket_idx = sub_bucketcnt_ + (shift - 1) * half_sub_bucketcnt_ + sub_bucket_idx;
+        assert(bucket_idx < bucket_cnts_.size());
+        return bucket_idx;
+    }
+
+    uint32_t LatencyHistogram::getHighestEquivalentLatency_(const uint32_t& bucket_idx) const
+    {
+        assert(bucket_idx < bucket_cnts_.size());
+
+        if (bucket_idx < sub_bucketcnt_)
+        {
+            return bucket_idx; // Exact bucket
+        }
+
+        const uint32_t shift = (bucket_idx - sub_bucketcnt_) / half_sub_bucketcnt_ + 1;
+        const uint64_t mantissa = (bucket_idx - sub_bucketcnt_) % half_sub_bucketcnt_ + half_sub_bucketcnt_;
+        const uint64_t highest_latency = ((mantissa + 1) << shift) - 1;
+        return static_cast<uint32_t>(std::min(highest_latency, static_cast<uint64_t>(UINT32_MAX)));
+    }
+}
@@ -0,0 +1,62 @@
+/*
+ * LatencyHistogram: a compact log-linear (HDR-style) histogram of latencies in units of us.
+ *
+ * NOTE: with significant bits b (Config::latency_histogram_significant_bits_), latencies < 2^b are tracked exactly, while each larger power-of-2 range is split into 2^(b-1) linear sub-buckets -> relative error of at most 2^-(b-1) for all uint32_t latencies w/o saturation (e.g., 3328 buckets for b = 8), instead of one bucket per us.
+ *
+ * NOTE: LatencyHistogram is NOT thread safe: each client worker updates its own cache-line-aligned histogram, while client wrapper merges per-worker histograms only after all client workers switch to the next slot (see ClientStatisticsTracker) -> NO lock or atomic RMW in the critical path.
+ */
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <string>
+#include <vector>
+
+#include "common/dynamic_array.h"
+
+namespace covered
+{
+    class alignas(64) LatencyHistogram // NOTE: avoid false sharing among per-client-worker histograms
+    {
+    public:
+        static uint32_t getLatencyHistogramIOSize(); // Based on Config::latency_histogram_significant_bits_
+
+        LatencyHistogram(); // Based on Config::latency_histogram_significant_bits_
+        LatencyHistogram(const uint32_t& significant_bits);
+        ~LatencyHistogram();
+
+        void update(const uint32_t& latency_us);
+        void merge(const LatencyHistogram& other); // NOTE: other MUST have the same significant bits
+        void clean();
+
+        uint64_t getTotalCnt() const;
+        uint32_t getAvgLatency() const;
+        uint32_t getMinLatency() const;
+        uint32_t getMaxLatency() const;
+        uint32_t getPercentileLatency(const double& ratio) const; // Highest equivalent latency of the first bucket whose cumulative ratio >= ratio (capped by max latency)
+
+        uint32_t serialize(DynamicArray& dynamic_array, const uint32_t& position) const;
+        uint32_t deserialize(const DynamicArray& dynamic_array, const uint32_t& position);
+
+        const LatencyHistogram& operator=(const LatencyHistogram& other);
+    private:
+        static const std::string kClassName;
+
+        static uint32_t getBucketcnt_(const uint32_t& significant_bits);
+
+        uint32_t getBucketIdx_(const uint32_t& latency_us) const;
+        uint32_t getHighestEquivalentLatency_(const uint32_t& bucket_idx) const;
+
+        uint32_t significant_bits_;
+        uint32_t sub_bucketcnt_; // 2^significant_bits_ (# of exact buckets)
+        uint32_t half_sub_bucketcnt_; // 2^(significant_bits_-1) (# of linear sub-buckets for each larger power-of-2 range)
+
+        uint64_t total_cnt_;
+        uint64_t total_latency_; // Exact sum of latencies for average latency
+        uint32_t min_latency_; // Exact min latency
+        uint32_t max_latency_; // Exact max latency
+        std::vector<uint32_t> bucket_cnts_;
+    };
+}
+
+#endif
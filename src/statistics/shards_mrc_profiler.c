@@ -0,0 +1,212 @@
+#include "statistics/shards_mrc_profiler.h"
+
+#include <algorithm> // std::lower_bound, std::sort, std::max
+#include <assert.h>
+#include <sstream>
+
+#include "common/util.h"
+
+namespace covered
+{
+    const uint64_t ShardsMrcProfiler::SAMPLING_MODULUS = 1 << 24;
+
+    const std::string ShardsMrcProfiler::kClassName("ShardsMrcProfiler");
+    const uint64_t ShardsMrcProfiler::INIT_TIMESTAMPCNT = 1 << 20;
+
+    bool ShardsMrcProfiler::isSampled(const Key& key, const double& sample_ratio)
+    {
+        // NOTE: remix the precomputed key hash (splitmix64 finalizer) to decouple sampling from other usages of the key hash (e.g., DHT)
+        uint64_t tmp_hash = key.getKeyHash();
+        tmp_hash ^= tmp_hash >> 30;
+        tmp_hash *= 0xbf58476d1ce4e5b9ULL;
+        tmp_hash ^= tmp_hash >> 27;
+        tmp_hash *= 0x94d049bb133111ebULL;
+        tmp_hash ^= tmp_hash >> 31;
+
+        const uint64_t sample_threshold = static_cast<uint64_t>(sample_ratio * static_cast<double>(SAMPLING_MODULUS));
+        return (tmp_hash & (SAMPLING_MODULUS - 1)) < sample_threshold;
+    }
+
+    ShardsMrcProfiler::ShardsMrcProfiler(const double& sample_ratio, const std::vector<uint64_t>& capacities_bytes) : sample_ratio_(sample_ratio), capacities_bytes_(capacities_bytes)
+    {
+        if (sample_ratio <= 0.0 || sample_ratio > 1.0)
+        {
+            std::ostringstream oss;
+            oss << "sample ratio " << sample_ratio << " should be in (0, 1]";
+            Util::dumpErrorMsg(kClassName, oss.str());
+            exit(1);
+        }
+        assert(capacities_bytes.size() > 0);
+        assert(std::is_sorted(capacities_bytes.begin(), capacities_bytes.end()));
+
+        fenwick_bytes_.resize(INIT_TIMESTAMPCNT + 1, 0);
+        cur_timestamp_ = 0;
+        total_live_bytes_ = 0;
+
+        first_hit_reqcnts_.resize(capacities_bytes.size(), 0);
+        first_hit_bytes_.resize(capacities_bytes.size(), 0);
+        sampled_reqcnt_ = 0;
+        sampled_bytes_ = 0;
+    }
+
+    ShardsMrcProfiler::~ShardsMrcProfiler() {}
+
+    bool ShardsMrcProfiler::access(const Key& key, const uint32_t& objsize, const uint32_t& charged_objsize, const bool& is_counted)
+    {
+        if (!isSampled(key, sample_ratio_))
+        {
+            return false;
+        }
+
+        std::unordered_map<Key, std::pair<uint64_t, uint32_t>, KeyHasher>::iterator lastaccess_iter = key_lastaccess_map_.find(key);
+        if (lastaccess_iter != key_lastaccess_map_.end()) // Reuse
+        {
+            const uint64_t last_timestamp = lastaccess_iter->second.first;
+            const uint32_t last_charged_objsize = lastaccess_iter->second.second;
+
+            if (is_counted)
+            {
+                // Bytes of distinct objects accessed after the last access, plus the object itself
+                const uint64_t reuse_distance_bytes = total_live_bytes_ - fenwickPrefixSum_(last_timestamp) + charged_objsize;
+                const uint64_t scaled_reuse_distance_bytes = static_cast<uint64_t>(static_cast<double>(reuse_distance_bytes) / sample_ratio_);
+
+                const uint32_t first_hit_capacity_idx = std::lower_bound(capacities_bytes_.begin(), capacities_bytes_.end(), scaled_reuse_distance_bytes) - capacities_bytes_.begin();
+                if (first_hit_capacity_idx < capacities_bytes_.size())
+                {
+                    first_hit_reqcnts_[first_hit_capacity_idx] += 1;
+                    first_hit_bytes_[first_hit_capacity_idx] += objsize;
+                }
+            }
+
+            // Remove the last access (NOTE: erase the key before compaction, which rebuilds Fenwick tree from key_lastaccess_map_)
+            fenwickUpdate_(last_timestamp, -static_cast<int64_t>(last_charged_objsize));
+            total_live_bytes_ -= last_charged_objsize;
+            key_lastaccess_map_.erase(lastaccess_iter);
+        }
+        // NOTE: cold miss for the first access of the key
+
+        if (cur_timestamp_ + 1 >= fenwick_bytes_.size())
+        {
+            compactTimestamps_();
+        }
+        cur_timestamp_ += 1;
+        fenwickUpdate_(cur_timestamp_, static_cast<int64_t>(charged_objsize));
+        total_live_bytes_ += charged_objsize;
+        key_lastaccess_map_[key] = std::pair<uint64_t, uint32_t>(cur_timestamp_, charged_objsize);
+
+        if (is_counted)
+        {
+            sampled_reqcnt_ += 1;
+            sampled_bytes_ += objsize;
+        }
+
+        return true;
+    }
+
+    void ShardsMrcProfiler::remove(const Key& key)
+    {
+        std::unordered_map<Key, std::pair<uint64_t, uint32_t>, KeyHasher>::iterator lastaccess_iter = key_lastaccess_map_.find(key);
+        if (lastaccess_iter != key_lastaccess_map_.end())
+        {
+            fenwickUpdate_(lastaccess_iter->second.first, -static_cast<int64_t>(lastaccess_iter->second.second));
+            total_live_bytes_ -= lastaccess_iter->second.second;
+            key_lastaccess_map_.erase(lastaccess_iter);
+        }
+        return;
+    }
+
+    uint64_t ShardsMrcProfiler::getSampledReqcnt() const
+    {
+        return sampled_reqcnt_;
+    }
+
+    double ShardsMrcProfiler::getHitRatio(const uint32_t& capacity_idx) const
+    {
+        assert(capacity_idx < capacities_bytes_.size());
+        if (sampled_reqcnt_ == 0)
+        {
+            return 0.0;
+        }
+
+        uint64_t hitcnt = 0;
+        for (uint32_t i = 0; i <= capacity_idx; i++)
+        {
+            hitcnt += first_hit_reqcnts_[i];
+        }
+        return static_cast<double>(hitcnt) / static_cast<double>(sampled_reqcnt_);
+    }
+
+    double ShardsMrcProfiler::getByteHitRatio(const uint32_t& capacity_idx) const
+    {
+        assert(capacity_idx < capacities_bytes_.size());
+        if (sampled_bytes_ == 0)
+        {
+            return 0.0;
+        }
+
+        uint64_t hit_bytes = 0;
+        for (uint32_t i = 0; i <= capacity_idx; i++)
+        {
+            hit_bytes += first_hit_bytes_[i];
+        }
+        return static_cast<double>(hit_bytes) / static_cast<double>(sampled_bytes_);
+    }
+
+    void ShardsMrcProfiler::fenwickUpdate_(const uint64_t& timestamp, const int64_t& delta_bytes)
+    {
+        assert(timestamp > 0 && timestamp < fenwick_bytes_.size());
+        for (uint64_t i = timestamp; i < fenwick_bytes_.size(); i += i & (~i + 1))
+        {
+            fenwick_bytes_[i] += delta_bytes; // NOTE: unsigned wrap-around is fine as the final prefix sums are non-negative
+        }
+        return;
+    }
+
+    uint64_t ShardsMrcProfiler::fenwickPrefixSum_(const uint64_t& timestamp) const
+    {
+        assert(timestamp < fenwick_bytes_.size());
+        uint64_t prefix_sum = 0;
+        for (uint64_t i = timestamp; i > 0; i -= i & (~i + 1))
+        {
+            prefix_sum += fenwick_bytes_[i];
+        }
+        return prefix_sum;
+    }
+
+    void ShardsMrcProfiler::compactTimestamps_()
+    {
+        // Sort live keys by last-access timestamps
+        std::vector<std::pair<uint64_t, std::unordered_map<Key, std::pair<uint64_t, uint32_t>, KeyHasher>::iterator>> sorted_live_keys;
+        sorted_live_keys.reserve(key_lastaccess_map_.size());
+        for (std::unordered_map<Key, std::pair<uint64_t, uint32_t>, KeyHasher>::iterator lastaccess_iter = key_lastaccess_map_.begin(); lastaccess_iter != key_lastaccess_map_.end(); lastaccess_iter++)
+        {
+            sorted_live_keys.push_back(std::make_pair(lastaccess_iter->second.first, lastaccess_iter));
+        }
+        std::sort(sorted_live_keys.begin(), sorted_live_keys.end(), [](const std::pair<uint64_t, std::unordered_map<Key, std::pair<uint64_t, uint32_t>, KeyHasher>::iterator>& a, const std::pair<uint64_t, std::unordered_map<Key, std::pair<uint64_t, uint32_t>, KeyHasher>::iterator>& b) { return a.first < b.first; });
+
+        // Keep at least half of the tree free for new timestamps
+        const uint64_t live_keycnt = sorted_live_keys.size();
+        const uint64_t new_timestampcnt = std::max(INIT_TIMESTAMPCNT, 2 * live_keycnt);
+        fenwick_bytes_.assign(new_timestampcnt + 1, 0);
+
+        // Renumber timestamps in [1, live_keycnt] w/ the same order
+        for (uint64_t i = 0; i < live_keycnt; i++)
+        {
+            sorted_live_keys[i].second->second.first = i + 1;
+            fenwick_bytes_[i + 1] = sorted_live_keys[i].second->second.second;
+        }
+        cur_timestamp_ = live_keycnt;
+
+        // Build Fenwick tree in O(n)
+        for (uint64_t i = 1; i < fenwick_bytes_.size(); i++)
+        {
+            const uint64_t parent = i + (i & (~i + 1));
+            if (parent < fenwick_bytes_.size())
+            {
+                fenwick_bytes_[parent] += fenwick_bytes_[i];
+            }
+        }
+
+        return;
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * ShardsMrcProfiler: one-pass LRU miss ratio curve (object/byte hit ratios for multiple cache capacities) by SHARDS-style spatially hashed sampling and byte-weighted reuse distance tracking.
+ *
+ * NOTE: a key is sampled iff (hash(key) mod SAMPLING_MODULUS) < sample_ratio * SAMPLING_MODULUS, so all requests of a sampled key are tracked (spatial sampling), and keys sampled under a smaller ratio are also sampled under any larger ratio (used by scaled-down mini-caches with different sample ratios).
+ *
+ * NOTE: reuse distance of a sampled request is the total bytes of distinct sampled objects accessed since the last access of the same key (plus the object itself), scaled by 1 / sample_ratio -> LRU hits the request iff reuse distance <= cache capacity; we maintain byte sizes at last-access timestamps by a Fenwick tree for O(log n) reuse distance calculation, and renumber timestamps of live keys once the tree is full.
+ *
+ * NOTE: reuse distances use the bytes charged by the cache for each object (i.e., including per-object metadata, see LruCache::getObjsizeForCapacity()), while byte hit ratios use object sizes (key + value).
+ *
+ * NOTE: reuse distances assume a single LRU stack for all capacities, so writes are modeled as write-allocate (i.e., a write moves the key to MRU even if evicted), while the simulator ONLY updates cached objects -> NOT exact for workloads with writes (the simulator always additionally profiles LRU by mini-caches for exact results).
+ *
+ * NOTE: ShardsMrcProfiler is NOT thread safe.
+ */
+
+#ifndef SHARDS_MRC_PROFILER_H
+#define SHARDS_MRC_PROFILER_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/key.h"
+
+namespace covered
+{
+    class ShardsMrcProfiler
+    {
+    public:
+        static const uint64_t SAMPLING_MODULUS; // 2^24
+
+        static bool isSampled(const Key& key, const double& sample_ratio);
+
+        ShardsMrcProfiler(const double& sample_ratio, const std::vector<uint64_t>& capacities_bytes); // NOTE: capacities_bytes MUST be in ascending order
+        ~ShardsMrcProfiler();
+
+        bool access(const Key& key, const uint32_t& objsize, const uint32_t& charged_objsize, const bool& is_counted); // Return if key is sampled; update reuse distance histogram ONLY if is_counted (e.g., GET requests after warmup)
+        void remove(const Key& key); // E.g., for DEL requests
+
+        uint64_t getSampledReqcnt() const;
+        double getHitRatio(const uint32_t& capacity_idx) const;
+        double getByteHitRatio(const uint32_t& capacity_idx) const;
+    private:
+        static const std::string kClassName;
+        static const uint64_t INIT_TIMESTAMPCNT;
+
+        void fenwickUpdate_(const uint64_t& timestamp, const int64_t& delta_bytes);
+        uint64_t fenwickPrefixSum_(const uint64_t& timestamp) const; // Total bytes with last-access timestamps in [1, timestamp]
+        void compactTimestamps_(); // Renumber last-access timestamps of live keys into [1, live keycnt] and rebuild Fenwick tree
+
+        const double sample_ratio_;
+        const std::vector<uint64_t> capacities_bytes_;
+
+        std::unordered_map<Key, std::pair<uint64_t, uint32_t>, KeyHasher> key_lastaccess_map_; // Last-access timestamp and charged object size of each sampled live key
+        std::vector<uint64_t> fenwick_bytes_; // 1-indexed Fenwick tree of charged object bytes at last-access timestamps
+        uint64_t cur_timestamp_;
+        uint64_t total_live_bytes_;
+
+        // Reuse distance histogram: hit of a request is counted by the smallest capacity >= its scaled reuse distance (prefix sums give hits of each capacity)
+        std::vector<uint64_t> first_hit_reqcnts_;
+        std::vector<uint64_t> first_hit_bytes_;
+        uint64_t sampled_reqcnt_; // Counted requests of sampled keys
+        uint64_t sampled_bytes_; // Counted bytes of sampled keys
+    };
+}
+
+#endif
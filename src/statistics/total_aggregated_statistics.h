@@ -1,7 +1,7 @@
 /*
  * TotalAggregatedStatistics: store total aggregated statistics (aggregate ClientAggregatedStatistics of all clients).
  *
- * NOTE: TotalAggregatedStatistics aggregates latency statistics approximately to avoid holding too many latency histograms.
+ * NOTE: TotalAggregatedStatistics aggregates latency statistics accurately by merging the compact latency histograms of all clients (instead of approximating percentiles by per-client percentiles).
  *
  * NOTE: TotalAggregatedStatistics does NOT support online updates.
  * 
@@ -0,0 +1,172 @@
+/*
+ * Microbenchmark of UDP message socket layer over loopback (per-packet sendto/recvfrom vs. batched sendmmsg/recvmmsg).
+ *
+ * NOTE: a sender thread issues single-fragment messages (UdpFragHdr + payload) by UdpPktSocket, while the main thread receives them by UdpMsgSocketServer::recv() or recvBatch(); we report sender/receiver packet rate (pps), receiver goodput (MiB/s), and loss ratio (loopback may drop packets if the receiver cannot keep up).
+ */
+
+#include <algorithm> // std::min
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/program_options.hpp>
+
+#include "common/dynamic_array.h"
+#include "common/util.h"
+#include "network/network_addr.h"
+#include "network/udp_frag_hdr.h"
+#include "network/udp_msg_socket_server.h"
+#include "network/udp_pkt_socket.h"
+
+namespace
+{
+    const std::string kClassName("udp_microbenchmark");
+
+    const uint32_t RECV_IDLE_TIMEOUT_MS = 200; // Stop receiving if no packet within 200 ms after sender finishes
+
+    double getElapsedSec(const std::chrono::steady_clock::time_point& start_time)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+    }
+
+    void runSender(const bool is_batch, const uint32_t pktcnt, const uint32_t payload_size, const uint16_t port, std::atomic<bool>* is_sender_finished_ptr, double* send_sec_ptr)
+    {
+        covered::UdpPktSocket pkt_socket(false);
+        const covered::NetworkAddr remote_addr("127.0.0.1", port);
+        const covered::NetworkAddr source_addr("127.0.0.1", port + 1); // NOTE: only used by MsgFragStats of receiver to track fragments
+
+        // Prepare a batch of packets (each a single-fragment message)
+        const uint32_t batch_pktcnt = covered::UdpPktSocket::UDP_BATCH_MAX_PKTCNT;
+        const uint32_t msg_payload_size = payload_size;
+        std::vector<covered::DynamicArray> pkt_payloads(batch_pktcnt);
+        std::vector<covered::NetworkAddr> remote_addrs(batch_pktcnt, remote_addr);
+        for (uint32_t i = 0; i < batch_pktcnt; i++)
+        {
+            pkt_payloads[i].clear(covered::Util::UDP_MAX_PKT_PAYLOAD);
+            covered::UdpFragHdr fraghdr(0, 1, msg_payload_size, i, source_addr);
+            uint32_t fraghdr_size = fraghdr.serialize(pkt_payloads[i]);
+            pkt_payloads[i].arrayset(fraghdr_size, 'v', msg_payload_size);
+        }
+
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        uint32_t sent_pktcnt = 0;
+        while (sent_pktcnt < pktcnt)
+        {
+            const uint32_t tmp_pktcnt = std::min(batch_pktcnt, pktcnt - sent_pktcnt);
+            if (is_batch)
+            {
+                pkt_socket.udpSendBatch(pkt_payloads, remote_addrs, tmp_pktcnt);
+            }
+            else
+            {
+                for (uint32_t i = 0; i < tmp_pktcnt; i++)
+                {
+                    pkt_socket.udpSendto(pkt_payloads[i], remote_addr);
+                }
+            }
+            sent_pktcnt += tmp_pktcnt;
+        }
+        *send_sec_ptr = getElapsedSec(start_time);
+
+        is_sender_finished_ptr->store(true, std::memory_order_release);
+        return;
+    }
+}
+
+int main(int argc, char **argv) {
+    // (1) Parse CLI parameters
+
+    boost::program_options::options_description argument_desc("Allowed arguments for " + kClassName);
+    argument_desc.add_options()
+        ("help,h", "dump help information")
+        ("pktcnt", boost::program_options::value<uint32_t>()->default_value(1000000), "the number of packets (single-fragment messages) for each mode")
+        ("payload_size", boost::program_options::value<uint32_t>()->default_value(64), "the message payload size in units of bytes")
+        ("port", boost::program_options::value<uint16_t>()->default_value(4999), "the loopback UDP port of the receiver")
+    ;
+    boost::program_options::variables_map argument_info;
+    boost::program_options::store(boost::program_options::parse_command_line(argc, argv, argument_desc), argument_info);
+    boost::program_options::notify(argument_info);
+    if (argument_info.count("help"))
+    {
+        std::cout << argument_desc << std::endl;
+        return 0;
+    }
+
+    const uint32_t pktcnt = argument_info["pktcnt"].as<uint32_t>();
+    const uint32_t payload_size = argument_info["payload_size"].as<uint32_t>();
+    const uint16_t port = argument_info["port"].as<uint16_t>();
+    if (pktcnt == 0 || payload_size == 0 || payload_size > covered::Util::UDP_MAX_FRAG_PAYLOAD || port <= covered::Util::UDP_MIN_PORT)
+    {
+        std::cerr << "[ERROR] " << kClassName << ": pktcnt MUST be positive, payload_size MUST be in (0, " << covered::Util::UDP_MAX_FRAG_PAYLOAD << "], and port MUST be larger than " << covered::Util::UDP_MIN_PORT << std::endl;
+        return 1;
+    }
+
+    std::cout << "pktcnt: " << pktcnt << "; payload_size: " << payload_size << "; batch_pktcnt: " << covered::UdpPktSocket::UDP_BATCH_MAX_PKTCNT << std::endl;
+    std::cout << std::left << std::setw(12) << "mode" << std::setw(16) << "send_pps" << std::setw(16) << "recv_pps" << std::setw(16) << "recv_MiB/s" << "loss_ratio" << std::endl;
+
+    // (2) Per-packet syscalls vs. batched syscalls
+
+    covered::UdpMsgSocketServer socket_server(covered::NetworkAddr(covered::Util::ANY_IPSTR, port));
+    const bool is_batch_list[2] = {false, true};
+    for (uint32_t mode_idx = 0; mode_idx < 2; mode_idx++)
+    {
+        const bool is_batch = is_batch_list[mode_idx];
+
+        std::atomic<bool> is_sender_finished(false);
+        double send_sec = 0.0;
+        std::thread sender_thread(runSender, is_batch, pktcnt, payload_size, port, &is_sender_finished, &send_sec);
+
+        // Receive until all packets are received or receiver is idle after sender finishes
+        uint64_t recv_msgcnt = 0;
+        uint64_t recv_bytes = 0;
+        covered::DynamicArray msg_payload;
+        std::vector<covered::DynamicArray> msg_payloads;
+        std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+        std::chrono::steady_clock::time_point last_recv_time = start_time;
+        while (recv_msgcnt < pktcnt)
+        {
+            uint32_t tmp_msgcnt = 0;
+            if (is_batch)
+            {
+                tmp_msgcnt = socket_server.recvBatch(msg_payloads, covered::UdpPktSocket::UDP_BATCH_MAX_PKTCNT, true);
+                for (uint32_t i = 0; i < tmp_msgcnt; i++)
+                {
+                    recv_bytes += msg_payloads[i].getSize();
+                }
+            }
+            else
+            {
+                bool is_timeout = socket_server.recv(msg_payload, true);
+                if (!is_timeout)
+                {
+                    tmp_msgcnt = 1;
+                    recv_bytes += msg_payload.getSize();
+                }
+            }
+
+            if (tmp_msgcnt > 0)
+            {
+                recv_msgcnt += tmp_msgcnt;
+                last_recv_time = std::chrono::steady_clock::now();
+            }
+            else if (is_sender_finished.load(std::memory_order_acquire) && std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - last_recv_time).count() >= RECV_IDLE_TIMEOUT_MS)
+            {
+                break; // Remaining packets are dropped
+            }
+        }
+        const double recv_sec = std::chrono::duration<double>(last_recv_time - start_time).count();
+        sender_thread.join();
+
+        const double send_pps = static_cast<double>(pktcnt) / send_sec;
+        const double recv_pps = (recv_sec > 0.0) ? static_cast<double>(recv_msgcnt) / recv_sec : 0.0;
+        const double recv_mibps = (recv_sec > 0.0) ? static_cast<double>(recv_bytes) / recv_sec / 1024.0 / 1024.0 : 0.0;
+        const double loss_ratio = 1.0 - static_cast<double>(recv_msgcnt) / static_cast<double>(pktcnt);
+        std::cout << std::left << std::setw(12) << (is_batch ? "mmsg" : "single") << std::setw(16) << std::fixed << std::setprecision(0) << send_pps << std::setw(16) << recv_pps << std::setw(16) << std::setprecision(2) << recv_mibps << std::setprecision(4) << loss_ratio << std::endl;
+    }
+
+    return 0;
+}
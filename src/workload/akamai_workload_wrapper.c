@@ -519,7 +519,7 @@ namespace covered
 
         // Get the object ID (8B)
         int64_t tmp_objid = 0;
-        memcpy((char *)&tmp_objid, key.getKeystr().c_str(), objid_bytecnt);
+        memcpy((char *)&tmp_objid, key.getKeystrView().data(), objid_bytecnt);
         assert(tmp_objid >= 0 && tmp_objid < static_cast<int64_t>(dataset_valsizes_.size()));
 
         return tmp_objid;
@@ -0,0 +1,113 @@
+#include "workload/alias_sampler.h"
+
+#include <assert.h>
+#include <sstream>
+
+#include "common/util.h"
+
+namespace covered
+{
+    const std::string AliasSampler::kClassName("AliasSampler");
+
+    AliasSampler::AliasSampler(const std::vector<double>& probs)
+    {
+        const uint64_t slotcnt = probs.size();
+        if (slotcnt == 0 || slotcnt > UINT32_MAX)
+        {
+            std::ostringstream oss;
+            oss << "invalid slotcnt " << slotcnt << " for alias table!";
+            Util::dumpErrorMsg(kClassName, oss.str());
+            exit(1);
+        }
+
+        double total_prob = 0.0;
+        for (uint32_t i = 0; i < slotcnt; i++)
+        {
+            assert(probs[i] >= 0.0);
+            total_prob += probs[i];
+        }
+        if (total_prob <= 0.0)
+        {
+            Util::dumpErrorMsg(kClassName, "total probability MUST be positive for alias table!");
+            exit(1);
+        }
+
+        // Vose's alias method: scale probs such that the average is 1.0, and pair each small slot (< 1.0) with a large slot (>= 1.0)
+        std::vector<double> scaled_probs(slotcnt, 0.0);
+        std::vector<uint32_t> small_slot_idxes;
+        std::vector<uint32_t> large_slot_idxes;
+        for (uint32_t i = 0; i < slotcnt; i++)
+        {
+            scaled_probs[i] = probs[i] / total_prob * static_cast<double>(slotcnt);
+            if (scaled_probs[i] < 1.0)
+            {
+                small_slot_idxes.push_back(i);
+            }
+            else
+            {
+                large_slot_idxes.push_back(i);
+            }
+        }
+
+        const double threshold_scale = 4294967296.0; // 2^32
+        alias_slots_.resize(slotcnt);
+        while (!small_slot_idxes.empty() && !large_slot_idxes.empty())
+        {
+            const uint32_t tmp_small_slot_idx = small_slot_idxes.back();
+            small_slot_idxes.pop_back();
+            const uint32_t tmp_large_slot_idx = large_slot_idxes.back();
+
+            alias_slots_[tmp_small_slot_idx].threshold = static_cast<uint32_t>(scaled_probs[tmp_small_slot_idx] * threshold_scale);
+            alias_slots_[tmp_small_slot_idx].alias = tmp_large_slot_idx;
+
+            // Move the remaining probability of the large slot
+            scaled_probs[tmp_large_slot_idx] -= (1.0 - scaled_probs[tmp_small_slot_idx]);
+            if (scaled_probs[tmp_large_slot_idx] < 1.0)
+            {
+                large_slot_idxes.pop_back();
+                small_slot_idxes.push_back(tmp_large_slot_idx);
+            }
+        }
+
+        // NOTE: remaining slots are full (probability ~1.0 due to floating-point errors)
+        for (uint32_t i = 0; i < large_slot_idxes.size(); i++)
+        {
+            alias_slots_[large_slot_idxes[i]].threshold = UINT32_MAX;
+            alias_slots_[large_slot_idxes[i]].alias = large_slot_idxes[i];
+        }
+        for (uint32_t i = 0; i < small_slot_idxes.size(); i++)
+        {
+            alias_slots_[small_slot_idxes[i]].threshold = UINT32_MAX;
+            alias_slots_[small_slot_idxes[i]].alias = small_slot_idxes[i];
+        }
+    }
+
+    AliasSampler::~AliasSampler() {}
+
+    uint32_t AliasSampler::sample(std::mt19937_64& randgen) const
+    {
+        const uint64_t tmp_random = randgen();
+
+        // Select a slot by multiply-shift of the higher 32 bits (NO modulo)
+        const uint32_t tmp_slot_idx = static_cast<uint32_t>(((tmp_random >> 32) * static_cast<uint64_t>(alias_slots_.size())) >> 32);
+        assert(tmp_slot_idx < alias_slots_.size());
+
+        // Toss a biased coin by the lower 32 bits
+        const AliasSlot& tmp_alias_slot = alias_slots_[tmp_slot_idx];
+        if (static_cast<uint32_t>(tmp_random) < tmp_alias_slot.threshold)
+        {
+            return tmp_slot_idx;
+        }
+        return tmp_alias_slot.alias;
+    }
+
+    uint32_t AliasSampler::getSlotcnt() const
+    {
+        return alias_slots_.size();
+    }
+
+    uint64_t AliasSampler::getSizeForCapacity() const
+    {
+        return alias_slots_.size() * sizeof(AliasSlot);
+    }
+}
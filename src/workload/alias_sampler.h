@@ -0,0 +1,40 @@
+/*
+ * AliasSampler: an immutable Walker/Vose alias table to sample indexes from a discrete distribution in O(1) (thread safe).
+ *
+ * NOTE: the table is built once per workload and shared read-only by all client workers, while each worker passes its own random generator (the ONLY per-worker state); unlike std::discrete_distribution (CDF table + O(log n) binary search per sample), each sample takes a single 64-bit random number, whose higher 32 bits select a slot and lower 32 bits decide between the slot and its alias.
+ */
+
+#ifndef ALIAS_SAMPLER_H
+#define ALIAS_SAMPLER_H
+
+#include <random> // std::mt19937_64
+#include <string>
+#include <vector>
+
+namespace covered
+{
+    class AliasSampler
+    {
+    public:
+        AliasSampler(const std::vector<double>& probs); // NOTE: probs are NOT required to be normalized
+        ~AliasSampler();
+
+        uint32_t sample(std::mt19937_64& randgen) const; // Return an index within [0, slotcnt)
+
+        uint32_t getSlotcnt() const;
+        uint64_t getSizeForCapacity() const;
+    private:
+        static const std::string kClassName;
+
+        // NOTE: slot_idx is returned if the lower 32 bits of a random number < threshold, otherwise alias is returned (alias = slot_idx for full slots)
+        struct AliasSlot
+        {
+            uint32_t threshold;
+            uint32_t alias;
+        };
+
+        std::vector<AliasSlot> alias_slots_;
+    };
+}
+
+#endif
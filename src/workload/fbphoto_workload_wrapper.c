@@ -156,7 +156,7 @@ namespace covered
 
         // Get index
         uint32_t tmp_keyint = 0;
-        memcpy((char *)&tmp_keyint, key.getKeystr().c_str(), sizeof(uint32_t));
+        memcpy((char *)&tmp_keyint, key.getKeystrView().data(), sizeof(uint32_t));
         uint32_t tmp_key_index = tmp_keyint - 1;
         assert(tmp_key_index < dataset_keys_.size()); // Should not access an unexisting key during warmup
         assert(dataset_keys_[tmp_key_index] == tmp_keyint);
@@ -176,7 +176,7 @@ namespace covered
 
         // Get index
         uint32_t tmp_keyint = 0;
-        memcpy((char *)&tmp_keyint, key.getKeystr().c_str(), sizeof(uint32_t));
+        memcpy((char *)&tmp_keyint, key.getKeystrView().data(), sizeof(uint32_t));
         uint32_t tmp_key_index = tmp_keyint - 1;
         assert(tmp_key_index < dataset_keys_.size()); // Should not access an unexisting key during warmup
         assert(dataset_keys_[tmp_key_index] == tmp_keyint);
@@ -1,8 +1,17 @@
 #include "workload/replayed_workload_wrapper_base.h"
 
+#include <algorithm> // std::max
 #include <assert.h>
+#include <errno.h>
+#include <fcntl.h> // O_RDONLY
+#include <pthread.h>
 #include <sstream>
+#include <string.h> // memchr
+#include <sys/mman.h> // mmap, madvise, and munmap
+#include <unistd.h> // lseek
 
+#include "common/config.h"
+#include "common/thread_launcher.h"
 #include "common/util.h"
 
 namespace covered
@@ -12,6 +21,8 @@ namespace covered
     const uint32_t ReplayedWorkloadWrapperBase::PHASE_FOR_WORKLOAD_SAMPLE_RATIO = 0;
     const uint32_t ReplayedWorkloadWrapperBase::PHASE_FOR_WORKLOAD_SAMPLE = 1;
 
+    const int64_t ReplayedWorkloadWrapperBase::TRACE_CHUNK_SIZE = MB2B(64); // NOTE: NOT too large to bound memory usage of parsed workload items in each window of trace chunks
+
     ReplayedWorkloadWrapperBase::ReplayedWorkloadWrapperBase(const uint32_t& clientcnt, const uint32_t& client_idx, const uint32_t& keycnt, const uint32_t& perclient_opcnt, const uint32_t& perclient_workercnt, const std::string& workload_name, const std::string& workload_usage_role, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period, const uint32_t& dynamic_change_keycnt, const uint32_t& workload_randombase) : WorkloadWrapperBase(clientcnt, client_idx, keycnt, perclient_opcnt, perclient_workercnt, workload_name, workload_usage_role, workload_pattern_name, dynamic_change_period, dynamic_change_keycnt, workload_randombase)
     {
         // Differentiate workload generator in different clients
@@ -37,10 +48,10 @@ namespace covered
         max_dataset_valuesize_ = 0;
         dataset_lookup_table_.clear();
         dataset_kvpairs_.clear();
+        sampled_dataset_file_ptr_ = NULL;
 
         // For clients
-        curclient_workload_keys_.clear();
-        curclient_workload_value_sizes_.clear();
+        sampled_workload_file_ptr_ = NULL;
         curclient_ranked_unique_keys_.clear();
 
         per_client_worker_workload_idx_.resize(perclient_workercnt);
@@ -63,6 +74,20 @@ namespace covered
             delete workload_sample_dist_ptr_;
             workload_sample_dist_ptr_ = NULL;
         }
+
+        // For dataset loader and cloud
+        if (sampled_dataset_file_ptr_ != NULL)
+        {
+            delete sampled_dataset_file_ptr_;
+            sampled_dataset_file_ptr_ = NULL;
+        }
+
+        // For clients
+        if (sampled_workload_file_ptr_ != NULL)
+        {
+            delete sampled_workload_file_ptr_;
+            sampled_workload_file_ptr_ = NULL;
+        }
     }
 
     uint32_t ReplayedWorkloadWrapperBase::getPracticalKeycnt() const
@@ -73,7 +98,12 @@ namespace covered
         assert(Util::isReplayedWorkload(getWorkloadName_()));
         assert(needDatasetItems_());
 
-        int64_t dataset_size = dataset_kvpairs_.size();
+        if (sampled_dataset_file_ptr_ != NULL) // Dataset loader and cloud
+        {
+            return sampled_dataset_file_ptr_->getItemcnt();
+        }
+
+        int64_t dataset_size = dataset_kvpairs_.size(); // Preprocessor
         return Util::toUint32(dataset_size);
     }
 
@@ -84,7 +114,12 @@ namespace covered
         assert(needDatasetItems_());
         assert(itemidx < getPracticalKeycnt());
 
-        const Key tmp_covered_key = dataset_kvpairs_[itemidx].first;
+        if (sampled_dataset_file_ptr_ != NULL) // Dataset loader and cloud
+        {
+            return WorkloadItem(sampled_dataset_file_ptr_->getKey(itemidx), sampled_dataset_file_ptr_->getDatasetValue(itemidx), WorkloadItemType::kWorkloadItemPut);
+        }
+
+        const Key tmp_covered_key = dataset_kvpairs_[itemidx].first; // Preprocessor
         const Value tmp_covered_value = dataset_kvpairs_[itemidx].second;
         return WorkloadItem(tmp_covered_key, tmp_covered_value, WorkloadItemType::kWorkloadItemPut);
     }
@@ -209,14 +244,16 @@ namespace covered
 
         assert(needWorkloadItems_()); // Must be clients for evaluation
         
+        assert(sampled_workload_file_ptr_ != NULL);
+        const uint32_t curclient_workload_size = sampled_workload_file_ptr_->getItemcnt();
         uint32_t curclient_workload_idx = per_client_worker_workload_idx_[local_client_worker_idx];
-        assert(curclient_workload_idx < curclient_workload_keys_.size());
+        assert(curclient_workload_idx < curclient_workload_size);
 
-        // Get key, value, and type
-        Key tmp_key = curclient_workload_keys_[curclient_workload_idx];
+        // Get key, value, and type from mmaped workload file
+        Key tmp_key = sampled_workload_file_ptr_->getKey(curclient_workload_idx);
         Value tmp_value;
         WorkloadItemType tmp_type = WorkloadItemType::kWorkloadItemGet;
-        int tmp_workload_valuesize = curclient_workload_value_sizes_[curclient_workload_idx];
+        int tmp_workload_valuesize = sampled_workload_file_ptr_->getCodedValueSize(curclient_workload_idx);
         if (tmp_workload_valuesize == 0)
         {
             tmp_type = WorkloadItemType::kWorkloadItemDel;
@@ -229,7 +266,7 @@ namespace covered
         }
 
         // Update for the next workload idx
-        uint32_t next_curclient_workload_idx = (curclient_workload_idx + getPerclientWorkercnt_()) % curclient_workload_keys_.size();
+        uint32_t next_curclient_workload_idx = (curclient_workload_idx + getPerclientWorkercnt_()) % curclient_workload_size;
         per_client_worker_workload_idx_[local_client_worker_idx] = next_curclient_workload_idx;
 
         return WorkloadItem(tmp_key, tmp_value, tmp_type);
@@ -252,13 +289,13 @@ namespace covered
             parseTraceFiles_(PHASE_FOR_WORKLOAD_SAMPLE); // Will invoke updateDatasetOrSampleWorkload_() to update and sample dataset and workload items for trace preprocessor
 
             // Dump dataset file by trace preprocessor for dataset loader and cloud
-            const uint32_t dataset_filesize = dumpDatasetFile_();
+            const uint64_t dataset_filesize = dumpDatasetFile_();
             std::ostringstream oss;
             oss << "dump dataset file (" << dataset_filesize << " bytes) for workload " << getWorkloadName_();
             Util::dumpNormalMsg(base_instance_name_, oss.str());
 
             // Dump sampled workload file
-            const uint32_t workload_filesize = dumpWorkloadFile_();
+            const uint64_t workload_filesize = dumpWorkloadFile_();
             oss.clear();
             oss.str("");
             oss << "dump workload file (" << workload_filesize << " bytes) for workload " << getWorkloadName_();
@@ -266,7 +303,7 @@ namespace covered
         }
         else if (needWorkloadItems_()) // Need workload file for workload items (clients)
         {
-            const uint32_t workload_filesize = loadWorkloadFile_(); // Load workload file for clients (will update curclient_workload_keys_ and curclient_workload_value_sizes_)
+            const uint64_t workload_filesize = loadWorkloadFile_(); // Load workload file for clients (will update sampled_workload_file_ptr_)
                 
             std::ostringstream oss;
             oss << "load workload file (" << workload_filesize << " bytes) for workload " << getWorkloadName_();
@@ -274,7 +311,7 @@ namespace covered
         }
         else if (needDatasetItems_()) // Need dataset items for dataset loader and cloud for warmup speedup
         {
-            const uint32_t dataset_filesize = loadDatasetFile_(); // Load dataset for dataset loader and cloud (will update dataset_kvpairs_, dataset_lookup_table_, and dataset statistics)
+            const uint64_t dataset_filesize = loadDatasetFile_(); // Load dataset for dataset loader and cloud (will update sampled_dataset_file_ptr_ and dataset statistics)
 
             std::ostringstream oss;
             oss << "load dataset file (" << dataset_filesize << " bytes) for workload " << getWorkloadName_();
@@ -405,7 +442,7 @@ namespace covered
         return;
     }
 
-    uint32_t ReplayedWorkloadWrapperBase::dumpDatasetFile_() const
+    uint64_t ReplayedWorkloadWrapperBase::dumpDatasetFile_() const
     {
         assert(Util::isReplayedWorkload(getWorkloadName_()));
         assert(needAllTraceFiles_()); // Trace preprocessor
@@ -413,51 +450,20 @@ namespace covered
         const std::string tmp_dataset_filepath = Util::getSampledDatasetFilepath(getWorkloadName_());
         assert(!Util::isFileExist(tmp_dataset_filepath, true)); // Must NOT exist (already verified by verifyDatasetAndWorkloadFile_() before)
 
-        // Create and open a binary file for dumping dataset by trace preprocessor
+        // Create and dump a columnar binary file for dataset by trace preprocessor
         // NOTE: trace preprocessor is a single-thread program and hence ONLY one dataset file will be created for each given workload
         std::ostringstream oss;
         oss << "open file " << tmp_dataset_filepath << " for dumping " << dataset_kvpairs_.size() << " sampled dataset of " << getWorkloadName_() << " with trace sample opcnt " << Config::getTraceSampleOpcnt(getWorkloadName_()) << " and total workload opcnt " << total_workload_opcnt_ << " (workload sample ratio " << workload_sample_ratio_ << ")";
         Util::dumpNormalMsg(base_instance_name_, oss.str());
-        std::fstream* fs_ptr = Util::openFile(tmp_dataset_filepath, std::ios_base::out | std::ios_base::binary);
-        assert(fs_ptr != NULL);
-
-        // Dump key-value pairs of dataset
-        // Format: dataset size, key, value, key, value, ...
-        uint32_t size = 0;
-        // (0) dataset size
-        const uint32_t dataset_size = dataset_kvpairs_.size();
-        assert(dataset_size > 0);
-        fs_ptr->write((const char*)&dataset_size, sizeof(uint32_t));
-        size += sizeof(uint32_t);
-        // (1) key-value pairs
-        const bool is_value_space_efficient = true; // NOT serialize value content
-        for (uint32_t i = 0; i < dataset_size; i++)
-        {
-            // Key
-            const Key& tmp_key = dataset_kvpairs_[i].first;
-            const uint32_t key_serialize_size = tmp_key.serialize(fs_ptr);
-            size += key_serialize_size;
-
-            // Must be sampled key
-            std::unordered_map<Key, uint32_t, KeyHasher>::const_iterator tmp_iter = dataset_lookup_table_.find(tmp_key);
-            assert(tmp_iter != dataset_lookup_table_.end());
-
-            // Value
-            const Value& tmp_value = dataset_kvpairs_[i].second;
-            const uint32_t value_serialize_size = tmp_value.serialize(fs_ptr, is_value_space_efficient);
-            assert(value_serialize_size == tmp_value.getValuePayloadSize(is_value_space_efficient));
-            size += value_serialize_size;
-        }
 
-        // Close file and release ofstream
-        fs_ptr->close();
-        delete fs_ptr;
-        fs_ptr = NULL;
+        // Format: see SampledTraceFile (key offsets, value sizes, key arena, and prebuilt key index)
+        assert(dataset_kvpairs_.size() == dataset_lookup_table_.size()); // Must be sampled keys
+        const uint64_t size = SampledTraceFile::dumpDatasetFile(tmp_dataset_filepath, dataset_kvpairs_, average_dataset_keysize_, average_dataset_valuesize_, min_dataset_keysize_, min_dataset_valuesize_, max_dataset_keysize_, max_dataset_valuesize_);
 
-        return size - 0;
+        return size;
     }
 
-    uint32_t ReplayedWorkloadWrapperBase::dumpWorkloadFile_() const
+    uint64_t ReplayedWorkloadWrapperBase::dumpWorkloadFile_() const
     {
         assert(Util::isReplayedWorkload(getWorkloadName_()));
         assert(needAllTraceFiles_()); // Trace preprocessor
@@ -465,47 +471,21 @@ namespace covered
         const std::string tmp_workload_filepath = Util::getSampledWorkloadFilepath(getWorkloadName_());
         assert(!Util::isFileExist(tmp_workload_filepath, true)); // Must NOT exist (already verified by verifyDatasetAndWorkloadFile_() before)
 
-        // Create and open a binary file for dumping sampled workload items by trace preprocessor
+        // Create and dump a columnar binary file for sampled workload items by trace preprocessor
         // NOTE: trace preprocessor is a single-thread program and hence ONLY one workload file will be created for each given workload
         std::ostringstream oss;
         oss << "open file " << tmp_workload_filepath << " for dumping " << sample_workload_keys_.size() << " sampled workload items of " << getWorkloadName_() << " with trace sample opcnt " << Config::getTraceSampleOpcnt(getWorkloadName_()) << " and total workload opcnt " << total_workload_opcnt_ << " (workload sample ratio " << workload_sample_ratio_ << ")";
         Util::dumpNormalMsg(base_instance_name_, oss.str());
-        std::fstream* fs_ptr = Util::openFile(tmp_workload_filepath, std::ios_base::out | std::ios_base::binary);
-        assert(fs_ptr != NULL);
-
-        // Dump key-value pairs of dataset
-        // Format: sampled workload size, key, coded value size, key coded value size, ...
-        uint32_t size = 0;
-        // (0) sampled workload size
-        const uint32_t sampled_workload_size = sample_workload_keys_.size();
-        assert(sampled_workload_size > 0);
-        fs_ptr->write((const char*)&sampled_workload_size, sizeof(uint32_t));
-        size += sizeof(uint32_t);
-        // (1) key-valuesize pairs
-        for (uint32_t i = 0; i < sampled_workload_size; i++)
-        {
-            // Key
-            const Key& tmp_key = sample_workload_keys_[i];
-            const uint32_t key_serialize_size = tmp_key.serialize(fs_ptr);
-            size += key_serialize_size;
-
-            // Coded value size (< 0: read; = 0: delete; > 0: write)
-            const int tmp_coded_value_size = sample_workload_value_sizes_[i];
-            fs_ptr->write((const char*)&tmp_coded_value_size, sizeof(int));
-            size += sizeof(int);
-        }
 
-        // Close file and release ofstream
-        fs_ptr->close();
-        delete fs_ptr;
-        fs_ptr = NULL;
+        // Format: see SampledTraceFile (key offsets, coded value sizes, and key arena)
+        const uint64_t size = SampledTraceFile::dumpWorkloadFile(tmp_workload_filepath, sample_workload_keys_, sample_workload_value_sizes_);
 
-        return size - 0;
+        return size;
     }
 
     // (2) For role of dataset loader and cloud (ONLY for replayed traces)
 
-    uint32_t ReplayedWorkloadWrapperBase::loadDatasetFile_()
+    uint64_t ReplayedWorkloadWrapperBase::loadDatasetFile_()
     {
         assert(Util::isReplayedWorkload(getWorkloadName_()));
         assert(getWorkloadUsageRole_() == WORKLOAD_USAGE_ROLE_LOADER || getWorkloadUsageRole_() == WORKLOAD_USAGE_ROLE_CLOUD); // dataset loader and cloud
@@ -522,46 +502,24 @@ namespace covered
             exit(1);
         }
 
-        // Open the existing binary file for sampled dataset items
+        // mmap the existing columnar binary file for sampled dataset items
         std::ostringstream oss;
         oss << "open file " << tmp_sampled_dataset_filepath << " for loading dataset of " << getWorkloadName_();
         Util::dumpNormalMsg(base_instance_name_, oss.str());
-        std::fstream* fs_ptr = Util::openFile(tmp_sampled_dataset_filepath, std::ios_base::in | std::ios_base::binary);
-        assert(fs_ptr != NULL);
-
-        // Load dataset key-value pairs from dataset file
-        // Format: dataset size, key, value, key, value, ...
-        uint32_t size = 0;
-        // (0) dataset size
-        uint32_t dataset_size = 0;
-        fs_ptr->read((char *)&dataset_size, sizeof(uint32_t));
-        size += sizeof(uint32_t);
-        // (1) key-value pairs
-        const bool is_value_space_efficient = true; // NOT deserialize value content
-        for (uint32_t i = 0; i < dataset_size; i++)
-        {
-            // Key
-            Key tmp_key;
-            uint32_t key_deserialize_size = tmp_key.deserialize(fs_ptr);
-            size += key_deserialize_size;
-
-            // Value
-            Value tmp_value;
-            uint32_t value_deserialize_size = tmp_value.deserialize(fs_ptr, is_value_space_efficient);
-            size += value_deserialize_size;
-
-            // Update dataset and dataset statistics
-            const uint32_t unused_preprocess_phase = 0; // NOTE: preprocess phase is NOT used for dataset loader and cloud
-            bool tmp_is_achieve_trace_sample_opcnt = updateDatasetOrSampleWorkload_(tmp_key, tmp_value, unused_preprocess_phase);
-            assert(!tmp_is_achieve_trace_sample_opcnt); // NOTE: ONLY trace preprocessor can achieve trace sample opcnt
-        }
-
-        // Close file and release ifstream
-        fs_ptr->close();
-        delete fs_ptr;
-        fs_ptr = NULL;
-
-        return size - 0;
+        const bool is_writable_value_sizes = (getWorkloadUsageRole_() == WORKLOAD_USAGE_ROLE_CLOUD); // NOTE: ONLY cloud updates dataset values for warmup speedup
+        assert(sampled_dataset_file_ptr_ == NULL);
+        sampled_dataset_file_ptr_ = new SampledTraceFile(tmp_sampled_dataset_filepath, SampledTraceFileType::kSampledDatasetFile, is_writable_value_sizes);
+        assert(sampled_dataset_file_ptr_ != NULL);
+
+        // Dataset statistics are precomputed by trace preprocessor
+        average_dataset_keysize_ = sampled_dataset_file_ptr_->getAvgKeysize();
+        average_dataset_valuesize_ = sampled_dataset_file_ptr_->getAvgValuesize();
+        min_dataset_keysize_ = sampled_dataset_file_ptr_->getMinKeysize();
+        min_dataset_valuesize_ = sampled_dataset_file_ptr_->getMinValuesize();
+        max_dataset_keysize_ = sampled_dataset_file_ptr_->getMaxKeysize();
+        max_dataset_valuesize_ = sampled_dataset_file_ptr_->getMaxValuesize();
+
+        return sampled_dataset_file_ptr_->getFilesize();
     }
 
     // (3) For role of cloud for warmup speedup (ONLY for replayed traces)
@@ -571,22 +529,21 @@ namespace covered
         assert(Util::isReplayedWorkload(getWorkloadName_()));
         assert(getWorkloadUsageRole_() == WORKLOAD_USAGE_ROLE_CLOUD); // cloud
 
-        // Check dataset lookup table
-        std::unordered_map<Key, uint32_t, KeyHasher>::const_iterator tmp_iter = dataset_lookup_table_.find(key);
-        if (tmp_iter == dataset_lookup_table_.end())
+        // Check prebuilt key index of mmaped dataset file
+        assert(sampled_dataset_file_ptr_ != NULL);
+        uint32_t tmp_itemidx = 0;
+        bool is_exist = sampled_dataset_file_ptr_->lookup(key, tmp_itemidx);
+        if (!is_exist)
         {
             // Key must exist
             std::ostringstream oss;
-            oss << "key " << key.getKeyDebugstr() << " does not exist in dataset (lookup table size: " << dataset_lookup_table_.size() << "; dataset size: " << dataset_kvpairs_.size() << ") for quick get!";
+            oss << "key " << key.getKeyDebugstr() << " does not exist in dataset (dataset size: " << sampled_dataset_file_ptr_->getItemcnt() << ") for quick get!";
             Util::dumpErrorMsg(base_instance_name_, oss.str());
             exit(1);
         }
 
         // Get value
-        const uint32_t dataset_kvpairs_index = tmp_iter->second;
-        assert(dataset_kvpairs_index < dataset_kvpairs_.size());
-        assert(dataset_kvpairs_[dataset_kvpairs_index].first == key);
-        value = dataset_kvpairs_[dataset_kvpairs_index].second;
+        value = sampled_dataset_file_ptr_->getDatasetValue(tmp_itemidx);
 
         return;
     }
@@ -596,15 +553,15 @@ namespace covered
         assert(Util::isReplayedWorkload(getWorkloadName_()));
         assert(getWorkloadUsageRole_() == WORKLOAD_USAGE_ROLE_CLOUD); // cloud
 
-        // Check dataset lookup table
-        std::unordered_map<Key, uint32_t, KeyHasher>::const_iterator tmp_iter = dataset_lookup_table_.find(key);
-        assert(tmp_iter != dataset_lookup_table_.end()); // Key must exist
+        // Check prebuilt key index of mmaped dataset file
+        assert(sampled_dataset_file_ptr_ != NULL);
+        uint32_t tmp_itemidx = 0;
+        bool is_exist = sampled_dataset_file_ptr_->lookup(key, tmp_itemidx);
+        assert(is_exist); // Key must exist
+        UNUSED(is_exist);
 
-        // Put value
-        const uint32_t dataset_kvpairs_index = tmp_iter->second;
-        assert(dataset_kvpairs_index < dataset_kvpairs_.size());
-        assert(dataset_kvpairs_[dataset_kvpairs_index].first == key);
-        dataset_kvpairs_[dataset_kvpairs_index].second = value;
+        // Put value (copy-on-write of mmaped value sizes)
+        sampled_dataset_file_ptr_->setDatasetValue(tmp_itemidx, value);
 
         return;
     }
@@ -618,7 +575,7 @@ namespace covered
 
     // (4) For role of clients during evaluation
 
-    uint32_t ReplayedWorkloadWrapperBase::loadWorkloadFile_()
+    uint64_t ReplayedWorkloadWrapperBase::loadWorkloadFile_()
     {
         assert(Util::isReplayedWorkload(getWorkloadName_()));
         assert(needWorkloadItems_()); // clients for evaluation
@@ -635,71 +592,53 @@ namespace covered
             exit(1);
         }
 
-        // Open the existing binary file for sampled workload items
+        // mmap the existing columnar binary file for sampled workload items (read-only)
         std::ostringstream oss;
         oss << "open file " << tmp_sampled_workload_filepath << " for loading sampled workload items of " << getWorkloadName_();
         Util::dumpNormalMsg(base_instance_name_, oss.str());
-        std::fstream* fs_ptr = Util::openFile(tmp_sampled_workload_filepath, std::ios_base::in | std::ios_base::binary);
-        assert(fs_ptr != NULL);
-
-        // Count per-key freq for dynamic workload patterns
-        std::unordered_map<Key, uint32_t, KeyHasher> tmp_key_freq_map;
-
-        // Load sampled workload key-valuesize pairs from dataset file
-        // Format: sampled workload size, key, coded value size, key, coded value size, ...
-        uint32_t size = 0;
-        // (0) sampled workload size
-        uint32_t sampled_workload_size = 0;
-        fs_ptr->read((char *)&sampled_workload_size, sizeof(uint32_t));
-        size += sizeof(uint32_t);
-        // (1) key-valuesize pairs
-        for (uint32_t i = 0; i < sampled_workload_size; i++)
-        {
-            // Key
-            Key tmp_key;
-            uint32_t key_deserialize_size = tmp_key.deserialize(fs_ptr);
-            size += key_deserialize_size;
-
-            // Coded value size
-            int tmp_coded_value_size = -1;
-            fs_ptr->read((char *)&tmp_coded_value_size, sizeof(int));
-            size += sizeof(int);
-
-            // Update current client workload key-value pairs
-            curclient_workload_keys_.push_back(tmp_key);
-            curclient_workload_value_sizes_.push_back(tmp_coded_value_size);
-
-            // Update per-key freq map for dynamic workload patterns
-            if (tmp_key_freq_map.find(tmp_key) == tmp_key_freq_map.end())
+        const bool is_writable_value_sizes = false;
+        assert(sampled_workload_file_ptr_ == NULL);
+        sampled_workload_file_ptr_ = new SampledTraceFile(tmp_sampled_workload_filepath, SampledTraceFileType::kSampledWorkloadFile, is_writable_value_sizes);
+        assert(sampled_workload_file_ptr_ != NULL);
+        const uint32_t sampled_workload_size = sampled_workload_file_ptr_->getItemcnt();
+        assert(sampled_workload_size > 0);
+        UNUSED(sampled_workload_size);
+
+        // NOTE: ONLY dynamic workload patterns need rank information, which requires to scan all workload items
+        curclient_ranked_unique_keys_.clear(); // Clear for safety
+        if (Util::isDynamicWorkloadPattern(getWorkloadPatternName_()))
+        {
+            // Count per-key freq for dynamic workload patterns
+            std::unordered_map<Key, uint32_t, KeyHasher> tmp_key_freq_map;
+            for (uint32_t i = 0; i < sampled_workload_size; i++)
             {
-                tmp_key_freq_map.insert(std::pair<Key, uint32_t>(tmp_key, 1));
+                const Key tmp_key = sampled_workload_file_ptr_->getKey(i);
+                std::unordered_map<Key, uint32_t, KeyHasher>::iterator tmp_key_freq_map_iter = tmp_key_freq_map.find(tmp_key);
+                if (tmp_key_freq_map_iter == tmp_key_freq_map.end())
+                {
+                    tmp_key_freq_map.insert(std::pair<Key, uint32_t>(tmp_key, 1));
+                }
+                else
+                {
+                    tmp_key_freq_map_iter->second += 1;
+                }
             }
-            else
+
+            // Sort per-key freq map by freq in descending order
+            std::multimap<uint32_t, Key, std::greater<uint32_t>> tmp_sorted_key_freq_map;
+            for (std::unordered_map<Key, uint32_t, KeyHasher>::const_iterator iter = tmp_key_freq_map.begin(); iter != tmp_key_freq_map.end(); iter++)
             {
-                tmp_key_freq_map[tmp_key] += 1;
+                tmp_sorted_key_freq_map.insert(std::pair<uint32_t, Key>(iter->second, iter->first));
             }
-        }
-
-        // Sort per-key freq map by freq in descending order
-        std::multimap<uint32_t, Key, std::greater<uint32_t>> tmp_sorted_key_freq_map;
-        for (std::unordered_map<Key, uint32_t, KeyHasher>::const_iterator iter = tmp_key_freq_map.begin(); iter != tmp_key_freq_map.end(); iter++)
-        {
-            tmp_sorted_key_freq_map.insert(std::pair<uint32_t, Key>(iter->second, iter->first));
-        }
 
-        // Update rank information for dynamic workload patterns
-        curclient_ranked_unique_keys_.clear(); // Clear for safety
-        for (std::multimap<uint32_t, Key, std::greater<uint32_t>>::const_iterator iter = tmp_sorted_key_freq_map.begin(); iter != tmp_sorted_key_freq_map.end(); iter++)
-        {
-            curclient_ranked_unique_keys_.push_back(iter->second);
+            // Update rank information for dynamic workload patterns
+            for (std::multimap<uint32_t, Key, std::greater<uint32_t>>::const_iterator iter = tmp_sorted_key_freq_map.begin(); iter != tmp_sorted_key_freq_map.end(); iter++)
+            {
+                curclient_ranked_unique_keys_.push_back(iter->second);
+            }
         }
 
-        // Close file and release ifstream
-        fs_ptr->close();
-        delete fs_ptr;
-        fs_ptr = NULL;
-
-        return size - 0;
+        return sampled_workload_file_ptr_->getFilesize();
     }
 
     // (5) Common utilities (ONLY for replayed traces)
@@ -781,22 +720,13 @@ namespace covered
                 is_achieve_trace_sample_opcnt = true;
             }
         }
-        else // Dataset loader and cloud (dataset file)
+        else // Dataset loader and cloud
         {
-            UNUSED(preprocess_phase);
-
-            // NOTE: count all dataset items from dataset file
-            std::unordered_map<Key, uint32_t, KeyHasher>::iterator tmp_dataset_lookup_table_iter = dataset_lookup_table_.find(key);
-            if (tmp_dataset_lookup_table_iter == dataset_lookup_table_.end()) // The first request on the key
-            {
-                const uint32_t original_dataset_size = dataset_kvpairs_.size();
-                dataset_kvpairs_.push_back(std::pair(key, value));
-                tmp_dataset_lookup_table_iter = dataset_lookup_table_.insert(std::pair(key, original_dataset_size)).first; // Must be true due to NO sampling for dataset items from dataset file
-
-                // Update dataset statistics
-                updateDatasetStatistics_(key, value, original_dataset_size);
-            }
-            assert(tmp_dataset_lookup_table_iter != dataset_lookup_table_.end());
+            // NOTE: dataset loader and cloud mmap the sampled dataset file and use it in place instead of updating dataset items one by one
+            std::ostringstream oss;
+            oss << "workload usage role " << getWorkloadUsageRole_() << " should use the mmaped sampled dataset file instead of updateDatasetOrSampleWorkload_() (preprocess phase: " << preprocess_phase << ")";
+            Util::dumpErrorMsg(base_instance_name_, oss.str());
+            exit(1);
         }
 
         return is_achieve_trace_sample_opcnt;
@@ -826,4 +756,174 @@ namespace covered
 
         return;
     }
+
+    // (6) For role of trace preprocessor (parallel chunked parsing)
+
+    void ReplayedWorkloadWrapperBase::parseTraceFile_(const std::string& trace_filepath, const bool& with_title_line, const uint32_t& preprocess_phase, bool& is_achieve_trace_sample_opcnt)
+    {
+        assert(needAllTraceFiles_()); // Must be trace preprocessor
+
+        // Check if file exists
+        bool is_exist = Util::isFileExist(trace_filepath, true);
+        if (!is_exist)
+        {
+            std::ostringstream oss;
+            oss << "trace file " << trace_filepath << " does not exist!";
+            Util::dumpErrorMsg(base_instance_name_, oss.str());
+            exit(1);
+        }
+
+        // Get file length
+        int tmp_fd = Util::openFile(trace_filepath, O_RDONLY);
+        int64_t tmp_filelen = lseek(tmp_fd, 0, SEEK_END);
+        assert(tmp_filelen > 0);
+
+        // Map the entire trace file (read-only and sequential) to be shared by all trace chunk parsers
+        // NOTE: chunks are newline-aligned, so NO need to concatenate tail data across mmap blocks
+        char* tmp_file_buffer = (char*) mmap(NULL, tmp_filelen, PROT_READ, MAP_PRIVATE, tmp_fd, 0);
+        if (tmp_file_buffer == MAP_FAILED)
+        {
+            std::ostringstream oss;
+            oss << "failed to mmap trace file " << trace_filepath << " (errno: " << errno << ")";
+            Util::dumpErrorMsg(base_instance_name_, oss.str());
+            exit(1);
+        }
+        madvise(tmp_file_buffer, tmp_filelen, MADV_SEQUENTIAL);
+        const char* tmp_file_endpos = tmp_file_buffer + tmp_filelen; // Exclusive
+
+        // Skip the title/metadata line if any
+        const char* tmp_chunk_startpos = tmp_file_buffer;
+        if (with_title_line)
+        {
+            const char* tmp_title_line_endpos = (const char*) memchr(tmp_chunk_startpos, Util::LINE_SEP_CHAR, tmp_filelen);
+            tmp_chunk_startpos = (tmp_title_line_endpos == NULL) ? tmp_file_endpos : tmp_title_line_endpos + 1;
+        }
+
+        // NOTE: trace preprocessor can occupy all dedicated CPU cores (see ThreadLauncher), and each window has at most one trace chunk per dedicated CPU core
+        const uint32_t trace_chunk_parsercnt = std::max(Config::getCurrentPhysicalMachine().getCpuDedicatedCorecnt(), static_cast<uint32_t>(1));
+        const bool is_count_only = (preprocess_phase == PHASE_FOR_WORKLOAD_SAMPLE_RATIO);
+        std::vector<TraceChunkParam> trace_chunk_params(trace_chunk_parsercnt);
+        std::vector<pthread_t> trace_chunk_parser_threads(trace_chunk_parsercnt);
+        while (!is_achieve_trace_sample_opcnt && tmp_chunk_startpos < tmp_file_endpos) // For each window of trace chunks
+        {
+            // Split the next window into newline-aligned trace chunks
+            uint32_t tmp_chunkcnt = 0;
+            while (tmp_chunkcnt < trace_chunk_parsercnt && tmp_chunk_startpos < tmp_file_endpos)
+            {
+                const char* tmp_chunk_endpos = tmp_file_endpos;
+                if (tmp_file_endpos - tmp_chunk_startpos > TRACE_CHUNK_SIZE)
+                {
+                    // Extend the chunk end to the next line start (i.e., the byte after the first line separator at or after the nominal chunk end - 1)
+                    const char* tmp_nominal_lastpos = tmp_chunk_startpos + TRACE_CHUNK_SIZE - 1;
+                    const char* tmp_line_sep_pos = (const char*) memchr(tmp_nominal_lastpos, Util::LINE_SEP_CHAR, tmp_file_endpos - tmp_nominal_lastpos);
+                    tmp_chunk_endpos = (tmp_line_sep_pos == NULL) ? tmp_file_endpos : tmp_line_sep_pos + 1;
+                }
+
+                TraceChunkParam& tmp_trace_chunk_param = trace_chunk_params[tmp_chunkcnt];
+                tmp_trace_chunk_param.workload_wrapper_ptr = this;
+                tmp_trace_chunk_param.chunk_startpos = tmp_chunk_startpos;
+                tmp_trace_chunk_param.chunk_endpos = tmp_chunk_endpos;
+                tmp_trace_chunk_param.is_count_only = is_count_only;
+                tmp_trace_chunk_param.linecnt = 0;
+                tmp_trace_chunk_param.kvpairs.clear();
+
+                tmp_chunk_startpos = tmp_chunk_endpos;
+                tmp_chunkcnt++;
+            }
+
+            // Launch trace chunk parsers for the current window
+            // NOTE: specify CPU core index explicitly, as trace chunk parsers are re-launched for each window
+            for (uint32_t tmp_parser_idx = 0; tmp_parser_idx < tmp_chunkcnt; tmp_parser_idx++)
+            {
+                std::string tmp_thread_name = "trace-chunk-parser-" + std::to_string(tmp_parser_idx);
+                const uint32_t tmp_cpuidx = tmp_parser_idx;
+                ThreadLauncher::pthreadCreateHighPriority(ThreadLauncher::TRACE_PREPROCESSOR_THREAD_ROLE, tmp_thread_name, &trace_chunk_parser_threads[tmp_parser_idx], launchTraceChunkParser_, (void*)(&trace_chunk_params[tmp_parser_idx]), &tmp_cpuidx);
+            }
+            for (uint32_t tmp_parser_idx = 0; tmp_parser_idx < tmp_chunkcnt; tmp_parser_idx++)
+            {
+                int pthread_returncode = pthread_join(trace_chunk_parser_threads[tmp_parser_idx], NULL); // void* retval = NULL
+                if (pthread_returncode != 0)
+                {
+                    std::ostringstream oss;
+                    oss << "failed to join trace chunk parser " << tmp_parser_idx << " (error code: " << pthread_returncode << ")" << std::endl;
+                    Util::dumpErrorMsg(base_instance_name_, oss.str());
+                    exit(1);
+                }
+            }
+
+            // Merge parsed trace chunks in trace order
+            for (uint32_t tmp_chunkidx = 0; tmp_chunkidx < tmp_chunkcnt && !is_achieve_trace_sample_opcnt; tmp_chunkidx++)
+            {
+                TraceChunkParam& tmp_trace_chunk_param = trace_chunk_params[tmp_chunkidx];
+                if (is_count_only) // Phase 0: update total opcnt (the same as invoking updateDatasetOrSampleWorkload_() for each line)
+                {
+                    for (uint32_t tmp_lineidx = 0; tmp_lineidx < tmp_trace_chunk_param.linecnt && !is_achieve_trace_sample_opcnt; tmp_lineidx++)
+                    {
+                        is_achieve_trace_sample_opcnt = updateDatasetOrSampleWorkload_(Key(), Value(), preprocess_phase);
+                    }
+                }
+                else // Phase 1: sample dataset and workload items by the single random generator in trace order
+                {
+                    for (uint32_t tmp_kvidx = 0; tmp_kvidx < tmp_trace_chunk_param.kvpairs.size() && !is_achieve_trace_sample_opcnt; tmp_kvidx++)
+                    {
+                        const std::pair<Key, Value>& tmp_kvpair = tmp_trace_chunk_param.kvpairs[tmp_kvidx];
+                        is_achieve_trace_sample_opcnt = updateDatasetOrSampleWorkload_(tmp_kvpair.first, tmp_kvpair.second, preprocess_phase);
+                    }
+                }
+
+                // Release parsed workload items of the current trace chunk
+                std::vector<std::pair<Key, Value>>().swap(tmp_trace_chunk_param.kvpairs);
+            }
+        } // End of windows of trace chunks
+
+        // Release memory mapping and close file
+        munmap(tmp_file_buffer, tmp_filelen);
+        Util::closeFile(tmp_fd);
+
+        return;
+    }
+
+    void* ReplayedWorkloadWrapperBase::launchTraceChunkParser_(void* trace_chunk_param_ptr)
+    {
+        assert(trace_chunk_param_ptr != NULL);
+        TraceChunkParam& tmp_trace_chunk_param = *((TraceChunkParam*)trace_chunk_param_ptr);
+        assert(tmp_trace_chunk_param.workload_wrapper_ptr != NULL);
+
+        tmp_trace_chunk_param.workload_wrapper_ptr->parseTraceChunk_(tmp_trace_chunk_param);
+
+        pthread_exit(NULL);
+        return NULL;
+    }
+
+    void ReplayedWorkloadWrapperBase::parseTraceChunk_(TraceChunkParam& trace_chunk_param) const
+    {
+        assert(trace_chunk_param.chunk_startpos <= trace_chunk_param.chunk_endpos);
+
+        const char* tmp_line_startpos = trace_chunk_param.chunk_startpos;
+        while (tmp_line_startpos < trace_chunk_param.chunk_endpos) // For each line in the current trace chunk
+        {
+            // Find the end of the current line
+            const char* tmp_line_endpos = (const char*) memchr(tmp_line_startpos, Util::LINE_SEP_CHAR, trace_chunk_param.chunk_endpos - tmp_line_startpos);
+            if (tmp_line_endpos == NULL)
+            {
+                // NOTE: ONLY the last line of a trace file may NOT have a line separator, which is skipped as a possibly-truncated line
+                break;
+            }
+
+            trace_chunk_param.linecnt++;
+            if (!trace_chunk_param.is_count_only)
+            {
+                // Process the current line to get key and value
+                Key tmp_key;
+                Value tmp_value;
+                parseTraceLine_(tmp_line_startpos, tmp_line_endpos, tmp_key, tmp_value);
+                trace_chunk_param.kvpairs.push_back(std::pair<Key, Value>(tmp_key, tmp_value));
+            }
+
+            // Switch to the next line
+            tmp_line_startpos = tmp_line_endpos + 1;
+        }
+
+        return;
+    }
 }
\ No newline at end of file
@@ -9,6 +9,10 @@
  * --> Approach 1: use std::bernoulli_distribution with probability of workload_sample_ratio_ to make a decision for each workload item -> after n independent trials (time complexity is O(n)), will finally get trace_sample_opcnt_ items.
  * --> Approach 2: use std::shuffle to randomly rearrange the order of total workload items, and then choose the first trace_sample_opcnt_ items -> time complexity of std::shuffle is O(n), which needs to generate n random numbers to swap items from end to begin of total workload items.
  * --> Here we use approach 1, which can perform sampling for each workload item individually, while std::shuffle in approach 2 needs all workload items before sampling (may exceed total memory capacity) and require 3 memory copies due to in-place swapping.
+ *
+ * NOTE: trace preprocessor dumps sampled dataset/workload files in the columnar format of SampledTraceFile, which are mmaped and used in place by dataset loader, cloud, and clients (NO parsing and per-key heap allocation at startup; page cache is shared by processes in the same machine).
+ *
+ * NOTE: trace preprocessor splits each trace file into newline-aligned chunks, which are parsed by multiple trace chunk parser threads (one per dedicated CPU core) in windows of chunks; parsed workload items are then merged by the main thread in trace order, such that Bernoulli sampling still consumes the single random generator in the same order -> sampled dataset/workload files are the same as single-threaded preprocessing.
  * 
  * By Siyuan Sheng (2024.02.26).
  */
@@ -17,7 +21,10 @@
 #define REPLAYED_WORKLOAD_WRAPPER_BASE_H
 
 #include <random> // std::mt19937 and std::bernoulli_distribution
+#include <utility> // std::pair
+#include <vector>
 
+#include "workload/sampled_trace_file.h"
 #include "workload/workload_wrapper_base.h"
 
 namespace covered
@@ -66,12 +73,12 @@ namespace covered
         void verifyDatasetAndWorkloadAbsenceForPreprocessor_(); // Dataset and workload file should NOT exist
         virtual void parseTraceFiles_(const uint32_t& preprocess_phase) = 0;
         void calculateWorkloadSampleRatio_();
-        uint32_t dumpDatasetFile_() const; // Dump dataset key-value pairs into dataset file; return dataset file size (in units of bytes)
-        uint32_t dumpWorkloadFile_() const; // Dump total workload key-value pairs into workload file; return workload file size (in units of bytes)
+        uint64_t dumpDatasetFile_() const; // Dump dataset key-value pairs into dataset file; return dataset file size (in units of bytes)
+        uint64_t dumpWorkloadFile_() const; // Dump total workload key-value pairs into workload file; return workload file size (in units of bytes)
 
         // (2) For role of dataset loader and cloud
 
-        uint32_t loadDatasetFile_(); // Load dataset key-value pairs to update dataset_kvpairs_, dataset_lookup_table_, and dataset statistics; return dataset file size (in units of bytes)
+        uint64_t loadDatasetFile_(); // mmap dataset file to update sampled_dataset_file_ptr_ and dataset statistics; return dataset file size (in units of bytes)
 
         // (3) For role of cloud for warmup speedup
 
@@ -81,7 +88,7 @@ namespace covered
 
         // (4) For role of clients during evaluation
 
-        uint32_t loadWorkloadFile_(); // Load total workload key-value pairs to update curclient_workload_keys_, curclient_workload_value_sizes_, and eval_workload_opcnt_; return partial workload file size (in units of bytes)
+        uint64_t loadWorkloadFile_(); // mmap workload file to update sampled_workload_file_ptr_ (and curclient_ranked_unique_keys_ for dynamic workload patterns); return workload file size (in units of bytes)
 
         // Const shared variables
         std::string base_instance_name_;
@@ -102,15 +109,33 @@ namespace covered
         uint32_t min_dataset_valuesize_; // Minimum dataset value size
         uint32_t max_dataset_keysize_; // Maximum dataset key size
         uint32_t max_dataset_valuesize_; // Maximum dataset value size
-        std::unordered_map<Key, uint32_t, KeyHasher> dataset_lookup_table_; // Fast indexing for dataset key-value pairs after sampling
-        std::vector<std::pair<Key, Value>> dataset_kvpairs_; // Key-value pairs of dataset after sampling
+        std::unordered_map<Key, uint32_t, KeyHasher> dataset_lookup_table_; // Fast indexing for dataset key-value pairs after sampling (ONLY for preprocessor)
+        std::vector<std::pair<Key, Value>> dataset_kvpairs_; // Key-value pairs of dataset after sampling (ONLY for preprocessor)
+        SampledTraceFile* sampled_dataset_file_ptr_; // mmaped dataset file with prebuilt key index (ONLY for dataset loader and cloud; value sizes are writable ONLY for cloud)
         // (C) For role of clients during evaluation
-        std::vector<Key> curclient_workload_keys_; // Keys of workload in the current client
-        std::vector<int> curclient_workload_value_sizes_; // Value sizes of workload in the current client (< 0: read; = 0: delete; > 0: write)
+        SampledTraceFile* sampled_workload_file_ptr_; // mmaped workload file with keys and coded value sizes (< 0: read; = 0: delete; > 0: write)
         std::vector<Key> curclient_ranked_unique_keys_; // Ranked unique keys in the current client (used for dynamic workload patterns)
 
         // Non-const individual variables
         std::vector<uint32_t> per_client_worker_workload_idx_; // Track per-clientworker workload index
+
+        // (6) For role of trace preprocessor (parallel chunked parsing)
+
+        static const int64_t TRACE_CHUNK_SIZE; // Nominal size of each trace chunk (in units of bytes)
+
+        // Parameters of a trace chunk parsed by a trace chunk parser thread
+        struct TraceChunkParam
+        {
+            const ReplayedWorkloadWrapperBase* workload_wrapper_ptr;
+            const char* chunk_startpos; // Inclusive (MUST be a line start)
+            const char* chunk_endpos; // Exclusive (MUST be a line start or the end of trace file)
+            bool is_count_only; // Only count lines for phase 0 of trace preprocessing
+            uint32_t linecnt; // # of lines in the trace chunk
+            std::vector<std::pair<Key, Value>> kvpairs; // Parsed workload items in trace order (empty if is_count_only)
+        };
+
+        static void* launchTraceChunkParser_(void* trace_chunk_param_ptr);
+        void parseTraceChunk_(TraceChunkParam& trace_chunk_param) const; // Thread safe
     protected:
         static const uint32_t PHASE_FOR_WORKLOAD_SAMPLE_RATIO; // Phase 0 of trace preprocessing
         static const uint32_t PHASE_FOR_WORKLOAD_SAMPLE; // Phase 1 of trace preprocessing
@@ -119,6 +144,11 @@ namespace covered
 
         bool updateDatasetOrSampleWorkload_(const Key& key, const Value& value, const uint32_t& preprocess_phase); // Update dataset items from all trace files (also update and sample workload items) or dataset file with the key-value pair (return true if clients achieve trace sample opcnt)
         void updateDatasetStatistics_(const Key& key, const Value& value, const uint32_t& original_dataset_size); // Update dataset statistics (e.g., average/min/max dataset key/value size)
+
+        // (6) For role of trace preprocessor (parallel chunked parsing)
+
+        void parseTraceFile_(const std::string& trace_filepath, const bool& with_title_line, const uint32_t& preprocess_phase, bool& is_achieve_trace_sample_opcnt); // Parse a trace file by trace chunk parsers, and update dataset/workload in trace order by updateDatasetOrSampleWorkload_()
+        virtual void parseTraceLine_(const char* line_startpos, const char* line_endpos, Key& key, Value& value) const = 0; // Parse a line in [line_startpos, line_endpos) (w/o line separator) to get key and value (MUST be thread safe)
     };
 }
 
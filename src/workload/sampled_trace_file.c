@@ -0,0 +1,423 @@
+#include "workload/sampled_trace_file.h"
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h> // O_RDONLY
+#include <fstream>
+#include <sstream>
+#include <string.h> // memset
+#include <sys/mman.h> // mmap and munmap
+#include <unistd.h> // lseek
+
+#include "common/util.h"
+
+namespace covered
+{
+    const int32_t SampledTraceFile::DELETED_VALUE_SIZE = -1;
+
+    const std::string SampledTraceFile::kClassName("SampledTraceFile");
+    const uint32_t SampledTraceFile::MAGIC_NUMBER = 0x46535643; // "CVSF" in little endian
+    const uint32_t SampledTraceFile::FORMAT_VERSION = 1;
+    const uint64_t SampledTraceFile::SECTION_ALIGNMENT = 8;
+
+    std::string SampledTraceFile::sampledTraceFileTypeToString(const SampledTraceFileType& file_type)
+    {
+        std::string file_type_str = "";
+        switch (file_type)
+        {
+            case SampledTraceFileType::kSampledDatasetFile:
+            {
+                file_type_str = "kSampledDatasetFile";
+                break;
+            }
+            case SampledTraceFileType::kSampledWorkloadFile:
+            {
+                file_type_str = "kSampledWorkloadFile";
+                break;
+            }
+            default:
+            {
+                file_type_str = std::to_string(static_cast<uint32_t>(file_type));
+                break;
+            }
+        }
+        return file_type_str;
+    }
+
+    uint64_t SampledTraceFile::dumpDatasetFile(const std::string& filepath, const std::vector<std::pair<Key, Value>>& dataset_kvpairs, const double& avg_keysize, const double& avg_valuesize, const uint32_t& min_keysize, const uint32_t& min_valuesize, const uint32_t& max_keysize, const uint32_t& max_valuesize)
+    {
+        const uint32_t dataset_size = dataset_kvpairs.size();
+        assert(dataset_size > 0);
+
+        std::vector<Key> tmp_keys;
+        std::vector<int32_t> tmp_value_sizes;
+        tmp_keys.reserve(dataset_size);
+        tmp_value_sizes.reserve(dataset_size);
+        for (uint32_t i = 0; i < dataset_size; i++)
+        {
+            const Value& tmp_value = dataset_kvpairs[i].second;
+            tmp_keys.push_back(dataset_kvpairs[i].first);
+            tmp_value_sizes.push_back(tmp_value.isDeleted() ? DELETED_VALUE_SIZE : static_cast<int32_t>(tmp_value.getValuesize()));
+        }
+
+        Header tmp_header;
+        memset(&tmp_header, 0, sizeof(Header));
+        tmp_header.file_type = static_cast<uint32_t>(SampledTraceFileType::kSampledDatasetFile);
+        tmp_header.avg_keysize = avg_keysize;
+        tmp_header.avg_valuesize = avg_valuesize;
+        tmp_header.min_keysize = min_keysize;
+        tmp_header.min_valuesize = min_valuesize;
+        tmp_header.max_keysize = max_keysize;
+        tmp_header.max_valuesize = max_valuesize;
+
+        const bool with_key_index = true; // For key lookups of cloud for warmup speedup
+        return dumpFile_(filepath, tmp_header, tmp_keys, tmp_value_sizes, with_key_index);
+    }
+
+    uint64_t SampledTraceFile::dumpWorkloadFile(const std::string& filepath, const std::vector<Key>& workload_keys, const std::vector<int>& workload_coded_value_sizes)
+    {
+        assert(workload_keys.size() > 0);
+        assert(workload_keys.size() == workload_coded_value_sizes.size());
+
+        std::vector<int32_t> tmp_value_sizes(workload_coded_value_sizes.begin(), workload_coded_value_sizes.end());
+
+        Header tmp_header;
+        memset(&tmp_header, 0, sizeof(Header));
+        tmp_header.file_type = static_cast<uint32_t>(SampledTraceFileType::kSampledWorkloadFile);
+
+        const bool with_key_index = false; // Workload items are ONLY accessed by index
+        return dumpFile_(filepath, tmp_header, workload_keys, tmp_value_sizes, with_key_index);
+    }
+
+    SampledTraceFile::SampledTraceFile(const std::string& filepath, const SampledTraceFileType& file_type, const bool& is_writable_value_sizes) : filepath_(filepath), file_type_(file_type)
+    {
+        std::ostringstream oss;
+        oss << kClassName << " " << sampledTraceFileTypeToString(file_type);
+        instance_name_ = oss.str();
+
+        // Get file length
+        int tmp_fd = Util::openFile(filepath, O_RDONLY);
+        int64_t tmp_filelen = lseek(tmp_fd, 0, SEEK_END);
+        if (tmp_filelen < static_cast<int64_t>(sizeof(Header)))
+        {
+            oss.clear();
+            oss.str("");
+            oss << "file " << filepath << " (" << tmp_filelen << " bytes) is too small for sampled trace file header -> please re-run trace_preprocessor!";
+            Util::dumpErrorMsg(instance_name_, oss.str());
+            exit(1);
+        }
+        filesize_ = static_cast<uint64_t>(tmp_filelen);
+
+        // Map the entire file
+        // NOTE: writable value sizes are copy-on-write (MAP_PRIVATE), so the file itself is NEVER modified
+        const int tmp_prot = is_writable_value_sizes ? (PROT_READ | PROT_WRITE) : PROT_READ;
+        file_buffer_ = (char*) mmap(NULL, filesize_, tmp_prot, MAP_PRIVATE, tmp_fd, 0);
+        if (file_buffer_ == MAP_FAILED)
+        {
+            oss.clear();
+            oss.str("");
+            oss << "failed to mmap file " << filepath << " (errno: " << errno << ")";
+            Util::dumpErrorMsg(instance_name_, oss.str());
+            exit(1);
+        }
+        Util::closeFile(tmp_fd); // NOTE: mmaped memory is still valid after closing file descriptor
+
+        header_ptr_ = (const Header*) file_buffer_;
+        verifyHeader_();
+
+        key_offsets_ = (const uint64_t*) (file_buffer_ + header_ptr_->key_offsets_fileoff);
+        value_sizes_ = (int32_t*) (file_buffer_ + header_ptr_->value_sizes_fileoff);
+        key_arena_ = file_buffer_ + header_ptr_->key_arena_fileoff;
+        key_index_ = NULL;
+        if (header_ptr_->key_index_bucketcnt > 0)
+        {
+            key_index_ = (const uint32_t*) (file_buffer_ + header_ptr_->key_index_fileoff);
+        }
+    }
+
+    SampledTraceFile::~SampledTraceFile()
+    {
+        assert(file_buffer_ != NULL);
+        munmap(file_buffer_, filesize_);
+        file_buffer_ = NULL;
+        header_ptr_ = NULL;
+        key_offsets_ = NULL;
+        value_sizes_ = NULL;
+        key_arena_ = NULL;
+        key_index_ = NULL;
+    }
+
+    uint64_t SampledTraceFile::getFilesize() const
+    {
+        return filesize_;
+    }
+
+    uint32_t SampledTraceFile::getItemcnt() const
+    {
+        return header_ptr_->itemcnt;
+    }
+
+    Key SampledTraceFile::getKey(const uint32_t& itemidx) const
+    {
+        assert(itemidx < header_ptr_->itemcnt);
+
+        const uint64_t tmp_key_startoff = key_offsets_[itemidx];
+        const uint64_t tmp_keylen = key_offsets_[itemidx + 1] - tmp_key_startoff;
+        return Key(key_arena_ + tmp_key_startoff, static_cast<uint32_t>(tmp_keylen)); // NOTE: short keys are stored inline in Key w/o heap allocation
+    }
+
+    int SampledTraceFile::getCodedValueSize(const uint32_t& itemidx) const
+    {
+        assert(file_type_ == SampledTraceFileType::kSampledWorkloadFile);
+        assert(itemidx < header_ptr_->itemcnt);
+        return value_sizes_[itemidx];
+    }
+
+    Value SampledTraceFile::getDatasetValue(const uint32_t& itemidx) const
+    {
+        assert(file_type_ == SampledTraceFileType::kSampledDatasetFile);
+        assert(itemidx < header_ptr_->itemcnt);
+
+        const int32_t tmp_value_size = value_sizes_[itemidx];
+        if (tmp_value_size == DELETED_VALUE_SIZE)
+        {
+            return Value(); // Deleted value
+        }
+        assert(tmp_value_size >= 0);
+        return Value(static_cast<uint32_t>(tmp_value_size));
+    }
+
+    void SampledTraceFile::setDatasetValue(const uint32_t& itemidx, const Value& value)
+    {
+        assert(file_type_ == SampledTraceFileType::kSampledDatasetFile);
+        assert(itemidx < header_ptr_->itemcnt);
+
+        value_sizes_[itemidx] = value.isDeleted() ? DELETED_VALUE_SIZE : static_cast<int32_t>(value.getValuesize()); // NOTE: segmentation fault if NOT mmaped as writable
+        return;
+    }
+
+    bool SampledTraceFile::lookup(const Key& key, uint32_t& itemidx) const
+    {
+        assert(file_type_ == SampledTraceFileType::kSampledDatasetFile);
+        assert(key_index_ != NULL);
+
+        const std::string_view tmp_keystr_view = key.getKeystrView();
+        const uint32_t tmp_bucketmask = header_ptr_->key_index_bucketcnt - 1;
+        uint32_t tmp_bucketidx = static_cast<uint32_t>(key.getKeyHash()) & tmp_bucketmask;
+        while (true) // NOTE: MUST terminate due to load factor of at most 0.5
+        {
+            const uint32_t tmp_bucket = key_index_[tmp_bucketidx];
+            if (tmp_bucket == 0) // Empty bucket
+            {
+                return false;
+            }
+
+            const uint32_t tmp_itemidx = tmp_bucket - 1;
+            const uint64_t tmp_key_startoff = key_offsets_[tmp_itemidx];
+            const uint64_t tmp_keylen = key_offsets_[tmp_itemidx + 1] - tmp_key_startoff;
+            if (tmp_keystr_view == std::string_view(key_arena_ + tmp_key_startoff, tmp_keylen))
+            {
+                itemidx = tmp_itemidx;
+                return true;
+            }
+
+            tmp_bucketidx = (tmp_bucketidx + 1) & tmp_bucketmask;
+        }
+
+        return false;
+    }
+
+    // Dataset statistics (ONLY for dataset)
+
+    double SampledTraceFile::getAvgKeysize() const
+    {
+        assert(file_type_ == SampledTraceFileType::kSampledDatasetFile);
+        return header_ptr_->avg_keysize;
+    }
+
+    double SampledTraceFile::getAvgValuesize() const
+    {
+        assert(file_type_ == SampledTraceFileType::kSampledDatasetFile);
+        return header_ptr_->avg_valuesize;
+    }
+
+    uint32_t SampledTraceFile::getMinKeysize() const
+    {
+        assert(file_type_ == SampledTraceFileType::kSampledDatasetFile);
+        return header_ptr_->min_keysize;
+    }
+
+    uint32_t SampledTraceFile::getMinValuesize() const
+    {
+        assert(file_type_ == SampledTraceFileType::kSampledDatasetFile);
+        return header_ptr_->min_valuesize;
+    }
+
+    uint32_t SampledTraceFile::getMaxKeysize() const
+    {
+        assert(file_type_ == SampledTraceFileType::kSampledDatasetFile);
+        return header_ptr_->max_keysize;
+    }
+
+    uint32_t SampledTraceFile::getMaxValuesize() const
+    {
+        assert(file_type_ == SampledTraceFileType::kSampledDatasetFile);
+        return header_ptr_->max_valuesize;
+    }
+
+    uint64_t SampledTraceFile::alignSectionFileoff_(const uint64_t& fileoff)
+    {
+        return (fileoff + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT * SECTION_ALIGNMENT;
+    }
+
+    uint32_t SampledTraceFile::getKeyIndexBucketcnt_(const uint32_t& itemcnt)
+    {
+        uint32_t bucketcnt = 1;
+        while (bucketcnt < 2 * static_cast<uint64_t>(itemcnt))
+        {
+            assert(bucketcnt <= (1U << 31)); // NOT overflow
+            bucketcnt <<= 1;
+        }
+        return bucketcnt;
+    }
+
+    uint64_t SampledTraceFile::dumpFile_(const std::string& filepath, Header& header, const std::vector<Key>& keys, const std::vector<int32_t>& value_sizes, const bool& with_key_index)
+    {
+        assert(keys.size() == value_sizes.size());
+        const uint32_t itemcnt = keys.size();
+
+        // Prepare key offsets and key arena
+        std::vector<uint64_t> tmp_key_offsets(itemcnt + 1, 0);
+        for (uint32_t i = 0; i < itemcnt; i++)
+        {
+            tmp_key_offsets[i + 1] = tmp_key_offsets[i] + keys[i].getKeyLength();
+        }
+        const uint64_t tmp_key_arena_size = tmp_key_offsets[itemcnt];
+        std::string tmp_key_arena;
+        tmp_key_arena.reserve(tmp_key_arena_size);
+        for (uint32_t i = 0; i < itemcnt; i++)
+        {
+            tmp_key_arena.append(keys[i].getKeystrView());
+        }
+        assert(tmp_key_arena.size() == tmp_key_arena_size);
+
+        // Prepare key index by linear probing
+        std::vector<uint32_t> tmp_key_index;
+        if (with_key_index)
+        {
+            tmp_key_index.resize(getKeyIndexBucketcnt_(itemcnt), 0);
+            const uint32_t tmp_bucketmask = tmp_key_index.size() - 1;
+            for (uint32_t i = 0; i < itemcnt; i++)
+            {
+                uint32_t tmp_bucketidx = static_cast<uint32_t>(keys[i].getKeyHash()) & tmp_bucketmask;
+                while (tmp_key_index[tmp_bucketidx] != 0)
+                {
+                    assert(keys[tmp_key_index[tmp_bucketidx] - 1] != keys[i]); // NOTE: dataset keys MUST be unique
+                    tmp_bucketidx = (tmp_bucketidx + 1) & tmp_bucketmask;
+                }
+                tmp_key_index[tmp_bucketidx] = i + 1;
+            }
+        }
+
+        // Update header
+        header.magic = MAGIC_NUMBER;
+        header.version = FORMAT_VERSION;
+        header.itemcnt = itemcnt;
+        header.key_arena_size = tmp_key_arena_size;
+        header.key_index_bucketcnt = tmp_key_index.size();
+        header.key_offsets_fileoff = alignSectionFileoff_(sizeof(Header));
+        header.value_sizes_fileoff = alignSectionFileoff_(header.key_offsets_fileoff + tmp_key_offsets.size() * sizeof(uint64_t));
+        header.key_arena_fileoff = alignSectionFileoff_(header.value_sizes_fileoff + value_sizes.size() * sizeof(int32_t));
+        header.key_index_fileoff = with_key_index ? alignSectionFileoff_(header.key_arena_fileoff + tmp_key_arena_size) : 0;
+
+        // Create and open a binary file
+        std::fstream* fs_ptr = Util::openFile(filepath, std::ios_base::out | std::ios_base::binary);
+        assert(fs_ptr != NULL);
+
+        // Dump sections
+        uint64_t fileoff = 0;
+        writeSection_(fs_ptr, fileoff, 0, (const char*)&header, sizeof(Header));
+        writeSection_(fs_ptr, fileoff, header.key_offsets_fileoff, (const char*)tmp_key_offsets.data(), tmp_key_offsets.size() * sizeof(uint64_t));
+        writeSection_(fs_ptr, fileoff, header.value_sizes_fileoff, (const char*)value_sizes.data(), value_sizes.size() * sizeof(int32_t));
+        writeSection_(fs_ptr, fileoff, header.key_arena_fileoff, tmp_key_arena.data(), tmp_key_arena_size);
+        if (with_key_index)
+        {
+            writeSection_(fs_ptr, fileoff, header.key_index_fileoff, (const char*)tmp_key_index.data(), tmp_key_index.size() * sizeof(uint32_t));
+        }
+
+        // Close file and release ofstream
+        fs_ptr->close();
+        delete fs_ptr;
+        fs_ptr = NULL;
+
+        return fileoff;
+    }
+
+    void SampledTraceFile::writeSection_(std::fstream* fs_ptr, uint64_t& fileoff, const uint64_t& section_fileoff, const char* section_bytes, const uint64_t& section_size)
+    {
+        assert(fs_ptr != NULL);
+        assert(fileoff <= section_fileoff);
+
+        // Pad zeros for alignment
+        const char tmp_padding[SECTION_ALIGNMENT] = {0};
+        assert(section_fileoff - fileoff < SECTION_ALIGNMENT);
+        fs_ptr->write(tmp_padding, section_fileoff - fileoff);
+        fileoff = section_fileoff;
+
+        if (section_size > 0)
+        {
+            fs_ptr->write(section_bytes, section_size);
+            fileoff += section_size;
+        }
+        return;
+    }
+
+    void SampledTraceFile::verifyHeader_() const
+    {
+        assert(header_ptr_ != NULL);
+
+        std::ostringstream oss;
+        if (header_ptr_->magic != MAGIC_NUMBER || header_ptr_->version != FORMAT_VERSION)
+        {
+            oss << "file " << filepath_ << " is NOT a sampled trace file of version " << FORMAT_VERSION << " (magic: " << header_ptr_->magic << "; version: " << header_ptr_->version << ") -> please delete it and re-run trace_preprocessor!";
+            Util::dumpErrorMsg(instance_name_, oss.str());
+            exit(1);
+        }
+        if (header_ptr_->file_type != static_cast<uint32_t>(file_type_))
+        {
+            oss << "file " << filepath_ << " has file type " << header_ptr_->file_type << ", which is NOT " << sampledTraceFileTypeToString(file_type_) << "!";
+            Util::dumpErrorMsg(instance_name_, oss.str());
+            exit(1);
+        }
+        if (file_type_ == SampledTraceFileType::kSampledDatasetFile && header_ptr_->key_index_bucketcnt == 0)
+        {
+            oss << "sampled dataset file " << filepath_ << " does NOT have key index!";
+            Util::dumpErrorMsg(instance_name_, oss.str());
+            exit(1);
+        }
+
+        const uint64_t tmp_itemcnt = header_ptr_->itemcnt;
+        verifySection_(header_ptr_->key_offsets_fileoff, (tmp_itemcnt + 1) * sizeof(uint64_t), "key offsets");
+        verifySection_(header_ptr_->value_sizes_fileoff, tmp_itemcnt * sizeof(int32_t), "value sizes");
+        verifySection_(header_ptr_->key_arena_fileoff, header_ptr_->key_arena_size, "key arena");
+        if (header_ptr_->key_index_bucketcnt > 0)
+        {
+            assert((header_ptr_->key_index_bucketcnt & (header_ptr_->key_index_bucketcnt - 1)) == 0); // Power of 2
+            verifySection_(header_ptr_->key_index_fileoff, static_cast<uint64_t>(header_ptr_->key_index_bucketcnt) * sizeof(uint32_t), "key index");
+        }
+
+        return;
+    }
+
+    void SampledTraceFile::verifySection_(const uint64_t& section_fileoff, const uint64_t& section_size, const std::string& section_name) const
+    {
+        if (section_fileoff < sizeof(Header) || section_fileoff % SECTION_ALIGNMENT != 0 || section_fileoff > filesize_ || section_size > filesize_ - section_fileoff)
+        {
+            std::ostringstream oss;
+            oss << "invalid " << section_name << " section [" << section_fileoff << ", +" << section_size << ") in file " << filepath_ << " (" << filesize_ << " bytes) -> please delete it and re-run trace_preprocessor!";
+            Util::dumpErrorMsg(instance_name_, oss.str());
+            exit(1);
+        }
+        return;
+    }
+}
@@ -0,0 +1,112 @@
+/*
+ * SampledTraceFile: columnar binary format of sampled dataset/workload files dumped by trace preprocessor for replayed traces, which are mmaped and used in place by dataset loader, cloud, and clients (w/o parsing and per-key heap allocation).
+ *
+ * NOTE: file layout (version 1; host byte order, each section is 8-byte aligned):
+ * -> Header: magic, version, file type, item count, key arena size, key index bucket count, dataset statistics, and section offsets;
+ * -> Key offsets: uint64_t[itemcnt + 1], where key i is [key_offsets[i], key_offsets[i + 1]) in key arena;
+ * -> Value sizes: int32_t[itemcnt] (dataset: value size or DELETED_VALUE_SIZE; workload: coded value size, i.e., < 0: read; = 0: delete; > 0: write);
+ * -> Key arena: concatenated key bytes;
+ * -> Key index (ONLY for dataset): uint32_t[bucketcnt] of open addressing with linear probing by the precomputed key hash (MurmurHash3 x64 w/ seed 0, stable across processes), where each bucket stores item index + 1 (0 means empty).
+ *
+ * NOTE: value sizes can be updated in place ONLY if mmaped as writable (i.e., cloud for warmup speedup), which are copy-on-write (MAP_PRIVATE) and NOT written back into the file, so untouched pages are still shared by processes in the same machine.
+ */
+
+#ifndef SAMPLED_TRACE_FILE_H
+#define SAMPLED_TRACE_FILE_H
+
+#include <string>
+#include <utility> // std::pair
+#include <vector>
+
+#include "common/key.h"
+#include "common/value.h"
+
+namespace covered
+{
+    enum SampledTraceFileType
+    {
+        kSampledDatasetFile = 1,
+        kSampledWorkloadFile
+    };
+
+    class SampledTraceFile
+    {
+    public:
+        static const int32_t DELETED_VALUE_SIZE; // Value size of deleted dataset values
+
+        static std::string sampledTraceFileTypeToString(const SampledTraceFileType& file_type);
+
+        // Dump sampled dataset/workload file by trace preprocessor; return file size (in units of bytes)
+        static uint64_t dumpDatasetFile(const std::string& filepath, const std::vector<std::pair<Key, Value>>& dataset_kvpairs, const double& avg_keysize, const double& avg_valuesize, const uint32_t& min_keysize, const uint32_t& min_valuesize, const uint32_t& max_keysize, const uint32_t& max_valuesize);
+        static uint64_t dumpWorkloadFile(const std::string& filepath, const std::vector<Key>& workload_keys, const std::vector<int>& workload_coded_value_sizes);
+
+        SampledTraceFile(const std::string& filepath, const SampledTraceFileType& file_type, const bool& is_writable_value_sizes); // mmap an existing sampled dataset/workload file
+        ~SampledTraceFile();
+
+        uint64_t getFilesize() const;
+        uint32_t getItemcnt() const;
+
+        // Access items by multiple threads (thread safe)
+        Key getKey(const uint32_t& itemidx) const;
+        int getCodedValueSize(const uint32_t& itemidx) const; // ONLY for workload
+        Value getDatasetValue(const uint32_t& itemidx) const; // ONLY for dataset
+        void setDatasetValue(const uint32_t& itemidx, const Value& value); // ONLY for dataset mmaped as writable (NOTE: different threads MUST NOT update the same item concurrently)
+        bool lookup(const Key& key, uint32_t& itemidx) const; // Return true if key exists in key index (ONLY for dataset)
+
+        // Dataset statistics (ONLY for dataset)
+        double getAvgKeysize() const;
+        double getAvgValuesize() const;
+        uint32_t getMinKeysize() const;
+        uint32_t getMinValuesize() const;
+        uint32_t getMaxKeysize() const;
+        uint32_t getMaxValuesize() const;
+    private:
+        static const std::string kClassName;
+        static const uint32_t MAGIC_NUMBER;
+        static const uint32_t FORMAT_VERSION;
+        static const uint64_t SECTION_ALIGNMENT;
+
+        struct Header
+        {
+            uint32_t magic;
+            uint32_t version;
+            uint32_t file_type;
+            uint32_t itemcnt;
+            uint64_t key_arena_size;
+            uint32_t key_index_bucketcnt; // 0 if without key index
+            uint32_t reserved;
+            double avg_keysize;
+            double avg_valuesize;
+            uint32_t min_keysize;
+            uint32_t min_valuesize;
+            uint32_t max_keysize;
+            uint32_t max_valuesize;
+            uint64_t key_offsets_fileoff;
+            uint64_t value_sizes_fileoff;
+            uint64_t key_arena_fileoff;
+            uint64_t key_index_fileoff; // 0 if without key index
+        };
+
+        static uint64_t alignSectionFileoff_(const uint64_t& fileoff);
+        static uint32_t getKeyIndexBucketcnt_(const uint32_t& itemcnt); // Power of 2 with load factor of at most 0.5
+        static uint64_t dumpFile_(const std::string& filepath, Header& header, const std::vector<Key>& keys, const std::vector<int32_t>& value_sizes, const bool& with_key_index); // Update section offsets in header
+        static void writeSection_(std::fstream* fs_ptr, uint64_t& fileoff, const uint64_t& section_fileoff, const char* section_bytes, const uint64_t& section_size); // Pad zeros up to section_fileoff before section bytes
+
+        void verifyHeader_() const;
+        void verifySection_(const uint64_t& section_fileoff, const uint64_t& section_size, const std::string& section_name) const;
+
+        // Const shared variables
+        std::string instance_name_;
+        std::string filepath_;
+        SampledTraceFileType file_type_;
+        uint64_t filesize_;
+        char* file_buffer_; // mmaped file
+        const Header* header_ptr_;
+        const uint64_t* key_offsets_;
+        int32_t* value_sizes_; // Writable ONLY if is_writable_value_sizes = true
+        const char* key_arena_;
+        const uint32_t* key_index_; // NULL if without key index
+    };
+}
+
+#endif
@@ -7,6 +7,8 @@
  * -> Image TSV: relative_unix hashed_path_query image_type response_size time_firstbyte
  * -> Text TSV: relative_unix hashed_path_query response_size time_firstbyte
  * 
+ * NOTE: trace files are parsed by ReplayedWorkloadWrapperBase in parallel newline-aligned chunks, so WikipediaWorkloadWrapper ONLY needs to parse each bounded TSV line (by memchr and std::from_chars without relying on any line terminator).
+ * 
  * NOTE: (i) as Wiki image and text CDN workloads have large I/O overhead for loading trace files, we MUST distinguish loading and evaluation phases -> (ii) In loading phase, we ONLY load dataset instead of tracking workload items; while in evaluation phase, we ONLY track workload items instead of dataset -> (iii) Although we cannot use dataset key indices for workload items, the space cost is acceptable due to not-many workload items under geo-distributed tiered storage (large propagation latency limits throughput and hence # of workload items).
  * 
  * By Siyuan Sheng (2024.02.15).
@@ -40,13 +42,15 @@ namespace covered
         // (1) For role of preprocessor (all trace files)
 
         virtual void parseTraceFiles_(const uint32_t& preprocess_phase) override;
-        void parseCurrentFile_(const std::string& tmp_filepath, const uint32_t& key_column_idx, const uint32_t& value_column_idx, const uint32_t& column_cnt, bool& is_achieve_trace_sample_opcnt, const uint32_t& preprocess_phase); // Process the current trace file
-        void completeLastLine_(const char* tmp_line_startpos, const char* tmp_line_endpos, char** tmp_complete_line_startpos_ptr, char** tmp_complete_line_endpos_ptr) const; // Complete the last line of a trace file by an extra line separator
-        void concatenateLastLine_(const char* prev_block_taildata, const uint32_t& prev_block_tailsize, const char* tmp_complete_line_startpos, const char* tmp_complete_line_endpos, char** tmp_concat_line_startpos_ptr, char** tmp_concat_line_endpos_ptr) const; // Concatenate tail data of the previous mmap block with the first complete line of the current mmap block
-        void parseCurrentLine_(const char* tmp_concat_line_startpos, const char* tmp_concat_line_endpos, const uint32_t& key_column_idx, const uint32_t& value_column_idx, const uint32_t& column_cnt, Key& key, Value& value) const; // Parse a line to get key and value
+        virtual void parseTraceLine_(const char* line_startpos, const char* line_endpos, Key& key, Value& value) const override; // Parse a line [line_startpos, line_endpos) to get key and value (thread safe due to accessing const shared variables only)
+        int64_t parseIntColumn_(const char* column_startpos, const char* column_endpos) const; // Parse a column [column_startpos, column_endpos) as a decimal integer w/ optional surrounding whitespaces and leading plus sign as strtoll (exit if invalid)
 
         // Const shared variables
         std::string instance_name_;
+        uint32_t column_cnt_; // # of TSV columns in each line
+        uint32_t key_column_idx_;
+        uint32_t value_column_idx_;
+        std::vector<std::string> trace_filepaths_; // NOTE: follow the trace order
 
         // NOTE: see more const and non-const variables in ReplayedWorkloadWrapperBase
     };
@@ -42,7 +42,7 @@ namespace covered
 
         // For clients
         client_worker_item_randgen_ptrs_.resize(perclient_workercnt, NULL);
-        client_worker_reqdist_ptrs_.resize(perclient_workercnt, NULL);
+        request_sampler_ptr_ = NULL;
         client_ranked_unique_key_indices_.clear();
     }
 
@@ -60,13 +60,10 @@ namespace covered
                 client_worker_item_randgen_ptrs_[i] = NULL;
             }
 
-            // Release request distribution for each client worker
-            for (uint32_t i = 0; i < client_worker_reqdist_ptrs_.size(); i++)
-            {
-                assert(client_worker_reqdist_ptrs_[i] != NULL);
-                delete client_worker_reqdist_ptrs_[i];
-                client_worker_reqdist_ptrs_[i] = NULL;
-            }
+            // Release request sampler shared by client workers
+            assert(request_sampler_ptr_ != NULL);
+            delete request_sampler_ptr_;
+            request_sampler_ptr_ = NULL;
         }
     }
 
@@ -488,6 +485,10 @@ namespace covered
     {
         if (needWorkloadItems_()) // Clients
         {
+            // Create request sampler once, which is shared read-only by all client workers (each worker ONLY has its own random generator)
+            request_sampler_ptr_ = new AliasSampler(dataset_probs_);
+            assert(request_sampler_ptr_ != NULL);
+
             // Create workload generator for each client
             for (uint32_t tmp_local_client_worker_idx = 0; tmp_local_client_worker_idx < getPerclientWorkercnt_(); tmp_local_client_worker_idx++)
             {
@@ -505,9 +506,6 @@ namespace covered
                 }
 
                 client_worker_item_randgen_ptrs_[tmp_local_client_worker_idx] = tmp_client_worker_item_randgen_ptr_;
-
-                client_worker_reqdist_ptrs_[tmp_local_client_worker_idx] = new std::discrete_distribution<uint32_t>(dataset_probs_.begin(), dataset_probs_.end());
-                assert(client_worker_reqdist_ptrs_[tmp_local_client_worker_idx] != NULL);
             }
 
             // Update rank information for dynamic workload patterns
@@ -553,9 +551,7 @@ namespace covered
         // Get a workload index randomly
         std::mt19937_64* request_randgen_ptr = client_worker_item_randgen_ptrs_[local_client_worker_idx];
         assert(request_randgen_ptr != NULL);
-        std::discrete_distribution<uint32_t>* request_dist_ptr = client_worker_reqdist_ptrs_[local_client_worker_idx];
-        assert(request_dist_ptr != NULL);
-        const uint32_t tmp_key_index = (*request_dist_ptr)(*request_randgen_ptr); // NOTE: here we directly use Zeta distribution to select item from dataset as workload item, instead of selecting item from pre-generated workload items (approximate workload distribution as in src/workload/fbphoto_workload_wrapper.c)
+        const uint32_t tmp_key_index = request_sampler_ptr_->sample(*request_randgen_ptr); // NOTE: here we directly use Zeta distribution to select item from dataset as workload item, instead of selecting item from pre-generated workload items (approximate workload distribution as in src/workload/fbphoto_workload_wrapper.c)
         assert(tmp_key_index < dataset_keys_.size());
 
         // Get key
@@ -607,11 +603,7 @@ namespace covered
                 assert(client_worker_item_randgen_ptrs_[i] != NULL);
             }
 
-            assert(client_worker_reqdist_ptrs_.size() > 0);
-            for (uint32_t i = 0; i < client_worker_reqdist_ptrs_.size(); i++)
-            {
-                assert(client_worker_reqdist_ptrs_[i] != NULL);
-            }
+            assert(request_sampler_ptr_ != NULL);
         }
     }
 }
@@ -10,8 +10,9 @@
 #include <string>
 #include <unordered_map>
 #include <vector>
-#include <random> // std::mt19937_64, std::discrete_distribution
+#include <random> // std::mt19937_64
 
+#include "workload/alias_sampler.h"
 #include "workload/workload_item.h"
 #include "workload/workload_wrapper_base.h"
 
@@ -87,7 +88,7 @@ namespace covered
         std::vector<uint32_t> dataset_valsizes_; // Client needs dataset_valsizes_ to generate workload items (although NOT used by client workers due to GET requests)
         // For clients
         std::vector<std::mt19937_64*> client_worker_item_randgen_ptrs_;
-        std::vector<std::discrete_distribution<uint32_t>*> client_worker_reqdist_ptrs_; // randomly select request index from workload indices of each client
+        AliasSampler* request_sampler_ptr_; // randomly select request index from dataset (shared read-only by all client workers with per-worker random generators)
         // std::vector<uint32_t> workload_key_indices_; // workload indices for each client (NOTE: NO need due to directly generating workload items by Zeta distribution)
         std::vector<uint32_t> client_ranked_unique_key_indices_; // Ranked unique key indices for current client (used for dynamic workload patterns)
     };
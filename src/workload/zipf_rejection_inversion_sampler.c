@@ -0,0 +1,108 @@
+#include "workload/zipf_rejection_inversion_sampler.h"
+
+#include <assert.h>
+#include <cmath>
+#include <sstream>
+
+#include "common/util.h"
+
+namespace covered
+{
+    const std::string ZipfRejectionInversionSampler::kClassName("ZipfRejectionInversionSampler");
+
+    ZipfRejectionInversionSampler::ZipfRejectionInversionSampler(const uint64_t& keycnt, const double& zipf_constant) : keycnt_(keycnt), zipf_constant_(zipf_constant)
+    {
+        if (keycnt == 0 || !(zipf_constant > 0.0))
+        {
+            std::ostringstream oss;
+            oss << "invalid keycnt " << keycnt << " or zipf_constant " << zipf_constant << " (keycnt and zipf_constant MUST be positive)!";
+            Util::dumpErrorMsg(kClassName, oss.str());
+            exit(1);
+        }
+
+        h_integral_x1_ = hIntegral_(1.5) - 1.0;
+        h_integral_keycnt_ = hIntegral_(static_cast<double>(keycnt_) + 0.5);
+        s_ = 2.0 - hIntegralInverse_(hIntegral_(2.5) - h_(2.0));
+    }
+
+    ZipfRejectionInversionSampler::~ZipfRejectionInversionSampler() {}
+
+    uint64_t ZipfRejectionInversionSampler::sample(std::mt19937_64& randgen) const
+    {
+        while (true)
+        {
+            // Uniform real number within [0, 1) with 53-bit precision
+            const double tmp_uniform = static_cast<double>(randgen() >> 11) * (1.0 / 9007199254740992.0);
+
+            // Invert the integral of the continuous hat function h(x) (u is within (H(keycnt+0.5), H(1.5)-1])
+            const double tmp_u = h_integral_keycnt_ + tmp_uniform * (h_integral_x1_ - h_integral_keycnt_);
+            const double tmp_x = hIntegralInverse_(tmp_u);
+
+            // Round to the nearest rank
+            uint64_t tmp_rank = static_cast<uint64_t>(tmp_x + 0.5);
+            if (tmp_x + 0.5 < 1.0)
+            {
+                tmp_rank = 1;
+            }
+            else if (tmp_rank > keycnt_)
+            {
+                tmp_rank = keycnt_;
+            }
+
+            // Accept by squeeze (most cases) or by exact comparison with the hat area of the rank
+            if (static_cast<double>(tmp_rank) - tmp_x <= s_ || tmp_u >= hIntegral_(static_cast<double>(tmp_rank) + 0.5) - h_(static_cast<double>(tmp_rank)))
+            {
+                return tmp_rank;
+            }
+        }
+    }
+
+    uint64_t ZipfRejectionInversionSampler::getKeycnt() const
+    {
+        return keycnt_;
+    }
+
+    double ZipfRejectionInversionSampler::getZipfConstant() const
+    {
+        return zipf_constant_;
+    }
+
+    double ZipfRejectionInversionSampler::h_(const double& x) const
+    {
+        return std::exp(-zipf_constant_ * std::log(x));
+    }
+
+    double ZipfRejectionInversionSampler::hIntegral_(const double& x) const
+    {
+        const double tmp_log_x = std::log(x);
+        return helper2_((1.0 - zipf_constant_) * tmp_log_x) * tmp_log_x;
+    }
+
+    double ZipfRejectionInversionSampler::hIntegralInverse_(const double& x) const
+    {
+        double tmp_t = x * (1.0 - zipf_constant_);
+        if (tmp_t < -1.0)
+        {
+            tmp_t = -1.0; // Avoid NaN due to floating-point errors
+        }
+        return std::exp(helper1_(tmp_t) * x);
+    }
+
+    double ZipfRejectionInversionSampler::helper1_(const double& x)
+    {
+        if (std::fabs(x) > 1e-8)
+        {
+            return std::log1p(x) / x;
+        }
+        return 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+    }
+
+    double ZipfRejectionInversionSampler::helper2_(const double& x)
+    {
+        if (std::fabs(x) > 1e-8)
+        {
+            return std::expm1(x) / x;
+        }
+        return 1.0 + x * 0.5 * (1.0 + x * (1.0 / 3.0) * (1.0 + 0.25 * x));
+    }
+}
@@ -0,0 +1,44 @@
+/*
+ * ZipfRejectionInversionSampler: sample ranks from a power-law Zipf distribution p(rank) ~ 1/rank^zipf_constant over [1, keycnt] by rejection-inversion (thread safe).
+ *
+ * NOTE: unlike AliasSampler, NO per-key table is tabulated (O(1) memory and expected O(1) time per sample with acceptance rate close to 1), so it is suitable for key spaces too large to tabulate (e.g., billions of keys).
+ *
+ * NOTE: refer to W. Hormann and G. Derflinger, "Rejection-inversion to generate variates from monotone discrete distributions", ACM TOMACS 1996 (the same as Apache Commons RNG).
+ */
+
+#ifndef ZIPF_REJECTION_INVERSION_SAMPLER_H
+#define ZIPF_REJECTION_INVERSION_SAMPLER_H
+
+#include <random> // std::mt19937_64
+#include <string>
+
+namespace covered
+{
+    class ZipfRejectionInversionSampler
+    {
+    public:
+        ZipfRejectionInversionSampler(const uint64_t& keycnt, const double& zipf_constant);
+        ~ZipfRejectionInversionSampler();
+
+        uint64_t sample(std::mt19937_64& randgen) const; // Return a rank within [1, keycnt]
+
+        uint64_t getKeycnt() const;
+        double getZipfConstant() const;
+    private:
+        static const std::string kClassName;
+
+        double h_(const double& x) const; // h(x) = 1/x^zipf_constant
+        double hIntegral_(const double& x) const; // H(x) = (x^(1-zipf_constant) - 1) / (1-zipf_constant), or log(x) if zipf_constant = 1
+        double hIntegralInverse_(const double& x) const; // Inverse of H(x)
+        static double helper1_(const double& x); // log(1+x)/x with Taylor expansion around 0
+        static double helper2_(const double& x); // (exp(x)-1)/x with Taylor expansion around 0
+
+        uint64_t keycnt_;
+        double zipf_constant_;
+        double h_integral_x1_; // H(1.5) - 1
+        double h_integral_keycnt_; // H(keycnt + 0.5)
+        double s_; // Squeeze threshold to accept most samples without evaluating H
+    };
+}
+
+#endif
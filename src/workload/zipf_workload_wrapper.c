@@ -10,6 +10,8 @@ namespace covered
 {
     const std::string ZipfWorkloadWrapper::kClassName("ZipfWorkloadWrapper");
 
+    const uint32_t ZipfWorkloadWrapper::ALIAS_TABLE_MAX_KEYCNT = 64 * 1024 * 1024; // 512 MiB alias table at most
+
     //, zipf_alpha_(zipf_alpha)
     ZipfWorkloadWrapper::ZipfWorkloadWrapper(const uint32_t& clientcnt, const uint32_t& client_idx, const uint32_t& keycnt, const uint32_t& perclient_opcnt, const uint32_t& perclient_workercnt, const std::string& workload_name, const std::string& workload_usage_role, const float& zipf_alpha, const std::string& workload_pattern_name, const uint32_t& dynamic_change_period, const uint32_t& dynamic_change_keycnt, const uint32_t& workload_randombase) : WorkloadWrapperBase(clientcnt, client_idx, keycnt, perclient_opcnt, perclient_workercnt, workload_name, workload_usage_role, workload_pattern_name, dynamic_change_period, dynamic_change_keycnt, workload_randombase)
     {
@@ -28,6 +30,7 @@ namespace covered
         std::ostringstream oss;
         oss << kClassName << " client" << client_idx;
         instance_name_ = oss.str();
+        zipf_constant_ = 0.0;
 
         // For clients, dataset loader, and cloud
         average_dataset_keysize_ = 0;
@@ -40,8 +43,8 @@ namespace covered
 
         // For clients
         client_worker_item_randgen_ptrs_.resize(perclient_workercnt, NULL);
-        client_worker_reqdist_ptrs_.resize(perclient_workercnt, NULL);
-        client_ranked_unique_key_indices_.clear();
+        request_alias_sampler_ptr_ = NULL;
+        request_rejinv_sampler_ptr_ = NULL;
 
         // Optype ratios for workloads requiring them
         read_ratio_ = 1.0;
@@ -69,12 +72,16 @@ namespace covered
                 client_worker_item_randgen_ptrs_[i] = NULL;
             }
 
-            // Release request distribution for each client worker
-            for (uint32_t i = 0; i < client_worker_reqdist_ptrs_.size(); i++)
+            // Release request sampler shared by client workers
+            if (request_alias_sampler_ptr_ != NULL)
+            {
+                delete request_alias_sampler_ptr_;
+                request_alias_sampler_ptr_ = NULL;
+            }
+            if (request_rejinv_sampler_ptr_ != NULL)
             {
-                assert(client_worker_reqdist_ptrs_[i] != NULL);
-                delete client_worker_reqdist_ptrs_[i];
-                client_worker_reqdist_ptrs_[i] = NULL;
+                delete request_rejinv_sampler_ptr_;
+                request_rejinv_sampler_ptr_ = NULL;
             }
 
             // For workloads need optype ratios
@@ -234,6 +241,11 @@ namespace covered
         return;
     }
 
+    bool ZipfWorkloadWrapper::isRejinvSampling_() const
+    {
+        return getKeycnt_() > ALIAS_TABLE_MAX_KEYCNT;
+    }
+
     void ZipfWorkloadWrapper::loadZipfCharacteristicsFile_()
     {
         // NOTE: MUST be the same as characteristics filepath in scripts/workload/characterize_zipf_traces.py
@@ -256,6 +268,7 @@ namespace covered
         double zipf_constant = 0.0;
         fs_ptr->read((char *)&zipf_constant, sizeof(double));
         assert(zipf_constant > 0.0); // Power-law Zipfian constant must be larger than 0.0
+        zipf_constant_ = zipf_constant;
 
         // // Load Zipfian scaling factor (convert relative frequency into probability)
         // double zipf_scaling_factor = 0.0;
@@ -377,11 +390,16 @@ namespace covered
         // (3) Use Zipfian constant and key/value size distribution to generate keys, probs, and value sizes
 
         // Initialize dataset keys, probs, and value sizes
+        // NOTE: NOT materialize per-key probs under rejection-inversion sampling, which samples ranks from Zipfian constant directly
         const uint32_t dataset_size = getKeycnt_();
+        const bool is_materialize_probs = !isRejinvSampling_();
         dataset_keys_.clear();
         dataset_keys_.resize(dataset_size, "");
         dataset_probs_.clear();
-        dataset_probs_.resize(dataset_size, 0.0);
+        if (is_materialize_probs)
+        {
+            dataset_probs_.resize(dataset_size, 0.0);
+        }
         dataset_valsizes_.clear();
         dataset_valsizes_.resize(dataset_size, 0);
 
@@ -404,9 +422,12 @@ namespace covered
 
             // Generate prob
             // double tmp_prob = 1.0 / std::pow(static_cast<double>(tmp_rank), zipf_constant) * zipf_scaling_factor;
-            double tmp_prob = 1.0 / std::pow(static_cast<double>(tmp_rank), zipf_constant);
-            dataset_probs_[i] = tmp_prob;
-            total_prob += tmp_prob;
+            if (is_materialize_probs)
+            {
+                double tmp_prob = 1.0 / std::pow(static_cast<double>(tmp_rank), zipf_constant);
+                dataset_probs_[i] = tmp_prob;
+                total_prob += tmp_prob;
+            }
 
             // Generate value size
             uint32_t tmp_valuesize = fixed_valuesize;
@@ -420,7 +441,7 @@ namespace covered
         }
 
         // Normalize dataset probs to sum to 1.0
-        for (uint32_t i = 0; i < dataset_size; i++)
+        for (uint32_t i = 0; i < dataset_probs_.size(); i++)
         {
             dataset_probs_[i] /= total_prob;
         }
@@ -460,8 +481,17 @@ namespace covered
         // TODO: Print debug info (to verify the same dataset across different clients and the same power-law distribution between C++ and python)
         std::ostringstream oss;
         oss << "zipf_constant: " << zipf_constant << std::endl;
-        oss << "dataset_keys_[0]: " << Key(dataset_keys_[0]).getKeyDebugstr() << "; dataset_probs_[0]: " << dataset_probs_[0] << "; dataset_valsizes_[0]: " << dataset_valsizes_[0] << std::endl;
-        oss << "dataset_keys_[1]: " << Key(dataset_keys_[1]).getKeyDebugstr() << "; dataset_probs_[1]: " << dataset_probs_[1] << "; dataset_valsizes_[1]: " << dataset_valsizes_[1];
+        if (is_materialize_probs)
+        {
+            oss << "dataset_keys_[0]: " << Key(dataset_keys_[0]).getKeyDebugstr() << "; dataset_probs_[0]: " << dataset_probs_[0] << "; dataset_valsizes_[0]: " << dataset_valsizes_[0] << std::endl;
+            oss << "dataset_keys_[1]: " << Key(dataset_keys_[1]).getKeyDebugstr() << "; dataset_probs_[1]: " << dataset_probs_[1] << "; dataset_valsizes_[1]: " << dataset_valsizes_[1];
+        }
+        else
+        {
+            oss << "dataset_keys_[0]: " << Key(dataset_keys_[0]).getKeyDebugstr() << "; dataset_valsizes_[0]: " << dataset_valsizes_[0] << std::endl;
+            oss << "dataset_keys_[1]: " << Key(dataset_keys_[1]).getKeyDebugstr() << "; dataset_valsizes_[1]: " << dataset_valsizes_[1] << std::endl;
+            oss << "dataset probs are NOT materialized for rejection-inversion sampling (keycnt > " << ALIAS_TABLE_MAX_KEYCNT << ")";
+        }
         if (Util::needOptypeRatios(getWorkloadName_()))
         {
             oss << std::endl;
@@ -526,6 +556,21 @@ namespace covered
     {
         if (needWorkloadItems_()) // Clients
         {
+            // Create request sampler once, which is shared read-only by all client workers (each worker ONLY has its own random generator)
+            if (!isRejinvSampling_())
+            {
+                assert(dataset_probs_.size() == getKeycnt_());
+                request_alias_sampler_ptr_ = new AliasSampler(dataset_probs_);
+                assert(request_alias_sampler_ptr_ != NULL);
+            }
+            else
+            {
+                // NOTE: dataset probs follow power-law Zipf distribution over ranks (key index = rank - 1), so we can sample ranks without tabulating probs
+                assert(dataset_probs_.size() == 0);
+                request_rejinv_sampler_ptr_ = new ZipfRejectionInversionSampler(getKeycnt_(), zipf_constant_);
+                assert(request_rejinv_sampler_ptr_ != NULL);
+            }
+
             // Create workload generator for each client
             for (uint32_t tmp_local_client_worker_idx = 0; tmp_local_client_worker_idx < getPerclientWorkercnt_(); tmp_local_client_worker_idx++)
             {
@@ -543,9 +588,6 @@ namespace covered
                 }
                 client_worker_item_randgen_ptrs_[tmp_local_client_worker_idx] = tmp_client_worker_item_randgen_ptr;
 
-                client_worker_reqdist_ptrs_[tmp_local_client_worker_idx] = new std::discrete_distribution<uint32_t>(dataset_probs_.begin(), dataset_probs_.end());
-                assert(client_worker_reqdist_ptrs_[tmp_local_client_worker_idx] != NULL);
-
                 // Create randgen and uniform dist for clients under workloads need optype ratios
                 if (Util::needOptypeRatios(getWorkloadName_()))
                 {
@@ -562,17 +604,7 @@ namespace covered
                 }
             }
 
-            // Update rank information for dynamic workload patterns
-            std::multimap<double, uint32_t, std::greater<double>> tmp_sorted_prob_keyindex_map;
-            for (uint32_t i = 0; i < dataset_probs_.size(); i++)
-            {
-                tmp_sorted_prob_keyindex_map.insert(std::pair<double, uint32_t>(dataset_probs_[i], i));
-            }
-            client_ranked_unique_key_indices_.clear(); // Clear for safety
-            for (std::multimap<double, uint32_t>::iterator tmp_sorted_prob_keyindex_map_iter = tmp_sorted_prob_keyindex_map.begin(); tmp_sorted_prob_keyindex_map_iter != tmp_sorted_prob_keyindex_map.end(); tmp_sorted_prob_keyindex_map_iter++)
-            {
-                client_ranked_unique_key_indices_.push_back(tmp_sorted_prob_keyindex_map_iter->second);
-            }
+            // NOTE: NO need to sort keys by probs for dynamic workload patterns, as dataset keys are generated in descending order of probs (i.e., key index = rank - 1)
         }
 
         return;
@@ -648,9 +680,16 @@ namespace covered
         // Get a workload index randomly
         std::mt19937_64* request_randgen_ptr = client_worker_item_randgen_ptrs_[local_client_worker_idx];
         assert(request_randgen_ptr != NULL);
-        std::discrete_distribution<uint32_t>* request_dist_ptr = client_worker_reqdist_ptrs_[local_client_worker_idx];
-        assert(request_dist_ptr != NULL);
-        const uint32_t tmp_key_index = (*request_dist_ptr)(*request_randgen_ptr); // NOTE: here we directly use power-law distribution to select item from dataset as workload item, instead of selecting item from pre-generated workload items (approximate workload distribution as in src/workload/fbphoto_workload_wrapper.c)
+        uint32_t tmp_key_index = 0; // NOTE: here we directly use power-law distribution to select item from dataset as workload item, instead of selecting item from pre-generated workload items (approximate workload distribution as in src/workload/fbphoto_workload_wrapper.c)
+        if (request_alias_sampler_ptr_ != NULL)
+        {
+            tmp_key_index = request_alias_sampler_ptr_->sample(*request_randgen_ptr);
+        }
+        else
+        {
+            assert(request_rejinv_sampler_ptr_ != NULL);
+            tmp_key_index = static_cast<uint32_t>(request_rejinv_sampler_ptr_->sample(*request_randgen_ptr) - 1); // Rank starts from 1
+        }
         assert(tmp_key_index < dataset_keys_.size());
 
         // Get key
@@ -667,7 +706,7 @@ namespace covered
 
         UNUSED(local_client_worker_idx);
 
-        return client_ranked_unique_key_indices_.size() - 1;
+        return dataset_keys_.size() - 1;
     }
     
     void ZipfWorkloadWrapper::getRankedKeys_(const uint32_t local_client_worker_idx, const uint32_t start_rank, const uint32_t ranked_keycnt, std::vector<std::string>& ranked_keys) const
@@ -682,8 +721,8 @@ namespace covered
         ranked_keys.clear();
         for (int i = 0; i < tmp_ranked_idxes.size(); i++)
         {
-            const uint32_t tmp_ranked_key_indices_idx = tmp_ranked_idxes[i];
-            const uint32_t tmp_ranked_key_indice = client_ranked_unique_key_indices_[tmp_ranked_key_indices_idx];
+            const uint32_t tmp_ranked_key_indice = tmp_ranked_idxes[i]; // Key index = rank - 1
+            assert(tmp_ranked_key_indice < dataset_keys_.size());
             ranked_keys.push_back(dataset_keys_[tmp_ranked_key_indice]);
         }
 
@@ -702,11 +741,7 @@ namespace covered
                 assert(client_worker_item_randgen_ptrs_[i] != NULL);
             }
 
-            assert(client_worker_reqdist_ptrs_.size() > 0);
-            for (uint32_t i = 0; i < client_worker_reqdist_ptrs_.size(); i++)
-            {
-                assert(client_worker_reqdist_ptrs_[i] != NULL);
-            }
+            assert(request_alias_sampler_ptr_ != NULL || request_rejinv_sampler_ptr_ != NULL);
 
             if (Util::needOptypeRatios(getWorkloadName_()))
             {
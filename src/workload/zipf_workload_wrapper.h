@@ -7,13 +7,15 @@
 #ifndef ZIPF_WORKLOAD_WRAPPER_H
 #define ZIPF_WORKLOAD_WRAPPER_H
 
-#include <random> // std::mt19937_64, std::discrete_distribution
+#include <random> // std::mt19937_64
 #include <string>
 #include <unordered_map>
 #include <vector>
 
+#include "workload/alias_sampler.h"
 #include "workload/workload_item.h"
 #include "workload/workload_wrapper_base.h"
+#include "workload/zipf_rejection_inversion_sampler.h"
 
 namespace covered
 {
@@ -42,6 +44,9 @@ namespace covered
     private:
         static const std::string kClassName;
 
+        static const uint32_t ALIAS_TABLE_MAX_KEYCNT; // Use rejection-inversion instead of alias table for larger key spaces
+
+        bool isRejinvSampling_() const; // Whether to sample ranks by rejection inversion (i.e., keycnt > ALIAS_TABLE_MAX_KEYCNT) without materializing per-key probs
         void loadZipfCharacteristicsFile_(); // Load Zipfian constant, key size histogram, and value size histogram (required by all roles including clients, dataset loader, and cloud)
         static std::string getKeystrFromKeyrank_(const int64_t& keyrank, const uint32_t& keysize); // Generate a key string based on the key rank with key size bytes
         static int64_t getKeyrankFromKeystr_(const std::string& keystr); // Generate a key rank based on the key string
@@ -75,18 +80,20 @@ namespace covered
 
         // (3) Const shared variables
         std::string instance_name_;
+        double zipf_constant_; // Loaded from the characteristics file
         // const float zipf_alpha_; // NOTE: we use the Zipfian constant loaded from the characteristics file, while that from CLI is ONLY used for Zipfian Facebook CDN workload to tune workload skewness
 
         // (4) Other shared variables
         // For clients, dataset loader, and cloud
         std::vector<std::string> dataset_keys_; // Client needs dataset_keys_ to sample for workload items
-        std::vector<double> dataset_probs_;
+        std::vector<double> dataset_probs_; // NOTE: dataset_probs_[i] is the prob of rank i + 1 (i.e., dataset keys are ranked by index), which is empty under rejection-inversion sampling
         std::vector<uint32_t> dataset_valsizes_; // Client needs dataset_valsizes_ to generate workload items (although NOT used by client workers due to GET requests)
         // For clients
         std::vector<std::mt19937_64*> client_worker_item_randgen_ptrs_;
-        std::vector<std::discrete_distribution<uint32_t>*> client_worker_reqdist_ptrs_; // randomly select request index from workload indices of each client
+        AliasSampler* request_alias_sampler_ptr_; // randomly select request index from dataset (shared read-only by all client workers with per-worker random generators; NULL if keycnt > ALIAS_TABLE_MAX_KEYCNT)
+        ZipfRejectionInversionSampler* request_rejinv_sampler_ptr_; // randomly select request rank without tabulating per-key probs (shared read-only by all client workers; NULL if keycnt <= ALIAS_TABLE_MAX_KEYCNT)
         // std::vector<uint32_t> workload_key_indices_; // workload indices for each client (NOTE: NO need due to directly generating workload items by power-law Zipf distribution)
-        std::vector<uint32_t> client_ranked_unique_key_indices_; // Ranked unique key indices for current client (used for dynamic workload patterns)
+        // std::vector<uint32_t> client_ranked_unique_key_indices_; // Ranked unique key indices for current client (NOTE: NO need as key index = rank - 1 for dynamic workload patterns)
 
         // (5) Optype ratios for workloads requiring them
         double read_ratio_;